@@ -18,7 +18,9 @@
 extern UART_HandleTypeDef huart1;
 
 /* Data buffer */
-__attribute__((section(".sram_noncache_bss"))) uint8_t uart1_tx_buf[256];
+__attribute__((section(".sram_noncache_bss"))) uint8_t uart1_tx_buf[1024];
+static uint8_t uart1_rx_ring[256];
+static uint32_t uart1_rx_pos = 0;           // DMA buffer position already copied to rx_buffer
 
 
 /* Declear instance */
@@ -45,13 +47,16 @@ __attribute__((section(".fast_code"))) void async_uart_callback(void *hw_instanc
     {
         if (event == AU_EVENT_TRASNMIT_COMPLETE)
         {
+            // The DMA is done with these bytes only now, before they may be overwritten
+            rb_read_commit(&(uart1.tx_buffer), uart1.tx_sending);
+            uart1.tx_sending = 0;
             if(rb_get_count(&(uart1.tx_buffer)) > 0)
             {
                 uint8_t *send_data_ptr = NULL;
                 uint32_t send_len = 0;
                 rb_read_nocopy(&(uart1.tx_buffer), &send_data_ptr, &send_len);
+                uart1.tx_sending = send_len;
                 platform_uart_async_send(uart1.hw_instance, send_data_ptr, send_len);
-                rb_read_commit(&(uart1.tx_buffer), send_len);
             }
             else
             {
@@ -73,7 +78,8 @@ void async_uart_init(void)
     /* uart1 initialize */
     rb_init(&(uart1.tx_buffer), uart1_tx_buf, sizeof(uart1_tx_buf));
     uart1.tx_status = ASYNC_UART_IDLE;
-    // uart1.rx_buffer = NULL;  
+    uart1.tx_sending = 0;
+    rb_init(&(uart1.rx_buffer), uart1_rx_ring, sizeof(uart1_rx_ring));
     uart1.rx_status = ASYNC_UART_IDLE;
     uart1.hw_instance = (void *)&huart1;
 }
@@ -83,14 +89,20 @@ int32_t async_uart_send(async_uart_instance_t *instance, uint8_t *data, uint32_t
     uint8_t *send_data_ptr = NULL;
     uint32_t send_len = 0;
     int32_t written_len = 0;
+    uint32_t primask;
 
     if(instance == NULL || data == NULL || len == 0)
     {
         return -1;
     }
 
+    // The TX complete interrupt updates the same ring buffer
+    primask = __get_PRIMASK();
+    __disable_irq();
+
     if(len > rb_get_free(&(instance->tx_buffer)))
     {
+        __set_PRIMASK(primask);
         return -2;  // Not enough space in buffer
     }
 
@@ -104,16 +116,71 @@ int32_t async_uart_send(async_uart_instance_t *instance, uint8_t *data, uint32_t
         {
             instance->tx_status = ASYNC_UART_BUSY;
             rb_read_nocopy(&(instance->tx_buffer), &send_data_ptr, &send_len);
+            instance->tx_sending = send_len;    // Committed by the TX complete callback
             
             platform_uart_async_send(instance->hw_instance, send_data_ptr, send_len);
-
-            rb_read_commit(&(instance->tx_buffer), send_len);
         }
     }
+    __set_PRIMASK(primask);
 
     return written_len;            
 }
 
+__attribute__((section(".fast_code"))) void async_uart_rx_callback(void *hw_instance, const uint8_t *dma_buf, uint32_t dma_size, uint32_t pos)
+{
+    if(((UART_HandleTypeDef *)hw_instance)->Instance == USART1)
+    {
+        // Circular DMA: the new bytes are from the last position to pos, maybe wrapped
+        if(pos >= dma_size)
+        {
+            pos = 0;
+        }
+        while(uart1_rx_pos != pos)
+        {
+            uint32_t end = (pos > uart1_rx_pos) ? pos : dma_size;
+            uint32_t len = end - uart1_rx_pos;
+
+            if(rb_write(&(uart1.rx_buffer), &dma_buf[uart1_rx_pos], len) != len)
+            {
+                uart1.rx_status = ASYNC_UART_OVERFLOW;
+            }
+            uart1_rx_pos = (end == dma_size) ? 0 : end;
+        }
+    }
+}
+
+uint32_t async_uart_read_line(async_uart_instance_t *instance, char *line, uint32_t size)
+{
+    uint32_t count;
+    uint32_t primask;
+
+    if(instance == NULL || line == NULL || size < 2)
+    {
+        return 0;
+    }
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    count = rb_peek(&(instance->rx_buffer), (uint8_t *)line, size - 1);
+    for(uint32_t i = 0; i < count; i++)
+    {
+        if(line[i] == '\r' || line[i] == '\n')
+        {
+            rb_skip(&(instance->rx_buffer), i + 1);
+            __set_PRIMASK(primask);
+            line[i] = '\0';
+            return i;       // An empty line (the \n of \r\n) returns 0 as well
+        }
+    }
+    if(count == size - 1)
+    {
+        rb_skip(&(instance->rx_buffer), count);     // Longer than the line buffer: drop it
+    }
+    __set_PRIMASK(primask);
+
+    return 0;
+}
+
 
 
 /* Application code */
@@ -33,6 +33,7 @@ typedef struct
     void                *hw_instance;
     async_uart_status   tx_status;
     ring_buffer_t       tx_buffer;
+    uint32_t            tx_sending;     // Bytes the DMA is reading, freed when it completes
     async_uart_status   rx_status;
     ring_buffer_t       rx_buffer;
 }async_uart_instance_t;
@@ -42,5 +43,10 @@ __attribute__((section(".fast_code"))) void async_uart_callback(void *hw_instanc
 int32_t async_uart_send(async_uart_instance_t *instance, uint8_t *data, uint32_t len);
 void async_usart_printf(async_uart_instance_t *instance, const char *__format, ...);
 
+/* Receive: dma_buf is the circular DMA buffer, pos the reception position from HAL_UARTEx_RxEventCallback */
+__attribute__((section(".fast_code"))) void async_uart_rx_callback(void *hw_instance, const uint8_t *dma_buf, uint32_t dma_size, uint32_t pos);
+/* Take one received line without the line end, returns its length, 0 if no complete line yet */
+uint32_t async_uart_read_line(async_uart_instance_t *instance, char *line, uint32_t size);
+
 
 #endif /* __ASYNC_UART_H__ */
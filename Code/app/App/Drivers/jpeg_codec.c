@@ -0,0 +1,108 @@
+/**
+ * @file jpeg_codec.c
+ * @brief JPEG frame header parsing shared by the hardware and software decoders
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include "jpeg_codec.h"
+
+#define JPEG_SOF0                       0xC0
+#define JPEG_DHT                        0xC4
+#define JPEG_DAC                        0xCC
+#define JPEG_SOI                        0xD8
+#define JPEG_EOI                        0xD9
+#define JPEG_SOS                        0xDA
+#define JPEG_DRI                        0xDD
+
+static inline uint32_t jpeg_be16(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 8) | p[1];
+}
+
+static jpeg_codec_error_t jpeg_sof(const uint8_t *p, uint32_t len, jpeg_info_t *info)
+{
+    uint32_t h, v;
+
+    if (len < 6U || (p[5] == 3U && len < 15U)) {
+        return JPEG_CODEC_ERR_DATA;
+    }
+    if (p[0] != 8U || p[5] != 3U || p[10] != 0x11U || p[13] != 0x11U) {
+        return JPEG_CODEC_ERR_FORMAT;                       // 8 bit, YCbCr, chroma not sub-sampled in its MCU
+    }
+    h = p[7] >> 4;
+    v = p[7] & 0x0FU;
+    if (h == 1U && v == 1U) {
+        info->css = JPEG_CSS_444;
+    } else if (h == 2U && v == 1U) {
+        info->css = JPEG_CSS_422;
+    } else if (h == 2U && v == 2U) {
+        info->css = JPEG_CSS_420;
+    } else {
+        return JPEG_CODEC_ERR_FORMAT;
+    }
+    info->height = (uint16_t)jpeg_be16(p + 1);
+    info->width = (uint16_t)jpeg_be16(p + 3);
+    if (info->width == 0U || info->height == 0U) {
+        return JPEG_CODEC_ERR_FORMAT;                       // Height in a DNL marker
+    }
+    info->mcu_w = (uint8_t)(8U * h);
+    info->mcu_h = (uint8_t)(8U * v);
+    info->mcu_bytes = (uint16_t)((h * v + 2U) * 64U);
+    info->mcu_cols = (uint16_t)((info->width + info->mcu_w - 1U) / info->mcu_w);
+    info->mcu_rows = (uint16_t)((info->height + info->mcu_h - 1U) / info->mcu_h);
+    return JPEG_CODEC_OK;
+}
+
+jpeg_codec_error_t jpeg_codec_info(const uint8_t *data, uint32_t size, jpeg_info_t *info)
+{
+    bool sof = false;
+    uint32_t i = 2;
+
+    if (data == NULL || info == NULL) {
+        return JPEG_CODEC_ERR_PARAM;
+    }
+    memset(info, 0, sizeof(*info));
+    if (size < 4U || data[0] != 0xFFU || data[1] != JPEG_SOI) {
+        return JPEG_CODEC_ERR_DATA;
+    }
+
+    while (i + 4U <= size) {
+        uint32_t marker = data[i + 1], len;
+
+        if (data[i] != 0xFFU) {
+            return JPEG_CODEC_ERR_DATA;
+        }
+        if (marker == 0xFFU) {                              // Fill byte
+            i++;
+            continue;
+        }
+        if (marker == JPEG_EOI) {
+            return JPEG_CODEC_ERR_DATA;
+        }
+        len = jpeg_be16(data + i + 2);
+        if (len < 2U || len > size - i - 2U) {
+            return JPEG_CODEC_ERR_DATA;
+        }
+
+        if (marker == JPEG_SOF0) {
+            jpeg_codec_error_t err = jpeg_sof(data + i + 4, len - 2U, info);
+
+            if (err != JPEG_CODEC_OK) {
+                return err;
+            }
+            sof = true;
+        } else if (marker > JPEG_SOF0 && marker <= 0xCFU && marker != JPEG_DHT && marker != JPEG_DAC) {
+            return JPEG_CODEC_ERR_FORMAT;                   // Extended, progressive, lossless, arithmetic
+        } else if (marker == JPEG_DRI && len >= 4U) {
+            info->restart = (uint16_t)jpeg_be16(data + i + 4);
+        } else if (marker == JPEG_SOS) {
+            return sof ? JPEG_CODEC_OK : JPEG_CODEC_ERR_DATA;
+        }
+        i += 2U + len;
+    }
+    return JPEG_CODEC_ERR_DATA;
+}
@@ -0,0 +1,107 @@
+/**
+ * @file jpeg_codec.h
+ * @brief Baseline JPEG decoding to YCbCr MCU blocks, hardware codec + MDMA or software back end
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note Both back ends write the output format of the JPEG codec: for every
+ *       MCU its 8x8 Y blocks in raster order, then one Cb and one Cr block.
+ *       DMA2D converts that to RGB565 in YCbCr mode. Output is cut in chunks
+ *       of whole MCU rows written to two buffers in turns: chunk k goes to
+ *       out[k & 1] and the codec only starts chunk k + 2 once chunk k has
+ *       been released, so DMA2D converts one buffer while the other fills.
+ *
+ *       jpeg_codec_hw.c drives the codec with two MDMA channels triggered by
+ *       the FIFO thresholds (input from the frame, output to the chunk
+ *       buffers), the CPU only re-arms the output channel between chunks.
+ *       jpeg_codec_sw.c decodes on the CPU when a chunk is waited for. The
+ *       host build links the software decoder; the firmware links the
+ *       hardware one unless configured with -DAPP_JPEG_SOFT=ON.
+ *
+ *       Supported: 8 bit baseline (SOF0), three interleaved components,
+ *       4:4:4, 4:2:2 and 4:2:0, restart intervals. Every frame carries its
+ *       own quantisation and Huffman tables (MJPEG without DHT is refused).
+ */
+
+#ifndef __JPEG_CODEC_H__
+#define __JPEG_CODEC_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define JPEG_CODEC_TIMEOUT_MS           100         // Hardware: longest wait for one chunk
+
+/* Same values as DMA2D_NO_CSS / DMA2D_CSS_422 / DMA2D_CSS_420 */
+typedef enum {
+    JPEG_CSS_444 = 0,
+    JPEG_CSS_422,
+    JPEG_CSS_420,
+} jpeg_css_t;
+
+typedef enum {
+    JPEG_CODEC_OK = 0,
+    JPEG_CODEC_ERR_PARAM,
+    JPEG_CODEC_ERR_FORMAT,                          // Not baseline YCbCr, or sub-sampling not supported
+    JPEG_CODEC_ERR_DATA,                            // Broken stream
+    JPEG_CODEC_ERR_TIMEOUT,
+} jpeg_codec_error_t;
+
+typedef struct {
+    uint16_t    width;
+    uint16_t    height;
+    uint8_t     css;                                // jpeg_css_t
+    uint8_t     mcu_w;                              // MCU size in pixels
+    uint8_t     mcu_h;
+    uint16_t    mcu_bytes;                          // 192 (4:4:4), 256 (4:2:2), 384 (4:2:0)
+    uint16_t    mcu_cols;                           // MCUs per MCU row
+    uint16_t    mcu_rows;
+    uint16_t    restart;                            // Restart interval in MCUs, 0: none
+} jpeg_info_t;
+
+/**
+ * @brief Read the frame header (up to SOS) and check the back ends can decode it
+ */
+jpeg_codec_error_t jpeg_codec_info(const uint8_t *data, uint32_t size, jpeg_info_t *info);
+
+/**
+ * @brief Clocks, MDMA channels and interrupts of the hardware codec, nothing for the software one
+ */
+void jpeg_codec_init(void);
+
+/**
+ * @brief Start decoding a frame
+ * @param data       whole frame SOI..EOI, readable by MDMA (not DTCM, cleaned from the D-cache),
+ *                   read in whole words: a few bytes past its end are read too
+ * @param info       from jpeg_codec_info()
+ * @param out        two chunk buffers of chunk_rows MCU rows each, non-cacheable or invalidated by the caller
+ * @param chunk_rows MCU rows per chunk
+ */
+jpeg_codec_error_t jpeg_codec_start(const uint8_t *data, uint32_t size, const jpeg_info_t *info,
+                                    uint8_t *const out[2], uint16_t chunk_rows);
+
+/**
+ * @brief Wait until chunk k (0, 1, ...) is in out[k & 1]
+ * @note  Chunks are waited for in order, chunk k - 2 must have been released.
+ */
+jpeg_codec_error_t jpeg_codec_wait(uint32_t chunk);
+
+/**
+ * @brief Give the buffer of chunk k back to the codec
+ */
+void jpeg_codec_release(uint32_t chunk);
+
+/**
+ * @brief End of the frame or abort, the codec is idle afterwards
+ * @return error of the frame, JPEG_CODEC_ERR_DATA if it was stopped before the last chunk
+ */
+jpeg_codec_error_t jpeg_codec_stop(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __JPEG_CODEC_H__ */
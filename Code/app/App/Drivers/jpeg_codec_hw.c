@@ -0,0 +1,217 @@
+/**
+ * @file jpeg_codec_hw.c
+ * @brief JPEG decoding with the hardware codec, input and output moved by MDMA
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note The codec is programmed at register level (the HAL JPEG driver is not
+ *       part of this project), the MDMA channels through the HAL MDMA driver.
+ *       On the STM32H7 the MDMA requests are the codec FIFO threshold flags:
+ *       the input channel writes 32 bytes to DIR whenever the input FIFO is
+ *       half empty, the output channel reads 32 bytes from DOR whenever the
+ *       output FIFO is half full. When no output buffer is armed the output
+ *       FIFO fills up and the codec simply stalls, which is how a chunk
+ *       buffer still being converted by DMA2D holds decoding back.
+ *
+ *       Header processing is done by the codec (CONFR1.HDR), tables come
+ *       from the stream. MCU rows are multiples of 64 bytes, so every chunk
+ *       drains through threshold requests and nothing is left in the FIFO.
+ */
+
+#include <stddef.h>
+#include "main.h"
+#include "jpeg_codec.h"
+
+#define HW_BLOCK_MAX                    65536U      // MDMA block length, bytes
+
+MDMA_HandleTypeDef hmdma_jpeg_infifo_th;
+MDMA_HandleTypeDef hmdma_jpeg_outfifo_th;
+
+static uint8_t     *hw_out[2];
+static uint32_t     hw_chunks;
+static uint32_t     hw_chunk_bytes;
+static uint32_t     hw_last_bytes;
+static volatile uint32_t hw_done;                   // Chunks written
+static volatile uint32_t hw_armed;                  // Chunks the output channel was started for
+static volatile uint32_t hw_released;
+static volatile bool hw_error;
+
+/* Output channel to the buffer of the next chunk, IRQ context or interrupts masked */
+static void hw_arm(uint32_t chunk)
+{
+    uint32_t bytes = (chunk + 1U == hw_chunks) ? hw_last_bytes : hw_chunk_bytes;
+
+    hw_armed = chunk + 1U;
+    if (HAL_MDMA_Start_IT(&hmdma_jpeg_outfifo_th, (uint32_t)&JPEG->DOR, (uint32_t)hw_out[chunk & 1U], bytes, 1) != HAL_OK) {
+        hw_error = true;
+    }
+}
+
+/* Chunk k + 2 reuses the buffer of chunk k */
+static inline bool hw_can_arm(uint32_t chunk)
+{
+    return chunk < hw_chunks && hw_armed == chunk && hw_released + 1U >= chunk;
+}
+
+static void hw_out_cplt(MDMA_HandleTypeDef *hmdma)
+{
+    hw_done++;
+    if (hw_can_arm(hw_done)) {
+        hw_arm(hw_done);
+    }
+}
+
+static void hw_mdma_error(MDMA_HandleTypeDef *hmdma)
+{
+    hw_error = true;
+}
+
+void jpeg_codec_init(void)
+{
+    __HAL_RCC_JPGDECEN_CLK_ENABLE();
+    __HAL_RCC_MDMA_CLK_ENABLE();
+
+    /* Frame -> DIR, 32 bytes per input FIFO threshold request */
+    hmdma_jpeg_infifo_th.Instance = MDMA_Channel7;
+    hmdma_jpeg_infifo_th.Init.Request = MDMA_REQUEST_JPEG_INFIFO_TH;
+    hmdma_jpeg_infifo_th.Init.TransferTriggerMode = MDMA_BUFFER_TRANSFER;
+    hmdma_jpeg_infifo_th.Init.Priority = MDMA_PRIORITY_HIGH;
+    hmdma_jpeg_infifo_th.Init.Endianness = MDMA_LITTLE_ENDIANNESS_PRESERVE;
+    hmdma_jpeg_infifo_th.Init.SourceInc = MDMA_SRC_INC_BYTE;
+    hmdma_jpeg_infifo_th.Init.DestinationInc = MDMA_DEST_INC_DISABLE;
+    hmdma_jpeg_infifo_th.Init.SourceDataSize = MDMA_SRC_DATASIZE_BYTE;
+    hmdma_jpeg_infifo_th.Init.DestDataSize = MDMA_DEST_DATASIZE_WORD;
+    hmdma_jpeg_infifo_th.Init.DataAlignment = MDMA_DATAALIGN_PACKENABLE;
+    hmdma_jpeg_infifo_th.Init.BufferTransferLength = 32;
+    hmdma_jpeg_infifo_th.Init.SourceBurst = MDMA_SOURCE_BURST_32BEATS;
+    hmdma_jpeg_infifo_th.Init.DestBurst = MDMA_DEST_BURST_8BEATS;
+    hmdma_jpeg_infifo_th.Init.SourceBlockAddressOffset = 0;
+    hmdma_jpeg_infifo_th.Init.DestBlockAddressOffset = 0;
+    if (HAL_MDMA_Init(&hmdma_jpeg_infifo_th) != HAL_OK)
+    {
+        Error_Handler();
+    }
+
+    /* DOR -> chunk buffer, 32 bytes per output FIFO threshold request */
+    hmdma_jpeg_outfifo_th.Instance = MDMA_Channel6;
+    hmdma_jpeg_outfifo_th.Init.Request = MDMA_REQUEST_JPEG_OUTFIFO_TH;
+    hmdma_jpeg_outfifo_th.Init.TransferTriggerMode = MDMA_BUFFER_TRANSFER;
+    hmdma_jpeg_outfifo_th.Init.Priority = MDMA_PRIORITY_VERY_HIGH;
+    hmdma_jpeg_outfifo_th.Init.Endianness = MDMA_LITTLE_ENDIANNESS_PRESERVE;
+    hmdma_jpeg_outfifo_th.Init.SourceInc = MDMA_SRC_INC_DISABLE;
+    hmdma_jpeg_outfifo_th.Init.DestinationInc = MDMA_DEST_INC_BYTE;
+    hmdma_jpeg_outfifo_th.Init.SourceDataSize = MDMA_SRC_DATASIZE_WORD;
+    hmdma_jpeg_outfifo_th.Init.DestDataSize = MDMA_DEST_DATASIZE_BYTE;
+    hmdma_jpeg_outfifo_th.Init.DataAlignment = MDMA_DATAALIGN_PACKENABLE;
+    hmdma_jpeg_outfifo_th.Init.BufferTransferLength = 32;
+    hmdma_jpeg_outfifo_th.Init.SourceBurst = MDMA_SOURCE_BURST_8BEATS;
+    hmdma_jpeg_outfifo_th.Init.DestBurst = MDMA_DEST_BURST_32BEATS;
+    hmdma_jpeg_outfifo_th.Init.SourceBlockAddressOffset = 0;
+    hmdma_jpeg_outfifo_th.Init.DestBlockAddressOffset = 0;
+    if (HAL_MDMA_Init(&hmdma_jpeg_outfifo_th) != HAL_OK)
+    {
+        Error_Handler();
+    }
+    hmdma_jpeg_infifo_th.XferErrorCallback = hw_mdma_error;
+    hmdma_jpeg_outfifo_th.XferCpltCallback = hw_out_cplt;
+    hmdma_jpeg_outfifo_th.XferErrorCallback = hw_mdma_error;
+
+    HAL_NVIC_SetPriority(MDMA_IRQn, 1, 0);
+    HAL_NVIC_EnableIRQ(MDMA_IRQn);
+
+    JPEG->CR = JPEG_CR_JCEN;                                // Codec on, interrupts off: MDMA only
+    JPEG->CONFR0 = 0;
+    JPEG->CONFR1 = JPEG_CONFR1_DE | JPEG_CONFR1_HDR;        // Decode, header parsed by the codec
+    JPEG->CR |= JPEG_CR_IFF | JPEG_CR_OFF;
+    JPEG->CFR = JPEG_CFR_CEOCF | JPEG_CFR_CHPDF;
+}
+
+jpeg_codec_error_t jpeg_codec_start(const uint8_t *data, uint32_t size, const jpeg_info_t *info,
+                                    uint8_t *const out[2], uint16_t chunk_rows)
+{
+    uint32_t row_bytes, in_bytes, blocks;
+
+    if (data == NULL || info == NULL || out == NULL || out[0] == NULL || out[1] == NULL || chunk_rows == 0U ||
+        (((uint32_t)out[0] | (uint32_t)out[1]) & 3U) != 0U) {
+        return JPEG_CODEC_ERR_PARAM;
+    }
+    row_bytes = (uint32_t)info->mcu_cols * info->mcu_bytes;
+    hw_out[0] = out[0];
+    hw_out[1] = out[1];
+    hw_chunks = (info->mcu_rows + chunk_rows - 1U) / chunk_rows;
+    hw_chunk_bytes = row_bytes * chunk_rows;
+    hw_last_bytes = row_bytes * (info->mcu_rows - (hw_chunks - 1U) * chunk_rows);
+    if (hw_chunk_bytes > HW_BLOCK_MAX) {
+        return JPEG_CODEC_ERR_PARAM;
+    }
+
+    /* Whole words, split in equal MDMA blocks: reads at most a few bytes past the end of the frame */
+    in_bytes = (size + 3U) & ~3U;
+    blocks = (in_bytes + HW_BLOCK_MAX - 1U) / HW_BLOCK_MAX;
+    in_bytes = (((in_bytes + blocks - 1U) / blocks) + 3U) & ~3U;
+
+    JPEG->CONFR0 = 0;
+    JPEG->CR |= JPEG_CR_IFF | JPEG_CR_OFF;
+    JPEG->CFR = JPEG_CFR_CEOCF | JPEG_CFR_CHPDF;
+
+    hw_done = 0;
+    hw_armed = 0;
+    hw_released = 0;
+    hw_error = false;
+    hw_arm(0);
+    if (HAL_MDMA_Start_IT(&hmdma_jpeg_infifo_th, (uint32_t)data, (uint32_t)&JPEG->DIR, in_bytes, blocks) != HAL_OK) {
+        jpeg_codec_stop();
+        return JPEG_CODEC_ERR_PARAM;
+    }
+    JPEG->CONFR0 = JPEG_CONFR0_START;
+    return JPEG_CODEC_OK;
+}
+
+jpeg_codec_error_t jpeg_codec_wait(uint32_t chunk)
+{
+    uint32_t tick = HAL_GetTick();
+
+    while (hw_done <= chunk) {
+        if (hw_error) {
+            return JPEG_CODEC_ERR_DATA;
+        }
+        if (chunk >= hw_chunks || HAL_GetTick() - tick > JPEG_CODEC_TIMEOUT_MS) {
+            return (chunk >= hw_chunks) ? JPEG_CODEC_ERR_PARAM : JPEG_CODEC_ERR_TIMEOUT;
+        }
+        __WFI();                                            // MDMA or SysTick
+    }
+    return hw_error ? JPEG_CODEC_ERR_DATA : JPEG_CODEC_OK;
+}
+
+void jpeg_codec_release(uint32_t chunk)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    if (chunk + 1U > hw_released) {
+        hw_released = chunk + 1U;
+    }
+    if (hw_can_arm(hw_done)) {
+        hw_arm(hw_done);
+    }
+    if (!primask) {
+        __enable_irq();
+    }
+}
+
+jpeg_codec_error_t jpeg_codec_stop(void)
+{
+    jpeg_codec_error_t err = (hw_error || hw_done < hw_chunks) ? JPEG_CODEC_ERR_DATA : JPEG_CODEC_OK;
+
+    JPEG->CONFR0 = 0;
+    if (HAL_MDMA_GetState(&hmdma_jpeg_infifo_th) == HAL_MDMA_STATE_BUSY) {
+        HAL_MDMA_Abort(&hmdma_jpeg_infifo_th);              // Bytes after EOI, or a broken frame
+    }
+    if (HAL_MDMA_GetState(&hmdma_jpeg_outfifo_th) == HAL_MDMA_STATE_BUSY) {
+        HAL_MDMA_Abort(&hmdma_jpeg_outfifo_th);
+    }
+    JPEG->CR |= JPEG_CR_IFF | JPEG_CR_OFF;
+    JPEG->CFR = JPEG_CFR_CEOCF | JPEG_CFR_CHPDF;
+    hw_chunks = 0;
+    return err;
+}
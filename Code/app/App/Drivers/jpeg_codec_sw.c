@@ -0,0 +1,477 @@
+/**
+ * @file jpeg_codec_sw.c
+ * @brief Software baseline JPEG decoder with the output format of the hardware codec
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note Huffman decoding through a 9 bit lookup table (longer codes walk the
+ *       canonical code bounds), dequantisation while de-zigzagging, and the
+ *       integer LLM IDCT (13 bit constants, the libjpeg "islow" factorisation)
+ *       with a DC only shortcut for columns. A chunk is decoded when it is
+ *       waited for, so the DMA2D conversion of the previous chunk overlaps it.
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include "jpeg_codec.h"
+
+#define SW_FAST_BITS                    9
+#define SW_TABLES                       4
+
+typedef struct {
+    uint16_t    fast[1U << SW_FAST_BITS];           // (length << 8) | symbol, 0: longer code
+    int32_t     maxcode[17];                        // Largest code of each length
+    int32_t     delta[17];                          // Symbol index - code, per length
+    uint8_t     symbols[256];
+} sw_huff_t;
+
+typedef struct {
+    uint8_t     quant;
+    uint8_t     dc;
+    uint8_t     ac;
+    int32_t     pred;
+} sw_comp_t;
+
+typedef struct {
+    const uint8_t   *p;
+    const uint8_t   *end;
+    uint32_t        bits;                           // MSB first
+    int32_t         nbits;
+    bool            marker;                         // Stopped in front of a marker
+} sw_bits_t;
+
+static const uint8_t sw_zigzag[64] = {
+     0,  1,  8, 16,  9,  2,  3, 10, 17, 24, 32, 25, 18, 11,  4,  5,
+    12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13,  6,  7, 14, 21, 28,
+    35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+    58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63,
+};
+
+static uint16_t     sw_quant[SW_TABLES][64];        // Zigzag order
+static sw_huff_t    sw_dc[SW_TABLES];
+static sw_huff_t    sw_ac[SW_TABLES];
+static sw_comp_t    sw_comp[3];
+static sw_bits_t    sw_in;
+static jpeg_info_t  sw_info;
+static uint8_t     *sw_out[2];
+static uint16_t     sw_chunk_rows;
+static uint32_t     sw_chunks;
+static uint32_t     sw_done;                        // Chunks decoded
+static uint32_t     sw_released;
+static uint32_t     sw_todo;                        // MCUs to the next restart marker
+static jpeg_codec_error_t sw_error;
+
+static inline uint32_t sw_be16(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 8) | p[1];
+}
+
+static bool sw_huff_build(sw_huff_t *h, const uint8_t *counts, const uint8_t *symbols, uint32_t n)
+{
+    uint32_t code = 0, k = 0;
+
+    memset(h->fast, 0, sizeof(h->fast));
+    memcpy(h->symbols, symbols, n);
+    for (uint32_t len = 1; len <= 16U; len++) {
+        h->delta[len] = (int32_t)k - (int32_t)code;
+        for (uint32_t i = 0; i < counts[len - 1U]; i++, k++, code++) {
+            if (len <= SW_FAST_BITS) {
+                uint32_t first = code << (SW_FAST_BITS - len);
+
+                for (uint32_t j = 0; j < (1U << (SW_FAST_BITS - len)); j++) {
+                    h->fast[first + j] = (uint16_t)((len << 8) | symbols[k]);
+                }
+            }
+        }
+        if (code > (1U << len)) {
+            return false;
+        }
+        h->maxcode[len] = (int32_t)code - 1;
+        code <<= 1;
+    }
+    return true;
+}
+
+static jpeg_codec_error_t sw_tables(const uint8_t *p, uint32_t len, uint32_t marker)
+{
+    while (len > 0U) {
+        uint32_t id = p[0] & 0x0FU, n = 0;
+
+        if (marker == 0xDBU) {                              // DQT, 8 bit entries only
+            if ((p[0] >> 4) != 0U || id >= SW_TABLES || len < 65U) {
+                return JPEG_CODEC_ERR_FORMAT;
+            }
+            for (uint32_t i = 0; i < 64U; i++) {
+                sw_quant[id][i] = p[1 + i];
+            }
+            p += 65;
+            len -= 65U;
+            continue;
+        }
+        if (id >= SW_TABLES || len < 17U) {                 // DHT
+            return JPEG_CODEC_ERR_DATA;
+        }
+        for (uint32_t i = 0; i < 16U; i++) {
+            n += p[1 + i];
+        }
+        if (n > 256U || len < 17U + n ||
+            !sw_huff_build((p[0] >> 4) ? &sw_ac[id] : &sw_dc[id], p + 1, p + 17, n)) {
+            return JPEG_CODEC_ERR_DATA;
+        }
+        p += 17U + n;
+        len -= 17U + n;
+    }
+    return JPEG_CODEC_OK;
+}
+
+/* Tables and scan header, leaves sw_in at the entropy coded data */
+static jpeg_codec_error_t sw_header(const uint8_t *data, uint32_t size)
+{
+    uint32_t i = 2;
+    uint8_t ids[3] = { 0 };
+
+    while (i + 4U <= size) {
+        uint32_t marker = data[i + 1], len;
+        const uint8_t *p = data + i + 4;
+        jpeg_codec_error_t err;
+
+        if (marker == 0xFFU) {
+            i++;
+            continue;
+        }
+        len = sw_be16(data + i + 2);
+        if (data[i] != 0xFFU || len < 2U || len > size - i - 2U) {
+            return JPEG_CODEC_ERR_DATA;
+        }
+        len -= 2U;
+        switch (marker) {
+        case 0xC0:                                          // SOF0, geometry checked by jpeg_codec_info()
+            for (uint32_t c = 0; c < 3U; c++) {
+                ids[c] = p[6 + 3 * c];
+                sw_comp[c].quant = p[8 + 3 * c] & 3U;
+            }
+            break;
+        case 0xC4:
+        case 0xDB:
+            if ((err = sw_tables(p, len, marker)) != JPEG_CODEC_OK) {
+                return err;
+            }
+            break;
+        case 0xDA:                                          // SOS, one interleaved scan
+            if (len < 10U || p[0] != 3U) {
+                return JPEG_CODEC_ERR_FORMAT;
+            }
+            for (uint32_t c = 0; c < 3U; c++) {
+                if (p[1 + 2 * c] != ids[c]) {
+                    return JPEG_CODEC_ERR_FORMAT;
+                }
+                sw_comp[c].dc = (p[2 + 2 * c] >> 4) & 3U;
+                sw_comp[c].ac = p[2 + 2 * c] & 3U;
+                sw_comp[c].pred = 0;
+            }
+            sw_in.p = p + len;
+            sw_in.end = data + size;
+            return JPEG_CODEC_OK;
+        default:
+            break;
+        }
+        i += 2U + len + 2U;
+    }
+    return JPEG_CODEC_ERR_DATA;
+}
+
+static inline void sw_fill(sw_bits_t *b)
+{
+    while (b->nbits <= 24) {
+        uint32_t c = 0;
+
+        if (!b->marker && b->p < b->end) {
+            c = *b->p;
+            if (c != 0xFFU) {
+                b->p++;
+            } else if (b->p + 1 < b->end && b->p[1] == 0x00U) {
+                b->p += 2;                                  // Stuffed byte
+            } else {
+                b->marker = true;                           // Zeros from here
+                c = 0;
+            }
+        }
+        b->bits |= c << (24 - b->nbits);
+        b->nbits += 8;
+    }
+}
+
+static inline uint32_t sw_get(sw_bits_t *b, uint32_t n)
+{
+    uint32_t v = b->bits >> (32U - n);
+
+    b->bits <<= n;
+    b->nbits -= (int32_t)n;
+    return v;
+}
+
+static inline int32_t sw_decode(sw_bits_t *b, const sw_huff_t *h)
+{
+    uint32_t e;
+
+    sw_fill(b);
+    e = h->fast[b->bits >> (32 - SW_FAST_BITS)];
+    if (e != 0U) {
+        sw_get(b, e >> 8);
+        return (int32_t)(e & 0xFFU);
+    }
+    for (uint32_t len = SW_FAST_BITS + 1; len <= 16U; len++) {
+        int32_t code = (int32_t)(b->bits >> (32U - len));
+
+        if (code <= h->maxcode[len]) {
+            sw_get(b, len);
+            return h->symbols[(code + h->delta[len]) & 0xFF];
+        }
+    }
+    return -1;
+}
+
+/* Receive and extend: s bits of a signed magnitude, s in 1..15 */
+static inline int32_t sw_value(sw_bits_t *b, uint32_t s)
+{
+    uint32_t v;
+
+    sw_fill(b);
+    v = sw_get(b, s);
+    return (v < (1U << (s - 1U))) ? (int32_t)v - (int32_t)(1U << s) + 1 : (int32_t)v;
+}
+
+#define SW_FIX(x)                       ((int32_t)((x) * 8192.0 + 0.5))
+
+/* One LLM pass over 8 values spaced by step, out[] in natural order, before the final shift */
+#define SW_IDCT_1D(s0, s1, s2, s3, s4, s5, s6, s7)                          \
+    int32_t t0, t1, t2, t3, p1, p2, p3, p4, p5, x0, x1, x2, x3;             \
+    p1 = ((s2) + (s6)) * SW_FIX(0.541196100);                               \
+    t2 = p1 + (s6) * SW_FIX(-1.847759065);                                  \
+    t3 = p1 + (s2) * SW_FIX(0.765366865);                                   \
+    t0 = ((s0) + (s4)) * 8192;                                              \
+    t1 = ((s0) - (s4)) * 8192;                                              \
+    x0 = t0 + t3;                                                           \
+    x3 = t0 - t3;                                                           \
+    x1 = t1 + t2;                                                           \
+    x2 = t1 - t2;                                                           \
+    t0 = (s7);                                                              \
+    t1 = (s5);                                                              \
+    t2 = (s3);                                                              \
+    t3 = (s1);                                                              \
+    p3 = t0 + t2;                                                           \
+    p4 = t1 + t3;                                                           \
+    p1 = t0 + t3;                                                           \
+    p2 = t1 + t2;                                                           \
+    p5 = (p3 + p4) * SW_FIX(1.175875602);                                   \
+    t0 *= SW_FIX(0.298631336);                                              \
+    t1 *= SW_FIX(2.053119869);                                              \
+    t2 *= SW_FIX(3.072711026);                                              \
+    t3 *= SW_FIX(1.501321110);                                              \
+    p1 = p5 + p1 * SW_FIX(-0.899976223);                                    \
+    p2 = p5 + p2 * SW_FIX(-2.562915447);                                    \
+    p3 *= SW_FIX(-1.961570560);                                             \
+    p4 *= SW_FIX(-0.390180644);                                             \
+    t3 += p1 + p4;                                                          \
+    t2 += p2 + p3;                                                          \
+    t1 += p2 + p4;                                                          \
+    t0 += p1 + p3;
+
+static inline uint8_t sw_clamp(int32_t v)
+{
+    return (uint8_t)((v < 0) ? 0 : ((v > 255) ? 255 : v));
+}
+
+static void sw_idct(const int32_t *in, uint8_t *out)
+{
+    int32_t ws[64];
+
+    /* Columns, 2 fraction bits kept */
+    for (uint32_t i = 0; i < 8U; i++) {
+        const int32_t *c = in + i;
+        int32_t *w = ws + i;
+
+        if ((c[8] | c[16] | c[24] | c[32] | c[40] | c[48] | c[56]) == 0) {
+            int32_t dc = c[0] * 4;
+
+            w[0] = w[8] = w[16] = w[24] = w[32] = w[40] = w[48] = w[56] = dc;
+            continue;
+        }
+        {
+            SW_IDCT_1D(c[0], c[8], c[16], c[24], c[32], c[40], c[48], c[56])
+            x0 += 1 << 10;
+            x1 += 1 << 10;
+            x2 += 1 << 10;
+            x3 += 1 << 10;
+            w[0]  = (x0 + t3) >> 11;
+            w[56] = (x0 - t3) >> 11;
+            w[8]  = (x1 + t2) >> 11;
+            w[48] = (x1 - t2) >> 11;
+            w[16] = (x2 + t1) >> 11;
+            w[40] = (x2 - t1) >> 11;
+            w[24] = (x3 + t0) >> 11;
+            w[32] = (x3 - t0) >> 11;
+        }
+    }
+
+    /* Rows, descale by 8 * 4 * 8192 and level shift */
+    for (uint32_t i = 0; i < 8U; i++) {
+        const int32_t *r = ws + i * 8U;
+        uint8_t *o = out + i * 8U;
+        SW_IDCT_1D(r[0], r[1], r[2], r[3], r[4], r[5], r[6], r[7])
+
+        x0 += (1 << 17) + (128 << 18);
+        x1 += (1 << 17) + (128 << 18);
+        x2 += (1 << 17) + (128 << 18);
+        x3 += (1 << 17) + (128 << 18);
+        o[0] = sw_clamp((x0 + t3) >> 18);
+        o[7] = sw_clamp((x0 - t3) >> 18);
+        o[1] = sw_clamp((x1 + t2) >> 18);
+        o[6] = sw_clamp((x1 - t2) >> 18);
+        o[2] = sw_clamp((x2 + t1) >> 18);
+        o[5] = sw_clamp((x2 - t1) >> 18);
+        o[3] = sw_clamp((x3 + t0) >> 18);
+        o[4] = sw_clamp((x3 - t0) >> 18);
+    }
+}
+
+static bool sw_block(sw_comp_t *c, uint8_t *out)
+{
+    int32_t coef[64] = { 0 };
+    const uint16_t *q = sw_quant[c->quant];
+    int32_t t = sw_decode(&sw_in, &sw_dc[c->dc]);
+
+    if (t < 0 || t > 11) {
+        return false;
+    }
+    if (t != 0) {
+        c->pred += sw_value(&sw_in, (uint32_t)t);
+    }
+    coef[0] = c->pred * q[0];
+
+    for (uint32_t k = 1; k < 64U; k++) {
+        int32_t rs = sw_decode(&sw_in, &sw_ac[c->ac]);
+        uint32_t s;
+
+        if (rs < 0) {
+            return false;
+        }
+        s = (uint32_t)rs & 0x0FU;
+        if (s == 0U) {
+            if (rs != 0xF0) {
+                break;                                      // End of block
+            }
+            k += 15U;                                       // 16 zeros
+            continue;
+        }
+        k += (uint32_t)rs >> 4;
+        if (k > 63U) {
+            return false;
+        }
+        coef[sw_zigzag[k]] = sw_value(&sw_in, s) * q[k];
+    }
+    sw_idct(coef, out);
+    return true;
+}
+
+/* Skip the padding bits and the RSTn marker, reset the predictors */
+static bool sw_restart(void)
+{
+    sw_bits_t *b = &sw_in;
+
+    while (b->p + 1 < b->end && !(b->p[0] == 0xFFU && b->p[1] >= 0xD0U && b->p[1] <= 0xD7U)) {
+        b->p++;
+    }
+    if (b->p + 1 >= b->end) {
+        return false;
+    }
+    b->p += 2;
+    b->bits = 0;
+    b->nbits = 0;
+    b->marker = false;
+    for (uint32_t c = 0; c < 3U; c++) {
+        sw_comp[c].pred = 0;
+    }
+    sw_todo = sw_info.restart;
+    return true;
+}
+
+static jpeg_codec_error_t sw_decode_rows(uint8_t *out, uint32_t rows)
+{
+    uint32_t luma = (uint32_t)sw_info.mcu_w * sw_info.mcu_h / 64U;
+
+    for (uint32_t n = rows * sw_info.mcu_cols; n > 0U; n--) {
+        if (sw_info.restart != 0U && sw_todo == 0U && !sw_restart()) {
+            return JPEG_CODEC_ERR_DATA;
+        }
+        for (uint32_t b = 0; b < luma; b++) {
+            if (!sw_block(&sw_comp[0], out + b * 64U)) {
+                return JPEG_CODEC_ERR_DATA;
+            }
+        }
+        if (!sw_block(&sw_comp[1], out + luma * 64U) || !sw_block(&sw_comp[2], out + luma * 64U + 64U)) {
+            return JPEG_CODEC_ERR_DATA;
+        }
+        out += sw_info.mcu_bytes;
+        if (sw_info.restart != 0U) {
+            sw_todo--;
+        }
+    }
+    return JPEG_CODEC_OK;
+}
+
+void jpeg_codec_init(void)
+{
+}
+
+jpeg_codec_error_t jpeg_codec_start(const uint8_t *data, uint32_t size, const jpeg_info_t *info,
+                                    uint8_t *const out[2], uint16_t chunk_rows)
+{
+    if (data == NULL || info == NULL || out == NULL || out[0] == NULL || out[1] == NULL || chunk_rows == 0U) {
+        return JPEG_CODEC_ERR_PARAM;
+    }
+    memset(&sw_in, 0, sizeof(sw_in));
+    sw_info = *info;
+    sw_out[0] = out[0];
+    sw_out[1] = out[1];
+    sw_chunk_rows = chunk_rows;
+    sw_chunks = (info->mcu_rows + chunk_rows - 1U) / chunk_rows;
+    sw_done = 0;
+    sw_released = 0;
+    sw_todo = info->restart;
+    sw_error = sw_header(data, size);
+    return sw_error;
+}
+
+jpeg_codec_error_t jpeg_codec_wait(uint32_t chunk)
+{
+    while (sw_error == JPEG_CODEC_OK && sw_done <= chunk) {
+        uint32_t rows = sw_info.mcu_rows - sw_done * sw_chunk_rows;
+
+        if (sw_done >= sw_chunks || sw_released + 1U < sw_done) {
+            return JPEG_CODEC_ERR_PARAM;                    // Past the end, or the buffer is still in use
+        }
+        sw_error = sw_decode_rows(sw_out[sw_done & 1U], (rows < sw_chunk_rows) ? rows : sw_chunk_rows);
+        sw_done++;
+    }
+    return sw_error;
+}
+
+void jpeg_codec_release(uint32_t chunk)
+{
+    if (chunk + 1U > sw_released) {
+        sw_released = chunk + 1U;
+    }
+}
+
+jpeg_codec_error_t jpeg_codec_stop(void)
+{
+    jpeg_codec_error_t err = sw_error;
+
+    if (err == JPEG_CODEC_OK && sw_done < sw_chunks) {
+        err = JPEG_CODEC_ERR_DATA;
+    }
+    sw_chunks = 0;
+    sw_error = JPEG_CODEC_ERR_PARAM;
+    return err;
+}
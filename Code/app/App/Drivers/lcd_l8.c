@@ -0,0 +1,110 @@
+/**
+ * @file lcd_l8.c
+ * @brief 8-bit indexed (L8 + CLUT) display mode with double buffering in GRAM
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note One RGB565 frame takes all 750KB of GRAM, two L8 frames fit in the
+ *       same space and LTDC only fetches half the bytes per scanline.
+ */
+
+#include <stddef.h>
+#include "lcd_l8.h"
+#include "ltdc.h"
+#include "dma2d.h"
+#include "lcd_present.h"
+
+/* DMA2D reads the CLUT over AXI, keep it out of DTCM */
+__attribute__((section(".sram_bss"))) static uint32_t lcd_l8_clut_rgb332[256];
+
+static uint8_t lcd_l8_front = 0;            // Buffer index scanned out
+static uint32_t lcd_l8_swap_seq = 0;        // lcd_present() sequence of the last swap
+
+static const uint32_t lcd_l8_fb_addr[2] = { LCD_L8_FB0_ADDR, LCD_L8_FB1_ADDR };
+
+const uint32_t *lcd_l8_default_clut(void)
+{
+    if (lcd_l8_clut_rgb332[0xFF] == 0) {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t r = (i >> 5) & 0x07;
+            uint32_t g = (i >> 2) & 0x07;
+            uint32_t b = i & 0x03;
+
+            /* Expand to 8 bits by bit replication so 0xFF maps to white */
+            r = (r << 5) | (r << 2) | (r >> 1);
+            g = (g << 5) | (g << 2) | (g >> 1);
+            b = (b << 6) | (b << 4) | (b << 2) | b;
+            lcd_l8_clut_rgb332[i] = 0xFF000000UL | (r << 16) | (g << 8) | b;
+        }
+    }
+
+    return lcd_l8_clut_rgb332;
+}
+
+int32_t lcd_l8_load_clut(const uint32_t *clut)
+{
+    if (clut == NULL) {
+        return -1;
+    }
+
+    /* CLUTWR is not shadowed, entries written outside vblank may show for one frame */
+    if (HAL_LTDC_ConfigCLUT(&hltdc, clut, 256, 0) != HAL_OK) {
+        return -1;
+    }
+    DMA2D_load_clut(clut, 256);
+
+    return 0;
+}
+
+void lcd_l8_init(void)
+{
+    lcd_l8_front = 0;
+
+    if (HAL_LTDC_SetPixelFormat(&hltdc, LTDC_PIXEL_FORMAT_L8, 0) != HAL_OK) {
+        Error_Handler();
+    }
+    if (HAL_LTDC_SetAddress(&hltdc, lcd_l8_fb_addr[0], 0) != HAL_OK) {
+        Error_Handler();
+    }
+    if (lcd_l8_load_clut(lcd_l8_default_clut()) != 0) {
+        Error_Handler();
+    }
+    if (HAL_LTDC_EnableCLUT(&hltdc, 0) != HAL_OK) {
+        Error_Handler();
+    }
+}
+
+uint32_t lcd_l8_get_draw_buffer(void)
+{
+    return lcd_l8_fb_addr[lcd_l8_front ^ 1];
+}
+
+uint32_t lcd_l8_get_show_buffer(void)
+{
+    return lcd_l8_fb_addr[lcd_l8_front];
+}
+
+bool lcd_l8_swap_pending(void)
+{
+    return !lcd_present_done(lcd_l8_swap_seq);
+}
+
+int32_t lcd_l8_swap(void)
+{
+    if (lcd_l8_swap_pending()) {
+        return -1;
+    }
+
+    lcd_l8_front ^= 1;
+
+    /* Shadow register only, LTDC latches it during the next vertical blank */
+    lcd_present_set_address(0, lcd_l8_fb_addr[lcd_l8_front]);
+    lcd_l8_swap_seq = lcd_present();
+
+    return 0;
+}
+
+void lcd_l8_wait_swap(void)
+{
+    lcd_present_wait(lcd_l8_swap_seq);
+}
@@ -0,0 +1,78 @@
+/**
+ * @file lcd_l8.h
+ * @brief 8-bit indexed (L8 + CLUT) display mode with double buffering in GRAM
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#ifndef __LCD_L8_H__
+#define __LCD_L8_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "main.h"
+
+/* Set LCD_USE_L8=1 in CMakeLists.txt to switch layer 0 to L8 at start up */
+#ifndef LCD_USE_L8
+#define LCD_USE_L8                      0
+#endif
+
+#define LCD_L8_WIDTH                    800
+#define LCD_L8_HEIGHT                   480
+#define LCD_L8_FRAME_SIZE               (LCD_L8_WIDTH * LCD_L8_HEIGHT)      // 375KB
+#define LCD_L8_FB0_ADDR                 0x24040000UL
+#define LCD_L8_FB1_ADDR                 (LCD_L8_FB0_ADDR + LCD_L8_FRAME_SIZE)
+
+/**
+ * @brief Switch LTDC layer 0 to L8, load the default RGB332 CLUT and show buffer 0
+ * @note  Call after MX_LTDC_Init() and MX_DMA2D_Init()
+ */
+void lcd_l8_init(void);
+
+/**
+ * @brief Load a 256 entry ARGB8888 palette into both LTDC layer 0 and DMA2D
+ * @param clut palette, must be readable by DMA2D (not in DTCM)
+ * @return 0 on success, -1 on error
+ */
+int32_t lcd_l8_load_clut(const uint32_t *clut);
+
+/**
+ * @brief Default palette: RGB332, the same one Tools/img2l8.py uses with --palette rgb332
+ */
+const uint32_t *lcd_l8_default_clut(void);
+
+/**
+ * @brief Address of the buffer that is not being scanned out
+ */
+uint32_t lcd_l8_get_draw_buffer(void);
+
+/**
+ * @brief Address of the buffer currently scanned out (or about to be, if a swap is pending)
+ */
+uint32_t lcd_l8_get_show_buffer(void);
+
+/**
+ * @brief Queue the draw buffer for display at the next vertical blank
+ * @return 0 on success, -1 if the previous swap has not happened yet
+ */
+int32_t lcd_l8_swap(void);
+
+/**
+ * @brief true while a queued swap waits for the vertical blank
+ */
+bool lcd_l8_swap_pending(void);
+
+/**
+ * @brief Sleep until the queued swap has been latched by LTDC
+ */
+void lcd_l8_wait_swap(void);
+
+/**
+ * @brief Convert an RGB888 colour to the nearest RGB332 palette index
+ */
+static inline uint8_t lcd_l8_index_rgb332(uint8_t r, uint8_t g, uint8_t b) {
+    return (uint8_t)((r & 0xE0) | ((g & 0xE0) >> 3) | (b >> 6));
+}
+
+#endif /* __LCD_L8_H__ */
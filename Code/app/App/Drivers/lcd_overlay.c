@@ -0,0 +1,211 @@
+/**
+ * @file lcd_overlay.c
+ * @brief LTDC layer 2 used as a hardware overlay (HUD, cursor, popups)
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note LTDC blends layer 2 over layer 1 during scan out, so the base frame
+ *       buffer is never touched when overlay content moves or changes.
+ */
+
+#include <stddef.h>
+#include "lcd_overlay.h"
+#include "ltdc.h"
+#include "lcd_present.h"
+
+#define LCD_ACTIVE_WIDTH                800
+#define LCD_ACTIVE_HEIGHT               480
+
+static lcd_overlay_cfg_t overlay_cfg;
+static bool overlay_visible = false;
+
+static uint32_t overlay_bpp(uint32_t pixel_format)
+{
+    switch (pixel_format) {
+    case LTDC_PIXEL_FORMAT_ARGB8888:
+        return 4;
+    case LTDC_PIXEL_FORMAT_RGB888:
+        return 3;
+    case LTDC_PIXEL_FORMAT_RGB565:
+    case LTDC_PIXEL_FORMAT_ARGB1555:
+    case LTDC_PIXEL_FORMAT_ARGB4444:
+    case LTDC_PIXEL_FORMAT_AL88:
+        return 2;
+    default:
+        return 1;
+    }
+}
+
+/*
+ * LTDC windows cannot start left of / above the active area, so clip the
+ * window and offset the start address instead. The pitch stays the buffer
+ * width, so the visible part is still read from the right lines.
+ */
+static lcd_overlay_error_t overlay_apply_window(void)
+{
+    int32_t x0 = overlay_cfg.x;
+    int32_t y0 = overlay_cfg.y;
+    int32_t x1 = overlay_cfg.x + overlay_cfg.width;
+    int32_t y1 = overlay_cfg.y + overlay_cfg.height;
+    uint32_t bpp = overlay_bpp(overlay_cfg.pixel_format);
+    uint32_t address;
+
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > LCD_ACTIVE_WIDTH) x1 = LCD_ACTIVE_WIDTH;
+    if (y1 > LCD_ACTIVE_HEIGHT) y1 = LCD_ACTIVE_HEIGHT;
+
+    if (x1 <= x0 || y1 <= y0) {
+        /* Completely off screen, keep the window but stop fetching it */
+        __HAL_LTDC_LAYER_DISABLE(&hltdc, LCD_OVERLAY_LAYER);
+        return LCD_OVERLAY_OK;
+    }
+
+    address = overlay_cfg.buffer +
+              ((uint32_t)(y0 - overlay_cfg.y) * overlay_cfg.width + (uint32_t)(x0 - overlay_cfg.x)) * bpp;
+
+    /* Each HAL call rewrites the layer from hltdc.LayerCfg, pitch must be last */
+    if (HAL_LTDC_SetWindowSize_NoReload(&hltdc, (uint32_t)(x1 - x0), (uint32_t)(y1 - y0), LCD_OVERLAY_LAYER) != HAL_OK ||
+        HAL_LTDC_SetWindowPosition_NoReload(&hltdc, (uint32_t)x0, (uint32_t)y0, LCD_OVERLAY_LAYER) != HAL_OK ||
+        HAL_LTDC_SetAddress_NoReload(&hltdc, address, LCD_OVERLAY_LAYER) != HAL_OK ||
+        HAL_LTDC_SetPitch_NoReload(&hltdc, overlay_cfg.width, LCD_OVERLAY_LAYER) != HAL_OK) {
+        return LCD_OVERLAY_ERR_HAL;
+    }
+
+    /* LTDC_SetConfig() sets LEN on every call */
+    if (!overlay_visible) {
+        __HAL_LTDC_LAYER_DISABLE(&hltdc, LCD_OVERLAY_LAYER);
+    }
+
+    return LCD_OVERLAY_OK;
+}
+
+void lcd_overlay_default_cfg(lcd_overlay_cfg_t *cfg, uint32_t buffer, uint16_t width, uint16_t height)
+{
+    if (cfg == NULL) {
+        return;
+    }
+
+    cfg->buffer = buffer;
+    cfg->width = width;
+    cfg->height = height;
+    cfg->x = 0;
+    cfg->y = 0;
+    cfg->pixel_format = LTDC_PIXEL_FORMAT_ARGB4444;
+    cfg->alpha = 255;
+    cfg->blending1 = LTDC_BLENDING_FACTOR1_PAxCA;
+    cfg->blending2 = LTDC_BLENDING_FACTOR2_PAxCA;
+}
+
+lcd_overlay_error_t lcd_overlay_init(const lcd_overlay_cfg_t *cfg)
+{
+    LTDC_LayerCfgTypeDef layer = {0};
+
+    if (cfg == NULL || cfg->buffer == 0 || cfg->width == 0 || cfg->height == 0) {
+        return LCD_OVERLAY_ERR_PARAM;
+    }
+
+    overlay_cfg = *cfg;
+    overlay_visible = true;
+
+    /* Start with the full buffer on screen, then clip through overlay_apply_window() */
+    layer.WindowX0 = 0;
+    layer.WindowX1 = (cfg->width < LCD_ACTIVE_WIDTH) ? cfg->width : LCD_ACTIVE_WIDTH;
+    layer.WindowY0 = 0;
+    layer.WindowY1 = (cfg->height < LCD_ACTIVE_HEIGHT) ? cfg->height : LCD_ACTIVE_HEIGHT;
+    layer.PixelFormat = cfg->pixel_format;
+    layer.Alpha = cfg->alpha;
+    layer.Alpha0 = 0;                               // Transparent outside the window
+    layer.BlendingFactor1 = cfg->blending1;
+    layer.BlendingFactor2 = cfg->blending2;
+    layer.FBStartAdress = cfg->buffer;
+    layer.ImageWidth = layer.WindowX1;
+    layer.ImageHeight = layer.WindowY1;
+    layer.Backcolor.Blue = 0;
+    layer.Backcolor.Green = 0;
+    layer.Backcolor.Red = 0;
+
+    if (HAL_LTDC_ConfigLayer(&hltdc, &layer, LCD_OVERLAY_LAYER) != HAL_OK) {
+        return LCD_OVERLAY_ERR_HAL;
+    }
+
+    if (overlay_apply_window() != LCD_OVERLAY_OK) {
+        return LCD_OVERLAY_ERR_HAL;
+    }
+    HAL_LTDC_Reload(&hltdc, LTDC_RELOAD_IMMEDIATE);
+
+    return LCD_OVERLAY_OK;
+}
+
+lcd_overlay_error_t lcd_overlay_move(int16_t x, int16_t y)
+{
+    lcd_overlay_error_t ret;
+
+    overlay_cfg.x = x;
+    overlay_cfg.y = y;
+
+    ret = overlay_apply_window();
+    if (ret == LCD_OVERLAY_OK) {
+        lcd_present();
+    }
+
+    return ret;
+}
+
+lcd_overlay_error_t lcd_overlay_set_alpha(uint8_t alpha)
+{
+    overlay_cfg.alpha = alpha;
+
+    /* Not HAL_LTDC_SetAlpha_NoReload(), it would reset the pitch to the window width and enable the layer */
+    hltdc.LayerCfg[LCD_OVERLAY_LAYER].Alpha = alpha;
+    LTDC_LAYER(&hltdc, LCD_OVERLAY_LAYER)->CACR = alpha;
+    lcd_present();
+
+    return LCD_OVERLAY_OK;
+}
+
+lcd_overlay_error_t lcd_overlay_set_buffer(uint32_t buffer)
+{
+    lcd_overlay_error_t ret;
+
+    if (buffer == 0) {
+        return LCD_OVERLAY_ERR_PARAM;
+    }
+
+    overlay_cfg.buffer = buffer;
+
+    ret = overlay_apply_window();
+    if (ret == LCD_OVERLAY_OK) {
+        lcd_present();
+    }
+
+    return ret;
+}
+
+lcd_overlay_error_t lcd_overlay_show(bool show)
+{
+    overlay_visible = show;
+
+    if (show) {
+        return lcd_overlay_move(overlay_cfg.x, overlay_cfg.y);
+    }
+
+    __HAL_LTDC_LAYER_DISABLE(&hltdc, LCD_OVERLAY_LAYER);
+    lcd_present();
+
+    return LCD_OVERLAY_OK;
+}
+
+void lcd_overlay_clean_cache(void)
+{
+    uint32_t size = (uint32_t)overlay_cfg.width * overlay_cfg.height * overlay_bpp(overlay_cfg.pixel_format);
+
+    if (overlay_cfg.buffer != 0) {
+        SCB_CleanDCache_by_Addr((uint32_t *)overlay_cfg.buffer, (int32_t)size);
+    }
+}
+
+const lcd_overlay_cfg_t *lcd_overlay_get_cfg(void)
+{
+    return &overlay_cfg;
+}
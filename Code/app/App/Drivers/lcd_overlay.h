@@ -0,0 +1,79 @@
+/**
+ * @file lcd_overlay.h
+ * @brief LTDC layer 2 used as a hardware overlay (HUD, cursor, popups)
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#ifndef __LCD_OVERLAY_H__
+#define __LCD_OVERLAY_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "main.h"
+
+#define LCD_OVERLAY_LAYER               1           // LTDC layer index (layer 2)
+
+typedef enum {
+    LCD_OVERLAY_OK = 0,
+    LCD_OVERLAY_ERR_PARAM,
+    LCD_OVERLAY_ERR_HAL,
+} lcd_overlay_error_t;
+
+typedef struct {
+    uint32_t    buffer;                             // Overlay frame buffer, owned by caller (not DTCM)
+    uint16_t    width;                              // Buffer size in pixels
+    uint16_t    height;
+    int16_t     x;                                  // Window position on screen, may be partly off screen
+    int16_t     y;
+    uint32_t    pixel_format;                       // LTDC_PIXEL_FORMAT_xxx
+    uint8_t     alpha;                              // Constant alpha
+    uint32_t    blending1;                          // LTDC_BLENDING_FACTOR1_CA or _PAxCA
+    uint32_t    blending2;                          // LTDC_BLENDING_FACTOR2_CA or _PAxCA
+} lcd_overlay_cfg_t;
+
+/**
+ * @brief Fill cfg with defaults: ARGB4444, per pixel alpha, fully opaque
+ */
+void lcd_overlay_default_cfg(lcd_overlay_cfg_t *cfg, uint32_t buffer, uint16_t width, uint16_t height);
+
+/**
+ * @brief Configure and enable layer 2, takes effect immediately
+ */
+lcd_overlay_error_t lcd_overlay_init(const lcd_overlay_cfg_t *cfg);
+
+/**
+ * @brief Move the overlay window, latched at the next vertical blank
+ * @note  Only LTDC registers are written, no pixel is copied. Parts outside
+ *        the screen are clipped by moving the start address and window.
+ */
+lcd_overlay_error_t lcd_overlay_move(int16_t x, int16_t y);
+
+/**
+ * @brief Change the constant alpha, latched at the next vertical blank
+ */
+lcd_overlay_error_t lcd_overlay_set_alpha(uint8_t alpha);
+
+/**
+ * @brief Point the overlay at another buffer of the same size (double buffered HUD)
+ */
+lcd_overlay_error_t lcd_overlay_set_buffer(uint32_t buffer);
+
+/**
+ * @brief Show or hide the overlay, latched at the next vertical blank
+ */
+lcd_overlay_error_t lcd_overlay_show(bool show);
+
+/**
+ * @brief Write back D-cache lines of the overlay buffer after CPU drawing
+ * @note  Not needed when the buffer lives in RAM_NOCACHE or is drawn by DMA2D
+ */
+void lcd_overlay_clean_cache(void);
+
+/**
+ * @brief Current overlay configuration
+ */
+const lcd_overlay_cfg_t *lcd_overlay_get_cfg(void);
+
+#endif /* __LCD_OVERLAY_H__ */
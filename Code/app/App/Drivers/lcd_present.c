@@ -0,0 +1,263 @@
+/**
+ * @file lcd_present.c
+ * @brief Vsync synchronised present/flip API driven by the LTDC reload interrupt
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note LTDC layer registers are double buffered: writes go to shadow
+ *       registers and are latched when SRCR.VBR is set and the next vertical
+ *       blank starts. The reload (RR) interrupt tells us the new frame is on
+ *       screen, a line interrupt at the first blanking line counts vblanks.
+ *       Nothing in here busy waits, waiting callers sleep in WFI.
+ */
+
+#include <stddef.h>
+#include "lcd_present.h"
+#include "ltdc.h"
+
+static volatile uint32_t present_seq = 0;           // Last sequence handed out
+static volatile uint32_t latched_seq = 0;           // Last sequence on screen
+static volatile uint32_t armed_seq = 0;             // Sequence the armed VBR reload latches, set with VBR
+static volatile bool present_pending = false;
+static volatile uint32_t request_cycles = 0;        // DWT timestamp of the first unlatched request
+static volatile uint32_t request_vblank = 0;        // Vblank count at that request
+
+/* A reload that happened while lcd_present() had interrupts masked and armed VBR again */
+static volatile bool reload_unserved = false;
+static volatile uint32_t reloaded_seq = 0;
+static volatile uint32_t reloaded_cycles = 0;
+static volatile uint32_t reloaded_vblank = 0;
+
+static const uint32_t *volatile pending_clut[2] = { NULL, NULL };
+
+static lcd_present_cb present_callback = NULL;
+static void *present_user = NULL;
+
+static volatile uint32_t present_vblanks = 0;       // Counted by the line interrupt, copied into present_stats
+static lcd_present_stats_t present_stats;
+
+static inline uint32_t present_cycles(void)
+{
+    return DWT->CYCCNT;
+}
+
+static inline uint32_t present_cycles_to_us(uint32_t cycles)
+{
+    return cycles / (SystemCoreClock / 1000000U);
+}
+
+void lcd_present_init(void)
+{
+    present_callback = NULL;
+    present_pending = false;
+    reload_unserved = false;
+    lcd_present_reset_stats();
+
+    /* Cycle counter for latency measurement */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->LAR = 0xC5ACCE55;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    hltdc.Instance->LIPCR = LCD_PRESENT_VBLANK_LINE;
+    __HAL_LTDC_ENABLE_IT(&hltdc, LTDC_IT_LI | LTDC_IT_FU | LTDC_IT_TE);
+}
+
+lcd_present_error_t lcd_present_set_address(uint32_t layer, uint32_t address)
+{
+    if (layer > 1) {
+        return LCD_PRESENT_ERR_PARAM;
+    }
+
+    /* Not HAL_LTDC_SetAddress_NoReload(), it would also reset a custom pitch (lcd_scroll) */
+    hltdc.LayerCfg[layer].FBStartAdress = address;
+    LTDC_LAYER(&hltdc, layer)->CFBAR = address;
+
+    return LCD_PRESENT_OK;
+}
+
+lcd_present_error_t lcd_present_set_window(uint32_t layer, uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+    uint32_t pitch;
+
+    if (layer > 1 || w == 0 || h == 0) {
+        return LCD_PRESENT_ERR_PARAM;
+    }
+
+    /* HAL_LTDC_SetWindowSize resets the pitch to the window width, keep the current one */
+    pitch = (LTDC_LAYER(&hltdc, layer)->CFBLR & LTDC_LxCFBLR_CFBP) >> LTDC_LxCFBLR_CFBP_Pos;
+
+    if (HAL_LTDC_SetWindowSize_NoReload(&hltdc, w, h, layer) != HAL_OK ||
+        HAL_LTDC_SetWindowPosition_NoReload(&hltdc, x, y, layer) != HAL_OK) {
+        return LCD_PRESENT_ERR_HAL;
+    }
+    LTDC_LAYER(&hltdc, layer)->CFBLR = (LTDC_LAYER(&hltdc, layer)->CFBLR & ~LTDC_LxCFBLR_CFBP) |
+                                       (pitch << LTDC_LxCFBLR_CFBP_Pos);
+
+    return LCD_PRESENT_OK;
+}
+
+lcd_present_error_t lcd_present_set_clut(uint32_t layer, const uint32_t *clut)
+{
+    if (layer > 1 || clut == NULL) {
+        return LCD_PRESENT_ERR_PARAM;
+    }
+
+    pending_clut[layer] = clut;
+    return LCD_PRESENT_OK;
+}
+
+uint32_t lcd_present(void)
+{
+    uint32_t seq;
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+
+    seq = ++present_seq;
+    present_stats.requests++;
+
+    /* VBR is cleared by the reload: the armed frame is on screen, its interrupt waits for us */
+    if (present_pending && (hltdc.Instance->SRCR & LTDC_SRCR_VBR) == 0) {
+        reloaded_seq = armed_seq;
+        reloaded_cycles = request_cycles;
+        reloaded_vblank = request_vblank;
+        reload_unserved = true;
+        present_pending = false;
+    }
+    if (!present_pending) {
+        present_pending = true;
+        request_cycles = present_cycles();
+        request_vblank = present_vblanks;
+        if (__HAL_LTDC_GET_FLAG(&hltdc, LTDC_FLAG_LI) != 0U) {
+            request_vblank++;                       // Line interrupt not served yet
+        }
+    }
+
+    /* Direct register access, HAL_LTDC_Reload() takes the handle lock */
+    armed_seq = seq;
+    __HAL_LTDC_ENABLE_IT(&hltdc, LTDC_IT_RR);
+    hltdc.Instance->SRCR = LTDC_SRCR_VBR;
+
+    __set_PRIMASK(primask);
+
+    return seq;
+}
+
+bool lcd_present_done(uint32_t seq)
+{
+    return (int32_t)(latched_seq - seq) >= 0;
+}
+
+void lcd_present_wait(uint32_t seq)
+{
+    while (!lcd_present_done(seq)) {
+        __WFI();
+    }
+}
+
+void lcd_present_wait_vblank(void)
+{
+    uint32_t vblank = present_vblanks;
+
+    while (present_vblanks == vblank) {
+        __WFI();
+    }
+}
+
+void lcd_present_set_callback(lcd_present_cb cb, void *user)
+{
+    present_callback = NULL;
+    present_user = user;
+    present_callback = cb;
+}
+
+const lcd_present_stats_t *lcd_present_get_stats(void)
+{
+    return &present_stats;
+}
+
+void lcd_present_reset_stats(void)
+{
+    uint32_t vblanks = present_vblanks;
+
+    present_stats = (lcd_present_stats_t){0};
+    present_stats.vblanks = vblanks;
+}
+
+/* Reload interrupt: queued shadow registers are now active */
+void HAL_LTDC_ReloadEventCallback(LTDC_HandleTypeDef *hltdc)
+{
+    uint32_t seq, cycles, vblank;
+    uint32_t latency;
+    uint32_t waited;
+
+    /* CLUT is not shadowed, we are still inside the vertical blank here */
+    for (uint32_t layer = 0; layer < 2; layer++) {
+        const uint32_t *clut = pending_clut[layer];
+
+        if (clut != NULL) {
+            for (uint32_t i = 0; i < 256; i++) {
+                LTDC_LAYER(hltdc, layer)->CLUTWR = (i << 24) | (clut[i] & 0x00FFFFFFUL);
+            }
+            pending_clut[layer] = NULL;
+        }
+    }
+
+    /* Latch only what was armed: with VBR set again, the newer request waits for the next vblank */
+    if (reload_unserved) {
+        seq = reloaded_seq;
+        cycles = reloaded_cycles;
+        vblank = reloaded_vblank;
+        reload_unserved = false;
+    } else {
+        seq = armed_seq;
+        cycles = request_cycles;
+        vblank = request_vblank;
+    }
+    if ((hltdc->Instance->SRCR & LTDC_SRCR_VBR) == 0) {
+        seq = armed_seq;                            // The re-armed frame was latched as well
+        present_pending = false;
+    } else {
+        __HAL_LTDC_ENABLE_IT(hltdc, LTDC_IT_RR);    // HAL disables RR after every event
+    }
+
+    latency = present_cycles_to_us(present_cycles() - cycles);
+    present_stats.frames++;
+    present_stats.last_latency_us = latency;
+    present_stats.total_latency_us += latency;
+    if (latency > present_stats.max_latency_us) {
+        present_stats.max_latency_us = latency;
+    }
+
+    /* The line interrupt counts the vblank a prompt request latches on */
+    waited = present_vblanks - vblank;
+    if (waited > 1) {
+        present_stats.missed_vblanks += waited - 1;
+    }
+
+    latched_seq = seq;
+
+    if (present_callback != NULL) {
+        present_callback(seq, present_user);
+    }
+}
+
+/* Line interrupt at the first blanking line: one per frame */
+void HAL_LTDC_LineEventCallback(LTDC_HandleTypeDef *hltdc)
+{
+    present_vblanks++;
+    present_stats.vblanks = present_vblanks;
+
+    /* HAL disables LI after every event */
+    __HAL_LTDC_ENABLE_IT(hltdc, LTDC_IT_LI);
+}
+
+void HAL_LTDC_ErrorCallback(LTDC_HandleTypeDef *hltdc)
+{
+    if (hltdc->ErrorCode & HAL_LTDC_ERROR_FU) {
+        present_stats.fifo_underruns++;
+    }
+    hltdc->ErrorCode = HAL_LTDC_ERROR_NONE;
+
+    __HAL_LTDC_ENABLE_IT(hltdc, LTDC_IT_FU | LTDC_IT_TE);
+}
@@ -0,0 +1,90 @@
+/**
+ * @file lcd_present.h
+ * @brief Vsync synchronised present/flip API driven by the LTDC reload interrupt
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#ifndef __LCD_PRESENT_H__
+#define __LCD_PRESENT_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "main.h"
+
+#define LCD_PRESENT_VBLANK_LINE         520         // First line after the active area, = AccumulatedActiveH
+
+typedef enum {
+    LCD_PRESENT_OK = 0,
+    LCD_PRESENT_ERR_PARAM,
+    LCD_PRESENT_ERR_HAL,
+} lcd_present_error_t;
+
+typedef struct {
+    uint32_t    vblanks;                            // Vertical blanks since init
+    uint32_t    frames;                             // Reloads latched
+    uint32_t    requests;                           // lcd_present() calls (several may share one reload)
+    uint32_t    missed_vblanks;                     // Vblanks a requested frame waited beyond the next one
+    uint32_t    last_latency_us;                    // First request to latch
+    uint32_t    max_latency_us;
+    uint64_t    total_latency_us;
+    uint32_t    fifo_underruns;
+} lcd_present_stats_t;
+
+typedef void (*lcd_present_cb)(uint32_t seq, void *user);
+
+/**
+ * @brief Enable vblank and reload interrupts
+ */
+void lcd_present_init(void);
+
+/**
+ * @brief Queue a new frame buffer address, shadow register only
+ */
+lcd_present_error_t lcd_present_set_address(uint32_t layer, uint32_t address);
+
+/**
+ * @brief Queue a new window (position and size, pitch unchanged), shadow registers only
+ */
+lcd_present_error_t lcd_present_set_window(uint32_t layer, uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+
+/**
+ * @brief Queue a 256 entry CLUT, written from the reload interrupt during vblank
+ * @note  clut must stay valid until the frame is presented
+ */
+lcd_present_error_t lcd_present_set_clut(uint32_t layer, const uint32_t *clut);
+
+/**
+ * @brief Arm the reload at the next vertical blank for everything queued so far
+ * @return sequence number to pass to lcd_present_done() / lcd_present_wait()
+ */
+uint32_t lcd_present(void);
+
+/**
+ * @brief true once the frame with this sequence number is on screen
+ */
+bool lcd_present_done(uint32_t seq);
+
+/**
+ * @brief Sleep (WFI) until the frame with this sequence number is on screen
+ */
+void lcd_present_wait(uint32_t seq);
+
+/**
+ * @brief Sleep (WFI) until the next vertical blank starts
+ */
+void lcd_present_wait_vblank(void);
+
+/**
+ * @brief Called from the reload interrupt after a frame is latched
+ */
+void lcd_present_set_callback(lcd_present_cb cb, void *user);
+
+/**
+ * @brief Frame timing statistics
+ */
+const lcd_present_stats_t *lcd_present_get_stats(void);
+void lcd_present_reset_stats(void);
+
+#endif /* __LCD_PRESENT_H__ */
@@ -0,0 +1,249 @@
+/**
+ * @file lcd_scroll.c
+ * @brief Hardware scrolling by reprogramming the LTDC layer start address
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note Buffer layout: a vertical ring of ring_lines lines followed by a copy
+ *       of the first view_h ring lines. Any window of view_h lines starting
+ *       inside the ring is then contiguous in memory, so LTDC can scan it out
+ *       with a single start address and no wrap-around.
+ *
+ *       content line L -> ring line L % ring_lines -> buffer line (and buffer
+ *       line + ring_lines when ring line < view_h)
+ */
+
+#include <stddef.h>
+#include "lcd_scroll.h"
+#include "ltdc.h"
+#include "lcd_present.h"
+#include "dma2d.h"
+
+static uint8_t scroll_bpp(uint32_t pixel_format)
+{
+    switch (pixel_format) {
+    case LTDC_PIXEL_FORMAT_ARGB8888:
+        return 4;
+    case LTDC_PIXEL_FORMAT_RGB888:
+        return 3;
+    case LTDC_PIXEL_FORMAT_RGB565:
+    case LTDC_PIXEL_FORMAT_ARGB1555:
+    case LTDC_PIXEL_FORMAT_ARGB4444:
+    case LTDC_PIXEL_FORMAT_AL88:
+        return 2;
+    default:
+        return 1;
+    }
+}
+
+static inline uint32_t scroll_line_addr(const lcd_scroll_t *scroll, uint32_t buffer_line)
+{
+    return scroll->cfg.buffer + buffer_line * scroll->cfg.width * scroll->bpp;
+}
+
+/* Render content lines [line, line + count) into the ring and its mirrored tail */
+static void scroll_render(lcd_scroll_t *scroll, uint32_t line, uint32_t count)
+{
+    const lcd_scroll_cfg_t *cfg = &scroll->cfg;
+
+    if (cfg->content_lines != 0) {
+        if (line >= cfg->content_lines) {
+            return;
+        }
+        if (line + count > cfg->content_lines) {
+            count = cfg->content_lines - line;
+        }
+    }
+
+    while (count) {
+        uint32_t ring = line % cfg->ring_lines;
+        uint32_t chunk = cfg->ring_lines - ring;            // Stop at the ring end
+
+        if (chunk > count) {
+            chunk = count;
+        }
+
+        cfg->render(line, (uint16_t)chunk, scroll_line_addr(scroll, ring), cfg->width, cfg->user);    // chunk <= ring_lines
+
+        /* Keep the tail copy in sync, one DMA2D stripe instead of rendering twice.
+           LTDC_PIXEL_FORMAT_xxx and DMA2D_INPUT_xxx share the same encoding. */
+        if (ring < cfg->view_h) {
+            uint32_t mirror = cfg->view_h - ring;
+
+            if (mirror > chunk) {
+                mirror = chunk;
+            }
+            DMA2D_copy_rect(scroll_line_addr(scroll, ring), cfg->width,
+                            scroll_line_addr(scroll, ring + cfg->ring_lines), cfg->width,
+                            cfg->width, (uint16_t)mirror, cfg->pixel_format);           // mirror <= view_h
+        }
+
+        scroll->lines_rendered += chunk;
+        line += chunk;
+        count -= chunk;
+    }
+}
+
+/* Program window, address and pitch into the shadow registers */
+static lcd_scroll_error_t scroll_apply(lcd_scroll_t *scroll, uint32_t reload_type)
+{
+    const lcd_scroll_cfg_t *cfg = &scroll->cfg;
+    uint32_t address = scroll_line_addr(scroll, scroll->top % cfg->ring_lines) + (uint32_t)scroll->x * scroll->bpp;
+
+    if (HAL_LTDC_SetAddress_NoReload(&hltdc, address, cfg->layer) != HAL_OK ||
+        HAL_LTDC_SetPitch_NoReload(&hltdc, cfg->width, cfg->layer) != HAL_OK) {
+        return LCD_SCROLL_ERR_HAL;
+    }
+    if (reload_type == LTDC_RELOAD_IMMEDIATE) {
+        HAL_LTDC_Reload(&hltdc, LTDC_RELOAD_IMMEDIATE);
+        scroll->shown_top = scroll->top;
+    } else {
+        scroll->seq = lcd_present();
+    }
+
+    return LCD_SCROLL_OK;
+}
+
+lcd_scroll_error_t lcd_scroll_init(lcd_scroll_t *scroll, const lcd_scroll_cfg_t *cfg)
+{
+    if (scroll == NULL || cfg == NULL || cfg->render == NULL || cfg->buffer == 0 ||
+        cfg->view_w == 0 || cfg->view_h == 0 || cfg->view_w > cfg->width ||
+        cfg->max_step == 0 || (uint32_t)cfg->ring_lines < (uint32_t)cfg->view_h + cfg->max_step || cfg->layer > 1) {
+        return LCD_SCROLL_ERR_PARAM;
+    }
+
+    scroll->cfg = *cfg;
+    scroll->bpp = scroll_bpp(cfg->pixel_format);
+    scroll->top = 0;
+    scroll->shown_top = 0;
+    scroll->seq = 0;
+    scroll->x = 0;
+    scroll->lines_rendered = 0;
+
+    if (HAL_LTDC_SetWindowSize_NoReload(&hltdc, cfg->view_w, cfg->view_h, cfg->layer) != HAL_OK ||
+        HAL_LTDC_SetWindowPosition_NoReload(&hltdc, cfg->view_x, cfg->view_y, cfg->layer) != HAL_OK) {
+        return LCD_SCROLL_ERR_HAL;
+    }
+
+    scroll_render(scroll, 0, cfg->view_h);
+
+    return scroll_apply(scroll, LTDC_RELOAD_IMMEDIATE);
+}
+
+lcd_scroll_error_t lcd_scroll_to(lcd_scroll_t *scroll, uint32_t top)
+{
+    const lcd_scroll_cfg_t *cfg;
+    uint32_t old_top;
+    uint32_t step;
+
+    if (scroll == NULL) {
+        return LCD_SCROLL_ERR_PARAM;
+    }
+
+    cfg = &scroll->cfg;
+    if (cfg->content_lines != 0) {
+        uint32_t max_top = (cfg->content_lines > cfg->view_h) ? (cfg->content_lines - cfg->view_h) : 0;
+
+        if (top > max_top) {
+            top = max_top;
+        }
+    }
+
+    old_top = scroll->top;
+    if (top == old_top) {
+        return LCD_SCROLL_OK;
+    }
+
+    /* The frame on screen and the new view must both fit in the ring, else wait for the pending reload */
+    if (scroll->shown_top != old_top && lcd_present_done(scroll->seq)) {
+        scroll->shown_top = old_top;
+    }
+    step = (top > scroll->shown_top) ? top - scroll->shown_top : scroll->shown_top - top;
+    if (scroll->shown_top != old_top && step > (uint32_t)(cfg->ring_lines - cfg->view_h)) {
+        lcd_present_wait(scroll->seq);
+        scroll->shown_top = old_top;
+    }
+
+    /* Render only the stripe that becomes visible */
+    if (top > old_top + cfg->view_h || old_top > top + cfg->view_h) {
+        scroll_render(scroll, top, cfg->view_h);
+    } else if (top > old_top) {
+        scroll_render(scroll, old_top + cfg->view_h, top - old_top);
+    } else {
+        scroll_render(scroll, top, old_top - top);
+    }
+
+    scroll->top = top;
+
+    return scroll_apply(scroll, LTDC_RELOAD_VERTICAL_BLANKING);
+}
+
+lcd_scroll_error_t lcd_scroll_by(lcd_scroll_t *scroll, int32_t lines)
+{
+    int64_t top;
+
+    if (scroll == NULL) {
+        return LCD_SCROLL_ERR_PARAM;
+    }
+
+    top = (int64_t)scroll->top + lines;
+    if (top < 0) {
+        top = 0;
+    }
+
+    return lcd_scroll_to(scroll, (uint32_t)top);
+}
+
+lcd_scroll_error_t lcd_scroll_set_x(lcd_scroll_t *scroll, uint16_t x)
+{
+    if (scroll == NULL) {
+        return LCD_SCROLL_ERR_PARAM;
+    }
+
+    if (x > scroll->cfg.width - scroll->cfg.view_w) {
+        x = scroll->cfg.width - scroll->cfg.view_w;
+    }
+    scroll->x = x;
+
+    return scroll_apply(scroll, LTDC_RELOAD_VERTICAL_BLANKING);
+}
+
+void lcd_scroll_invalidate(lcd_scroll_t *scroll, uint32_t line, uint32_t count)
+{
+    uint32_t first;
+    uint32_t last;
+
+    if (scroll == NULL || count == 0) {
+        return;
+    }
+
+    /* Lines outside the view are rendered when they scroll in */
+    first = (line > scroll->top) ? line : scroll->top;
+    last = scroll->top + scroll->cfg.view_h;
+    if (line < last && count < last - line) {
+        last = line + count;
+    }
+
+    if (last > first) {
+        scroll_render(scroll, first, last - first);
+    }
+}
+
+uint32_t lcd_scroll_set_content_lines(lcd_scroll_t *scroll, uint32_t lines)
+{
+    uint32_t old;
+
+    if (scroll == NULL) {
+        return 0;
+    }
+
+    old = scroll->cfg.content_lines;
+    scroll->cfg.content_lines = lines;
+
+    /* Newly appended lines already inside the view must be drawn now */
+    if (old != 0 && lines > old) {
+        lcd_scroll_invalidate(scroll, old, lines - old);
+    }
+
+    return lines;
+}
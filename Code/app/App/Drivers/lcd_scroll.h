@@ -0,0 +1,98 @@
+/**
+ * @file lcd_scroll.h
+ * @brief Hardware scrolling by reprogramming the LTDC layer start address
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#ifndef __LCD_SCROLL_H__
+#define __LCD_SCROLL_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "main.h"
+
+typedef enum {
+    LCD_SCROLL_OK = 0,
+    LCD_SCROLL_ERR_PARAM,
+    LCD_SCROLL_ERR_HAL,
+} lcd_scroll_error_t;
+
+/**
+ * @brief Render content lines into the scroll buffer
+ * @param line  first content line (absolute, 0 = top of the content)
+ * @param count number of lines
+ * @param dst   address of the first line in the buffer
+ * @param pitch buffer line length in pixels
+ */
+typedef void (*lcd_scroll_render_cb)(uint32_t line, uint16_t count, uint32_t dst, uint16_t pitch, void *user);
+
+typedef struct {
+    uint32_t    layer;                              // LTDC layer index, 0 or 1
+    uint32_t    buffer;                             // Scroll buffer, (ring_lines + view_h) * width * bpp bytes
+    uint32_t    pixel_format;                       // LTDC_PIXEL_FORMAT_xxx, must match the layer
+    uint16_t    width;                              // Virtual width (buffer pitch) in pixels
+    uint16_t    ring_lines;                         // Lines in the vertical ring, >= view_h + max_step, 2 * view_h recommended
+    uint16_t    max_step;                           // Largest scroll step per frame drawn without waiting for the latch
+    uint16_t    view_x;                             // Window on screen
+    uint16_t    view_y;
+    uint16_t    view_w;                             // <= width
+    uint16_t    view_h;
+    uint32_t    content_lines;                      // Total content height, 0 = unbounded (terminal log)
+    lcd_scroll_render_cb render;
+    void        *user;
+} lcd_scroll_cfg_t;
+
+typedef struct {
+    lcd_scroll_cfg_t cfg;
+    uint8_t     bpp;
+    uint32_t    top;                                // First visible content line
+    uint32_t    shown_top;                          // top of the frame on screen, differs until the reload latches
+    uint32_t    seq;                                // lcd_present() sequence of the last scroll
+    uint16_t    x;                                  // Horizontal offset inside the virtual width
+    uint32_t    lines_rendered;                     // Statistics: total lines drawn by render
+} lcd_scroll_t;
+
+/**
+ * @brief Take over an LTDC layer window and render the first page
+ * @note  The layer must already be configured (MX_LTDC_Init / lcd_overlay_init)
+ */
+lcd_scroll_error_t lcd_scroll_init(lcd_scroll_t *scroll, const lcd_scroll_cfg_t *cfg);
+
+/**
+ * @brief Scroll to an absolute content line
+ * @note  Only lines that were not visible before are rendered, then the new
+ *        start address is latched at the next vertical blank. The new lines
+ *        go to ring lines that are not on screen as long as the step from
+ *        the frame on screen is at most ring_lines - view_h; a larger step
+ *        first waits for the pending scroll to latch. Jumps further than
+ *        that redraw the whole view, which can tear once.
+ */
+lcd_scroll_error_t lcd_scroll_to(lcd_scroll_t *scroll, uint32_t top);
+
+/**
+ * @brief Scroll relative to the current position, positive moves content up
+ */
+lcd_scroll_error_t lcd_scroll_by(lcd_scroll_t *scroll, int32_t lines);
+
+/**
+ * @brief Pan horizontally inside the virtual width, register writes only
+ */
+lcd_scroll_error_t lcd_scroll_set_x(lcd_scroll_t *scroll, uint16_t x);
+
+/**
+ * @brief Re-render visible content lines after their content changed
+ */
+void lcd_scroll_invalidate(lcd_scroll_t *scroll, uint32_t line, uint32_t count);
+
+/**
+ * @brief Grow the content (terminal log append), returns the new content height
+ */
+uint32_t lcd_scroll_set_content_lines(lcd_scroll_t *scroll, uint32_t lines);
+
+static inline uint32_t lcd_scroll_get_top(const lcd_scroll_t *scroll) {
+    return scroll->top;
+}
+
+#endif /* __LCD_SCROLL_H__ */
@@ -0,0 +1,272 @@
+/**
+ * @file lcd_shot.c
+ * @brief Frame buffer screenshots, RLE compressed and streamed in small packets without blocking rendering
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note A packet is built once and kept until the sink takes it, so the
+ *       pixels of a refused packet are not read again.
+ */
+
+#include <stddef.h>
+#include "lcd_shot.h"
+
+#define SHOT_LITERAL_MAX                128
+#define SHOT_RUN_MAX                    129
+#define SHOT_PAYLOAD_MAX                (LCD_SHOT_PACKET_MAX - LCD_SHOT_HEAD_SIZE - LCD_SHOT_CRC_SIZE)
+#define SHOT_DATA_HEAD                  6           // Id, first pixel
+
+typedef enum {
+    SHOT_IDLE = 0,
+    SHOT_HEADER,
+    SHOT_DATA,
+    SHOT_END,
+} shot_state_t;
+
+static lcd_shot_sink_t shot_sink = NULL;
+static void *shot_user = NULL;
+static uint8_t shot_state = SHOT_IDLE;
+static uint32_t shot_addr;
+static uint16_t shot_pitch;
+static uint8_t shot_format;
+static const uint32_t *shot_clut;
+static uint16_t shot_x, shot_y, shot_w, shot_h;
+static uint16_t shot_id = 0;
+static uint32_t shot_total;                 // Pixels in the region
+static uint32_t shot_next;                  // Next pixel to encode
+static uint32_t shot_rows_read;             // Region rows taken from memory, not from the D-cache
+static uint32_t shot_stream;                // RLE bytes so far
+static uint32_t shot_len = 0;               // Packet waiting for the sink, 0: none
+static uint32_t shot_len_pixels;            // Pixels in it
+static uint8_t shot_packet[LCD_SHOT_PACKET_MAX];
+static lcd_shot_stats_t shot_stats;
+
+static uint16_t crc16_ccitt(const uint8_t *data, uint32_t len)
+{
+    uint16_t crc = 0xFFFF;
+
+    while (len--) {
+        crc ^= (uint16_t)(*data++ << 8);
+        for (uint8_t i = 0; i < 8; i++) {
+            crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+static uint8_t *put16(uint8_t *p, uint16_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    return p + 2;
+}
+
+static uint8_t *put32(uint8_t *p, uint32_t v)
+{
+    p = put16(p, (uint16_t)v);
+    return put16(p, (uint16_t)(v >> 16));
+}
+
+/* Pixel i of the region in raster order, as RGB565 */
+static uint16_t shot_pixel(uint32_t i)
+{
+    uint32_t row = i / shot_w;
+    uint32_t offset = (shot_y + row) * shot_pitch + shot_x + (i - row * shot_w);
+
+    /* DMA2D / the GFXMMU write behind the D-cache: drop the row's lines before its first pixel */
+    if (row >= shot_rows_read) {
+        uint32_t bpp = (shot_format == LCD_SHOT_L8) ? 1U : 2U;
+
+        SCB_CleanInvalidateDCache_by_Addr((uint32_t *)(shot_addr + ((shot_y + row) * shot_pitch + shot_x) * bpp),
+                                          (int32_t)(shot_w * bpp));
+        shot_rows_read = row + 1U;
+    }
+    if (shot_format == LCD_SHOT_L8) {
+        uint32_t c = shot_clut[((const volatile uint8_t *)shot_addr)[offset]];
+
+        return (uint16_t)(((c >> 8) & 0xF800) | ((c >> 5) & 0x07E0) | ((c >> 3) & 0x001F));
+    }
+    return ((const volatile uint16_t *)shot_addr)[offset];
+}
+
+/* Whole RLE codes from shot_next on, at most room bytes */
+static uint32_t shot_encode(uint8_t *out, uint32_t room)
+{
+    uint8_t *p = out;
+    uint8_t *end = out + room;
+
+    while (shot_next < shot_total && end - p >= 3) {
+        uint16_t v = shot_pixel(shot_next);
+        uint16_t q = (shot_next + 1 < shot_total) ? shot_pixel(shot_next + 1) : (uint16_t)~v;
+        uint32_t n;
+
+        if (q == v) {
+            n = 2;
+            while (n < SHOT_RUN_MAX && shot_next + n < shot_total && shot_pixel(shot_next + n) == v) {
+                n++;
+            }
+            *p++ = (uint8_t)(0x80 | (n - 2));
+            p = put16(p, v);
+            shot_next += n;
+        } else {
+            uint32_t max = (uint32_t)(end - p - 1) / 2;
+            uint8_t *head = p++;
+
+            if (max > SHOT_LITERAL_MAX) {
+                max = SHOT_LITERAL_MAX;
+            }
+            p = put16(p, v);
+            shot_next++;
+            n = 1;
+            /* Up to the next pixel pair that starts a run; q is pixel shot_next */
+            while (n < max && shot_next < shot_total) {
+                uint16_t r = (shot_next + 1 < shot_total) ? shot_pixel(shot_next + 1) : (uint16_t)~q;
+
+                if (r == q) {
+                    break;
+                }
+                p = put16(p, q);
+                shot_next++;
+                n++;
+                q = r;
+            }
+            *head = (uint8_t)(n - 1);
+        }
+    }
+    return (uint32_t)(p - out);
+}
+
+static void shot_build(void)
+{
+    uint8_t *payload = &shot_packet[LCD_SHOT_HEAD_SIZE];
+    uint8_t *p = payload;
+    uint32_t first = shot_next;
+    uint16_t crc;
+    uint32_t n;
+
+    switch (shot_state) {
+    case SHOT_HEADER:
+        shot_packet[2] = 'H';
+        *p++ = LCD_SHOT_VERSION;
+        *p++ = LCD_SHOT_ENC_RLE565;
+        p = put16(p, shot_x);
+        p = put16(p, shot_y);
+        p = put16(p, shot_w);
+        p = put16(p, shot_h);
+        p = put32(p, HAL_GetTick());
+        p = put16(p, shot_id);
+        break;
+    case SHOT_DATA:
+        shot_packet[2] = 'D';
+        p = put16(p, shot_id);
+        p = put32(p, shot_next);
+        n = shot_encode(p, SHOT_PAYLOAD_MAX - SHOT_DATA_HEAD);
+        shot_stream += n;
+        p += n;
+        break;
+    default:
+        shot_packet[2] = 'E';
+        p = put16(p, shot_id);
+        p = put32(p, shot_total);
+        p = put32(p, shot_stream);
+        break;
+    }
+
+    shot_packet[0] = LCD_SHOT_SYNC0;
+    shot_packet[1] = LCD_SHOT_SYNC1;
+    put16(&shot_packet[3], (uint16_t)(p - payload));
+    crc = crc16_ccitt(&shot_packet[2], (uint32_t)(p - &shot_packet[2]));
+    p = put16(p, crc);
+    shot_len = (uint32_t)(p - shot_packet);
+    shot_len_pixels = shot_next - first;
+}
+
+void lcd_shot_init(lcd_shot_sink_t sink, void *user)
+{
+    shot_sink = sink;
+    shot_user = user;
+    shot_state = SHOT_IDLE;
+    shot_len = 0;
+}
+
+lcd_shot_error_t lcd_shot_start(uint32_t addr, uint16_t pitch, uint16_t height, lcd_shot_format_t format, const uint32_t *clut,
+                                uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+    if (shot_state != SHOT_IDLE) {
+        return LCD_SHOT_ERR_BUSY;
+    }
+    if (shot_sink == NULL || w == 0 || h == 0 || (uint32_t)x + w > pitch || (uint32_t)y + h > height ||
+        (format == LCD_SHOT_L8 && clut == NULL) || format > LCD_SHOT_L8) {
+        return LCD_SHOT_ERR_PARAM;
+    }
+
+    shot_addr = addr;
+    shot_pitch = pitch;
+    shot_format = (uint8_t)format;
+    shot_clut = clut;
+    shot_x = x;
+    shot_y = y;
+    shot_w = w;
+    shot_h = h;
+    shot_total = (uint32_t)w * h;
+    shot_next = 0;
+    shot_rows_read = 0;
+    shot_stream = 0;
+    shot_len = 0;
+    shot_id++;
+    shot_state = SHOT_HEADER;
+    return LCD_SHOT_OK;
+}
+
+bool lcd_shot_poll(void)
+{
+    for (uint32_t i = 0; i < LCD_SHOT_PACKETS_PER_POLL && shot_state != SHOT_IDLE; i++) {
+        if (shot_len == 0) {
+            shot_build();
+        }
+        if (shot_sink(shot_packet, shot_len, shot_user) == 0) {
+            shot_stats.stalls++;
+            break;
+        }
+        shot_stats.packets++;
+        shot_stats.bytes += shot_len;
+        shot_stats.pixels += shot_len_pixels;
+        shot_len = 0;
+
+        if (shot_state == SHOT_HEADER) {
+            shot_state = SHOT_DATA;
+        } else if (shot_state == SHOT_DATA) {
+            if (shot_next == shot_total) {
+                shot_state = SHOT_END;
+            }
+        } else {
+            shot_state = SHOT_IDLE;
+            shot_stats.shots++;
+        }
+    }
+    return shot_state != SHOT_IDLE;
+}
+
+bool lcd_shot_busy(void)
+{
+    return shot_state != SHOT_IDLE;
+}
+
+void lcd_shot_abort(void)
+{
+    if (shot_state != SHOT_IDLE) {
+        shot_state = SHOT_IDLE;
+        shot_len = 0;
+        shot_stats.aborted++;
+    }
+}
+
+const lcd_shot_stats_t *lcd_shot_get_stats(void)
+{
+    return &shot_stats;
+}
+
+void lcd_shot_reset_stats(void)
+{
+    shot_stats = (lcd_shot_stats_t){ 0 };
+}
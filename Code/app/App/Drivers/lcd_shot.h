@@ -0,0 +1,108 @@
+/**
+ * @file lcd_shot.h
+ * @brief Frame buffer screenshots, RLE compressed and streamed in small packets without blocking rendering
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note A capture is a region of a frame buffer (RGB565, or L8 expanded
+ *       through its CLUT). lcd_shot_poll() encodes the next pixels into one
+ *       packet at a time and offers it to the sink, e.g. the async UART TX
+ *       ring. A sink without room refuses the packet, it is offered again
+ *       on the next poll: the main loop never waits for the UART.
+ *
+ *       Pixels are read when their packet is built, not when the capture
+ *       starts, each row from memory: its D-cache lines are invalidated
+ *       before its first pixel is encoded. Whatever is drawn into the region meanwhile shows up in the
+ *       rows that were not sent yet, capture a still screen. Double
+ *       buffered, the caller holds its swaps while lcd_shot_busy() (main.c
+ *       does) so the buffer read stays the one shown.
+ *
+ *       Encoding: the region in raster order as RGB565, runs may cross rows.
+ *       Control byte c < 0x80: c + 1 literal pixels follow (LE), c >= 0x80:
+ *       the next pixel repeated (c & 0x7F) + 2 times. A flat 800 pixel row
+ *       is 21 bytes instead of 1600, UI screens usually stream in a few
+ *       seconds at 115200 baud where the raw 750 KB take over a minute.
+ *
+ *       Packet: 0xA5 0x5A, type, payload length (LE16), payload, then
+ *       CRC-16/CCITT-FALSE (LE) over type, length and payload. Text printed
+ *       on the same UART between packets is skipped by the host tool
+ *       (Tools/fbshot).
+ *         'H' header: version, encoding, x, y, w, h (LE16), tick (LE32), id (LE16)
+ *         'D' data:   id (LE16), index of the first pixel (LE32), whole RLE codes
+ *         'E' end:    id (LE16), pixels (LE32), RLE bytes (LE32)
+ *       Every data packet starts at a known pixel, a corrupted one only
+ *       leaves a hole in the picture.
+ */
+
+#ifndef __LCD_SHOT_H__
+#define __LCD_SHOT_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "main.h"
+
+#define LCD_SHOT_PACKET_MAX             256         // Bytes including framing, at most a quarter of the UART TX ring
+#define LCD_SHOT_PACKETS_PER_POLL       4           // Encoding work per lcd_shot_poll() call
+#define LCD_SHOT_VERSION                1
+#define LCD_SHOT_ENC_RLE565             1
+
+#define LCD_SHOT_SYNC0                  0xA5
+#define LCD_SHOT_SYNC1                  0x5A
+#define LCD_SHOT_HEAD_SIZE              5           // Sync, type, length
+#define LCD_SHOT_CRC_SIZE               2
+
+typedef enum {
+    LCD_SHOT_OK = 0,
+    LCD_SHOT_ERR_PARAM,                             // Empty region, outside the buffer, no sink or no CLUT
+    LCD_SHOT_ERR_BUSY,                              // A capture is running
+} lcd_shot_error_t;
+
+typedef enum {
+    LCD_SHOT_RGB565 = 0,
+    LCD_SHOT_L8,                                    // Indices into an ARGB8888 CLUT
+} lcd_shot_format_t;
+
+/**
+ * @brief Takes a whole packet or nothing
+ * @return len if the packet was taken, 0 if there is no room now
+ */
+typedef uint32_t (*lcd_shot_sink_t)(const uint8_t *data, uint32_t len, void *user);
+
+typedef struct {
+    uint32_t    shots;                              // Captures sent completely
+    uint32_t    aborted;
+    uint32_t    packets;
+    uint32_t    stalls;                             // Packets refused by the sink, offered again later
+    uint32_t    pixels;
+    uint32_t    bytes;                              // Sent, framing included
+} lcd_shot_stats_t;
+
+/**
+ * @brief Set where packets go
+ */
+void lcd_shot_init(lcd_shot_sink_t sink, void *user);
+
+/**
+ * @brief Start capturing w * h pixels at (x, y) of the buffer at addr, height lines pitch pixels apart
+ * @param clut ARGB8888 palette of an L8 buffer, NULL for RGB565
+ */
+lcd_shot_error_t lcd_shot_start(uint32_t addr, uint16_t pitch, uint16_t height, lcd_shot_format_t format, const uint32_t *clut,
+                                uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+
+/**
+ * @brief Encode and send up to LCD_SHOT_PACKETS_PER_POLL packets, call once per frame
+ * @return true while the capture is running
+ */
+bool lcd_shot_poll(void);
+
+bool lcd_shot_busy(void);
+
+/**
+ * @brief Stop the capture, the host sees it without end packet
+ */
+void lcd_shot_abort(void);
+
+const lcd_shot_stats_t *lcd_shot_get_stats(void);
+void lcd_shot_reset_stats(void);
+
+#endif /* __LCD_SHOT_H__ */
@@ -0,0 +1,213 @@
+/**
+ * @file lcd_vfb.c
+ * @brief GFXMMU virtual frame buffer: packed lines in GRAM behind a contiguous virtual address
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note One look-up table entry per virtual line: enable, first and last
+ *       visible block, and the line offset. The offset is chosen so that
+ *       the first visible block of line y lands right after the last block
+ *       of line y - 1, i.e. LO = packed offset - 16 * FVB (may be negative).
+ *       All buffers share the table, each one has its own physical base.
+ */
+
+#include <stddef.h>
+#include "lcd_vfb.h"
+#include "ltdc.h"
+#include "lcd_present.h"
+
+static uint32_t lcd_vfb_lut[2 * LCD_VFB_HEIGHT];
+static uint8_t lcd_vfb_buffers = 0;
+static uint8_t lcd_vfb_front = 0;           // Buffer index scanned out
+static uint32_t lcd_vfb_swap_seq = 0;       // lcd_present() sequence of the last swap
+
+static const uint32_t lcd_vfb_base[LCD_VFB_BUFFERS_MAX] = {
+    GFXMMU_VIRTUAL_BUFFER0_BASE, GFXMMU_VIRTUAL_BUFFER1_BASE,
+    GFXMMU_VIRTUAL_BUFFER2_BASE, GFXMMU_VIRTUAL_BUFFER3_BASE,
+};
+
+static uint32_t lcd_vfb_isqrt(uint32_t v)
+{
+    uint32_t r = 0;
+
+    for (uint32_t bit = 1UL << 30; bit != 0; bit >>= 2) {
+        if (v >= r + bit) {
+            v -= r + bit;
+            r = (r >> 1) + bit;
+        } else {
+            r >>= 1;
+        }
+    }
+    return r;
+}
+
+lcd_vfb_error_t lcd_vfb_shape_spans(const lcd_vfb_shape_t *shape, lcd_vfb_span_t *spans)
+{
+    uint32_t w, h, r;
+
+    if (shape == NULL || spans == NULL ||
+        shape->left + shape->right >= LCD_VFB_WIDTH || shape->top + shape->bottom >= LCD_VFB_HEIGHT) {
+        return LCD_VFB_ERR_PARAM;
+    }
+    w = LCD_VFB_WIDTH - shape->left - shape->right;
+    h = LCD_VFB_HEIGHT - shape->top - shape->bottom;
+    r = shape->radius;
+    if (2U * r > w || 2U * r > h) {
+        return LCD_VFB_ERR_PARAM;
+    }
+
+    for (uint32_t y = 0; y < LCD_VFB_HEIGHT; y++) {
+        uint32_t row, inset = 0;
+
+        spans[y].x0 = 0;
+        spans[y].x1 = 0;
+        if (y < shape->top || y >= shape->top + h) {
+            continue;
+        }
+
+        /* Distance to the nearer horizontal edge, pixel centres inside the corner circle are kept */
+        row = y - shape->top;
+        if (row >= h - r) {
+            row = h - 1U - row;
+        }
+        if (row < r) {
+            uint32_t d = 2U * (r - row) - 1U;
+
+            inset = r - lcd_vfb_isqrt(4U * r * r - d * d) / 2U;
+        }
+        spans[y].x0 = (uint16_t)(shape->left + inset);
+        spans[y].x1 = (uint16_t)(LCD_VFB_WIDTH - shape->right - inset);
+    }
+
+    return LCD_VFB_OK;
+}
+
+uint32_t lcd_vfb_build_lut(const lcd_vfb_span_t *spans, uint32_t *lut)
+{
+    uint32_t offset = 0;
+
+    for (uint32_t y = 0; y < LCD_VFB_HEIGHT; y++) {
+        uint32_t x0 = spans[y].x0;
+        uint32_t x1 = (spans[y].x1 > LCD_VFB_WIDTH) ? LCD_VFB_WIDTH : spans[y].x1;
+        uint32_t fvb, lvb;
+
+        if (x1 <= x0) {
+            lut[2 * y] = 0;
+            lut[2 * y + 1] = 0;
+            continue;
+        }
+
+        /* Blocks of 16 bytes = 8 RGB565 pixels */
+        fvb = x0 * 2U / 16U;
+        lvb = (x1 * 2U - 1U) / 16U;
+        lut[2 * y] = GFXMMU_LUTxL_EN | (fvb << GFXMMU_LUTxL_FVB_Pos) | (lvb << GFXMMU_LUTxL_LVB_Pos);
+        lut[2 * y + 1] = (offset - fvb * 16U) & GFXMMU_LUTxH_LO;
+        offset += (lvb - fvb + 1U) * 16U;
+    }
+
+    return offset;
+}
+
+lcd_vfb_error_t lcd_vfb_init(const lcd_vfb_span_t *spans, uint8_t buffers, lcd_vfb_info_t *info)
+{
+    static lcd_vfb_span_t full[LCD_VFB_HEIGHT];
+    volatile uint32_t *bcr = &GFXMMU->B0CR;
+    uint32_t bytes, lines = 0;
+
+    if (buffers == 0 || buffers > LCD_VFB_BUFFERS_MAX) {
+        return LCD_VFB_ERR_PARAM;
+    }
+    if (spans == NULL) {
+        for (uint32_t y = 0; y < LCD_VFB_HEIGHT; y++) {
+            full[y].x0 = 0;
+            full[y].x1 = LCD_VFB_WIDTH;
+        }
+        spans = full;
+    }
+
+    bytes = lcd_vfb_build_lut(spans, lcd_vfb_lut);
+    for (uint32_t y = 0; y < LCD_VFB_HEIGHT; y++) {
+        lines += lcd_vfb_lut[2 * y] & GFXMMU_LUTxL_EN;
+    }
+    if (info != NULL) {
+        info->frame_bytes = bytes;
+        info->lines = lines;
+        info->buffers = buffers;
+        info->spare_addr = LCD_VFB_PHYS_ADDR + bytes * buffers;
+        info->spare_size = (bytes * buffers <= LCD_VFB_PHYS_SIZE) ? LCD_VFB_PHYS_SIZE - bytes * buffers : 0;
+    }
+    if ((uint64_t)bytes * buffers > LCD_VFB_PHYS_SIZE) {
+        return LCD_VFB_ERR_SIZE;
+    }
+
+    __HAL_RCC_GFXMMU_CLK_ENABLE();
+
+    GFXMMU->CR = GFXMMU_CR_192BM;                           // 192 blocks = 3072 bytes per line
+    GFXMMU->DVR = 0;                                        // Unmapped pixels read as black
+    GFXMMU->FCR = GFXMMU_FCR_CB0OF | GFXMMU_FCR_CB1OF | GFXMMU_FCR_CB2OF | GFXMMU_FCR_CB3OF | GFXMMU_FCR_CAMEF;
+    for (uint32_t n = 0; n < LCD_VFB_BUFFERS_MAX; n++) {
+        bcr[n] = (n < buffers) ? LCD_VFB_PHYS_ADDR + n * bytes : LCD_VFB_PHYS_ADDR;
+    }
+    for (uint32_t y = 0; y < LCD_VFB_LUT_LINES; y++) {
+        GFXMMU->LUT[2 * y] = (y < LCD_VFB_HEIGHT) ? lcd_vfb_lut[2 * y] : 0;
+        GFXMMU->LUT[2 * y + 1] = (y < LCD_VFB_HEIGHT) ? lcd_vfb_lut[2 * y + 1] : 0;
+    }
+
+    lcd_vfb_buffers = buffers;
+    lcd_vfb_front = 0;
+
+    /* SetAddress rewrites the pitch from the layer width, so it goes first */
+    if (HAL_LTDC_SetAddress(&hltdc, lcd_vfb_base[0], 0) != HAL_OK ||
+        HAL_LTDC_SetPitch(&hltdc, LCD_VFB_PITCH, 0) != HAL_OK) {
+        return LCD_VFB_ERR_HAL;
+    }
+
+    return LCD_VFB_OK;
+}
+
+void lcd_vfb_deinit(void)
+{
+    HAL_LTDC_SetAddress(&hltdc, LCD_VFB_PHYS_ADDR, 0);
+    HAL_LTDC_SetPitch(&hltdc, LCD_VFB_WIDTH, 0);
+
+    for (uint32_t y = 0; y < LCD_VFB_LUT_LINES; y++) {
+        GFXMMU->LUT[2 * y] = 0;
+    }
+    GFXMMU->CR = 0;
+    lcd_vfb_buffers = 0;
+}
+
+uint32_t lcd_vfb_get_buffer(uint8_t n)
+{
+    return (n < lcd_vfb_buffers) ? lcd_vfb_base[n] : 0;
+}
+
+uint32_t lcd_vfb_get_draw_buffer(void)
+{
+    return (lcd_vfb_buffers > 1) ? lcd_vfb_base[lcd_vfb_front ^ 1] : lcd_vfb_base[0];
+}
+
+uint32_t lcd_vfb_get_show_buffer(void)
+{
+    return lcd_vfb_base[lcd_vfb_front];
+}
+
+int32_t lcd_vfb_swap(void)
+{
+    if (lcd_vfb_buffers < 2 || !lcd_present_done(lcd_vfb_swap_seq)) {
+        return -1;
+    }
+
+    lcd_vfb_front ^= 1;
+
+    /* Shadow register only, LTDC latches it during the next vertical blank */
+    lcd_present_set_address(0, lcd_vfb_base[lcd_vfb_front]);
+    lcd_vfb_swap_seq = lcd_present();
+
+    return 0;
+}
+
+void lcd_vfb_wait_swap(void)
+{
+    lcd_present_wait(lcd_vfb_swap_seq);
+}
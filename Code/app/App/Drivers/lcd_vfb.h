@@ -0,0 +1,148 @@
+/**
+ * @file lcd_vfb.h
+ * @brief GFXMMU virtual frame buffer: packed lines in GRAM behind a contiguous virtual address
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note The GFXMMU shows LTDC, DMA2D and the CPU a frame buffer with a fixed
+ *       pitch at 0x25000000 (buffer n at + n * 4MB). Every line has a span of
+ *       16 byte blocks that is backed by GRAM, packed one after the other;
+ *       reads outside the span return the default value (black) and writes
+ *       there are dropped. Pixels behind the bezel or the rounded corners of
+ *       the glass, and lines that are never drawn, take no memory.
+ *
+ *       Virtual lines are 192 blocks (3072 bytes), so the pitch is
+ *       LCD_VFB_PITCH pixels, not 800. Spans are rounded out to blocks
+ *       (8 RGB565 pixels).
+ */
+
+#ifndef __LCD_VFB_H__
+#define __LCD_VFB_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "main.h"
+
+/* Set LCD_USE_VFB=1 in CMakeLists.txt to scan layer 0 out of the virtual frame buffer */
+#ifndef LCD_USE_VFB
+#define LCD_USE_VFB                     0
+#endif
+
+/* Visible area of the glass used by main.c with LCD_USE_VFB, in pixels */
+#ifndef LCD_VFB_BEZEL_LEFT
+#define LCD_VFB_BEZEL_LEFT              0
+#endif
+#ifndef LCD_VFB_BEZEL_RIGHT
+#define LCD_VFB_BEZEL_RIGHT             0
+#endif
+#ifndef LCD_VFB_BEZEL_TOP
+#define LCD_VFB_BEZEL_TOP               0
+#endif
+#ifndef LCD_VFB_BEZEL_BOTTOM
+#define LCD_VFB_BEZEL_BOTTOM            0
+#endif
+#ifndef LCD_VFB_BEZEL_RADIUS
+#define LCD_VFB_BEZEL_RADIUS            0
+#endif
+
+#define LCD_VFB_WIDTH                   800
+#define LCD_VFB_HEIGHT                  480
+#define LCD_VFB_PITCH                   1536        // Pixels per virtual line, 192 blocks of 16 bytes
+#define LCD_VFB_LINE_BYTES              (LCD_VFB_PITCH * 2)
+#define LCD_VFB_BUFFERS_MAX             4
+#define LCD_VFB_PHYS_ADDR               0x24040000UL
+#define LCD_VFB_PHYS_SIZE               (800UL * 480UL * 2UL)               // GRAM, see .gram in the linker script
+#define LCD_VFB_LUT_LINES               1024
+
+typedef enum {
+    LCD_VFB_OK = 0,
+    LCD_VFB_ERR_PARAM,
+    LCD_VFB_ERR_SIZE,                               // The buffers do not fit GRAM
+    LCD_VFB_ERR_HAL,
+} lcd_vfb_error_t;
+
+/* Backed pixels of a line, [x0, x1), x0 == x1 if nothing is */
+typedef struct {
+    uint16_t    x0;
+    uint16_t    x1;
+} lcd_vfb_span_t;
+
+/* Visible area: insets from the panel edges and the corner radius of the glass */
+typedef struct {
+    uint16_t    left;
+    uint16_t    right;
+    uint16_t    top;
+    uint16_t    bottom;
+    uint16_t    radius;
+} lcd_vfb_shape_t;
+
+typedef struct {
+    uint32_t    frame_bytes;                        // GRAM per buffer
+    uint32_t    lines;                              // Lines with a span
+    uint8_t     buffers;
+    uint32_t    spare_addr;                         // GRAM left over, free for a second buffer or the asset cache
+    uint32_t    spare_size;
+} lcd_vfb_info_t;
+
+/**
+ * @brief Spans of a shape, one per panel line
+ * @param spans LCD_VFB_HEIGHT entries
+ */
+lcd_vfb_error_t lcd_vfb_shape_spans(const lcd_vfb_shape_t *shape, lcd_vfb_span_t *spans);
+
+/**
+ * @brief Fill the GFXMMU look-up table for a set of spans, lines packed from offset 0
+ * @param spans LCD_VFB_HEIGHT entries
+ * @param lut   2 * LCD_VFB_HEIGHT words, LUTxL / LUTxH per line
+ * @return bytes of physical memory one buffer needs
+ */
+uint32_t lcd_vfb_build_lut(const lcd_vfb_span_t *spans, uint32_t *lut);
+
+/**
+ * @brief Program the GFXMMU and point LTDC layer 0 at virtual buffer 0
+ * @param spans   LCD_VFB_HEIGHT entries, NULL for the whole panel
+ * @param buffers 1..LCD_VFB_BUFFERS_MAX, packed one after the other from LCD_VFB_PHYS_ADDR
+ * @param info    optional, filled on success and on LCD_VFB_ERR_SIZE
+ * @note  Call after MX_LTDC_Init(). Virtual buffer contents are undefined.
+ */
+lcd_vfb_error_t lcd_vfb_init(const lcd_vfb_span_t *spans, uint8_t buffers, lcd_vfb_info_t *info);
+
+/**
+ * @brief Switch LTDC back to the flat frame buffer at LCD_VFB_PHYS_ADDR and stop the GFXMMU
+ */
+void lcd_vfb_deinit(void);
+
+/**
+ * @brief Virtual address of buffer n, 0 if not configured
+ */
+uint32_t lcd_vfb_get_buffer(uint8_t n);
+
+/**
+ * @brief Virtual address of pixel (x, y) in a virtual buffer
+ */
+static inline uint32_t lcd_vfb_pixel_addr(uint32_t buffer, uint16_t x, uint16_t y) {
+    return buffer + ((uint32_t)y * LCD_VFB_PITCH + x) * 2U;
+}
+
+/**
+ * @brief Buffer not scanned out (buffer 0 with a single buffer)
+ */
+uint32_t lcd_vfb_get_draw_buffer(void);
+
+/**
+ * @brief Buffer currently scanned out (or about to be, if a swap is pending)
+ */
+uint32_t lcd_vfb_get_show_buffer(void);
+
+/**
+ * @brief Queue the draw buffer for display at the next vertical blank
+ * @return 0 on success, -1 with a single buffer or if the previous swap is pending
+ */
+int32_t lcd_vfb_swap(void);
+
+/**
+ * @brief Sleep until the queued swap has been latched by LTDC
+ */
+void lcd_vfb_wait_swap(void);
+
+#endif /* __LCD_VFB_H__ */
@@ -0,0 +1,166 @@
+/**
+ * @file mdma_fetch.c
+ * @brief Background copies of 2D blocks with MDMA, e.g. from memory mapped OSPI flash into SRAM
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note The beat size and the block repeat source offset are part of the
+ *       channel configuration (CTCR / CBRUR), so the channel is only
+ *       re-initialised when a job needs different ones than the last.
+ */
+
+#include <stddef.h>
+#include "mdma_fetch.h"
+
+MDMA_HandleTypeDef hmdma_fetch;
+
+static volatile bool fetch_busy = false;
+static volatile bool fetch_error = false;
+static uint32_t fetch_size = 0;             // Beat size in bytes of the current configuration, 0 before init
+static uint32_t fetch_skip = 0;             // Source block repeat offset of the current configuration
+static mdma_fetch_stats_t fetch_stats;
+
+static void fetch_cplt(MDMA_HandleTypeDef *hmdma)
+{
+    (void)hmdma;
+    fetch_busy = false;
+}
+
+static void fetch_xfer_error(MDMA_HandleTypeDef *hmdma)
+{
+    (void)hmdma;
+    fetch_error = true;
+    fetch_busy = false;
+}
+
+static mdma_fetch_error_t fetch_config(uint32_t size, uint32_t skip)
+{
+    static const uint32_t inc[3][2] = {
+        { MDMA_SRC_INC_BYTE,        MDMA_DEST_INC_BYTE },
+        { MDMA_SRC_INC_HALFWORD,    MDMA_DEST_INC_HALFWORD },
+        { MDMA_SRC_INC_WORD,        MDMA_DEST_INC_WORD },
+    };
+    static const uint32_t data_size[3][2] = {
+        { MDMA_SRC_DATASIZE_BYTE,       MDMA_DEST_DATASIZE_BYTE },
+        { MDMA_SRC_DATASIZE_HALFWORD,   MDMA_DEST_DATASIZE_HALFWORD },
+        { MDMA_SRC_DATASIZE_WORD,       MDMA_DEST_DATASIZE_WORD },
+    };
+    static const uint32_t burst[3][2] = {                   // 64 bytes per burst
+        { MDMA_SOURCE_BURST_64BEATS,    MDMA_DEST_BURST_64BEATS },
+        { MDMA_SOURCE_BURST_32BEATS,    MDMA_DEST_BURST_32BEATS },
+        { MDMA_SOURCE_BURST_16BEATS,    MDMA_DEST_BURST_16BEATS },
+    };
+    uint32_t i = (size == 4U) ? 2U : size - 1U;
+
+    if (size == fetch_size && skip == fetch_skip) {
+        return MDMA_FETCH_OK;
+    }
+
+    hmdma_fetch.Instance = MDMA_FETCH_CHANNEL;
+    hmdma_fetch.Init.Request = MDMA_REQUEST_SW;
+    hmdma_fetch.Init.TransferTriggerMode = MDMA_FULL_TRANSFER;
+    hmdma_fetch.Init.Priority = MDMA_PRIORITY_MEDIUM;      // Below the JPEG FIFO channels
+    hmdma_fetch.Init.Endianness = MDMA_LITTLE_ENDIANNESS_PRESERVE;
+    hmdma_fetch.Init.SourceInc = inc[i][0];
+    hmdma_fetch.Init.DestinationInc = inc[i][1];
+    hmdma_fetch.Init.SourceDataSize = data_size[i][0];
+    hmdma_fetch.Init.DestDataSize = data_size[i][1];
+    hmdma_fetch.Init.DataAlignment = MDMA_DATAALIGN_PACKENABLE;
+    hmdma_fetch.Init.BufferTransferLength = 128;
+    hmdma_fetch.Init.SourceBurst = burst[i][0];
+    hmdma_fetch.Init.DestBurst = burst[i][1];
+    hmdma_fetch.Init.SourceBlockAddressOffset = (int32_t)skip;
+    hmdma_fetch.Init.DestBlockAddressOffset = 0;
+    if (HAL_MDMA_Init(&hmdma_fetch) != HAL_OK) {
+        fetch_size = 0;
+        return MDMA_FETCH_ERR_HAL;
+    }
+    hmdma_fetch.XferCpltCallback = fetch_cplt;
+    hmdma_fetch.XferErrorCallback = fetch_xfer_error;
+
+    fetch_size = size;
+    fetch_skip = skip;
+    return MDMA_FETCH_OK;
+}
+
+mdma_fetch_error_t mdma_fetch_init(void)
+{
+    __HAL_RCC_MDMA_CLK_ENABLE();
+
+    fetch_busy = false;
+    fetch_error = false;
+    fetch_size = 0;
+    if (fetch_config(4U, 0) != MDMA_FETCH_OK) {
+        return MDMA_FETCH_ERR_HAL;
+    }
+
+    HAL_NVIC_SetPriority(MDMA_IRQn, 1, 0);
+    HAL_NVIC_EnableIRQ(MDMA_IRQn);
+
+    return MDMA_FETCH_OK;
+}
+
+mdma_fetch_error_t mdma_fetch_start(uint32_t src, uint32_t src_pitch, uint32_t dst, uint32_t row_bytes, uint32_t rows)
+{
+    uint32_t align, size;
+    mdma_fetch_error_t err;
+
+    if (row_bytes == 0 || row_bytes > MDMA_FETCH_ROW_MAX || rows == 0 || rows > MDMA_FETCH_ROWS_MAX ||
+        src_pitch < row_bytes || (rows > 1U && src_pitch - row_bytes > MDMA_FETCH_SKIP_MAX)) {
+        return MDMA_FETCH_ERR_PARAM;
+    }
+    if (fetch_busy) {
+        return MDMA_FETCH_ERR_BUSY;
+    }
+
+    /* Widest beat every address and length is a multiple of */
+    align = src | dst | row_bytes | ((rows > 1U) ? src_pitch : 0);
+    size = (align & 1U) ? 1U : ((align & 2U) ? 2U : 4U);
+    err = fetch_config(size, (rows > 1U) ? src_pitch - row_bytes : fetch_skip);
+    if (err != MDMA_FETCH_OK) {
+        return err;
+    }
+
+    fetch_error = false;
+    fetch_busy = true;
+    if (HAL_MDMA_Start_IT(&hmdma_fetch, src, dst, row_bytes, rows) != HAL_OK) {
+        fetch_busy = false;
+        fetch_stats.errors++;
+        return MDMA_FETCH_ERR_HAL;
+    }
+    fetch_stats.jobs++;
+    fetch_stats.bytes += row_bytes * rows;
+
+    return MDMA_FETCH_OK;
+}
+
+bool mdma_fetch_busy(void)
+{
+    return fetch_busy;
+}
+
+mdma_fetch_error_t mdma_fetch_wait(void)
+{
+    if (fetch_busy) {
+        fetch_stats.waits++;
+    }
+    while (fetch_busy) {
+        __WFI();                                            // MDMA completion
+    }
+    if (fetch_error) {
+        fetch_error = false;
+        fetch_stats.errors++;
+        return MDMA_FETCH_ERR_XFER;
+    }
+    return MDMA_FETCH_OK;
+}
+
+const mdma_fetch_stats_t *mdma_fetch_get_stats(void)
+{
+    return &fetch_stats;
+}
+
+void mdma_fetch_reset_stats(void)
+{
+    fetch_stats = (mdma_fetch_stats_t){ 0 };
+}
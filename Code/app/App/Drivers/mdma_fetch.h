@@ -0,0 +1,72 @@
+/**
+ * @file mdma_fetch.h
+ * @brief Background copies of 2D blocks with MDMA, e.g. from memory mapped OSPI flash into SRAM
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note One software triggered MDMA channel (MDMA_FETCH_CHANNEL, the JPEG
+ *       codec uses 6 and 7). A job is a repeated block transfer: every row
+ *       is one block, the source address skips the rest of the source line
+ *       between blocks, the destination is packed. The CPU and DMA2D keep
+ *       running while it is in flight, the interrupt only marks it done.
+ *
+ *       The destination should not be cached (RAM_NOCACHE), MDMA does not
+ *       snoop the D-cache.
+ */
+
+#ifndef __MDMA_FETCH_H__
+#define __MDMA_FETCH_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "main.h"
+
+#define MDMA_FETCH_CHANNEL              MDMA_Channel0
+#define MDMA_FETCH_ROW_MAX              65536U      // Block length, bytes
+#define MDMA_FETCH_ROWS_MAX             4096U       // Block repeat count + 1
+#define MDMA_FETCH_SKIP_MAX             65535U      // Source pitch - row bytes, 16-bit block repeat offset
+
+typedef enum {
+    MDMA_FETCH_OK = 0,
+    MDMA_FETCH_ERR_PARAM,                           // Size out of range, or the pitch skip does not fit
+    MDMA_FETCH_ERR_BUSY,                            // Previous job not finished
+    MDMA_FETCH_ERR_HAL,
+    MDMA_FETCH_ERR_XFER,                            // Bus error reported by the channel
+} mdma_fetch_error_t;
+
+typedef struct {
+    uint32_t    jobs;
+    uint32_t    bytes;
+    uint32_t    waits;                              // mdma_fetch_wait() calls that had to sleep
+    uint32_t    errors;
+} mdma_fetch_stats_t;
+
+extern MDMA_HandleTypeDef hmdma_fetch;
+
+/**
+ * @brief Enable the MDMA clock and interrupt, configure the fetch channel
+ */
+mdma_fetch_error_t mdma_fetch_init(void);
+
+/**
+ * @brief Start copying rows * row_bytes from src (lines src_pitch bytes apart) to dst, packed
+ * @note  Returns at once. Word or halfword beats are used when src, dst,
+ *        row_bytes and src_pitch allow it, bytes otherwise.
+ */
+mdma_fetch_error_t mdma_fetch_start(uint32_t src, uint32_t src_pitch, uint32_t dst, uint32_t row_bytes, uint32_t rows);
+
+/**
+ * @brief true while a job is in flight
+ */
+bool mdma_fetch_busy(void);
+
+/**
+ * @brief Sleep until the job in flight, if any, is done
+ * @return MDMA_FETCH_ERR_XFER if it failed, the destination is undefined then
+ */
+mdma_fetch_error_t mdma_fetch_wait(void);
+
+const mdma_fetch_stats_t *mdma_fetch_get_stats(void);
+void mdma_fetch_reset_stats(void);
+
+#endif /* __MDMA_FETCH_H__ */
@@ -0,0 +1,413 @@
+/**
+ * @file touch_gesture.c
+ * @brief Gesture recogniser (tap, long press, drag, swipe, pinch, rotate) and touch motion predictor
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note Angles use atan(z) ~ 45 z + 15.64 z (1 - z) degrees on the first
+ *       octant (error below 0.25 degree), distances an integer square root.
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include "touch_gesture.h"
+
+typedef enum {
+    GESTURE_IDLE = 0,
+    GESTURE_PRESSED,                                        // One finger, not moved yet
+    GESTURE_LONG,                                           // Long press reported
+    GESTURE_DRAG,
+    GESTURE_TWO,                                            // Two fingers
+    GESTURE_WAIT,                                           // Ignore the touch until all fingers are up
+} gesture_state_t;
+
+#define ACTIVE_PINCH                    0x01
+#define ACTIVE_ROTATE                   0x02
+
+/* ---------------------------------------------------------------------------
+ * Fixed point helpers
+ */
+static uint32_t isqrt32(uint32_t v)
+{
+    uint32_t root = 0;
+    uint32_t bit = 1UL << 30;
+
+    while (bit > v) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (v >= root + bit) {
+            v -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+/* Angle of (x, y) in 0.01 degree, -18000 .. 18000 */
+static int32_t atan2_cd(int32_t y, int32_t x)
+{
+    uint32_t ax = (uint32_t)((x < 0) ? -x : x);
+    uint32_t ay = (uint32_t)((y < 0) ? -y : y);
+    int32_t z, a;
+
+    if (ax == 0 && ay == 0) {
+        return 0;
+    }
+    z = (int32_t)(((ay <= ax) ? (ay << 15) / ax : (ax << 15) / ay));   // Q15, 0 .. 1
+    a = (4500 * z + 1564 * ((z * (32768 - z)) >> 15)) >> 15;
+    if (ay > ax) {
+        a = 9000 - a;
+    }
+    if (x < 0) {
+        a = 18000 - a;
+    }
+    return (y < 0) ? -a : a;
+}
+
+static int32_t abs32(int32_t v)
+{
+    return (v < 0) ? -v : v;
+}
+
+/* ---------------------------------------------------------------------------
+ * Alpha-beta filter of the first finger
+ */
+static void filter_reset(touch_gesture_ctx_t *ctx, int16_t x, int16_t y, uint32_t tick)
+{
+    ctx->px = (int32_t)x << 16;
+    ctx->py = (int32_t)y << 16;
+    ctx->vx = 0;
+    ctx->vy = 0;
+    ctx->last_tick = tick;
+    ctx->last_x = x;
+    ctx->last_y = y;
+}
+
+static void filter_axis(int32_t *p, int32_t *v, int16_t meas, uint32_t dt)
+{
+    int32_t expect = *p + *v * (int32_t)dt;
+    int32_t r = ((int32_t)meas << 16) - expect;
+
+    *p = expect + (int32_t)(((int64_t)r * TOUCH_PREDICT_ALPHA) >> 8);
+    if (dt != 0) {
+        *v += (int32_t)((((int64_t)r * TOUCH_PREDICT_BETA) >> 8) / (int32_t)dt);
+    }
+}
+
+static void filter_update(touch_gesture_ctx_t *ctx, int16_t x, int16_t y, uint32_t tick)
+{
+    uint32_t dt = tick - ctx->last_tick;
+
+    if (dt > TOUCH_PREDICT_GAP_MS) {
+        filter_reset(ctx, x, y, tick);
+        return;
+    }
+    filter_axis(&ctx->px, &ctx->vx, x, dt);
+    filter_axis(&ctx->py, &ctx->vy, y, dt);
+    ctx->last_tick = tick;
+    ctx->last_x = x;
+    ctx->last_y = y;
+}
+
+/* Pixels per ms Q16 to pixels per second */
+static int32_t filter_speed(int32_t v)
+{
+    return (int32_t)(((int64_t)v * 1000) >> 16);
+}
+
+/* ---------------------------------------------------------------------------
+ * Recogniser
+ */
+static touch_gesture_t *emit(touch_gesture_t *out, uint8_t *count, touch_gesture_type_t type,
+                             touch_gesture_phase_t phase, uint32_t tick, int16_t x, int16_t y, uint8_t fingers)
+{
+    touch_gesture_t *g;
+
+    if (*count >= TOUCH_GESTURE_OUT_MAX) {
+        return NULL;
+    }
+    g = &out[(*count)++];
+    memset(g, 0, sizeof(*g));
+    g->type = type;
+    g->phase = phase;
+    g->tick = tick;
+    g->x = x;
+    g->y = y;
+    g->fingers = fingers;
+    return g;
+}
+
+static void emit_drag(const touch_gesture_ctx_t *ctx, touch_gesture_t *out, uint8_t *count,
+                      touch_gesture_phase_t phase, uint32_t tick)
+{
+    touch_gesture_t *g = emit(out, count, TOUCH_GESTURE_DRAG, phase, tick, ctx->last_x, ctx->last_y, 1);
+
+    if (g != NULL) {
+        g->dx = (int16_t)(ctx->last_x - ctx->start_x);
+        g->dy = (int16_t)(ctx->last_y - ctx->start_y);
+        g->vx = filter_speed(ctx->vx);
+        g->vy = filter_speed(ctx->vy);
+    }
+}
+
+static const touch_point_t *find_point(const touch_event_t *event, uint8_t id)
+{
+    for (uint8_t i = 0; i < event->count; i++) {
+        if (event->points[i].id == id) {
+            return &event->points[i];
+        }
+    }
+    return NULL;
+}
+
+static void two_measure(const touch_point_t *a, const touch_point_t *b, uint32_t *dist, int32_t *angle)
+{
+    int32_t dx = (int32_t)b->x - a->x;
+    int32_t dy = (int32_t)b->y - a->y;
+
+    *dist = isqrt32((uint32_t)(dx * dx + dy * dy));
+    *angle = atan2_cd(dy, dx);
+}
+
+/* Second finger down: a drag in progress ends, the pinch / rotate reference is taken */
+static void two_begin(touch_gesture_ctx_t *ctx, const touch_event_t *event, touch_gesture_t *out, uint8_t *count)
+{
+    const touch_point_t *a = find_point(event, ctx->first);
+    const touch_point_t *b = NULL;
+
+    for (uint8_t i = 0; i < event->down && b == NULL; i++) {
+        if (event->points[i].id != ctx->first) {
+            b = &event->points[i];
+        }
+    }
+    if (ctx->state == GESTURE_DRAG) {
+        emit_drag(ctx, out, count, TOUCH_PHASE_END, event->tick);
+    }
+    if (a == NULL || b == NULL) {
+        ctx->state = GESTURE_WAIT;
+        return;
+    }
+
+    ctx->second = b->id;
+    ctx->active = 0;
+    ctx->angle_sum = 0;
+    two_measure(a, b, &ctx->dist0, &ctx->angle_last);
+    ctx->state = (ctx->dist0 != 0) ? GESTURE_TWO : GESTURE_WAIT;
+}
+
+static void two_end(touch_gesture_ctx_t *ctx, uint32_t tick, touch_gesture_t *out, uint8_t *count)
+{
+    if (ctx->active & ACTIVE_PINCH) {
+        emit(out, count, TOUCH_GESTURE_PINCH, TOUCH_PHASE_END, tick, ctx->last_x, ctx->last_y, 2);
+    }
+    if (ctx->active & ACTIVE_ROTATE) {
+        emit(out, count, TOUCH_GESTURE_ROTATE, TOUCH_PHASE_END, tick, ctx->last_x, ctx->last_y, 2);
+    }
+    ctx->active = 0;
+}
+
+static void two_update(touch_gesture_ctx_t *ctx, const touch_event_t *event, touch_gesture_t *out, uint8_t *count)
+{
+    const touch_point_t *a = find_point(event, ctx->first);
+    const touch_point_t *b = find_point(event, ctx->second);
+    touch_gesture_t *g;
+    uint32_t dist;
+    int32_t angle, turn, scale;
+
+    if (a == NULL || b == NULL || a->action == TOUCH_UP || b->action == TOUCH_UP) {
+        two_end(ctx, event->tick, out, count);
+        ctx->state = (event->down != 0) ? GESTURE_WAIT : GESTURE_IDLE;
+        return;
+    }
+
+    ctx->last_x = (int16_t)((a->x + b->x) / 2);
+    ctx->last_y = (int16_t)((a->y + b->y) / 2);
+    two_measure(a, b, &dist, &angle);
+    turn = angle - ctx->angle_last;                         // Unwrapped, fingers turn less than 180 degrees per report
+    if (turn > 18000) {
+        turn -= 36000;
+    } else if (turn < -18000) {
+        turn += 36000;
+    }
+    ctx->angle_sum += turn;
+    ctx->angle_last = angle;
+    scale = (int32_t)(((uint64_t)dist << 16) / ctx->dist0);
+
+    if (!(ctx->active & ACTIVE_PINCH) &&
+        (uint32_t)abs32((int32_t)dist - (int32_t)ctx->dist0) * 100U >= ctx->dist0 * TOUCH_PINCH_START) {
+        ctx->active |= ACTIVE_PINCH;
+        g = emit(out, count, TOUCH_GESTURE_PINCH, TOUCH_PHASE_BEGIN, event->tick, ctx->last_x, ctx->last_y, 2);
+    } else if (ctx->active & ACTIVE_PINCH) {
+        g = emit(out, count, TOUCH_GESTURE_PINCH, TOUCH_PHASE_UPDATE, event->tick, ctx->last_x, ctx->last_y, 2);
+    } else {
+        g = NULL;
+    }
+    if (g != NULL) {
+        g->scale = scale;
+    }
+
+    if (!(ctx->active & ACTIVE_ROTATE) && abs32(ctx->angle_sum) >= TOUCH_ROTATE_START) {
+        ctx->active |= ACTIVE_ROTATE;
+        g = emit(out, count, TOUCH_GESTURE_ROTATE, TOUCH_PHASE_BEGIN, event->tick, ctx->last_x, ctx->last_y, 2);
+    } else if (ctx->active & ACTIVE_ROTATE) {
+        g = emit(out, count, TOUCH_GESTURE_ROTATE, TOUCH_PHASE_UPDATE, event->tick, ctx->last_x, ctx->last_y, 2);
+    } else {
+        g = NULL;
+    }
+    if (g != NULL) {
+        g->angle = ctx->angle_sum;
+    }
+}
+
+/* The first finger lifted */
+static void one_up(touch_gesture_ctx_t *ctx, const touch_event_t *event, touch_gesture_t *out, uint8_t *count)
+{
+    touch_gesture_t *g;
+
+    if (ctx->state == GESTURE_PRESSED && event->tick - ctx->down_tick < TOUCH_TAP_MAX_MS) {
+        emit(out, count, TOUCH_GESTURE_TAP, TOUCH_PHASE_ONCE, event->tick, ctx->start_x, ctx->start_y, 1);
+    } else if (ctx->state == GESTURE_DRAG) {
+        int32_t vx = filter_speed(ctx->vx);
+        int32_t vy = filter_speed(ctx->vy);
+
+        emit_drag(ctx, out, count, TOUCH_PHASE_END, event->tick);
+        if (event->tick - ctx->last_tick <= TOUCH_SWIPE_IDLE_MS &&
+            (int64_t)vx * vx + (int64_t)vy * vy >= (int64_t)TOUCH_SWIPE_VELOCITY * TOUCH_SWIPE_VELOCITY) {     // 46341 px/s overflows 32 bits
+            g = emit(out, count, TOUCH_GESTURE_SWIPE, TOUCH_PHASE_ONCE, event->tick, ctx->last_x, ctx->last_y, 1);
+            if (g != NULL) {
+                g->dx = (int16_t)(ctx->last_x - ctx->start_x);
+                g->dy = (int16_t)(ctx->last_y - ctx->start_y);
+                g->vx = vx;
+                g->vy = vy;
+                if (abs32(vx) >= abs32(vy)) {
+                    g->direction = (vx < 0) ? TOUCH_SWIPE_LEFT : TOUCH_SWIPE_RIGHT;
+                } else {
+                    g->direction = (vy < 0) ? TOUCH_SWIPE_UP : TOUCH_SWIPE_DOWN;
+                }
+            }
+        }
+    }
+    ctx->state = (event->down != 0) ? GESTURE_WAIT : GESTURE_IDLE;
+}
+
+void touch_gesture_init(touch_gesture_ctx_t *ctx)
+{
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->state = GESTURE_IDLE;
+    ctx->latency = TOUCH_PREDICT_LATENCY_MS << 4;
+}
+
+uint8_t touch_gesture_feed(touch_gesture_ctx_t *ctx, const touch_event_t *event, touch_gesture_t *out)
+{
+    const touch_point_t *p;
+    uint8_t count = 0;
+
+    switch (ctx->state) {
+    case GESTURE_IDLE:
+        if (event->down == 0) {
+            break;
+        }
+        p = &event->points[0];
+        ctx->first = p->id;
+        ctx->down_tick = event->tick;
+        ctx->start_x = (int16_t)p->x;
+        ctx->start_y = (int16_t)p->y;
+        filter_reset(ctx, (int16_t)p->x, (int16_t)p->y, event->tick);
+        ctx->state = GESTURE_PRESSED;
+        if (event->down >= 2) {
+            two_begin(ctx, event, out, &count);
+        }
+        break;
+
+    case GESTURE_PRESSED:
+    case GESTURE_LONG:
+    case GESTURE_DRAG:
+        p = find_point(event, ctx->first);
+        if (p == NULL || p->action == TOUCH_UP) {
+            one_up(ctx, event, out, &count);
+            break;
+        }
+        filter_update(ctx, (int16_t)p->x, (int16_t)p->y, event->tick);
+        if (event->down >= 2) {
+            if (ctx->state == GESTURE_LONG) {
+                ctx->state = GESTURE_WAIT;
+            } else {
+                two_begin(ctx, event, out, &count);
+            }
+        } else if (ctx->state == GESTURE_PRESSED) {
+            int32_t dx = ctx->last_x - ctx->start_x;
+            int32_t dy = ctx->last_y - ctx->start_y;
+
+            if (dx * dx + dy * dy > TOUCH_SLOP * TOUCH_SLOP) {
+                ctx->state = GESTURE_DRAG;
+                emit_drag(ctx, out, &count, TOUCH_PHASE_BEGIN, event->tick);
+            } else {
+                count = touch_gesture_tick(ctx, event->tick, out);
+            }
+        } else if (ctx->state == GESTURE_DRAG) {
+            emit_drag(ctx, out, &count, TOUCH_PHASE_UPDATE, event->tick);
+        }
+        break;
+
+    case GESTURE_TWO:
+        two_update(ctx, event, out, &count);
+        break;
+
+    default:
+        if (event->down == 0) {
+            ctx->state = GESTURE_IDLE;
+        }
+        break;
+    }
+    return count;
+}
+
+uint8_t touch_gesture_tick(touch_gesture_ctx_t *ctx, uint32_t now, touch_gesture_t *out)
+{
+    uint8_t count = 0;
+
+    if (ctx->state == GESTURE_PRESSED && now - ctx->down_tick >= TOUCH_LONG_PRESS_MS) {
+        ctx->state = GESTURE_LONG;
+        emit(out, &count, TOUCH_GESTURE_LONG_PRESS, TOUCH_PHASE_ONCE, now, ctx->start_x, ctx->start_y, 1);
+    }
+    return count;
+}
+
+void touch_gesture_latency(touch_gesture_ctx_t *ctx, uint32_t event_tick, uint32_t shown_tick)
+{
+    uint32_t sample = (shown_tick - event_tick) << 4;
+
+    if (!ctx->latency_set) {
+        ctx->latency = sample;
+        ctx->latency_set = true;
+    } else {
+        ctx->latency = (uint32_t)((int32_t)ctx->latency + ((int32_t)sample - (int32_t)ctx->latency) / 8);
+    }
+}
+
+uint32_t touch_gesture_get_latency(const touch_gesture_ctx_t *ctx)
+{
+    return (ctx->latency + 8U) >> 4;
+}
+
+bool touch_gesture_predict(const touch_gesture_ctx_t *ctx, int16_t *x, int16_t *y)
+{
+    int32_t ahead = (int32_t)touch_gesture_get_latency(ctx);
+    int32_t px, py;
+
+    if (ctx->state != GESTURE_PRESSED && ctx->state != GESTURE_LONG && ctx->state != GESTURE_DRAG) {
+        return false;
+    }
+    if (ahead > TOUCH_PREDICT_MAX_MS) {
+        ahead = TOUCH_PREDICT_MAX_MS;
+    }
+    px = (ctx->px + ctx->vx * ahead + 0x8000) >> 16;
+    py = (ctx->py + ctx->vy * ahead + 0x8000) >> 16;
+    *x = (int16_t)((px < 0) ? 0 : ((px >= TOUCH_LCD_WIDTH) ? TOUCH_LCD_WIDTH - 1 : px));
+    *y = (int16_t)((py < 0) ? 0 : ((py >= TOUCH_LCD_HEIGHT) ? TOUCH_LCD_HEIGHT - 1 : py));
+    return true;
+}
@@ -0,0 +1,143 @@
+/**
+ * @file touch_gesture.h
+ * @brief Gesture recogniser (tap, long press, drag, swipe, pinch, rotate) and touch motion predictor
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note Fed with the events of touch_gt911_read(), no hardware access, so
+ *       the host tests replay recorded traces through it. Integer and
+ *       fixed point only, all state lives in touch_gesture_ctx_t.
+ *
+ *       One finger: down, then TAP if it is lifted within TOUCH_TAP_MAX_MS
+ *       without moving TOUCH_SLOP pixels, LONG_PRESS once it stays down
+ *       TOUCH_LONG_PRESS_MS (reported by touch_gesture_tick() even without
+ *       new events), or DRAG BEGIN / UPDATE / END once it moves. A drag
+ *       lifted at TOUCH_SWIPE_VELOCITY or faster is also a SWIPE.
+ *
+ *       Two fingers: PINCH starts once their distance changed by
+ *       TOUCH_PINCH_START percent, ROTATE once the line through them turned
+ *       TOUCH_ROTATE_START, both can run at once. Lifting either ends them,
+ *       the rest of the touch is ignored until all fingers are up.
+ *
+ *       Predictor: the first finger is tracked with an alpha-beta filter
+ *       (position and velocity, Q16). touch_gesture_predict() extrapolates
+ *       it by the display latency, the time from the touch to the frame
+ *       showing it, measured with touch_gesture_latency() and smoothed.
+ *       Content dragged to the predicted point stays under the finger
+ *       instead of trailing it by latency * speed pixels.
+ */
+
+#ifndef __TOUCH_GESTURE_H__
+#define __TOUCH_GESTURE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "touch_gt911.h"
+
+#define TOUCH_SLOP                      10          // Pixels a finger moves before it is a drag
+#define TOUCH_TAP_MAX_MS                300
+#define TOUCH_LONG_PRESS_MS             500
+#define TOUCH_SWIPE_VELOCITY            400         // Pixels per second at the lift
+#define TOUCH_SWIPE_IDLE_MS             60          // A finger resting longer before the lift is not a swipe
+#define TOUCH_PINCH_START               8           // Percent of the start distance
+#define TOUCH_ROTATE_START              800         // 0.01 degree
+#define TOUCH_PREDICT_ALPHA             128         // Position gain, 1/256
+#define TOUCH_PREDICT_BETA              64          // Velocity gain, 1/256
+#define TOUCH_PREDICT_GAP_MS            100         // Longer between samples: restart the filter
+#define TOUCH_PREDICT_LATENCY_MS        30          // Until the first measurement
+#define TOUCH_PREDICT_MAX_MS            60          // Prediction horizon limit
+#define TOUCH_GESTURE_OUT_MAX           4           // Gestures one call reports at most
+
+typedef enum {
+    TOUCH_GESTURE_TAP = 0,
+    TOUCH_GESTURE_LONG_PRESS,
+    TOUCH_GESTURE_DRAG,
+    TOUCH_GESTURE_SWIPE,
+    TOUCH_GESTURE_PINCH,
+    TOUCH_GESTURE_ROTATE,
+} touch_gesture_type_t;
+
+typedef enum {
+    TOUCH_PHASE_ONCE = 0,                           // TAP, LONG_PRESS, SWIPE
+    TOUCH_PHASE_BEGIN,
+    TOUCH_PHASE_UPDATE,
+    TOUCH_PHASE_END,
+} touch_gesture_phase_t;
+
+typedef enum {
+    TOUCH_SWIPE_LEFT = 0,
+    TOUCH_SWIPE_RIGHT,
+    TOUCH_SWIPE_UP,
+    TOUCH_SWIPE_DOWN,
+} touch_swipe_dir_t;
+
+typedef struct {
+    uint8_t     type;                               // touch_gesture_type_t
+    uint8_t     phase;                              // touch_gesture_phase_t
+    uint8_t     direction;                          // SWIPE: touch_swipe_dir_t, the larger velocity component
+    uint8_t     fingers;
+    uint32_t    tick;                               // Event time, HAL_GetTick()
+    int16_t     x;                                  // The finger, or the middle of two
+    int16_t     y;
+    int16_t     dx;                                 // DRAG / SWIPE: moved since the finger went down
+    int16_t     dy;
+    int32_t     vx;                                 // DRAG / SWIPE: pixels per second
+    int32_t     vy;
+    int32_t     scale;                              // PINCH: distance / start distance, Q16
+    int32_t     angle;                              // ROTATE: turned since the start, 0.01 degree, clockwise on screen
+} touch_gesture_t;
+
+typedef struct {
+    uint8_t     state;
+    uint8_t     first;                              // Track ids
+    uint8_t     second;
+    uint8_t     active;                             // Two finger gestures running
+    uint32_t    down_tick;
+    uint32_t    last_tick;
+    int16_t     start_x;
+    int16_t     start_y;
+    int16_t     last_x;
+    int16_t     last_y;
+    int32_t     px;                                 // Filtered position, pixels Q16
+    int32_t     py;
+    int32_t     vx;                                 // Filtered velocity, pixels per ms Q16
+    int32_t     vy;
+    uint32_t    dist0;                              // Two fingers at the start: distance, angle
+    int32_t     angle_last;
+    int32_t     angle_sum;
+    uint32_t    latency;                            // Smoothed display latency, ms Q4
+    bool        latency_set;
+} touch_gesture_ctx_t;
+
+void touch_gesture_init(touch_gesture_ctx_t *ctx);
+
+/**
+ * @brief Run one touch event through the recogniser
+ * @param out room for TOUCH_GESTURE_OUT_MAX gestures
+ * @return number of gestures written to out
+ */
+uint8_t touch_gesture_feed(touch_gesture_ctx_t *ctx, const touch_event_t *event, touch_gesture_t *out);
+
+/**
+ * @brief Time based gestures (long press), call once per frame
+ * @return number of gestures written to out
+ */
+uint8_t touch_gesture_tick(touch_gesture_ctx_t *ctx, uint32_t now, touch_gesture_t *out);
+
+/**
+ * @brief One latency measurement: an event with tick event_tick reached the screen at shown_tick
+ */
+void touch_gesture_latency(touch_gesture_ctx_t *ctx, uint32_t event_tick, uint32_t shown_tick);
+
+/**
+ * @brief Smoothed display latency, ms
+ */
+uint32_t touch_gesture_get_latency(const touch_gesture_ctx_t *ctx);
+
+/**
+ * @brief Where the first finger will be when the next frame shows, limited to the LCD
+ * @return false if no finger is tracked
+ */
+bool touch_gesture_predict(const touch_gesture_ctx_t *ctx, int16_t *x, int16_t *y);
+
+#endif /* __TOUCH_GESTURE_H__ */
@@ -0,0 +1,416 @@
+/**
+ * @file touch_gt911.c
+ * @brief GT911 capacitive touch driver, woken by the INT line, multi-touch events through a lock-free queue
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note I2C is clocked on the open-drain pins through BSRR / IDR: a line
+ *       is released (pulled up) by setting its pin and driven low by
+ *       resetting it. SCL is read back after every release, so a GT911
+ *       stretching the clock is waited for.
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include "touch_gt911.h"
+
+#define I2C_SCL_HIGH()                  (TOUCH_SCL_GPIO_Port->BSRR = TOUCH_SCL_Pin)
+#define I2C_SCL_LOW()                   (TOUCH_SCL_GPIO_Port->BSRR = (uint32_t)TOUCH_SCL_Pin << 16)
+#define I2C_SDA_HIGH()                  (TOUCH_SDA_GPIO_Port->BSRR = TOUCH_SDA_Pin)
+#define I2C_SDA_LOW()                   (TOUCH_SDA_GPIO_Port->BSRR = (uint32_t)TOUCH_SDA_Pin << 16)
+#define I2C_SCL_READ()                  ((TOUCH_SCL_GPIO_Port->IDR & TOUCH_SCL_Pin) != 0)
+#define I2C_SDA_READ()                  ((TOUCH_SDA_GPIO_Port->IDR & TOUCH_SDA_Pin) != 0)
+
+#define TOUCH_REPORT_SIZE               (1 + TOUCH_POINTS_MAX * GT911_POINT_SIZE)
+
+static touch_event_t touch_queue[TOUCH_QUEUE_SIZE];
+static volatile uint32_t touch_head = 0;            // Written by the interrupt only
+static volatile uint32_t touch_tail = 0;            // Written by the reader only
+static touch_point_t touch_last[TOUCH_POINTS_MAX];  // Points down in the last queued event
+static uint8_t touch_last_down = 0;
+static uint16_t touch_res_x = TOUCH_LCD_WIDTH;
+static uint16_t touch_res_y = TOUCH_LCD_HEIGHT;
+static volatile bool touch_ready = false;
+static uint32_t i2c_half_cycles = 1;                // CPU cycles per SCL half period
+static touch_stats_t touch_stats;
+
+/* ---------------------------------------------------------------------------
+ * I2C master on GPIO
+ */
+static void i2c_delay(void)
+{
+    uint32_t start = DWT->CYCCNT;
+
+    while (DWT->CYCCNT - start < i2c_half_cycles) {
+        __NOP();
+    }
+}
+
+static bool i2c_scl_release(void)
+{
+    uint32_t wait = TOUCH_I2C_STRETCH_MAX;
+
+    I2C_SCL_HIGH();
+    while (!I2C_SCL_READ()) {
+        if (--wait == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void i2c_start(void)
+{
+    /* Also a repeated start: SCL is low after a byte */
+    I2C_SDA_HIGH();
+    i2c_delay();
+    i2c_scl_release();
+    i2c_delay();
+    I2C_SDA_LOW();
+    i2c_delay();
+    I2C_SCL_LOW();
+}
+
+static void i2c_stop(void)
+{
+    I2C_SDA_LOW();
+    i2c_delay();
+    i2c_scl_release();
+    i2c_delay();
+    I2C_SDA_HIGH();
+    i2c_delay();
+}
+
+/* @return true if the byte was acknowledged */
+static bool i2c_write_byte(uint8_t data)
+{
+    bool ack;
+
+    for (uint8_t bit = 0; bit < 8; bit++) {
+        if (data & 0x80) {
+            I2C_SDA_HIGH();
+        } else {
+            I2C_SDA_LOW();
+        }
+        data <<= 1;
+        i2c_delay();
+        i2c_scl_release();
+        i2c_delay();
+        I2C_SCL_LOW();
+    }
+
+    I2C_SDA_HIGH();
+    i2c_delay();
+    ack = i2c_scl_release() && !I2C_SDA_READ();
+    i2c_delay();
+    I2C_SCL_LOW();
+
+    touch_stats.bytes++;
+    return ack;
+}
+
+static uint8_t i2c_read_byte(bool ack)
+{
+    uint8_t data = 0;
+
+    I2C_SDA_HIGH();
+    for (uint8_t bit = 0; bit < 8; bit++) {
+        i2c_delay();
+        i2c_scl_release();
+        i2c_delay();
+        data = (uint8_t)((data << 1) | I2C_SDA_READ());
+        I2C_SCL_LOW();
+    }
+
+    if (ack) {
+        I2C_SDA_LOW();
+    }
+    i2c_delay();
+    i2c_scl_release();
+    i2c_delay();
+    I2C_SCL_LOW();
+    I2C_SDA_HIGH();
+
+    touch_stats.bytes++;
+    return data;
+}
+
+/* Clock out a device stuck in the middle of a byte, e.g. after a reset of the MCU during a read */
+static touch_error_t i2c_recover(void)
+{
+    I2C_SDA_HIGH();
+    I2C_SCL_HIGH();
+    i2c_delay();
+    for (uint8_t n = 0; n < 9 && !I2C_SDA_READ(); n++) {
+        I2C_SCL_LOW();
+        i2c_delay();
+        I2C_SCL_HIGH();
+        i2c_delay();
+    }
+    if (!I2C_SDA_READ() || !I2C_SCL_READ()) {
+        return TOUCH_ERR_BUS;
+    }
+    i2c_start();
+    i2c_stop();
+    return TOUCH_OK;
+}
+
+/* Register address phase, ends with the bus held (SCL low) */
+static bool gt911_address(uint16_t reg)
+{
+    i2c_start();
+    return i2c_write_byte(TOUCH_GT911_ADDR << 1) &&
+           i2c_write_byte((uint8_t)(reg >> 8)) &&
+           i2c_write_byte((uint8_t)reg);
+}
+
+static touch_error_t gt911_read(uint16_t reg, uint8_t *buf, uint16_t len)
+{
+    if (!gt911_address(reg)) {
+        i2c_stop();
+        return TOUCH_ERR_NACK;
+    }
+    i2c_start();
+    if (!i2c_write_byte((TOUCH_GT911_ADDR << 1) | 1U)) {
+        i2c_stop();
+        return TOUCH_ERR_NACK;
+    }
+    for (uint16_t i = 0; i < len; i++) {
+        buf[i] = i2c_read_byte(i + 1U < len);
+    }
+    i2c_stop();
+    return TOUCH_OK;
+}
+
+static touch_error_t gt911_write(uint16_t reg, const uint8_t *buf, uint16_t len)
+{
+    bool ack = gt911_address(reg);
+
+    for (uint16_t i = 0; ack && i < len; i++) {
+        ack = i2c_write_byte(buf[i]);
+    }
+    i2c_stop();
+    return ack ? TOUCH_OK : TOUCH_ERR_NACK;
+}
+
+/* ---------------------------------------------------------------------------
+ * Events
+ */
+static uint16_t touch_scale(uint16_t value, uint16_t res, uint16_t size)
+{
+    if (res != size && res != 0) {
+        value = (uint16_t)((uint32_t)value * size / res);
+    }
+    return (value < size) ? value : (uint16_t)(size - 1U);
+}
+
+static bool touch_was_down(uint8_t id)
+{
+    for (uint8_t i = 0; i < touch_last_down; i++) {
+        if (touch_last[i].id == id) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* Compare the report with the last queued event and queue the difference */
+static void touch_push(uint32_t tick, const uint8_t *report)
+{
+    uint32_t head = touch_head;
+    uint8_t down = report[0] & GT911_STATUS_POINTS;
+    touch_event_t *event;
+
+    if (head - touch_tail >= TOUCH_QUEUE_SIZE) {
+        touch_stats.dropped++;
+        return;
+    }
+    if (down > TOUCH_POINTS_MAX) {
+        down = TOUCH_POINTS_MAX;
+    }
+    if (down == 0 && touch_last_down == 0) {
+        return;                                             // Nothing down before or now
+    }
+
+    event = &touch_queue[head & (TOUCH_QUEUE_SIZE - 1U)];
+    event->tick = tick;
+    event->down = down;
+    event->count = down;
+    for (uint8_t i = 0; i < down; i++) {
+        const uint8_t *raw = &report[1 + i * GT911_POINT_SIZE];
+        touch_point_t *point = &event->points[i];
+
+        point->id = raw[0];
+        point->action = touch_was_down(raw[0]) ? TOUCH_MOVE : TOUCH_DOWN;
+        point->x = touch_scale((uint16_t)(raw[1] | (raw[2] << 8)), touch_res_x, TOUCH_LCD_WIDTH);
+        point->y = touch_scale((uint16_t)(raw[3] | (raw[4] << 8)), touch_res_y, TOUCH_LCD_HEIGHT);
+        point->size = (uint16_t)(raw[5] | (raw[6] << 8));
+    }
+
+    /* Fingers of the last event missing now are lifted */
+    for (uint8_t i = 0; i < touch_last_down; i++) {
+        bool found = false;
+
+        for (uint8_t j = 0; j < down; j++) {
+            found |= event->points[j].id == touch_last[i].id;
+        }
+        if (!found) {
+            event->points[event->count] = touch_last[i];
+            event->points[event->count].action = TOUCH_UP;
+            event->count++;
+        }
+    }
+
+    memcpy(touch_last, event->points, down * sizeof(touch_point_t));
+    touch_last_down = down;
+
+    __DMB();                                                // Event written before it is published
+    touch_head = head + 1U;
+    touch_stats.events++;
+}
+
+void touch_gt911_irq(void)
+{
+    static const uint8_t clear = 0;
+    uint32_t tick = HAL_GetTick();
+    uint8_t report[TOUCH_REPORT_SIZE];
+
+    touch_stats.irqs++;
+    if (!touch_ready) {
+        return;
+    }
+
+    if (gt911_read(GT911_REG_STATUS, report, sizeof(report)) != TOUCH_OK) {
+        touch_stats.errors++;
+        return;
+    }
+    if (!(report[0] & GT911_STATUS_READY)) {
+        return;                                             // Not a new report
+    }
+    /* The GT911 fills its buffer again only once the status is cleared */
+    if (gt911_write(GT911_REG_STATUS, &clear, 1) != TOUCH_OK) {
+        touch_stats.errors++;
+    }
+
+    touch_stats.reports++;
+    touch_push(tick, report);
+}
+
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
+{
+    if (GPIO_Pin == TOUCH_INT_Pin) {
+        touch_gt911_irq();
+    }
+}
+
+/* ---------------------------------------------------------------------------
+ * API
+ */
+touch_error_t touch_gt911_init(touch_info_t *info)
+{
+    static const uint8_t clear = 0;
+    GPIO_InitTypeDef gpio = {0};
+    uint8_t id[11];
+    uint8_t config;
+    touch_error_t err;
+
+    touch_gt911_deinit();
+
+    /* Cycle counter for the I2C half periods, rounded up: never faster than TOUCH_I2C_HZ */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->LAR = 0xC5ACCE55;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    i2c_half_cycles = (SystemCoreClock + 2U * TOUCH_I2C_HZ - 1U) / (2U * TOUCH_I2C_HZ);
+
+    /* Reset with INT low selects address 0x5D */
+    HAL_GPIO_WritePin(TOUCH_RESET_GPIO_Port, TOUCH_RESET_Pin, GPIO_PIN_RESET);
+    gpio.Pin = TOUCH_INT_Pin;
+    gpio.Mode = GPIO_MODE_OUTPUT_PP;
+    gpio.Pull = GPIO_NOPULL;
+    gpio.Speed = GPIO_SPEED_FREQ_LOW;
+    HAL_GPIO_Init(TOUCH_INT_GPIO_Port, &gpio);
+    HAL_GPIO_WritePin(TOUCH_INT_GPIO_Port, TOUCH_INT_Pin, GPIO_PIN_RESET);
+    I2C_SCL_HIGH();                                         // MX_GPIO_Init() leaves the bus driven low
+    I2C_SDA_HIGH();
+    HAL_Delay(1);
+    HAL_GPIO_WritePin(TOUCH_RESET_GPIO_Port, TOUCH_RESET_Pin, GPIO_PIN_SET);
+    HAL_Delay(6);
+
+    /* The GT911 drives INT from now on, it accepts commands 50 ms later */
+    gpio.Mode = GPIO_MODE_INPUT;
+    HAL_GPIO_Init(TOUCH_INT_GPIO_Port, &gpio);
+    HAL_Delay(55);
+
+    err = i2c_recover();
+    if (err == TOUCH_OK) {
+        err = gt911_read(GT911_REG_PRODUCT_ID, id, sizeof(id));
+    }
+    if (err == TOUCH_OK) {
+        err = gt911_read(GT911_REG_MODULE_SWITCH1, &config, 1);
+    }
+    if (err != TOUCH_OK) {
+        return err;
+    }
+    if (id[0] != '9' || id[1] != '1' || id[2] != '1') {
+        return TOUCH_ERR_ID;
+    }
+    touch_res_x = (uint16_t)(id[6] | (id[7] << 8));
+    touch_res_y = (uint16_t)(id[8] | (id[9] << 8));
+    if (info != NULL) {
+        info->firmware = (uint16_t)(id[4] | (id[5] << 8));
+        info->res_x = touch_res_x;
+        info->res_y = touch_res_y;
+        info->trigger = config & 0x03;
+    }
+
+    touch_last_down = 0;
+    touch_tail = touch_head;
+    if (gt911_write(GT911_REG_STATUS, &clear, 1) != TOUCH_OK) {
+        return TOUCH_ERR_NACK;
+    }
+
+    /* Edge of the INT pulse the GT911 is configured for, level modes pulse too */
+    gpio.Mode = ((config & 0x03) == 0 || (config & 0x03) == 3) ? GPIO_MODE_IT_RISING : GPIO_MODE_IT_FALLING;
+    HAL_GPIO_Init(TOUCH_INT_GPIO_Port, &gpio);
+    __HAL_GPIO_EXTI_CLEAR_IT(TOUCH_INT_Pin);
+    touch_ready = true;
+    HAL_NVIC_SetPriority(EXTI4_IRQn, TOUCH_IRQ_PRIORITY, 0);
+    HAL_NVIC_EnableIRQ(EXTI4_IRQn);
+
+    return TOUCH_OK;
+}
+
+void touch_gt911_deinit(void)
+{
+    HAL_NVIC_DisableIRQ(EXTI4_IRQn);
+    touch_ready = false;
+}
+
+bool touch_gt911_read(touch_event_t *event)
+{
+    uint32_t tail = touch_tail;
+
+    if (tail == touch_head) {
+        return false;
+    }
+    __DMB();                                                // Read the event after seeing it published
+    *event = touch_queue[tail & (TOUCH_QUEUE_SIZE - 1U)];
+    __DMB();                                                // Copied before the slot is handed back
+    touch_tail = tail + 1U;
+    return true;
+}
+
+uint32_t touch_gt911_pending(void)
+{
+    return touch_head - touch_tail;
+}
+
+const touch_stats_t *touch_gt911_get_stats(void)
+{
+    return &touch_stats;
+}
+
+void touch_gt911_reset_stats(void)
+{
+    memset(&touch_stats, 0, sizeof(touch_stats));
+}
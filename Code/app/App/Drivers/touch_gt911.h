@@ -0,0 +1,135 @@
+/**
+ * @file touch_gt911.h
+ * @brief GT911 capacitive touch driver, woken by the INT line, multi-touch events through a lock-free queue
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note The I2C bus is only touched when the GT911 signals a new report on
+ *       INT (EXTI line 4), never polled. The EXTI interrupt reads the status
+ *       byte and all TOUCH_POINTS_MAX points in one I2C transaction from
+ *       0x814E, clears the status and queues one event. The event carries
+ *       the HAL_GetTick() time of the INT edge, not of the end of the read.
+ *
+ *       TOUCH_SCL / TOUCH_SDA (PE5 / PE6) have no I2C alternate function, so
+ *       the transaction is clocked by the CPU on the open-drain pins. Half
+ *       periods are timed with the DWT cycle counter against SystemCoreClock
+ *       (touch_gt911_init() enables it), so SCL stays under TOUCH_I2C_HZ at
+ *       any clock and optimisation level. At about 400 kHz it takes 1.2 ms, which is why the interrupt runs at
+ *       TOUCH_IRQ_PRIORITY, below SysTick and every other interrupt: only
+ *       the main loop waits for it.
+ *
+ *       Latency: an event is in the queue about 1.2 ms after the GT911
+ *       raises INT. Read the queue once per frame before drawing and the
+ *       touch reaches the screen with the next frame.
+ *
+ *       Queue: single producer (the interrupt), single consumer (the main
+ *       loop). Each side only writes its own index, no interrupt masking.
+ *       When it is full the report is dropped. The next queued event is
+ *       compared with the last queued one, so a finger that went up or down
+ *       meanwhile is still reported once.
+ */
+
+#ifndef __TOUCH_GT911_H__
+#define __TOUCH_GT911_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "main.h"
+
+#define TOUCH_GT911_ADDR                0x5D        // 7-bit, selected by INT low during reset (0x14 with INT high)
+#define TOUCH_POINTS_MAX                5           // GT911 point registers
+#define TOUCH_EVENT_POINTS              (TOUCH_POINTS_MAX * 2)  // All down, all lifted
+#define TOUCH_QUEUE_SIZE                16          // Events, power of two
+#define TOUCH_LCD_WIDTH                 800         // Coordinates are scaled from the GT911 resolution to these
+#define TOUCH_LCD_HEIGHT                480
+#define TOUCH_I2C_HZ                    400000      // SCL at most, each half period is timed with DWT->CYCCNT
+#define TOUCH_I2C_STRETCH_MAX           1000        // SCL reads waiting for a clock stretch
+#define TOUCH_IRQ_PRIORITY              15          // Lowest, below SysTick (TICK_INT_PRIORITY 14)
+
+/* GT911 registers */
+#define GT911_REG_CONFIG                0x8047      // Config version, first byte of the configuration
+#define GT911_REG_MODULE_SWITCH1        0x804D      // Bits 1:0 INT trigger: 0 rising, 1 falling, 2 low, 3 high level
+#define GT911_REG_PRODUCT_ID            0x8140      // "911\0", firmware version, x / y resolution
+#define GT911_REG_STATUS                0x814E      // Bit 7 buffer ready, bits 3:0 number of points
+#define GT911_REG_POINT1                0x814F      // 8 bytes per point: track id, x, y, size (LE), reserved
+
+#define GT911_STATUS_READY              0x80
+#define GT911_STATUS_POINTS             0x0F
+#define GT911_POINT_SIZE                8
+
+typedef enum {
+    TOUCH_OK = 0,
+    TOUCH_ERR_NACK,                                 // No device answered at TOUCH_GT911_ADDR
+    TOUCH_ERR_BUS,                                  // SDA or SCL held low
+    TOUCH_ERR_ID,                                   // Product ID is not "911"
+} touch_error_t;
+
+typedef enum {
+    TOUCH_DOWN = 0,
+    TOUCH_MOVE,                                     // Still down, same or new position
+    TOUCH_UP,                                       // Lifted, position of the last report
+} touch_action_t;
+
+typedef struct {
+    uint8_t     id;                                 // GT911 track id, the same while the finger stays down
+    uint8_t     action;                             // touch_action_t
+    uint16_t    x;                                  // LCD pixels
+    uint16_t    y;
+    uint16_t    size;                               // Contact area reported by the GT911
+} touch_point_t;
+
+typedef struct {
+    uint32_t    tick;                               // HAL_GetTick() at the INT edge
+    uint8_t     down;                               // Fingers down, points[0 .. down - 1]
+    uint8_t     count;                              // down + the fingers lifted since the last event
+    touch_point_t points[TOUCH_EVENT_POINTS];
+} touch_event_t;
+
+typedef struct {
+    uint16_t    res_x;                              // Panel resolution configured in the GT911
+    uint16_t    res_y;
+    uint16_t    firmware;
+    uint8_t     trigger;                            // INT trigger, GT911_REG_MODULE_SWITCH1 bits 1:0
+} touch_info_t;
+
+typedef struct {
+    uint32_t    irqs;                               // INT edges
+    uint32_t    reports;                            // Reads with the buffer ready bit set
+    uint32_t    events;                             // Events queued
+    uint32_t    dropped;                            // Reports lost to a full queue
+    uint32_t    errors;                             // Reads not acknowledged
+    uint32_t    bytes;                              // Bytes on the bus, both directions
+} touch_stats_t;
+
+/**
+ * @brief Reset the GT911 to TOUCH_GT911_ADDR, check its ID, then enable the INT interrupt
+ * @param info panel data read from the GT911, may be NULL
+ * @note  Takes about 60 ms (reset timing). Call after MX_GPIO_Init().
+ */
+touch_error_t touch_gt911_init(touch_info_t *info);
+
+/**
+ * @brief Disable the INT interrupt, queued events are kept
+ */
+void touch_gt911_deinit(void);
+
+/**
+ * @brief Take the oldest event
+ * @return false if the queue is empty
+ */
+bool touch_gt911_read(touch_event_t *event);
+
+/**
+ * @brief Events waiting in the queue
+ */
+uint32_t touch_gt911_pending(void);
+
+/**
+ * @brief INT edge handler, called from HAL_GPIO_EXTI_Callback()
+ */
+void touch_gt911_irq(void);
+
+const touch_stats_t *touch_gt911_get_stats(void);
+void touch_gt911_reset_stats(void);
+
+#endif /* __TOUCH_GT911_H__ */
@@ -0,0 +1,352 @@
+/**
+ * @file gfx_anim.c
+ * @brief Sprite sheet and frame sequence animation, frames prefetched from external flash by MDMA
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note Per draw, every visible sprite becomes one job: the clipped frame
+ *       area in the sheet and on the canvas. Jobs that fit a staging buffer
+ *       take the two buffers in turn, so job k + 1 is fetched into the one
+ *       job k - 1 was blended from, after that blend has finished.
+ */
+
+#include <stddef.h>
+#include "main.h"
+#include "dma2d.h"
+#include "mdma_fetch.h"
+#include "gfx_anim.h"
+
+typedef struct {
+    uint32_t    src;                                // First visible pixel in the sheet
+    uint32_t    src_pitch;                          // Bytes
+    uint32_t    row_bytes;
+    uint32_t    dst;
+    uint16_t    w;
+    uint16_t    h;
+    uint16_t    pitch;                              // Pixels, of the sheet or of the staging buffer
+    uint8_t     format;
+    uint8_t     alpha;
+    int8_t      buf;                                // Staging buffer, -1 to blend from the sheet
+} anim_job_t;
+
+/* Frame staged by the end of the last draw, valid while buf >= 0 */
+typedef struct {
+    uint32_t    src;
+    uint32_t    src_pitch;
+    uint32_t    row_bytes;
+    uint16_t    h;
+    int8_t      buf;
+} anim_staged_t;
+
+static const uint32_t anim_color_mode[] = { DMA2D_INPUT_RGB565, DMA2D_INPUT_ARGB8888, DMA2D_INPUT_ARGB4444 };
+static const uint8_t anim_bpp[] = { 2, 4, 2 };
+
+__attribute__((section(".sram_noncache_bss"), aligned(32))) static uint8_t anim_stage[2][GFX_ANIM_STAGE_SIZE];  // MDMA -> DMA2D
+static anim_staged_t anim_staged = { 0, 0, 0, 0, -1 };
+static gfx_anim_stats_t anim_stats;
+
+/* Clip position after ms more, stopping on the last frame unless the sprite loops */
+static void anim_advance(const gfx_anim_sprite_t *s, uint32_t ms, uint16_t *frame, uint16_t *elapsed)
+{
+    uint32_t frame_ms = s->sheet->frame_ms;
+    uint32_t t = (uint32_t)s->elapsed_ms + ms;
+    uint32_t steps;
+
+    *frame = s->frame;
+    *elapsed = s->elapsed_ms;
+    if (frame_ms == 0 || s->count < 2U) {
+        return;                                     // Still image
+    }
+    steps = t / frame_ms;
+    *elapsed = (uint16_t)(t % frame_ms);
+    if (s->flags & GFX_ANIM_LOOP) {
+        *frame = (uint16_t)((s->frame + steps) % s->count);
+    } else if (s->frame + steps >= s->count) {
+        *frame = s->count - 1U;
+        *elapsed = 0;
+    } else {
+        *frame = (uint16_t)(s->frame + steps);
+    }
+}
+
+/* Job for frame `frame` of the clip, false if nothing of it is visible */
+static bool anim_job(const gfx_anim_sprite_t *s, uint16_t frame, const gfx_canvas_t *canvas, anim_job_t *job)
+{
+    const gfx_anim_sheet_t *sh = s->sheet;
+    gfx_rect_t rect = { s->x, s->y, (int16_t)sh->frame_w, (int16_t)sh->frame_h };
+    gfx_rect_t area;
+    uint32_t f = (uint32_t)s->first + frame;
+    uint32_t bpp = anim_bpp[sh->format];
+
+    if (!(s->flags & GFX_ANIM_VISIBLE) || s->opacity == 0 || !gfx_rect_intersect(&rect, &canvas->clip, &area)) {
+        return false;
+    }
+
+    job->src_pitch = (uint32_t)sh->pitch * bpp;
+    job->src = sh->addr + (f / sh->cols) * sh->frame_h * job->src_pitch + (f % sh->cols) * sh->frame_w * bpp +
+               (uint32_t)(area.y - s->y) * job->src_pitch + (uint32_t)(area.x - s->x) * bpp;
+    job->row_bytes = (uint32_t)area.w * bpp;
+    job->dst = canvas->buffer + ((uint32_t)area.y * canvas->pitch + (uint32_t)area.x) * 2U;
+    job->w = (uint16_t)area.w;
+    job->h = (uint16_t)area.h;
+    job->pitch = sh->pitch;
+    job->format = sh->format;
+    job->alpha = s->opacity;
+    job->buf = -1;
+    return true;
+}
+
+static bool anim_fits(const anim_job_t *job)
+{
+    return job->row_bytes * job->h <= GFX_ANIM_STAGE_SIZE;
+}
+
+static bool anim_is_staged(const anim_staged_t *staged, const anim_job_t *job)
+{
+    return staged->buf >= 0 && staged->src == job->src && staged->src_pitch == job->src_pitch &&
+           staged->row_bytes == job->row_bytes && staged->h == job->h;
+}
+
+/* Start the fetch of a job into its staging buffer, falls back to the sheet if MDMA refuses */
+static void anim_fetch(anim_job_t *job)
+{
+    mdma_fetch_wait();                              // Prefetch of the last draw that was not used
+    if (mdma_fetch_start(job->src, job->src_pitch, (uint32_t)anim_stage[job->buf], job->row_bytes, job->h) != MDMA_FETCH_OK) {
+        job->buf = -1;
+        return;
+    }
+    anim_stats.fetches++;
+}
+
+static void anim_sort(gfx_anim_t *anim)
+{
+    for (uint32_t i = 0; i < anim->count; i++) {
+        anim->order[i] = (uint8_t)i;
+    }
+    /* Insertion sort, stable: equal z keeps the order of adding */
+    for (uint32_t i = 1; i < anim->count; i++) {
+        uint8_t id = anim->order[i];
+        uint32_t j = i;
+
+        while (j > 0 && anim->sprites[anim->order[j - 1U]].z > anim->sprites[id].z) {
+            anim->order[j] = anim->order[j - 1U];
+            j--;
+        }
+        anim->order[j] = id;
+    }
+    anim->sorted = true;
+}
+
+void gfx_anim_init(gfx_anim_t *anim)
+{
+    anim->count = 0;
+    anim->sorted = true;
+    anim->prefetch = true;
+    anim->tick_ms = 0;
+}
+
+gfx_anim_error_t gfx_anim_add(gfx_anim_t *anim, const gfx_anim_sheet_t *sheet, uint16_t first, uint16_t count,
+                              int16_t x, int16_t y, int8_t z, uint8_t *id)
+{
+    gfx_anim_sprite_t *s;
+
+    if (sheet == NULL || sheet->frame_w == 0 || sheet->frame_h == 0 || sheet->cols == 0 ||
+        sheet->format > GFX_ANIM_ARGB4444 || sheet->pitch < (uint32_t)sheet->frame_w * sheet->cols ||
+        count == 0 || (uint32_t)first + count > sheet->frames) {
+        return GFX_ANIM_ERR_PARAM;
+    }
+    if (anim->count >= GFX_ANIM_SPRITES_MAX) {
+        return GFX_ANIM_ERR_FULL;
+    }
+
+    s = &anim->sprites[anim->count];
+    s->sheet = sheet;
+    s->x = x;
+    s->y = y;
+    s->first = first;
+    s->count = count;
+    s->frame = 0;
+    s->elapsed_ms = 0;
+    s->opacity = 255;
+    s->z = z;
+    s->flags = GFX_ANIM_VISIBLE | GFX_ANIM_LOOP;
+    if (id != NULL) {
+        *id = anim->count;
+    }
+    anim->count++;
+    anim->sorted = false;
+
+    return GFX_ANIM_OK;
+}
+
+void gfx_anim_set_pos(gfx_anim_t *anim, uint8_t id, int16_t x, int16_t y)
+{
+    if (id < anim->count) {
+        anim->sprites[id].x = x;
+        anim->sprites[id].y = y;
+    }
+}
+
+void gfx_anim_set_opacity(gfx_anim_t *anim, uint8_t id, uint8_t opacity)
+{
+    if (id < anim->count) {
+        anim->sprites[id].opacity = opacity;
+    }
+}
+
+void gfx_anim_set_z(gfx_anim_t *anim, uint8_t id, int8_t z)
+{
+    if (id < anim->count && anim->sprites[id].z != z) {
+        anim->sprites[id].z = z;
+        anim->sorted = false;
+    }
+}
+
+void gfx_anim_set_flags(gfx_anim_t *anim, uint8_t id, uint8_t flags)
+{
+    if (id < anim->count) {
+        anim->sprites[id].flags = flags;
+    }
+}
+
+void gfx_anim_set_frame(gfx_anim_t *anim, uint8_t id, uint16_t frame)
+{
+    if (id < anim->count && frame < anim->sprites[id].count) {
+        anim->sprites[id].frame = frame;
+        anim->sprites[id].elapsed_ms = 0;
+    }
+}
+
+void gfx_anim_sprite_rect(const gfx_anim_t *anim, uint8_t id, gfx_rect_t *rect)
+{
+    const gfx_anim_sprite_t *s;
+
+    if (id >= anim->count || !(anim->sprites[id].flags & GFX_ANIM_VISIBLE)) {
+        rect->x = rect->y = rect->w = rect->h = 0;
+        return;
+    }
+    s = &anim->sprites[id];
+    rect->x = s->x;
+    rect->y = s->y;
+    rect->w = (int16_t)s->sheet->frame_w;
+    rect->h = (int16_t)s->sheet->frame_h;
+}
+
+bool gfx_anim_tick(gfx_anim_t *anim, uint32_t ms)
+{
+    bool changed = false;
+
+    anim->tick_ms = (ms > 0xFFFFU) ? 0xFFFFU : (uint16_t)ms;
+    for (uint32_t i = 0; i < anim->count; i++) {
+        gfx_anim_sprite_t *s = &anim->sprites[i];
+        uint16_t frame;
+
+        anim_advance(s, ms, &frame, &s->elapsed_ms);
+        if (frame != s->frame) {
+            s->frame = frame;
+            changed |= (s->flags & GFX_ANIM_VISIBLE) != 0;
+        }
+    }
+    return changed;
+}
+
+void gfx_anim_draw(gfx_anim_t *anim, const gfx_canvas_t *canvas)
+{
+    anim_job_t jobs[GFX_ANIM_SPRITES_MAX];
+    anim_staged_t staged = anim_staged;
+    uint32_t n = 0;
+    int8_t buf = 0;
+    bool hit = false;
+
+    if (!anim->sorted) {
+        anim_sort(anim);
+    }
+    for (uint32_t i = 0; i < anim->count; i++) {
+        const gfx_anim_sprite_t *s = &anim->sprites[anim->order[i]];
+
+        n += anim_job(s, s->frame, canvas, &jobs[n]) ? 1U : 0U;
+    }
+    anim_stats.draws++;
+
+    /* Staging buffers in turn, the first one continues from the frame staged by the last draw */
+    anim_staged.buf = -1;
+    for (uint32_t k = 0; k < n && anim->prefetch; k++) {
+        if (!anim_fits(&jobs[k])) {
+            continue;
+        }
+        if (k == 0 && anim_is_staged(&staged, &jobs[0])) {
+            buf = staged.buf;
+            hit = true;
+            anim_stats.hits++;
+        }
+        jobs[k].buf = buf;
+        buf ^= 1;
+    }
+    if (n > 0 && jobs[0].buf >= 0 && !hit) {
+        anim_fetch(&jobs[0]);
+    }
+
+    for (uint32_t k = 0; k < n; k++) {
+        anim_job_t *job = &jobs[k];
+
+        if (job->buf >= 0) {
+            anim_stats.stalls += mdma_fetch_busy() ? 1U : 0U;
+            if (mdma_fetch_wait() != MDMA_FETCH_OK) {
+                job->buf = -1;
+            }
+        }
+
+        /* The next fetch overwrites the buffer the previous blend read */
+        DMA2D_wait();
+        if (k + 1U < n && jobs[k + 1U].buf >= 0) {
+            anim_fetch(&jobs[k + 1U]);
+        }
+
+        if (job->buf >= 0) {
+            DMA2D_blend_rect_start((uint32_t)anim_stage[job->buf], job->w, anim_color_mode[job->format], job->alpha,
+                                   job->dst, canvas->pitch, job->w, job->h);
+        } else {
+            DMA2D_blend_rect_start(job->src, job->pitch, anim_color_mode[job->format], job->alpha,
+                                   job->dst, canvas->pitch, job->w, job->h);
+            anim_stats.direct++;
+        }
+        anim_stats.blends++;
+    }
+    DMA2D_wait();
+
+    /* Bottom sprite of the next draw, in the frame it will most likely show */
+    if (anim->prefetch) {
+        for (uint32_t i = 0; i < anim->count; i++) {
+            const gfx_anim_sprite_t *s = &anim->sprites[anim->order[i]];
+            uint16_t frame, elapsed;
+            anim_job_t next;
+
+            anim_advance(s, anim->tick_ms, &frame, &elapsed);
+            if (!anim_job(s, frame, canvas, &next)) {
+                continue;
+            }
+            if (anim_fits(&next)) {
+                next.buf = 0;
+                anim_fetch(&next);
+                if (next.buf >= 0) {
+                    anim_staged.src = next.src;
+                    anim_staged.src_pitch = next.src_pitch;
+                    anim_staged.row_bytes = next.row_bytes;
+                    anim_staged.h = next.h;
+                    anim_staged.buf = 0;
+                }
+            }
+            break;
+        }
+    }
+}
+
+const gfx_anim_stats_t *gfx_anim_get_stats(void)
+{
+    return &anim_stats;
+}
+
+void gfx_anim_reset_stats(void)
+{
+    anim_stats = (gfx_anim_stats_t){ 0 };
+}
@@ -0,0 +1,140 @@
+/**
+ * @file gfx_anim.h
+ * @brief Sprite sheet and frame sequence animation, frames prefetched from external flash by MDMA
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note A sheet is a grid of equally sized frames in RO_DATA (OSPI, XIP):
+ *       frame f sits at column f % cols, row f / cols. A frame sequence is a
+ *       sheet with one column, frames stored one after the other.
+ *
+ *       Sprites play a clip of a sheet at a position, opacity and z order.
+ *       gfx_anim_draw() blends them bottom to top with DMA2D. Reading the
+ *       frames straight from XIP makes every blend wait on the flash, so the
+ *       visible part of each frame is first copied by MDMA into one of two
+ *       staging buffers in RAM_NOCACHE: while DMA2D blends sprite k from one
+ *       buffer, MDMA fetches sprite k + 1 into the other. After the last
+ *       blend the first sprite's frame of the next draw is fetched already
+ *       (predicted from the last tick step), so it is ready when the next
+ *       frame starts. Frames larger than a staging buffer are blended from
+ *       flash directly.
+ */
+
+#ifndef __GFX_ANIM_H__
+#define __GFX_ANIM_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gfx_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GFX_ANIM_SPRITES_MAX            16
+#define GFX_ANIM_STAGE_SIZE             16384       // Bytes per staging buffer, two in RAM_NOCACHE (32 KB)
+
+/* Sprite flags */
+#define GFX_ANIM_VISIBLE                0x01
+#define GFX_ANIM_LOOP                   0x02        // Restart the clip, otherwise stop on its last frame
+
+typedef enum {
+    GFX_ANIM_RGB565 = 0,
+    GFX_ANIM_ARGB8888,                              // Straight (not premultiplied) alpha
+    GFX_ANIM_ARGB4444,
+} gfx_anim_format_t;
+
+typedef enum {
+    GFX_ANIM_OK = 0,
+    GFX_ANIM_ERR_PARAM,
+    GFX_ANIM_ERR_FULL,                              // GFX_ANIM_SPRITES_MAX sprites already
+} gfx_anim_error_t;
+
+typedef struct {
+    uint32_t    addr;                               // Pixel (0, 0) of frame 0, RO_DATA or RAM
+    uint16_t    pitch;                              // Sheet line length in pixels
+    uint16_t    frame_w;
+    uint16_t    frame_h;
+    uint16_t    frames;
+    uint8_t     cols;                               // Frames per sheet row, 1 for a frame sequence
+    uint8_t     format;                             // gfx_anim_format_t
+    uint16_t    frame_ms;                           // Display time of one frame
+} gfx_anim_sheet_t;
+
+typedef struct {
+    const gfx_anim_sheet_t *sheet;
+    int16_t     x;
+    int16_t     y;
+    uint16_t    first;                              // Clip: sheet frames first .. first + count - 1
+    uint16_t    count;
+    uint16_t    frame;                              // Current frame within the clip
+    uint16_t    elapsed_ms;                         // Time shown so far
+    uint8_t     opacity;
+    int8_t      z;                                  // Higher is drawn on top, equal z keeps the order of adding
+    uint8_t     flags;
+} gfx_anim_sprite_t;
+
+typedef struct {
+    gfx_anim_sprite_t sprites[GFX_ANIM_SPRITES_MAX];
+    uint8_t     order[GFX_ANIM_SPRITES_MAX];        // Sprite indices bottom to top
+    uint8_t     count;
+    bool        sorted;
+    bool        prefetch;                           // false: blend every frame straight from its sheet
+    uint16_t    tick_ms;                            // Last gfx_anim_tick() step, predicts the next frame
+} gfx_anim_t;
+
+typedef struct {
+    uint32_t    draws;
+    uint32_t    blends;                             // DMA2D jobs
+    uint32_t    fetches;                            // MDMA jobs
+    uint32_t    hits;                               // Frames staged by the previous draw and used
+    uint32_t    direct;                             // Blends from the sheet (too large, prefetch off or MDMA error)
+    uint32_t    stalls;                             // Blends that had to wait for their fetch
+} gfx_anim_stats_t;
+
+/**
+ * @brief Empty sprite set, prefetch on
+ */
+void gfx_anim_init(gfx_anim_t *anim);
+
+/**
+ * @brief Add a visible, looping sprite playing frames first .. first + count - 1 of a sheet
+ * @param id index of the new sprite, for the setters
+ */
+gfx_anim_error_t gfx_anim_add(gfx_anim_t *anim, const gfx_anim_sheet_t *sheet, uint16_t first, uint16_t count,
+                              int16_t x, int16_t y, int8_t z, uint8_t *id);
+
+void gfx_anim_set_pos(gfx_anim_t *anim, uint8_t id, int16_t x, int16_t y);
+void gfx_anim_set_opacity(gfx_anim_t *anim, uint8_t id, uint8_t opacity);
+void gfx_anim_set_z(gfx_anim_t *anim, uint8_t id, int8_t z);
+void gfx_anim_set_flags(gfx_anim_t *anim, uint8_t id, uint8_t flags);
+
+/**
+ * @brief Jump to a frame of the clip
+ */
+void gfx_anim_set_frame(gfx_anim_t *anim, uint8_t id, uint16_t frame);
+
+/**
+ * @brief Canvas area a sprite covers, empty if it is hidden
+ */
+void gfx_anim_sprite_rect(const gfx_anim_t *anim, uint8_t id, gfx_rect_t *rect);
+
+/**
+ * @brief Advance all clips
+ * @return true if any visible sprite changed frame
+ */
+bool gfx_anim_tick(gfx_anim_t *anim, uint32_t ms);
+
+/**
+ * @brief Blend all visible sprites onto the canvas, bottom to top
+ */
+void gfx_anim_draw(gfx_anim_t *anim, const gfx_canvas_t *canvas);
+
+const gfx_anim_stats_t *gfx_anim_get_stats(void);
+void gfx_anim_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __GFX_ANIM_H__ */
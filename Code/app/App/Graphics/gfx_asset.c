@@ -0,0 +1,136 @@
+/**
+ * @file gfx_asset.c
+ * @brief Resource bundle in RO_DATA: perfect hash lookup and DMA2D drawing of pre-converted assets
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#include <string.h>
+#include "main.h"
+#include "dma2d.h"
+#include "gfx_image.h"
+#include "gfx_asset.h"
+
+/* Must match assetpack.py */
+static uint32_t asset_fnv1a(const char *name)
+{
+    uint32_t h = 0x811C9DC5UL;
+
+    while (*name != '\0') {
+        h = (h ^ (uint8_t)*name++) * 0x01000193UL;
+    }
+    return h;
+}
+
+static inline uint32_t asset_mix(uint32_t h, uint32_t d) {
+    h ^= d * 0x9E3779B9UL;
+    h ^= h >> 16;
+    h *= 0x85EBCA6BUL;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35UL;
+    h ^= h >> 16;
+    return h;
+}
+
+gfx_asset_error_t gfx_asset_open(gfx_bundle_t *bundle, uint32_t addr)
+{
+    const gfx_bundle_header_t *h = (const gfx_bundle_header_t *)addr;
+
+    if (bundle == NULL || h == NULL || (addr & (GFX_BUNDLE_ALIGN - 1U)) != 0U) {
+        return GFX_ASSET_ERR_PARAM;
+    }
+    if (h->magic != GFX_BUNDLE_MAGIC || h->version != GFX_BUNDLE_VERSION ||
+        h->header_size < sizeof(gfx_bundle_header_t) || h->count == 0U) {
+        return GFX_ASSET_ERR_FORMAT;
+    }
+
+    bundle->base = addr;
+    bundle->count = h->count;
+    bundle->disp = (const int32_t *)(addr + h->disp_offset);
+    bundle->assets = (const gfx_asset_t *)(addr + h->entry_offset);
+    return GFX_ASSET_OK;
+}
+
+const gfx_asset_t *gfx_asset_find(const gfx_bundle_t *bundle, const char *name)
+{
+    const gfx_asset_t *a;
+    uint32_t h, slot;
+    int32_t d;
+
+    if (bundle == NULL || name == NULL) {
+        return NULL;
+    }
+    h = asset_fnv1a(name);
+    d = bundle->disp[h % bundle->count];
+    slot = (d < 0) ? (uint32_t)(-d - 1) : asset_mix(h, (uint32_t)d) % bundle->count;
+
+    /* Names outside the bundle hash to some slot too */
+    a = &bundle->assets[slot];
+    if (a->hash != h || strcmp(gfx_asset_name(bundle, a), name) != 0) {
+        return NULL;
+    }
+    return a;
+}
+
+gfx_asset_error_t gfx_asset_draw(const gfx_canvas_t *canvas, const gfx_bundle_t *bundle, const gfx_asset_t *asset,
+                                 int16_t x, int16_t y, uint32_t argb)
+{
+    static const uint8_t bpp[] = { 2, 2, 4, 1, 1 };     // By gfx_asset_format_t
+    static const uint32_t cm[] = { DMA2D_INPUT_RGB565, DMA2D_INPUT_ARGB4444, DMA2D_INPUT_ARGB8888,
+                                   DMA2D_INPUT_A8, DMA2D_INPUT_L8 };
+    gfx_rect_t area, r;
+    uint32_t src, dst;
+
+    if (canvas == NULL || bundle == NULL || asset == NULL) {
+        return GFX_ASSET_ERR_PARAM;
+    }
+    if (asset->format > GFX_ASSET_L8) {
+        return GFX_ASSET_ERR_TYPE;
+    }
+    if (asset->codec != GFX_ASSET_RAW) {
+        return (gfx_img_draw(canvas, gfx_asset_addr(bundle, asset), asset->size, x, y) == GFX_IMG_OK)
+               ? GFX_ASSET_OK : GFX_ASSET_ERR_DECODE;
+    }
+
+    area.x = x;
+    area.y = y;
+    area.w = (int16_t)asset->width;
+    area.h = (int16_t)asset->height;
+    if (!gfx_rect_intersect(&area, &canvas->clip, &r)) {
+        return GFX_ASSET_OK;
+    }
+    src = gfx_asset_addr(bundle, asset) +
+          ((uint32_t)(r.y - y) * asset->pitch + (uint32_t)(r.x - x)) * bpp[asset->format];
+    dst = canvas->buffer + ((uint32_t)r.y * canvas->pitch + (uint32_t)r.x) * 2U;
+
+    switch (asset->format) {
+    case GFX_ASSET_RGB565:
+        DMA2D_copy_rect(src, asset->pitch, dst, canvas->pitch, (uint16_t)r.w, (uint16_t)r.h, DMA2D_INPUT_RGB565);
+        break;
+    case GFX_ASSET_L8:
+        DMA2D_load_clut((const uint32_t *)(bundle->base + asset->clut), asset->clut_size);
+        DMA2D_convert_rect(src, asset->pitch, DMA2D_INPUT_L8, dst, canvas->pitch, (uint16_t)r.w, (uint16_t)r.h);
+        break;
+    case GFX_ASSET_A8:
+        DMA2D_blend_a8_start(src, asset->pitch, dst, canvas->pitch, (uint16_t)r.w, (uint16_t)r.h, argb);
+        DMA2D_wait();
+        break;
+    default:
+        DMA2D_blend_rect(src, asset->pitch, cm[asset->format], (uint8_t)(argb >> 24), dst, canvas->pitch,
+                         (uint16_t)r.w, (uint16_t)r.h);
+        break;
+    }
+    return GFX_ASSET_OK;
+}
+
+gfx_asset_error_t gfx_asset_font(const gfx_bundle_t *bundle, const gfx_asset_t *asset, gfx_font_t *font)
+{
+    if (bundle == NULL || asset == NULL || font == NULL) {
+        return GFX_ASSET_ERR_PARAM;
+    }
+    if (asset->format != GFX_ASSET_FONT) {
+        return GFX_ASSET_ERR_TYPE;
+    }
+    return (gfx_font_open(font, gfx_asset_addr(bundle, asset)) == GFX_FONT_OK) ? GFX_ASSET_OK : GFX_ASSET_ERR_FORMAT;
+}
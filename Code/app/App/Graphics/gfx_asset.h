@@ -0,0 +1,140 @@
+/**
+ * @file gfx_asset.h
+ * @brief Resource bundle in RO_DATA: perfect hash lookup and DMA2D drawing of pre-converted assets
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note The bundle is built on the host by Tools/assetpack/assetpack.py and
+ *       linked into .ro_data or flashed to RO_DATA (0x90200000). Every image
+ *       is already in the pixel format it is drawn from (RGB565, ARGB4444,
+ *       A8, L8 + CLUT), starts on a 32 byte cache line and has a padded line
+ *       pitch, so drawing is one DMA2D job with no parsing or conversion on
+ *       the target. RGB565 images may be LZ4 / QOI compressed (gfx_image).
+ *
+ *       Lookup by name is a minimal perfect hash: one FNV-1a pass over the
+ *       name, one displacement read and one string compare. assetpack also
+ *       writes a header with the slot of every asset for lookups by index.
+ */
+
+#ifndef __GFX_ASSET_H__
+#define __GFX_ASSET_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gfx_types.h"
+#include "gfx_font.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GFX_BUNDLE_MAGIC                0x444E4247UL    // "GBND"
+#define GFX_BUNDLE_VERSION              1
+#define GFX_BUNDLE_ALIGN                32              // Asset data alignment, one cache line
+
+typedef enum {
+    GFX_ASSET_RGB565 = 0,
+    GFX_ASSET_ARGB4444,
+    GFX_ASSET_ARGB8888,
+    GFX_ASSET_A8,                                   // Tinted with the draw colour
+    GFX_ASSET_L8,                                   // With an ARGB8888 CLUT
+    GFX_ASSET_FONT,                                 // gfx_font_store_t
+    GFX_ASSET_BLOB,                                 // Raw bytes
+} gfx_asset_format_t;
+
+typedef enum {
+    GFX_ASSET_RAW = 0,
+    GFX_ASSET_LZ4,                                  // gfx_image streams, RGB565 only
+    GFX_ASSET_QOI,
+} gfx_asset_codec_t;
+
+typedef struct {
+    uint32_t    hash;                               // FNV-1a of the name
+    uint32_t    name;                               // Offsets are from the start of the bundle
+    uint32_t    data;                               // GFX_BUNDLE_ALIGN aligned
+    uint32_t    size;
+    uint16_t    width;
+    uint16_t    height;
+    uint16_t    pitch;                              // Line length in pixels (>= width), raw images
+    uint8_t     format;                             // gfx_asset_format_t
+    uint8_t     codec;                              // gfx_asset_codec_t
+    uint32_t    clut;                               // L8: ARGB8888 CLUT offset
+    uint16_t    clut_size;
+    uint16_t    reserved;
+} gfx_asset_t;
+
+typedef struct {
+    uint32_t    magic;
+    uint16_t    version;
+    uint16_t    header_size;
+    uint32_t    size;                               // Whole bundle in bytes
+    uint32_t    count;
+    uint32_t    disp_offset;                        // int32_t[count], perfect hash displacements
+    uint32_t    entry_offset;                       // gfx_asset_t[count], in slot order
+    uint32_t    reserved[2];
+} gfx_bundle_header_t;
+
+typedef struct {
+    uint32_t                    base;
+    uint32_t                    count;
+    const int32_t              *disp;
+    const gfx_asset_t          *assets;
+} gfx_bundle_t;
+
+#ifdef APP_ASSET_BUNDLE
+extern const uint8_t asset_bundle[];                // Linked by APP_ASSET_MANIFEST, see Code/app/CMakeLists.txt
+#endif
+
+typedef enum {
+    GFX_ASSET_OK = 0,
+    GFX_ASSET_ERR_PARAM,
+    GFX_ASSET_ERR_FORMAT,                           // Not a bundle or unsupported version
+    GFX_ASSET_ERR_TYPE,                             // Not drawable / not a font
+    GFX_ASSET_ERR_DECODE,                           // Compressed image is corrupt
+} gfx_asset_error_t;
+
+/**
+ * @brief Use a bundle in place
+ * @param addr address of the bundle, GFX_BUNDLE_ALIGN aligned
+ */
+gfx_asset_error_t gfx_asset_open(gfx_bundle_t *bundle, uint32_t addr);
+
+/**
+ * @brief Find an asset by name, NULL if the bundle does not have it
+ */
+const gfx_asset_t *gfx_asset_find(const gfx_bundle_t *bundle, const char *name);
+
+/**
+ * @brief Asset in a slot, see the header written by assetpack --header
+ */
+static inline const gfx_asset_t *gfx_asset_at(const gfx_bundle_t *bundle, uint32_t slot) {
+    return (slot < bundle->count) ? &bundle->assets[slot] : NULL;
+}
+
+static inline uint32_t gfx_asset_addr(const gfx_bundle_t *bundle, const gfx_asset_t *asset) {
+    return bundle->base + asset->data;
+}
+
+static inline const char *gfx_asset_name(const gfx_bundle_t *bundle, const gfx_asset_t *asset) {
+    return (const char *)(bundle->base + asset->name);
+}
+
+/**
+ * @brief Draw an image asset with its top left corner at (x, y), clipped
+ * @param argb A8: colour and alpha, other formats: only the alpha is used
+ *             (blended images are faded, opaque ones ignore it)
+ * @note  L8 images reload the DMA2D foreground CLUT.
+ */
+gfx_asset_error_t gfx_asset_draw(const gfx_canvas_t *canvas, const gfx_bundle_t *bundle, const gfx_asset_t *asset,
+                                 int16_t x, int16_t y, uint32_t argb);
+
+/**
+ * @brief Open a font store asset
+ */
+gfx_asset_error_t gfx_asset_font(const gfx_bundle_t *bundle, const gfx_asset_t *asset, gfx_font_t *font);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __GFX_ASSET_H__ */
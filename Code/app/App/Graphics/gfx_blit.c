@@ -0,0 +1,223 @@
+/**
+ * @file gfx_blit.c
+ * @brief Composited blits: source colour key, external A8 clip mask and constant opacity, in any combination
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#include <stddef.h>
+#include "main.h"
+#include "dma2d.h"
+#include "gfx_blit.h"
+
+__attribute__((section(".sram_bss"), aligned(32))) static uint32_t blit_clut[256];     // Read by DMA2D, L8 palette with the key entries made transparent
+static gfx_blit_stats_t blit_stats;
+
+/* ---------------------------------------------------------------- pixels --- */
+
+static inline uint32_t blit_pack(uint32_t argb)
+{
+    return ((argb >> 8) & 0xF800U) | ((argb >> 5) & 0x07E0U) | ((argb >> 3) & 0x001FU);
+}
+
+/* a * b / 255, exact at 0 and 255 */
+static inline uint32_t blit_mul(uint32_t a, uint32_t b)
+{
+    return (a * b + 255U) >> 8;
+}
+
+static inline uint16_t blit_blend(uint32_t d, uint32_t c, uint32_t a)
+{
+    if (a == 255U) {
+        return (uint16_t)c;
+    }
+    /* Both colours spread to 0000 0GGG GGG0 0000 RRRR R000 00BB BBBB: one multiply for all three channels */
+    uint32_t s32 = (c | (c << 16)) & 0x07E0F81FU;
+    uint32_t d32 = (d | (d << 16)) & 0x07E0F81FU;
+
+    d32 = (d32 + (((s32 - d32) * (a >> 3)) >> 5)) & 0x07E0F81FU;
+    return (uint16_t)(d32 | (d32 >> 16));
+}
+
+/* Two pixels of s, the ones equal to the key replaced by the ones of d */
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+static inline uint32_t blit_sel_key(uint32_t s, uint32_t d, uint32_t key2)
+{
+    (void)__USUB16(s ^ key2, 0x00010001U);          // GE bits set for the halfwords that differ from the key
+    return __SEL(s, d);
+}
+#else
+static inline uint32_t blit_sel_key(uint32_t s, uint32_t d, uint32_t key2)
+{
+    uint32_t x = s ^ key2;
+    uint32_t keep = (((x & 0x0000FFFFU) != 0U) ? 0x0000FFFFU : 0U) | (((x & 0xFFFF0000U) != 0U) ? 0xFFFF0000U : 0U);
+
+    return (s & keep) | (d & ~keep);
+}
+#endif
+
+/* RGB565 with a key, opaque: a word at a time once both lines are aligned alike */
+static void blit_row_key(uint16_t *d, const uint16_t *s, int32_t n, uint16_t key)
+{
+    uint32_t key2 = (uint32_t)key | ((uint32_t)key << 16);
+
+    if ((((uint32_t)(uintptr_t)d ^ (uint32_t)(uintptr_t)s) & 2U) == 0U) {
+        if (((uint32_t)(uintptr_t)d & 2U) != 0U && n > 0) {
+            *d = (*s != key) ? *s : *d;
+            d++;
+            s++;
+            n--;
+        }
+        for (; n >= 2; n -= 2) {
+            uint32_t *w = (uint32_t *)d;
+
+            *w = blit_sel_key(*(const uint32_t *)s, *w, key2);
+            d += 2;
+            s += 2;
+        }
+    }
+    for (int32_t i = 0; i < n; i++) {
+        d[i] = (s[i] != key) ? s[i] : d[i];
+    }
+}
+
+/* Any image combination: per pixel colour, key, CLUT alpha * opacity * mask */
+static void blit_row_mix(uint16_t *d, const gfx_blit_src_t *src, uint32_t s, const uint8_t *m, int32_t n,
+                         const gfx_blit_opts_t *opts)
+{
+    bool key = (opts->flags & GFX_BLIT_KEY) != 0U;
+
+    for (int32_t i = 0; i < n; i++) {
+        uint32_t c, a = 255U;
+
+        if (src->format == GFX_BLIT_L8) {
+            uint32_t index = ((const uint8_t *)s)[i];
+            uint32_t e = (index < src->clut_size) ? src->clut[index] : 0U;
+
+            c = blit_pack(e);
+            a = e >> 24;
+        } else {
+            c = ((const uint16_t *)s)[i];
+        }
+        if (key && c == opts->key) {
+            continue;
+        }
+        a = blit_mul(a, opts->opacity);
+        if (m != NULL) {
+            a = blit_mul(a, m[i]);
+        }
+        if (a >= 8U) {
+            d[i] = blit_blend(d[i], c, a);
+        }
+    }
+}
+
+static void blit_cpu(const gfx_canvas_t *canvas, const gfx_blit_src_t *src, const gfx_rect_t *r,
+                     uint32_t s, uint32_t bpp, const uint8_t *m, const gfx_blit_opts_t *opts)
+{
+    bool fast = src->format == GFX_BLIT_RGB565 && opts->flags == GFX_BLIT_KEY && opts->opacity == 255U;
+
+    DMA2D_wait();
+    for (int32_t j = 0; j < r->h; j++) {
+        uint16_t *d = (uint16_t *)(canvas->buffer + ((uint32_t)(r->y + j) * canvas->pitch + (uint32_t)r->x) * 2U);
+
+        SCB_CleanInvalidateDCache_by_Addr((uint32_t *)d, r->w * 2);     // DMA2D may have drawn the line behind the D-cache
+        if (fast) {
+            blit_row_key(d, (const uint16_t *)s, r->w, opts->key);
+        } else {
+            blit_row_mix(d, src, s, m, r->w, opts);
+        }
+        SCB_CleanDCache_by_Addr((uint32_t *)d, r->w * 2);
+        s += (uint32_t)src->pitch * bpp;
+        m = (m != NULL) ? m + opts->mask_pitch : NULL;
+    }
+    blit_stats.cpu_pixels += (uint32_t)r->w * (uint32_t)r->h;
+}
+
+/* ------------------------------------------------------------------- api --- */
+
+gfx_blit_error_t gfx_blit(const gfx_canvas_t *canvas, const gfx_blit_src_t *src, int16_t x, int16_t y,
+                          const gfx_blit_opts_t *opts)
+{
+    static const gfx_blit_opts_t copy = { 0U, 255U, 0U, 0U, 0U, { 0, 0, 0, 0 } };
+    gfx_rect_t area, r;
+    uint32_t bpp, s, dst, pixels;
+    const uint8_t *m = NULL;
+
+    if (canvas == NULL || src == NULL || src->format > GFX_BLIT_COLOR ||
+        (src->format != GFX_BLIT_COLOR && (src->addr == 0U || src->pitch < src->width)) ||
+        (src->format == GFX_BLIT_L8 && (src->clut == NULL || src->clut_size == 0U || src->clut_size > 256U))) {
+        return GFX_BLIT_ERR_PARAM;
+    }
+    if (opts == NULL) {
+        opts = &copy;
+    }
+    if ((opts->flags & GFX_BLIT_MASK) != 0U && opts->mask == 0U) {
+        return GFX_BLIT_ERR_PARAM;
+    }
+
+    area.x = x;
+    area.y = y;
+    area.w = (int16_t)src->width;
+    area.h = (int16_t)src->height;
+    if (opts->opacity == 0U || !gfx_rect_intersect(&area, &canvas->clip, &r) ||
+        ((opts->flags & GFX_BLIT_MASK) != 0U && !gfx_rect_intersect(&r, &opts->mask_area, &r))) {
+        return GFX_BLIT_OK;
+    }
+    blit_stats.blits++;
+
+    bpp = (src->format == GFX_BLIT_L8) ? 1U : 2U;
+    s = src->addr + ((uint32_t)(r.y - y) * src->pitch + (uint32_t)(r.x - x)) * bpp;
+    dst = canvas->buffer + ((uint32_t)r.y * canvas->pitch + (uint32_t)r.x) * 2U;
+    pixels = (uint32_t)r.w * (uint32_t)r.h;
+    if ((opts->flags & GFX_BLIT_MASK) != 0U) {
+        m = (const uint8_t *)opts->mask + (uint32_t)(r.y - opts->mask_area.y) * opts->mask_pitch +
+            (uint32_t)(r.x - opts->mask_area.x);
+    }
+
+    if (src->format == GFX_BLIT_COLOR) {
+        uint32_t argb = (blit_mul(src->color >> 24, opts->opacity) << 24) | (src->color & 0x00FFFFFFU);
+
+        if (m != NULL) {
+            DMA2D_blend_a8_start((uint32_t)(uintptr_t)m, opts->mask_pitch, dst, canvas->pitch, (uint16_t)r.w, (uint16_t)r.h, argb);
+        } else {
+            DMA2D_blend_color_start(dst, canvas->pitch, (uint16_t)r.w, (uint16_t)r.h, argb);
+        }
+    } else if (src->format == GFX_BLIT_L8 && m == NULL) {
+        const uint32_t *clut = src->clut;
+
+        if ((opts->flags & GFX_BLIT_KEY) != 0U) {
+            for (uint32_t i = 0; i < src->clut_size; i++) {
+                blit_clut[i] = (blit_pack(clut[i]) == opts->key) ? (clut[i] & 0x00FFFFFFU) : clut[i];
+            }
+            clut = blit_clut;
+        }
+        DMA2D_wait();                               // The running job may still read the CLUT
+        DMA2D_load_clut_format(clut, src->clut_size, DMA2D_CCM_ARGB8888);
+        blit_stats.clut_loads++;
+        DMA2D_blend_rect_start(s, src->pitch, DMA2D_INPUT_L8, opts->opacity, dst, canvas->pitch, (uint16_t)r.w, (uint16_t)r.h);
+    } else if (src->format == GFX_BLIT_RGB565 && opts->flags == 0U) {
+        if (opts->opacity == 255U) {
+            DMA2D_copy_rect_start(s, src->pitch, dst, canvas->pitch, (uint16_t)r.w, (uint16_t)r.h, DMA2D_INPUT_RGB565);
+        } else {
+            DMA2D_blend_rect_start(s, src->pitch, DMA2D_INPUT_RGB565, opts->opacity, dst, canvas->pitch, (uint16_t)r.w, (uint16_t)r.h);
+        }
+    } else {
+        blit_cpu(canvas, src, &r, s, bpp, m, opts);
+        return GFX_BLIT_OK;
+    }
+    blit_stats.dma2d_jobs++;
+    blit_stats.dma2d_pixels += pixels;
+    return GFX_BLIT_OK;
+}
+
+const gfx_blit_stats_t *gfx_blit_get_stats(void)
+{
+    return &blit_stats;
+}
+
+void gfx_blit_reset_stats(void)
+{
+    blit_stats = (gfx_blit_stats_t){ 0 };
+}
@@ -0,0 +1,95 @@
+/**
+ * @file gfx_blit.h
+ * @brief Composited blits: source colour key, external A8 clip mask and constant opacity, in any combination
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note Legacy assets mark transparent pixels with a key colour (usually
+ *       magenta), widgets with rounded or arbitrary outlines clip through an
+ *       A8 mask. gfx_blit() takes any mix of the two plus a constant opacity
+ *       and picks the cheapest way to draw it, the caller does not choose:
+ *
+ *         colour + mask (+ opacity)      DMA2D blend, A8 mask as foreground with FGCOLR
+ *         colour (+ opacity)             DMA2D register fill, or blend with a fixed colour
+ *         RGB565 (+ opacity)             DMA2D copy, or blend with a constant alpha
+ *         L8 (+ key, + opacity)          DMA2D blend through the CLUT, key entries get alpha 0
+ *         RGB565 + key                   CPU, two pixels per word (USUB16 / SEL on the M7)
+ *         everything else                CPU, one pass per pixel
+ *
+ *       DMA2D has no colour key and blends only one alpha source with one
+ *       image, RGB565 keys and image + mask combinations stay on the CPU.
+ *       DMA2D jobs are started and not waited for, like the DMA2D_xxx_start()
+ *       functions; the CPU path waits for DMA2D first, invalidates each
+ *       destination line before it reads it back and cleans it after. A mask the CPU just wrote must be cleaned by
+ *       the caller before a colour + mask blit (DMA2D reads it).
+ */
+
+#ifndef __GFX_BLIT_H__
+#define __GFX_BLIT_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gfx_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GFX_BLIT_KEY                    0x01U       // Skip source pixels of colour key (images only)
+#define GFX_BLIT_MASK                   0x02U       // Multiply by the A8 mask, nothing is drawn outside it
+
+typedef enum {
+    GFX_BLIT_RGB565 = 0,
+    GFX_BLIT_L8,                                    // ARGB8888 CLUT, its alpha is used
+    GFX_BLIT_COLOR,                                 // Solid ARGB8888 colour, no pixels
+} gfx_blit_format_t;
+
+typedef enum {
+    GFX_BLIT_OK = 0,
+    GFX_BLIT_ERR_PARAM,
+} gfx_blit_error_t;
+
+typedef struct {
+    uint32_t        addr;                           // Pixel (0, 0), unused for GFX_BLIT_COLOR
+    uint16_t        pitch;                          // Line length in pixels
+    uint16_t        width;
+    uint16_t        height;
+    uint8_t         format;                         // gfx_blit_format_t
+    uint8_t         reserved;
+    const uint32_t *clut;                           // L8: ARGB8888 entries
+    uint16_t        clut_size;                      // L8: 1..256
+    uint32_t        color;                          // GFX_BLIT_COLOR: ARGB8888
+} gfx_blit_src_t;
+
+typedef struct {
+    uint8_t         flags;                          // GFX_BLIT_KEY | GFX_BLIT_MASK
+    uint8_t         opacity;                        // 255: opaque
+    uint16_t        key;                            // RGB565; an L8 entry is keyed when it converts to it
+    uint32_t        mask;                           // A8, its pixel (0, 0) is at mask_area.x, mask_area.y of the canvas
+    uint16_t        mask_pitch;                     // Line length in bytes
+    gfx_rect_t      mask_area;                      // Canvas area covered by the mask
+} gfx_blit_opts_t;
+
+typedef struct {
+    uint32_t        blits;
+    uint32_t        dma2d_jobs;
+    uint32_t        dma2d_pixels;
+    uint32_t        cpu_pixels;
+    uint32_t        clut_loads;
+} gfx_blit_stats_t;
+
+/**
+ * @brief Draw src onto the canvas at (x, y), clipped to the canvas clip (and the mask area)
+ * @param opts NULL: opaque copy
+ */
+gfx_blit_error_t gfx_blit(const gfx_canvas_t *canvas, const gfx_blit_src_t *src, int16_t x, int16_t y,
+                          const gfx_blit_opts_t *opts);
+
+const gfx_blit_stats_t *gfx_blit_get_stats(void);
+void gfx_blit_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __GFX_BLIT_H__ */
@@ -0,0 +1,176 @@
+/**
+ * @file gfx_convert.c
+ * @brief Pixel format conversion to RGB565: exact DMA2D PFC or ordered (Bayer) dithering on the CPU
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#include <stddef.h>
+#include "main.h"
+#include "dma2d.h"
+#include "gfx_convert.h"
+
+static gfx_cvt_stats_t cvt_stats;
+
+/* 4x4 Bayer thresholds as byte offsets: 0..7 on red / blue, 0..3 on green */
+#define CVT_OFFSET(t)                   ((((uint32_t)(t) >> 1) << 16) | (((uint32_t)(t) >> 2) << 8) | ((uint32_t)(t) >> 1))
+
+static const uint32_t cvt_bayer[4][4] = {
+    { CVT_OFFSET(0),  CVT_OFFSET(8),  CVT_OFFSET(2),  CVT_OFFSET(10) },
+    { CVT_OFFSET(12), CVT_OFFSET(4),  CVT_OFFSET(14), CVT_OFFSET(6)  },
+    { CVT_OFFSET(3),  CVT_OFFSET(11), CVT_OFFSET(1),  CVT_OFFSET(9)  },
+    { CVT_OFFSET(15), CVT_OFFSET(7),  CVT_OFFSET(13), CVT_OFFSET(5)  },
+};
+
+/* Saturating add of four bytes */
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#define cvt_uqadd8(a, b)                __UQADD8((a), (b))
+#else
+static inline uint32_t cvt_uqadd8(uint32_t a, uint32_t b)
+{
+    uint32_t sum = ((a & 0x7F7F7F7FU) + (b & 0x7F7F7F7FU)) ^ ((a ^ b) & 0x80808080U);
+    uint32_t carry = ((a & b) | ((a | b) & ~sum)) & 0x80808080U;
+
+    return sum | ((carry >> 7) * 0xFFU);
+}
+#endif
+
+static inline uint32_t cvt_pack(uint32_t p)
+{
+    return ((p >> 8) & 0xF800U) | ((p >> 5) & 0x07E0U) | ((p >> 3) & 0x001FU);
+}
+
+static inline uint32_t cvt_rgb888(const uint8_t *s)
+{
+    return (uint32_t)s[0] | ((uint32_t)s[1] << 8) | ((uint32_t)s[2] << 16);
+}
+
+/*
+ * One line, o[] are the thresholds of the line starting at the first pixel.
+ * Four pixels per iteration, stored as two words once d is word aligned.
+ */
+static void cvt_row_argb8888(const uint32_t *s, uint16_t *d, int32_t n, const uint32_t *o)
+{
+    uint32_t o0 = o[0], o1 = o[1], o2 = o[2], o3 = o[3];
+
+    if (((uint32_t)(uintptr_t)d & 2U) != 0U && n > 0) {
+        *d++ = (uint16_t)cvt_pack(cvt_uqadd8(*s++, o0));
+        n--;
+        o0 = o1;
+        o1 = o2;
+        o2 = o3;
+        o3 = o[0];
+    }
+    for (; n >= 4; n -= 4) {
+        uint32_t *w = (uint32_t *)d;
+
+        w[0] = cvt_pack(cvt_uqadd8(s[0], o0)) | (cvt_pack(cvt_uqadd8(s[1], o1)) << 16);
+        w[1] = cvt_pack(cvt_uqadd8(s[2], o2)) | (cvt_pack(cvt_uqadd8(s[3], o3)) << 16);
+        s += 4;
+        d += 4;
+    }
+    for (uint32_t i = 0; i < (uint32_t)n; i++) {
+        d[i] = (uint16_t)cvt_pack(cvt_uqadd8(s[i], (i == 0U) ? o0 : ((i == 1U) ? o1 : o2)));
+    }
+}
+
+static void cvt_row_rgb888(const uint8_t *s, uint16_t *d, int32_t n, const uint32_t *o)
+{
+    uint32_t o0 = o[0], o1 = o[1], o2 = o[2], o3 = o[3];
+
+    if (((uint32_t)(uintptr_t)d & 2U) != 0U && n > 0) {
+        *d++ = (uint16_t)cvt_pack(cvt_uqadd8(cvt_rgb888(s), o0));
+        s += 3;
+        n--;
+        o0 = o1;
+        o1 = o2;
+        o2 = o3;
+        o3 = o[0];
+    }
+    for (; n >= 4; n -= 4) {
+        uint32_t *w = (uint32_t *)d;
+
+        w[0] = cvt_pack(cvt_uqadd8(cvt_rgb888(s), o0)) | (cvt_pack(cvt_uqadd8(cvt_rgb888(s + 3), o1)) << 16);
+        w[1] = cvt_pack(cvt_uqadd8(cvt_rgb888(s + 6), o2)) | (cvt_pack(cvt_uqadd8(cvt_rgb888(s + 9), o3)) << 16);
+        s += 12;
+        d += 4;
+    }
+    for (uint32_t i = 0; i < (uint32_t)n; i++) {
+        d[i] = (uint16_t)cvt_pack(cvt_uqadd8(cvt_rgb888(s + 3U * i), (i == 0U) ? o0 : ((i == 1U) ? o1 : o2)));
+    }
+}
+
+static void cvt_dither(const gfx_canvas_t *canvas, const gfx_cvt_src_t *src, const gfx_rect_t *r, int16_t x, int16_t y)
+{
+    uint32_t bpp = (src->format == GFX_CVT_ARGB8888) ? 4U : 3U;
+
+    for (int32_t j = r->y; j < r->y + r->h; j++) {
+        const uint32_t *row = cvt_bayer[j & 3];
+        uint32_t o[4] = { row[r->x & 3], row[(r->x + 1) & 3], row[(r->x + 2) & 3], row[(r->x + 3) & 3] };
+        uint32_t s = src->addr + ((uint32_t)(j - y) * src->pitch + (uint32_t)(r->x - x)) * bpp;
+        uint16_t *d = (uint16_t *)(canvas->buffer + ((uint32_t)j * canvas->pitch + (uint32_t)r->x) * 2U);
+
+        if (bpp == 4U) {
+            cvt_row_argb8888((const uint32_t *)s, d, r->w, o);
+        } else {
+            cvt_row_rgb888((const uint8_t *)s, d, r->w, o);
+        }
+        SCB_CleanDCache_by_Addr((uint32_t *)d, r->w * 2);
+    }
+    cvt_stats.dither_pixels += (uint32_t)r->w * (uint32_t)r->h;
+}
+
+gfx_cvt_error_t gfx_cvt_draw(const gfx_canvas_t *canvas, const gfx_cvt_src_t *src, int16_t x, int16_t y,
+                             gfx_cvt_mode_t mode)
+{
+    static const uint8_t bits[] = { 32, 24, 16, 16, 16, 8, 8, 16 };     // By gfx_cvt_format_t
+    gfx_rect_t area, r;
+    bool deep, dither;
+
+    if (canvas == NULL || src == NULL || src->addr == 0U || src->format > GFX_CVT_AL88 || mode > GFX_CVT_DITHER ||
+        src->pitch < src->width) {
+        return GFX_CVT_ERR_PARAM;
+    }
+    deep = (src->format == GFX_CVT_ARGB8888 || src->format == GFX_CVT_RGB888);
+    if ((mode == GFX_CVT_DITHER && !deep) ||
+        (src->format >= GFX_CVT_L8 && (src->clut == NULL || src->clut_size == 0U || src->clut_size > 256U))) {
+        return GFX_CVT_ERR_FORMAT;
+    }
+
+    area.x = x;
+    area.y = y;
+    area.w = (int16_t)src->width;
+    area.h = (int16_t)src->height;
+    if (!gfx_rect_intersect(&area, &canvas->clip, &r)) {
+        return GFX_CVT_OK;
+    }
+
+    dither = deep && mode != GFX_CVT_EXACT;
+    if (dither) {
+        cvt_dither(canvas, src, &r, x, y);
+        return GFX_CVT_OK;
+    }
+
+    if (src->format >= GFX_CVT_L8) {
+        DMA2D_load_clut_format(src->clut, src->clut_size, src->clut_rgb888 ? DMA2D_CCM_RGB888 : DMA2D_CCM_ARGB8888);
+        cvt_stats.clut_loads++;
+    }
+    DMA2D_convert_rect(src->addr + ((uint32_t)(r.y - y) * src->pitch + (uint32_t)(r.x - x)) * bits[src->format] / 8U,
+                       src->pitch, src->format,
+                       canvas->buffer + ((uint32_t)r.y * canvas->pitch + (uint32_t)r.x) * 2U, canvas->pitch,
+                       (uint16_t)r.w, (uint16_t)r.h);
+    cvt_stats.dma2d_jobs++;
+    cvt_stats.dma2d_pixels += (uint32_t)r.w * (uint32_t)r.h;
+    return GFX_CVT_OK;
+}
+
+const gfx_cvt_stats_t *gfx_cvt_get_stats(void)
+{
+    return &cvt_stats;
+}
+
+void gfx_cvt_reset_stats(void)
+{
+    cvt_stats = (gfx_cvt_stats_t){ 0 };
+}
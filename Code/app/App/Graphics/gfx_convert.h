@@ -0,0 +1,90 @@
+/**
+ * @file gfx_convert.h
+ * @brief Pixel format conversion to RGB565: exact DMA2D PFC or ordered (Bayer) dithering on the CPU
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note DMA2D PFC truncates 8 bit channels to 5 / 6 bits, which makes smooth
+ *       gradients band. Sources with 8 bits per channel (ARGB8888, RGB888)
+ *       are therefore dithered by the CPU with a 4x4 Bayer matrix anchored
+ *       to canvas coordinates (stable across PFB tiles and partial updates):
+ *       the threshold of a pixel is added to all channels at once with a
+ *       saturating byte add (UQADD8 on the Cortex-M7 DSP extension), then
+ *       the pixel is packed, two RGB565 pixels per store.
+ *
+ *       Formats RGB565 holds exactly (RGB565, ARGB1555, ARGB4444) and CLUT
+ *       formats are converted by DMA2D PFC. Every job programs its own input
+ *       format and loads its own CLUT, the hdma2d configuration of
+ *       MX_DMA2D_Init() is not used. Alpha is dropped: this converts, use
+ *       DMA2D_blend_rect() to blend.
+ */
+
+#ifndef __GFX_CONVERT_H__
+#define __GFX_CONVERT_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gfx_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Same values as DMA2D_INPUT_xxx */
+typedef enum {
+    GFX_CVT_ARGB8888 = 0,
+    GFX_CVT_RGB888,                                 // B, G, R bytes
+    GFX_CVT_RGB565,
+    GFX_CVT_ARGB1555,
+    GFX_CVT_ARGB4444,
+    GFX_CVT_L8,                                     // CLUT formats
+    GFX_CVT_AL44,
+    GFX_CVT_AL88,
+} gfx_cvt_format_t;
+
+typedef enum {
+    GFX_CVT_AUTO = 0,                               // Dither 8 bit per channel sources, DMA2D for the rest
+    GFX_CVT_EXACT,                                  // Always DMA2D PFC (truncates)
+    GFX_CVT_DITHER,                                 // CPU, ARGB8888 / RGB888 sources only
+} gfx_cvt_mode_t;
+
+typedef enum {
+    GFX_CVT_OK = 0,
+    GFX_CVT_ERR_PARAM,
+    GFX_CVT_ERR_FORMAT,                             // Dithering asked for a format it does not apply to, or no CLUT
+} gfx_cvt_error_t;
+
+typedef struct {
+    uint32_t        addr;                           // Pixel (0, 0), DMA2D readable for the PFC path
+    uint16_t        pitch;                          // Line length in pixels
+    uint16_t        width;
+    uint16_t        height;
+    uint8_t         format;                         // gfx_cvt_format_t
+    uint8_t         clut_rgb888;                    // CLUT entries are RGB888 instead of ARGB8888
+    const void     *clut;                           // CLUT formats, loaded by each job
+    uint16_t        clut_size;                      // Entries, 1..256
+} gfx_cvt_src_t;
+
+typedef struct {
+    uint32_t        dma2d_jobs;
+    uint32_t        dma2d_pixels;
+    uint32_t        dither_pixels;
+    uint32_t        clut_loads;
+} gfx_cvt_stats_t;
+
+/**
+ * @brief Convert an image to RGB565 onto the canvas at (x, y), clipped
+ * @note  A source updated by another bus master (video decoder) must be
+ *        invalidated in the D-cache by the caller before dithering.
+ */
+gfx_cvt_error_t gfx_cvt_draw(const gfx_canvas_t *canvas, const gfx_cvt_src_t *src, int16_t x, int16_t y,
+                             gfx_cvt_mode_t mode);
+
+const gfx_cvt_stats_t *gfx_cvt_get_stats(void);
+void gfx_cvt_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __GFX_CONVERT_H__ */
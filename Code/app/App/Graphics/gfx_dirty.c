@@ -0,0 +1,256 @@
+/**
+ * @file gfx_dirty.c
+ * @brief Dirty rectangle tracking with cost based region coalescing
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#include <stddef.h>
+#include "gfx_dirty.h"
+
+uint32_t gfx_dirty_cost(const gfx_rect_t *rect)
+{
+    if (gfx_rect_is_empty(rect)) {
+        return 0;
+    }
+
+    return GFX_DIRTY_SETUP_COST + (uint32_t)rect->h * GFX_DIRTY_LINE_COST + gfx_rect_area(rect);
+}
+
+static void dirty_remove(gfx_dirty_t *dirty, uint16_t index)
+{
+    dirty->count--;
+    if (index != dirty->count) {
+        dirty->rects[index] = dirty->rects[dirty->count];
+    }
+}
+
+/* Drop every rectangle (except keep) fully covered by rects[keep], returns new index of keep */
+static uint16_t dirty_drop_covered(gfx_dirty_t *dirty, uint16_t keep)
+{
+    uint16_t i = 0;
+
+    while (i < dirty->count) {
+        if (i != keep && gfx_rect_contains(&dirty->rects[keep], &dirty->rects[i])) {
+            dirty_remove(dirty, i);
+            if (keep == dirty->count) {
+                keep = i;       // keep was the last entry and got moved into the hole
+            }
+            continue;
+        }
+        i++;
+    }
+
+    return keep;
+}
+
+/*
+ * Shrink rect when another rectangle covers one of its edges across the full
+ * span, so the overlap is not drawn twice. Only trims that keep a single
+ * rectangle are done, anything else is left to the merge step.
+ */
+static void dirty_trim(const gfx_rect_t *cover, gfx_rect_t *rect)
+{
+    gfx_rect_t ov;
+
+    if (!gfx_rect_intersect(cover, rect, &ov)) {
+        return;
+    }
+
+    if (ov.x == rect->x && ov.w == rect->w) {
+        if (ov.y == rect->y) {
+            rect->y += ov.h;
+            rect->h -= ov.h;
+        } else if (ov.y + ov.h == rect->y + rect->h) {
+            rect->h -= ov.h;
+        }
+    } else if (ov.y == rect->y && ov.h == rect->h) {
+        if (ov.x == rect->x) {
+            rect->x += ov.w;
+            rect->w -= ov.w;
+        } else if (ov.x + ov.w == rect->x + rect->w) {
+            rect->w -= ov.w;
+        }
+    }
+}
+
+/* Merge rects[index] with its best partner while merging saves bandwidth */
+static void dirty_coalesce(gfx_dirty_t *dirty, uint16_t index)
+{
+    for (;;) {
+        int32_t best_saving = 0;
+        int32_t best = -1;
+        uint32_t cost_self = gfx_dirty_cost(&dirty->rects[index]);
+
+        for (uint16_t i = 0; i < dirty->count; i++) {
+            gfx_rect_t merged;
+            int32_t saving;
+
+            if (i == index) {
+                continue;
+            }
+            gfx_rect_union(&dirty->rects[index], &dirty->rects[i], &merged);
+            saving = (int32_t)(cost_self + gfx_dirty_cost(&dirty->rects[i])) - (int32_t)gfx_dirty_cost(&merged);
+            if (saving > best_saving) {
+                best_saving = saving;
+                best = i;
+            }
+        }
+
+        if (best < 0) {
+            return;
+        }
+
+        gfx_rect_union(&dirty->rects[index], &dirty->rects[best], &dirty->rects[index]);
+        dirty_remove(dirty, (uint16_t)best);
+        if (index == dirty->count) {
+            index = (uint16_t)best;
+        }
+        index = dirty_drop_covered(dirty, index);
+    }
+}
+
+/* List is full: fold rect into the entry whose bounding box grows the least */
+static uint16_t dirty_force_merge(gfx_dirty_t *dirty, const gfx_rect_t *rect)
+{
+    uint32_t best_delta = UINT32_MAX;
+    uint16_t best = 0;
+
+    for (uint16_t i = 0; i < dirty->count; i++) {
+        gfx_rect_t merged;
+        uint32_t delta;
+
+        gfx_rect_union(&dirty->rects[i], rect, &merged);
+        delta = gfx_dirty_cost(&merged) - gfx_dirty_cost(&dirty->rects[i]);
+        if (delta < best_delta) {
+            best_delta = delta;
+            best = i;
+        }
+    }
+
+    gfx_rect_union(&dirty->rects[best], rect, &dirty->rects[best]);
+    return best;
+}
+
+void gfx_dirty_init(gfx_dirty_t *dirty, const gfx_rect_t *bounds)
+{
+    if (dirty == NULL) {
+        return;
+    }
+
+    if (bounds != NULL) {
+        dirty->bounds = *bounds;
+    } else {
+        dirty->bounds.x = 0;
+        dirty->bounds.y = 0;
+        dirty->bounds.w = GFX_LCD_WIDTH;
+        dirty->bounds.h = GFX_LCD_HEIGHT;
+    }
+    dirty->count = 0;
+}
+
+uint16_t gfx_dirty_add(gfx_dirty_t *dirty, const gfx_rect_t *rect)
+{
+    gfx_rect_t clip;
+    uint16_t index;
+
+    if (dirty == NULL || rect == NULL) {
+        return 0;
+    }
+
+    if (!gfx_rect_intersect(&dirty->bounds, rect, &clip)) {
+        return dirty->count;
+    }
+
+    for (uint16_t i = 0; i < dirty->count; i++) {
+        if (gfx_rect_contains(&dirty->rects[i], &clip)) {
+            return dirty->count;
+        }
+        dirty_trim(&dirty->rects[i], &clip);
+        if (gfx_rect_is_empty(&clip)) {
+            return dirty->count;
+        }
+    }
+
+    if (dirty->count >= GFX_DIRTY_MAX_RECTS) {
+        index = dirty_force_merge(dirty, &clip);
+    } else {
+        index = dirty->count++;
+        dirty->rects[index] = clip;
+    }
+
+    index = dirty_drop_covered(dirty, index);
+    dirty_coalesce(dirty, index);
+
+    return dirty->count;
+}
+
+void gfx_dirty_invalidate_all(gfx_dirty_t *dirty)
+{
+    if (dirty == NULL) {
+        return;
+    }
+
+    dirty->rects[0] = dirty->bounds;
+    dirty->count = 1;
+}
+
+void gfx_dirty_clear(gfx_dirty_t *dirty)
+{
+    if (dirty != NULL) {
+        dirty->count = 0;
+    }
+}
+
+uint32_t gfx_dirty_total_cost(const gfx_dirty_t *dirty)
+{
+    uint32_t cost = 0;
+
+    for (uint16_t i = 0; i < dirty->count; i++) {
+        cost += gfx_dirty_cost(&dirty->rects[i]);
+    }
+
+    return cost;
+}
+
+uint32_t gfx_dirty_total_area(const gfx_dirty_t *dirty)
+{
+    uint32_t area = 0;
+
+    for (uint16_t i = 0; i < dirty->count; i++) {
+        area += gfx_rect_area(&dirty->rects[i]);
+    }
+
+    return area;
+}
+
+uint16_t gfx_dirty_flush(gfx_dirty_t *dirty, gfx_dirty_render_cb render, void *user)
+{
+    uint16_t rendered = 0;
+
+    if (dirty == NULL || render == NULL || dirty->count == 0) {
+        return 0;
+    }
+
+    /* Last chance: one job over the bounding box may still beat the list */
+    if (dirty->count > 1) {
+        gfx_rect_t bbox = dirty->rects[0];
+
+        for (uint16_t i = 1; i < dirty->count; i++) {
+            gfx_rect_union(&bbox, &dirty->rects[i], &bbox);
+        }
+        if (gfx_dirty_cost(&bbox) <= gfx_dirty_total_cost(dirty)) {
+            dirty->rects[0] = bbox;
+            dirty->count = 1;
+        }
+    }
+
+    for (uint16_t i = 0; i < dirty->count; i++) {
+        render(&dirty->rects[i], user);
+        rendered++;
+    }
+
+    dirty->count = 0;
+    return rendered;
+}
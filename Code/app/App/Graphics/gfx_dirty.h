@@ -0,0 +1,96 @@
+/**
+ * @file gfx_dirty.h
+ * @brief Dirty rectangle tracking with cost based region coalescing
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#ifndef __GFX_DIRTY_H__
+#define __GFX_DIRTY_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gfx_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GFX_DIRTY_MAX_RECTS             16          // Max rectangles kept per frame
+
+/*
+ * Bandwidth cost model, all values in "pixel equivalents" (one RGB565 pixel
+ * written through DMA2D). A job costs SETUP + h * LINE + w * h.
+ * SETUP covers register programming, start latency and the polling/IRQ round
+ * trip; LINE covers the burst restart DMA2D pays at the end of every line.
+ */
+#define GFX_DIRTY_SETUP_COST            600
+#define GFX_DIRTY_LINE_COST             8
+
+typedef struct {
+    gfx_rect_t  bounds;                             // Clip area, normally the whole screen
+    gfx_rect_t  rects[GFX_DIRTY_MAX_RECTS];
+    uint16_t    count;
+} gfx_dirty_t;
+
+typedef void (*gfx_dirty_render_cb)(const gfx_rect_t *rect, void *user);
+
+/**
+ * @brief Initialize a dirty list
+ * @param dirty dirty list instance
+ * @param bounds clip area, NULL for the whole LCD
+ */
+void gfx_dirty_init(gfx_dirty_t *dirty, const gfx_rect_t *bounds);
+
+/**
+ * @brief Mark an area as dirty
+ * @note The rectangle is clipped to bounds, then merged with the existing
+ *       list while merging lowers the total cost.
+ * @return number of rectangles in the list after the merge
+ */
+uint16_t gfx_dirty_add(gfx_dirty_t *dirty, const gfx_rect_t *rect);
+
+/**
+ * @brief Mark the whole bounds as dirty
+ */
+void gfx_dirty_invalidate_all(gfx_dirty_t *dirty);
+
+/**
+ * @brief Drop all dirty rectangles
+ */
+void gfx_dirty_clear(gfx_dirty_t *dirty);
+
+/**
+ * @brief Cost of redrawing one rectangle with a single DMA2D job
+ */
+uint32_t gfx_dirty_cost(const gfx_rect_t *rect);
+
+/**
+ * @brief Total cost of the current list
+ */
+uint32_t gfx_dirty_total_cost(const gfx_dirty_t *dirty);
+
+/**
+ * @brief Total dirty area in pixels (overlaps counted twice)
+ */
+uint32_t gfx_dirty_total_area(const gfx_dirty_t *dirty);
+
+/**
+ * @brief Render every dirty rectangle then clear the list
+ * @param dirty dirty list instance
+ * @param render called once per rectangle
+ * @param user passed through to render
+ * @return number of rectangles rendered
+ */
+uint16_t gfx_dirty_flush(gfx_dirty_t *dirty, gfx_dirty_render_cb render, void *user);
+
+static inline bool gfx_dirty_is_empty(const gfx_dirty_t *dirty) {
+    return (dirty == NULL) || (dirty->count == 0);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __GFX_DIRTY_H__ */
@@ -0,0 +1,419 @@
+/**
+ * @file gfx_effect.c
+ * @brief UI effects: separable box blur, drop shadows and anti-aliased rounded corners
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include "main.h"
+#include "dma2d.h"
+#include "gfx_math.h"
+#include "gfx_effect.h"
+
+#define FX_STRIP_MAX                    16          // Columns per vertical blur strip, 32 bytes of a GRAM line
+#define FX_TILE_MAX                     64          // Shadow tile side, FX_TILE_MAX^2 <= GFX_FX_MASK_SIZE
+
+typedef struct {
+    int32_t x0, y0, x1, y1;
+    int32_t r;                                      // Corner radius
+} fx_rrect_t;
+
+static union {
+    uint16_t    rgb565[GFX_FX_WORK_SIZE / 2];
+    uint8_t     a8[GFX_FX_WORK_SIZE];
+} fx_work;                                                                              // DTCM, CPU only
+__attribute__((section(".sram_noncache_bss"))) static uint8_t fx_mask[2][GFX_FX_MASK_SIZE];   // Read by DMA2D
+static gfx_fx_stats_t fx_stats;
+
+/* ------------------------------------------------------------ box filter --- */
+
+/* 65536 / (2r + 1), the sum of a constant run scales back to the same value */
+static inline uint32_t fx_inv(int32_t r)
+{
+    return (65536U + (uint32_t)r) / (2U * (uint32_t)r + 1U);
+}
+
+static inline int32_t fx_clamp(int32_t i, int32_t n)
+{
+    return (i < 0) ? 0 : ((i >= n) ? n - 1 : i);
+}
+
+/* One box pass over n pixels, running sums per channel, edges clamped */
+static void fx_box_565(const uint16_t *in, uint16_t *out, int32_t out_step, int32_t n, int32_t r)
+{
+    uint32_t inv = fx_inv(r);
+    uint32_t sr = 0, sg = 0, sb = 0;
+
+    for (int32_t k = -r - 1; k < r; k++) {
+        uint32_t p = in[fx_clamp(k, n)];
+
+        sr += p >> 11;
+        sg += (p >> 5) & 0x3FU;
+        sb += p & 0x1FU;
+    }
+    for (int32_t i = 0; i < n; i++) {
+        uint32_t a = in[(i + r < n) ? i + r : n - 1];
+        uint32_t d = in[(i - r - 1 > 0) ? i - r - 1 : 0];
+
+        sr += (a >> 11) - (d >> 11);
+        sg += ((a >> 5) & 0x3FU) - ((d >> 5) & 0x3FU);
+        sb += (a & 0x1FU) - (d & 0x1FU);
+        *out = (uint16_t)((((sr * inv + 32768U) >> 16) << 11) | (((sg * inv + 32768U) >> 16) << 5) |
+                          ((sb * inv + 32768U) >> 16));
+        out += out_step;
+    }
+}
+
+static void fx_box_a8(const uint8_t *in, uint8_t *out, int32_t out_step, int32_t n, int32_t r)
+{
+    uint32_t inv = fx_inv(r);
+    uint32_t s = 0;
+
+    for (int32_t k = -r - 1; k < r; k++) {
+        s += in[fx_clamp(k, n)];
+    }
+    for (int32_t i = 0; i < n; i++) {
+        s += (uint32_t)in[(i + r < n) ? i + r : n - 1] - in[(i - r - 1 > 0) ? i - r - 1 : 0];
+        *out = (uint8_t)((s * inv + 32768U) >> 16);
+        out += out_step;
+    }
+}
+
+/* All passes over one line or column, in place through the two temporaries */
+static void fx_passes_565(uint16_t *line, int32_t step, int32_t n, int32_t r, uint32_t passes, uint16_t *a, uint16_t *b)
+{
+    for (int32_t i = 0; i < n; i++) {
+        a[i] = line[i * step];
+    }
+    for (uint32_t p = 1; p < passes; p++) {
+        uint16_t *t = a;
+
+        fx_box_565(a, b, 1, n, r);
+        a = b;
+        b = t;
+    }
+    fx_box_565(a, line, step, n, r);
+}
+
+static void fx_passes_a8(uint8_t *line, int32_t step, int32_t n, int32_t r, uint32_t passes, uint8_t *a, uint8_t *b)
+{
+    for (int32_t i = 0; i < n; i++) {
+        a[i] = line[i * step];
+    }
+    for (uint32_t p = 1; p < passes; p++) {
+        uint8_t *t = a;
+
+        fx_box_a8(a, b, 1, n, r);
+        a = b;
+        b = t;
+    }
+    fx_box_a8(a, line, step, n, r);
+}
+
+/* ------------------------------------------------------------------- blur --- */
+
+gfx_fx_error_t gfx_fx_blur(const gfx_canvas_t *canvas, const gfx_rect_t *area, uint16_t radius, uint8_t passes)
+{
+    gfx_rect_t r;
+    uint16_t *a, *b, *strip;
+    int32_t w, h, strip_w;
+
+    if (canvas == NULL || area == NULL || radius == 0U || passes == 0U || passes > GFX_FX_MAX_PASSES) {
+        return GFX_FX_ERR_PARAM;
+    }
+    if (!gfx_rect_intersect(area, &canvas->clip, &r)) {
+        return GFX_FX_OK;
+    }
+    w = r.w;
+    h = r.h;
+    strip_w = (int32_t)(GFX_FX_WORK_SIZE / 2U) / h - 2;
+    strip_w = (strip_w > FX_STRIP_MAX) ? FX_STRIP_MAX : strip_w;
+    if (strip_w < 1 || 2 * w > (int32_t)(GFX_FX_WORK_SIZE / 2U)) {
+        return GFX_FX_ERR_BUDGET;
+    }
+    DMA2D_wait();
+
+    /* Horizontal: one line at a time, DMA2D may have drawn it behind the D-cache */
+    a = fx_work.rgb565;
+    b = a + w;
+    for (int32_t y = r.y; y < r.y + h; y++) {
+        uint16_t *line = (uint16_t *)(canvas->buffer + ((uint32_t)y * canvas->pitch + (uint32_t)r.x) * 2U);
+
+        SCB_CleanInvalidateDCache_by_Addr((uint32_t *)line, w * 2);
+        fx_passes_565(line, 1, w, radius, passes, a, b);
+    }
+
+    /* Vertical: a strip of columns is gathered line by line, blurred column by column */
+    strip = fx_work.rgb565;
+    a = strip + strip_w * h;
+    b = a + h;
+    for (int32_t x = r.x; x < r.x + w; x += strip_w) {
+        int32_t n = (r.x + w - x < strip_w) ? r.x + w - x : strip_w;
+
+        for (int32_t y = 0; y < h; y++) {
+            const uint16_t *src = (const uint16_t *)(canvas->buffer + ((uint32_t)(r.y + y) * canvas->pitch + (uint32_t)x) * 2U);
+
+            for (int32_t c = 0; c < n; c++) {
+                strip[c * h + y] = src[c];
+            }
+        }
+        for (int32_t c = 0; c < n; c++) {
+            fx_passes_565(&strip[c * h], 1, h, radius, passes, a, b);
+        }
+        for (int32_t y = 0; y < h; y++) {
+            uint16_t *dst = (uint16_t *)(canvas->buffer + ((uint32_t)(r.y + y) * canvas->pitch + (uint32_t)x) * 2U);
+
+            for (int32_t c = 0; c < n; c++) {
+                dst[c] = strip[c * h + y];
+            }
+        }
+    }
+    for (int32_t y = r.y; y < r.y + h; y++) {
+        SCB_CleanDCache_by_Addr((uint32_t *)(canvas->buffer + ((uint32_t)y * canvas->pitch + (uint32_t)r.x) * 2U), w * 2);
+    }
+    fx_stats.blur_pixels += (uint32_t)(w * h);
+
+    return GFX_FX_OK;
+}
+
+/* -------------------------------------------------------- rounded shapes --- */
+
+/* A8 coverage of n pixels of line y of a rounded rectangle, sampled at pixel centres */
+static void fx_rrect_row(const fx_rrect_t *s, int32_t y, int32_t x, int32_t n, uint8_t *out)
+{
+    float fy = (float)y + 0.5f;
+    float dy = 0.0f;
+
+    if (y < s->y0 || y >= s->y1) {
+        memset(out, 0, (size_t)n);
+        return;
+    }
+    if (fy < (float)(s->y0 + s->r)) {
+        dy = (float)(s->y0 + s->r) - fy;
+    } else if (fy > (float)(s->y1 - s->r)) {
+        dy = fy - (float)(s->y1 - s->r);
+    }
+
+    for (int32_t i = 0; i < n; i++) {
+        int32_t px = x + i;
+
+        if (px < s->x0 || px >= s->x1) {
+            out[i] = 0;
+        } else if (dy > 0.0f && (px < s->x0 + s->r || px >= s->x1 - s->r)) {
+            float fx = (float)px + 0.5f;
+            float dx = (px < s->x0 + s->r) ? (float)(s->x0 + s->r) - fx : fx - (float)(s->x1 - s->r);
+            float c = gfx_clampf((float)s->r - gfx_sqrtf(dx * dx + dy * dy) + 0.5f, 0.0f, 1.0f);
+
+            out[i] = (uint8_t)(c * 255.0f + 0.5f);
+        } else {
+            out[i] = 255;
+        }
+    }
+}
+
+/* The whole blur support of the tile is inside one of the two bands of the shape */
+static bool fx_rrect_covers(const fx_rrect_t *s, int32_t x0, int32_t y0, int32_t x1, int32_t y1)
+{
+    return (x0 >= s->x0 && x1 <= s->x1 && y0 >= s->y0 + s->r && y1 <= s->y1 - s->r) ||
+           (x0 >= s->x0 + s->r && x1 <= s->x1 - s->r && y0 >= s->y0 && y1 <= s->y1);
+}
+
+gfx_fx_error_t gfx_fx_shadow(const gfx_canvas_t *canvas, const gfx_rect_t *rect, uint16_t corner, uint16_t blur,
+                             uint32_t argb)
+{
+    fx_rrect_t s;
+    gfx_rect_t box, area;
+    int32_t radius, halo, tile;
+    uint32_t buf = 0;
+
+    if (canvas == NULL || rect == NULL || gfx_rect_is_empty(rect)) {
+        return GFX_FX_ERR_PARAM;
+    }
+    if ((argb >> 24) == 0U) {
+        return GFX_FX_OK;
+    }
+    s.x0 = rect->x;
+    s.y0 = rect->y;
+    s.x1 = rect->x + rect->w;
+    s.y1 = rect->y + rect->h;
+    s.r = (corner * 2 > rect->w) ? rect->w / 2 : corner;
+    s.r = (s.r * 2 > rect->h) ? rect->h / 2 : s.r;
+
+    radius = (blur + GFX_FX_SHADOW_PASSES - 1) / GFX_FX_SHADOW_PASSES;
+    halo = radius * GFX_FX_SHADOW_PASSES;
+    box.x = (int16_t)(rect->x - halo);
+    box.y = (int16_t)(rect->y - halo);
+    box.w = (int16_t)(rect->w + 2 * halo);
+    box.h = (int16_t)(rect->h + 2 * halo);
+    if (!gfx_rect_intersect(&box, &canvas->clip, &area)) {
+        return GFX_FX_OK;
+    }
+
+    /* Largest square tile whose blur input (tile + halo) and two line temporaries fit the work buffer */
+    tile = FX_TILE_MAX;
+    while (tile >= 8 && (tile + 2 * halo) * (tile + 2 * halo + 2) > GFX_FX_WORK_SIZE) {
+        tile -= 8;
+    }
+    if (tile < 8) {
+        return GFX_FX_ERR_BUDGET;
+    }
+
+    for (int32_t ty = area.y; ty < area.y + area.h; ty += tile) {
+        int32_t th = (area.y + area.h - ty < tile) ? area.y + area.h - ty : tile;
+
+        for (int32_t tx = area.x; tx < area.x + area.w; tx += tile) {
+            int32_t tw = (area.x + area.w - tx < tile) ? area.x + area.w - tx : tile;
+            uint8_t *mask = fx_mask[buf];
+
+            /* The other mask may still be blending, this one finished before it was started */
+            if (radius == 0) {
+                for (int32_t j = 0; j < th; j++) {
+                    fx_rrect_row(&s, ty + j, tx, tw, &mask[j * tw]);
+                }
+            } else if (fx_rrect_covers(&s, tx - halo, ty - halo, tx + tw + halo, ty + th + halo)) {
+                memset(mask, 255, (size_t)(tw * th));
+            } else {
+                int32_t ww = tw + 2 * halo, wh = th + 2 * halo;
+                uint8_t *work = fx_work.a8;
+                uint8_t *a = work + ww * wh;
+                uint8_t *b = a + ((ww > wh) ? ww : wh);
+
+                for (int32_t j = 0; j < wh; j++) {
+                    fx_rrect_row(&s, ty - halo + j, tx - halo, ww, &work[j * ww]);
+                    if (ty - halo + j >= s.y0 && ty - halo + j < s.y1) {
+                        fx_passes_a8(&work[j * ww], 1, ww, radius, GFX_FX_SHADOW_PASSES, a, b);
+                    }
+                }
+                for (int32_t c = 0; c < tw; c++) {
+                    fx_passes_a8(&work[halo + c], ww, wh, radius, GFX_FX_SHADOW_PASSES, a, b);
+                    for (int32_t j = 0; j < th; j++) {
+                        mask[j * tw + c] = work[(halo + j) * ww + halo + c];
+                    }
+                }
+                fx_stats.shadow_tiles++;
+            }
+            DMA2D_blend_a8_start((uint32_t)mask, (uint16_t)tw,
+                                 canvas->buffer + ((uint32_t)ty * canvas->pitch + (uint32_t)tx) * 2U,
+                                 canvas->pitch, (uint16_t)tw, (uint16_t)th, argb);
+            fx_stats.jobs++;
+            fx_stats.shadow_pixels += (uint32_t)(tw * th);
+            buf ^= 1U;
+        }
+    }
+    DMA2D_wait();
+
+    return GFX_FX_OK;
+}
+
+/* ---------------------------------------------------------------- corners --- */
+
+gfx_fx_error_t gfx_fx_corner_make(gfx_fx_corner_t *corner, uint8_t *buf, uint16_t radius, bool outside)
+{
+    fx_rrect_t s = { 0, 0, 2 * radius, 2 * radius, radius };
+    uint32_t size = 2U * radius;
+
+    if (corner == NULL || buf == NULL || radius == 0U) {
+        return GFX_FX_ERR_PARAM;
+    }
+    for (uint32_t y = 0; y < size; y++) {
+        fx_rrect_row(&s, (int32_t)y, 0, (int32_t)size, &buf[y * size]);
+        if (outside) {
+            for (uint32_t x = 0; x < size; x++) {
+                buf[y * size + x] = (uint8_t)(255U - buf[y * size + x]);
+            }
+        }
+    }
+    SCB_CleanDCache_by_Addr((uint32_t *)buf, (int32_t)GFX_FX_CORNER_SIZE(radius));
+
+    corner->mask = (uint32_t)buf;
+    corner->radius = radius;
+    corner->outside = outside;
+    return GFX_FX_OK;
+}
+
+static void fx_fill(const gfx_canvas_t *canvas, int32_t x, int32_t y, int32_t w, int32_t h, uint32_t argb)
+{
+    gfx_rect_t a = { (int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h }, r;
+
+    if (gfx_rect_intersect(&a, &canvas->clip, &r)) {
+        DMA2D_blend_color_start(canvas->buffer + ((uint32_t)r.y * canvas->pitch + (uint32_t)r.x) * 2U, canvas->pitch,
+                                (uint16_t)r.w, (uint16_t)r.h, argb);
+        fx_stats.jobs++;
+    }
+}
+
+/* Quadrant (qx, qy) of the corner mask with its top left corner at (x, y), clipped */
+static void fx_quadrant(const gfx_canvas_t *canvas, const gfx_fx_corner_t *corner, uint32_t qx, uint32_t qy,
+                        int32_t x, int32_t y, uint32_t argb)
+{
+    uint32_t size = 2U * corner->radius;
+    gfx_rect_t a = { (int16_t)x, (int16_t)y, (int16_t)corner->radius, (int16_t)corner->radius }, r;
+
+    if (gfx_rect_intersect(&a, &canvas->clip, &r)) {
+        uint32_t mx = qx * corner->radius + (uint32_t)(r.x - x);
+        uint32_t my = qy * corner->radius + (uint32_t)(r.y - y);
+
+        DMA2D_blend_a8_start(corner->mask + my * size + mx, (uint16_t)size,
+                             canvas->buffer + ((uint32_t)r.y * canvas->pitch + (uint32_t)r.x) * 2U, canvas->pitch,
+                             (uint16_t)r.w, (uint16_t)r.h, argb);
+        fx_stats.jobs++;
+    }
+}
+
+static void fx_corners(const gfx_canvas_t *canvas, const gfx_rect_t *rect, const gfx_fx_corner_t *corner, uint32_t argb)
+{
+    int32_t r = corner->radius;
+
+    fx_quadrant(canvas, corner, 0, 0, rect->x, rect->y, argb);
+    fx_quadrant(canvas, corner, 1, 0, rect->x + rect->w - r, rect->y, argb);
+    fx_quadrant(canvas, corner, 0, 1, rect->x, rect->y + rect->h - r, argb);
+    fx_quadrant(canvas, corner, 1, 1, rect->x + rect->w - r, rect->y + rect->h - r, argb);
+}
+
+gfx_fx_error_t gfx_fx_round_rect(const gfx_canvas_t *canvas, const gfx_rect_t *rect, const gfx_fx_corner_t *corner,
+                                 uint32_t argb)
+{
+    int32_t r;
+
+    if (canvas == NULL || rect == NULL || corner == NULL || corner->outside ||
+        2 * corner->radius > rect->w || 2 * corner->radius > rect->h) {
+        return GFX_FX_ERR_PARAM;
+    }
+    if ((argb >> 24) == 0U) {
+        return GFX_FX_OK;
+    }
+    r = corner->radius;
+    fx_corners(canvas, rect, corner, argb);
+    fx_fill(canvas, rect->x + r, rect->y, rect->w - 2 * r, r, argb);
+    fx_fill(canvas, rect->x, rect->y + r, rect->w, rect->h - 2 * r, argb);
+    fx_fill(canvas, rect->x + r, rect->y + rect->h - r, rect->w - 2 * r, r, argb);
+    DMA2D_wait();
+
+    return GFX_FX_OK;
+}
+
+gfx_fx_error_t gfx_fx_round_corners(const gfx_canvas_t *canvas, const gfx_rect_t *rect, const gfx_fx_corner_t *corner,
+                                    uint32_t argb)
+{
+    if (canvas == NULL || rect == NULL || corner == NULL || !corner->outside ||
+        2 * corner->radius > rect->w || 2 * corner->radius > rect->h) {
+        return GFX_FX_ERR_PARAM;
+    }
+    fx_corners(canvas, rect, corner, argb);
+    DMA2D_wait();
+
+    return GFX_FX_OK;
+}
+
+const gfx_fx_stats_t *gfx_fx_get_stats(void)
+{
+    return &fx_stats;
+}
+
+void gfx_fx_reset_stats(void)
+{
+    fx_stats = (gfx_fx_stats_t){ 0 };
+}
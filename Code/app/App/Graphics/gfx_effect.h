@@ -0,0 +1,111 @@
+/**
+ * @file gfx_effect.h
+ * @brief UI effects: separable box blur, drop shadows and anti-aliased rounded corners
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note Blur: horizontal then vertical box passes with running sums, so the
+ *       cost per pixel does not depend on the radius. Two or three passes
+ *       approximate a gaussian. The blur works in place on the canvas (a PFB
+ *       tile or the frame buffer) through GFX_FX_WORK_SIZE bytes of DTCM:
+ *       single lines for the horizontal passes, strips of columns for the
+ *       vertical ones (each strip line is one cache line of GRAM). Pixels
+ *       outside the blurred area are not read, edges are clamped.
+ *
+ *       Shadow: the A8 coverage of a rounded rectangle is blurred in tiles
+ *       that fit the work buffer with their halo, and DMA2D blends each
+ *       tile with the shadow colour while the next one is computed. Tiles
+ *       inside the shape are not blurred.
+ *
+ *       Corners: an A8 quarter circle mask per corner radius is computed
+ *       once (gfx_fx_corner_make()) and DMA2D blends its quadrants to draw
+ *       rounded panels or to cut the corners of an image.
+ */
+
+#ifndef __GFX_EFFECT_H__
+#define __GFX_EFFECT_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gfx_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GFX_FX_WORK_SIZE                16384       // DTCM bytes for blur lines / strips and shadow tiles
+#define GFX_FX_MASK_SIZE                4096        // A8 bytes per shadow tile, two tiles in RAM_NOCACHE
+#define GFX_FX_MAX_PASSES               3
+#define GFX_FX_SHADOW_PASSES            2
+
+// Bytes of a corner mask, see gfx_fx_corner_make()
+#define GFX_FX_CORNER_SIZE(radius)      (4U * (uint32_t)(radius) * (uint32_t)(radius))
+
+typedef enum {
+    GFX_FX_OK = 0,
+    GFX_FX_ERR_PARAM,
+    GFX_FX_ERR_BUDGET,                              // Area or blur radius too large for GFX_FX_WORK_SIZE
+} gfx_fx_error_t;
+
+typedef struct {
+    uint32_t    mask;                               // A8, 2 radius x 2 radius, one quadrant per corner
+    uint16_t    radius;
+    bool        outside;                            // Coverage outside the arc, to cut image corners
+} gfx_fx_corner_t;
+
+typedef struct {
+    uint32_t    blur_pixels;
+    uint32_t    shadow_pixels;                      // Mask pixels blended
+    uint32_t    shadow_tiles;                       // Tiles that were blurred
+    uint32_t    jobs;                               // DMA2D jobs
+} gfx_fx_stats_t;
+
+/**
+ * @brief Blur an area of the canvas in place (frosted glass)
+ * @param area   clipped to the canvas
+ * @param radius box radius, each pass averages 2 * radius + 1 pixels
+ * @param passes 1 (box) to GFX_FX_MAX_PASSES (close to gaussian)
+ * @note  DMA2D must not be writing to the area.
+ */
+gfx_fx_error_t gfx_fx_blur(const gfx_canvas_t *canvas, const gfx_rect_t *area, uint16_t radius, uint8_t passes);
+
+/**
+ * @brief Soft shadow of a rounded rectangle
+ * @param rect   the shape casting the shadow, offset already applied
+ * @param corner corner radius of the shape
+ * @param blur   shadow extent outside the shape, pixels
+ * @param argb   shadow colour and opacity
+ */
+gfx_fx_error_t gfx_fx_shadow(const gfx_canvas_t *canvas, const gfx_rect_t *rect, uint16_t corner, uint16_t blur,
+                             uint32_t argb);
+
+/**
+ * @brief Compute the mask of a corner radius
+ * @param buf GFX_FX_CORNER_SIZE(radius) bytes DMA2D can read (AXI / AHB SRAM, not DTCM)
+ * @param outside false: coverage of the quarter circle (rounded panels),
+ *                true: coverage outside it (cutting image corners)
+ */
+gfx_fx_error_t gfx_fx_corner_make(gfx_fx_corner_t *corner, uint8_t *buf, uint16_t radius, bool outside);
+
+/**
+ * @brief Fill a rounded rectangle, corners through the mask, the rest by DMA2D fills
+ * @param corner inside mask, radius at most half the rectangle size
+ */
+gfx_fx_error_t gfx_fx_round_rect(const gfx_canvas_t *canvas, const gfx_rect_t *rect, const gfx_fx_corner_t *corner,
+                                 uint32_t argb);
+
+/**
+ * @brief Round the corners of what is drawn in rect by blending the background colour outside the arcs
+ * @param corner outside mask
+ */
+gfx_fx_error_t gfx_fx_round_corners(const gfx_canvas_t *canvas, const gfx_rect_t *rect, const gfx_fx_corner_t *corner,
+                                    uint32_t argb);
+
+const gfx_fx_stats_t *gfx_fx_get_stats(void);
+void gfx_fx_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __GFX_EFFECT_H__ */
@@ -0,0 +1,604 @@
+/**
+ * @file gfx_font.c
+ * @brief Bitmap fonts in RO_DATA, LRU glyph atlas in AXI SRAM and batched DMA2D text blending
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include "main.h"
+#include "dma2d.h"
+#include "gfx_font.h"
+
+#define FONT_NIL                        0xFFFFU
+#define FONT_MIN_SLOT_SHIFT             5           // Smallest slot 32 bytes
+#define FONT_CLASSES                    8           // 32 .. 4096 bytes
+#define FONT_PAGES                      (GFX_FONT_ATLAS_SIZE / GFX_FONT_PAGE_SIZE)
+
+/*
+ * Atlas allocator: every page serves one slot size (power of two, so A4 and
+ * A8 glyphs of any font share it without fragmentation). Each size class
+ * keeps its own free list, threaded through the free slots, and its own LRU
+ * list. A miss takes a free slot, then a fresh page, then evicts the least
+ * recently used glyph of the same class.
+ */
+typedef struct {
+    const gfx_font_t   *font;
+    const gfx_glyph_t  *glyph;
+    uint8_t            *data;
+    uint16_t            hash_next;                  // Also links the free entry list
+    uint16_t            lru_prev;                   // Towards most recently used
+    uint16_t            lru_next;
+    uint8_t             cls;
+} font_entry_t;
+
+typedef struct {
+    uint16_t    mru;
+    uint16_t    lru;
+    void       *free_slots;
+} font_class_t;
+
+typedef struct {
+    const gfx_glyph_t  *glyph;
+    int16_t             x;                          // Bitmap left edge on the canvas
+} font_placed_t;
+
+__attribute__((section(".sram_bss"), aligned(32))) static uint8_t font_atlas[GFX_FONT_ATLAS_SIZE];
+__attribute__((section(".sram_noncache_bss"))) static uint8_t font_strip[2][GFX_FONT_STRIP_SIZE];   // Read by DMA2D
+
+static font_entry_t font_entries[GFX_FONT_CACHE_ENTRIES];
+static uint16_t     font_hash[GFX_FONT_HASH_SIZE];
+static uint16_t     font_entry_free;
+static font_class_t font_class[FONT_CLASSES];
+static uint16_t     font_pages_used;
+static bool         font_ready = false;
+static font_placed_t font_placed[GFX_FONT_MAX_GLYPHS];
+static gfx_font_stats_t font_stats;
+
+/* ---------------------------------------------------------------- lookup --- */
+
+/* Set bits, Cortex-M7 has no popcount instruction (GCC would call __popcountsi2) */
+static inline uint32_t font_popcount(uint32_t v)
+{
+    v = v - ((v >> 1) & 0x55555555U);
+    v = (v & 0x33333333U) + ((v >> 2) & 0x33333333U);
+    return (uint32_t)(((v + (v >> 4)) & 0x0F0F0F0FU) * 0x01010101U) >> 24;
+}
+
+gfx_font_error_t gfx_font_open(gfx_font_t *font, uint32_t store)
+{
+    const gfx_font_store_t *st = (const gfx_font_store_t *)store;
+    const uint8_t *base = (const uint8_t *)store;
+
+    if (font == NULL || st == NULL) {
+        return GFX_FONT_ERR_PARAM;
+    }
+    if (st->magic != GFX_FONT_STORE_MAGIC || st->version != GFX_FONT_STORE_VERSION ||
+        st->header_size < sizeof(gfx_font_store_t) || (st->bpp != 4U && st->bpp != 8U) ||
+        st->glyph_count > 0xFFFFU || st->kern_count > 0xFFFFU) {
+        return GFX_FONT_ERR_FORMAT;
+    }
+
+    font->glyphs = (const gfx_glyph_t *)(base + st->glyph_offset);
+    font->bitmaps = base + st->bitmap_offset;
+    font->kerns = st->kern_count ? (const gfx_kern_t *)(base + st->kern_offset) : NULL;
+    font->glyph_count = (uint16_t)st->glyph_count;
+    font->kern_count = (uint16_t)st->kern_count;
+    font->bpp = st->bpp;
+    font->line_height = st->line_height;
+    font->baseline = st->baseline;
+    font->reserved = 0;
+    font->fallback = st->fallback;
+    font->index_l1 = (const uint16_t *)(base + st->l1_offset);
+    font->index_pages = (const gfx_font_page_t *)(base + st->page_offset);
+
+    return GFX_FONT_OK;
+}
+
+const gfx_glyph_t *gfx_font_find(const gfx_font_t *font, uint32_t codepoint)
+{
+    uint32_t lo = 0, hi = font->glyph_count;
+
+    if (font->index_l1 != NULL) {
+        const gfx_font_page_t *page;
+        uint32_t word, bit, bits;
+
+        if (codepoint > 0xFFFFU || font->index_l1[codepoint >> 8] == GFX_FONT_NO_PAGE) {
+            return NULL;
+        }
+        page = &font->index_pages[font->index_l1[codepoint >> 8]];
+        word = (codepoint >> 5) & 7U;
+        bit = codepoint & 31U;
+        bits = page->bits[word];
+        if (!((bits >> bit) & 1U)) {
+            return NULL;
+        }
+        return &font->glyphs[page->base + page->rank[word] + font_popcount(bits & ((1U << bit) - 1U))];
+    }
+
+    while (lo < hi) {
+        uint32_t mid = (lo + hi) / 2U;
+        uint32_t cp = font->glyphs[mid].codepoint;
+
+        if (cp == codepoint) {
+            return &font->glyphs[mid];
+        }
+        if (cp < codepoint) {
+            lo = mid + 1U;
+        } else {
+            hi = mid;
+        }
+    }
+
+    return NULL;
+}
+
+int32_t gfx_font_kerning(const gfx_font_t *font, uint32_t left, uint32_t right)
+{
+    uint32_t pair = (left << 16) | (right & 0xFFFFU);
+    uint32_t lo = 0, hi = font->kern_count;
+
+    if (font->kerns == NULL || left > 0xFFFFU || right > 0xFFFFU) {
+        return 0;
+    }
+    while (lo < hi) {
+        uint32_t mid = (lo + hi) / 2U;
+
+        if (font->kerns[mid].pair == pair) {
+            return font->kerns[mid].adjust;
+        }
+        if (font->kerns[mid].pair < pair) {
+            lo = mid + 1U;
+        } else {
+            hi = mid;
+        }
+    }
+
+    return 0;
+}
+
+/* Decode one UTF-8 sequence, invalid input consumes one byte */
+static bool font_utf8_next(const char **text, uint32_t *codepoint)
+{
+    const uint8_t *p = (const uint8_t *)*text;
+    uint32_t cp, len, min;
+
+    if (p[0] < 0x80U) {
+        *codepoint = p[0];
+        *text += 1;
+        return true;
+    }
+    if ((p[0] & 0xE0U) == 0xC0U) {
+        cp = p[0] & 0x1FU; len = 2; min = 0x80U;
+    } else if ((p[0] & 0xF0U) == 0xE0U) {
+        cp = p[0] & 0x0FU; len = 3; min = 0x800U;
+    } else if ((p[0] & 0xF8U) == 0xF0U) {
+        cp = p[0] & 0x07U; len = 4; min = 0x10000U;
+    } else {
+        *text += 1;
+        return false;
+    }
+    for (uint32_t i = 1; i < len; i++) {
+        if ((p[i] & 0xC0U) != 0x80U) {
+            *text += i;                             // Stops at the terminator too
+            return false;
+        }
+        cp = (cp << 6) | (p[i] & 0x3FU);
+    }
+    *text += len;
+    if (cp < min || cp > 0x10FFFFU) {
+        return false;
+    }
+    *codepoint = cp;
+    return true;
+}
+
+/* Glyph for the next character, NULL when neither it nor the fallback exist */
+static const gfx_glyph_t *font_next_glyph(const gfx_font_t *font, const char **text, uint32_t *codepoint, bool *bad)
+{
+    const gfx_glyph_t *g = NULL;
+
+    if (font_utf8_next(text, codepoint)) {
+        g = gfx_font_find(font, *codepoint);
+    } else {
+        *bad = true;
+    }
+    if (g == NULL) {
+        *codepoint = font->fallback;
+        g = gfx_font_find(font, font->fallback);
+    }
+
+    return g;
+}
+
+uint32_t gfx_font_text_width(const gfx_font_t *font, const char *text)
+{
+    int32_t pen = 0;
+    uint32_t prev = 0, cp = 0;
+    bool bad = false;
+
+    if (font == NULL || text == NULL) {
+        return 0;
+    }
+    while (*text) {
+        const gfx_glyph_t *g = font_next_glyph(font, &text, &cp, &bad);
+
+        if (g == NULL) {
+            continue;
+        }
+        if (prev) {
+            pen += gfx_font_kerning(font, prev, cp);
+        }
+        pen += g->advance;
+        prev = cp;
+    }
+
+    return (pen > 0) ? (uint32_t)(pen + (1 << (GFX_FONT_Q - 1))) >> GFX_FONT_Q : 0;
+}
+
+/* ----------------------------------------------------------------- atlas --- */
+
+static uint32_t font_glyph_bytes(const gfx_font_t *font, const gfx_glyph_t *g)
+{
+    return (font->bpp == 4U) ? ((uint32_t)(g->width + 1U) / 2U) * g->height : (uint32_t)g->width * g->height;
+}
+
+static uint32_t font_hash_of(const gfx_font_t *font, uint32_t codepoint)
+{
+    return ((((uint32_t)(uintptr_t)font >> 4) ^ (codepoint * 2654435761UL)) >> 8) & (GFX_FONT_HASH_SIZE - 1U);
+}
+
+static void font_cache_init(void)
+{
+    for (uint32_t i = 0; i < GFX_FONT_HASH_SIZE; i++) {
+        font_hash[i] = FONT_NIL;
+    }
+    for (uint32_t i = 0; i < GFX_FONT_CACHE_ENTRIES; i++) {
+        font_entries[i].hash_next = (i + 1U < GFX_FONT_CACHE_ENTRIES) ? (uint16_t)(i + 1U) : FONT_NIL;
+    }
+    font_entry_free = 0;
+    for (uint32_t i = 0; i < FONT_CLASSES; i++) {
+        font_class[i].mru = font_class[i].lru = FONT_NIL;
+        font_class[i].free_slots = NULL;
+    }
+    font_pages_used = 0;
+    font_ready = true;
+}
+
+void gfx_font_cache_flush(void)
+{
+    font_cache_init();
+}
+
+static void font_lru_unlink(font_entry_t *e)
+{
+    font_class_t *c = &font_class[e->cls];
+
+    if (e->lru_prev != FONT_NIL) {
+        font_entries[e->lru_prev].lru_next = e->lru_next;
+    } else {
+        c->mru = e->lru_next;
+    }
+    if (e->lru_next != FONT_NIL) {
+        font_entries[e->lru_next].lru_prev = e->lru_prev;
+    } else {
+        c->lru = e->lru_prev;
+    }
+}
+
+static void font_lru_push(uint16_t index)
+{
+    font_entry_t *e = &font_entries[index];
+    font_class_t *c = &font_class[e->cls];
+
+    e->lru_prev = FONT_NIL;
+    e->lru_next = c->mru;
+    if (c->mru != FONT_NIL) {
+        font_entries[c->mru].lru_prev = index;
+    } else {
+        c->lru = index;
+    }
+    c->mru = index;
+}
+
+/* Free the least recently used glyph of a class, its slot goes back to the class */
+static bool font_evict(uint32_t cls)
+{
+    uint16_t index = font_class[cls].lru;
+    font_entry_t *e;
+    uint16_t *link;
+
+    if (index == FONT_NIL) {
+        return false;
+    }
+    e = &font_entries[index];
+    font_lru_unlink(e);
+
+    link = &font_hash[font_hash_of(e->font, e->glyph->codepoint)];
+    while (*link != index) {
+        link = &font_entries[*link].hash_next;
+    }
+    *link = e->hash_next;
+
+    *(void **)e->data = font_class[cls].free_slots;
+    font_class[cls].free_slots = e->data;
+    e->hash_next = font_entry_free;
+    font_entry_free = index;
+    font_stats.evictions++;
+
+    return true;
+}
+
+static uint8_t *font_slot_alloc(uint32_t cls)
+{
+    font_class_t *c = &font_class[cls];
+    uint8_t *slot;
+
+    if (c->free_slots == NULL && font_pages_used < FONT_PAGES) {
+        uint32_t size = 1UL << (cls + FONT_MIN_SLOT_SHIFT);
+        uint8_t *page = &font_atlas[(uint32_t)font_pages_used++ * GFX_FONT_PAGE_SIZE];
+
+        for (uint32_t off = GFX_FONT_PAGE_SIZE; off >= size; off -= size) {
+            *(void **)&page[off - size] = c->free_slots;
+            c->free_slots = &page[off - size];
+        }
+    }
+    if (c->free_slots == NULL && !font_evict(cls)) {
+        return NULL;
+    }
+    slot = c->free_slots;
+    c->free_slots = *(void **)slot;
+
+    return slot;
+}
+
+/*
+ * PackBits: n < 128 copies n + 1 literal bytes, n > 128 repeats the next
+ * byte 257 - n times, 128 is a no-op. Output is bounded by bytes.
+ */
+static void font_unpack(const uint8_t *src, uint32_t size, uint8_t *dst, uint32_t bytes)
+{
+    const uint8_t *end = src + size;
+    uint8_t *out_end = dst + bytes;
+
+    while (src < end && dst < out_end) {
+        uint32_t n = *src++;
+
+        if (n < 128U) {
+            n = (n + 1U > (uint32_t)(out_end - dst)) ? (uint32_t)(out_end - dst) : n + 1U;
+            memcpy(dst, src, n);
+            src += n;
+            dst += n;
+        } else if (n > 128U) {
+            n = (257U - n > (uint32_t)(out_end - dst)) ? (uint32_t)(out_end - dst) : 257U - n;
+            memset(dst, *src++, n);
+            dst += n;
+        }
+    }
+    if (dst < out_end) {
+        memset(dst, 0, (size_t)(out_end - dst));    // Truncated data, keep the rest transparent
+    }
+}
+
+/* Bring a glyph bitmap from flash into RAM, unpacking it if needed */
+static void font_load(const gfx_font_t *font, const gfx_glyph_t *g, uint8_t *dst, uint32_t bytes)
+{
+    const uint8_t *src = &font->bitmaps[g->offset];
+
+    if (g->size) {
+        font_unpack(src, g->size, dst, bytes);
+        font_stats.flash_bytes += g->size;
+        font_stats.decoded_bytes += bytes;
+    } else {
+        memcpy(dst, src, bytes);
+        font_stats.flash_bytes += bytes;
+    }
+}
+
+/* Glyph too large for a slot or no slot available: raw ones are read in place */
+static const uint8_t *font_uncached(const gfx_font_t *font, const gfx_glyph_t *g, uint32_t bytes)
+{
+    static uint8_t scratch[GFX_FONT_PAGE_SIZE];
+
+    font_stats.uncached++;
+    if (g->size == 0) {
+        font_stats.flash_bytes += bytes;
+        return &font->bitmaps[g->offset];
+    }
+    if (bytes > sizeof(scratch)) {
+        return NULL;                                // Compressed and larger than a page, not drawn
+    }
+    font_load(font, g, scratch, bytes);
+    return scratch;
+}
+
+/* Bitmap of a glyph, from the atlas when possible */
+static const uint8_t *font_cache_get(const gfx_font_t *font, const gfx_glyph_t *g)
+{
+    uint32_t h = font_hash_of(font, g->codepoint);
+    uint32_t bytes = font_glyph_bytes(font, g);
+    uint32_t cls = 0;
+    uint16_t index;
+    font_entry_t *e;
+    uint8_t *slot;
+
+    for (index = font_hash[h]; index != FONT_NIL; index = font_entries[index].hash_next) {
+        e = &font_entries[index];
+        if (e->font == font && e->glyph->codepoint == g->codepoint) {
+            font_lru_unlink(e);
+            font_lru_push(index);
+            font_stats.hits++;
+            return e->data;
+        }
+    }
+
+    while ((1UL << (cls + FONT_MIN_SLOT_SHIFT)) < bytes) {
+        cls++;
+    }
+    if (cls >= FONT_CLASSES) {
+        return font_uncached(font, g, bytes);
+    }
+
+    /* An entry first (evicting a same size glyph when none is free), then the slot */
+    if (font_entry_free == FONT_NIL && !font_evict(cls)) {
+        for (uint32_t i = 0; i < FONT_CLASSES && font_entry_free == FONT_NIL; i++) {
+            font_evict(i);
+        }
+    }
+    slot = font_slot_alloc(cls);
+    if (slot == NULL || font_entry_free == FONT_NIL) {
+        if (slot != NULL) {
+            *(void **)slot = font_class[cls].free_slots;
+            font_class[cls].free_slots = slot;
+        }
+        return font_uncached(font, g, bytes);
+    }
+
+    index = font_entry_free;
+    e = &font_entries[index];
+    font_entry_free = e->hash_next;
+    e->font = font;
+    e->glyph = g;
+    e->data = slot;
+    e->cls = (uint8_t)cls;
+    e->hash_next = font_hash[h];
+    font_hash[h] = index;
+    font_lru_push(index);
+
+    font_load(font, g, slot, bytes);                // The only read of this glyph from flash
+    font_stats.misses++;
+
+    return slot;
+}
+
+/* --------------------------------------------------------------- drawing --- */
+
+/* Add the visible part of a glyph to the strip, coverage saturates where glyphs overlap */
+static void font_compose(const gfx_font_t *font, const gfx_glyph_t *g, const uint8_t *bitmap,
+                         int32_t gx, int32_t gy, uint8_t *strip, int32_t sx, int32_t sy, int32_t sw, int32_t sh)
+{
+    int32_t x0 = (gx > sx) ? gx : sx;
+    int32_t x1 = (gx + g->width < sx + sw) ? gx + g->width : sx + sw;
+    int32_t y0 = (gy > sy) ? gy : sy;
+    int32_t y1 = (gy + g->height < sy + sh) ? gy + g->height : sy + sh;
+    uint32_t pitch = (font->bpp == 4U) ? (g->width + 1U) / 2U : g->width;
+
+    for (int32_t y = y0; y < y1; y++) {
+        const uint8_t *src = &bitmap[(uint32_t)(y - gy) * pitch];
+        uint8_t *dst = &strip[(y - sy) * sw + (x0 - sx)];
+
+        for (int32_t x = x0; x < x1; x++) {
+            uint32_t c, i = (uint32_t)(x - gx);
+
+            if (font->bpp == 4U) {
+                c = (uint32_t)((i & 1U) ? (src[i / 2U] >> 4) : (src[i / 2U] & 0x0FU)) * 17U;
+            } else {
+                c = src[i];
+            }
+            c += *dst;
+            *dst++ = (uint8_t)((c > 255U) ? 255U : c);
+        }
+    }
+}
+
+gfx_font_error_t gfx_font_draw(const gfx_canvas_t *canvas, const gfx_font_t *font, int16_t x, int16_t y,
+                               const char *text, uint32_t argb)
+{
+    int32_t row0, row1, rows, strip_cols;
+    int32_t pen = (int32_t)x << GFX_FONT_Q;
+    uint32_t prev = 0, cp = 0;
+    uint8_t buf = 0;
+    bool bad = false;
+
+    if (canvas == NULL || font == NULL || text == NULL || (font->bpp != 4U && font->bpp != 8U)) {
+        return GFX_FONT_ERR_PARAM;
+    }
+    if (!font_ready) {
+        font_cache_init();
+    }
+
+    row0 = (y > canvas->clip.y) ? y : canvas->clip.y;
+    row1 = (y + font->line_height < canvas->clip.y + canvas->clip.h) ? y + font->line_height
+                                                                     : canvas->clip.y + canvas->clip.h;
+    rows = row1 - row0;
+    if (rows <= 0 || (argb >> 24) == 0) {
+        return GFX_FONT_OK;
+    }
+    strip_cols = GFX_FONT_STRIP_SIZE / rows;
+
+    while (*text) {
+        int32_t bx0 = INT16_MAX, bx1 = INT16_MIN;
+        uint32_t n = 0;
+
+        /* Layout a batch */
+        while (*text && n < GFX_FONT_MAX_GLYPHS) {
+            const gfx_glyph_t *g = font_next_glyph(font, &text, &cp, &bad);
+
+            if (g == NULL) {
+                continue;
+            }
+            if (prev) {
+                pen += gfx_font_kerning(font, prev, cp);
+            }
+            prev = cp;
+            font_placed[n].glyph = g;
+            font_placed[n].x = (int16_t)(((pen + (1 << (GFX_FONT_Q - 1))) >> GFX_FONT_Q) + g->left);
+            pen += g->advance;
+            font_stats.glyphs++;
+            if (g->width && g->height) {
+                bx0 = (font_placed[n].x < bx0) ? font_placed[n].x : bx0;
+                bx1 = (font_placed[n].x + g->width > bx1) ? font_placed[n].x + g->width : bx1;
+                n++;
+            }
+        }
+        bx0 = (bx0 > canvas->clip.x) ? bx0 : canvas->clip.x;
+        bx1 = (bx1 < canvas->clip.x + canvas->clip.w) ? bx1 : canvas->clip.x + canvas->clip.w;
+
+        /* Compose strip by strip, DMA2D blends one strip while the next is composed */
+        for (int32_t sx = bx0; sx < bx1; sx += strip_cols) {
+            int32_t sw = (bx1 - sx < strip_cols) ? bx1 - sx : strip_cols;
+            uint8_t *strip = font_strip[buf];
+            bool any = false;
+
+            memset(strip, 0, (size_t)(sw * rows));
+            for (uint32_t i = 0; i < n; i++) {
+                const font_placed_t *p = &font_placed[i];
+                int32_t gy = y + p->glyph->top;
+                const uint8_t *bitmap;
+
+                if (p->x >= sx + sw || p->x + p->glyph->width <= sx ||
+                    gy >= row1 || gy + p->glyph->height <= row0) {
+                    continue;
+                }
+                bitmap = font_cache_get(font, p->glyph);
+                if (bitmap != NULL) {
+                    font_compose(font, p->glyph, bitmap, p->x, gy, strip, sx, row0, sw, rows);
+                    any = true;
+                }
+            }
+            if (any) {
+                DMA2D_blend_a8_start((uint32_t)strip, (uint16_t)sw,
+                                     canvas->buffer + ((uint32_t)row0 * canvas->pitch + (uint32_t)sx) * 2U,
+                                     canvas->pitch, (uint16_t)sw, (uint16_t)rows, argb);
+                font_stats.jobs++;
+                font_stats.blend_pixels += (uint32_t)(sw * rows);
+                buf ^= 1U;
+            }
+        }
+    }
+    DMA2D_wait();
+
+    return bad ? GFX_FONT_ERR_UTF8 : GFX_FONT_OK;
+}
+
+const gfx_font_stats_t *gfx_font_get_stats(void)
+{
+    return &font_stats;
+}
+
+void gfx_font_reset_stats(void)
+{
+    font_stats = (gfx_font_stats_t){ 0 };
+}
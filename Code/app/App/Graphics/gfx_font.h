@@ -0,0 +1,178 @@
+/**
+ * @file gfx_font.h
+ * @brief Bitmap fonts in RO_DATA, LRU glyph atlas in AXI SRAM and batched DMA2D text blending
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note Fonts are pre-rasterised on the host by Tools/fontgen/fontgen.py into
+ *       A4 or A8 bitmaps placed in .ro_data (external flash). A glyph is read
+ *       from flash once, on the first use after it fell out of the atlas.
+ *       Text is drawn one line at a time: glyphs are composed from the atlas
+ *       into an A8 strip (RAM_NOCACHE) and DMA2D blends the strip with the
+ *       text colour, one job per strip instead of one per glyph. Two strips
+ *       are used, the CPU composes the next while DMA2D blends the current.
+ *
+ *       Large fonts (CJK, thousands of glyphs per size) are packed into a
+ *       store (gfx_font_store_t) with a two-level codepoint index and
+ *       PackBits compressed glyphs, opened in place with gfx_font_open().
+ */
+
+#ifndef __GFX_FONT_H__
+#define __GFX_FONT_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gfx_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef GFX_FONT_ATLAS_SIZE
+#define GFX_FONT_ATLAS_SIZE             (64 * 1024) // Glyph atlas in AXI SRAM (.sram_bss)
+#endif
+#define GFX_FONT_PAGE_SIZE              4096        // Atlas pages are handed to one slot size each
+#ifndef GFX_FONT_CACHE_ENTRIES
+#define GFX_FONT_CACHE_ENTRIES          512         // Glyphs held by the atlas at most
+#endif
+#define GFX_FONT_HASH_SIZE              256         // Power of two
+#define GFX_FONT_STRIP_SIZE             8192        // A8 bytes per strip, two strips in RAM_NOCACHE
+#define GFX_FONT_MAX_GLYPHS             128         // Glyphs laid out per batch, longer strings take several
+
+/* Fixed point positions: advances and kerning in 1/16 pixel */
+#define GFX_FONT_Q                      4
+
+typedef struct {
+    uint32_t    codepoint;
+    uint32_t    offset;                             // Bitmap offset in gfx_font_t.bitmaps
+    uint16_t    advance;                            // Pen advance, 1/16 pixel
+    uint8_t     width;                              // Bitmap size, A4 rows are padded to whole bytes
+    uint8_t     height;
+    int8_t      left;                               // Bitmap position relative to the pen
+    int8_t      top;                                // Bitmap position relative to the line top
+    uint16_t    size;                               // Stored bytes when PackBits compressed, 0: raw bitmap
+} gfx_glyph_t;
+
+typedef struct {
+    uint32_t    pair;                               // (left codepoint << 16) | right codepoint
+    int16_t     adjust;                             // Added to the advance of left, 1/16 pixel
+    uint16_t    reserved;
+} gfx_kern_t;
+
+typedef struct {
+    const gfx_glyph_t  *glyphs;                     // Sorted by codepoint
+    const uint8_t      *bitmaps;
+    const gfx_kern_t   *kerns;                      // Sorted by pair, may be NULL
+    uint16_t            glyph_count;
+    uint16_t            kern_count;
+    uint8_t             bpp;                        // 4 (A4, first pixel in the low nibble) or 8 (A8)
+    uint8_t             line_height;
+    uint8_t             baseline;                   // Baseline distance from the line top
+    uint8_t             reserved;
+    uint32_t            fallback;                   // Drawn for codepoints missing in the font
+    const uint16_t     *index_l1;                   // Two-level index of a store, NULL: binary search
+    const struct gfx_font_page *index_pages;
+} gfx_font_t;
+
+/*
+ * Font store, one blob per size in RO_DATA, written by fontgen.py --store.
+ * Offsets are from the start of the store, every table is 4 byte aligned.
+ *
+ * Codepoint index (BMP only): index_l1[cp >> 8] is the page of the 256
+ * codepoint block, 0xFFFF when the block is empty. A page holds a presence
+ * bitmap and the rank of each word, so the glyph index is
+ *     base + rank[w] + popcount(bits[w] below cp)
+ * Two table reads and no search, 44 bytes per block used.
+ */
+#define GFX_FONT_STORE_MAGIC            0x544E4647UL    // "GFNT"
+#define GFX_FONT_STORE_VERSION          1
+#define GFX_FONT_NO_PAGE                0xFFFFU
+
+typedef struct gfx_font_page {
+    uint32_t    bits[8];                            // Codepoints present in the block
+    uint32_t    base;                               // Glyph index of the first one
+    uint8_t     rank[8];                            // Present codepoints in the words before
+} gfx_font_page_t;
+
+typedef struct {
+    uint32_t    magic;
+    uint16_t    version;
+    uint16_t    header_size;
+    uint32_t    size;                               // Whole store in bytes
+    uint32_t    glyph_count;
+    uint8_t     bpp;
+    uint8_t     line_height;
+    uint8_t     baseline;
+    uint8_t     reserved;
+    uint32_t    fallback;
+    uint32_t    l1_offset;                          // uint16_t[256]
+    uint32_t    page_offset;                        // gfx_font_page_t[]
+    uint32_t    glyph_offset;                       // gfx_glyph_t[glyph_count], codepoint order
+    uint32_t    bitmap_offset;
+    uint32_t    kern_offset;                        // gfx_kern_t[kern_count]
+    uint32_t    kern_count;
+} gfx_font_store_t;
+
+typedef enum {
+    GFX_FONT_OK = 0,
+    GFX_FONT_ERR_PARAM,
+    GFX_FONT_ERR_UTF8,                              // Invalid sequence, drawn as the fallback glyph
+    GFX_FONT_ERR_FORMAT,                            // Not a font store or unsupported version
+} gfx_font_error_t;
+
+typedef struct {
+    uint32_t    hits;
+    uint32_t    misses;                             // Glyphs read from flash into the atlas
+    uint32_t    evictions;
+    uint32_t    uncached;                           // Composed straight from flash (no slot available)
+    uint32_t    flash_bytes;                        // Bitmap bytes read from flash
+    uint32_t    decoded_bytes;                      // Bytes unpacked from compressed glyphs
+    uint32_t    glyphs;                             // Glyphs drawn
+    uint32_t    jobs;                               // DMA2D strip blends
+    uint32_t    blend_pixels;
+} gfx_font_stats_t;
+
+/**
+ * @brief Use a font store in place
+ * @param font filled in, only points into the store
+ * @param store address of the store, usually in RO_DATA
+ */
+gfx_font_error_t gfx_font_open(gfx_font_t *font, uint32_t store);
+
+/**
+ * @brief Find a glyph, NULL if the font does not have it
+ */
+const gfx_glyph_t *gfx_font_find(const gfx_font_t *font, uint32_t codepoint);
+
+/**
+ * @brief Kerning between two codepoints, 1/16 pixel
+ */
+int32_t gfx_font_kerning(const gfx_font_t *font, uint32_t left, uint32_t right);
+
+/**
+ * @brief Width of a UTF-8 string in pixels, including kerning
+ */
+uint32_t gfx_font_text_width(const gfx_font_t *font, const char *text);
+
+/**
+ * @brief Draw a single line of UTF-8 text
+ * @param x, y top left corner of the line box, the baseline is at y + font->baseline
+ * @param argb text colour, alpha scales the glyph coverage
+ * @note  '\n' is not interpreted. Returns after the last blend has finished.
+ */
+gfx_font_error_t gfx_font_draw(const gfx_canvas_t *canvas, const gfx_font_t *font, int16_t x, int16_t y,
+                               const char *text, uint32_t argb);
+
+/**
+ * @brief Drop every glyph from the atlas, e.g. after the font data was reflashed
+ */
+void gfx_font_cache_flush(void);
+
+const gfx_font_stats_t *gfx_font_get_stats(void);
+void gfx_font_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __GFX_FONT_H__ */
@@ -0,0 +1,400 @@
+/**
+ * @file gfx_gradient.c
+ * @brief Linear and radial gradient fills from line templates replicated by DMA2D
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note Linear index: twice the 16.16 index is kept in 64 bits, so the
+ *       incremental lines give exactly the per pixel result. Radial
+ *       distances are doubled (pixel centres at odd coordinates) to stay
+ *       integer.
+ */
+
+#include <stddef.h>
+#include "main.h"
+#include "dma2d.h"
+#include "gfx_gradient.h"
+
+#define GRAD_CHUNK_W                    (GFX_GRAD_LINE_MAX / 2)     // Widest line of the two line buffers, pixels
+#define GRAD_HALF_BYTES                 (GFX_GRAD_LINE_MAX * 2)     // One line buffer
+
+__attribute__((section(".sram_noncache_bss"), aligned(32))) static uint32_t grad_line[GFX_GRAD_LINE_MAX];   // Read by DMA2D
+static gfx_grad_stats_t grad_stats;
+
+static uint32_t grad_addr(const gfx_canvas_t *canvas, int32_t x, int32_t y)
+{
+    return canvas->buffer + ((uint32_t)y * canvas->pitch + (uint32_t)x) * 2U;
+}
+
+static void *grad_half(uint32_t b)
+{
+    return (uint8_t *)grad_line + b * GRAD_HALF_BYTES;
+}
+
+static int32_t grad_clamp(int64_t t2)
+{
+    int64_t k = t2 >> 17;                           // Doubled 16.16 to integer index
+
+    return (k < 0) ? 0 : ((k > GFX_GRAD_LUT_SIZE - 1) ? GFX_GRAD_LUT_SIZE - 1 : (int32_t)k);
+}
+
+/* Doubled 16.16 linear index at the centre of pixel (x, y) */
+static int64_t grad_linear_t2(const gfx_grad_t *g, int32_t x, int32_t y)
+{
+    return (int64_t)(2 * (x - g->x0) + 1) * g->step_x + (int64_t)(2 * (y - g->y0) + 1) * g->step_y;
+}
+
+/* Largest k with bound[k] <= d */
+static int32_t grad_radial_index(const gfx_grad_t *g, uint32_t d)
+{
+    int32_t lo = 0, hi = GFX_GRAD_LUT_SIZE - 1;
+
+    while (lo < hi) {
+        int32_t mid = (lo + hi + 1) / 2;
+
+        if (g->bound[mid] <= d) {
+            lo = mid;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    return lo;
+}
+
+static void grad_lut(gfx_grad_t *g, const gfx_grad_stop_t *stops, uint8_t count)
+{
+    uint32_t s = 0;
+
+    g->opaque = true;
+    for (uint32_t i = 0; i < count; i++) {
+        g->opaque &= (stops[i].argb >> 24) == 0xFFU;
+    }
+    for (uint32_t k = 0; k < GFX_GRAD_LUT_SIZE; k++) {
+        uint32_t c;
+
+        while (s + 1U < count && stops[s + 1U].pos <= k) {
+            s++;
+        }
+        if (k <= stops[0].pos || s + 1U >= count) {
+            c = (k <= stops[0].pos) ? stops[0].argb : stops[count - 1U].argb;
+        } else {
+            uint32_t c0 = stops[s].argb, c1 = stops[s + 1U].argb;
+            uint32_t span = stops[s + 1U].pos - stops[s].pos;
+            uint32_t f = k - stops[s].pos;
+
+            c = 0;
+            for (uint32_t sh = 0; sh < 32U; sh += 8U) {
+                int32_t a = (int32_t)((c0 >> sh) & 0xFFU), b = (int32_t)((c1 >> sh) & 0xFFU);
+
+                c |= (uint32_t)(a + ((b - a) * (int32_t)f + (int32_t)span / 2) / (int32_t)span) << sh;
+            }
+        }
+        g->lut[k] = c;
+        g->lut565[k] = GFX_RGB565((c >> 16) & 0xFFU, (c >> 8) & 0xFFU, c & 0xFFU);
+    }
+}
+
+static bool grad_stops_valid(const gfx_grad_stop_t *stops, uint8_t count)
+{
+    if (stops == NULL || count == 0 || count > GFX_GRAD_STOPS_MAX) {
+        return false;
+    }
+    for (uint32_t i = 1; i < count; i++) {
+        if (stops[i].pos < stops[i - 1U].pos) {
+            return false;
+        }
+    }
+    return true;
+}
+
+gfx_grad_error_t gfx_grad_linear(gfx_grad_t *grad, int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                                 const gfx_grad_stop_t *stops, uint8_t count)
+{
+    int64_t vx = x1 - x0, vy = y1 - y0;
+    int64_t len2 = vx * vx + vy * vy;
+
+    if (grad == NULL || len2 == 0 || !grad_stops_valid(stops, count)) {
+        return GFX_GRAD_ERR_PARAM;
+    }
+    grad->type = GFX_GRAD_LINEAR;
+    grad->x0 = x0;
+    grad->y0 = y0;
+    grad->step_x = (int32_t)(vx * (GFX_GRAD_LUT_SIZE - 1) * 65536 / len2);
+    grad->step_y = (int32_t)(vy * (GFX_GRAD_LUT_SIZE - 1) * 65536 / len2);
+    grad_lut(grad, stops, count);
+
+    return GFX_GRAD_OK;
+}
+
+gfx_grad_error_t gfx_grad_radial(gfx_grad_t *grad, int16_t cx, int16_t cy, uint16_t radius,
+                                 const gfx_grad_stop_t *stops, uint8_t count)
+{
+    const uint64_t n2 = (uint64_t)(GFX_GRAD_LUT_SIZE - 1) * (GFX_GRAD_LUT_SIZE - 1);
+
+    if (grad == NULL || radius == 0 || radius > GFX_GRAD_RADIUS_MAX || !grad_stops_valid(stops, count)) {
+        return GFX_GRAD_ERR_PARAM;
+    }
+    grad->type = GFX_GRAD_RADIAL;
+    grad->x0 = cx;
+    grad->y0 = cy;
+    grad->step_x = grad->step_y = 0;
+    /* Index k from doubled distance 2 * k * radius / 255 on, squared and rounded up */
+    for (uint32_t k = 0; k < GFX_GRAD_LUT_SIZE; k++) {
+        uint64_t d = 2ULL * k * radius;
+
+        grad->bound[k] = (uint32_t)((d * d + n2 - 1U) / n2);
+    }
+    grad_lut(grad, stops, count);
+
+    return GFX_GRAD_OK;
+}
+
+uint32_t gfx_grad_color(const gfx_grad_t *grad, int16_t x, int16_t y)
+{
+    if (grad->type == GFX_GRAD_RADIAL) {
+        int32_t dx = 2 * (x - grad->x0) + 1, dy = 2 * (y - grad->y0) + 1;
+
+        return grad->lut[grad_radial_index(grad, (uint32_t)(dx * dx + dy * dy))];
+    }
+    return grad->lut[grad_clamp(grad_linear_t2(grad, x, y))];
+}
+
+/* Lines of one colour */
+static void grad_run(const gfx_canvas_t *canvas, const gfx_rect_t *r, int32_t y, int32_t h, uint32_t argb)
+{
+    DMA2D_blend_color_start(grad_addr(canvas, r->x, y), canvas->pitch, (uint16_t)r->w, (uint16_t)h, argb);
+    grad_stats.jobs++;
+}
+
+/* One line (or n identical lines) of the line buffer b to the canvas */
+static void grad_put(const gfx_canvas_t *canvas, const gfx_grad_t *g, const void *src, uint16_t src_pitch,
+                     const gfx_rect_t *r, int32_t y, int32_t n)
+{
+    if (g->opaque) {
+        DMA2D_copy_rect_start((uint32_t)src, src_pitch, grad_addr(canvas, r->x, y), canvas->pitch,
+                              (uint16_t)r->w, (uint16_t)n, DMA2D_INPUT_RGB565);
+    } else {
+        DMA2D_blend_rect_start((uint32_t)src, src_pitch, DMA2D_INPUT_ARGB8888, 255, grad_addr(canvas, r->x, y),
+                               canvas->pitch, (uint16_t)r->w, (uint16_t)n);
+    }
+    grad_stats.jobs++;
+}
+
+static void grad_linear_line(const gfx_grad_t *g, int64_t t2, int32_t n, void *out)
+{
+    int64_t step2 = 2 * (int64_t)g->step_x;
+
+    if (g->opaque) {
+        uint16_t *p = (uint16_t *)out;
+
+        for (int32_t i = 0; i < n; i++, t2 += step2) {
+            p[i] = g->lut565[grad_clamp(t2)];
+        }
+    } else {
+        uint32_t *p = (uint32_t *)out;
+
+        for (int32_t i = 0; i < n; i++, t2 += step2) {
+            p[i] = g->lut[grad_clamp(t2)];
+        }
+    }
+    grad_stats.lines++;
+    grad_stats.cpu_pixels += (uint32_t)n;
+}
+
+/* step_x == 0: every line is one colour, runs of equal colours are one fill each */
+static void grad_vertical(const gfx_canvas_t *canvas, const gfx_rect_t *r, const gfx_grad_t *g)
+{
+    int64_t t2 = grad_linear_t2(g, r->x, r->y);
+    int32_t start = r->y, k0 = grad_clamp(t2);
+
+    for (int32_t y = r->y + 1; y <= r->y + r->h; y++) {
+        int32_t k;
+
+        t2 += 2 * (int64_t)g->step_y;
+        k = (y < r->y + r->h) ? grad_clamp(t2) : -1;
+        if (k >= 0 && (g->opaque ? g->lut565[k] == g->lut565[k0] : g->lut[k] == g->lut[k0])) {
+            continue;
+        }
+        grad_run(canvas, r, start, y - start, g->lut[k0]);
+        start = y;
+        k0 = k;
+    }
+    grad_stats.lines++;
+}
+
+/* step_y == 0: one template line, then copies of the lines done so far */
+static void grad_horizontal(const gfx_canvas_t *canvas, const gfx_rect_t *r, const gfx_grad_t *g)
+{
+    grad_linear_line(g, grad_linear_t2(g, r->x, r->y), r->w, grad_line);
+
+    if (g->opaque) {
+        grad_put(canvas, g, grad_line, (uint16_t)r->w, r, r->y, 1);
+        for (int32_t done = 1; done < r->h;) {
+            int32_t n = (done < r->h - done) ? done : r->h - done;
+
+            DMA2D_copy_rect_start(grad_addr(canvas, r->x, r->y), canvas->pitch, grad_addr(canvas, r->x, r->y + done),
+                                  canvas->pitch, (uint16_t)r->w, (uint16_t)n, DMA2D_INPUT_RGB565);
+            grad_stats.jobs++;
+            done += n;
+        }
+    } else {
+        /* Blending cannot reuse the canvas: repeat the template in the buffer, blend that many lines per job */
+        int32_t rep = GFX_GRAD_LINE_MAX / r->w;
+
+        if (rep > r->h) {
+            rep = r->h;
+        }
+        for (int32_t i = 1; i < rep; i++) {
+            for (int32_t x = 0; x < r->w; x++) {
+                grad_line[i * r->w + x] = grad_line[x];
+            }
+        }
+        grad_stats.cpu_pixels += (uint32_t)((rep - 1) * r->w);
+        for (int32_t y = 0; y < r->h; y += rep) {
+            grad_put(canvas, g, grad_line, (uint16_t)r->w, r, r->y + y, (r->h - y < rep) ? r->h - y : rep);
+        }
+    }
+}
+
+static int32_t grad_round_div(int64_t a, int64_t b)
+{
+    if (b < 0) {
+        a = -a;
+        b = -b;
+    }
+    return (int32_t)((a >= 0) ? (a + b / 2) / b : -((-a + b / 2) / b));
+}
+
+/* Line y is the line above shifted by step_y / step_x pixels: one template covering every shift */
+static bool grad_diagonal(const gfx_canvas_t *canvas, const gfx_rect_t *r, const gfx_grad_t *g)
+{
+    int32_t last = grad_round_div((int64_t)(r->h - 1) * g->step_y, g->step_x);
+    int32_t smin = (last < 0) ? last : 0;
+    int32_t len = r->w + ((last < 0) ? -last : last);
+
+    if (len > (g->opaque ? 2 * GFX_GRAD_LINE_MAX : GFX_GRAD_LINE_MAX)) {
+        return false;
+    }
+    grad_linear_line(g, grad_linear_t2(g, r->x + smin, r->y), len, grad_line);
+    for (int32_t y = 0; y < r->h; y++) {
+        int32_t j = grad_round_div((int64_t)y * g->step_y, g->step_x) - smin;
+        const void *src = g->opaque ? (const void *)((const uint16_t *)grad_line + j) : (const void *)(grad_line + j);
+
+        grad_put(canvas, g, src, (uint16_t)r->w, r, r->y + y, 1);
+    }
+    return true;
+}
+
+/* Every line computed, into the two line buffers in turn */
+static void grad_lines(const gfx_canvas_t *canvas, const gfx_rect_t *r, const gfx_grad_t *g)
+{
+    for (int32_t y = 0; y < r->h; y++) {
+        void *buf = grad_half((uint32_t)y & 1U);    // DMA2D reads the other one
+
+        grad_linear_line(g, grad_linear_t2(g, r->x, r->y + y), r->w, buf);
+        grad_put(canvas, g, buf, (uint16_t)r->w, r, r->y + y, 1);
+    }
+}
+
+static void grad_radial_line(const gfx_grad_t *g, int32_t x, int32_t dy, int32_t n, void *out)
+{
+    int32_t dx = 2 * (x - g->x0) + 1;
+    uint32_t d = (uint32_t)(dx * dx + dy * dy);
+    int32_t k = grad_radial_index(g, d);
+
+    for (int32_t i = 0; i < n; i++) {
+        if (g->opaque) {
+            ((uint16_t *)out)[i] = g->lut565[k];
+        } else {
+            ((uint32_t *)out)[i] = g->lut[k];
+        }
+        d += (uint32_t)(4 * dx + 4);                // (dx + 2)^2 - dx^2
+        dx += 2;
+        while (k < GFX_GRAD_LUT_SIZE - 1 && d >= g->bound[k + 1]) {
+            k++;
+        }
+        while (k > 0 && d < g->bound[k]) {
+            k--;
+        }
+    }
+    grad_stats.lines++;
+    grad_stats.cpu_pixels += (uint32_t)n;
+}
+
+static void grad_radial(const gfx_canvas_t *canvas, const gfx_rect_t *r, const gfx_grad_t *g)
+{
+    uint32_t outer = g->bound[GFX_GRAD_LUT_SIZE - 1];
+    int32_t run = -1;                               // First line of a run outside the radius
+    uint32_t b = 0;
+
+    for (int32_t y = r->y; y <= r->y + r->h; y++) {
+        int32_t dy = 2 * (y - g->y0) + 1;
+        int32_t mirror = 2 * g->y0 - 1 - y;         // Line with the same distances
+
+        if (y < r->y + r->h && (uint32_t)(dy * dy) >= outer) {
+            if (run < 0) {
+                run = y;
+            }
+            continue;
+        }
+        if (run >= 0) {
+            grad_run(canvas, r, run, y - run, g->lut[GFX_GRAD_LUT_SIZE - 1]);
+            run = -1;
+        }
+        if (y == r->y + r->h) {
+            break;
+        }
+
+        if (g->opaque && mirror >= r->y && mirror < y) {
+            DMA2D_copy_rect_start(grad_addr(canvas, r->x, mirror), canvas->pitch, grad_addr(canvas, r->x, y),
+                                  canvas->pitch, (uint16_t)r->w, 1, DMA2D_INPUT_RGB565);
+            grad_stats.jobs++;
+        } else {
+            grad_radial_line(g, r->x, dy, r->w, grad_half(b));
+            grad_put(canvas, g, grad_half(b), (uint16_t)r->w, r, y, 1);
+            b ^= 1U;
+        }
+    }
+}
+
+gfx_grad_error_t gfx_grad_fill(const gfx_canvas_t *canvas, const gfx_rect_t *rect, const gfx_grad_t *grad)
+{
+    gfx_rect_t area;
+
+    if (canvas == NULL || rect == NULL || grad == NULL) {
+        return GFX_GRAD_ERR_PARAM;
+    }
+    if (!gfx_rect_intersect(rect, &canvas->clip, &area)) {
+        return GFX_GRAD_OK;
+    }
+
+    /* Line buffers hold GRAD_CHUNK_W pixels, wider areas are done in columns */
+    for (int32_t x = area.x; x < area.x + area.w; x += GRAD_CHUNK_W) {
+        gfx_rect_t r = { (int16_t)x, area.y, (int16_t)((area.x + area.w - x < GRAD_CHUNK_W) ? area.x + area.w - x : GRAD_CHUNK_W),
+                         area.h };
+
+        if (grad->type == GFX_GRAD_RADIAL) {
+            grad_radial(canvas, &r, grad);
+        } else if (grad->step_x == 0) {
+            grad_vertical(canvas, &r, grad);
+        } else if (grad->step_y == 0) {
+            grad_horizontal(canvas, &r, grad);
+        } else if (!grad_diagonal(canvas, &r, grad)) {
+            grad_lines(canvas, &r, grad);
+        }
+        DMA2D_wait();                               // The line buffers are reused by the next column
+    }
+    grad_stats.pixels += gfx_rect_area(&area);
+
+    return GFX_GRAD_OK;
+}
+
+const gfx_grad_stats_t *gfx_grad_get_stats(void)
+{
+    return &grad_stats;
+}
+
+void gfx_grad_reset_stats(void)
+{
+    grad_stats = (gfx_grad_stats_t){ 0 };
+}
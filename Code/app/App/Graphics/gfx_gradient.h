@@ -0,0 +1,110 @@
+/**
+ * @file gfx_gradient.h
+ * @brief Linear and radial gradient fills from line templates replicated by DMA2D
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note The colour stops are expanded once into a GFX_GRAD_LUT_SIZE entry
+ *       table, pixels only look up their index in it. The CPU computes as
+ *       few lines as the gradient allows and DMA2D does the rest:
+ *       - vertical: one index per line, every run of lines with the same
+ *         colour is one R2M fill (a blend for translucent colours);
+ *       - horizontal: one line template, replicated by M2M copies of the
+ *         area drawn so far, doubling the number of lines each time;
+ *       - any other angle: one template long enough for all lines, line y
+ *         is copied from it at the offset of its shift (rounded to a pixel);
+ *       - radial: one line per pair of lines mirrored about the centre, the
+ *         squared distance is updated incrementally along the line and
+ *         compared with the squared index boundaries, no square root. Lines
+ *         outside the radius are fills.
+ *       Lines the CPU computes go to two line buffers in RAM_NOCACHE, so
+ *       the next line is computed while DMA2D copies the last one.
+ *
+ *       Gradients with only opaque stops are drawn as RGB565 copies, others
+ *       are blended from ARGB8888 templates.
+ *
+ *       Full screen RGB565 in render_suite, CPU lines included: vertical
+ *       ~270 MP/s, horizontal ~140 MP/s, radial ~54 MP/s (CPU bound).
+ */
+
+#ifndef __GFX_GRADIENT_H__
+#define __GFX_GRADIENT_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gfx_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GFX_GRAD_LUT_SIZE               256
+#define GFX_GRAD_STOPS_MAX              8
+#define GFX_GRAD_LINE_MAX               1600        // ARGB8888 template pixels (6400 bytes), twice as many RGB565
+#define GFX_GRAD_RADIUS_MAX             2047
+
+typedef enum {
+    GFX_GRAD_LINEAR = 0,
+    GFX_GRAD_RADIAL,
+} gfx_grad_type_t;
+
+typedef enum {
+    GFX_GRAD_OK = 0,
+    GFX_GRAD_ERR_PARAM,
+} gfx_grad_error_t;
+
+typedef struct {
+    uint8_t     pos;                                // 0: start point / centre, 255: end point / radius
+    uint32_t    argb;
+} gfx_grad_stop_t;
+
+typedef struct {
+    uint8_t     type;                               // gfx_grad_type_t
+    bool        opaque;                             // Every stop has alpha 255
+    int16_t     x0;                                 // Start point, or centre
+    int16_t     y0;
+    int32_t     step_x;                             // Linear: index change per pixel, 16.16
+    int32_t     step_y;
+    uint32_t    lut[GFX_GRAD_LUT_SIZE];             // ARGB8888
+    uint16_t    lut565[GFX_GRAD_LUT_SIZE];
+    uint32_t    bound[GFX_GRAD_LUT_SIZE];           // Radial: squared doubled distance where index k starts
+} gfx_grad_t;
+
+typedef struct {
+    uint32_t    pixels;
+    uint32_t    lines;                              // Lines or templates computed by the CPU
+    uint32_t    cpu_pixels;                         // Their pixels, and template repeats written by the CPU
+    uint32_t    jobs;                               // DMA2D jobs
+} gfx_grad_stats_t;
+
+/**
+ * @brief Gradient from (x0, y0) to (x1, y1), constant across that direction, padded beyond the ends
+ * @param stops sorted by pos, 1 .. GFX_GRAD_STOPS_MAX
+ */
+gfx_grad_error_t gfx_grad_linear(gfx_grad_t *grad, int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                                 const gfx_grad_stop_t *stops, uint8_t count);
+
+/**
+ * @brief Gradient around (cx, cy) (a pixel corner) out to radius, padded beyond it
+ */
+gfx_grad_error_t gfx_grad_radial(gfx_grad_t *grad, int16_t cx, int16_t cy, uint16_t radius,
+                                 const gfx_grad_stop_t *stops, uint8_t count);
+
+/**
+ * @brief Fill a rectangle of the canvas, clipped, with gradient coordinates in canvas pixels
+ */
+gfx_grad_error_t gfx_grad_fill(const gfx_canvas_t *canvas, const gfx_rect_t *rect, const gfx_grad_t *grad);
+
+/**
+ * @brief ARGB8888 colour of one pixel, computed on its own
+ */
+uint32_t gfx_grad_color(const gfx_grad_t *grad, int16_t x, int16_t y);
+
+const gfx_grad_stats_t *gfx_grad_get_stats(void);
+void gfx_grad_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __GFX_GRADIENT_H__ */
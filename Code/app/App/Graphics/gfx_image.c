@@ -0,0 +1,374 @@
+/**
+ * @file gfx_image.c
+ * @brief Streaming LZ4 (RGB565) and QOI image decoders, RO_DATA to frame buffer or tile
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include "main.h"
+#include "gfx_image.h"
+
+#define IMG_RING_MASK                   (GFX_IMG_LZ4_RING - 1U)
+
+static gfx_img_decoder_t img_decoder;               // gfx_img_draw(), DTCM: the CPU is the only user
+static gfx_img_stats_t img_stats;
+
+static inline uint32_t img_min(uint32_t a, uint32_t b) {
+    return (a < b) ? a : b;
+}
+
+static inline uint32_t img_be32(const uint8_t *p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+gfx_img_error_t gfx_img_open(gfx_img_decoder_t *dec, uint32_t data, uint32_t size)
+{
+    const uint8_t *p = (const uint8_t *)data;
+
+    if (dec == NULL || p == NULL || size < 4U) {
+        return GFX_IMG_ERR_PARAM;
+    }
+    memset(dec, 0, offsetof(gfx_img_decoder_t, u));
+    dec->pixel = 0xFF000000UL;                      // QOI starts from opaque black
+
+    if (size >= sizeof(gfx_img_lz4_header_t) && p[0] == 'Z' && p[1] == '5' && p[2] == '6' && p[3] == '5') {
+        gfx_img_lz4_header_t h;
+
+        memcpy(&h, p, sizeof(h));                   // RO_DATA may not be aligned for the header
+        if (h.window > GFX_IMG_LZ4_RING || (uint32_t)h.width * 2U > GFX_IMG_LZ4_RING ||
+            h.size > size - sizeof(h)) {
+            return GFX_IMG_ERR_FORMAT;
+        }
+        dec->src = p + sizeof(h);
+        dec->end = dec->src + h.size;
+        dec->width = h.width;
+        dec->height = h.height;
+        dec->format = GFX_IMG_LZ4_RGB565;
+        return GFX_IMG_OK;
+    }
+
+    if (size >= GFX_IMG_QOI_HEADER_SIZE && p[0] == 'q' && p[1] == 'o' && p[2] == 'i' && p[3] == 'f') {
+        uint32_t w = img_be32(p + 4), h = img_be32(p + 8);
+
+        if (w > 0xFFFFU || h > 0xFFFFU || (p[12] != 3U && p[12] != 4U)) {
+            return GFX_IMG_ERR_FORMAT;
+        }
+        memset(dec->u.index, 0, sizeof(dec->u.index));
+        dec->src = p + GFX_IMG_QOI_HEADER_SIZE;
+        dec->end = p + size;
+        dec->width = (uint16_t)w;
+        dec->height = (uint16_t)h;
+        dec->format = GFX_IMG_QOI;
+        return GFX_IMG_OK;
+    }
+
+    return GFX_IMG_ERR_FORMAT;
+}
+
+/* ------------------------------------------------------------------ LZ4 --- */
+
+static void img_ring_put(uint8_t *ring, uint32_t pos, const uint8_t *src, uint32_t n)
+{
+    uint32_t at = pos & IMG_RING_MASK;
+    uint32_t first = GFX_IMG_LZ4_RING - at;
+
+    if (n <= first) {
+        memcpy(ring + at, src, n);
+    } else {
+        memcpy(ring + at, src, first);
+        memcpy(ring, src + first, n - first);
+    }
+}
+
+static bool img_lz4_length(const uint8_t **src, const uint8_t *end, uint32_t *len)
+{
+    const uint8_t *s = *src;
+    uint32_t b;
+
+    do {
+        if (s >= end) {
+            return false;
+        }
+        b = *s++;
+        *len += b;
+    } while (b == 255U);
+    *src = s;
+    return true;
+}
+
+/**
+ * @brief Decode the next n bytes into the ring, n <= GFX_IMG_LZ4_RING
+ * @note  Resumable at any byte: a sequence may span lines and calls.
+ */
+static bool img_lz4_fill(gfx_img_decoder_t *dec, uint32_t n)
+{
+    uint8_t *ring = dec->u.ring;
+    const uint8_t *src = dec->src;
+    const uint8_t *end = dec->end;
+    uint32_t pos = dec->pos;
+    bool ok = true;
+
+    while (n != 0U) {
+        if (dec->literal != 0U) {
+            uint32_t k = img_min(dec->literal, n);
+
+            if (k > (uint32_t)(end - src)) {
+                ok = false;
+                break;
+            }
+            img_ring_put(ring, pos, src, k);
+            src += k;
+            pos += k;
+            n -= k;
+            dec->literal -= k;
+        } else if (dec->match != 0U) {
+            uint32_t k = img_min(dec->match, n);
+            uint32_t at = pos & IMG_RING_MASK;
+            uint32_t from = (pos - dec->offset) & IMG_RING_MASK;
+
+            if (dec->offset >= k && at + k <= GFX_IMG_LZ4_RING && from + k <= GFX_IMG_LZ4_RING) {
+                memmove(ring + at, ring + from, k);
+            } else {
+                /* Overlapping (repeated pattern) or wrapping, forward byte copy */
+                for (uint32_t i = 0; i < k; i++) {
+                    ring[(pos + i) & IMG_RING_MASK] = ring[(pos - dec->offset + i) & IMG_RING_MASK];
+                }
+            }
+            pos += k;
+            n -= k;
+            dec->match -= k;
+        } else if (dec->token != 0U) {
+            /* Literals done, offset and match length follow */
+            uint32_t len = dec->token & 15U;
+
+            if ((uint32_t)(end - src) < 2U) {
+                ok = false;
+                break;
+            }
+            dec->offset = (uint32_t)src[0] | ((uint32_t)src[1] << 8);
+            src += 2;
+            if (dec->offset == 0U || dec->offset > pos || dec->offset > GFX_IMG_LZ4_RING ||
+                (len == 15U && !img_lz4_length(&src, end, &len))) {
+                ok = false;
+                break;
+            }
+            dec->match = len + 4U;
+            dec->token = 0;
+        } else {
+            /* Next sequence: token, literal length */
+            uint32_t token, len;
+
+            if (src >= end) {
+                ok = false;
+                break;
+            }
+            token = *src++;
+            len = token >> 4;
+            if (len == 15U && !img_lz4_length(&src, end, &len)) {
+                ok = false;
+                break;
+            }
+            dec->literal = len;
+            dec->token = token | 0x100U;            // Non zero even for a zero token
+        }
+    }
+
+    dec->src = src;
+    dec->pos = pos;
+    return ok;
+}
+
+static bool img_lz4_line(gfx_img_decoder_t *dec, uint16_t *out, uint32_t x, uint32_t w)
+{
+    uint32_t start = dec->pos;
+
+    if (!img_lz4_fill(dec, (uint32_t)dec->width * 2U)) {
+        return false;
+    }
+    if (w != 0U) {
+        uint32_t at = (start + x * 2U) & IMG_RING_MASK;
+        uint32_t bytes = w * 2U;
+        uint32_t first = img_min(bytes, GFX_IMG_LZ4_RING - at);
+
+        memcpy(out, dec->u.ring + at, first);
+        memcpy((uint8_t *)out + first, dec->u.ring, bytes - first);
+    }
+    return true;
+}
+
+/* ------------------------------------------------------------------ QOI --- */
+
+#define QOI_OP_INDEX                    0x00U
+#define QOI_OP_DIFF                     0x40U
+#define QOI_OP_LUMA                     0x80U
+#define QOI_OP_RUN                      0xC0U
+#define QOI_OP_RGB                      0xFEU
+#define QOI_OP_RGBA                     0xFFU
+
+static inline uint32_t qoi_hash(uint32_t px) {
+    return ((px & 0xFFU) * 3U + ((px >> 8) & 0xFFU) * 5U + ((px >> 16) & 0xFFU) * 7U + (px >> 24) * 11U) & 63U;
+}
+
+static inline uint16_t qoi_rgb565(uint32_t px) {
+    return (uint16_t)(((px & 0xF8U) << 8) | ((px >> 5) & 0x07E0U) | ((px >> 19) & 0x001FU));
+}
+
+static bool img_qoi_line(gfx_img_decoder_t *dec, uint16_t *out, uint32_t x, uint32_t w)
+{
+    const uint8_t *src = dec->src;
+    const uint8_t *end = dec->end;
+    uint32_t *index = dec->u.index;
+    uint32_t px = dec->pixel;
+    uint32_t run = dec->run;
+    bool ok = true;
+
+    for (uint32_t i = 0; i < dec->width; i++) {
+        if (run != 0U) {
+            run--;
+        } else {
+            uint32_t b;
+
+            if (src >= end) {
+                ok = false;
+                break;
+            }
+            b = *src++;
+            if (b == QOI_OP_RGB || b == QOI_OP_RGBA) {
+                uint32_t n = (b == QOI_OP_RGB) ? 3U : 4U;
+
+                if ((uint32_t)(end - src) < n) {
+                    ok = false;
+                    break;
+                }
+                px = (n == 3U) ? ((px & 0xFF000000UL) | src[0] | ((uint32_t)src[1] << 8) | ((uint32_t)src[2] << 16))
+                               : (src[0] | ((uint32_t)src[1] << 8) | ((uint32_t)src[2] << 16) | ((uint32_t)src[3] << 24));
+                src += n;
+            } else if ((b & 0xC0U) == QOI_OP_INDEX) {
+                px = index[b];
+            } else if ((b & 0xC0U) == QOI_OP_DIFF) {
+                uint32_t r = (px + ((b >> 4) & 3U) - 2U) & 0xFFU;
+                uint32_t g = ((px >> 8) + ((b >> 2) & 3U) - 2U) & 0xFFU;
+                uint32_t bl = ((px >> 16) + (b & 3U) - 2U) & 0xFFU;
+
+                px = (px & 0xFF000000UL) | r | (g << 8) | (bl << 16);
+            } else if ((b & 0xC0U) == QOI_OP_LUMA) {
+                int32_t dg = (int32_t)(b & 0x3FU) - 32;
+                uint32_t b2, r, g, bl;
+
+                if (src >= end) {
+                    ok = false;
+                    break;
+                }
+                b2 = *src++;
+                r = (uint32_t)((int32_t)(px & 0xFFU) + dg - 8 + (int32_t)(b2 >> 4)) & 0xFFU;
+                g = (uint32_t)((int32_t)((px >> 8) & 0xFFU) + dg) & 0xFFU;
+                bl = (uint32_t)((int32_t)((px >> 16) & 0xFFU) + dg - 8 + (int32_t)(b2 & 15U)) & 0xFFU;
+                px = (px & 0xFF000000UL) | r | (g << 8) | (bl << 16);
+            } else {
+                run = b & 0x3FU;                    // This pixel plus run more
+            }
+            index[qoi_hash(px)] = px;
+        }
+        if (i - x < w) {
+            out[i - x] = qoi_rgb565(px);
+        }
+    }
+
+    dec->src = src;
+    dec->pixel = px;
+    dec->run = run;
+    return ok;
+}
+
+/* ------------------------------------------------------------------ API --- */
+
+gfx_img_error_t gfx_img_decode(gfx_img_decoder_t *dec, uint32_t dst, uint16_t dst_pitch,
+                               uint16_t x, uint16_t w, uint16_t lines)
+{
+    uint16_t *out = (uint16_t *)dst;
+    uint32_t done = 0;
+
+    if (dec == NULL || dec->format == GFX_IMG_NONE || (w != 0U && dst == 0U)) {
+        return GFX_IMG_ERR_PARAM;
+    }
+    if (dec->error != GFX_IMG_OK) {
+        return (gfx_img_error_t)dec->error;
+    }
+    if (dec->line >= dec->height) {
+        return GFX_IMG_ERR_END;
+    }
+    w = (x >= dec->width) ? 0U : (uint16_t)img_min(w, (uint32_t)dec->width - x);
+    lines = (uint16_t)img_min(lines, (uint32_t)dec->height - dec->line);
+
+    for (; done < lines; done++) {
+        bool ok = (dec->format == GFX_IMG_QOI) ? img_qoi_line(dec, out, x, w) : img_lz4_line(dec, out, x, w);
+
+        if (!ok) {
+            dec->error = GFX_IMG_ERR_DATA;
+            break;
+        }
+        dec->line++;
+        out += dst_pitch;
+        if (dec->format == GFX_IMG_QOI) {
+            img_stats.qoi_pixels += dec->width;
+        } else {
+            img_stats.lz4_pixels += dec->width;
+        }
+    }
+
+    /* GRAM is write-through (MPU region 2), the clean is for destinations in
+     * write-back AXI SRAM (region 0): LTDC / DMA2D read the lines from memory */
+    if (w != 0U && done != 0U) {
+        SCB_CleanDCache_by_Addr((uint32_t *)dst, (int32_t)(((done - 1U) * dst_pitch + w) * 2U));
+    }
+
+    return (gfx_img_error_t)dec->error;
+}
+
+gfx_img_error_t gfx_img_skip(gfx_img_decoder_t *dec, uint16_t lines)
+{
+    return gfx_img_decode(dec, 0, 0, 0, 0, lines);
+}
+
+gfx_img_error_t gfx_img_draw(const gfx_canvas_t *canvas, uint32_t data, uint32_t size, int16_t x, int16_t y)
+{
+    gfx_img_error_t err;
+    gfx_rect_t area, r;
+
+    if (canvas == NULL) {
+        return GFX_IMG_ERR_PARAM;
+    }
+    err = gfx_img_open(&img_decoder, data, size);
+    if (err != GFX_IMG_OK) {
+        return err;
+    }
+    area.x = x;
+    area.y = y;
+    area.w = (int16_t)img_decoder.width;
+    area.h = (int16_t)img_decoder.height;
+    if (!gfx_rect_intersect(&area, &canvas->clip, &r)) {
+        return GFX_IMG_OK;
+    }
+
+    if (r.y > y) {
+        err = gfx_img_skip(&img_decoder, (uint16_t)(r.y - y));
+        if (err != GFX_IMG_OK) {
+            return err;
+        }
+    }
+    return gfx_img_decode(&img_decoder, canvas->buffer + ((uint32_t)r.y * canvas->pitch + (uint32_t)r.x) * 2U,
+                          canvas->pitch, (uint16_t)(r.x - x), (uint16_t)r.w, (uint16_t)r.h);
+}
+
+const gfx_img_stats_t *gfx_img_get_stats(void)
+{
+    return &img_stats;
+}
+
+void gfx_img_reset_stats(void)
+{
+    img_stats = (gfx_img_stats_t){ 0 };
+}
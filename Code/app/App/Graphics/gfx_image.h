@@ -0,0 +1,126 @@
+/**
+ * @file gfx_image.h
+ * @brief Streaming LZ4 (RGB565) and QOI image decoders, RO_DATA to frame buffer or tile
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note Compressed images are read in place from RO_DATA and decoded top to
+ *       bottom, a few lines at a time, straight into the destination: the
+ *       frame buffer, or a band shaped PFB tile that is then copied by DMA2D.
+ *       No full image buffer is needed, the decoder state is the only RAM.
+ *
+ *       LZ4: gfx_img_lz4_header_t followed by one LZ4 block of the raw
+ *       RGB565 pixels (little endian, no line padding). Match offsets are
+ *       limited to the window in the header, so history fits the ring of
+ *       the decoder. Written by Tools/imgcodec/imgcodec.py.
+ *
+ *       QOI: the standard format (qoiformat.org), RGB or RGBA, decoded to
+ *       RGB565, alpha is dropped.
+ */
+
+#ifndef __GFX_IMAGE_H__
+#define __GFX_IMAGE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gfx_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef GFX_IMG_LZ4_RING
+#define GFX_IMG_LZ4_RING                8192        // LZ4 history in bytes, power of two
+#endif
+
+#define GFX_IMG_LZ4_MAGIC               0x3536355AUL    // "Z565"
+#define GFX_IMG_QOI_MAGIC               0x66696F71UL    // "qoif"
+#define GFX_IMG_QOI_HEADER_SIZE         14
+
+typedef struct {
+    uint32_t    magic;
+    uint16_t    width;
+    uint16_t    height;
+    uint32_t    size;                               // LZ4 block bytes after the header
+    uint16_t    window;                             // Largest match offset in bytes
+    uint16_t    reserved;
+} gfx_img_lz4_header_t;
+
+typedef enum {
+    GFX_IMG_NONE = 0,
+    GFX_IMG_LZ4_RGB565,
+    GFX_IMG_QOI,
+} gfx_img_format_t;
+
+typedef enum {
+    GFX_IMG_OK = 0,
+    GFX_IMG_ERR_PARAM,
+    GFX_IMG_ERR_FORMAT,                             // Unknown magic, or the window does not fit the ring
+    GFX_IMG_ERR_DATA,                               // Stream ends early or references data before the start
+    GFX_IMG_ERR_END,                                // Every line has been decoded
+} gfx_img_error_t;
+
+typedef struct {
+    const uint8_t      *src;                        // Next compressed byte
+    const uint8_t      *end;
+    uint16_t            width;
+    uint16_t            height;
+    uint16_t            line;                       // Next line to decode
+    uint8_t             format;                     // gfx_img_format_t
+    uint8_t             error;                      // Sticky gfx_img_error_t of the stream
+    /* LZ4: sequence in progress */
+    uint32_t            literal;                    // Literal bytes left
+    uint32_t            match;                      // Match bytes left
+    uint32_t            offset;
+    uint32_t            token;                      // Token whose match follows the literals, 0: none
+    uint32_t            pos;                        // Bytes decoded so far
+    /* QOI */
+    uint32_t            pixel;                      // Previous pixel, 0xAABBGGRR
+    uint32_t            run;                        // Repeats of pixel left
+    union {
+        uint8_t         ring[GFX_IMG_LZ4_RING];     // LZ4 history, the current line is decoded here
+        uint32_t        index[64];                  // QOI colour cache
+    } u;
+} gfx_img_decoder_t;
+
+typedef struct {
+    uint32_t            lz4_pixels;                 // Decoded, whole lines including the dropped columns
+    uint32_t            qoi_pixels;
+} gfx_img_stats_t;
+
+/**
+ * @brief Start decoding an image
+ * @param data address of the LZ4 or QOI image, usually in RO_DATA
+ * @param size bytes available at data
+ */
+gfx_img_error_t gfx_img_open(gfx_img_decoder_t *dec, uint32_t data, uint32_t size);
+
+/**
+ * @brief Decode the next lines into an RGB565 buffer
+ * @param dst address of pixel (0, 0) of the lines written, e.g. a PFB tile
+ * @param dst_pitch destination line length in pixels
+ * @param x, w image columns written to dst (the rest of each line is decoded and dropped)
+ * @param lines lines to decode, fewer are written at the end of the image
+ */
+gfx_img_error_t gfx_img_decode(gfx_img_decoder_t *dec, uint32_t dst, uint16_t dst_pitch,
+                               uint16_t x, uint16_t w, uint16_t lines);
+
+/**
+ * @brief Decode and drop lines, e.g. the part above the clip rectangle
+ */
+gfx_img_error_t gfx_img_skip(gfx_img_decoder_t *dec, uint16_t lines);
+
+/**
+ * @brief Decode a whole image onto a canvas at (x, y), clipped
+ * @note  Uses a static decoder, not reentrant.
+ */
+gfx_img_error_t gfx_img_draw(const gfx_canvas_t *canvas, uint32_t data, uint32_t size, int16_t x, int16_t y);
+
+const gfx_img_stats_t *gfx_img_get_stats(void);
+void gfx_img_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __GFX_IMAGE_H__ */
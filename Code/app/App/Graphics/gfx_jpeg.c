@@ -0,0 +1,360 @@
+/**
+ * @file gfx_jpeg.c
+ * @brief JPEG photos and MJPEG playback: codec to YCbCr MCU chunks, DMA2D YCbCr to RGB565 into the canvas
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#include <stddef.h>
+#include "main.h"
+#include "dma2d.h"
+#include "jpeg_codec.h"
+#include "gfx_jpeg.h"
+
+enum {
+    STREAM_SYNC = 0,                                // Looking for FF D8
+    STREAM_SYNC_FF,
+    STREAM_MARKER,                                  // Header: FF of the next marker
+    STREAM_CODE,
+    STREAM_LEN_HI,
+    STREAM_LEN_LO,
+    STREAM_SEGMENT,
+    STREAM_SCAN,                                    // Entropy coded data up to FF D9
+    STREAM_SCAN_FF,
+};
+
+#define JPEG_SOI                        0xD8
+#define JPEG_EOI                        0xD9
+#define JPEG_SOS                        0xDA
+
+static gfx_jpeg_stats_t jpeg_stats;
+
+__attribute__((section(".sram_noncache_bss"), aligned(32))) static uint8_t jpeg_chunk[2][GFX_JPEG_CHUNK_SIZE];  // Codec -> DMA2D
+
+static gfx_jpeg_error_t jpeg_error(jpeg_codec_error_t err)
+{
+    switch (err) {
+    case JPEG_CODEC_OK:             return GFX_JPEG_OK;
+    case JPEG_CODEC_ERR_FORMAT:     return GFX_JPEG_ERR_FORMAT;
+    case JPEG_CODEC_ERR_TIMEOUT:    return GFX_JPEG_ERR_TIMEOUT;
+    case JPEG_CODEC_ERR_DATA:       return GFX_JPEG_ERR_DECODE;
+    default:                        return GFX_JPEG_ERR_PARAM;
+    }
+}
+
+gfx_jpeg_error_t gfx_jpeg_info(const uint8_t *data, uint32_t size, gfx_jpeg_info_t *info)
+{
+    jpeg_info_t ji;
+    jpeg_codec_error_t err;
+
+    if (data == NULL || info == NULL) {
+        return GFX_JPEG_ERR_PARAM;
+    }
+    err = jpeg_codec_info(data, size, &ji);
+    info->width = ji.width;
+    info->height = ji.height;
+    info->css = ji.css;
+    if (err == JPEG_CODEC_OK && (uint32_t)ji.mcu_cols * ji.mcu_bytes > GFX_JPEG_CHUNK_SIZE) {
+        return GFX_JPEG_ERR_SIZE;
+    }
+    return jpeg_error(err);
+}
+
+gfx_jpeg_error_t gfx_jpeg_draw(const gfx_canvas_t *canvas, const uint8_t *data, uint32_t size, int16_t x, int16_t y)
+{
+    static uint8_t *const out[2] = { jpeg_chunk[0], jpeg_chunk[1] };
+    jpeg_info_t info;
+    jpeg_codec_error_t err;
+    gfx_rect_t area, r;
+    uint32_t row_bytes, chunk_rows, chunks, line = 0, k = 0;
+
+    if (canvas == NULL || data == NULL) {
+        return GFX_JPEG_ERR_PARAM;
+    }
+    if ((err = jpeg_codec_info(data, size, &info)) != JPEG_CODEC_OK) {
+        jpeg_stats.errors++;
+        return jpeg_error(err);
+    }
+    row_bytes = (uint32_t)info.mcu_cols * info.mcu_bytes;
+    if (row_bytes > GFX_JPEG_CHUNK_SIZE) {
+        return GFX_JPEG_ERR_SIZE;
+    }
+
+    area.x = x;
+    area.y = y;
+    area.w = (int16_t)info.width;
+    area.h = (int16_t)info.height;
+    if (!gfx_rect_intersect(&area, &canvas->clip, &r)) {
+        return GFX_JPEG_OK;
+    }
+    if (r.x != x || r.y != y) {
+        return GFX_JPEG_ERR_CLIP;
+    }
+
+    chunk_rows = GFX_JPEG_CHUNK_SIZE / row_bytes;
+    chunks = (info.mcu_rows + chunk_rows - 1U) / chunk_rows;
+    SCB_CleanDCache_by_Addr((uint32_t *)(uintptr_t)((uint32_t)(uintptr_t)data & ~31U), (int32_t)(size + 32U));
+    err = jpeg_codec_start(data, size, &info, out, (uint16_t)chunk_rows);
+
+    /* Chunk k is converted while the codec writes chunk k + 1, visible lines only */
+    while (err == JPEG_CODEC_OK && line < (uint32_t)r.h) {
+        uint32_t lines = chunk_rows * info.mcu_h;
+
+        if ((err = jpeg_codec_wait(k)) != JPEG_CODEC_OK) {
+            break;
+        }
+        if (k > 0U) {
+            DMA2D_wait();
+            jpeg_codec_release(k - 1U);
+        }
+        if (lines > (uint32_t)r.h - line) {
+            lines = (uint32_t)r.h - line;
+        }
+        DMA2D_convert_ycbcr_start((uint32_t)(uintptr_t)out[k & 1U], (uint16_t)(info.mcu_cols * info.mcu_w), info.css,
+                                  canvas->buffer + ((uint32_t)(r.y + line) * canvas->pitch + (uint32_t)r.x) * 2U,
+                                  canvas->pitch, (uint16_t)r.w, (uint16_t)lines);
+        jpeg_stats.chunks++;
+        line += lines;
+        k++;
+    }
+    DMA2D_wait();
+    if (k > 0U) {
+        jpeg_codec_release(k - 1U);
+    }
+
+    /* Stopping early (bottom clipped) is not an error */
+    if (jpeg_codec_stop() != JPEG_CODEC_OK && err == JPEG_CODEC_OK && k == chunks) {
+        err = JPEG_CODEC_ERR_DATA;
+    }
+    if (err != JPEG_CODEC_OK) {
+        jpeg_stats.errors++;
+        return jpeg_error(err);
+    }
+    jpeg_stats.frames++;
+    jpeg_stats.pixels += (uint32_t)r.w * (uint32_t)r.h;
+    return GFX_JPEG_OK;
+}
+
+static inline uint32_t jpeg_be16(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 8) | p[1];
+}
+
+/* Offset just past the EOI of the frame whose SOI is at pos, 0 if it does not end in the data */
+static uint32_t jpeg_frame_end(const uint8_t *data, uint32_t pos, uint32_t size)
+{
+    uint32_t i = pos + 2U;
+
+    /* Header segments may hold anything (thumbnails), skip them by length */
+    while (i + 4U <= size) {
+        uint32_t marker = data[i + 1];
+
+        if (data[i] != 0xFFU) {
+            return 0;
+        }
+        if (marker == 0xFFU) {
+            i++;
+            continue;
+        }
+        if (marker == JPEG_EOI) {
+            return i + 2U;
+        }
+        i += 2U + jpeg_be16(data + i + 2);
+        if (marker == JPEG_SOS) {
+            break;
+        }
+    }
+    /* Entropy coded data has no FF D9 */
+    for (; i + 1U < size; i++) {
+        if (data[i] == 0xFFU && data[i + 1] == JPEG_EOI) {
+            return i + 2U;
+        }
+    }
+    return 0;
+}
+
+gfx_jpeg_error_t gfx_mjpeg_open(gfx_mjpeg_t *mjpeg, const uint8_t *data, uint32_t size, bool loop)
+{
+    if (mjpeg == NULL || data == NULL) {
+        return GFX_JPEG_ERR_PARAM;
+    }
+    mjpeg->data = data;
+    mjpeg->size = size;
+    mjpeg->pos = 0;
+    mjpeg->frame = 0;
+    mjpeg->loop = loop;
+    return GFX_JPEG_OK;
+}
+
+gfx_jpeg_error_t gfx_mjpeg_next(gfx_mjpeg_t *mjpeg, const uint8_t **frame, uint32_t *size)
+{
+    const uint8_t *d;
+
+    if (mjpeg == NULL || mjpeg->data == NULL || frame == NULL || size == NULL) {
+        return GFX_JPEG_ERR_PARAM;
+    }
+    d = mjpeg->data;
+    for (uint32_t pass = 0; pass < 2U; pass++) {
+        uint32_t pos = mjpeg->pos, end = 0;
+
+        while (pos + 1U < mjpeg->size && !(d[pos] == 0xFFU && d[pos + 1] == JPEG_SOI)) {
+            pos++;
+        }
+        if (pos + 1U < mjpeg->size) {
+            end = jpeg_frame_end(d, pos, mjpeg->size);
+        }
+        if (end != 0U) {
+            *frame = d + pos;
+            *size = end - pos;
+            mjpeg->pos = end;
+            mjpeg->frame++;
+            return GFX_JPEG_OK;
+        }
+        if (!mjpeg->loop || mjpeg->pos == 0U) {
+            break;                                          // End, or no frame at all
+        }
+        mjpeg->pos = 0;
+    }
+    return GFX_JPEG_ERR_END;
+}
+
+void gfx_jpeg_stream_init(gfx_jpeg_stream_t *stream, uint8_t *buf, uint32_t size)
+{
+    stream->buf = buf;
+    stream->size = size;
+    stream->len = 0;
+    stream->skip = 0;
+    stream->state = STREAM_SYNC;
+    stream->marker = 0;
+    stream->ready = false;
+    stream->frames = 0;
+    stream->dropped = 0;
+}
+
+static void stream_restart(gfx_jpeg_stream_t *s, bool soi)
+{
+    if (soi) {
+        s->buf[0] = 0xFFU;
+        s->buf[1] = JPEG_SOI;
+        s->len = 2;
+        s->state = STREAM_MARKER;
+    } else {
+        s->len = 0;
+        s->state = STREAM_SYNC;
+    }
+}
+
+uint32_t gfx_jpeg_stream_feed(gfx_jpeg_stream_t *stream, const uint8_t *data, uint32_t len)
+{
+    gfx_jpeg_stream_t *s = stream;
+    uint32_t n;
+
+    if (s == NULL || s->buf == NULL || s->size < 4U) {
+        return 0;
+    }
+    for (n = 0; n < len && !s->ready; n++) {
+        uint8_t c = data[n];
+
+        if (s->state >= STREAM_MARKER) {
+            if (s->len >= s->size) {
+                s->dropped++;
+                stream_restart(s, false);
+                continue;
+            }
+            s->buf[s->len++] = c;
+        }
+
+        switch (s->state) {
+        case STREAM_SYNC:
+            if (c == 0xFFU) {
+                s->state = STREAM_SYNC_FF;
+            }
+            break;
+        case STREAM_SYNC_FF:
+            if (c == JPEG_SOI) {
+                stream_restart(s, true);
+            } else if (c != 0xFFU) {
+                s->state = STREAM_SYNC;
+            }
+            break;
+        case STREAM_MARKER:
+            if (c != 0xFFU) {
+                s->dropped++;                               // Lost sync inside a header
+                stream_restart(s, false);
+            } else {
+                s->state = STREAM_CODE;
+            }
+            break;
+        case STREAM_CODE:
+            if (c == JPEG_SOI) {
+                stream_restart(s, true);
+            } else if (c == JPEG_EOI) {
+                s->ready = true;
+            } else if (c != 0xFFU) {
+                s->marker = c;
+                s->state = STREAM_LEN_HI;
+            }
+            break;
+        case STREAM_LEN_HI:
+            s->skip = (uint32_t)c << 8;
+            s->state = STREAM_LEN_LO;
+            break;
+        case STREAM_LEN_LO:
+            s->skip |= c;
+            if (s->skip < 2U) {
+                s->dropped++;
+                stream_restart(s, false);
+                break;
+            }
+            s->skip -= 2U;
+            if (s->skip == 0U) {
+                s->state = (s->marker == JPEG_SOS) ? STREAM_SCAN : STREAM_MARKER;
+            } else {
+                s->state = STREAM_SEGMENT;
+            }
+            break;
+        case STREAM_SEGMENT:
+            if (--s->skip == 0U) {
+                s->state = (s->marker == JPEG_SOS) ? STREAM_SCAN : STREAM_MARKER;
+            }
+            break;
+        case STREAM_SCAN:
+            if (c == 0xFFU) {
+                s->state = STREAM_SCAN_FF;
+            }
+            break;
+        default:    /* STREAM_SCAN_FF */
+            if (c == JPEG_EOI) {
+                s->ready = true;
+            } else if (c == JPEG_SOI) {
+                s->dropped++;                               // Frame cut short, the next one starts
+                stream_restart(s, true);
+            } else if (c != 0xFFU) {
+                s->state = STREAM_SCAN;                     // Stuffed byte, RSTn
+            }
+            break;
+        }
+        if (s->ready) {
+            s->frames++;
+        }
+    }
+    return n;
+}
+
+void gfx_jpeg_stream_release(gfx_jpeg_stream_t *stream)
+{
+    stream->ready = false;
+    stream->len = 0;
+    stream->state = STREAM_SYNC;
+}
+
+const gfx_jpeg_stats_t *gfx_jpeg_get_stats(void)
+{
+    return &jpeg_stats;
+}
+
+void gfx_jpeg_reset_stats(void)
+{
+    jpeg_stats = (gfx_jpeg_stats_t){ 0 };
+}
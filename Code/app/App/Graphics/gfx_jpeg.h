@@ -0,0 +1,130 @@
+/**
+ * @file gfx_jpeg.h
+ * @brief JPEG photos and MJPEG playback: codec to YCbCr MCU chunks, DMA2D YCbCr to RGB565 into the canvas
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note A frame is decoded in chunks of whole MCU rows into two buffers in
+ *       RAM_NOCACHE (GFX_JPEG_CHUNK_SIZE bytes each). DMA2D converts chunk k
+ *       straight into the canvas while the codec writes chunk k + 1 into the
+ *       other buffer, so the frame never exists in YCbCr as a whole and the
+ *       CPU only waits, starts DMA2D jobs and re-arms MDMA (jpeg_codec.h).
+ *
+ *       DMA2D reads YCbCr from the first MCU of a row: the image may be
+ *       clipped on the right and at the bottom, but its top left corner must
+ *       be inside the canvas clip (GFX_JPEG_ERR_CLIP otherwise).
+ *
+ *       Sources: a JPEG or a raw MJPEG stream (concatenated JPEG frames, see
+ *       Tools/mjpeg) in RO_DATA, or frames assembled from bytes received on
+ *       a UART with gfx_jpeg_stream_feed().
+ */
+
+#ifndef __GFX_JPEG_H__
+#define __GFX_JPEG_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gfx_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GFX_JPEG_CHUNK_SIZE             19200       // One MCU row of an 800 pixel wide frame (any sub-sampling)
+
+typedef enum {
+    GFX_JPEG_OK = 0,
+    GFX_JPEG_ERR_PARAM,
+    GFX_JPEG_ERR_FORMAT,                            // Not baseline YCbCr 4:4:4 / 4:2:2 / 4:2:0
+    GFX_JPEG_ERR_SIZE,                              // An MCU row does not fit GFX_JPEG_CHUNK_SIZE
+    GFX_JPEG_ERR_CLIP,                              // Top left corner outside the canvas clip
+    GFX_JPEG_ERR_DECODE,                            // Broken stream
+    GFX_JPEG_ERR_TIMEOUT,
+    GFX_JPEG_ERR_END,                               // No more frames
+} gfx_jpeg_error_t;
+
+typedef struct {
+    uint16_t    width;
+    uint16_t    height;
+    uint8_t     css;                                // jpeg_css_t
+} gfx_jpeg_info_t;
+
+/* Raw MJPEG stream in memory */
+typedef struct {
+    const uint8_t  *data;
+    uint32_t        size;
+    uint32_t        pos;                            // Next frame
+    uint32_t        frame;                          // Frames returned
+    bool            loop;
+} gfx_mjpeg_t;
+
+/* Frame assembly from a byte stream */
+typedef struct {
+    uint8_t        *buf;
+    uint32_t        size;
+    uint32_t        len;                            // Bytes of the frame so far
+    uint32_t        skip;                           // Rest of the current header segment
+    uint8_t         state;
+    uint8_t         marker;                         // Of the current header segment
+    bool            ready;                          // buf holds a whole frame, see gfx_jpeg_stream_release()
+    uint32_t        frames;
+    uint32_t        dropped;                        // Frames larger than the buffer
+} gfx_jpeg_stream_t;
+
+typedef struct {
+    uint32_t    frames;
+    uint32_t    chunks;                             // DMA2D YCbCr jobs
+    uint32_t    pixels;
+    uint32_t    errors;
+} gfx_jpeg_stats_t;
+
+/**
+ * @brief Size and sub-sampling of a JPEG, and whether it can be drawn
+ */
+gfx_jpeg_error_t gfx_jpeg_info(const uint8_t *data, uint32_t size, gfx_jpeg_info_t *info);
+
+/**
+ * @brief Decode a JPEG onto the canvas at (x, y), clipped on the right and at the bottom
+ * @param data whole frame, readable by MDMA (see jpeg_codec_start())
+ */
+gfx_jpeg_error_t gfx_jpeg_draw(const gfx_canvas_t *canvas, const uint8_t *data, uint32_t size, int16_t x, int16_t y);
+
+/**
+ * @brief Open a raw MJPEG stream
+ * @param loop start over after the last frame
+ */
+gfx_jpeg_error_t gfx_mjpeg_open(gfx_mjpeg_t *mjpeg, const uint8_t *data, uint32_t size, bool loop);
+
+/**
+ * @brief Locate the next frame (SOI..EOI)
+ * @return GFX_JPEG_ERR_END after the last frame when not looping
+ */
+gfx_jpeg_error_t gfx_mjpeg_next(gfx_mjpeg_t *mjpeg, const uint8_t **frame, uint32_t *size);
+
+/**
+ * @brief Assemble frames in buf (not DTCM: the codec reads it with MDMA)
+ */
+void gfx_jpeg_stream_init(gfx_jpeg_stream_t *stream, uint8_t *buf, uint32_t size);
+
+/**
+ * @brief Take received bytes, up to the end of the next frame
+ * @return bytes consumed, 0 while a frame is ready and not released
+ * @note  Bytes before a start of image are skipped, so a stream can be joined
+ *        at any point. With the UART receive ring: rb_read_nocopy(), feed,
+ *        rb_read_commit() of the consumed count.
+ */
+uint32_t gfx_jpeg_stream_feed(gfx_jpeg_stream_t *stream, const uint8_t *data, uint32_t len);
+
+/**
+ * @brief The frame in buf has been drawn, assemble the next one
+ */
+void gfx_jpeg_stream_release(gfx_jpeg_stream_t *stream);
+
+const gfx_jpeg_stats_t *gfx_jpeg_get_stats(void);
+void gfx_jpeg_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __GFX_JPEG_H__ */
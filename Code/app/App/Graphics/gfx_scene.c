@@ -0,0 +1,792 @@
+/**
+ * @file gfx_scene.c
+ * @brief Retained scene graph: node pool, incremental layout and damage based redraw
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note Hidden nodes are left out of the layout and their bounds are
+ *       cleared, so showing one again always counts as a move and lays
+ *       out its whole subtree.
+ */
+
+#include <stddef.h>
+#include "main.h"
+#include "dma2d.h"
+#include "gfx_scene.h"
+
+#define SCENE_NODE_USED                 0x80        // Taken from the pool
+
+typedef struct {
+    gfx_rect_t  area;                               // Damaged rectangle, clipped to the canvas
+    gfx_rect_t  occluders[GFX_SCENE_OCCLUDERS];
+    uint8_t     occluder_count;
+    bool        full;                               // An opaque node covers the whole area
+    uint16_t    count;
+    gfx_node_id_t list[GFX_SCENE_NODES_MAX];        // Nodes to draw, front to back
+} scene_cull_t;
+
+typedef struct {
+    gfx_scene_t        *scene;
+    const gfx_canvas_t *canvas;
+} scene_flush_t;
+
+static gfx_scene_stats_t scene_stats;
+
+static gfx_node_t *scene_get(gfx_scene_t *scene, gfx_node_id_t id)
+{
+    if (scene == NULL || id >= GFX_SCENE_NODES_MAX || !(scene->nodes[id].flags & SCENE_NODE_USED)) {
+        return NULL;
+    }
+    return &scene->nodes[id];
+}
+
+static bool scene_rect_equal(const gfx_rect_t *a, const gfx_rect_t *b)
+{
+    return a->x == b->x && a->y == b->y && a->w == b->w && a->h == b->h;
+}
+
+/* Node and all its ancestors visible */
+static bool scene_shown(const gfx_scene_t *scene, const gfx_node_t *n)
+{
+    while (true) {
+        if (!(n->flags & GFX_NODE_VISIBLE)) {
+            return false;
+        }
+        if (n->parent == GFX_NODE_NONE) {
+            return true;
+        }
+        n = &scene->nodes[n->parent];
+    }
+}
+
+static void scene_damage_rect(gfx_scene_t *scene, const gfx_rect_t *rect)
+{
+    if (!gfx_rect_is_empty(rect)) {
+        gfx_dirty_add(&scene->damage, rect);
+    }
+}
+
+/* Content changed, same bounds */
+static void scene_damage_node(gfx_scene_t *scene, const gfx_node_t *n)
+{
+    if (scene_shown(scene, n)) {
+        scene_damage_rect(scene, &n->bounds);
+    }
+}
+
+/* Children of n must be placed again, its ancestors lead the layout pass there */
+static void scene_mark_layout(gfx_scene_t *scene, gfx_node_t *n)
+{
+    n->dirty |= GFX_NODE_DIRTY_LAYOUT;
+    while (n->parent != GFX_NODE_NONE) {
+        n = &scene->nodes[n->parent];
+        if (n->dirty & GFX_NODE_DIRTY_CHILD) {
+            break;                                  // Ancestors above are marked already
+        }
+        n->dirty |= GFX_NODE_DIRTY_CHILD;
+    }
+}
+
+/* Size or position of n changed: its parent places it again */
+static void scene_relayout(gfx_scene_t *scene, gfx_node_t *n)
+{
+    scene_mark_layout(scene, (n->parent != GFX_NODE_NONE) ? &scene->nodes[n->parent] : n);
+}
+
+static void scene_unlink(gfx_scene_t *scene, gfx_node_id_t id)
+{
+    gfx_node_t *n = &scene->nodes[id];
+    gfx_node_t *p = &scene->nodes[n->parent];
+
+    if (n->prev != GFX_NODE_NONE) {
+        scene->nodes[n->prev].next = n->next;
+    } else {
+        p->first = n->next;
+    }
+    if (n->next != GFX_NODE_NONE) {
+        scene->nodes[n->next].prev = n->prev;
+    } else {
+        p->last = n->prev;
+    }
+    n->prev = n->next = GFX_NODE_NONE;
+}
+
+/* Insert above the last sibling with a z not above n's */
+static void scene_link(gfx_scene_t *scene, gfx_node_id_t parent, gfx_node_id_t id)
+{
+    gfx_node_t *n = &scene->nodes[id];
+    gfx_node_t *p = &scene->nodes[parent];
+    gfx_node_id_t below = p->last;
+
+    while (below != GFX_NODE_NONE && scene->nodes[below].z > n->z) {
+        below = scene->nodes[below].prev;
+    }
+    n->parent = parent;
+    n->prev = below;
+    if (below != GFX_NODE_NONE) {
+        n->next = scene->nodes[below].next;
+        scene->nodes[below].next = id;
+    } else {
+        n->next = p->first;
+        p->first = id;
+    }
+    if (n->next != GFX_NODE_NONE) {
+        scene->nodes[n->next].prev = id;
+    } else {
+        p->last = id;
+    }
+}
+
+static void scene_free(gfx_scene_t *scene, gfx_node_id_t id)
+{
+    gfx_node_t *n = &scene->nodes[id];
+    gfx_node_id_t c = n->first;
+
+    while (c != GFX_NODE_NONE) {
+        gfx_node_id_t next = scene->nodes[c].next;
+
+        scene_free(scene, c);
+        c = next;
+    }
+    n->flags = 0;
+    n->next = scene->free;
+    scene->free = id;
+    scene->used--;
+}
+
+static int32_t scene_content_size(const gfx_node_t *n, bool horizontal)
+{
+    if (n->kind == GFX_NODE_TEXT && n->content.text.font != NULL && n->content.text.str != NULL) {
+        return horizontal ? (int32_t)gfx_font_text_width(n->content.text.font, n->content.text.str)
+                          : (int32_t)n->content.text.font->line_height;
+    }
+    if (n->kind == GFX_NODE_IMAGE && n->content.image.asset != NULL) {
+        return horizontal ? (int32_t)n->content.image.asset->width : (int32_t)n->content.image.asset->height;
+    }
+    return 0;
+}
+
+/* Resolved size of a child, avail: space left for a FILL size */
+static int32_t scene_size(const gfx_node_t *n, bool horizontal, int32_t avail)
+{
+    int32_t req = horizontal ? n->w : n->h;
+
+    if (req >= 0) {
+        return req;
+    }
+    if (req == GFX_SIZE_CONTENT) {
+        return scene_content_size(n, horizontal);
+    }
+    return (avail > 0) ? avail : 0;
+}
+
+static void scene_layout(gfx_scene_t *scene, gfx_node_t *n, bool force, bool damaged);
+
+/* New bounds of a child, lays out its subtree and damages what moved */
+static void scene_place(gfx_scene_t *scene, gfx_node_t *c, const gfx_rect_t *r, bool damaged)
+{
+    bool moved = !scene_rect_equal(r, &c->bounds);
+
+    scene_stats.layouts++;
+    if (moved && !damaged) {
+        scene_damage_rect(scene, &c->extent);       // Where the subtree was
+    }
+    c->bounds = *r;
+    scene_layout(scene, c, moved, damaged || moved);
+    if (moved && !damaged) {
+        scene_damage_rect(scene, &c->extent);       // Where it is now
+    }
+}
+
+static void scene_arrange(gfx_scene_t *scene, gfx_node_t *n, bool damaged)
+{
+    gfx_rect_t cb = { (int16_t)(n->bounds.x + n->pad), (int16_t)(n->bounds.y + n->pad),
+                      (int16_t)(n->bounds.w - 2 * n->pad), (int16_t)(n->bounds.h - 2 * n->pad) };
+    bool row = (n->layout == GFX_LAYOUT_ROW);
+    int32_t main_size = row ? cb.w : cb.h;
+    int32_t used = 0, fills = 0, share = 0, rest = 0, pos;
+
+    if (cb.w < 0) {
+        cb.w = 0;
+    }
+    if (cb.h < 0) {
+        cb.h = 0;
+    }
+
+    if (n->layout == GFX_LAYOUT_ABSOLUTE) {
+        for (gfx_node_id_t id = n->first; id != GFX_NODE_NONE; id = scene->nodes[id].next) {
+            gfx_node_t *c = &scene->nodes[id];
+            gfx_rect_t r;
+
+            if (!(c->flags & GFX_NODE_VISIBLE)) {
+                continue;
+            }
+            r.x = (int16_t)(cb.x + c->x);
+            r.y = (int16_t)(cb.y + c->y);
+            r.w = (int16_t)scene_size(c, true, cb.w - c->x);
+            r.h = (int16_t)scene_size(c, false, cb.h - c->y);
+            scene_place(scene, c, &r, damaged);
+        }
+        return;
+    }
+
+    /* ROW / COLUMN: fixed sizes first, FILL children share what is left */
+    for (gfx_node_id_t id = n->first; id != GFX_NODE_NONE; id = scene->nodes[id].next) {
+        const gfx_node_t *c = &scene->nodes[id];
+
+        if (!(c->flags & GFX_NODE_VISIBLE)) {
+            continue;
+        }
+        if (used > 0 || fills > 0) {
+            used += n->gap;
+        }
+        if ((row ? c->w : c->h) == GFX_SIZE_FILL) {
+            fills++;
+        } else {
+            used += scene_size(c, row, 0);
+        }
+    }
+    if (fills > 0 && main_size > used) {
+        share = (main_size - used) / fills;
+        rest = (main_size - used) % fills;
+    }
+
+    pos = row ? cb.x : cb.y;
+    for (gfx_node_id_t id = n->first; id != GFX_NODE_NONE; id = scene->nodes[id].next) {
+        gfx_node_t *c = &scene->nodes[id];
+        int32_t size;
+        gfx_rect_t r;
+
+        if (!(c->flags & GFX_NODE_VISIBLE)) {
+            continue;
+        }
+        if ((row ? c->w : c->h) == GFX_SIZE_FILL) {
+            size = share + ((rest > 0) ? 1 : 0);
+            rest -= (rest > 0) ? 1 : 0;
+        } else {
+            size = scene_size(c, row, 0);
+        }
+        if (row) {
+            r.x = (int16_t)pos;
+            r.y = (int16_t)(cb.y + c->y);
+            r.w = (int16_t)size;
+            r.h = (int16_t)scene_size(c, false, cb.h - c->y);
+        } else {
+            r.x = (int16_t)(cb.x + c->x);
+            r.y = (int16_t)pos;
+            r.w = (int16_t)scene_size(c, true, cb.w - c->x);
+            r.h = (int16_t)size;
+        }
+        scene_place(scene, c, &r, damaged);
+        pos += size + n->gap;
+    }
+}
+
+/*
+ * force: n moved or was resized, all its children are placed again.
+ * damaged: an ancestor already damaged its whole extent.
+ */
+static void scene_layout(gfx_scene_t *scene, gfx_node_t *n, bool force, bool damaged)
+{
+    if (force || (n->dirty & GFX_NODE_DIRTY_LAYOUT)) {
+        scene_arrange(scene, n, damaged);
+    } else {
+        for (gfx_node_id_t id = n->first; id != GFX_NODE_NONE; id = scene->nodes[id].next) {
+            gfx_node_t *c = &scene->nodes[id];
+
+            if ((c->flags & GFX_NODE_VISIBLE) && c->dirty) {
+                scene_layout(scene, c, false, damaged);
+            }
+        }
+    }
+
+    n->extent = n->bounds;
+    for (gfx_node_id_t id = n->first; id != GFX_NODE_NONE; id = scene->nodes[id].next) {
+        const gfx_node_t *c = &scene->nodes[id];
+
+        if ((c->flags & GFX_NODE_VISIBLE) && !gfx_rect_is_empty(&c->extent)) {
+            if (gfx_rect_is_empty(&n->extent)) {
+                n->extent = c->extent;
+            } else {
+                gfx_rect_union(&n->extent, &c->extent, &n->extent);
+            }
+        }
+    }
+    n->dirty = 0;
+}
+
+static bool scene_paints(const gfx_node_t *n)
+{
+    switch (n->kind) {
+    case GFX_NODE_TEXT:
+        if (n->content.text.font != NULL && n->content.text.str != NULL && (n->style.color >> 24) != 0U) {
+            return true;
+        }
+        break;
+    case GFX_NODE_IMAGE:
+        if (n->content.image.bundle != NULL && n->content.image.asset != NULL) {
+            return true;
+        }
+        break;
+    case GFX_NODE_CUSTOM:
+        if (n->content.custom.draw != NULL) {
+            return true;
+        }
+        break;
+    default:
+        break;
+    }
+    return (n->style.fill >> 24) != 0U;
+}
+
+static int16_t scene_align_x(const gfx_node_t *n, int32_t w)
+{
+    switch (n->style.align) {
+    case GFX_ALIGN_CENTER:
+        return (int16_t)(n->bounds.x + (n->bounds.w - w) / 2);
+    case GFX_ALIGN_RIGHT:
+        return (int16_t)(n->bounds.x + n->bounds.w - w);
+    default:
+        return n->bounds.x;
+    }
+}
+
+/* Area n covers with opaque pixels, empty if none */
+static void scene_opaque_area(const gfx_node_t *n, gfx_rect_t *r)
+{
+    const gfx_asset_t *a = (n->kind == GFX_NODE_IMAGE) ? n->content.image.asset : NULL;
+
+    if ((n->style.fill >> 24) == 0xFFU && n->style.corner == NULL) {
+        *r = n->bounds;
+    } else if (a != NULL && a->format == GFX_ASSET_RGB565) {
+        gfx_rect_t img = { scene_align_x(n, a->width), (int16_t)(n->bounds.y + (n->bounds.h - a->height) / 2),
+                           (int16_t)a->width, (int16_t)a->height };
+
+        gfx_rect_intersect(&img, &n->bounds, r);
+    } else {
+        r->x = r->y = r->w = r->h = 0;
+    }
+}
+
+static bool scene_occluded(const scene_cull_t *cull, const gfx_rect_t *r)
+{
+    for (uint32_t i = 0; i < cull->occluder_count; i++) {
+        if (gfx_rect_contains(&cull->occluders[i], r)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* Front to back: children from the top, then the node itself */
+static void scene_collect(const gfx_scene_t *scene, gfx_node_id_t id, scene_cull_t *cull)
+{
+    const gfx_node_t *n = &scene->nodes[id];
+    gfx_rect_t r, o;
+
+    if (cull->full || !(n->flags & GFX_NODE_VISIBLE)) {
+        return;
+    }
+    scene_stats.visits++;
+    if (!gfx_rect_intersect(&n->extent, &cull->area, &r)) {
+        return;
+    }
+    if (scene_occluded(cull, &r)) {
+        scene_stats.culled++;                       // The whole subtree
+        return;
+    }
+
+    for (gfx_node_id_t c = n->last; c != GFX_NODE_NONE; c = scene->nodes[c].prev) {
+        scene_collect(scene, c, cull);
+    }
+
+    if (!scene_paints(n) || !gfx_rect_intersect(&n->bounds, &cull->area, &r)) {
+        return;
+    }
+    if (cull->full || scene_occluded(cull, &r)) {
+        scene_stats.culled++;
+        return;
+    }
+    cull->list[cull->count++] = id;
+
+    scene_opaque_area(n, &o);
+    if (gfx_rect_intersect(&o, &cull->area, &o)) {
+        if (scene_rect_equal(&o, &cull->area)) {
+            cull->full = true;
+        } else if (cull->occluder_count < GFX_SCENE_OCCLUDERS) {
+            cull->occluders[cull->occluder_count++] = o;
+        }
+    }
+}
+
+static void scene_draw_node(const gfx_canvas_t *canvas, const gfx_rect_t *area, const gfx_node_t *n)
+{
+    uint32_t fill = n->style.fill;
+    gfx_canvas_t cv = *canvas;
+
+    if (!gfx_rect_intersect(area, &n->bounds, &cv.clip)) {
+        return;
+    }
+
+    if ((fill >> 24) != 0U) {
+        const gfx_fx_corner_t *corner = n->style.corner;
+
+        if (corner != NULL && 2 * corner->radius <= n->bounds.w && 2 * corner->radius <= n->bounds.h) {
+            gfx_fx_round_rect(&cv, &n->bounds, corner, fill);
+        } else if ((fill >> 24) == 0xFFU) {
+            DMA2D_fill_rect_fb(cv.buffer, cv.pitch, (uint16_t)cv.clip.x, (uint16_t)cv.clip.y,
+                               (uint16_t)cv.clip.w, (uint16_t)cv.clip.h,
+                               GFX_RGB565((fill >> 16) & 0xFFU, (fill >> 8) & 0xFFU, fill & 0xFFU));
+        } else {
+            DMA2D_blend_color_start(cv.buffer + ((uint32_t)cv.clip.y * cv.pitch + (uint32_t)cv.clip.x) * 2U, cv.pitch,
+                                    (uint16_t)cv.clip.w, (uint16_t)cv.clip.h, fill);
+            DMA2D_wait();
+        }
+    }
+
+    switch (n->kind) {
+    case GFX_NODE_TEXT:
+        if (n->content.text.font != NULL && n->content.text.str != NULL) {
+            const gfx_font_t *font = n->content.text.font;
+
+            gfx_font_draw(&cv, font, scene_align_x(n, (int32_t)gfx_font_text_width(font, n->content.text.str)),
+                          (int16_t)(n->bounds.y + (n->bounds.h - font->line_height) / 2),
+                          n->content.text.str, n->style.color);
+        }
+        break;
+    case GFX_NODE_IMAGE:
+        if (n->content.image.bundle != NULL && n->content.image.asset != NULL) {
+            const gfx_asset_t *a = n->content.image.asset;
+
+            gfx_asset_draw(&cv, n->content.image.bundle, a, scene_align_x(n, a->width),
+                           (int16_t)(n->bounds.y + (n->bounds.h - a->height) / 2), n->style.color);
+        }
+        break;
+    case GFX_NODE_CUSTOM:
+        if (n->content.custom.draw != NULL) {
+            n->content.custom.draw(&cv, n, n->content.custom.user);
+        }
+        break;
+    default:
+        break;
+    }
+    scene_stats.draws++;
+}
+
+static void scene_flush_rect(const gfx_rect_t *rect, void *user)
+{
+    const scene_flush_t *f = (const scene_flush_t *)user;
+
+    gfx_scene_draw_rect(f->scene, f->canvas, rect);
+}
+
+void gfx_scene_init(gfx_scene_t *scene, const gfx_rect_t *bounds, uint32_t fill)
+{
+    static const gfx_rect_t lcd = { 0, 0, GFX_LCD_WIDTH, GFX_LCD_HEIGHT };
+    gfx_node_t *root = &scene->nodes[GFX_SCENE_ROOT];
+
+    if (bounds == NULL) {
+        bounds = &lcd;
+    }
+    for (uint32_t i = 0; i < GFX_SCENE_NODES_MAX; i++) {
+        scene->nodes[i].flags = 0;
+        scene->nodes[i].next = (i + 1U < GFX_SCENE_NODES_MAX) ? (gfx_node_id_t)(i + 1U) : GFX_NODE_NONE;
+    }
+    scene->free = GFX_SCENE_ROOT + 1;
+    scene->used = 1;
+
+    *root = (gfx_node_t){ 0 };
+    root->bounds = *bounds;
+    root->extent = *bounds;
+    root->x = bounds->x;
+    root->y = bounds->y;
+    root->w = bounds->w;
+    root->h = bounds->h;
+    root->kind = GFX_NODE_GROUP;
+    root->flags = GFX_NODE_VISIBLE | SCENE_NODE_USED;
+    root->dirty = GFX_NODE_DIRTY_LAYOUT;
+    root->parent = root->first = root->last = root->prev = root->next = GFX_NODE_NONE;
+    root->style.fill = fill | 0xFF000000UL;
+    root->style.color = 0xFFFFFFFFUL;
+
+    gfx_dirty_init(&scene->damage, bounds);
+    gfx_dirty_invalidate_all(&scene->damage);
+}
+
+gfx_scene_error_t gfx_scene_add(gfx_scene_t *scene, gfx_node_id_t parent, gfx_node_kind_t kind,
+                                int16_t x, int16_t y, int16_t w, int16_t h, gfx_node_id_t *id)
+{
+    gfx_node_t *p = scene_get(scene, parent);
+    gfx_node_id_t new_id;
+    gfx_node_t *n;
+    uint32_t depth = 1;
+
+    if (p == NULL || kind > GFX_NODE_CUSTOM || w < GFX_SIZE_CONTENT || h < GFX_SIZE_CONTENT) {
+        return GFX_SCENE_ERR_PARAM;
+    }
+    for (const gfx_node_t *a = p; a->parent != GFX_NODE_NONE; a = &scene->nodes[a->parent]) {
+        depth++;
+    }
+    if (depth >= GFX_SCENE_DEPTH_MAX) {
+        return GFX_SCENE_ERR_DEPTH;
+    }
+    if (scene->free == GFX_NODE_NONE) {
+        return GFX_SCENE_ERR_FULL;
+    }
+
+    new_id = scene->free;
+    n = &scene->nodes[new_id];
+    scene->free = n->next;
+    scene->used++;
+
+    *n = (gfx_node_t){ 0 };                         // Empty bounds: the first layout counts as a move
+    n->x = x;
+    n->y = y;
+    n->w = w;
+    n->h = h;
+    n->kind = (uint8_t)kind;
+    n->flags = GFX_NODE_VISIBLE | SCENE_NODE_USED;
+    n->first = n->last = GFX_NODE_NONE;
+    n->style.color = 0xFFFFFFFFUL;
+    scene_link(scene, parent, new_id);
+    scene_mark_layout(scene, p);
+
+    if (id != NULL) {
+        *id = new_id;
+    }
+    return GFX_SCENE_OK;
+}
+
+gfx_scene_error_t gfx_scene_remove(gfx_scene_t *scene, gfx_node_id_t id)
+{
+    gfx_node_t *n = scene_get(scene, id);
+    gfx_node_t *p;
+
+    if (n == NULL || id == GFX_SCENE_ROOT) {
+        return GFX_SCENE_ERR_PARAM;
+    }
+    p = &scene->nodes[n->parent];
+    if (scene_shown(scene, n)) {
+        scene_damage_rect(scene, &n->extent);
+    }
+    scene_unlink(scene, id);
+    scene_free(scene, id);
+    scene_mark_layout(scene, p);
+
+    return GFX_SCENE_OK;
+}
+
+void gfx_scene_set_layout(gfx_scene_t *scene, gfx_node_id_t id, gfx_layout_t layout, uint8_t pad, uint8_t gap)
+{
+    gfx_node_t *n = scene_get(scene, id);
+
+    if (n != NULL && layout <= GFX_LAYOUT_COLUMN) {
+        n->layout = (uint8_t)layout;
+        n->pad = pad;
+        n->gap = gap;
+        scene_mark_layout(scene, n);
+    }
+}
+
+void gfx_scene_set_pos(gfx_scene_t *scene, gfx_node_id_t id, int16_t x, int16_t y)
+{
+    gfx_node_t *n = scene_get(scene, id);
+
+    if (n != NULL && id != GFX_SCENE_ROOT && (n->x != x || n->y != y)) {
+        n->x = x;
+        n->y = y;
+        scene_relayout(scene, n);
+    }
+}
+
+void gfx_scene_set_size(gfx_scene_t *scene, gfx_node_id_t id, int16_t w, int16_t h)
+{
+    gfx_node_t *n = scene_get(scene, id);
+
+    if (n != NULL && id != GFX_SCENE_ROOT && w >= GFX_SIZE_CONTENT && h >= GFX_SIZE_CONTENT &&
+        (n->w != w || n->h != h)) {
+        n->w = w;
+        n->h = h;
+        scene_relayout(scene, n);
+    }
+}
+
+void gfx_scene_set_z(gfx_scene_t *scene, gfx_node_id_t id, int8_t z)
+{
+    gfx_node_t *n = scene_get(scene, id);
+
+    if (n == NULL || id == GFX_SCENE_ROOT || n->z == z) {
+        return;
+    }
+    if (scene_shown(scene, n)) {
+        scene_damage_rect(scene, &n->extent);       // Drawing order changes
+    }
+    scene_unlink(scene, id);
+    n->z = z;
+    scene_link(scene, n->parent, id);
+    scene_relayout(scene, n);                       // Order of a ROW / COLUMN
+}
+
+void gfx_scene_set_visible(gfx_scene_t *scene, gfx_node_id_t id, bool visible)
+{
+    gfx_node_t *n = scene_get(scene, id);
+
+    if (n == NULL || id == GFX_SCENE_ROOT || visible == ((n->flags & GFX_NODE_VISIBLE) != 0)) {
+        return;
+    }
+    if (visible) {
+        n->flags |= GFX_NODE_VISIBLE;
+    } else {
+        if (scene_shown(scene, n)) {
+            scene_damage_rect(scene, &n->extent);
+        }
+        n->flags &= (uint8_t)~GFX_NODE_VISIBLE;
+        n->bounds = n->extent = (gfx_rect_t){ 0, 0, 0, 0 };
+    }
+    scene_relayout(scene, n);
+}
+
+void gfx_scene_set_fill(gfx_scene_t *scene, gfx_node_id_t id, uint32_t argb)
+{
+    gfx_node_t *n = scene_get(scene, id);
+
+    if (n != NULL && n->style.fill != argb) {
+        n->style.fill = (id == GFX_SCENE_ROOT) ? (argb | 0xFF000000UL) : argb;
+        scene_damage_node(scene, n);
+    }
+}
+
+void gfx_scene_set_color(gfx_scene_t *scene, gfx_node_id_t id, uint32_t argb)
+{
+    gfx_node_t *n = scene_get(scene, id);
+
+    if (n != NULL && n->style.color != argb) {
+        n->style.color = argb;
+        scene_damage_node(scene, n);
+    }
+}
+
+void gfx_scene_set_corner(gfx_scene_t *scene, gfx_node_id_t id, const gfx_fx_corner_t *corner)
+{
+    gfx_node_t *n = scene_get(scene, id);
+
+    if (n != NULL && n->style.corner != corner && (corner == NULL || !corner->outside)) {
+        n->style.corner = corner;
+        scene_damage_node(scene, n);
+    }
+}
+
+void gfx_scene_set_align(gfx_scene_t *scene, gfx_node_id_t id, gfx_align_t align)
+{
+    gfx_node_t *n = scene_get(scene, id);
+
+    if (n != NULL && align <= GFX_ALIGN_RIGHT && n->style.align != align) {
+        n->style.align = (uint8_t)align;
+        scene_damage_node(scene, n);
+    }
+}
+
+/* New content: redraw, and place again if the size follows it */
+static void scene_content_changed(gfx_scene_t *scene, gfx_node_t *n)
+{
+    scene_damage_node(scene, n);
+    if (n->w == GFX_SIZE_CONTENT || n->h == GFX_SIZE_CONTENT) {
+        scene_relayout(scene, n);
+    }
+}
+
+void gfx_scene_set_text(gfx_scene_t *scene, gfx_node_id_t id, const gfx_font_t *font, const char *str)
+{
+    gfx_node_t *n = scene_get(scene, id);
+
+    if (n != NULL && n->kind == GFX_NODE_TEXT) {
+        n->content.text.font = font;
+        n->content.text.str = str;
+        scene_content_changed(scene, n);
+    }
+}
+
+void gfx_scene_set_image(gfx_scene_t *scene, gfx_node_id_t id, const gfx_bundle_t *bundle, const gfx_asset_t *asset)
+{
+    gfx_node_t *n = scene_get(scene, id);
+
+    if (n != NULL && n->kind == GFX_NODE_IMAGE) {
+        n->content.image.bundle = bundle;
+        n->content.image.asset = asset;
+        scene_content_changed(scene, n);
+    }
+}
+
+void gfx_scene_set_custom(gfx_scene_t *scene, gfx_node_id_t id, gfx_node_draw_cb draw, void *user)
+{
+    gfx_node_t *n = scene_get(scene, id);
+
+    if (n != NULL && n->kind == GFX_NODE_CUSTOM) {
+        n->content.custom.draw = draw;
+        n->content.custom.user = user;
+        scene_damage_node(scene, n);
+    }
+}
+
+void gfx_scene_invalidate(gfx_scene_t *scene, gfx_node_id_t id)
+{
+    gfx_node_t *n = scene_get(scene, id);
+
+    if (n != NULL) {
+        scene_damage_node(scene, n);
+    }
+}
+
+void gfx_scene_damage(gfx_scene_t *scene, const gfx_rect_t *rect)
+{
+    if (scene != NULL && rect != NULL) {
+        scene_damage_rect(scene, rect);
+    }
+}
+
+void gfx_scene_update(gfx_scene_t *scene)
+{
+    gfx_node_t *root = &scene->nodes[GFX_SCENE_ROOT];
+
+    if (root->dirty) {
+        scene_layout(scene, root, false, false);
+    }
+}
+
+uint16_t gfx_scene_render(gfx_scene_t *scene, const gfx_canvas_t *canvas)
+{
+    scene_flush_t f = { scene, canvas };
+
+    gfx_scene_update(scene);
+    scene_stats.frames++;
+    return gfx_dirty_flush(&scene->damage, scene_flush_rect, &f);
+}
+
+void gfx_scene_draw_rect(gfx_scene_t *scene, const gfx_canvas_t *canvas, const gfx_rect_t *rect)
+{
+    static scene_cull_t cull;                       // Too large for the stack of a small task
+
+    if (!gfx_rect_intersect(rect, &canvas->clip, &cull.area)) {
+        return;
+    }
+    cull.occluder_count = 0;
+    cull.full = false;
+    cull.count = 0;
+    scene_collect(scene, GFX_SCENE_ROOT, &cull);
+
+    for (uint32_t i = cull.count; i-- > 0;) {
+        scene_draw_node(canvas, &cull.area, &scene->nodes[cull.list[i]]);
+    }
+    scene_stats.rects++;
+    scene_stats.pixels += gfx_rect_area(&cull.area);
+}
+
+const gfx_scene_stats_t *gfx_scene_get_stats(void)
+{
+    return &scene_stats;
+}
+
+void gfx_scene_reset_stats(void)
+{
+    scene_stats = (gfx_scene_stats_t){ 0 };
+}
@@ -0,0 +1,230 @@
+/**
+ * @file gfx_scene.h
+ * @brief Retained scene graph: node pool, incremental layout and damage based redraw
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note A scene is a tree of nodes taken from a fixed pool inside
+ *       gfx_scene_t, no heap. Node 0 is the root and covers the scene
+ *       bounds. Setters only record what changed:
+ *       - size, position, layout, visibility and content size changes mark
+ *         the parent for layout and its ancestors as having a dirty child;
+ *       - colour or content changes of the same size add the node bounds to
+ *         the damage list (a gfx_dirty_t).
+ *
+ *       gfx_scene_update() lays out only the marked subtrees: a node whose
+ *       bounds did not change is not entered unless one of its descendants
+ *       is marked, and a node that moved adds its old and new extent (its
+ *       bounds and those of all descendants) to the damage list.
+ *
+ *       gfx_scene_render() redraws each damaged rectangle. The tree is
+ *       walked front to back, skipping subtrees whose extent misses the
+ *       rectangle. Opaque nodes become occluders: nodes behind one are
+ *       culled, and the walk ends once one covers the whole rectangle. The
+ *       remaining nodes are drawn back to front, clipped to the rectangle
+ *       and to their own bounds. So per frame work follows the damaged area
+ *       and the nodes touching it, not the scene size.
+ *
+ *       Siblings are kept in z order (equal z: order of adding). ROW and
+ *       COLUMN containers place their children in that order.
+ */
+
+#ifndef __GFX_SCENE_H__
+#define __GFX_SCENE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gfx_types.h"
+#include "gfx_dirty.h"
+#include "gfx_effect.h"
+#include "gfx_font.h"
+#include "gfx_asset.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GFX_SCENE_NODES_MAX             128         // Pool size, including the root
+#define GFX_SCENE_DEPTH_MAX             12          // Tree depth, bounds the recursion of the layout pass
+#define GFX_SCENE_OCCLUDERS             8           // Opaque areas remembered per damaged rectangle
+
+#define GFX_SCENE_ROOT                  0
+#define GFX_NODE_NONE                   0xFF
+
+/* Node size, pixels or one of these */
+#define GFX_SIZE_FILL                   (-1)        // Rest of the parent content box (shared in a ROW / COLUMN)
+#define GFX_SIZE_CONTENT                (-2)        // Text or image size
+
+/* Node flags */
+#define GFX_NODE_VISIBLE                0x01
+
+/* Dirty flags, see gfx_scene_update() */
+#define GFX_NODE_DIRTY_LAYOUT           0x01        // Children must be placed again
+#define GFX_NODE_DIRTY_CHILD            0x02        // A descendant has GFX_NODE_DIRTY_LAYOUT
+
+typedef uint8_t gfx_node_id_t;
+
+typedef enum {
+    GFX_NODE_GROUP = 0,                             // Container, only the fill is drawn
+    GFX_NODE_TEXT,
+    GFX_NODE_IMAGE,
+    GFX_NODE_CUSTOM,
+} gfx_node_kind_t;
+
+typedef enum {
+    GFX_LAYOUT_ABSOLUTE = 0,                        // Children at their x, y in the content box
+    GFX_LAYOUT_ROW,                                 // Left to right, y is the offset from the top
+    GFX_LAYOUT_COLUMN,                              // Top to bottom, x is the offset from the left
+} gfx_layout_t;
+
+typedef enum {
+    GFX_ALIGN_LEFT = 0,                             // Text and images, vertically always centred
+    GFX_ALIGN_CENTER,
+    GFX_ALIGN_RIGHT,
+} gfx_align_t;
+
+typedef enum {
+    GFX_SCENE_OK = 0,
+    GFX_SCENE_ERR_PARAM,
+    GFX_SCENE_ERR_FULL,                             // Pool exhausted
+    GFX_SCENE_ERR_DEPTH,                            // Deeper than GFX_SCENE_DEPTH_MAX
+} gfx_scene_error_t;
+
+struct gfx_node;
+typedef void (*gfx_node_draw_cb)(const gfx_canvas_t *canvas, const struct gfx_node *node, void *user);
+
+typedef struct {
+    uint32_t    fill;                               // Background ARGB8888, alpha 0: none, 255: opaque
+    uint32_t    color;                              // Text / A8 colour, alpha fades the content
+    const gfx_fx_corner_t *corner;                  // Rounded background (inside mask), NULL: square
+    uint8_t     align;                              // gfx_align_t
+} gfx_style_t;
+
+typedef struct gfx_node {
+    gfx_rect_t  bounds;                             // Screen area, set by the layout
+    gfx_rect_t  extent;                             // bounds and the extent of all visible children
+    int16_t     x;                                  // Offset in the parent content box
+    int16_t     y;
+    int16_t     w;                                  // Pixels, GFX_SIZE_FILL or GFX_SIZE_CONTENT
+    int16_t     h;
+    uint8_t     kind;                               // gfx_node_kind_t
+    uint8_t     layout;                             // gfx_layout_t of the children
+    uint8_t     pad;                                // Content box inset
+    uint8_t     gap;                                // Between ROW / COLUMN children
+    int8_t      z;
+    uint8_t     flags;
+    uint8_t     dirty;
+    gfx_node_id_t parent;
+    gfx_node_id_t first;                            // Children, bottom to top
+    gfx_node_id_t last;
+    gfx_node_id_t prev;                             // Siblings, next is also the free list link
+    gfx_node_id_t next;
+    gfx_style_t style;
+    union {
+        struct {
+            const gfx_font_t *font;
+            const char *str;                        // Not copied, must stay valid
+        } text;
+        struct {
+            const gfx_bundle_t *bundle;
+            const gfx_asset_t *asset;
+        } image;
+        struct {
+            gfx_node_draw_cb draw;
+            void *user;
+        } custom;
+    } content;
+} gfx_node_t;
+
+typedef struct {
+    gfx_node_t  nodes[GFX_SCENE_NODES_MAX];
+    gfx_node_id_t free;                             // Free list head
+    uint8_t     used;
+    gfx_dirty_t damage;
+} gfx_scene_t;
+
+typedef struct {
+    uint32_t    frames;                             // gfx_scene_render() calls
+    uint32_t    layouts;                            // Nodes placed by the layout pass
+    uint32_t    visits;                             // Nodes tested against a damaged rectangle
+    uint32_t    draws;                              // Nodes drawn
+    uint32_t    culled;                             // Nodes hidden by an opaque node in front
+    uint32_t    rects;                              // Damaged rectangles redrawn
+    uint32_t    pixels;                             // Their area
+} gfx_scene_stats_t;
+
+/**
+ * @brief Empty scene, the root is a GROUP covering bounds with an opaque fill
+ * @param bounds scene area, NULL for the whole LCD
+ */
+void gfx_scene_init(gfx_scene_t *scene, const gfx_rect_t *bounds, uint32_t fill);
+
+/**
+ * @brief Take a node from the pool and append it to parent (top of its z)
+ * @param w, h pixels, GFX_SIZE_FILL or GFX_SIZE_CONTENT
+ * @note  The style starts transparent with a white colour, left aligned.
+ */
+gfx_scene_error_t gfx_scene_add(gfx_scene_t *scene, gfx_node_id_t parent, gfx_node_kind_t kind,
+                                int16_t x, int16_t y, int16_t w, int16_t h, gfx_node_id_t *id);
+
+/**
+ * @brief Return a node and its subtree to the pool
+ */
+gfx_scene_error_t gfx_scene_remove(gfx_scene_t *scene, gfx_node_id_t id);
+
+/* Layout */
+void gfx_scene_set_layout(gfx_scene_t *scene, gfx_node_id_t id, gfx_layout_t layout, uint8_t pad, uint8_t gap);
+void gfx_scene_set_pos(gfx_scene_t *scene, gfx_node_id_t id, int16_t x, int16_t y);
+void gfx_scene_set_size(gfx_scene_t *scene, gfx_node_id_t id, int16_t w, int16_t h);
+void gfx_scene_set_z(gfx_scene_t *scene, gfx_node_id_t id, int8_t z);
+void gfx_scene_set_visible(gfx_scene_t *scene, gfx_node_id_t id, bool visible);
+
+/* Style and content */
+void gfx_scene_set_fill(gfx_scene_t *scene, gfx_node_id_t id, uint32_t argb);
+void gfx_scene_set_color(gfx_scene_t *scene, gfx_node_id_t id, uint32_t argb);
+void gfx_scene_set_corner(gfx_scene_t *scene, gfx_node_id_t id, const gfx_fx_corner_t *corner);
+void gfx_scene_set_align(gfx_scene_t *scene, gfx_node_id_t id, gfx_align_t align);
+void gfx_scene_set_text(gfx_scene_t *scene, gfx_node_id_t id, const gfx_font_t *font, const char *str);
+void gfx_scene_set_image(gfx_scene_t *scene, gfx_node_id_t id, const gfx_bundle_t *bundle, const gfx_asset_t *asset);
+void gfx_scene_set_custom(gfx_scene_t *scene, gfx_node_id_t id, gfx_node_draw_cb draw, void *user);
+
+/**
+ * @brief Redraw a node at the next render, e.g. a CUSTOM node whose drawing changed
+ */
+void gfx_scene_invalidate(gfx_scene_t *scene, gfx_node_id_t id);
+
+/**
+ * @brief Redraw an area at the next render, e.g. after drawing over the scene
+ */
+void gfx_scene_damage(gfx_scene_t *scene, const gfx_rect_t *rect);
+
+static inline const gfx_node_t *gfx_scene_node(const gfx_scene_t *scene, gfx_node_id_t id) {
+    return (id < GFX_SCENE_NODES_MAX) ? &scene->nodes[id] : NULL;
+}
+
+/**
+ * @brief Lay out the marked subtrees, the damage they cause is added to scene->damage
+ */
+void gfx_scene_update(gfx_scene_t *scene);
+
+/**
+ * @brief gfx_scene_update(), then redraw and clear every damaged rectangle
+ * @return number of rectangles drawn
+ * @note  Copy scene->damage after gfx_scene_update() first when the areas
+ *        are needed afterwards, e.g. to sync a double buffer.
+ */
+uint16_t gfx_scene_render(gfx_scene_t *scene, const gfx_canvas_t *canvas);
+
+/**
+ * @brief Draw one area of the laid out scene, whether damaged or not
+ */
+void gfx_scene_draw_rect(gfx_scene_t *scene, const gfx_canvas_t *canvas, const gfx_rect_t *rect);
+
+const gfx_scene_stats_t *gfx_scene_get_stats(void);
+void gfx_scene_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __GFX_SCENE_H__ */
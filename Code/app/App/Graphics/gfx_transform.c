@@ -0,0 +1,363 @@
+/**
+ * @file gfx_transform.c
+ * @brief Affine transform blitter (rotate / scale) for RGB565 and ARGB8888 images, 16.16 fixed point
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#include <stddef.h>
+#include "main.h"
+#include "dma2d.h"
+#include "gfx_math.h"
+#include "gfx_transform.h"
+
+#define XF_ONE                          65536
+#define XF_HALF                         32768
+#define XF_TILE_PIXELS                  (GFX_XFORM_TILE * GFX_XFORM_TILE)
+
+typedef struct {
+    const gfx_xform_src_t *src;
+    int32_t     du_dx, dv_dx;                       // Image step per canvas pixel, 16.16
+    int32_t     du_dy, dv_dy;
+    int64_t     u0, v0;                             // Image position of the centre of canvas pixel (0, 0)
+    int32_t     lo_u, hi_u;                         // Inclusive range of u / v that produces a sample
+    int32_t     lo_v, hi_v;
+    bool        bilinear;
+} xf_job_t;
+
+__attribute__((section(".sram_noncache_bss"))) static uint32_t xf_tile[2][XF_TILE_PIXELS];    // Read by DMA2D
+static gfx_xform_stats_t xf_stats;
+
+/* ---------------------------------------------------------------- pixels --- */
+
+static inline uint32_t xf_rgb565_to_argb(uint32_t p)
+{
+    uint32_t r = (p >> 11) & 0x1FU;
+    uint32_t g = (p >> 5) & 0x3FU;
+    uint32_t b = p & 0x1FU;
+
+    return 0xFF000000U | (((r << 3) | (r >> 2)) << 16) | (((g << 2) | (g >> 4)) << 8) | ((b << 3) | (b >> 2));
+}
+
+static inline uint32_t xf_pixel(const gfx_xform_src_t *src, int32_t x, int32_t y)
+{
+    uint32_t i = (uint32_t)y * src->pitch + (uint32_t)x;
+
+    if (src->format == GFX_XFORM_RGB565) {
+        return xf_rgb565_to_argb(((const uint16_t *)src->addr)[i]);
+    }
+    return ((const uint32_t *)src->addr)[i];
+}
+
+/* Border tap of the bilinear filter: outside the image it is the nearest
+ * edge pixel made transparent, so edges fade out without a dark fringe */
+static inline uint32_t xf_tap(const gfx_xform_src_t *src, int32_t x, int32_t y)
+{
+    bool inside = (x >= 0) && (y >= 0) && (x < (int32_t)src->width) && (y < (int32_t)src->height);
+    uint32_t p;
+
+    x = (x < 0) ? 0 : ((x >= (int32_t)src->width) ? (int32_t)src->width - 1 : x);
+    y = (y < 0) ? 0 : ((y >= (int32_t)src->height) ? (int32_t)src->height - 1 : y);
+    p = xf_pixel(src, x, y);
+    return inside ? p : (p & 0x00FFFFFFU);
+}
+
+/* a + (b - a) * f / 256 on all four channels, two at a time */
+static inline uint32_t xf_lerp(uint32_t a, uint32_t b, uint32_t f)
+{
+    uint32_t rb = ((a & 0x00FF00FFU) * (256U - f) + (b & 0x00FF00FFU) * f) >> 8;
+    uint32_t ag = ((a >> 8) & 0x00FF00FFU) * (256U - f) + ((b >> 8) & 0x00FF00FFU) * f;
+
+    return (rb & 0x00FF00FFU) | (ag & 0xFF00FF00U);
+}
+
+/* --------------------------------------------------------------- samplers --- */
+
+static void xf_row_nearest(const gfx_xform_src_t *src, uint32_t *out, int32_t n,
+                           int32_t u, int32_t v, int32_t du, int32_t dv)
+{
+    if (src->format == GFX_XFORM_RGB565) {
+        const uint16_t *s = (const uint16_t *)src->addr;
+
+        while (n-- > 0) {
+            *out++ = xf_rgb565_to_argb(s[(uint32_t)(v >> 16) * src->pitch + (uint32_t)(u >> 16)]);
+            u += du;
+            v += dv;
+        }
+    } else {
+        const uint32_t *s = (const uint32_t *)src->addr;
+
+        while (n-- > 0) {
+            *out++ = s[(uint32_t)(v >> 16) * src->pitch + (uint32_t)(u >> 16)];
+            u += du;
+            v += dv;
+        }
+    }
+}
+
+static void xf_row_bilinear(const gfx_xform_src_t *src, uint32_t *out, int32_t n,
+                            int32_t u, int32_t v, int32_t du, int32_t dv)
+{
+    uint32_t max_u = ((uint32_t)src->width - 1U) << 16;     // Both taps inside below these
+    uint32_t max_v = ((uint32_t)src->height - 1U) << 16;
+
+    /* Taps are at the pixel centres around the sample point */
+    u -= XF_HALF;
+    v -= XF_HALF;
+    while (n-- > 0) {
+        int32_t x = u >> 16;
+        int32_t y = v >> 16;
+        uint32_t fx = ((uint32_t)u >> 8) & 0xFFU;
+        uint32_t fy = ((uint32_t)v >> 8) & 0xFFU;
+        uint32_t p00, p01, p10, p11;
+
+        if ((uint32_t)u < max_u && (uint32_t)v < max_v) {
+            p00 = xf_pixel(src, x, y);
+            p01 = xf_pixel(src, x + 1, y);
+            p10 = xf_pixel(src, x, y + 1);
+            p11 = xf_pixel(src, x + 1, y + 1);
+        } else {
+            p00 = xf_tap(src, x, y);
+            p01 = xf_tap(src, x + 1, y);
+            p10 = xf_tap(src, x, y + 1);
+            p11 = xf_tap(src, x + 1, y + 1);
+        }
+        *out++ = xf_lerp(xf_lerp(p00, p01, fx), xf_lerp(p10, p11, fx), fy);
+        u += du;
+        v += dv;
+    }
+}
+
+/* ------------------------------------------------------------------ spans --- */
+
+static inline int64_t xf_div_floor(int64_t a, int64_t b)
+{
+    int64_t q = a / b;
+
+    return ((a % b != 0) && ((a < 0) != (b < 0))) ? q - 1 : q;
+}
+
+static inline int64_t xf_div_ceil(int64_t a, int64_t b)
+{
+    return -xf_div_floor(-a, b);
+}
+
+/* Narrow [*x0, *x1) to the x with lo <= p + x * dp <= hi */
+static void xf_span(int64_t p, int32_t dp, int32_t lo, int32_t hi, int32_t *x0, int32_t *x1)
+{
+    int64_t a, b;
+
+    if (dp == 0) {
+        if (p < lo || p > hi) {
+            *x1 = *x0;
+        }
+        return;
+    }
+    if (dp > 0) {
+        a = xf_div_ceil((int64_t)lo - p, dp);
+        b = xf_div_floor((int64_t)hi - p, dp) + 1;
+    } else {
+        a = xf_div_ceil((int64_t)hi - p, dp);
+        b = xf_div_floor((int64_t)lo - p, dp) + 1;
+    }
+    if (a > *x0) {
+        *x0 = (int32_t)((a < *x1) ? a : *x1);
+    }
+    if (b < *x1) {
+        *x1 = (int32_t)((b > *x0) ? b : *x0);
+    }
+}
+
+/* Sample one tile into buf, the rows and columns without image pixels are
+ * cut off. Returns false if the tile misses the image. */
+static bool xf_tile_fill(const xf_job_t *j, int32_t tx, int32_t ty, int32_t tw, int32_t th,
+                         uint32_t *buf, gfx_rect_t *out)
+{
+    int16_t s0[GFX_XFORM_TILE], s1[GFX_XFORM_TILE];
+    int32_t jx0 = tw, jx1 = 0, jy0 = -1, jy1 = 0;
+    uint32_t *p;
+
+    for (int32_t r = 0; r < th; r++) {
+        int64_t u = j->u0 + (int64_t)(ty + r) * j->du_dy + (int64_t)tx * j->du_dx;
+        int64_t v = j->v0 + (int64_t)(ty + r) * j->dv_dy + (int64_t)tx * j->dv_dx;
+        int32_t x0 = 0, x1 = tw;
+
+        xf_span(u, j->du_dx, j->lo_u, j->hi_u, &x0, &x1);
+        xf_span(v, j->dv_dx, j->lo_v, j->hi_v, &x0, &x1);
+        s0[r] = (int16_t)x0;
+        s1[r] = (int16_t)x1;
+        if (x0 < x1) {
+            jx0 = (x0 < jx0) ? x0 : jx0;
+            jx1 = (x1 > jx1) ? x1 : jx1;
+            jy0 = (jy0 < 0) ? r : jy0;
+            jy1 = r + 1;
+        }
+    }
+    if (jy0 < 0) {
+        return false;
+    }
+
+    p = buf;
+    for (int32_t r = jy0; r < jy1; r++) {
+        int32_t x0 = (s0[r] < s1[r]) ? s0[r] : jx1;     // Empty rows are all transparent
+        int32_t x1 = (s0[r] < s1[r]) ? s1[r] : jx1;
+        int32_t n = x1 - x0;
+
+        for (int32_t x = jx0; x < x0; x++) {
+            *p++ = 0;
+        }
+        if (n > 0) {
+            int32_t u = (int32_t)(j->u0 + (int64_t)(ty + r) * j->du_dy + (int64_t)(tx + x0) * j->du_dx);
+            int32_t v = (int32_t)(j->v0 + (int64_t)(ty + r) * j->dv_dy + (int64_t)(tx + x0) * j->dv_dx);
+
+            if (j->bilinear) {
+                xf_row_bilinear(j->src, p, n, u, v, j->du_dx, j->dv_dx);
+                xf_stats.bilinear += (uint32_t)n;
+            } else {
+                xf_row_nearest(j->src, p, n, u, v, j->du_dx, j->dv_dx);
+            }
+            p += n;
+            xf_stats.pixels += (uint32_t)n;
+        }
+        for (int32_t x = x1; x < jx1; x++) {
+            *p++ = 0;
+        }
+    }
+
+    out->x = (int16_t)(tx + jx0);
+    out->y = (int16_t)(ty + jy0);
+    out->w = (int16_t)(jx1 - jx0);
+    out->h = (int16_t)(jy1 - jy0);
+    return true;
+}
+
+/* ------------------------------------------------------------------- api --- */
+
+void gfx_xform_rotate_scale(gfx_xform_matrix_t *m, float px, float py, float x, float y, float angle, float scale)
+{
+    float s, c;
+
+    gfx_sincosf(angle, &s, &c);
+    m->a = scale * c;
+    m->b = -scale * s;
+    m->c = scale * s;
+    m->d = scale * c;
+    m->tx = x - (m->a * px + m->b * py);
+    m->ty = y - (m->c * px + m->d * py);
+}
+
+static inline int32_t xf_fixed(float f)
+{
+    return (int32_t)gfx_floorf(f * (float)XF_ONE + 0.5f);
+}
+
+gfx_xform_error_t gfx_xform_draw(const gfx_canvas_t *canvas, const gfx_xform_src_t *src,
+                                 const gfx_xform_matrix_t *m, gfx_xform_filter_t filter, uint8_t alpha)
+{
+    const float cx[4] = { 0.0f, 1.0f, 0.0f, 1.0f };
+    const float cy[4] = { 0.0f, 0.0f, 1.0f, 1.0f };
+    float det, ia, ib, ic, id, min_x, min_y, max_x, max_y, pad;
+    gfx_rect_t box, area, job;
+    xf_job_t j;
+    uint32_t buf = 0;
+
+    if (canvas == NULL || src == NULL || m == NULL || src->addr == 0U || src->width == 0U ||
+        src->height == 0U || src->pitch < src->width || src->format > GFX_XFORM_ARGB8888) {
+        return GFX_XFORM_ERR_PARAM;
+    }
+    det = m->a * m->d - m->b * m->c;
+    if (gfx_absf(det) < 1e-12f) {
+        return GFX_XFORM_ERR_PARAM;
+    }
+    ia = m->d / det;
+    ib = -m->b / det;
+    ic = -m->c / det;
+    id = m->a / det;
+    if (gfx_maxf(gfx_maxf(gfx_absf(ia), gfx_absf(ib)), gfx_maxf(gfx_absf(ic), gfx_absf(id))) >= 32768.0f) {
+        return GFX_XFORM_ERR_PARAM;
+    }
+    xf_stats.draws++;
+    if (alpha == 0) {
+        return GFX_XFORM_OK;
+    }
+
+    /* Bounding box of the image corners, bilinear edges spill half a pixel */
+    min_x = min_y = 1e9f;
+    max_x = max_y = -1e9f;
+    for (uint32_t i = 0; i < 4U; i++) {
+        float sx = cx[i] * (float)src->width;
+        float sy = cy[i] * (float)src->height;
+        float x = m->a * sx + m->b * sy + m->tx;
+        float y = m->c * sx + m->d * sy + m->ty;
+
+        min_x = gfx_minf(min_x, x);
+        max_x = gfx_maxf(max_x, x);
+        min_y = gfx_minf(min_y, y);
+        max_y = gfx_maxf(max_y, y);
+    }
+    pad = (filter == GFX_XFORM_BILINEAR) ? 1.0f : 0.0f;
+    box.x = (int16_t)gfx_floorf(gfx_maxf(min_x - pad, -16384.0f));
+    box.y = (int16_t)gfx_floorf(gfx_maxf(min_y - pad, -16384.0f));
+    box.w = (int16_t)(gfx_ceilf(gfx_minf(max_x + pad, 16383.0f)) - (float)box.x);
+    box.h = (int16_t)(gfx_ceilf(gfx_minf(max_y + pad, 16383.0f)) - (float)box.y);
+    if (!gfx_rect_intersect(&box, &canvas->clip, &area)) {
+        return GFX_XFORM_OK;
+    }
+
+    /* Image position of the centre of canvas pixel (0, 0), the rest is stepped */
+    j.src = src;
+    j.du_dx = xf_fixed(ia);
+    j.du_dy = xf_fixed(ib);
+    j.dv_dx = xf_fixed(ic);
+    j.dv_dy = xf_fixed(id);
+    j.u0 = (int64_t)xf_fixed(ia * (0.5f - m->tx) + ib * (0.5f - m->ty));
+    j.v0 = (int64_t)xf_fixed(ic * (0.5f - m->tx) + id * (0.5f - m->ty));
+    j.bilinear = (filter == GFX_XFORM_BILINEAR);
+    if (j.bilinear) {
+        /* Any sample with a tap inside the image, (-1, w) after the half pixel shift */
+        j.lo_u = -XF_HALF + 1;
+        j.hi_u = ((int32_t)src->width << 16) + XF_HALF - 1;
+        j.lo_v = -XF_HALF + 1;
+        j.hi_v = ((int32_t)src->height << 16) + XF_HALF - 1;
+    } else {
+        j.lo_u = 0;
+        j.hi_u = ((int32_t)src->width << 16) - 1;
+        j.lo_v = 0;
+        j.hi_v = ((int32_t)src->height << 16) - 1;
+    }
+
+    for (int32_t ty = area.y; ty < area.y + area.h; ty += GFX_XFORM_TILE) {
+        int32_t th = area.y + area.h - ty;
+
+        th = (th > GFX_XFORM_TILE) ? GFX_XFORM_TILE : th;
+        for (int32_t tx = area.x; tx < area.x + area.w; tx += GFX_XFORM_TILE) {
+            int32_t tw = area.x + area.w - tx;
+
+            tw = (tw > GFX_XFORM_TILE) ? GFX_XFORM_TILE : tw;
+
+            /* The other tile may still be blending, this one finished before it was started */
+            if (xf_tile_fill(&j, tx, ty, tw, th, xf_tile[buf], &job)) {
+                DMA2D_blend_rect_start((uint32_t)xf_tile[buf], (uint16_t)job.w, DMA2D_INPUT_ARGB8888, alpha,
+                                       canvas->buffer + ((uint32_t)job.y * canvas->pitch + (uint32_t)job.x) * 2U,
+                                       canvas->pitch, (uint16_t)job.w, (uint16_t)job.h);
+                xf_stats.tiles++;
+                xf_stats.jobs++;
+                buf ^= 1U;
+            }
+        }
+    }
+    DMA2D_wait();
+
+    return GFX_XFORM_OK;
+}
+
+const gfx_xform_stats_t *gfx_xform_get_stats(void)
+{
+    return &xf_stats;
+}
+
+void gfx_xform_reset_stats(void)
+{
+    xf_stats = (gfx_xform_stats_t){ 0 };
+}
@@ -0,0 +1,98 @@
+/**
+ * @file gfx_transform.h
+ * @brief Affine transform blitter (rotate / scale) for RGB565 and ARGB8888 images, 16.16 fixed point
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note DMA2D can only copy and blend axis aligned blocks, so rotated and
+ *       scaled images are resampled by the CPU. The destination bounding
+ *       box (clipped to the canvas, i.e. the PFB tile) is walked in
+ *       GFX_XFORM_TILE x GFX_XFORM_TILE tiles: the source footprint of one
+ *       tile is a small parallelogram, so reads from RO_DATA (XIP) or SRAM
+ *       stay within a few cache lines per row instead of sweeping diagonally
+ *       through the whole image as a scanline walk does.
+ *
+ *       Every destination pixel is inverse mapped once per row, then stepped
+ *       with 16.16 increments. The span of a row that lands inside the image
+ *       is solved exactly in integers, so the inner loops have no bounds
+ *       checks (bilinear only checks the one pixel wide border). Samples are
+ *       written as ARGB8888 to one of two tile buffers and DMA2D blends the
+ *       tile onto the canvas while the CPU samples the next one. Pixels
+ *       outside the image are transparent, bilinear edges are anti-aliased.
+ */
+
+#ifndef __GFX_TRANSFORM_H__
+#define __GFX_TRANSFORM_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gfx_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GFX_XFORM_TILE                  32          // Destination tile size, two ARGB8888 tiles in RAM_NOCACHE (8 KB)
+
+typedef enum {
+    GFX_XFORM_RGB565 = 0,
+    GFX_XFORM_ARGB8888,                             // Straight (not premultiplied) alpha
+} gfx_xform_format_t;
+
+typedef enum {
+    GFX_XFORM_NEAREST = 0,
+    GFX_XFORM_BILINEAR,
+} gfx_xform_filter_t;
+
+typedef enum {
+    GFX_XFORM_OK = 0,
+    GFX_XFORM_ERR_PARAM,                            // Bad image, or the matrix is singular / scales below 1/32768
+} gfx_xform_error_t;
+
+typedef struct {
+    uint32_t    addr;                               // Pixel (0, 0), RO_DATA or RAM
+    uint16_t    pitch;                              // Line length in pixels
+    uint16_t    width;
+    uint16_t    height;
+    uint8_t     format;                             // gfx_xform_format_t
+    uint8_t     reserved;
+} gfx_xform_src_t;
+
+/* Image to canvas mapping, x' = a * x + b * y + tx, y' = c * x + d * y + ty.
+ * Pixel (i, j) of the image covers [i, i + 1) x [j, j + 1). */
+typedef struct {
+    float a, b, c, d;
+    float tx, ty;
+} gfx_xform_matrix_t;
+
+typedef struct {
+    uint32_t    draws;
+    uint32_t    tiles;                              // Tiles that had at least one image pixel
+    uint32_t    jobs;                               // DMA2D blends
+    uint32_t    pixels;                             // Samples taken
+    uint32_t    bilinear;                           // Of them, filtered from four texels
+} gfx_xform_stats_t;
+
+/**
+ * @brief Rotation about a pivot of the image, then uniform scaling
+ * @param px, py pivot in image pixels, e.g. the hub of a gauge needle
+ * @param x, y   canvas position of the pivot
+ * @param angle  radians, clockwise on the screen
+ */
+void gfx_xform_rotate_scale(gfx_xform_matrix_t *m, float px, float py, float x, float y, float angle, float scale);
+
+/**
+ * @brief Draw a transformed image, clipped to the canvas
+ * @param alpha global opacity, multiplied with the image alpha
+ */
+gfx_xform_error_t gfx_xform_draw(const gfx_canvas_t *canvas, const gfx_xform_src_t *src,
+                                 const gfx_xform_matrix_t *m, gfx_xform_filter_t filter, uint8_t alpha);
+
+const gfx_xform_stats_t *gfx_xform_get_stats(void);
+void gfx_xform_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __GFX_TRANSFORM_H__ */
@@ -0,0 +1,473 @@
+/**
+ * @file gfx_tri.c
+ * @brief Textured triangle rasteriser (affine or perspective correct) for 2.5D effects, tile binned
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note Edge function E(P) = dx * (Py - Ya) - dy * (Px - Xa) of the edge A -> B,
+ *       in 1/16 pixel, positive inside once the triangle is wound that way.
+ *       Inside the clip |E| stays below 2^31 thanks to GFX_TRI_COORD_MAX;
+ *       the value at pixel (0, 0) does not, it is kept in 64 bits and every
+ *       row starts from a 64 bit evaluation.
+ */
+
+#include <stddef.h>
+#include "main.h"
+#include "dma2d.h"
+#include "gfx_math.h"
+#include "gfx_tri.h"
+
+#define TRI_SUB                         (1 << GFX_TRI_SUBPIXEL)
+#define TRI_HALF                        (TRI_SUB / 2)
+#define TRI_BINS                        (GFX_TRI_BINS_X * GFX_TRI_BINS_Y)
+#define TRI_FIX_MAX                     134217728.0f        // 2^27, texture coordinates in 16.16 stay below
+
+typedef struct {
+    const gfx_tri_tex_t *tex;
+    int32_t     a[3], b[3];                         // Edge function step per pixel in x / y
+    int64_t     c[3];                               // Edge function at pixel (0, 0), top-left bias included
+    float       p[3][3];                            // u, v (affine) or u/w, v/w, 1/w: value at pixel (0, 0), per x, per y
+    gfx_rect_t  box;                                // Pixels that may be covered, inside the clip
+    uint8_t     mapping;
+} tri_t;
+
+static tri_t tri_list[GFX_TRI_MAX];
+static uint64_t tri_bins[TRI_BINS];                 // Bit i: triangle i touches the tile
+static uint32_t tri_count = 0;
+static gfx_canvas_t tri_canvas;
+static bool tri_open = false;
+static gfx_tri_stats_t tri_stats;
+
+/* ---------------------------------------------------------------- pixels --- */
+
+/* Texture coordinate to 16.16, clamped into [0, size) */
+static inline int32_t tri_fix(float f, int32_t max)
+{
+    int32_t i = (int32_t)gfx_clampf(f * 65536.0f, 0.0f, TRI_FIX_MAX);
+
+    return (i > max) ? max : i;
+}
+
+static void tri_span(uint16_t *d, int32_t n, const gfx_tri_tex_t *tex,
+                     int32_t u, int32_t v, int32_t du, int32_t dv)
+{
+    uint32_t pitch = tex->pitch;
+
+    if (tex->format == GFX_TRI_RGB565) {
+        const uint16_t *s = (const uint16_t *)tex->addr;
+
+        while (n-- > 0) {
+            *d++ = s[(uint32_t)(v >> 16) * pitch + (uint32_t)(u >> 16)];
+            u += du;
+            v += dv;
+        }
+        return;
+    }
+
+    const uint16_t *s = (const uint16_t *)tex->addr;
+
+    while (n-- > 0) {
+        uint32_t t = s[(uint32_t)(v >> 16) * pitch + (uint32_t)(u >> 16)];
+        uint32_t a = t >> 12;
+
+        u += du;
+        v += dv;
+        if (a == 0) {
+            d++;
+            continue;
+        }
+        uint32_t r = (t >> 8) & 0x0FU;
+        uint32_t g = (t >> 4) & 0x0FU;
+        uint32_t b = t & 0x0FU;
+        uint32_t c = (((r << 1) | (r >> 3)) << 11) | (((g << 2) | (g >> 2)) << 5) | ((b << 1) | (b >> 3));
+
+        if (a == 0x0FU) {
+            *d++ = (uint16_t)c;
+            continue;
+        }
+        /* Both colours spread to 0000 0GGG GGG0 0000 RRRR R000 00BB BBBB: one multiply for all three channels */
+        uint32_t s32 = (c | (c << 16)) & 0x07E0F81FU;
+        uint32_t d32 = ((uint32_t)*d | ((uint32_t)*d << 16)) & 0x07E0F81FU;
+
+        d32 = (d32 + (((s32 - d32) * ((a << 1) | (a >> 3))) >> 5)) & 0x07E0F81FU;
+        *d++ = (uint16_t)(d32 | (d32 >> 16));
+    }
+}
+
+/* ------------------------------------------------------------ rasteriser --- */
+
+/* Draw triangle t inside r (part of one tile) */
+static void tri_raster(const tri_t *t, const gfx_rect_t *r)
+{
+    const gfx_tri_tex_t *tex = t->tex;
+    int32_t max_u = ((int32_t)tex->width << 16) - 1;
+    int32_t max_v = ((int32_t)tex->height << 16) - 1;
+    int32_t n = r->w;
+
+    for (int32_t y = r->y; y < r->y + r->h; y++) {
+        int32_t lo = 0;
+        int32_t hi = n;
+
+        /* Covered pixels of the row: E + a * i >= 0 for every edge */
+        for (uint32_t k = 0; k < 3; k++) {
+            int32_t e = (int32_t)(t->c[k] + (int64_t)t->a[k] * r->x + (int64_t)t->b[k] * y);
+            int32_t a = t->a[k];
+
+            if (a > 0) {
+                if (e < 0) {
+                    int32_t i = (-e + a - 1) / a;
+
+                    lo = (i > lo) ? i : lo;
+                }
+            } else if (a < 0) {
+                if (e < 0) {
+                    hi = 0;
+                } else {
+                    int32_t i = e / -a + 1;
+
+                    hi = (i < hi) ? i : hi;
+                }
+            } else if (e < 0) {
+                hi = 0;
+            }
+        }
+        if (lo >= hi) {
+            continue;
+        }
+
+        int32_t x = r->x + lo;
+        int32_t len = hi - lo;
+        uint16_t *d = (uint16_t *)(tri_canvas.buffer) + (uint32_t)y * tri_canvas.pitch + (uint32_t)x;
+        float row[3];
+
+        for (uint32_t k = 0; k < 3; k++) {
+            row[k] = t->p[k][0] + t->p[k][2] * (float)y;
+        }
+        tri_stats.pixels += (uint32_t)len;
+
+        if (t->mapping == GFX_TRI_AFFINE) {
+            int32_t u0 = tri_fix(row[0] + t->p[0][1] * (float)x, max_u);
+            int32_t v0 = tri_fix(row[1] + t->p[1][1] * (float)x, max_v);
+            int32_t du = 0;
+            int32_t dv = 0;
+
+            /* Stepped between the first and the last pixel, both clamped: never outside the texture */
+            if (len > 1) {
+                du = (tri_fix(row[0] + t->p[0][1] * (float)(x + len - 1), max_u) - u0) / (len - 1);
+                dv = (tri_fix(row[1] + t->p[1][1] * (float)(x + len - 1), max_v) - v0) / (len - 1);
+            }
+            tri_span(d, len, tex, u0, v0, du, dv);
+            continue;
+        }
+
+        /* Perspective: exact u, v at both ends of every GFX_TRI_SPAN pixels, affine in between */
+        while (len > 0) {
+            int32_t m = (len > GFX_TRI_SPAN) ? GFX_TRI_SPAN : len;
+            float q0 = row[2] + t->p[2][1] * (float)x;
+            float r0 = (q0 > 0.0f) ? 1.0f / q0 : 0.0f;
+            int32_t u0 = tri_fix((row[0] + t->p[0][1] * (float)x) * r0, max_u);
+            int32_t v0 = tri_fix((row[1] + t->p[1][1] * (float)x) * r0, max_v);
+            int32_t du = 0;
+            int32_t dv = 0;
+
+            if (m > 1) {
+                float xe = (float)(x + m - 1);
+                float q1 = row[2] + t->p[2][1] * xe;
+                float r1 = (q1 > 0.0f) ? 1.0f / q1 : 0.0f;
+
+                du = (tri_fix((row[0] + t->p[0][1] * xe) * r1, max_u) - u0) / (m - 1);
+                dv = (tri_fix((row[1] + t->p[1][1] * xe) * r1, max_v) - v0) / (m - 1);
+            }
+            tri_span(d, m, tex, u0, v0, du, dv);
+            tri_stats.spans++;
+            d += m;
+            x += m;
+            len -= m;
+        }
+    }
+}
+
+/* Every tile with triangles, each drawn in the order added */
+static void tri_flush(void)
+{
+    const gfx_rect_t *clip = &tri_canvas.clip;
+    uint32_t start = DWT->CYCCNT;
+
+    if (tri_count == 0) {
+        return;
+    }
+    DMA2D_wait();
+
+    for (uint32_t i = 0; i < TRI_BINS; i++) {
+        uint64_t mask = tri_bins[i];
+        gfx_rect_t tile;
+
+        if (mask == 0) {
+            continue;
+        }
+        tri_bins[i] = 0;
+        tile.x = (int16_t)(clip->x + (int32_t)(i % GFX_TRI_BINS_X) * GFX_TRI_TILE);
+        tile.y = (int16_t)(clip->y + (int32_t)(i / GFX_TRI_BINS_X) * GFX_TRI_TILE);
+        tile.w = (int16_t)((clip->x + clip->w - tile.x < GFX_TRI_TILE) ? clip->x + clip->w - tile.x : GFX_TRI_TILE);
+        tile.h = (int16_t)((clip->y + clip->h - tile.y < GFX_TRI_TILE) ? clip->y + clip->h - tile.y : GFX_TRI_TILE);
+
+        /* ARGB4444 texels blend with what DMA2D left in the canvas */
+        for (int32_t y = tile.y; y < tile.y + tile.h; y++) {
+            SCB_CleanInvalidateDCache_by_Addr((uint32_t *)(tri_canvas.buffer + ((uint32_t)y * tri_canvas.pitch + (uint32_t)tile.x) * 2U),
+                                              tile.w * 2);
+        }
+        while (mask != 0) {
+            const tri_t *t = &tri_list[__builtin_ctzll(mask)];
+            gfx_rect_t r;
+
+            mask &= mask - 1;
+            if (gfx_rect_intersect(&tile, &t->box, &r)) {
+                tri_raster(t, &r);
+                tri_stats.bins++;
+            }
+        }
+        for (int32_t y = tile.y; y < tile.y + tile.h; y++) {
+            SCB_CleanDCache_by_Addr((uint32_t *)(tri_canvas.buffer + ((uint32_t)y * tri_canvas.pitch + (uint32_t)tile.x) * 2U),
+                                    tile.w * 2);
+        }
+        tri_stats.tiles++;
+    }
+    tri_count = 0;
+    tri_stats.batches++;
+    tri_stats.cycles += DWT->CYCCNT - start;
+}
+
+static bool tri_coord_ok(float f)
+{
+    return (f >= -(float)GFX_TRI_COORD_MAX) && (f <= (float)GFX_TRI_COORD_MAX);     // False for NaN too
+}
+
+static gfx_tri_error_t tri_add(const gfx_tri_vertex_t *v0, const gfx_tri_vertex_t *v1, const gfx_tri_vertex_t *v2,
+                               const gfx_tri_tex_t *tex, gfx_tri_mapping_t mapping)
+{
+    const gfx_tri_vertex_t *v[3] = { v0, v1, v2 };
+    const gfx_rect_t *clip = &tri_canvas.clip;
+    int32_t X[3], Y[3];
+    int64_t area;
+    tri_t *t;
+
+    for (uint32_t i = 0; i < 3; i++) {
+        if (!tri_coord_ok(v[i]->x) || !tri_coord_ok(v[i]->y) ||
+            (mapping == GFX_TRI_PERSPECTIVE && !(v[i]->w > 0.0f))) {
+            return GFX_TRI_ERR_PARAM;
+        }
+    }
+    tri_stats.triangles++;
+
+    for (uint32_t i = 0; i < 3; i++) {
+        X[i] = (int32_t)gfx_floorf(v[i]->x * (float)TRI_SUB + 0.5f);
+        Y[i] = (int32_t)gfx_floorf(v[i]->y * (float)TRI_SUB + 0.5f);
+    }
+    area = (int64_t)(X[1] - X[0]) * (Y[2] - Y[0]) - (int64_t)(Y[1] - Y[0]) * (X[2] - X[0]);
+    if (area == 0) {
+        tri_stats.culled++;
+        return GFX_TRI_OK;
+    }
+    if (area < 0) {
+        const gfx_tri_vertex_t *pv = v[1];
+        int32_t s;
+
+        v[1] = v[2];
+        v[2] = pv;
+        s = X[1]; X[1] = X[2]; X[2] = s;
+        s = Y[1]; Y[1] = Y[2]; Y[2] = s;
+        area = -area;
+    }
+
+    /* Pixels whose centre may be inside: centre of pixel i is at 16 * i + 8 */
+    int32_t min_x = X[0], max_x = X[0], min_y = Y[0], max_y = Y[0];
+
+    for (uint32_t i = 1; i < 3; i++) {
+        min_x = (X[i] < min_x) ? X[i] : min_x;
+        max_x = (X[i] > max_x) ? X[i] : max_x;
+        min_y = (Y[i] < min_y) ? Y[i] : min_y;
+        max_y = (Y[i] > max_y) ? Y[i] : max_y;
+    }
+    gfx_rect_t box;
+    int32_t bx0 = (min_x - TRI_HALF + TRI_SUB - 1) >> GFX_TRI_SUBPIXEL;
+    int32_t by0 = (min_y - TRI_HALF + TRI_SUB - 1) >> GFX_TRI_SUBPIXEL;
+    int32_t bx1 = ((max_x - TRI_HALF) >> GFX_TRI_SUBPIXEL) + 1;
+    int32_t by1 = ((max_y - TRI_HALF) >> GFX_TRI_SUBPIXEL) + 1;
+
+    box.x = (int16_t)bx0;
+    box.y = (int16_t)by0;
+    box.w = (int16_t)(bx1 - bx0);
+    box.h = (int16_t)(by1 - by0);
+    if (box.w <= 0 || box.h <= 0 || !gfx_rect_intersect(&box, clip, &box)) {
+        tri_stats.culled++;
+        return GFX_TRI_OK;
+    }
+
+    if (tri_count == GFX_TRI_MAX) {
+        tri_flush();
+    }
+    t = &tri_list[tri_count];
+    t->tex = tex;
+    t->mapping = (uint8_t)mapping;
+    t->box = box;
+
+    for (uint32_t k = 0; k < 3; k++) {
+        uint32_t j = (k + 1) % 3;
+        int32_t dx = X[j] - X[k];
+        int32_t dy = Y[j] - Y[k];
+        bool top_left = (dy < 0) || (dy == 0 && dx > 0);
+
+        t->a[k] = -dy * TRI_SUB;
+        t->b[k] = dx * TRI_SUB;
+        t->c[k] = (int64_t)dx * (TRI_HALF - Y[k]) - (int64_t)dy * (TRI_HALF - X[k]) - (top_left ? 0 : 1);
+    }
+
+    /* Attribute planes over the snapped vertices, evaluated at pixel centres */
+    float x[3], y[3], f[3][3];
+    float det = (float)area / (float)(TRI_SUB * TRI_SUB);
+
+    for (uint32_t i = 0; i < 3; i++) {
+        x[i] = (float)X[i] / (float)TRI_SUB;
+        y[i] = (float)Y[i] / (float)TRI_SUB;
+        if (mapping == GFX_TRI_PERSPECTIVE) {
+            float q = 1.0f / v[i]->w;
+
+            f[0][i] = v[i]->u * q;
+            f[1][i] = v[i]->v * q;
+            f[2][i] = q;
+        } else {
+            f[0][i] = v[i]->u;
+            f[1][i] = v[i]->v;
+            f[2][i] = 1.0f;
+        }
+    }
+    for (uint32_t k = 0; k < 3; k++) {
+        float fx = ((f[k][1] - f[k][0]) * (y[2] - y[0]) - (f[k][2] - f[k][0]) * (y[1] - y[0])) / det;
+        float fy = ((f[k][2] - f[k][0]) * (x[1] - x[0]) - (f[k][1] - f[k][0]) * (x[2] - x[0])) / det;
+
+        t->p[k][0] = f[k][0] + fx * (0.5f - x[0]) + fy * (0.5f - y[0]);
+        t->p[k][1] = fx;
+        t->p[k][2] = fy;
+    }
+
+    /* Bin into the tiles where some pixel centre passes all three edges */
+    int32_t tx0 = (box.x - clip->x) / GFX_TRI_TILE;
+    int32_t ty0 = (box.y - clip->y) / GFX_TRI_TILE;
+    int32_t tx1 = (box.x + box.w - 1 - clip->x) / GFX_TRI_TILE;
+    int32_t ty1 = (box.y + box.h - 1 - clip->y) / GFX_TRI_TILE;
+    bool binned = false;
+
+    for (int32_t ty = ty0; ty <= ty1; ty++) {
+        for (int32_t tx = tx0; tx <= tx1; tx++) {
+            gfx_rect_t tile = {
+                (int16_t)(clip->x + tx * GFX_TRI_TILE), (int16_t)(clip->y + ty * GFX_TRI_TILE),
+                GFX_TRI_TILE, GFX_TRI_TILE
+            };
+            gfx_rect_t r;
+            bool hit = gfx_rect_intersect(&tile, &box, &r);
+
+            for (uint32_t k = 0; k < 3 && hit; k++) {
+                int64_t e = t->c[k] + (int64_t)t->a[k] * ((t->a[k] > 0) ? r.x + r.w - 1 : r.x) +
+                            (int64_t)t->b[k] * ((t->b[k] > 0) ? r.y + r.h - 1 : r.y);
+
+                hit = (e >= 0);
+            }
+            if (hit) {
+                tri_bins[ty * GFX_TRI_BINS_X + tx] |= (uint64_t)1 << tri_count;
+                binned = true;
+            }
+        }
+    }
+    if (!binned) {
+        tri_stats.culled++;
+        return GFX_TRI_OK;
+    }
+    tri_count++;
+    return GFX_TRI_OK;
+}
+
+/* ------------------------------------------------------------------- api --- */
+
+gfx_tri_error_t gfx_tri_begin(const gfx_canvas_t *canvas)
+{
+    if (canvas == NULL || tri_open || canvas->clip.x < 0 || canvas->clip.y < 0 ||
+        canvas->clip.w <= 0 || canvas->clip.h <= 0 ||
+        canvas->clip.w > GFX_TRI_BINS_X * GFX_TRI_TILE || canvas->clip.h > GFX_TRI_BINS_Y * GFX_TRI_TILE) {
+        return GFX_TRI_ERR_PARAM;
+    }
+    tri_canvas = *canvas;
+    tri_count = 0;
+    tri_open = true;
+
+    /* Cycle counter for stats.cycles */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->LAR = 0xC5ACCE55;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    return GFX_TRI_OK;
+}
+
+static bool tri_tex_ok(const gfx_tri_tex_t *tex)
+{
+    return tex != NULL && tex->addr != 0 && tex->width != 0 && tex->height != 0 &&
+           tex->pitch >= tex->width && tex->width <= 2048 && tex->height <= 2048 &&
+           tex->format <= GFX_TRI_ARGB4444;
+}
+
+gfx_tri_error_t gfx_tri_add(const gfx_tri_vertex_t v[3], const gfx_tri_tex_t *tex, gfx_tri_mapping_t mapping)
+{
+    if (!tri_open || v == NULL || !tri_tex_ok(tex) || mapping > GFX_TRI_PERSPECTIVE) {
+        return GFX_TRI_ERR_PARAM;
+    }
+    return tri_add(&v[0], &v[1], &v[2], tex, mapping);
+}
+
+gfx_tri_error_t gfx_tri_add_quad(const gfx_tri_vertex_t v[4], const gfx_tri_tex_t *tex, gfx_tri_mapping_t mapping)
+{
+    gfx_tri_error_t err;
+
+    if (!tri_open || v == NULL || !tri_tex_ok(tex) || mapping > GFX_TRI_PERSPECTIVE) {
+        return GFX_TRI_ERR_PARAM;
+    }
+    err = tri_add(&v[0], &v[1], &v[2], tex, mapping);
+    if (err == GFX_TRI_OK) {
+        err = tri_add(&v[0], &v[2], &v[3], tex, mapping);
+    }
+    return err;
+}
+
+void gfx_tri_end(void)
+{
+    if (!tri_open) {
+        return;
+    }
+    tri_flush();
+    tri_open = false;
+}
+
+void gfx_tri_card(gfx_tri_vertex_t v[4], const gfx_tri_tex_t *tex, float x, float y, float pivot, float angle, float focal)
+{
+    float s, c;
+
+    gfx_sincosf(angle, &s, &c);
+    for (uint32_t i = 0; i < 4; i++) {
+        float u = (i == 1 || i == 2) ? (float)tex->width : 0.0f;
+        float t = (i >= 2) ? (float)tex->height : 0.0f;
+        float w = (focal + (u - pivot) * s) / focal;      // Depth relative to the screen plane
+
+        v[i].x = x + (u - pivot) * c / w;
+        v[i].y = y + (t - (float)tex->height * 0.5f) / w;
+        v[i].u = u;
+        v[i].v = t;
+        v[i].w = w;
+    }
+}
+
+const gfx_tri_stats_t *gfx_tri_get_stats(void)
+{
+    return &tri_stats;
+}
+
+void gfx_tri_reset_stats(void)
+{
+    tri_stats = (gfx_tri_stats_t){ 0 };
+}
@@ -0,0 +1,117 @@
+/**
+ * @file gfx_types.h
+ * @brief Common graphics types, display geometry and rectangle helpers
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#ifndef __GFX_TYPES_H__
+#define __GFX_TYPES_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Display geometry, must match MX_LTDC_Init() */
+#define GFX_LCD_WIDTH                   800
+#define GFX_LCD_HEIGHT                  480
+#define GFX_LCD_BPP                     2           // RGB565
+
+/* GRAM framebuffer, see .gram in STM32H7B0XX_FLASH.ld */
+#define GFX_FB_ADDR                     0x24040000UL
+#define GFX_FB_SIZE                     (GFX_LCD_WIDTH * GFX_LCD_HEIGHT * GFX_LCD_BPP)
+
+// RGB565 helpers
+#define GFX_RGB565(r, g, b)             ((uint16_t)((((r) & 0xF8) << 8) | (((g) & 0xFC) << 3) | (((b) & 0xF8) >> 3)))
+
+typedef struct {
+    int16_t x;
+    int16_t y;
+    int16_t w;
+    int16_t h;
+} gfx_rect_t;
+
+static inline bool gfx_rect_is_empty(const gfx_rect_t *r) {
+    return (r->w <= 0) || (r->h <= 0);
+}
+
+static inline uint32_t gfx_rect_area(const gfx_rect_t *r) {
+    return gfx_rect_is_empty(r) ? 0 : (uint32_t)r->w * (uint32_t)r->h;
+}
+
+/**
+ * @brief Intersection of two rectangles
+ * @return true if they overlap, false otherwise (out is cleared)
+ */
+static inline bool gfx_rect_intersect(const gfx_rect_t *a, const gfx_rect_t *b, gfx_rect_t *out) {
+    int32_t x0 = (a->x > b->x) ? a->x : b->x;
+    int32_t y0 = (a->y > b->y) ? a->y : b->y;
+    int32_t x1 = ((a->x + a->w) < (b->x + b->w)) ? (a->x + a->w) : (b->x + b->w);
+    int32_t y1 = ((a->y + a->h) < (b->y + b->h)) ? (a->y + a->h) : (b->y + b->h);
+
+    if (x1 <= x0 || y1 <= y0) {
+        out->x = out->y = out->w = out->h = 0;
+        return false;
+    }
+    out->x = (int16_t)x0;
+    out->y = (int16_t)y0;
+    out->w = (int16_t)(x1 - x0);
+    out->h = (int16_t)(y1 - y0);
+    return true;
+}
+
+/**
+ * @brief Bounding box of two rectangles
+ */
+static inline void gfx_rect_union(const gfx_rect_t *a, const gfx_rect_t *b, gfx_rect_t *out) {
+    int32_t x0 = (a->x < b->x) ? a->x : b->x;
+    int32_t y0 = (a->y < b->y) ? a->y : b->y;
+    int32_t x1 = ((a->x + a->w) > (b->x + b->w)) ? (a->x + a->w) : (b->x + b->w);
+    int32_t y1 = ((a->y + a->h) > (b->y + b->h)) ? (a->y + a->h) : (b->y + b->h);
+
+    out->x = (int16_t)x0;
+    out->y = (int16_t)y0;
+    out->w = (int16_t)(x1 - x0);
+    out->h = (int16_t)(y1 - y0);
+}
+
+/**
+ * @brief Check whether outer fully contains inner
+ */
+static inline bool gfx_rect_contains(const gfx_rect_t *outer, const gfx_rect_t *inner) {
+    return (inner->x >= outer->x) && (inner->y >= outer->y) &&
+           ((inner->x + inner->w) <= (outer->x + outer->w)) &&
+           ((inner->y + inner->h) <= (outer->y + outer->h));
+}
+
+// ARGB8888 colour for primitives blended by DMA2D
+#define GFX_ARGB(a, r, g, b)            ((uint32_t)(((uint32_t)(a) << 24) | ((uint32_t)(r) << 16) | ((uint32_t)(g) << 8) | (uint32_t)(b)))
+
+/* RGB565 drawing target, the buffer must be reachable by DMA2D (not DTCM) */
+typedef struct {
+    uint32_t    buffer;                             // Address of pixel (0, 0)
+    uint16_t    pitch;                              // Line length in pixels
+    gfx_rect_t  clip;                               // Drawing is limited to this area
+} gfx_canvas_t;
+
+/**
+ * @brief Canvas covering a whole buffer of the LCD size
+ */
+static inline void gfx_canvas_init(gfx_canvas_t *canvas, uint32_t buffer) {
+    canvas->buffer = buffer;
+    canvas->pitch = GFX_LCD_WIDTH;
+    canvas->clip.x = 0;
+    canvas->clip.y = 0;
+    canvas->clip.w = GFX_LCD_WIDTH;
+    canvas->clip.h = GFX_LCD_HEIGHT;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __GFX_TYPES_H__ */
@@ -0,0 +1,472 @@
+/**
+ * @file gfx_vector.c
+ * @brief Anti-aliased vector primitives, rasterised to A8 coverage and blended by DMA2D
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#include <stddef.h>
+#include "main.h"
+#include "dma2d.h"
+#include "gfx_math.h"
+#include "gfx_vector.h"
+
+typedef struct {
+    float x0, y0, x1, y1;
+} vec_edge_t;
+
+typedef struct {
+    vec_edge_t  edges[GFX_VEC_MAX_EDGES];
+    uint16_t    count;
+    bool        overflow;
+    bool        open;                               // A contour is being built
+    gfx_vec_point_t first;                          // First and last point of the open contour
+    gfx_vec_point_t last;
+    float       min_x, min_y, max_x, max_y;
+} vec_path_t;
+
+static vec_path_t vec_path;
+static float vec_acc[GFX_VEC_ACC_SIZE];                                                 // DTCM, CPU only
+__attribute__((section(".sram_noncache_bss"))) static uint8_t vec_mask[2][GFX_VEC_MASK_SIZE];   // Read by DMA2D
+static gfx_vec_stats_t vec_stats;
+
+/* ---------------------------------------------------------------- path --- */
+
+static void path_begin(void)
+{
+    vec_path.count = 0;
+    vec_path.overflow = false;
+    vec_path.open = false;
+    vec_path.min_x = vec_path.min_y = 1e9f;
+    vec_path.max_x = vec_path.max_y = -1e9f;
+}
+
+static void path_edge(gfx_vec_point_t a, gfx_vec_point_t b)
+{
+    vec_edge_t *e;
+
+    if (a.y == b.y) {
+        return;                                     // Horizontal edges add no coverage
+    }
+    if (vec_path.count >= GFX_VEC_MAX_EDGES) {
+        vec_path.overflow = true;
+        return;
+    }
+    e = &vec_path.edges[vec_path.count++];
+    e->x0 = a.x;
+    e->y0 = a.y;
+    e->x1 = b.x;
+    e->y1 = b.y;
+}
+
+static void path_point(float x, float y)
+{
+    gfx_vec_point_t p = { x, y };
+
+    if (x < vec_path.min_x) vec_path.min_x = x;
+    if (x > vec_path.max_x) vec_path.max_x = x;
+    if (y < vec_path.min_y) vec_path.min_y = y;
+    if (y > vec_path.max_y) vec_path.max_y = y;
+
+    if (!vec_path.open) {
+        vec_path.open = true;
+        vec_path.first = p;
+    } else {
+        path_edge(vec_path.last, p);
+    }
+    vec_path.last = p;
+}
+
+static void path_close(void)
+{
+    if (vec_path.open) {
+        path_edge(vec_path.last, vec_path.first);
+        vec_path.open = false;
+    }
+}
+
+/*
+ * Segments so that the chord never leaves the arc by more than
+ * GFX_VEC_TOLERANCE: the sagitta r * (1 - cos(step / 2)) stays below
+ * r * step^2 / 8, which gives step = sqrt(8 * tolerance / r).
+ */
+static uint32_t arc_segments(float r, float span)
+{
+    float step = (r > 2.0f * GFX_VEC_TOLERANCE) ? gfx_sqrtf(8.0f * GFX_VEC_TOLERANCE / r) : GFX_PI / 2.0f;
+    uint32_t n = (uint32_t)gfx_ceilf(span / step);
+
+    return (n < 2U) ? 2U : n;
+}
+
+/* Points of an arc, both ends included, span in radians (negative: counter clockwise) */
+static void path_arc(float cx, float cy, float r, float start, float span)
+{
+    uint32_t n = arc_segments(r, gfx_absf(span));
+    float c, s, dx, dy;
+
+    gfx_sincosf(span / (float)n, &s, &c);
+    gfx_sincosf(start, &dy, &dx);
+    dx *= r;
+    dy *= r;
+
+    path_point(cx + dx, cy + dy);
+    for (uint32_t i = 0; i < n; i++) {
+        float t = dx * c - dy * s;                  // Rotate the radius, one sin/cos per arc
+
+        dy = dx * s + dy * c;
+        dx = t;
+        path_point(cx + dx, cy + dy);
+    }
+}
+
+/* ----------------------------------------------------------- rasteriser --- */
+
+/*
+ * Signed area accumulation: every edge adds, for each cell it crosses, the
+ * area it covers to the right of itself inside that cell, and the rest of the
+ * row height to the next cell. A running sum along the row then gives the
+ * exact coverage of every pixel. Coordinates are band relative, x in [0, w].
+ */
+static void raster_edge(float *acc, uint32_t stride, uint32_t rows, float x0, float y0, float x1, float y1)
+{
+    float dir = 1.0f;
+    float dxdy, x;
+    int32_t y_start, y_end;
+
+    if (y0 > y1) {
+        float t;
+
+        dir = -1.0f;
+        t = x0; x0 = x1; x1 = t;
+        t = y0; y0 = y1; y1 = t;
+    }
+    if (y1 <= 0.0f || y0 >= (float)rows) {
+        return;
+    }
+
+    dxdy = (x1 - x0) / (y1 - y0);
+    x = x0;
+    if (y0 < 0.0f) {
+        x -= y0 * dxdy;
+        y0 = 0.0f;
+    }
+    if (y1 > (float)rows) {
+        y1 = (float)rows;
+    }
+
+    y_start = (int32_t)y0;
+    y_end = (int32_t)gfx_ceilf(y1);
+    for (int32_t y = y_start; y < y_end; y++) {
+        float *line = &acc[(uint32_t)y * stride];
+        float dy = gfx_minf((float)(y + 1), y1) - gfx_maxf((float)y, y0);
+        float x_next = gfx_minf(gfx_maxf(x + dxdy * dy, 0.0f), (float)(stride - 2U));   // Rounding must not leave the row
+        float d = dy * dir;
+        float xl = gfx_minf(x, x_next);
+        float xr = gfx_maxf(x, x_next);
+        float xl_floor = gfx_floorf(xl);
+        int32_t xli = (int32_t)xl_floor;
+        int32_t xri = (int32_t)gfx_ceilf(xr);
+
+        if (xri <= xli + 1) {
+            /* Inside one cell: split at the mean x */
+            float xm = 0.5f * (x + x_next) - xl_floor;
+
+            line[xli] += d - d * xm;
+            line[xli + 1] += d * xm;
+        } else {
+            float s = 1.0f / (xr - xl);
+            float xlf = xl - xl_floor;
+            float a0 = 0.5f * s * (1.0f - xlf) * (1.0f - xlf);
+            float xrf = xr - (float)xri + 1.0f;
+            float am = 0.5f * s * xrf * xrf;
+
+            line[xli] += d * a0;
+            if (xri == xli + 2) {
+                line[xli + 1] += d * (1.0f - a0 - am);
+            } else {
+                float a1 = s * (1.5f - xlf);
+
+                line[xli + 1] += d * (a1 - a0);
+                for (int32_t xi = xli + 2; xi < xri - 1; xi++) {
+                    line[xi] += d * s;
+                }
+                line[xri - 1] += d * (1.0f - (a1 + (float)(xri - xli - 3) * s) - am);
+            }
+            line[xri] += d * am;
+        }
+        x = x_next;
+    }
+}
+
+/*
+ * Clip an edge to the band columns [0, w]: parts left of the band become a
+ * vertical edge at x = 0 (they cover the whole row), parts right of it a
+ * vertical edge at x = w (they cover nothing visible).
+ */
+static void raster_edge_clipped(float *acc, uint32_t stride, uint32_t rows, float w,
+                                float x0, float y0, float x1, float y1)
+{
+    float t[3];
+    uint32_t n = 0;
+    float px, py;
+
+    if (x0 >= 0.0f && x0 <= w && x1 >= 0.0f && x1 <= w) {
+        raster_edge(acc, stride, rows, x0, y0, x1, y1);
+        return;
+    }
+
+    if ((x0 < 0.0f) != (x1 < 0.0f)) {
+        t[n++] = (0.0f - x0) / (x1 - x0);
+    }
+    if ((x0 > w) != (x1 > w)) {
+        t[n++] = (w - x0) / (x1 - x0);
+    }
+    if (n == 2 && t[0] > t[1]) {
+        float tmp = t[0];
+
+        t[0] = t[1];
+        t[1] = tmp;
+    }
+    t[n++] = 1.0f;
+
+    px = x0;
+    py = y0;
+    for (uint32_t i = 0; i < n; i++) {
+        float nx = (i == n - 1) ? x1 : x0 + (x1 - x0) * t[i];
+        float ny = (i == n - 1) ? y1 : y0 + (y1 - y0) * t[i];
+
+        raster_edge(acc, stride, rows, gfx_minf(gfx_maxf(px, 0.0f), w), py, gfx_minf(gfx_maxf(nx, 0.0f), w), ny);
+        px = nx;
+        py = ny;
+    }
+}
+
+/* Running sum of one band into A8, clears the accumulator for the next band */
+static bool raster_resolve(float *acc, uint32_t stride, uint32_t w, uint32_t rows, uint8_t *mask)
+{
+    uint32_t any = 0;
+
+    for (uint32_t y = 0; y < rows; y++) {
+        float *line = &acc[y * stride];
+        float sum = 0.0f;
+
+        for (uint32_t x = 0; x < w; x++) {
+            float c;
+            uint32_t a;
+
+            sum += line[x];
+            line[x] = 0.0f;
+            c = gfx_minf(gfx_absf(sum), 1.0f);
+            a = (uint32_t)(c * 255.0f + 0.5f);
+            mask[x] = (uint8_t)a;
+            any |= a;
+        }
+        line[w] = 0.0f;
+        line[w + 1] = 0.0f;
+        mask += w;
+    }
+
+    return any != 0;
+}
+
+static gfx_vec_error_t path_fill(const gfx_canvas_t *canvas, uint32_t argb)
+{
+    gfx_rect_t box, area;
+    uint32_t stride, band_rows, w;
+    uint8_t buf = 0;
+
+    path_close();
+    vec_stats.shapes++;
+    vec_stats.edges += vec_path.count;
+    if (vec_path.overflow) {
+        return GFX_VEC_ERR_OVERFLOW;
+    }
+    if (vec_path.count == 0 || (argb >> 24) == 0) {
+        return GFX_VEC_OK;
+    }
+
+    box.x = (int16_t)gfx_floorf(gfx_maxf(vec_path.min_x, -16384.0f));
+    box.y = (int16_t)gfx_floorf(gfx_maxf(vec_path.min_y, -16384.0f));
+    box.w = (int16_t)(gfx_ceilf(gfx_minf(vec_path.max_x, 16383.0f)) - (float)box.x);
+    box.h = (int16_t)(gfx_ceilf(gfx_minf(vec_path.max_y, 16383.0f)) - (float)box.y);
+    if (!gfx_rect_intersect(&box, &canvas->clip, &area)) {
+        return GFX_VEC_OK;
+    }
+
+    w = (uint32_t)area.w;
+    stride = w + 2U;                                // Edges at x = w spill into the next two cells
+    band_rows = GFX_VEC_ACC_SIZE / stride;
+    if (band_rows > GFX_VEC_MASK_SIZE / w) {
+        band_rows = GFX_VEC_MASK_SIZE / w;
+    }
+    if (band_rows == 0) {
+        return GFX_VEC_ERR_PARAM;                   // Canvas wider than the band buffers
+    }
+
+    for (int32_t by = area.y; by < area.y + area.h; by += (int32_t)band_rows) {
+        uint32_t rows = (uint32_t)(area.y + area.h - by);
+        float ox = (float)area.x;
+        float oy = (float)by;
+
+        if (rows > band_rows) {
+            rows = band_rows;
+        }
+        for (uint16_t i = 0; i < vec_path.count; i++) {
+            const vec_edge_t *e = &vec_path.edges[i];
+
+            raster_edge_clipped(vec_acc, stride, rows, (float)w, e->x0 - ox, e->y0 - oy, e->x1 - ox, e->y1 - oy);
+        }
+        vec_stats.bands++;
+
+        /* The other mask may still be blending, this one finished before it was started */
+        if (raster_resolve(vec_acc, stride, w, rows, vec_mask[buf])) {
+            DMA2D_blend_a8_start((uint32_t)vec_mask[buf], (uint16_t)w,
+                                 canvas->buffer + ((uint32_t)by * canvas->pitch + (uint32_t)area.x) * 2U,
+                                 canvas->pitch, (uint16_t)w, (uint16_t)rows, argb);
+            vec_stats.jobs++;
+            vec_stats.mask_pixels += w * rows;
+            buf ^= 1U;
+        }
+    }
+    DMA2D_wait();
+
+    return GFX_VEC_OK;
+}
+
+/* ----------------------------------------------------------- primitives --- */
+
+gfx_vec_error_t gfx_vec_line(const gfx_canvas_t *canvas, float x0, float y0, float x1, float y1,
+                             float width, uint32_t argb)
+{
+    float dx = x1 - x0, dy = y1 - y0;
+    float len = gfx_sqrtf(dx * dx + dy * dy);
+    float nx, ny;
+
+    if (canvas == NULL || width <= 0.0f) {
+        return GFX_VEC_ERR_PARAM;
+    }
+    if (len == 0.0f) {
+        return GFX_VEC_OK;
+    }
+    nx = -dy / len * width * 0.5f;
+    ny = dx / len * width * 0.5f;
+
+    path_begin();
+    path_point(x0 + nx, y0 + ny);
+    path_point(x1 + nx, y1 + ny);
+    path_point(x1 - nx, y1 - ny);
+    path_point(x0 - nx, y0 - ny);
+    return path_fill(canvas, argb);
+}
+
+gfx_vec_error_t gfx_vec_circle(const gfx_canvas_t *canvas, float cx, float cy, float r, uint32_t argb)
+{
+    if (canvas == NULL || r <= 0.0f) {
+        return GFX_VEC_ERR_PARAM;
+    }
+
+    path_begin();
+    path_arc(cx, cy, r, 0.0f, 2.0f * GFX_PI);
+    return path_fill(canvas, argb);
+}
+
+gfx_vec_error_t gfx_vec_ring(const gfx_canvas_t *canvas, float cx, float cy, float r, float width, uint32_t argb)
+{
+    float ro = r + width * 0.5f, ri = r - width * 0.5f;
+
+    if (canvas == NULL || width <= 0.0f || ro <= 0.0f) {
+        return GFX_VEC_ERR_PARAM;
+    }
+
+    path_begin();
+    path_arc(cx, cy, ro, 0.0f, 2.0f * GFX_PI);
+    path_close();
+    if (ri > 0.0f) {
+        path_arc(cx, cy, ri, 0.0f, -2.0f * GFX_PI);     // Opposite direction cuts the hole
+    }
+    return path_fill(canvas, argb);
+}
+
+gfx_vec_error_t gfx_vec_arc(const gfx_canvas_t *canvas, float cx, float cy, float r, float width,
+                            float start_deg, float end_deg, uint32_t argb)
+{
+    float ro = r + width * 0.5f, ri = r - width * 0.5f;
+    float span = end_deg - start_deg;
+    float start;
+
+    if (canvas == NULL || width <= 0.0f || ro <= 0.0f) {
+        return GFX_VEC_ERR_PARAM;
+    }
+    while (span < 0.0f) {
+        span += 360.0f;
+    }
+    if (span == 0.0f) {
+        return GFX_VEC_OK;
+    }
+    if (span >= 360.0f) {
+        return gfx_vec_ring(canvas, cx, cy, r, width, argb);
+    }
+    start = start_deg * GFX_PI / 180.0f;
+    span = span * GFX_PI / 180.0f;
+
+    path_begin();
+    path_arc(cx, cy, ro, start, span);
+    if (ri > 0.0f) {
+        path_arc(cx, cy, ri, start + span, -span);
+    } else {
+        path_point(cx, cy);                         // Pie slice
+    }
+    return path_fill(canvas, argb);
+}
+
+gfx_vec_error_t gfx_vec_round_rect(const gfx_canvas_t *canvas, float x, float y, float w, float h,
+                                   float radius, uint32_t argb)
+{
+    float limit = 0.5f * gfx_minf(w, h);
+
+    if (canvas == NULL || w <= 0.0f || h <= 0.0f) {
+        return GFX_VEC_ERR_PARAM;
+    }
+    if (radius > limit) {
+        radius = limit;
+    }
+
+    path_begin();
+    if (radius <= 0.0f) {
+        path_point(x, y);
+        path_point(x + w, y);
+        path_point(x + w, y + h);
+        path_point(x, y + h);
+    } else {
+        path_arc(x + w - radius, y + radius, radius, -0.5f * GFX_PI, 0.5f * GFX_PI);
+        path_arc(x + w - radius, y + h - radius, radius, 0.0f, 0.5f * GFX_PI);
+        path_arc(x + radius, y + h - radius, radius, 0.5f * GFX_PI, 0.5f * GFX_PI);
+        path_arc(x + radius, y + radius, radius, GFX_PI, 0.5f * GFX_PI);
+    }
+    return path_fill(canvas, argb);
+}
+
+gfx_vec_error_t gfx_vec_polygon(const gfx_canvas_t *canvas, const gfx_vec_point_t *points, uint16_t count,
+                                uint32_t argb)
+{
+    if (canvas == NULL || points == NULL || count < 3) {
+        return GFX_VEC_ERR_PARAM;
+    }
+
+    path_begin();
+    for (uint16_t i = 0; i < count; i++) {
+        path_point(points[i].x, points[i].y);
+    }
+    return path_fill(canvas, argb);
+}
+
+const gfx_vec_stats_t *gfx_vec_get_stats(void)
+{
+    return &vec_stats;
+}
+
+void gfx_vec_reset_stats(void)
+{
+    vec_stats = (gfx_vec_stats_t){ 0 };
+}
@@ -0,0 +1,102 @@
+/**
+ * @file gfx_vector.h
+ * @brief Anti-aliased vector primitives, rasterised to A8 coverage and blended by DMA2D
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note Every shape is turned into closed polygon edges, the edges are
+ *       accumulated as exact area coverage into a float band buffer (DTCM),
+ *       the band is converted to an A8 mask and DMA2D blends the mask with
+ *       the shape colour onto the RGB565 canvas. Two mask buffers are used,
+ *       so the CPU rasterises band n + 1 while DMA2D blends band n.
+ *       Fill rule: non-zero winding, coverage of overlapping contours of the
+ *       same direction saturates at 100 %.
+ */
+
+#ifndef __GFX_VECTOR_H__
+#define __GFX_VECTOR_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gfx_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GFX_VEC_MAX_EDGES               512         // Edges of one shape, arcs are split into segments
+#define GFX_VEC_ACC_SIZE                4096        // Float coverage cells per band (16 KB DTCM)
+#define GFX_VEC_MASK_SIZE               4096        // A8 bytes per mask buffer, two buffers in RAM_NOCACHE
+#define GFX_VEC_TOLERANCE               0.2f        // Max distance between a curve and its segments, pixels
+
+typedef enum {
+    GFX_VEC_OK = 0,
+    GFX_VEC_ERR_PARAM,
+    GFX_VEC_ERR_OVERFLOW,                           // More than GFX_VEC_MAX_EDGES edges
+} gfx_vec_error_t;
+
+typedef struct {
+    float x;
+    float y;
+} gfx_vec_point_t;
+
+typedef struct {
+    uint32_t    shapes;
+    uint32_t    edges;
+    uint32_t    bands;                              // Bands rasterised
+    uint32_t    jobs;                               // DMA2D blends started (empty bands are skipped)
+    uint32_t    mask_pixels;                        // Pixels blended by DMA2D
+} gfx_vec_stats_t;
+
+/*
+ * Coordinates are in pixels with (0, 0) the top left corner of pixel (0, 0),
+ * the centre of that pixel is (0.5, 0.5). Angles are in degrees, 0 points
+ * to the right and angles grow clockwise (screen y points down).
+ */
+
+/**
+ * @brief Line of the given width with butt ends
+ */
+gfx_vec_error_t gfx_vec_line(const gfx_canvas_t *canvas, float x0, float y0, float x1, float y1,
+                             float width, uint32_t argb);
+
+/**
+ * @brief Filled circle
+ */
+gfx_vec_error_t gfx_vec_circle(const gfx_canvas_t *canvas, float cx, float cy, float r, uint32_t argb);
+
+/**
+ * @brief Circle outline
+ * @param r radius of the centre of the stroke
+ */
+gfx_vec_error_t gfx_vec_ring(const gfx_canvas_t *canvas, float cx, float cy, float r, float width, uint32_t argb);
+
+/**
+ * @brief Stroked arc with butt ends, from start to end clockwise
+ * @param r radius of the centre of the stroke
+ * @param start_deg, end_deg end may be smaller than start, the arc then wraps through 360
+ */
+gfx_vec_error_t gfx_vec_arc(const gfx_canvas_t *canvas, float cx, float cy, float r, float width,
+                            float start_deg, float end_deg, uint32_t argb);
+
+/**
+ * @brief Filled rectangle with rounded corners
+ * @param radius corner radius, limited to half the shorter side
+ */
+gfx_vec_error_t gfx_vec_round_rect(const gfx_canvas_t *canvas, float x, float y, float w, float h,
+                                   float radius, uint32_t argb);
+
+/**
+ * @brief Filled polygon, closed automatically
+ */
+gfx_vec_error_t gfx_vec_polygon(const gfx_canvas_t *canvas, const gfx_vec_point_t *points, uint16_t count,
+                                uint32_t argb);
+
+const gfx_vec_stats_t *gfx_vec_get_stats(void);
+void gfx_vec_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __GFX_VECTOR_H__ */
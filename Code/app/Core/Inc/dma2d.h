@@ -42,6 +42,21 @@ void MX_DMA2D_Init(void);
 
 /* USER CODE BEGIN Prototypes */
 void DMA2D_fill_screen(void);
+void DMA2D_fill_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+void DMA2D_fill_rect_fb(uint32_t fb, uint16_t pitch, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+void DMA2D_load_clut(const uint32_t *clut, uint16_t size);
+void DMA2D_load_clut_format(const void *clut, uint16_t size, uint32_t ccm);
+void DMA2D_fill_rect_l8(uint32_t fb, uint16_t pitch, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t index);
+void DMA2D_copy_rect_start(uint32_t src, uint16_t src_pitch, uint32_t dst, uint16_t dst_pitch, uint16_t w, uint16_t h, uint32_t color_mode);
+void DMA2D_copy_rect(uint32_t src, uint16_t src_pitch, uint32_t dst, uint16_t dst_pitch, uint16_t w, uint16_t h, uint32_t color_mode);
+void DMA2D_copy_rect_l8(uint32_t src, uint32_t dst, uint16_t pitch, uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+void DMA2D_blend_a8_start(uint32_t mask, uint16_t mask_pitch, uint32_t dst, uint16_t dst_pitch, uint16_t w, uint16_t h, uint32_t argb);
+void DMA2D_blend_color_start(uint32_t dst, uint16_t dst_pitch, uint16_t w, uint16_t h, uint32_t argb);
+void DMA2D_convert_rect(uint32_t src, uint16_t src_pitch, uint32_t color_mode, uint32_t dst, uint16_t dst_pitch, uint16_t w, uint16_t h);
+void DMA2D_convert_ycbcr_start(uint32_t src, uint16_t mcu_pitch, uint32_t css, uint32_t dst, uint16_t dst_pitch, uint16_t w, uint16_t h);
+void DMA2D_blend_rect_start(uint32_t src, uint16_t src_pitch, uint32_t color_mode, uint8_t alpha, uint32_t dst, uint16_t dst_pitch, uint16_t w, uint16_t h);
+void DMA2D_blend_rect(uint32_t src, uint16_t src_pitch, uint32_t color_mode, uint8_t alpha, uint32_t dst, uint16_t dst_pitch, uint16_t w, uint16_t h);
+void DMA2D_wait(void);
 /* USER CODE END Prototypes */
 
 #ifdef __cplusplus
@@ -21,7 +21,7 @@
 #include "dma2d.h"
 
 /* USER CODE BEGIN 0 */
-
+#include "lcd_present.h"
 /* USER CODE END 0 */
 
 DMA2D_HandleTypeDef hdma2d;
@@ -120,7 +120,7 @@ void DMA2D_fill_screen(void)
 /******	
 等待 垂直数据使能显示状态 ，即LTDC即将刷完一整屏数据的时候
 因为在屏幕没有刷完一帧时进行刷屏，会有撕裂的现象
-用户也可以使用 寄存器重载中断 进行判断，不过为了保证例程的简洁以及移植的方便性，这里直接使用判断寄存器的方法
+这里使用 lcd_present 的行中断判断消隐期, 等待期间 CPU 在 WFI 中休眠, 不再轮询寄存器
 	
 如果不做垂直等待判断，DMA2D刷屏速度为：颜色格式	RGB565	1.4ms	(712帧)
 
@@ -128,11 +128,417 @@ void DMA2D_fill_screen(void)
 实际9ms的速度已经足够了，除非是对速度要求特别高的场合，不然建议加上判断垂直等待的语句，可以避免撕裂效应
 
 ******/
-	while( LTDC->CDSR != 0X00000001);	// 判断 显示状态寄存器LTDC_CDSR 的第0位 VDES：垂直数据使能显示状态
+	lcd_present_wait_vblank();			// 休眠等待 LTDC 行中断 (消隐期开始), 不再轮询 LTDC_CDSR
 	
 	DMA2D->CR	  |=	DMA2D_CR_START;					//	启动DMA2D
 		
 	while (DMA2D->CR & DMA2D_CR_START) ;				//	等待传输完成
 #endif
 }
+
+/**
+  * @brief  Fill a rectangle of the frame buffer, used to redraw dirty areas.
+  * @note   No vertical blank wait, partial updates are small enough to finish
+  *         inside the blanking period or before the scanline reaches them.
+  * @param  x, y, w, h  rectangle in screen coordinates, already clipped
+  * @param  color       RGB565 colour
+  * @retval None
+  */
+void DMA2D_fill_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color)
+{
+	DMA2D_fill_rect_fb(0x24040000, 800, x, y, w, h, color);
+}
+
+/**
+  * @brief  Fill a rectangle of any RGB565 frame buffer (e.g. a GFXMMU virtual buffer).
+  * @param  fb     frame buffer base address
+  * @param  pitch  frame buffer line length in pixels
+  * @param  x, y, w, h  rectangle, already clipped
+  * @param  color  RGB565 colour
+  * @retval None
+  */
+void DMA2D_fill_rect_fb(uint32_t fb, uint16_t pitch, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color)
+{
+	if (w == 0 || h == 0)
+	{
+		return;
+	}
+
+	DMA2D->CR	  &=	~(DMA2D_CR_START);
+	DMA2D->CR		=	DMA2D_R2M;
+	DMA2D->OPFCCR	=	LTDC_PIXEL_FORMAT_RGB565;
+	DMA2D->OOR		=	pitch - w;								//	行偏移 = 行长 - 矩形宽
+	DMA2D->OMAR		=	fb + ((uint32_t)y * pitch + x) * 2;
+	DMA2D->NLR		=	((uint32_t)w << 16) | h;
+	DMA2D->OCOLR	=	color;
+
+	DMA2D->CR	  |=	DMA2D_CR_START;
+
+	while (DMA2D->CR & DMA2D_CR_START) ;
+}
+
+/**
+  * @brief  Load a colour look-up table into the DMA2D foreground CLUT.
+  * @note   Needed before any L8 -> RGB conversion (M2M_PFC / M2M_BLEND).
+  * @param  clut  ARGB8888 entries, must be readable by DMA2D (not TCM)
+  * @param  size  number of entries, 1..256
+  * @retval None
+  */
+void DMA2D_load_clut(const uint32_t *clut, uint16_t size)
+{
+	DMA2D_load_clut_format(clut, size, DMA2D_CCM_ARGB8888);
+}
+
+/**
+  * @brief  Load a colour look-up table in ARGB8888 or RGB888 into the DMA2D foreground CLUT.
+  * @param  clut  entries, must be readable by DMA2D (not TCM)
+  * @param  size  number of entries, 1..256
+  * @param  ccm   DMA2D_CCM_ARGB8888 (4 bytes per entry) or DMA2D_CCM_RGB888 (3 bytes)
+  * @retval None
+  */
+void DMA2D_load_clut_format(const void *clut, uint16_t size, uint32_t ccm)
+{
+	if (clut == NULL || size == 0 || size > 256)
+	{
+		return;
+	}
+
+	SCB_CleanDCache_by_Addr((uint32_t *)clut, size * ((ccm == DMA2D_CCM_RGB888) ? 3 : 4));	//	DMA2D 从内存读取 CLUT, 先回写 cache
+
+	while (DMA2D->FGPFCCR & DMA2D_FGPFCCR_START) ;
+	DMA2D->FGCMAR	=	(uint32_t)clut;
+	DMA2D->FGPFCCR	=	((uint32_t)(size - 1) << DMA2D_FGPFCCR_CS_Pos) |
+						(ccm << DMA2D_FGPFCCR_CCM_Pos) |
+						DMA2D_INPUT_L8;
+	DMA2D->FGPFCCR |=	DMA2D_FGPFCCR_START;
+
+	while (DMA2D->FGPFCCR & DMA2D_FGPFCCR_START) ;
+}
+
+/**
+  * @brief  Fill a rectangle of an 8-bit (L8) frame buffer.
+  * @note   DMA2D has no 8-bit output format, the even aligned middle part is
+  *         filled as 16-bit pixels holding the index twice, odd edge columns
+  *         are written by the CPU.
+  * @param  fb     frame buffer base address
+  * @param  pitch  frame buffer width in pixels
+  * @param  x, y, w, h  rectangle, already clipped
+  * @param  index  CLUT index
+  * @retval None
+  */
+void DMA2D_fill_rect_l8(uint32_t fb, uint16_t pitch, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t index)
+{
+	volatile uint8_t *line = (volatile uint8_t *)(fb + (uint32_t)y * pitch + x);
+	uint16_t head = x & 1;
+	uint16_t body;
+	uint16_t i;
+
+	if (w == 0 || h == 0)
+	{
+		return;
+	}
+
+	if (head > w)
+	{
+		head = w;
+	}
+	body = (w - head) & ~1U;
+
+	if (body)
+	{
+		DMA2D->CR	  &=	~(DMA2D_CR_START);
+		DMA2D->CR		=	DMA2D_R2M;
+		DMA2D->OPFCCR	=	DMA2D_OUTPUT_ARGB4444;			//	任意 16 位格式, 只用于搬运两个索引
+		DMA2D->OOR		=	(pitch - body) / 2;
+		DMA2D->OMAR		=	(uint32_t)(line + head);
+		DMA2D->NLR		=	((uint32_t)(body / 2) << 16) | h;
+		DMA2D->OCOLR	=	((uint32_t)index << 8) | index;
+		DMA2D->CR	  |=	DMA2D_CR_START;
+	}
+
+	/* Odd edges while DMA2D runs, the areas do not overlap */
+	for (i = 0; i < h; i++)
+	{
+		if (head)
+		{
+			line[0] = index;
+		}
+		if (head + body < w)
+		{
+			line[w - 1] = index;
+		}
+		line += pitch;
+	}
+
+	while (DMA2D->CR & DMA2D_CR_START) ;
+}
+
+/**
+  * @brief  Copy a rectangle between two 8-bit (L8) frame buffers.
+  * @param  src, dst  frame buffer base addresses
+  * @param  pitch     frame buffer width in pixels (same for both)
+  * @param  x, y, w, h  rectangle, already clipped
+  * @retval None
+  */
+void DMA2D_copy_rect_l8(uint32_t src, uint32_t dst, uint16_t pitch, uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+	uint32_t offset = (uint32_t)y * pitch + x;
+
+	if (w == 0 || h == 0)
+	{
+		return;
+	}
+
+	DMA2D->CR	  &=	~(DMA2D_CR_START);
+	DMA2D->CR		=	DMA2D_M2M;							//	无 PFC, 按前景格式逐字节搬运
+	DMA2D->FGPFCCR	=	DMA2D_INPUT_L8;
+	DMA2D->FGMAR	=	src + offset;
+	DMA2D->FGOR		=	pitch - w;
+	DMA2D->OMAR		=	dst + offset;
+	DMA2D->OOR		=	pitch - w;
+	DMA2D->NLR		=	((uint32_t)w << 16) | h;
+	DMA2D->CR	  |=	DMA2D_CR_START;
+
+	while (DMA2D->CR & DMA2D_CR_START) ;
+}
+/**
+  * @brief  Start copying a block between two buffers without format conversion,
+  *         does not wait for the end of the job (see DMA2D_wait()).
+  * @param  src, dst          start address of the block in each buffer
+  * @param  src_pitch, dst_pitch  line length of each buffer in pixels
+  * @param  w, h              block size in pixels
+  * @param  color_mode        DMA2D_INPUT_xxx, only used for the pixel size
+  * @retval None
+  */
+void DMA2D_copy_rect_start(uint32_t src, uint16_t src_pitch, uint32_t dst, uint16_t dst_pitch, uint16_t w, uint16_t h, uint32_t color_mode)
+{
+	if (w == 0 || h == 0)
+	{
+		return;
+	}
+
+	while (DMA2D->CR & DMA2D_CR_START) ;
+	DMA2D->CR		=	DMA2D_M2M;
+	DMA2D->FGPFCCR	=	color_mode;
+	DMA2D->FGMAR	=	src;
+	DMA2D->FGOR		=	src_pitch - w;
+	DMA2D->OMAR		=	dst;
+	DMA2D->OOR		=	dst_pitch - w;
+	DMA2D->NLR		=	((uint32_t)w << 16) | h;
+	DMA2D->CR	  |=	DMA2D_CR_START;
+}
+
+/**
+  * @brief  Copy a block between two buffers without format conversion and wait for the end of the job.
+  * @param  see DMA2D_copy_rect_start()
+  * @retval None
+  */
+void DMA2D_copy_rect(uint32_t src, uint16_t src_pitch, uint32_t dst, uint16_t dst_pitch, uint16_t w, uint16_t h, uint32_t color_mode)
+{
+	DMA2D_copy_rect_start(src, src_pitch, dst, dst_pitch, w, h, color_mode);
+
+	while (DMA2D->CR & DMA2D_CR_START) ;
+}
+
+/**
+  * @brief  Blend a solid colour through an A8 coverage mask onto an RGB565 buffer.
+  * @note   Returns as soon as the job is started so the CPU can prepare the
+  *         next mask, call DMA2D_wait() before touching mask or dst again.
+  *         The mask must be readable by DMA2D (not DTCM) and already written
+  *         back from the D-cache.
+  * @param  mask       A8 coverage, one byte per pixel
+  * @param  mask_pitch mask line length in pixels
+  * @param  dst        first pixel of the block in the RGB565 buffer
+  * @param  dst_pitch  RGB565 buffer line length in pixels
+  * @param  w, h       block size in pixels
+  * @param  argb       colour, alpha scales the coverage
+  * @retval None
+  */
+void DMA2D_blend_a8_start(uint32_t mask, uint16_t mask_pitch, uint32_t dst, uint16_t dst_pitch, uint16_t w, uint16_t h, uint32_t argb)
+{
+	if (w == 0 || h == 0)
+	{
+		return;
+	}
+
+	while (DMA2D->CR & DMA2D_CR_START) ;					//	上一个任务可能还在运行
+	DMA2D->CR		=	DMA2D_M2M_BLEND;
+	DMA2D->FGPFCCR	=	(argb & 0xFF000000) |					//	前景 alpha = 覆盖率 * 颜色 alpha
+						(DMA2D_COMBINE_ALPHA << DMA2D_FGPFCCR_AM_Pos) |
+						DMA2D_INPUT_A8;
+	DMA2D->FGCOLR	=	argb & 0x00FFFFFF;						//	A8 的 RGB 来自 FGCOLR
+	DMA2D->FGMAR	=	mask;
+	DMA2D->FGOR		=	mask_pitch - w;
+	DMA2D->BGPFCCR	=	DMA2D_INPUT_RGB565;
+	DMA2D->BGMAR	=	dst;
+	DMA2D->BGOR		=	dst_pitch - w;
+	DMA2D->OPFCCR	=	DMA2D_OUTPUT_RGB565;
+	DMA2D->OMAR		=	dst;
+	DMA2D->OOR		=	dst_pitch - w;
+	DMA2D->NLR		=	((uint32_t)w << 16) | h;
+	DMA2D->CR	  |=	DMA2D_CR_START;
+}
+
+/**
+  * @brief  Start filling a block of an RGB565 buffer with a colour, blended by its alpha,
+  *         does not wait for the end of the job (see DMA2D_wait()).
+  * @note   Opaque colours are a register to memory fill, others blend with a fixed colour
+  *         foreground, no source memory is read for the colour.
+  * @param  dst        first pixel of the block
+  * @param  dst_pitch  buffer line length in pixels
+  * @param  w, h       block size in pixels
+  * @param  argb       ARGB8888 colour
+  * @retval None
+  */
+void DMA2D_blend_color_start(uint32_t dst, uint16_t dst_pitch, uint16_t w, uint16_t h, uint32_t argb)
+{
+	if (w == 0 || h == 0 || (argb >> 24) == 0)
+	{
+		return;
+	}
+
+	while (DMA2D->CR & DMA2D_CR_START) ;
+	if ((argb >> 24) == 0xFF)
+	{
+		DMA2D->CR		=	DMA2D_R2M;
+		DMA2D->OCOLR	=	((argb >> 8) & 0xF800) | ((argb >> 5) & 0x07E0) | ((argb >> 3) & 0x001F);
+	}
+	else
+	{
+		DMA2D->CR		=	DMA2D_M2M_BLEND_FG;						//	前景为固定颜色, 不读前景内存
+		DMA2D->FGPFCCR	=	(argb & 0xFF000000) |
+							(DMA2D_REPLACE_ALPHA << DMA2D_FGPFCCR_AM_Pos) |
+							DMA2D_INPUT_ARGB8888;
+		DMA2D->FGCOLR	=	argb & 0x00FFFFFF;
+		DMA2D->BGPFCCR	=	DMA2D_INPUT_RGB565;
+		DMA2D->BGMAR	=	dst;
+		DMA2D->BGOR		=	dst_pitch - w;
+	}
+	DMA2D->OPFCCR	=	DMA2D_OUTPUT_RGB565;
+	DMA2D->OMAR		=	dst;
+	DMA2D->OOR		=	dst_pitch - w;
+	DMA2D->NLR		=	((uint32_t)w << 16) | h;
+	DMA2D->CR	  |=	DMA2D_CR_START;
+}
+
+/**
+  * @brief  Convert a block to RGB565 (pixel format conversion, no blending).
+  * @note   L8 / AL44 / AL88 sources use the CLUT loaded by DMA2D_load_clut().
+  * @param  src        first pixel of the block, any DMA2D_INPUT_xxx format
+  * @param  src_pitch  source line length in pixels
+  * @param  color_mode DMA2D_INPUT_xxx of the source
+  * @param  dst        first pixel of the block in the RGB565 buffer
+  * @param  dst_pitch  RGB565 buffer line length in pixels
+  * @param  w, h       block size in pixels
+  * @retval None
+  */
+void DMA2D_convert_rect(uint32_t src, uint16_t src_pitch, uint32_t color_mode, uint32_t dst, uint16_t dst_pitch, uint16_t w, uint16_t h)
+{
+	if (w == 0 || h == 0)
+	{
+		return;
+	}
+
+	while (DMA2D->CR & DMA2D_CR_START) ;
+	DMA2D->CR		=	DMA2D_M2M_PFC;
+	DMA2D->FGPFCCR	=	color_mode;
+	DMA2D->FGMAR	=	src;
+	DMA2D->FGOR		=	src_pitch - w;
+	DMA2D->OPFCCR	=	DMA2D_OUTPUT_RGB565;
+	DMA2D->OMAR		=	dst;
+	DMA2D->OOR		=	dst_pitch - w;
+	DMA2D->NLR		=	((uint32_t)w << 16) | h;
+	DMA2D->CR	  |=	DMA2D_CR_START;
+
+	while (DMA2D->CR & DMA2D_CR_START) ;
+}
+
+/**
+  * @brief  Start converting JPEG codec output (YCbCr MCU blocks) to RGB565, does not wait for the end of the job.
+  * @note   The blocks of a whole number of MCU rows must follow each other from src: Y blocks of an MCU
+  *         in raster order, then one Cb and one Cr block (JPEG codec decoder output format).
+  * @param  src        first MCU of the first MCU row
+  * @param  mcu_pitch  MCU row width in pixels, a multiple of the MCU width (8 for 4:4:4, 16 otherwise)
+  * @param  css        DMA2D_NO_CSS / DMA2D_CSS_422 / DMA2D_CSS_420
+  * @param  dst        first pixel of the block in the RGB565 buffer
+  * @param  dst_pitch  RGB565 buffer line length in pixels
+  * @param  w, h       block size in pixels, w <= mcu_pitch
+  * @retval None
+  */
+void DMA2D_convert_ycbcr_start(uint32_t src, uint16_t mcu_pitch, uint32_t css, uint32_t dst, uint16_t dst_pitch, uint16_t w, uint16_t h)
+{
+	if (w == 0 || h == 0)
+	{
+		return;
+	}
+
+	while (DMA2D->CR & DMA2D_CR_START) ;
+	DMA2D->CR		=	DMA2D_M2M_PFC;
+	DMA2D->FGPFCCR	=	(css << DMA2D_FGPFCCR_CSS_Pos) |				//	色度子采样, 4:4:4 / 4:2:2 / 4:2:0
+						DMA2D_INPUT_YCBCR;
+	DMA2D->FGMAR	=	src;
+	DMA2D->FGOR		=	mcu_pitch - w;								//	跳过 MCU 行右边多出的像素
+	DMA2D->OPFCCR	=	DMA2D_OUTPUT_RGB565;
+	DMA2D->OMAR		=	dst;
+	DMA2D->OOR		=	dst_pitch - w;
+	DMA2D->NLR		=	((uint32_t)w << 16) | h;
+	DMA2D->CR	  |=	DMA2D_CR_START;
+}
+
+/**
+  * @brief  Start blending a block with its own alpha (ARGB8888 / ARGB4444 / ARGB1555) onto an RGB565 buffer,
+  *         does not wait for the end of the job (see DMA2D_wait()).
+  * @param  src        first pixel of the block
+  * @param  src_pitch  source line length in pixels
+  * @param  color_mode DMA2D_INPUT_xxx of the source
+  * @param  alpha      multiplied with the pixel alpha, 255: unchanged
+  * @param  dst        first pixel of the block in the RGB565 buffer
+  * @param  dst_pitch  RGB565 buffer line length in pixels
+  * @param  w, h       block size in pixels
+  * @retval None
+  */
+void DMA2D_blend_rect_start(uint32_t src, uint16_t src_pitch, uint32_t color_mode, uint8_t alpha, uint32_t dst, uint16_t dst_pitch, uint16_t w, uint16_t h)
+{
+	if (w == 0 || h == 0)
+	{
+		return;
+	}
+
+	while (DMA2D->CR & DMA2D_CR_START) ;
+	DMA2D->CR		=	DMA2D_M2M_BLEND;
+	DMA2D->FGPFCCR	=	((uint32_t)alpha << DMA2D_FGPFCCR_ALPHA_Pos) |	//	像素 alpha * 全局 alpha
+						(DMA2D_COMBINE_ALPHA << DMA2D_FGPFCCR_AM_Pos) |
+						color_mode;
+	DMA2D->FGMAR	=	src;
+	DMA2D->FGOR		=	src_pitch - w;
+	DMA2D->BGPFCCR	=	DMA2D_INPUT_RGB565;
+	DMA2D->BGMAR	=	dst;
+	DMA2D->BGOR		=	dst_pitch - w;
+	DMA2D->OPFCCR	=	DMA2D_OUTPUT_RGB565;
+	DMA2D->OMAR		=	dst;
+	DMA2D->OOR		=	dst_pitch - w;
+	DMA2D->NLR		=	((uint32_t)w << 16) | h;
+	DMA2D->CR	  |=	DMA2D_CR_START;
+}
+
+/**
+  * @brief  Blend a block with its own alpha onto an RGB565 buffer and wait for the end of the job.
+  * @param  see DMA2D_blend_rect_start()
+  * @retval None
+  */
+void DMA2D_blend_rect(uint32_t src, uint16_t src_pitch, uint32_t color_mode, uint8_t alpha, uint32_t dst, uint16_t dst_pitch, uint16_t w, uint16_t h)
+{
+	DMA2D_blend_rect_start(src, src_pitch, color_mode, alpha, dst, dst_pitch, w, h);
+
+	while (DMA2D->CR & DMA2D_CR_START) ;
+}
+
+/**
+  * @brief  Wait until the running DMA2D job, if any, has finished.
+  * @retval None
+  */
+void DMA2D_wait(void)
+{
+	while (DMA2D->CR & DMA2D_CR_START) ;
+}
 /* USER CODE END 1 */
@@ -28,7 +28,22 @@
 /* USER CODE BEGIN Includes */
 #include "async_uart.h"
 #include "key.h"
+#include "gfx_dirty.h"
+#include "jpeg_codec.h"
+#include "lcd_l8.h"
+#include "lcd_present.h"
+#include "lcd_shot.h"
+#include "lcd_vfb.h"
+#include "mdma_fetch.h"
+#include "touch_gesture.h"
+#include "touch_gt911.h"
 #include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#if LCD_USE_L8 && LCD_USE_VFB
+#error "LCD_USE_L8 and LCD_USE_VFB both use GRAM, enable only one"
+#endif
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -38,7 +53,11 @@
 
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
-
+#ifndef TOUCH_TRACE
+#define TOUCH_TRACE 0       /* 1: print every touch point in the host test trace format (Code/host/test/touch) */
+#endif
+#define SHOT_UART_RESERVE   256     /* TX ring bytes a screenshot leaves free for log lines */
+#define TOUCH_CURSOR_SIZE   24      /* Square drawn at the predicted finger position */
 /* USER CODE END PD */
 
 /* Private macro -------------------------------------------------------------*/
@@ -51,6 +70,10 @@
 /* USER CODE BEGIN PV */
 extern async_uart_instance_t uart1;
 __attribute__((section(".sram_noncache_bss"))) uint8_t uart1_rx_buf[256];
+
+gfx_dirty_t lcd_dirty;
+touch_gesture_ctx_t touch_gestures;
+static gfx_rect_t touch_cursor;                     /* Empty while no finger is down */
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
@@ -62,7 +85,150 @@ void User_MPU_Config(void);
 
 /* Private user code ---------------------------------------------------------*/
 /* USER CODE BEGIN 0 */
+/* Redraw one dirty area: background, then the part of the touch cursor inside it */
+static void lcd_render_rect(const gfx_rect_t *rect, void *user)
+{
+  gfx_rect_t cursor;
+  bool has_cursor = gfx_rect_intersect(rect, &touch_cursor, &cursor);
+
+#if LCD_USE_L8
+  uint8_t index = *(const uint8_t *)user;
+
+  DMA2D_fill_rect_l8(lcd_l8_get_draw_buffer(), LCD_L8_WIDTH, rect->x, rect->y, rect->w, rect->h, index);
+  if (has_cursor)
+  {
+    DMA2D_fill_rect_l8(lcd_l8_get_draw_buffer(), LCD_L8_WIDTH, cursor.x, cursor.y, cursor.w, cursor.h,
+                       lcd_l8_index_rgb332(0xFF, 0xFF, 0xFF));
+  }
+#elif LCD_USE_VFB
+  uint16_t color = *(const uint16_t *)user;
+
+  DMA2D_fill_rect_fb(lcd_vfb_get_draw_buffer(), LCD_VFB_PITCH, rect->x, rect->y, rect->w, rect->h, color);
+  if (has_cursor)
+  {
+    DMA2D_fill_rect_fb(lcd_vfb_get_draw_buffer(), LCD_VFB_PITCH, cursor.x, cursor.y, cursor.w, cursor.h, 0xFFFF);
+  }
+#else
+  uint16_t color = *(const uint16_t *)user;
+
+  DMA2D_fill_rect(rect->x, rect->y, rect->w, rect->h, color);
+  if (has_cursor)
+  {
+    DMA2D_fill_rect(cursor.x, cursor.y, cursor.w, cursor.h, 0xFFFF);
+  }
+#endif
+}
+
+/* Move the touch cursor to where the finger will be when the frame shows, damage old and new position */
+static void touch_cursor_update(void)
+{
+  gfx_rect_t cursor = { 0, 0, 0, 0 };
+  int16_t x, y;
+
+  if (touch_gesture_predict(&touch_gestures, &x, &y))
+  {
+    cursor.x = (int16_t)(x - TOUCH_CURSOR_SIZE / 2);
+    cursor.y = (int16_t)(y - TOUCH_CURSOR_SIZE / 2);
+    cursor.w = TOUCH_CURSOR_SIZE;
+    cursor.h = TOUCH_CURSOR_SIZE;
+  }
+  if (memcmp(&cursor, &touch_cursor, sizeof(cursor)) == 0)
+  {
+    return;
+  }
+  if (!gfx_rect_is_empty(&touch_cursor))
+  {
+    gfx_dirty_add(&lcd_dirty, &touch_cursor);
+  }
+  if (!gfx_rect_is_empty(&cursor))
+  {
+    gfx_dirty_add(&lcd_dirty, &cursor);
+  }
+  touch_cursor = cursor;
+}
+
+#if LCD_USE_L8
+/* After a swap the new back buffer is one frame old, bring the redrawn areas over */
+static void lcd_sync_rect(const gfx_rect_t *rect, void *user)
+{
+  (void)user;
+  DMA2D_copy_rect_l8(lcd_l8_get_show_buffer(), lcd_l8_get_draw_buffer(), LCD_L8_WIDTH,
+                     rect->x, rect->y, rect->w, rect->h);
+}
+#elif LCD_USE_VFB
+/* Same for the GFXMMU buffers, only called after a swap (two buffers) */
+static void lcd_sync_rect(const gfx_rect_t *rect, void *user)
+{
+  uint32_t offset = ((uint32_t)rect->y * LCD_VFB_PITCH + rect->x) * 2;
+
+  (void)user;
+  DMA2D_copy_rect(lcd_vfb_get_show_buffer() + offset, LCD_VFB_PITCH, lcd_vfb_get_draw_buffer() + offset, LCD_VFB_PITCH,
+                  rect->w, rect->h, DMA2D_INPUT_RGB565);
+}
+#endif
+
+/* Screenshot packets go to the UART TX ring only while log lines still fit after them */
+static uint32_t shot_uart_sink(const uint8_t *data, uint32_t len, void *user)
+{
+  async_uart_instance_t *uart = (async_uart_instance_t *)user;
+
+  if (rb_get_free(&uart->tx_buffer) < len + SHOT_UART_RESERVE)
+  {
+    return 0;
+  }
+  return (async_uart_send(uart, (uint8_t *)data, len) > 0) ? len : 0;
+}
+
+/* "shot" or "shot x y w h" on the UART streams the shown frame, Tools/fbshot turns it into a PNG.
+ * The main loop holds buffer swaps until the capture ends. */
+static void shot_command(void)
+{
+  char line[32];
+  unsigned int x = 0, y = 0, w = GFX_LCD_WIDTH, h = GFX_LCD_HEIGHT;
+  lcd_shot_error_t err;
+  int n;
+
+  if (async_uart_read_line(&uart1, line, sizeof(line)) == 0 || strncmp(line, "shot", 4) != 0)
+  {
+    return;
+  }
+  n = sscanf(&line[4], "%u %u %u %u", &x, &y, &w, &h);
+  /* Unsigned input: "-1" reads as UINT_MAX, so no sum that could wrap */
+  if ((n != EOF && n != 4) || x >= GFX_LCD_WIDTH || w == 0 || w > GFX_LCD_WIDTH - x ||
+      y >= GFX_LCD_HEIGHT || h == 0 || h > GFX_LCD_HEIGHT - y)
+  {
+    async_usart_printf(&uart1, "usage: shot [x y w h], inside %ux%u\r\n", GFX_LCD_WIDTH, GFX_LCD_HEIGHT);
+    return;
+  }
+#if LCD_USE_L8
+  err = lcd_shot_start(lcd_l8_get_show_buffer(), LCD_L8_WIDTH, LCD_L8_HEIGHT, LCD_SHOT_L8, lcd_l8_default_clut(), x, y, w, h);
+#elif LCD_USE_VFB
+  err = lcd_shot_start(lcd_vfb_get_show_buffer(), LCD_VFB_PITCH, LCD_VFB_HEIGHT, LCD_SHOT_RGB565, NULL, x, y, w, h);
+#else
+  err = lcd_shot_start(GFX_FB_ADDR, GFX_LCD_WIDTH, GFX_LCD_HEIGHT, LCD_SHOT_RGB565, NULL, x, y, w, h);
+#endif
+  if (err != LCD_SHOT_OK)
+  {
+    async_usart_printf(&uart1, "shot: error %d\r\n", (int)err);
+  }
+}
+
+static void touch_log_gestures(const touch_gesture_t *g, uint8_t count)
+{
+  static const char *const names[] = { "tap", "long press", "drag", "swipe", "pinch", "rotate" };
+  static const char *const phases[] = { "", " begin", " update", " end" };
 
+  for (uint8_t i = 0; i < count; i++, g++)
+  {
+    if (g->phase == TOUCH_PHASE_UPDATE)
+    {
+      continue;
+    }
+    async_usart_printf(&uart1, "gesture %s%s (%d, %d) d (%d, %d) v (%ld, %ld) scale %ld angle %ld\r\n",
+                       names[g->type], phases[g->phase], (int)g->x, (int)g->y, (int)g->dx, (int)g->dy,
+                       (long)g->vx, (long)g->vy, (long)g->scale, (long)g->angle);
+  }
+}
 /* USER CODE END 0 */
 
 /**
@@ -74,6 +240,7 @@ int main(void)
 
   /* USER CODE BEGIN 1 */
   volatile uint32_t start_tick = 0;
+  uint32_t touch_tick = 0;                          /* Newest touch event of this frame, 0: none */
 #if 0 // Remove defult MPU configuration
   /* USER CODE END 1 */
 
@@ -112,6 +279,7 @@ int main(void)
 
   async_uart_init();    // send use sofeware ring buffer
   HAL_UARTEx_ReceiveToIdle_DMA(&huart1, uart1_rx_buf, 256);
+  lcd_shot_init(shot_uart_sink, &uart1);
   
   async_usart_printf(&uart1, "\r\n\r\n\r\nApplication Start...\r\n");
   async_usart_printf(&uart1, "Compiled at %s %s\r\n", __DATE__, __TIME__);
@@ -119,7 +287,56 @@ int main(void)
   async_usart_printf(&uart1, "Turn LCD Backlight!\r\n");
   HAL_GPIO_WritePin(LCD_BL_GPIO_Port, LCD_BL_Pin, GPIO_PIN_SET);
 
+  lcd_present_init();
+  jpeg_codec_init();
+  mdma_fetch_init();
+  {
+    touch_info_t touch_info;
+    touch_error_t touch_err = touch_gt911_init(&touch_info);
+
+    if (touch_err == TOUCH_OK)
+    {
+      async_usart_printf(&uart1, "GT911: %ux%u, firmware 0x%04x\r\n",
+                         (unsigned)touch_info.res_x, (unsigned)touch_info.res_y, (unsigned)touch_info.firmware);
+    }
+    else
+    {
+      async_usart_printf(&uart1, "GT911: init failed (%d)\r\n", (int)touch_err);
+    }
+    touch_gesture_init(&touch_gestures);
+  }
+
+#if LCD_USE_L8
+  lcd_l8_init();
+  DMA2D_fill_rect_l8(LCD_L8_FB0_ADDR, LCD_L8_WIDTH, 0, 0, LCD_L8_WIDTH, LCD_L8_HEIGHT, lcd_l8_index_rgb332(0, 0, 0xFF));
+  DMA2D_fill_rect_l8(LCD_L8_FB1_ADDR, LCD_L8_WIDTH, 0, 0, LCD_L8_WIDTH, LCD_L8_HEIGHT, lcd_l8_index_rgb332(0, 0, 0xFF));
+#elif LCD_USE_VFB
+  {
+    static const lcd_vfb_shape_t shape = {
+      LCD_VFB_BEZEL_LEFT, LCD_VFB_BEZEL_RIGHT, LCD_VFB_BEZEL_TOP, LCD_VFB_BEZEL_BOTTOM, LCD_VFB_BEZEL_RADIUS
+    };
+    static lcd_vfb_span_t spans[LCD_VFB_HEIGHT];
+    lcd_vfb_info_t info;
+
+    /* Two buffers when the hidden pixels free enough GRAM, the rest is left for the asset cache */
+    if (lcd_vfb_shape_spans(&shape, spans) != LCD_VFB_OK ||
+        (lcd_vfb_init(spans, 2, &info) != LCD_VFB_OK && lcd_vfb_init(spans, 1, &info) != LCD_VFB_OK))
+    {
+      Error_Handler();
+    }
+    async_usart_printf(&uart1, "GFXMMU: %u lines, %u bytes per frame, %u buffer(s), %u bytes spare at 0x%08x\r\n",
+                       (unsigned)info.lines, (unsigned)info.frame_bytes, (unsigned)info.buffers,
+                       (unsigned)info.spare_size, (unsigned)info.spare_addr);
+    for (uint8_t n = 0; n < info.buffers; n++)
+    {
+      DMA2D_fill_rect_fb(lcd_vfb_get_buffer(n), LCD_VFB_PITCH, 0, 0, LCD_VFB_WIDTH, LCD_VFB_HEIGHT, 0x001F);
+    }
+  }
+#else
   DMA2D_fill_screen();
+#endif
+
+  gfx_dirty_init(&lcd_dirty, NULL);
   /* USER CODE END 2 */
 
   /* Infinite loop */
@@ -137,6 +354,69 @@ int main(void)
     }
     vKeySacnTask();
     KeyFunctionTest();
+
+    /* Touch events of this frame, before anything is drawn */
+    {
+      touch_event_t touch;
+      touch_gesture_t gestures[TOUCH_GESTURE_OUT_MAX];
+      uint8_t count;
+
+      touch_tick = 0;
+      while (touch_gt911_read(&touch))
+      {
+#if TOUCH_TRACE
+        for (uint8_t i = 0; i < touch.count; i++)
+        {
+          async_usart_printf(&uart1, "%u %u %c %u %u %u\r\n", (unsigned)touch.tick, (unsigned)touch.points[i].id,
+                             "dmu"[touch.points[i].action], (unsigned)touch.points[i].x, (unsigned)touch.points[i].y,
+                             (unsigned)touch.points[i].size);
+        }
+#endif
+        count = touch_gesture_feed(&touch_gestures, &touch, gestures);
+        touch_log_gestures(gestures, count);
+        touch_tick = touch.tick;
+      }
+      count = touch_gesture_tick(&touch_gestures, HAL_GetTick(), gestures);
+      touch_log_gestures(gestures, count);
+      touch_cursor_update();
+    }
+
+    /* Double buffered: no swap while a screenshot reads the shown buffer, the capture stays one frame.
+     * Single buffered frames are drawn in place and show up in the rows not sent yet. */
+    if(!gfx_dirty_is_empty(&lcd_dirty) && !((LCD_USE_L8 || LCD_USE_VFB) && lcd_shot_busy()))
+    {
+#if LCD_USE_L8
+      gfx_dirty_t frame_dirty = lcd_dirty;
+      uint8_t bg_index = lcd_l8_index_rgb332(0, 0, 0xFF);
+
+      gfx_dirty_flush(&lcd_dirty, lcd_render_rect, &bg_index);
+      lcd_l8_swap();
+      lcd_l8_wait_swap();
+      gfx_dirty_flush(&frame_dirty, lcd_sync_rect, NULL);
+#elif LCD_USE_VFB
+      gfx_dirty_t frame_dirty = lcd_dirty;
+      uint16_t bg_color = 0x001F;
+
+      gfx_dirty_flush(&lcd_dirty, lcd_render_rect, &bg_color);
+      if (lcd_vfb_swap() == 0)
+      {
+        lcd_vfb_wait_swap();
+        gfx_dirty_flush(&frame_dirty, lcd_sync_rect, NULL);
+      }
+#else
+      uint16_t bg_color = 0x001F;
+      gfx_dirty_flush(&lcd_dirty, lcd_render_rect, &bg_color);
+#endif
+      /* The newest touch is on screen now: display latency for the predictor */
+      if (touch_tick != 0)
+      {
+        touch_gesture_latency(&touch_gestures, touch_tick, HAL_GetTick());
+      }
+    }
+
+    /* Screenshot: a few packets per frame, never waits for the UART */
+    shot_command();
+    lcd_shot_poll();
   }
   /* USER CODE END 3 */
 }
@@ -260,6 +540,24 @@ void User_MPU_Config(void)
   MPU_InitStruct.IsBufferable = MPU_ACCESS_NOT_BUFFERABLE;
 
   HAL_MPU_ConfigRegion(&MPU_InitStruct);
+
+#if LCD_USE_VFB
+  /** GFXMMU virtual buffers, same attributes as GRAM behind them (DMA2D / LTDC write and read there too)
+  */
+  MPU_InitStruct.Enable = MPU_REGION_ENABLE;
+  MPU_InitStruct.Number = MPU_REGION_NUMBER3;
+  MPU_InitStruct.BaseAddress = GFXMMU_VIRTUAL_BUFFERS_BASE;
+  MPU_InitStruct.Size = MPU_REGION_SIZE_16MB;
+  MPU_InitStruct.SubRegionDisable = 0x00;
+  MPU_InitStruct.TypeExtField = MPU_TEX_LEVEL0;
+  MPU_InitStruct.AccessPermission = MPU_REGION_FULL_ACCESS;
+  MPU_InitStruct.DisableExec = MPU_INSTRUCTION_ACCESS_DISABLE;
+  MPU_InitStruct.IsShareable = MPU_ACCESS_NOT_SHAREABLE;
+  MPU_InitStruct.IsCacheable = MPU_ACCESS_CACHEABLE;
+  MPU_InitStruct.IsBufferable = MPU_ACCESS_NOT_BUFFERABLE;
+
+  HAL_MPU_ConfigRegion(&MPU_InitStruct);
+#endif
   /* Enables the MPU */
   HAL_MPU_Enable(MPU_PRIVILEGED_DEFAULT);
 }
@@ -22,6 +22,8 @@
 
 /* USER CODE BEGIN 0 */
 #include "async_uart.h"
+
+extern uint8_t uart1_rx_buf[256];
 /* USER CODE END 0 */
 
 UART_HandleTypeDef huart1;
@@ -220,6 +222,8 @@ __attribute__((section(".fast_code"))) void HAL_UARTEx_RxEventCallback(UART_Hand
   test_cnt++;
   if(huart->Instance == USART1)
   {
+    /* Idle, half and full events of the circular DMA: Size is the position in uart1_rx_buf */
+    async_uart_rx_callback(&huart1, uart1_rx_buf, sizeof(uart1_rx_buf), Size);
     if(huart->RxEventType == HAL_UART_RXEVENT_IDLE)
     {
       test_cnt++;
@@ -0,0 +1,189 @@
+/**
+ * @file core_cm7.h
+ * @brief Host replacement for the CMSIS Cortex-M7 core header
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note Picked up before Drivers/CMSIS/Include on the host build. Keeps the
+ *       CMSIS names used by the HAL and the application, core peripherals
+ *       live in the simulated address space, intrinsics call into the
+ *       simulator (interrupt masking, WFI) or do nothing (barriers, caches).
+ */
+
+#ifndef __CORE_CM7_H_GENERIC
+#define __CORE_CM7_H_GENERIC
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define __CM7_CMSIS_VERSION_MAIN        5U
+#define __CM7_CMSIS_VERSION_SUB         1U
+#define __CORTEX_M                      7U
+
+#define __I                             volatile const
+#define __O                             volatile
+#define __IO                            volatile
+#define __IM                            volatile const
+#define __OM                            volatile
+#define __IOM                           volatile
+
+#define __ASM                           __asm
+#define __INLINE                        inline
+#define __STATIC_INLINE                 static inline
+#define __STATIC_FORCEINLINE            static inline __attribute__((always_inline))
+#define __NO_RETURN                     __attribute__((__noreturn__))
+#define __USED                          __attribute__((used))
+#define __WEAK                          __attribute__((weak))
+#define __PACKED                        __attribute__((packed, aligned(1)))
+#define __PACKED_STRUCT                 struct __attribute__((packed, aligned(1)))
+#define __ALIGNED(x)                    __attribute__((aligned(x)))
+#define __RESTRICT                      __restrict
+#define __COMPILER_BARRIER()            __asm volatile("" ::: "memory")
+
+/* Provided by the simulator (sim_core.c) */
+void sim_irq_disable(void);
+void sim_irq_enable(void);
+uint32_t sim_irq_get_primask(void);
+void sim_irq_set_primask(uint32_t primask);
+void sim_wfi(void);
+void sim_breakpoint(void);
+void sim_nop(void);
+
+#define __NOP()                         sim_nop()
+#define __DSB()                         __sync_synchronize()
+#define __ISB()                         __sync_synchronize()
+#define __DMB()                         __sync_synchronize()
+#define __WFI()                         sim_wfi()
+#define __WFE()                         sim_wfi()
+#define __SEV()                         __COMPILER_BARRIER()
+#define __BKPT(value)                   sim_breakpoint()
+
+__STATIC_INLINE void __disable_irq(void)            { sim_irq_disable(); }
+__STATIC_INLINE void __enable_irq(void)             { sim_irq_enable(); }
+__STATIC_INLINE uint32_t __get_PRIMASK(void)        { return sim_irq_get_primask(); }
+__STATIC_INLINE void __set_PRIMASK(uint32_t p)      { sim_irq_set_primask(p); }
+
+__STATIC_INLINE uint32_t __REV(uint32_t v)          { return __builtin_bswap32(v); }
+__STATIC_INLINE uint32_t __REV16(uint32_t v)        { return ((v & 0xFF00FF00UL) >> 8) | ((v & 0x00FF00FFUL) << 8); }
+__STATIC_INLINE uint8_t __CLZ(uint32_t v)           { return (v == 0) ? 32U : (uint8_t)__builtin_clz(v); }
+__STATIC_INLINE uint32_t __RBIT(uint32_t v)
+{
+    uint32_t r = 0;
+    for (int i = 0; i < 32; i++) {
+        r = (r << 1) | (v & 1U);
+        v >>= 1;
+    }
+    return r;
+}
+__STATIC_INLINE int32_t __SSAT(int32_t v, uint32_t bits)
+{
+    int32_t max = (int32_t)((1UL << (bits - 1U)) - 1U);
+    int32_t min = -1 - max;
+    return (v > max) ? max : ((v < min) ? min : v);
+}
+__STATIC_INLINE uint32_t __USAT(int32_t v, uint32_t bits)
+{
+    uint32_t max = (1UL << bits) - 1U;
+    return (v < 0) ? 0U : (((uint32_t)v > max) ? max : (uint32_t)v);
+}
+
+/* ---------------------------------------------------------------------------
+ * Core peripherals, only the registers the firmware touches. They are mapped
+ * at their real addresses by sim_init() so plain reads and writes work.
+ */
+typedef struct {
+    __IOM uint32_t CTRL;
+    __IOM uint32_t CYCCNT;
+    __IOM uint32_t CPICNT;
+    __IOM uint32_t EXCCNT;
+    __IOM uint32_t SLEEPCNT;
+    __IOM uint32_t LSUCNT;
+    __IOM uint32_t FOLDCNT;
+    __IM  uint32_t PCSR;
+    uint32_t RESERVED0[1004];
+    __OM  uint32_t LAR;
+    __IM  uint32_t LSR;
+} DWT_Type;
+
+typedef struct {
+    __IOM uint32_t DHCSR;
+    __OM  uint32_t DCRSR;
+    __IOM uint32_t DCRDR;
+    __IOM uint32_t DEMCR;
+} CoreDebug_Type;
+
+typedef struct {
+    __IOM uint32_t CTRL;
+    __IOM uint32_t LOAD;
+    __IOM uint32_t VAL;
+    __IM  uint32_t CALIB;
+} SysTick_Type;
+
+#define DWT_CTRL_CYCCNTENA_Pos          0U
+#define DWT_CTRL_CYCCNTENA_Msk          (1UL << DWT_CTRL_CYCCNTENA_Pos)
+#define CoreDebug_DEMCR_TRCENA_Pos      24U
+#define CoreDebug_DEMCR_TRCENA_Msk      (1UL << CoreDebug_DEMCR_TRCENA_Pos)
+
+#define SysTick_CTRL_CLKSOURCE_Pos      2U
+#define SysTick_CTRL_CLKSOURCE_Msk      (1UL << SysTick_CTRL_CLKSOURCE_Pos)
+#define SysTick_CTRL_TICKINT_Pos        1U
+#define SysTick_CTRL_TICKINT_Msk        (1UL << SysTick_CTRL_TICKINT_Pos)
+#define SysTick_CTRL_ENABLE_Pos         0U
+#define SysTick_CTRL_ENABLE_Msk         (1UL)
+
+#define SCS_BASE                        (0xE000E000UL)
+#define DWT_BASE                        (0xE0001000UL)
+#define CoreDebug_BASE                  (0xE000EDF0UL)
+#define SysTick_BASE                    (SCS_BASE + 0x0010UL)
+
+#define DWT                             ((DWT_Type *)DWT_BASE)
+#define CoreDebug                       ((CoreDebug_Type *)CoreDebug_BASE)
+#define SysTick                         ((SysTick_Type *)SysTick_BASE)
+
+/* MPU register layout is not simulated, keep the HAL MPU constants compiling */
+#define MPU_RASR_ENABLE_Pos             0U
+#define MPU_RASR_SIZE_Pos               1U
+#define MPU_RASR_SRD_Pos                8U
+#define MPU_RASR_B_Pos                  16U
+#define MPU_RASR_C_Pos                  17U
+#define MPU_RASR_S_Pos                  18U
+#define MPU_RASR_TEX_Pos                19U
+#define MPU_RASR_AP_Pos                 24U
+#define MPU_RASR_XN_Pos                 28U
+
+/* Interrupt controller, handled by the simulator */
+void sim_nvic_enable(IRQn_Type irq);
+void sim_nvic_disable(IRQn_Type irq);
+void sim_nvic_set_priority(IRQn_Type irq, uint32_t priority);
+
+__STATIC_INLINE void NVIC_EnableIRQ(IRQn_Type irq)                      { sim_nvic_enable(irq); }
+__STATIC_INLINE void NVIC_DisableIRQ(IRQn_Type irq)                     { sim_nvic_disable(irq); }
+__STATIC_INLINE void NVIC_SetPriority(IRQn_Type irq, uint32_t priority) { sim_nvic_set_priority(irq, priority); }
+__STATIC_INLINE void NVIC_SetPriorityGrouping(uint32_t group)           { (void)group; }
+__STATIC_INLINE uint32_t NVIC_GetPriorityGrouping(void)                 { return 0; }
+__STATIC_INLINE uint32_t NVIC_EncodePriority(uint32_t g, uint32_t p, uint32_t s) { (void)g; return (p << 4) | s; }
+__STATIC_INLINE void NVIC_SystemReset(void)                             { sim_breakpoint(); }
+
+/* Caches: host memory is coherent, maintenance is a no-op */
+__STATIC_INLINE void SCB_EnableICache(void)                             { }
+__STATIC_INLINE void SCB_DisableICache(void)                            { }
+__STATIC_INLINE void SCB_InvalidateICache(void)                         { }
+__STATIC_INLINE void SCB_EnableDCache(void)                             { }
+__STATIC_INLINE void SCB_DisableDCache(void)                            { }
+__STATIC_INLINE void SCB_InvalidateDCache(void)                         { }
+__STATIC_INLINE void SCB_CleanDCache(void)                              { }
+__STATIC_INLINE void SCB_CleanInvalidateDCache(void)                    { }
+__STATIC_INLINE void SCB_InvalidateDCache_by_Addr(volatile void *a, int32_t s)      { (void)a; (void)s; }
+__STATIC_INLINE void SCB_CleanDCache_by_Addr(volatile void *a, int32_t s)           { (void)a; (void)s; }
+__STATIC_INLINE void SCB_CleanInvalidateDCache_by_Addr(volatile void *a, int32_t s) { (void)a; (void)s; }
+
+__STATIC_INLINE uint32_t SysTick_Config(uint32_t ticks)                 { (void)ticks; return 0; }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CORE_CM7_H_GENERIC */
@@ -0,0 +1,183 @@
+/**
+ * @file sim.h
+ * @brief Register level LTDC / DMA2D simulator, runs the firmware display code on a Linux host
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note The memory map of the STM32H7B0 is rebuilt at the real addresses
+ *       (AXI SRAM, DTCM, OSPI, peripherals), so firmware code that casts
+ *       addresses to uint32_t and programs DMA2D->xxx / LTDC->xxx runs
+ *       unchanged. Accesses to the DMA2D, LTDC, GFXMMU, MDMA, GPIOE and EXTI
+ *       register pages trap into the models, everything else is plain memory.
+ *       Host requirements: x86-64 Linux, non-PIE executable.
+ */
+
+#ifndef __SIM_H__
+#define __SIM_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SIM_CPU_HZ                      280000000UL     // SystemCoreClock after SystemClock_Config
+#define SIM_LTDC_PIXCLK_HZ              33000000UL      // PLL3R: 25 MHz / 25 * 330 / 10
+#define SIM_REG_ACCESS_CYCLES           8U              // CPU cycles charged per trapped register access
+#define SIM_SPIN_READS                  16U             // Identical status reads before time jumps to the next event
+#define SIM_OSPI_CYCLES_PER_BYTE        2U              // Memory mapped OSPI reads (octal DTR incl. command overhead), any bus master
+
+typedef enum {
+    SIM_DMA2D_M2M = 0,
+    SIM_DMA2D_M2M_PFC,
+    SIM_DMA2D_M2M_BLEND,
+    SIM_DMA2D_R2M,
+    SIM_DMA2D_M2M_BLEND_FG,
+    SIM_DMA2D_M2M_BLEND_BG,
+    SIM_DMA2D_CLUT_LOAD,
+    SIM_DMA2D_OP_COUNT,
+} sim_dma2d_op_t;
+
+typedef struct {
+    sim_dma2d_op_t  op;
+    uint32_t        width;
+    uint32_t        height;
+    uint64_t        pixels;                 // Output pixels (CLUT entries for CLUT_LOAD)
+    uint64_t        bytes_read;             // FG + BG + CLUT reads
+    uint64_t        bytes_written;
+    uint64_t        cycles;                 // Modelled DMA2D busy time in CPU cycles
+    uint64_t        bytes_ospi;             // Part of bytes_read fetched from OSPI, SIM_OSPI_CYCLES_PER_BYTE each
+} sim_dma2d_job_t;
+
+typedef struct {
+    uint32_t        jobs[SIM_DMA2D_OP_COUNT];
+    uint64_t        pixels[SIM_DMA2D_OP_COUNT];
+    uint64_t        bytes_read;
+    uint64_t        bytes_written;
+    uint64_t        cycles;
+    uint32_t        config_errors;          // Starts rejected for a bad configuration (CEIF)
+    sim_dma2d_job_t last;
+} sim_dma2d_stats_t;
+
+typedef struct {
+    uint32_t        jobs;                   // Transfers completed
+    uint32_t        aborts;                 // Channels disabled while transferring
+    uint32_t        errors;                 // Transfers refused with TEIF (unsupported configuration, bad address)
+    uint64_t        bytes;
+    uint64_t        cycles;                 // Modelled busy time, overlaps the CPU and DMA2D
+} sim_mdma_stats_t;
+
+typedef struct {
+    uint8_t         id;                     // Track id
+    uint16_t        x;                      // GT911 coordinates
+    uint16_t        y;
+    uint16_t        size;
+} sim_touch_point_t;
+
+typedef struct {
+    uint32_t        resets;                 // Rising edges of TOUCH_RESET
+    uint32_t        starts;                 // I2C (repeated) start conditions
+    uint32_t        reports;                // Reports loaded by sim_gt911_report()
+    uint32_t        missed;                 // Reports refused, the last one was not read yet
+    uint32_t        int_edges;              // INT edges that set the EXTI pending bit
+    uint64_t        bytes_read;             // Bytes sent by the GT911
+    uint64_t        bytes_written;          // Register bytes written by the MCU
+} sim_gt911_stats_t;
+
+typedef struct {
+    uint32_t        frames;                 // Vertical blanks since sim_init()
+    uint32_t        reloads;                // Shadow register reloads (immediate + vblank)
+    uint32_t        line_irqs;
+    uint32_t        reload_irqs;
+    uint32_t        clut_writes;
+    uint64_t        bytes_fetched;          // Layer frame buffer reads while scanning out
+} sim_ltdc_stats_t;
+
+/**
+ * @brief Map the memory regions and install the register traps, call once before any firmware code
+ */
+void sim_init(void);
+
+/**
+ * @brief Virtual time since sim_init(), advanced by register accesses, DMA2D jobs, WFI and sim_run_*
+ */
+uint64_t sim_cycles(void);
+uint64_t sim_time_us(void);
+
+/**
+ * @brief Advance virtual time, firing LTDC events and interrupts on the way
+ */
+void sim_run_cycles(uint64_t cycles);
+void sim_run_us(uint64_t us);
+
+/**
+ * @brief Run until the next vertical blank starts (first line after the active area)
+ */
+void sim_run_to_vblank(void);
+void sim_run_frames(uint32_t frames);
+
+/**
+ * @brief Charge CPU cycles without firing events, for modelled software work
+ */
+void sim_charge_cycles(uint64_t cycles);
+
+/**
+ * @brief Deliver pending interrupts if PRIMASK allows it
+ */
+void sim_poll_irq(void);
+
+/* DMA2D model */
+const sim_dma2d_stats_t *sim_dma2d_get_stats(void);
+void sim_dma2d_reset_stats(void);
+void sim_dma2d_set_trace(bool enable);
+
+/* MDMA model */
+const sim_mdma_stats_t *sim_mdma_get_stats(void);
+void sim_mdma_reset_stats(void);
+
+/* GT911 touch model */
+
+/**
+ * @brief Panel resolution and INT trigger (GT911 0x804D bits 1:0) the GT911 reports, resets its registers
+ */
+void sim_gt911_config(uint16_t res_x, uint16_t res_y, uint8_t trigger);
+
+/**
+ * @brief Fingers down now (0 .. 5), loaded into the point buffer and signalled on INT
+ * @return false if the last report was not read and cleared yet, this one is lost
+ * @note  The EXTI interrupt, if enabled, runs before it returns.
+ */
+bool sim_gt911_report(const sim_touch_point_t *points, uint32_t count);
+const sim_gt911_stats_t *sim_gt911_get_stats(void);
+void sim_gt911_reset_stats(void);
+
+/* LTDC model */
+const sim_ltdc_stats_t *sim_ltdc_get_stats(void);
+void sim_ltdc_reset_stats(void);
+
+/**
+ * @brief Compose the visible frame (background + enabled layers, active registers) as RGB888
+ * @param rgb  output, width * height * 3 bytes, width/height from the LTDC timing registers
+ * @return false if the LTDC is not enabled yet
+ */
+bool sim_ltdc_compose(uint8_t *rgb, uint32_t *width, uint32_t *height);
+
+/**
+ * @brief Sample the pixel of a layer at screen position (x, y) as ARGB8888
+ * @return false if the layer is disabled or (x, y) is outside its window
+ */
+bool sim_ltdc_layer_pixel(uint32_t layer, uint32_t x, uint32_t y, uint32_t *argb);
+
+/* PPM dumps */
+bool sim_dump_frame(const char *path);
+
+/**
+ * @brief Write a buffer in any DMA2D input format (DMA2D_INPUT_xxx) as binary PPM
+ * @param clut  ARGB8888 table for L8/L4/AL44/AL88, NULL for grey
+ */
+bool sim_dump_buffer(const char *path, uint32_t addr, uint32_t color_mode,
+                     uint32_t width, uint32_t height, uint32_t pitch, const uint32_t *clut);
+
+/* Pixel helpers shared by the models and the tests */
+uint32_t sim_pixel_bits(uint32_t color_mode);
+uint32_t sim_pixel_read(uint32_t addr, uint32_t index, uint32_t color_mode, const uint32_t *clut, uint32_t color);
+void sim_pixel_write(uint32_t addr, uint32_t index, uint32_t color_mode, uint32_t argb);
+
+#endif /* __SIM_H__ */
@@ -0,0 +1,484 @@
+/**
+ * @file sim_core.c
+ * @brief Memory map, register traps, virtual time and interrupt delivery
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note Register pages are mapped PROT_NONE. An access faults (SIGSEGV), the
+ *       handler opens the page and sets the trap flag, the instruction runs,
+ *       SIGTRAP closes the page again and calls the model with the result.
+ *       Interrupt handlers run at the end of a trap or at WFI / PRIMASK
+ *       changes, so they interrupt the firmware at a register access like
+ *       a real exception would.
+ */
+
+#define _GNU_SOURCE
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <ucontext.h>
+#include <sys/mman.h>
+
+#include "stm32h7xx.h"
+#include "sim_internal.h"
+
+#if !defined(__x86_64__) || !defined(__linux__)
+#error "The register trap needs x86-64 Linux (page fault error code and trap flag)"
+#endif
+
+#define SIM_MAX_DEVICES                 8
+#define SIM_EFLAGS_TF                   0x100
+#define SIM_PF_WRITE                    0x2
+#define SIM_WFI_MAX_LINES               (2U * 1100U)    // Wake up after about two frames without interrupt
+
+typedef struct {
+    uint32_t    base;
+    uint32_t    size;
+    const char *name;
+    int         prot;
+    int         flags;
+} sim_region_t;
+
+typedef struct {
+    uint32_t    base;
+    uint32_t    size;
+    uint8_t    *alias;
+    sim_pre_fn  pre;
+    sim_post_fn post;
+} sim_device_t;
+
+typedef struct {
+    IRQn_Type   irq;
+    bool      (*pending)(void);
+    void      (*handler)(void);
+} sim_vector_t;
+
+/* Bus master visible memory, same addresses as STM32H7B0XX_FLASH.ld */
+static const sim_region_t sim_regions[] = {
+    { 0x20000000UL, 0x00020000UL, "DTCM",       PROT_READ | PROT_WRITE, 0 },
+    { 0x24000000UL, 0x00100000UL, "AXI SRAM",   PROT_READ | PROT_WRITE, 0 },
+    { 0x30000000UL, 0x00020000UL, "AHB SRAM",   PROT_READ | PROT_WRITE, 0 },
+    { 0x90000000UL, 0x00800000UL, "OSPI",       PROT_READ | PROT_WRITE, 0 },
+    { 0x40000000UL, 0x20000000UL, "PERIPH",     PROT_READ | PROT_WRITE, MAP_NORESERVE },
+    { 0xE0000000UL, 0x00100000UL, "CORE",       PROT_READ | PROT_WRITE, 0 },
+};
+
+static const sim_vector_t sim_vectors[] = {
+    { LTDC_IRQn,    sim_ltdc_irq_pending,       LTDC_IRQHandler },
+    { LTDC_ER_IRQn, sim_ltdc_er_irq_pending,    LTDC_ER_IRQHandler },
+    { DMA2D_IRQn,   sim_dma2d_irq_pending,      DMA2D_IRQHandler },
+    { MDMA_IRQn,    sim_mdma_irq_pending,       MDMA_IRQHandler },
+    { EXTI4_IRQn,   sim_gt911_irq_pending,      EXTI4_IRQHandler },
+};
+
+uint64_t sim_now = 0;
+bool     sim_trace = false;
+
+static sim_device_t sim_devices[SIM_MAX_DEVICES];
+static uint32_t     sim_device_count = 0;
+static bool         sim_ready = false;
+
+/* Trap in flight between SIGSEGV and SIGTRAP */
+static volatile sim_device_t *trap_dev = NULL;
+static volatile uint32_t      trap_offset;
+static volatile bool          trap_write;
+static volatile uint32_t      trap_old;
+
+/* Busy-wait detection */
+static uint32_t spin_addr;
+static uint32_t spin_value;
+static uint32_t spin_count;
+
+/* Interrupt state */
+static uint32_t primask = 0;
+static uint32_t nvic_enabled[(160 + 31) / 32];
+static uint32_t isr_depth = 0;
+
+static sim_device_t *sim_device_find(uint32_t addr)
+{
+    for (uint32_t i = 0; i < sim_device_count; i++) {
+        if (addr >= sim_devices[i].base && addr - sim_devices[i].base < sim_devices[i].size) {
+            return &sim_devices[i];
+        }
+    }
+    return NULL;
+}
+
+static void sim_fatal(const char *msg, uintptr_t addr)
+{
+    fprintf(stderr, "sim: %s at 0x%08lx\n", msg, (unsigned long)addr);
+    abort();
+}
+
+static void sim_segv_handler(int sig, siginfo_t *si, void *ctx)
+{
+    ucontext_t *uc = (ucontext_t *)ctx;
+    uintptr_t addr = (uintptr_t)si->si_addr;
+    sim_device_t *dev;
+    uint32_t offset;
+
+    (void)sig;
+    dev = (addr >> 32) ? NULL : sim_device_find((uint32_t)addr);
+    if (dev == NULL || trap_dev != NULL) {
+        sim_fatal("unmapped access", addr);
+    }
+
+    offset = ((uint32_t)addr - dev->base) & ~3U;
+    trap_write = (uc->uc_mcontext.gregs[REG_ERR] & SIM_PF_WRITE) != 0;
+    trap_offset = offset;
+    if (dev->pre) {
+        dev->pre(offset, trap_write);
+    }
+    trap_old = *(volatile uint32_t *)(dev->alias + offset);
+    trap_dev = dev;
+
+    mprotect((void *)(uintptr_t)dev->base, dev->size, PROT_READ | PROT_WRITE);
+    uc->uc_mcontext.gregs[REG_EFL] |= SIM_EFLAGS_TF;
+}
+
+/* Next LTDC line start or MDMA completion, 0 if neither is coming */
+static uint64_t sim_cycles_to_next_event(void)
+{
+    uint64_t line = sim_ltdc_cycles_to_next_line();
+    uint64_t mdma = sim_mdma_cycles_to_done();
+
+    if (line == 0 || (mdma != 0 && mdma < line)) {
+        return mdma;
+    }
+    return line;
+}
+
+static void sim_trap_handler(int sig, siginfo_t *si, void *ctx)
+{
+    ucontext_t *uc = (ucontext_t *)ctx;
+    sim_device_t *dev = (sim_device_t *)trap_dev;
+    uint32_t offset = trap_offset;
+    uint32_t now_value;
+    bool written;
+
+    (void)sig;
+    (void)si;
+    if (dev == NULL) {
+        /* Not ours (breakpoint in a debugger session), let it through */
+        signal(SIGTRAP, SIG_DFL);
+        raise(SIGTRAP);
+        return;
+    }
+
+    mprotect((void *)(uintptr_t)dev->base, dev->size, PROT_NONE);
+    uc->uc_mcontext.gregs[REG_EFL] &= ~SIM_EFLAGS_TF;
+    trap_dev = NULL;
+
+    /* Read-modify-write instructions may report a read fault, compare the value too */
+    now_value = *(volatile uint32_t *)(dev->alias + offset);
+    written = trap_write || now_value != trap_old;
+
+    sim_advance(SIM_REG_ACCESS_CYCLES);
+    if (dev->post) {
+        dev->post(offset, written, trap_old);
+    }
+
+    if (written) {
+        spin_count = 0;
+    } else {
+        uint32_t addr = dev->base + offset;
+        uint32_t value = *(volatile uint32_t *)(dev->alias + offset);
+
+        if (addr == spin_addr && value == spin_value) {
+            if (++spin_count >= SIM_SPIN_READS) {
+                uint64_t skip = sim_cycles_to_next_event();
+
+                sim_advance(skip ? skip : 1000U);
+                spin_count = 0;
+            }
+        } else {
+            spin_addr = addr;
+            spin_value = value;
+            spin_count = 0;
+        }
+    }
+
+    sim_poll_irq();
+}
+
+void *sim_device_map(uint32_t base, uint32_t size, sim_pre_fn pre, sim_post_fn post)
+{
+    sim_device_t *dev;
+    int fd;
+
+    if (sim_device_count >= SIM_MAX_DEVICES || (base | size) & (SIM_PAGE_SIZE - 1)) {
+        sim_fatal("bad device mapping", base);
+    }
+
+    fd = memfd_create("sim_regs", 0);
+    if (fd < 0 || ftruncate(fd, size) != 0) {
+        sim_fatal("memfd_create failed", base);
+    }
+
+    dev = &sim_devices[sim_device_count++];
+    dev->base = base;
+    dev->size = size;
+    dev->pre = pre;
+    dev->post = post;
+    dev->alias = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (dev->alias == MAP_FAILED ||
+        mmap((void *)(uintptr_t)base, size, PROT_NONE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED) {
+        sim_fatal("device mmap failed", base);
+    }
+    close(fd);
+
+    return dev->alias;
+}
+
+/* Host statics a master may read, grouped by sim_sections.ld: the firmware
+ * .rodata and the AXI / AHB SRAM sections. Plain .data / .bss are DTCM. */
+extern char __sim_bus_data_start[];
+extern char __sim_bus_data_end[];
+extern char __sim_rodata_start[];
+extern char __sim_rodata_end[];
+
+bool sim_mem_valid(uint32_t addr, uint32_t size)
+{
+    uint64_t end = (uint64_t)addr + size;
+
+    if ((addr >= (uintptr_t)__sim_bus_data_start && end <= (uintptr_t)__sim_bus_data_end) ||
+        (addr >= (uintptr_t)__sim_rodata_start && end <= (uintptr_t)__sim_rodata_end)) {
+        return true;
+    }
+    if (SIM_GFXMMU_VIRTUAL(addr) && end <= SIM_GFXMMU_BASE + SIM_GFXMMU_SIZE) {
+        return true;                                        // Unbacked blocks read the default value
+    }
+    for (uint32_t i = 0; i < sizeof(sim_regions) / sizeof(sim_regions[0]); i++) {
+        const sim_region_t *r = &sim_regions[i];
+
+        if (r->base == 0x40000000UL || r->base == 0xE0000000UL) {
+            continue;                                       // Masters do not stream pixels from registers
+        }
+        if (r->base == 0x20000000UL) {
+            continue;                                       // DTCM is private to the CPU
+        }
+        if (addr >= r->base && end <= (uint64_t)r->base + r->size) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void sim_init(void)
+{
+    struct sigaction sa;
+    const char *trace;
+
+    if (sim_ready) {
+        return;
+    }
+
+    for (uint32_t i = 0; i < sizeof(sim_regions) / sizeof(sim_regions[0]); i++) {
+        const sim_region_t *r = &sim_regions[i];
+        void *p = mmap((void *)(uintptr_t)r->base, r->size, r->prot,
+                       MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE | r->flags, -1, 0);
+
+        if (p != (void *)(uintptr_t)r->base) {
+            fprintf(stderr, "sim: cannot map %s at 0x%08x, build the host target with -no-pie\n",
+                    r->name, r->base);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    memset(&sa, 0, sizeof(sa));
+    sigemptyset(&sa.sa_mask);
+    sa.sa_flags = SA_SIGINFO | SA_NODEFER;          // Interrupt handlers touch registers from inside a trap
+    sa.sa_sigaction = sim_segv_handler;
+    sigaction(SIGSEGV, &sa, NULL);
+    sa.sa_sigaction = sim_trap_handler;
+    sigaction(SIGTRAP, &sa, NULL);
+
+    trace = getenv("SIM_TRACE");
+    sim_trace = trace != NULL && trace[0] != '0';
+
+    sim_dma2d_init();
+    sim_gfxmmu_init();
+    sim_ltdc_init();
+    sim_mdma_init();
+    sim_gt911_init();
+    SystemCoreClock = SIM_CPU_HZ;
+    sim_ready = true;
+}
+
+/* ---------------------------------------------------------------------------
+ * Virtual time
+ */
+void sim_advance(uint64_t cycles)
+{
+    uint64_t from = sim_now;
+
+    sim_now += cycles;
+    if (DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) {
+        DWT->CYCCNT += (uint32_t)cycles;
+    }
+    sim_ltdc_advance(from, sim_now);
+    sim_mdma_advance(sim_now);
+}
+
+void sim_charge_cycles(uint64_t cycles)
+{
+    sim_advance(cycles);
+}
+
+uint64_t sim_cycles(void)
+{
+    return sim_now;
+}
+
+uint64_t sim_time_us(void)
+{
+    return sim_now / (SIM_CPU_HZ / 1000000UL);
+}
+
+void sim_run_cycles(uint64_t cycles)
+{
+    uint64_t end = sim_now + cycles;
+
+    while (sim_now < end) {
+        uint64_t step = sim_cycles_to_next_event();
+
+        if (step == 0 || step > end - sim_now) {
+            step = end - sim_now;
+        }
+        sim_advance(step);
+        sim_poll_irq();
+    }
+}
+
+void sim_run_us(uint64_t us)
+{
+    sim_run_cycles(us * (SIM_CPU_HZ / 1000000UL));
+}
+
+void sim_run_to_vblank(void)
+{
+    uint32_t frames = sim_ltdc_get_stats()->frames;
+
+    while (sim_ltdc_get_stats()->frames == frames) {
+        uint64_t step = sim_ltdc_cycles_to_next_line();
+
+        if (step == 0) {
+            return;                                         // LTDC off, no vblank will come
+        }
+        sim_advance(step);
+        sim_poll_irq();
+    }
+}
+
+void sim_run_frames(uint32_t frames)
+{
+    while (frames--) {
+        sim_run_to_vblank();
+    }
+}
+
+/* ---------------------------------------------------------------------------
+ * Interrupts
+ */
+static bool sim_irq_enabled(IRQn_Type irq)
+{
+    return (nvic_enabled[irq / 32] >> (irq % 32)) & 1U;
+}
+
+static bool sim_irq_any_pending(void)
+{
+    for (uint32_t i = 0; i < sizeof(sim_vectors) / sizeof(sim_vectors[0]); i++) {
+        if (sim_irq_enabled(sim_vectors[i].irq) && sim_vectors[i].pending()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void sim_poll_irq(void)
+{
+    uint32_t guard = 16;
+
+    if (primask || isr_depth || !sim_ready) {
+        return;
+    }
+
+    isr_depth++;
+    while (guard--) {
+        bool taken = false;
+
+        for (uint32_t i = 0; i < sizeof(sim_vectors) / sizeof(sim_vectors[0]); i++) {
+            if (sim_irq_enabled(sim_vectors[i].irq) && sim_vectors[i].pending()) {
+                sim_vectors[i].handler();
+                taken = true;
+            }
+        }
+        if (!taken) {
+            break;
+        }
+    }
+    isr_depth--;
+}
+
+void sim_irq_disable(void)
+{
+    primask = 1;
+}
+
+void sim_irq_enable(void)
+{
+    primask = 0;
+    sim_poll_irq();
+}
+
+uint32_t sim_irq_get_primask(void)
+{
+    return primask;
+}
+
+void sim_irq_set_primask(uint32_t value)
+{
+    primask = value & 1U;
+    sim_poll_irq();
+}
+
+void sim_wfi(void)
+{
+    /* Wake on any pending enabled interrupt, PRIMASK only decides if it is taken */
+    for (uint32_t lines = 0; lines < SIM_WFI_MAX_LINES && !sim_irq_any_pending(); lines++) {
+        uint64_t step = sim_cycles_to_next_event();
+
+        sim_advance(step ? step : 1000U);
+    }
+    sim_poll_irq();
+}
+
+/* One cycle, so delay loops polling DWT->CYCCNT see time pass */
+void sim_nop(void)
+{
+    sim_advance(1);
+}
+
+void sim_breakpoint(void)
+{
+    fprintf(stderr, "sim: breakpoint / system reset requested\n");
+    abort();
+}
+
+void sim_nvic_enable(IRQn_Type irq)
+{
+    nvic_enabled[irq / 32] |= 1UL << (irq % 32);
+    sim_poll_irq();
+}
+
+void sim_nvic_disable(IRQn_Type irq)
+{
+    nvic_enabled[irq / 32] &= ~(1UL << (irq % 32));
+}
+
+void sim_nvic_set_priority(IRQn_Type irq, uint32_t priority)
+{
+    (void)irq;
+    (void)priority;                                         // Vectors are taken in table order
+}
@@ -0,0 +1,152 @@
+/**
+ * @file sim_gfxmmu.c
+ * @brief GFXMMU model: look-up table translation of the virtual buffers at 0x25000000
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note Bus masters (DMA2D / LTDC models) translate every byte with
+ *       sim_gfxmmu_read8() / sim_gfxmmu_write8(). CPU accesses trap like
+ *       register pages: before the instruction a window around the address is
+ *       filled from the translated memory, afterwards the bytes it changed are
+ *       written back through the table.
+ *
+ *       Virtual buffer n is at 0x25000000 + n * 4MB, 1024 lines of 256 blocks
+ *       (192 with CR.192BM) of 16 bytes. Block b of line y is backed when
+ *       LUT[2y].EN and FVB <= b <= LVB, at BnCR + LO + 16 * b, LO being the
+ *       22-bit two's complement line offset of LUT[2y + 1]. Unbacked reads
+ *       return DVR, writes are dropped. A translated address outside
+ *       simulated memory sets SR.AMEF.
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "stm32h7xx.h"
+#include "sim_internal.h"
+
+#define GFXMMU_REGS_SIZE                0x3000U                 // Registers + LUT[2048]
+#define GFXMMU_WINDOW_BEFORE            64U                     // CPU access window around the fault
+#define GFXMMU_WINDOW_AFTER             128U
+
+static GFXMMU_TypeDef *regs;
+static uint8_t *virt;                                           // Model alias of the virtual range
+static uint32_t window_offset;
+static uint32_t window_size;
+static uint8_t  window[GFXMMU_WINDOW_BEFORE + GFXMMU_WINDOW_AFTER];
+
+/**
+ * @return physical address, 0 if the byte is not backed
+ */
+static uint32_t gfxmmu_translate(uint32_t addr)
+{
+    uint32_t offset = addr - GFXMMU_VIRTUAL_BUFFERS_BASE;
+    uint32_t n = offset >> 22;
+    uint32_t line_bytes = (regs->CR & GFXMMU_CR_192BM) ? 192U * 16U : 256U * 16U;
+    uint32_t y = (offset & 0x3FFFFFU) / line_bytes;
+    uint32_t block = (offset & 0x3FFFFFU) % line_bytes / 16U;
+    uint32_t lut_l, lo;
+
+    if (y >= 1024U) {
+        return 0;
+    }
+    lut_l = regs->LUT[2U * y];
+    if (!(lut_l & GFXMMU_LUTxL_EN) ||
+        block < ((lut_l & GFXMMU_LUTxL_FVB) >> GFXMMU_LUTxL_FVB_Pos) ||
+        block > ((lut_l & GFXMMU_LUTxL_LVB) >> GFXMMU_LUTxL_LVB_Pos)) {
+        return 0;
+    }
+
+    /* Sign extend bit 21 */
+    lo = regs->LUT[2U * y + 1U] & GFXMMU_LUTxH_LO;
+    if (lo & 0x200000U) {
+        lo |= 0xFFC00000U;
+    }
+    return ((&regs->B0CR)[n] & ~0xFU) + lo + block * 16U + (offset & 0xFU);
+}
+
+static bool gfxmmu_phys(uint32_t addr, uint32_t *phys)
+{
+    *phys = gfxmmu_translate(addr);
+    if (*phys == 0) {
+        return false;
+    }
+    if (!sim_mem_valid(*phys, 1)) {
+        SIM_LOG("gfxmmu: 0x%08x translates to 0x%08x, outside simulated memory\n", addr, *phys);
+        regs->SR |= GFXMMU_SR_AMEF;
+        return false;
+    }
+    return true;
+}
+
+uint8_t sim_gfxmmu_read8(uint32_t addr)
+{
+    uint32_t phys;
+
+    if (!gfxmmu_phys(addr, &phys)) {
+        return (uint8_t)(regs->DVR >> (8U * (addr & 3U)));
+    }
+    return *(volatile uint8_t *)(uintptr_t)phys;
+}
+
+void sim_gfxmmu_write8(uint32_t addr, uint8_t value)
+{
+    uint32_t phys;
+
+    if (gfxmmu_phys(addr, &phys)) {
+        *(volatile uint8_t *)(uintptr_t)phys = value;
+    }
+}
+
+static void gfxmmu_regs_post(uint32_t offset, bool written, uint32_t old_value)
+{
+    if (!written) {
+        return;
+    }
+
+    switch (offset) {
+    case offsetof(GFXMMU_TypeDef, SR):
+        regs->SR = old_value;                               // Read only
+        break;
+    case offsetof(GFXMMU_TypeDef, FCR):
+        regs->SR &= ~(regs->FCR & 0x1FU);
+        regs->FCR = 0;
+        break;
+    default:
+        break;
+    }
+}
+
+static void gfxmmu_virt_pre(uint32_t offset, bool is_write)
+{
+    (void)is_write;
+
+    window_offset = (offset > GFXMMU_WINDOW_BEFORE) ? offset - GFXMMU_WINDOW_BEFORE : 0;
+    window_size = GFXMMU_WINDOW_BEFORE + GFXMMU_WINDOW_AFTER;
+    if (window_offset + window_size > 4U * 0x400000U) {
+        window_size = 4U * 0x400000U - window_offset;
+    }
+    for (uint32_t i = 0; i < window_size; i++) {
+        window[i] = sim_gfxmmu_read8(GFXMMU_VIRTUAL_BUFFERS_BASE + window_offset + i);
+    }
+    memcpy(virt + window_offset, window, window_size);
+}
+
+static void gfxmmu_virt_post(uint32_t offset, bool written, uint32_t old_value)
+{
+    (void)offset;
+    (void)written;
+    (void)old_value;
+
+    /* Only the bytes the instruction changed, a store of the default value to an unbacked block stays dropped */
+    for (uint32_t i = 0; i < window_size; i++) {
+        if (virt[window_offset + i] != window[i]) {
+            sim_gfxmmu_write8(GFXMMU_VIRTUAL_BUFFERS_BASE + window_offset + i, virt[window_offset + i]);
+        }
+    }
+}
+
+void sim_gfxmmu_init(void)
+{
+    regs = (GFXMMU_TypeDef *)sim_device_map(GFXMMU_BASE, GFXMMU_REGS_SIZE, NULL, gfxmmu_regs_post);
+    virt = (uint8_t *)sim_device_map(GFXMMU_VIRTUAL_BUFFERS_BASE, 4U * 0x400000U, gfxmmu_virt_pre, gfxmmu_virt_post);
+}
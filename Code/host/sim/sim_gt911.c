@@ -0,0 +1,372 @@
+/**
+ * @file sim_gt911.c
+ * @brief GT911 touch controller model on the GPIOE touch pins, with the EXTI line its INT pin drives
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note The GPIOE and EXTI / SYSCFG register pages are trapped. Writes to
+ *       BSRR / ODR / MODER update the pin levels: SCL and SDA are open
+ *       drain lines with pull-ups (low if the MCU or the GT911 drives them
+ *       low), RESET is high unless driven low, INT is driven by the MCU
+ *       while it is an output and by the GT911 otherwise. IDR reads return
+ *       the levels.
+ *
+ *       The GT911 is an I2C slave state machine clocked by the SCL edges.
+ *       Bus time is the driver's own: its half period delay polls
+ *       DWT->CYCCNT and every __NOP() is one cycle of virtual time. Its address is chosen by
+ *       the INT level on the rising edge of RESET (low: 0x5D, high: 0x14).
+ *       Registers 0x8040 .. 0x81FF are modelled: configuration, product ID
+ *       and the point buffer. sim_gt911_report() loads the point buffer and
+ *       pulses INT, unless the last report is still waiting (status bit 7
+ *       not cleared), as on the chip. An INT edge on a line set up by
+ *       HAL_GPIO_Init() sets EXTI PR1, EXTI4_IRQn is pending while it is
+ *       set and unmasked. No clock stretching, no 50 ms start-up check.
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include "stm32h7xx.h"
+#include "sim_internal.h"
+
+#define SIM_GT911_REG_BASE              0x8040U
+#define SIM_GT911_REG_SIZE              0x01C0U
+
+#define PIN_RESET                       3U
+#define PIN_INT                         4U
+#define PIN_SCL                         5U
+#define PIN_SDA                         6U
+#define EXTI_LINE_INT                   (1UL << PIN_INT)
+#define EXTICR_PORT_E                   4U
+
+typedef enum {
+    I2C_IDLE = 0,
+    I2C_ADDR,
+    I2C_REG_HI,
+    I2C_REG_LO,
+    I2C_WRITE,
+    I2C_READ,
+    I2C_IGNORE,                                                 // Not addressed or read ended, wait for a (re)start
+} i2c_state_t;
+
+static GPIO_TypeDef   *gpio;
+static EXTI_TypeDef   *exti;
+static SYSCFG_TypeDef *syscfg;
+
+static uint8_t  gt_regs[SIM_GT911_REG_SIZE];
+static uint8_t  gt_addr = 0x5D;
+static bool     gt_int = true;                                  // Level the GT911 drives on INT
+static bool     gt_sda_low = false;                             // GT911 pulls SDA low
+static bool     line_scl = true;
+static bool     line_sda = true;
+static bool     line_rst = true;
+static bool     line_int = true;
+
+static i2c_state_t i2c_state = I2C_IDLE;
+static i2c_state_t i2c_next = I2C_IDLE;
+static uint8_t  i2c_bit;                                        // Clock of the byte, 8 is the acknowledge
+static uint8_t  i2c_byte;
+static bool     i2c_ack;
+static bool     i2c_clocked;                                    // SCL rose since the last falling edge or start
+static uint16_t gt_ptr;                                         // Register pointer, auto incremented
+
+static sim_gt911_stats_t stats;
+
+static uint8_t gt_reg_read(uint16_t reg)
+{
+    uint16_t i = (uint16_t)(reg - SIM_GT911_REG_BASE);
+
+    return (i < SIM_GT911_REG_SIZE) ? gt_regs[i] : 0;
+}
+
+static void gt_reg_write(uint16_t reg, uint8_t value)
+{
+    uint16_t i = (uint16_t)(reg - SIM_GT911_REG_BASE);
+
+    if (i < SIM_GT911_REG_SIZE) {
+        gt_regs[i] = value;
+    }
+}
+
+static bool pin_is_output(uint32_t pin)
+{
+    return ((gpio->MODER >> (pin * 2U)) & 3U) == 1U;
+}
+
+/* MCU side of an open drain or pulled up line */
+static bool pin_master_level(uint32_t pin)
+{
+    return !pin_is_output(pin) || ((gpio->ODR >> pin) & 1U);
+}
+
+static void exti_edge(bool rising)
+{
+    bool selected = ((syscfg->EXTICR[PIN_INT / 4U] >> ((PIN_INT % 4U) * 4U)) & 0xFU) == EXTICR_PORT_E;
+    uint32_t trigger = rising ? exti->RTSR1 : exti->FTSR1;
+
+    if (selected && (trigger & EXTI_LINE_INT)) {
+        exti->PR1 |= EXTI_LINE_INT;
+        stats.int_edges++;
+    }
+}
+
+static void update_int(void)
+{
+    bool level = pin_is_output(PIN_INT) ? ((gpio->ODR >> PIN_INT) & 1U) : gt_int;
+
+    if (level != line_int) {
+        line_int = level;
+        if (!pin_is_output(PIN_INT)) {
+            exti_edge(level);
+        }
+    }
+}
+
+/* A byte was received, acknowledge it or not and pick the state after the acknowledge */
+static void i2c_byte_done(void)
+{
+    i2c_ack = true;
+    switch (i2c_state) {
+    case I2C_ADDR:
+        if ((i2c_byte >> 1) != gt_addr || !line_rst) {
+            i2c_ack = false;
+            i2c_next = I2C_IGNORE;
+        } else {
+            i2c_next = (i2c_byte & 1U) ? I2C_READ : I2C_REG_HI;
+        }
+        break;
+    case I2C_REG_HI:
+        gt_ptr = (uint16_t)(i2c_byte << 8);
+        i2c_next = I2C_REG_LO;
+        break;
+    case I2C_REG_LO:
+        gt_ptr |= i2c_byte;
+        i2c_next = I2C_WRITE;
+        break;
+    default:
+        gt_reg_write(gt_ptr++, i2c_byte);
+        stats.bytes_written++;
+        i2c_next = I2C_WRITE;
+        break;
+    }
+    gt_sda_low = i2c_ack;
+}
+
+static void i2c_scl_rising(void)
+{
+    if (i2c_state == I2C_IDLE || i2c_state == I2C_IGNORE) {
+        return;
+    }
+    i2c_clocked = true;
+    if (i2c_state == I2C_READ) {
+        if (i2c_bit == 8U) {
+            i2c_ack = !line_sda;                                // Master acknowledge: one more byte
+        }
+    } else if (i2c_bit < 8U) {
+        i2c_byte = (uint8_t)((i2c_byte << 1) | line_sda);
+    }
+}
+
+static void i2c_scl_falling(void)
+{
+    if (i2c_state == I2C_IDLE || i2c_state == I2C_IGNORE || !i2c_clocked) {
+        return;                                                 // Also the falling edge that ends a start
+    }
+
+    i2c_clocked = false;
+    i2c_bit++;
+    if (i2c_state == I2C_READ) {
+        if (i2c_bit < 8U) {
+            gt_sda_low = !((i2c_byte >> (7U - i2c_bit)) & 1U);
+        } else if (i2c_bit == 8U) {
+            gt_sda_low = false;                                 // Master acknowledges
+        } else if (i2c_ack) {
+            i2c_bit = 0;
+            i2c_byte = gt_reg_read(gt_ptr++);
+            stats.bytes_read++;
+            gt_sda_low = !(i2c_byte & 0x80U);
+        } else {
+            i2c_state = I2C_IGNORE;
+        }
+        return;
+    }
+
+    if (i2c_bit == 8U) {
+        i2c_byte_done();
+    } else if (i2c_bit == 9U) {
+        gt_sda_low = false;
+        i2c_bit = 0;
+        i2c_byte = 0;
+        i2c_state = i2c_next;
+        if (i2c_state == I2C_READ) {
+            i2c_byte = gt_reg_read(gt_ptr++);
+            stats.bytes_read++;
+            gt_sda_low = !(i2c_byte & 0x80U);
+        }
+    }
+}
+
+/* Re-evaluate the lines after a register write and clock the GT911 */
+static void update_lines(void)
+{
+    bool rst = pin_master_level(PIN_RESET);
+    bool scl = pin_master_level(PIN_SCL);
+    bool sda;
+
+    update_int();
+    if (rst != line_rst) {
+        line_rst = rst;
+        if (rst) {
+            gt_addr = line_int ? 0x14 : 0x5D;
+            stats.resets++;
+        }
+        i2c_state = I2C_IDLE;
+        gt_sda_low = false;
+    }
+
+    if (scl != line_scl) {
+        line_scl = scl;
+        if (scl) {
+            i2c_scl_rising();
+        } else {
+            i2c_scl_falling();
+        }
+    }
+
+    sda = pin_master_level(PIN_SDA) && !gt_sda_low;
+    if (sda != line_sda) {
+        line_sda = sda;
+        if (line_scl && line_rst) {
+            if (!sda) {
+                i2c_state = I2C_ADDR;                           // (Repeated) start
+                i2c_bit = 0;
+                i2c_byte = 0;
+                i2c_clocked = false;
+                stats.starts++;
+            } else {
+                i2c_state = I2C_IDLE;                           // Stop
+            }
+            gt_sda_low = false;
+        }
+    }
+}
+
+static void gpio_pre(uint32_t offset, bool is_write)
+{
+    uint32_t idr;
+
+    if (is_write || offset != offsetof(GPIO_TypeDef, IDR)) {
+        return;
+    }
+    idr = gpio->ODR & 0xFFFFU;
+    idr &= ~((1UL << PIN_RESET) | (1UL << PIN_INT) | (1UL << PIN_SCL) | (1UL << PIN_SDA));
+    idr |= ((uint32_t)line_rst << PIN_RESET) | ((uint32_t)line_int << PIN_INT) |
+           ((uint32_t)line_scl << PIN_SCL) | ((uint32_t)line_sda << PIN_SDA);
+    gpio->IDR = idr;
+}
+
+static void gpio_post(uint32_t offset, bool written, uint32_t old_value)
+{
+    if (!written) {
+        return;
+    }
+    switch (offset) {
+    case offsetof(GPIO_TypeDef, BSRR):
+        gpio->ODR = (gpio->ODR & ~(gpio->BSRR >> 16)) | (gpio->BSRR & 0xFFFFU);
+        gpio->BSRR = 0;                                         // Write only
+        break;
+    case offsetof(GPIO_TypeDef, IDR):
+        gpio->IDR = old_value;                                  // Read only
+        return;
+    default:
+        break;
+    }
+    update_lines();
+}
+
+static void exti_post(uint32_t offset, bool written, uint32_t old_value)
+{
+    if (written && offset == offsetof(EXTI_TypeDef, PR1)) {
+        exti->PR1 = old_value & ~exti->PR1;                     // Write 1 to clear
+    }
+}
+
+bool sim_gt911_irq_pending(void)
+{
+    return (exti->PR1 & exti->IMR1 & EXTI_LINE_INT) != 0;
+}
+
+void sim_gt911_init(void)
+{
+    gpio = (GPIO_TypeDef *)sim_device_map(GPIOE_BASE, SIM_PAGE_SIZE, gpio_pre, gpio_post);
+    exti = (EXTI_TypeDef *)sim_device_map(EXTI_BASE, SIM_PAGE_SIZE, NULL, exti_post);
+    syscfg = (SYSCFG_TypeDef *)((uint8_t *)exti + (SYSCFG_BASE - EXTI_BASE));
+    sim_gt911_config(800, 480, 1);
+}
+
+void sim_gt911_config(uint16_t res_x, uint16_t res_y, uint8_t trigger)
+{
+    static const uint8_t id[] = { '9', '1', '1', 0, 0x60, 0x10 };
+
+    memset(gt_regs, 0, sizeof(gt_regs));
+    memcpy(&gt_regs[0x8140 - SIM_GT911_REG_BASE], id, sizeof(id));
+    gt_reg_write(0x8146, (uint8_t)res_x);
+    gt_reg_write(0x8147, (uint8_t)(res_x >> 8));
+    gt_reg_write(0x8148, (uint8_t)res_y);
+    gt_reg_write(0x8149, (uint8_t)(res_y >> 8));
+    gt_reg_write(0x8048, (uint8_t)res_x);                       // Configuration: output resolution
+    gt_reg_write(0x8049, (uint8_t)(res_x >> 8));
+    gt_reg_write(0x804A, (uint8_t)res_y);
+    gt_reg_write(0x804B, (uint8_t)(res_y >> 8));
+    gt_reg_write(0x804C, 5);
+    gt_reg_write(0x804D, trigger & 0x03U);
+    gt_int = (trigger & 0x03U) == 1U || (trigger & 0x03U) == 2U;   // Idle level: high for falling / low pulses
+    update_int();
+}
+
+bool sim_gt911_report(const sim_touch_point_t *points, uint32_t count)
+{
+    uint8_t trigger = gt_reg_read(0x804D) & 0x03U;
+    bool idle = trigger == 1U || trigger == 2U;
+
+    if (gt_reg_read(0x814E) & 0x80U) {
+        stats.missed++;
+        return false;
+    }
+
+    count = (count > 5U) ? 5U : count;
+    for (uint32_t i = 0; i < 5U; i++) {
+        uint8_t raw[8] = { 0 };
+
+        if (i < count) {
+            raw[0] = points[i].id;
+            raw[1] = (uint8_t)points[i].x;
+            raw[2] = (uint8_t)(points[i].x >> 8);
+            raw[3] = (uint8_t)points[i].y;
+            raw[4] = (uint8_t)(points[i].y >> 8);
+            raw[5] = (uint8_t)points[i].size;
+            raw[6] = (uint8_t)(points[i].size >> 8);
+        }
+        memcpy(&gt_regs[0x814F - SIM_GT911_REG_BASE + i * 8U], raw, sizeof(raw));
+    }
+    gt_reg_write(0x814E, (uint8_t)(0x80U | count));
+    stats.reports++;
+
+    /* INT pulse, the edge the MCU listens to happens on one of the two transitions */
+    gt_int = !idle;
+    update_int();
+    gt_int = idle;
+    update_int();
+
+    sim_poll_irq();
+    return true;
+}
+
+const sim_gt911_stats_t *sim_gt911_get_stats(void)
+{
+    return &stats;
+}
+
+void sim_gt911_reset_stats(void)
+{
+    memset(&stats, 0, sizeof(stats));
+}
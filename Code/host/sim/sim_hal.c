@@ -0,0 +1,88 @@
+/**
+ * @file sim_hal.c
+ * @brief HAL services the display drivers need but the simulator does not model
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note Replaces stm32h7xx_hal.c / hal_cortex.c / hal_rcc_ex.c and the
+ *       display and touch vectors of stm32h7xx_it.c. The peripheral HAL
+ *       drivers (DMA2D, LTDC, GPIO, MDMA) are compiled from Drivers/ unchanged.
+ */
+
+#include <stdlib.h>
+#include "main.h"
+#include "sim_internal.h"
+
+#define SIM_GETTICK_CYCLES              64U         // Cost of one HAL_GetTick() call, bounds HAL timeout loops
+
+extern LTDC_HandleTypeDef hltdc;
+extern DMA2D_HandleTypeDef hdma2d;
+extern MDMA_HandleTypeDef hmdma_fetch;
+
+uint32_t SystemCoreClock = SIM_CPU_HZ;
+
+uint32_t HAL_GetTick(void)
+{
+    sim_advance(SIM_GETTICK_CYCLES);
+    sim_poll_irq();
+    return (uint32_t)(sim_cycles() / (SIM_CPU_HZ / 1000U));
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+    sim_run_us((uint64_t)Delay * 1000U);
+}
+
+HAL_StatusTypeDef HAL_RCCEx_PeriphCLKConfig(RCC_PeriphCLKInitTypeDef *PeriphClkInit)
+{
+    (void)PeriphClkInit;                                    // Pixel clock is fixed at SIM_LTDC_PIXCLK_HZ
+    return HAL_OK;
+}
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority)
+{
+    (void)SubPriority;
+    NVIC_SetPriority(IRQn, PreemptPriority);
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+    NVIC_EnableIRQ(IRQn);
+}
+
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn)
+{
+    NVIC_DisableIRQ(IRQn);
+}
+
+__attribute__((weak)) void Error_Handler(void)
+{
+    fprintf(stderr, "sim: Error_Handler()\n");
+    abort();
+}
+
+/* Same bodies as stm32h7xx_it.c, weak so a test can hook a vector */
+__attribute__((weak)) void LTDC_IRQHandler(void)
+{
+    HAL_LTDC_IRQHandler(&hltdc);
+}
+
+__attribute__((weak)) void LTDC_ER_IRQHandler(void)
+{
+    HAL_LTDC_IRQHandler(&hltdc);
+}
+
+__attribute__((weak)) void DMA2D_IRQHandler(void)
+{
+    HAL_DMA2D_IRQHandler(&hdma2d);
+}
+
+__attribute__((weak)) void MDMA_IRQHandler(void)
+{
+    HAL_MDMA_IRQHandler(&hmdma_fetch);
+}
+
+__attribute__((weak)) void EXTI4_IRQHandler(void)
+{
+    HAL_GPIO_EXTI_IRQHandler(TOUCH_INT_Pin);
+}
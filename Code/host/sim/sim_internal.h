@@ -0,0 +1,106 @@
+/**
+ * @file sim_internal.h
+ * @brief Interfaces between the simulator core and the peripheral models
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#ifndef __SIM_INTERNAL_H__
+#define __SIM_INTERNAL_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include "sim.h"
+
+#define SIM_PAGE_SIZE                   4096U
+
+/**
+ * @brief Register access hooks, offset is the 32-bit aligned offset in the device page
+ * pre:  before the instruction runs, refresh read-only status registers
+ * post: after it ran, written is true if the register was stored to
+ */
+typedef void (*sim_pre_fn)(uint32_t offset, bool is_write);
+typedef void (*sim_post_fn)(uint32_t offset, bool written, uint32_t old_value);
+
+/**
+ * @brief Map a trapped device page range at its real address
+ * @return writable alias of the registers for the model (never traps)
+ */
+void *sim_device_map(uint32_t base, uint32_t size, sim_pre_fn pre, sim_post_fn post);
+
+/**
+ * @brief true if [addr, addr + size) is simulated memory a bus master can access
+ */
+bool sim_mem_valid(uint32_t addr, uint32_t size);
+
+/* Memory mapped external flash, slower for every bus master (SIM_OSPI_CYCLES_PER_BYTE) */
+#define SIM_OSPI_BASE                   0x90000000UL
+#define SIM_OSPI_SIZE                   0x00800000UL
+#define SIM_OSPI(addr)                  ((uint32_t)(addr) - SIM_OSPI_BASE < SIM_OSPI_SIZE)
+
+/* GFXMMU virtual buffers, bus masters go through sim_mem_read8() / sim_mem_write8() there */
+#define SIM_GFXMMU_BASE                 0x25000000UL
+#define SIM_GFXMMU_SIZE                 0x01000000UL
+#define SIM_GFXMMU_VIRTUAL(addr)        ((uint32_t)(addr) - SIM_GFXMMU_BASE < SIM_GFXMMU_SIZE)
+
+uint8_t sim_gfxmmu_read8(uint32_t addr);
+void sim_gfxmmu_write8(uint32_t addr, uint8_t value);
+
+static inline uint8_t sim_mem_read8(uint32_t addr)
+{
+    return SIM_GFXMMU_VIRTUAL(addr) ? sim_gfxmmu_read8(addr) : *(const volatile uint8_t *)(uintptr_t)addr;
+}
+
+static inline void sim_mem_write8(uint32_t addr, uint8_t value)
+{
+    if (SIM_GFXMMU_VIRTUAL(addr)) {
+        sim_gfxmmu_write8(addr, value);
+    } else {
+        *(volatile uint8_t *)(uintptr_t)addr = value;
+    }
+}
+
+/**
+ * @brief Advance virtual time without delivering interrupts (safe inside the trap handlers)
+ */
+void sim_advance(uint64_t cycles);
+
+/**
+ * @brief Cycles until the next LTDC line start, 0 if the LTDC is off
+ */
+uint64_t sim_ltdc_cycles_to_next_line(void);
+
+/**
+ * @brief Cycles until the next MDMA transfer completes, 0 if none is running
+ */
+uint64_t sim_mdma_cycles_to_done(void);
+
+/* Model entry points, called by the core */
+void sim_dma2d_init(void);
+void sim_gfxmmu_init(void);
+void sim_ltdc_init(void);
+void sim_ltdc_advance(uint64_t from, uint64_t to);
+void sim_mdma_init(void);
+void sim_mdma_advance(uint64_t to);
+void sim_gt911_init(void);
+bool sim_ltdc_irq_pending(void);
+bool sim_ltdc_er_irq_pending(void);
+bool sim_dma2d_irq_pending(void);
+bool sim_mdma_irq_pending(void);
+bool sim_gt911_irq_pending(void);
+
+extern uint64_t sim_now;                    // Virtual time in CPU cycles
+extern bool     sim_trace;                  // SIM_TRACE=1 in the environment
+
+/* Vector table entries, defined weak in sim_hal.c */
+void LTDC_IRQHandler(void);
+void LTDC_ER_IRQHandler(void);
+void DMA2D_IRQHandler(void);
+void MDMA_IRQHandler(void);
+void EXTI4_IRQHandler(void);
+
+#define SIM_LOG(...)    do { if (sim_trace) { fprintf(stderr, __VA_ARGS__); } } while (0)
+
+#endif /* __SIM_INTERNAL_H__ */
@@ -0,0 +1,338 @@
+/**
+ * @file sim_ltdc.c
+ * @brief LTDC model: timing generator, shadow registers, line / reload interrupts, CLUT, composition
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note The raster position is derived from virtual time and the pixel clock,
+ *       line numbers follow the register convention (0 = start of VSYNC,
+ *       active lines AVBP + 1 .. AAH). Layer registers written by the CPU are
+ *       the shadow copy, the active copy changes on an IMR reload or at the
+ *       first blanking line after a VBR request.
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include "stm32h7xx.h"
+#include "sim_internal.h"
+
+#define SIM_LTDC_LAYERS                 2U
+
+typedef struct {
+    uint32_t    CR, WHPCR, WVPCR, CKCR, PFCR, CACR, DCCR, BFCR, CFBAR, CFBLR, CFBLNR;
+} sim_layer_regs_t;
+
+static LTDC_TypeDef       *regs;
+static LTDC_Layer_TypeDef *layer_regs[SIM_LTDC_LAYERS];
+static sim_layer_regs_t    active[SIM_LTDC_LAYERS];
+static uint32_t            clut[SIM_LTDC_LAYERS][256];
+static sim_ltdc_stats_t    stats;
+static uint64_t            epoch;                       // sim_now when LTDCEN was set
+static bool                running;
+
+/* Timing from the configuration registers */
+static uint32_t total_w(void)  { return ((regs->TWCR & LTDC_TWCR_TOTALW) >> LTDC_TWCR_TOTALW_Pos) + 1U; }
+static uint32_t total_h(void)  { return (regs->TWCR & LTDC_TWCR_TOTALH) + 1U; }
+static uint32_t ahbp(void)     { return (regs->BPCR & LTDC_BPCR_AHBP) >> LTDC_BPCR_AHBP_Pos; }
+static uint32_t avbp(void)     { return regs->BPCR & LTDC_BPCR_AVBP; }
+static uint32_t aaw(void)      { return (regs->AWCR & LTDC_AWCR_AAW) >> LTDC_AWCR_AAW_Pos; }
+static uint32_t aah(void)      { return regs->AWCR & LTDC_AWCR_AAH; }
+
+static uint64_t pixclk_at(uint64_t cycles)
+{
+    return (uint64_t)(((unsigned __int128)(cycles - epoch) * SIM_LTDC_PIXCLK_HZ) / SIM_CPU_HZ);
+}
+
+static uint64_t cycles_at(uint64_t pixclk)
+{
+    return epoch + (uint64_t)(((unsigned __int128)pixclk * SIM_CPU_HZ + SIM_LTDC_PIXCLK_HZ - 1) / SIM_LTDC_PIXCLK_HZ);
+}
+
+static void ltdc_reload(void)
+{
+    for (uint32_t i = 0; i < SIM_LTDC_LAYERS; i++) {
+        LTDC_Layer_TypeDef *l = layer_regs[i];
+        sim_layer_regs_t *a = &active[i];
+
+        a->CR = l->CR;
+        a->WHPCR = l->WHPCR;
+        a->WVPCR = l->WVPCR;
+        a->CKCR = l->CKCR;
+        a->PFCR = l->PFCR;
+        a->CACR = l->CACR;
+        a->DCCR = l->DCCR;
+        a->BFCR = l->BFCR;
+        a->CFBAR = l->CFBAR;
+        a->CFBLR = l->CFBLR;
+        a->CFBLNR = l->CFBLNR;
+    }
+    regs->SRCR = 0;
+    stats.reloads++;
+}
+
+/* Called at the start of every line crossed by virtual time */
+static void ltdc_line_start(uint32_t line)
+{
+    if (line == (regs->LIPCR & LTDC_LIPCR_LIPOS)) {
+        regs->ISR |= LTDC_ISR_LIF;
+        stats.line_irqs += (regs->IER & LTDC_IER_LIE) ? 1U : 0U;
+    }
+    if (line == aah() + 1U) {
+        stats.frames++;
+        for (uint32_t i = 0; i < SIM_LTDC_LAYERS; i++) {
+            if (active[i].CR & LTDC_LxCR_LEN) {
+                uint32_t w = ((active[i].WHPCR & LTDC_LxWHPCR_WHSPPOS) >> 16) - (active[i].WHPCR & LTDC_LxWHPCR_WHSTPOS) + 1U;
+                uint32_t h = ((active[i].WVPCR & LTDC_LxWVPCR_WVSPPOS) >> 16) - (active[i].WVPCR & LTDC_LxWVPCR_WVSTPOS) + 1U;
+
+                stats.bytes_fetched += (uint64_t)w * h * sim_pixel_bits(active[i].PFCR & 7U) / 8U;
+            }
+        }
+        if (regs->SRCR & LTDC_SRCR_VBR) {
+            ltdc_reload();
+            regs->ISR |= LTDC_ISR_RRIF;                     // Only vertical blanking reloads raise RRIF
+            stats.reload_irqs += (regs->IER & LTDC_IER_RRIE) ? 1U : 0U;
+        }
+    }
+}
+
+void sim_ltdc_advance(uint64_t from, uint64_t to)
+{
+    uint64_t line_len, first, last;
+
+    if (!running) {
+        return;
+    }
+
+    line_len = total_w();
+    first = pixclk_at(from) / line_len + 1U;                // First line start after 'from'
+    last = pixclk_at(to) / line_len;
+    for (uint64_t l = first; l <= last; l++) {
+        ltdc_line_start((uint32_t)(l % total_h()));
+    }
+}
+
+uint64_t sim_ltdc_cycles_to_next_line(void)
+{
+    uint64_t next;
+
+    if (!running) {
+        return 0;
+    }
+    next = (pixclk_at(sim_now) / total_w() + 1U) * total_w();
+    return cycles_at(next) - sim_now;
+}
+
+static void ltdc_update_status(void)
+{
+    uint64_t pos;
+    uint32_t x, y;
+
+    if (!running) {
+        regs->CPSR = 0;
+        regs->CDSR = 0;
+        return;
+    }
+
+    pos = pixclk_at(sim_now);
+    x = (uint32_t)(pos % total_w());
+    y = (uint32_t)((pos / total_w()) % total_h());
+
+    regs->CPSR = (x << LTDC_CPSR_CXPOS_Pos) | y;
+    regs->CDSR = ((y > avbp() && y <= aah()) ? LTDC_CDSR_VDES : 0) |
+                 ((x > ahbp() && x <= aaw()) ? LTDC_CDSR_HDES : 0) |
+                 ((y <= (regs->SSCR & LTDC_SSCR_VSH)) ? LTDC_CDSR_VSYNCS : 0) |
+                 ((x <= ((regs->SSCR & LTDC_SSCR_HSW) >> LTDC_SSCR_HSW_Pos)) ? LTDC_CDSR_HSYNCS : 0);
+}
+
+static void ltdc_pre(uint32_t offset, bool is_write)
+{
+    (void)is_write;
+    if (offset == offsetof(LTDC_TypeDef, CPSR) || offset == offsetof(LTDC_TypeDef, CDSR)) {
+        ltdc_update_status();
+    }
+}
+
+static void ltdc_post(uint32_t offset, bool written, uint32_t old_value)
+{
+    if (!written) {
+        return;
+    }
+
+    switch (offset) {
+    case offsetof(LTDC_TypeDef, GCR):
+        if ((regs->GCR & LTDC_GCR_LTDCEN) && !running) {
+            running = true;
+            epoch = sim_now;
+        } else if (!(regs->GCR & LTDC_GCR_LTDCEN)) {
+            running = false;
+        }
+        break;
+    case offsetof(LTDC_TypeDef, SRCR):
+        if (regs->SRCR & LTDC_SRCR_IMR) {
+            ltdc_reload();
+        }
+        break;
+    case offsetof(LTDC_TypeDef, ICR):
+        regs->ISR &= ~(regs->ICR & 0xFU);
+        regs->ICR = 0;
+        break;
+    case offsetof(LTDC_TypeDef, ISR):
+    case offsetof(LTDC_TypeDef, CPSR):
+    case offsetof(LTDC_TypeDef, CDSR):
+        *(volatile uint32_t *)((uint8_t *)regs + offset) = old_value;     // Read only
+        break;
+    default:
+        for (uint32_t i = 0; i < SIM_LTDC_LAYERS; i++) {
+            if (offset == (uint32_t)((uint8_t *)&layer_regs[i]->CLUTWR - (uint8_t *)regs)) {
+                uint32_t v = layer_regs[i]->CLUTWR;
+
+                clut[i][v >> 24] = 0xFF000000UL | (v & 0x00FFFFFFUL);
+                stats.clut_writes++;
+            }
+        }
+        break;
+    }
+}
+
+bool sim_ltdc_irq_pending(void)
+{
+    return (regs->ISR & regs->IER & (LTDC_ISR_LIF | LTDC_ISR_RRIF)) != 0;
+}
+
+bool sim_ltdc_er_irq_pending(void)
+{
+    return (regs->ISR & regs->IER & (LTDC_ISR_FUIF | LTDC_ISR_TERRIF)) != 0;
+}
+
+void sim_ltdc_init(void)
+{
+    regs = (LTDC_TypeDef *)sim_device_map(LTDC_BASE, SIM_PAGE_SIZE, ltdc_pre, ltdc_post);
+    for (uint32_t i = 0; i < SIM_LTDC_LAYERS; i++) {
+        layer_regs[i] = (LTDC_Layer_TypeDef *)((uint8_t *)regs + 0x84U + 0x80U * i);
+        layer_regs[i]->CACR = 0xFF;                         // Reset values
+        layer_regs[i]->BFCR = 0x0607;
+    }
+    ltdc_reload();
+    stats.reloads = 0;
+}
+
+/* ---------------------------------------------------------------------------
+ * Composition
+ */
+static bool ltdc_layer_sample(uint32_t i, uint32_t col, uint32_t row, uint32_t *out)
+{
+    const sim_layer_regs_t *a = &active[i];
+    uint32_t x0 = a->WHPCR & LTDC_LxWHPCR_WHSTPOS, x1 = (a->WHPCR & LTDC_LxWHPCR_WHSPPOS) >> 16;
+    uint32_t y0 = a->WVPCR & LTDC_LxWVPCR_WVSTPOS, y1 = (a->WVPCR & LTDC_LxWVPCR_WVSPPOS) >> 16;
+    uint32_t fmt = a->PFCR & LTDC_LxPFCR_PF;
+    uint32_t bits = sim_pixel_bits(fmt);
+    uint32_t pitch = (a->CFBLR & LTDC_LxCFBLR_CFBP) >> LTDC_LxCFBLR_CFBP_Pos;
+    uint32_t line_len = (a->CFBLR & LTDC_LxCFBLR_CFBLL) - 7U;  // H7: bytes + 7
+    uint32_t px, py, c;
+
+    if (!(a->CR & LTDC_LxCR_LEN)) {
+        return false;
+    }
+    if (col < x0 || col > x1 || row < y0 || row > y1) {
+        *out = a->DCCR;                                     // Default colour outside the window
+        return true;
+    }
+
+    px = col - x0;
+    py = row - y0;
+    if (py >= (a->CFBLNR & LTDC_LxCFBLNR_CFBLNBR) || (uint64_t)(px + 1U) * bits / 8U > line_len ||
+        !sim_mem_valid(a->CFBAR + py * pitch, (px + 1U) * bits / 8U)) {
+        *out = a->DCCR;
+        return true;
+    }
+
+    c = sim_pixel_read(a->CFBAR + py * pitch, px, fmt, (a->CR & LTDC_LxCR_CLUTEN) ? clut[i] : NULL, 0);
+    if ((a->CR & LTDC_LxCR_COLKEN) && (c & 0x00FFFFFFUL) == (a->CKCR & 0x00FFFFFFUL)) {
+        c = 0;
+    }
+    *out = c;
+    return true;
+}
+
+static uint32_t ltdc_blend(uint32_t i, uint32_t c, uint32_t below)
+{
+    const sim_layer_regs_t *a = &active[i];
+    uint32_t ca = a->CACR & LTDC_LxCACR_CONSTA;
+    uint32_t pa = c >> 24;
+    uint32_t f1 = (((a->BFCR & LTDC_LxBFCR_BF1) >> 8) == 6U) ? pa * ca / 255U : ca;
+    uint32_t f2 = ((a->BFCR & LTDC_LxBFCR_BF2) == 7U) ? 255U - pa * ca / 255U : 255U - ca;
+    uint32_t out = 0;
+
+    for (uint32_t shift = 0; shift < 24; shift += 8) {
+        uint32_t v = (((c >> shift) & 0xFF) * f1 + ((below >> shift) & 0xFF) * f2) / 255U;
+
+        out |= (v > 255U ? 255U : v) << shift;
+    }
+    return out;
+}
+
+bool sim_ltdc_layer_pixel(uint32_t layer, uint32_t x, uint32_t y, uint32_t *argb)
+{
+    const sim_layer_regs_t *a;
+    uint32_t col = ahbp() + 1U + x, row = avbp() + 1U + y;
+
+    if (layer >= SIM_LTDC_LAYERS) {
+        return false;
+    }
+    a = &active[layer];
+    if (col < (a->WHPCR & LTDC_LxWHPCR_WHSTPOS) || col > ((a->WHPCR & LTDC_LxWHPCR_WHSPPOS) >> 16) ||
+        row < (a->WVPCR & LTDC_LxWVPCR_WVSTPOS) || row > ((a->WVPCR & LTDC_LxWVPCR_WVSPPOS) >> 16)) {
+        return false;
+    }
+    return ltdc_layer_sample(layer, col, row, argb);
+}
+
+bool sim_ltdc_compose(uint8_t *rgb, uint32_t *width, uint32_t *height)
+{
+    uint32_t w = aaw() - ahbp(), h = aah() - avbp();
+
+    if (!(regs->GCR & LTDC_GCR_LTDCEN) || w == 0 || h == 0) {
+        return false;
+    }
+    if (width) {
+        *width = w;
+    }
+    if (height) {
+        *height = h;
+    }
+    if (rgb == NULL) {
+        return true;
+    }
+
+    for (uint32_t y = 0; y < h; y++) {
+        for (uint32_t x = 0; x < w; x++) {
+            uint32_t c = regs->BCCR & 0x00FFFFFFUL;
+            uint8_t *p = rgb + ((size_t)y * w + x) * 3U;
+
+            for (uint32_t i = 0; i < SIM_LTDC_LAYERS; i++) {
+                uint32_t px;
+
+                if (ltdc_layer_sample(i, ahbp() + 1U + x, avbp() + 1U + y, &px)) {
+                    c = ltdc_blend(i, px, c);
+                }
+            }
+            p[0] = (uint8_t)(c >> 16);
+            p[1] = (uint8_t)(c >> 8);
+            p[2] = (uint8_t)c;
+        }
+    }
+    return true;
+}
+
+const sim_ltdc_stats_t *sim_ltdc_get_stats(void)
+{
+    return &stats;
+}
+
+void sim_ltdc_reset_stats(void)
+{
+    uint32_t frames = stats.frames;
+
+    memset(&stats, 0, sizeof(stats));
+    stats.frames = frames;                                  // Frame counter paces sim_run_to_vblank()
+}
@@ -0,0 +1,259 @@
+/**
+ * @file sim_mdma.c
+ * @brief MDMA model: software triggered memory to memory transfers running alongside the CPU and DMA2D
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note Unlike the DMA2D model, a transfer does not complete when it is
+ *       started: SWRQ schedules it, the bytes are copied and CTCIF / BTIF /
+ *       BRTIF / TCIF are raised once virtual time passes the modelled
+ *       duration, so DMA2D jobs and CPU work started meanwhile overlap it.
+ *       Timing: SIM_MDMA_SETUP_CYCLES, then SIM_MDMA_BYTES_PER_CYCLE from
+ *       internal RAM or SIM_OSPI_CYCLES_PER_BYTE from the memory mapped OSPI.
+ *
+ *       Supported: software request mode, incrementing source and
+ *       destination (increment offset = data size), blocks repeated with the
+ *       CBRUR address updates, no linked list and no mask write. Anything
+ *       else, a misaligned address or block length, or memory outside the
+ *       simulation sets TEIF. Hardware requests (JPEG FIFOs) are not modelled.
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include "stm32h7xx.h"
+#include "sim_internal.h"
+
+#define SIM_MDMA_CHANNELS               16U
+#define SIM_MDMA_SETUP_CYCLES           48U
+#define SIM_MDMA_BYTES_PER_CYCLE        2U
+#define MDMA_CISR_FLAGS                 (MDMA_CISR_TEIF | MDMA_CISR_CTCIF | MDMA_CISR_BRTIF | MDMA_CISR_BTIF | MDMA_CISR_TCIF)
+
+typedef struct {
+    bool        active;
+    uint64_t    done_at;                                        // sim_now when the last byte is written
+    uint64_t    bytes;
+} mdma_chan_t;
+
+static MDMA_TypeDef         *regs;
+static MDMA_Channel_TypeDef *chan_regs[SIM_MDMA_CHANNELS];
+static mdma_chan_t           chan[SIM_MDMA_CHANNELS];
+static sim_mdma_stats_t      stats;
+
+static void mdma_update_gisr(void)
+{
+    uint32_t gisr = 0;
+
+    for (uint32_t n = 0; n < SIM_MDMA_CHANNELS; n++) {
+        /* TEIE..TCIE line up with TEIF..TCIF one bit lower */
+        if (chan_regs[n]->CISR & (chan_regs[n]->CCR >> 1) & MDMA_CISR_FLAGS) {
+            gisr |= 1UL << n;
+        }
+    }
+    regs->GISR0 = gisr;
+}
+
+static void mdma_error(uint32_t n, uint32_t cesr, const char *why)
+{
+    SIM_LOG("mdma: channel %u transfer error, %s\n", n, why);
+    stats.errors++;
+    chan_regs[n]->CESR = cesr;
+    chan_regs[n]->CISR |= MDMA_CISR_TEIF;
+    chan_regs[n]->CCR &= ~MDMA_CCR_EN;
+}
+
+/* First byte of a block, after the block repeat address updates of the ones before */
+static uint32_t mdma_block_addr(uint32_t base, uint32_t block, uint32_t bndt, uint32_t update, bool down)
+{
+    return down ? base + block * bndt - block * update : base + block * (bndt + update);
+}
+
+static void mdma_start(uint32_t n)
+{
+    MDMA_Channel_TypeDef *c = chan_regs[n];
+    uint32_t ctcr = c->CTCR;
+    uint32_t ssize = (ctcr & MDMA_CTCR_SSIZE) >> MDMA_CTCR_SSIZE_Pos;
+    uint32_t dsize = (ctcr & MDMA_CTCR_DSIZE) >> MDMA_CTCR_DSIZE_Pos;
+    uint32_t bndt = c->CBNDTR & MDMA_CBNDTR_BNDT;
+    uint32_t blocks = ((c->CBNDTR & MDMA_CBNDTR_BRC) >> MDMA_CBNDTR_BRC_Pos) + 1U;
+    uint32_t suv = c->CBRUR & MDMA_CBRUR_SUV;
+    uint32_t duv = (c->CBRUR & MDMA_CBRUR_DUV) >> MDMA_CBRUR_DUV_Pos;
+    uint32_t first_src, last_src, first_dst, last_dst;
+    uint64_t cycles;
+
+    if (!(ctcr & MDMA_CTCR_SWRM)) {
+        SIM_LOG("mdma: channel %u waits for a hardware request, not modelled\n", n);
+        return;
+    }
+    if ((ctcr & MDMA_CTCR_TRGM) != MDMA_CTCR_TRGM || c->CLAR != 0 || c->CMAR != 0) {
+        mdma_error(n, MDMA_CESR_TELD, "only full transfers without linked list or mask write");
+        return;
+    }
+    if ((ctcr & MDMA_CTCR_SINC) != MDMA_CTCR_SINC_1 || (ctcr & MDMA_CTCR_DINC) != MDMA_CTCR_DINC_1 ||
+        ((ctcr & MDMA_CTCR_SINCOS) >> MDMA_CTCR_SINCOS_Pos) != ssize ||
+        ((ctcr & MDMA_CTCR_DINCOS) >> MDMA_CTCR_DINCOS_Pos) != dsize) {
+        mdma_error(n, 0, "only incrementing source and destination by the data size");
+        return;
+    }
+    if (bndt == 0 || (bndt & ((1U << ssize) - 1U)) || (bndt & ((1U << dsize) - 1U))) {
+        mdma_error(n, MDMA_CESR_BSE, "block length not a multiple of the data size");
+        return;
+    }
+    if ((c->CSAR & ((1U << ssize) - 1U)) || (c->CDAR & ((1U << dsize) - 1U)) ||
+        (suv & ((1U << ssize) - 1U)) || (duv & ((1U << dsize) - 1U))) {
+        mdma_error(n, MDMA_CESR_ASE, "address or block offset not aligned to the data size");
+        return;
+    }
+
+    first_src = mdma_block_addr(c->CSAR, 0, bndt, suv, (c->CBNDTR & MDMA_CBNDTR_BRSUM) != 0);
+    last_src = mdma_block_addr(c->CSAR, blocks - 1U, bndt, suv, (c->CBNDTR & MDMA_CBNDTR_BRSUM) != 0);
+    first_dst = mdma_block_addr(c->CDAR, 0, bndt, duv, (c->CBNDTR & MDMA_CBNDTR_BRDUM) != 0);
+    last_dst = mdma_block_addr(c->CDAR, blocks - 1U, bndt, duv, (c->CBNDTR & MDMA_CBNDTR_BRDUM) != 0);
+    if (!sim_mem_valid(first_src, bndt) || !sim_mem_valid(last_src, bndt)) {
+        mdma_error(n, 0, "source outside simulated memory");
+        return;
+    }
+    if (!sim_mem_valid(first_dst, bndt) || !sim_mem_valid(last_dst, bndt)) {
+        mdma_error(n, MDMA_CESR_TED, "destination outside simulated memory");
+        return;
+    }
+
+    chan[n].bytes = (uint64_t)bndt * blocks;
+    cycles = SIM_OSPI(c->CSAR) ? chan[n].bytes * SIM_OSPI_CYCLES_PER_BYTE
+                               : chan[n].bytes / SIM_MDMA_BYTES_PER_CYCLE;
+    cycles += SIM_MDMA_SETUP_CYCLES;
+    chan[n].active = true;
+    chan[n].done_at = sim_now + cycles;
+    c->CISR |= MDMA_CISR_CRQA;
+    stats.cycles += cycles;
+
+    SIM_LOG("mdma: channel %u %u x %u bytes 0x%08x -> 0x%08x, done in %llu cycles\n",
+            n, blocks, bndt, c->CSAR, c->CDAR, (unsigned long long)cycles);
+}
+
+static void mdma_complete(uint32_t n)
+{
+    MDMA_Channel_TypeDef *c = chan_regs[n];
+    uint32_t bndt = c->CBNDTR & MDMA_CBNDTR_BNDT;
+    uint32_t blocks = ((c->CBNDTR & MDMA_CBNDTR_BRC) >> MDMA_CBNDTR_BRC_Pos) + 1U;
+    uint32_t suv = c->CBRUR & MDMA_CBRUR_SUV;
+    uint32_t duv = (c->CBRUR & MDMA_CBRUR_DUV) >> MDMA_CBRUR_DUV_Pos;
+
+    for (uint32_t b = 0; b < blocks; b++) {
+        uint32_t src = mdma_block_addr(c->CSAR, b, bndt, suv, (c->CBNDTR & MDMA_CBNDTR_BRSUM) != 0);
+        uint32_t dst = mdma_block_addr(c->CDAR, b, bndt, duv, (c->CBNDTR & MDMA_CBNDTR_BRDUM) != 0);
+
+        if (SIM_GFXMMU_VIRTUAL(src) || SIM_GFXMMU_VIRTUAL(dst)) {
+            for (uint32_t i = 0; i < bndt; i++) {
+                sim_mem_write8(dst + i, sim_mem_read8(src + i));
+            }
+        } else {
+            memmove((void *)(uintptr_t)dst, (const void *)(uintptr_t)src, bndt);
+        }
+    }
+
+    chan[n].active = false;
+    c->CISR = (c->CISR & ~MDMA_CISR_CRQA) | MDMA_CISR_CTCIF | MDMA_CISR_BRTIF | MDMA_CISR_BTIF | MDMA_CISR_TCIF;
+    c->CCR &= ~MDMA_CCR_EN;
+    stats.jobs++;
+    stats.bytes += chan[n].bytes;
+}
+
+static void mdma_post(uint32_t offset, bool written, uint32_t old_value)
+{
+    uint32_t n = offset / 0x40U - 1U;
+    MDMA_Channel_TypeDef *c;
+
+    if (offset < 0x40U) {
+        if (written) {
+            regs->GISR0 = old_value;                            // Read only
+        }
+        return;
+    }
+    if (n >= SIM_MDMA_CHANNELS || !written) {
+        return;
+    }
+    c = chan_regs[n];
+
+    switch (offset % 0x40U) {
+    case offsetof(MDMA_Channel_TypeDef, CISR):
+        c->CISR = old_value;                                    // Read only
+        break;
+    case offsetof(MDMA_Channel_TypeDef, CIFCR):
+        c->CISR &= ~(c->CIFCR & MDMA_CISR_FLAGS);
+        if (c->CIFCR & MDMA_CIFCR_CTEIF) {
+            c->CESR = 0;
+        }
+        c->CIFCR = 0;
+        break;
+    case offsetof(MDMA_Channel_TypeDef, CESR):
+        c->CESR = old_value;
+        break;
+    case offsetof(MDMA_Channel_TypeDef, CCR):
+        if (!(c->CCR & MDMA_CCR_EN) && chan[n].active) {
+            /* Disabled mid transfer: stops, CTCIF tells the abort is done */
+            chan[n].active = false;
+            c->CISR = (c->CISR & ~MDMA_CISR_CRQA) | MDMA_CISR_CTCIF;
+            stats.aborts++;
+        }
+        if ((c->CCR & MDMA_CCR_SWRQ) && (c->CCR & MDMA_CCR_EN) && !chan[n].active) {
+            mdma_start(n);
+        }
+        c->CCR &= ~MDMA_CCR_SWRQ;                               // Write only
+        break;
+    default:
+        break;
+    }
+    mdma_update_gisr();
+}
+
+void sim_mdma_advance(uint64_t to)
+{
+    bool done = false;
+
+    for (uint32_t n = 0; n < SIM_MDMA_CHANNELS; n++) {
+        if (chan[n].active && chan[n].done_at <= to) {
+            mdma_complete(n);
+            done = true;
+        }
+    }
+    if (done) {
+        mdma_update_gisr();
+    }
+}
+
+uint64_t sim_mdma_cycles_to_done(void)
+{
+    uint64_t next = 0;
+
+    for (uint32_t n = 0; n < SIM_MDMA_CHANNELS; n++) {
+        if (chan[n].active) {
+            uint64_t left = (chan[n].done_at > sim_now) ? chan[n].done_at - sim_now : 1U;
+
+            next = (next == 0 || left < next) ? left : next;
+        }
+    }
+    return next;
+}
+
+bool sim_mdma_irq_pending(void)
+{
+    return regs->GISR0 != 0;
+}
+
+void sim_mdma_init(void)
+{
+    regs = (MDMA_TypeDef *)sim_device_map(MDMA_BASE, SIM_PAGE_SIZE, NULL, mdma_post);
+    for (uint32_t n = 0; n < SIM_MDMA_CHANNELS; n++) {
+        chan_regs[n] = (MDMA_Channel_TypeDef *)((uint8_t *)regs + 0x40U * (n + 1U));
+    }
+}
+
+const sim_mdma_stats_t *sim_mdma_get_stats(void)
+{
+    return &stats;
+}
+
+void sim_mdma_reset_stats(void)
+{
+    memset(&stats, 0, sizeof(stats));
+}
@@ -0,0 +1,142 @@
+/**
+ * @file sim_pixel.c
+ * @brief Pixel format decode / encode shared by the DMA2D and LTDC models
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note Colour mode numbers are the DMA2D_INPUT_xxx values, LTDC_PIXEL_FORMAT_xxx
+ *       and DMA2D_OUTPUT_xxx use the same encoding for the formats they share.
+ *       4-bit formats keep the first pixel in the low nibble.
+ */
+
+#include "sim_internal.h"
+
+enum {
+    CM_ARGB8888 = 0, CM_RGB888, CM_RGB565, CM_ARGB1555, CM_ARGB4444,
+    CM_L8, CM_AL44, CM_AL88, CM_L4, CM_A8, CM_A4,
+};
+
+static inline uint32_t argb(uint32_t a, uint32_t r, uint32_t g, uint32_t b)
+{
+    return (a << 24) | (r << 16) | (g << 8) | b;
+}
+
+static inline uint32_t expand5(uint32_t v) { return (v << 3) | (v >> 2); }
+static inline uint32_t expand6(uint32_t v) { return (v << 2) | (v >> 4); }
+static inline uint32_t expand4(uint32_t v) { return v * 17U; }
+
+static inline uint32_t lookup(const uint32_t *clut, uint32_t index)
+{
+    return clut ? clut[index] : argb(0xFF, index, index, index);
+}
+
+uint32_t sim_pixel_bits(uint32_t color_mode)
+{
+    switch (color_mode) {
+    case CM_ARGB8888:   return 32;
+    case CM_RGB888:     return 24;
+    case CM_RGB565:
+    case CM_ARGB1555:
+    case CM_ARGB4444:
+    case CM_AL88:       return 16;
+    case CM_L8:
+    case CM_AL44:
+    case CM_A8:         return 8;
+    case CM_L4:
+    case CM_A4:         return 4;
+    default:            return 0;
+    }
+}
+
+/**
+ * @param color  RGB used by the alpha-only formats (A8 / A4)
+ */
+uint32_t sim_pixel_read(uint32_t addr, uint32_t index, uint32_t color_mode, const uint32_t *clut, uint32_t color)
+{
+    uint64_t bit = (uint64_t)addr * 8U + (uint64_t)index * sim_pixel_bits(color_mode);
+    const volatile uint8_t *p = (const volatile uint8_t *)(uintptr_t)(bit >> 3);
+    uint8_t virt[4] = { 0 };
+    uint32_t v;
+
+    if (SIM_GFXMMU_VIRTUAL(bit >> 3)) {
+        for (uint32_t i = 0; i < (sim_pixel_bits(color_mode) + 7U) / 8U; i++) {
+            virt[i] = sim_mem_read8((uint32_t)(bit >> 3) + i);
+        }
+        p = virt;
+    }
+
+    switch (color_mode) {
+    case CM_ARGB8888:
+        return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+    case CM_RGB888:
+        return argb(0xFF, p[2], p[1], p[0]);
+    case CM_RGB565:
+        v = p[0] | (p[1] << 8);
+        return argb(0xFF, expand5(v >> 11), expand6((v >> 5) & 0x3F), expand5(v & 0x1F));
+    case CM_ARGB1555:
+        v = p[0] | (p[1] << 8);
+        return argb((v & 0x8000) ? 0xFF : 0, expand5((v >> 10) & 0x1F), expand5((v >> 5) & 0x1F), expand5(v & 0x1F));
+    case CM_ARGB4444:
+        v = p[0] | (p[1] << 8);
+        return argb(expand4(v >> 12), expand4((v >> 8) & 0xF), expand4((v >> 4) & 0xF), expand4(v & 0xF));
+    case CM_L8:
+        return lookup(clut, p[0]);
+    case CM_AL44:
+        return (lookup(clut, p[0] & 0xF) & 0x00FFFFFFUL) | (expand4(p[0] >> 4) << 24);
+    case CM_AL88:
+        return (lookup(clut, p[0]) & 0x00FFFFFFUL) | ((uint32_t)p[1] << 24);
+    case CM_L4:
+        return lookup(clut, (bit & 4) ? (p[0] >> 4) : (p[0] & 0xF));
+    case CM_A8:
+        return (color & 0x00FFFFFFUL) | ((uint32_t)p[0] << 24);
+    case CM_A4:
+        return (color & 0x00FFFFFFUL) | (expand4((bit & 4) ? (p[0] >> 4) : (p[0] & 0xF)) << 24);
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @brief Store an ARGB8888 pixel in one of the DMA2D output formats (truncating, like the hardware)
+ */
+void sim_pixel_write(uint32_t addr, uint32_t index, uint32_t color_mode, uint32_t c)
+{
+    uint32_t dst = addr + index * (sim_pixel_bits(color_mode) / 8U);
+    volatile uint8_t *p = (volatile uint8_t *)(uintptr_t)dst;
+    uint32_t a = c >> 24, r = (c >> 16) & 0xFF, g = (c >> 8) & 0xFF, b = c & 0xFF;
+    uint8_t virt[4] = { 0 };
+    uint32_t v;
+
+    if (SIM_GFXMMU_VIRTUAL(dst)) {
+        p = virt;
+    }
+
+    switch (color_mode) {
+    case CM_ARGB8888:
+        p[0] = b; p[1] = g; p[2] = r; p[3] = a;
+        break;
+    case CM_RGB888:
+        p[0] = b; p[1] = g; p[2] = r;
+        break;
+    case CM_RGB565:
+        v = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+        p[0] = v; p[1] = v >> 8;
+        break;
+    case CM_ARGB1555:
+        v = ((a >> 7) << 15) | ((r >> 3) << 10) | ((g >> 3) << 5) | (b >> 3);
+        p[0] = v; p[1] = v >> 8;
+        break;
+    case CM_ARGB4444:
+        v = ((a >> 4) << 12) | ((r >> 4) << 8) | ((g >> 4) << 4) | (b >> 4);
+        p[0] = v; p[1] = v >> 8;
+        break;
+    default:
+        break;
+    }
+
+    if (p == virt) {
+        for (uint32_t i = 0; i < sim_pixel_bits(color_mode) / 8U; i++) {
+            sim_mem_write8(dst + i, virt[i]);
+        }
+    }
+}
@@ -0,0 +1,70 @@
+/**
+ * @file sim_ppm.c
+ * @brief Binary PPM (P6) dumps of the composed LTDC output and of raw pixel buffers
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#include <stdlib.h>
+#include "sim_internal.h"
+
+static bool ppm_write(const char *path, const uint8_t *rgb, uint32_t width, uint32_t height)
+{
+    FILE *f = fopen(path, "wb");
+    bool ok;
+
+    if (f == NULL) {
+        return false;
+    }
+    fprintf(f, "P6\n%u %u\n255\n", width, height);
+    ok = fwrite(rgb, 3, (size_t)width * height, f) == (size_t)width * height;
+    return (fclose(f) == 0) && ok;
+}
+
+bool sim_dump_frame(const char *path)
+{
+    uint32_t width, height;
+    uint8_t *rgb;
+    bool ok;
+
+    if (!sim_ltdc_compose(NULL, &width, &height)) {
+        return false;
+    }
+    rgb = malloc((size_t)width * height * 3U);
+    if (rgb == NULL) {
+        return false;
+    }
+    ok = sim_ltdc_compose(rgb, &width, &height) && ppm_write(path, rgb, width, height);
+    free(rgb);
+    return ok;
+}
+
+bool sim_dump_buffer(const char *path, uint32_t addr, uint32_t color_mode,
+                     uint32_t width, uint32_t height, uint32_t pitch, const uint32_t *clut)
+{
+    uint32_t bits = sim_pixel_bits(color_mode);
+    uint8_t *rgb;
+    bool ok;
+
+    if (bits == 0 || !sim_mem_valid(addr, pitch * (height - 1U) + (width * bits + 7U) / 8U)) {
+        return false;
+    }
+    rgb = malloc((size_t)width * height * 3U);
+    if (rgb == NULL) {
+        return false;
+    }
+    for (uint32_t y = 0; y < height; y++) {
+        for (uint32_t x = 0; x < width; x++) {
+            uint32_t c = sim_pixel_read(addr + y * pitch, x, color_mode, clut, 0x00FFFFFFUL);
+            uint8_t *p = rgb + ((size_t)y * width + x) * 3U;
+
+            p[0] = (uint8_t)(c >> 16);
+            p[1] = (uint8_t)(c >> 8);
+            p[2] = (uint8_t)c;
+        }
+    }
+    ok = ppm_write(path, rgb, width, height);
+    free(rgb);
+    return ok;
+}
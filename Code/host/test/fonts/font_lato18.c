@@ -0,0 +1,1084 @@
+/* Generated by Tools/fontgen/fontgen.py, do not edit */
+/* Lato-Regular.ttf, 18 px, A4, 95 glyphs, 641 kerning pairs, 5114 bitmap bytes */
+
+#include "font_lato18.h"
+
+#define FONT_DATA __attribute__((section(".ro_data"), aligned(32)))
+
+FONT_DATA static const uint8_t font_lato18_bitmaps[5114] = {
+    0xDA, 0x00, 0xDA, 0x00, 0xDA, 0x00, 0xDA, 0x00, 0xDA, 0x00, 0xDA, 0x00, 0xC9, 0x00, 0xB7, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 0x01, 0xC9, 0xA0, 0x0C, 0xC9, 0xA0, 0x0C,
+    0xB9, 0x90, 0x0B, 0x86, 0x60, 0x08, 0x00, 0x20, 0x2E, 0x90, 0x09, 0x00, 0x50, 0x0E, 0xC0, 0x08,
+    0x00, 0x80, 0x0C, 0xF0, 0x05, 0x00, 0xB0, 0x09, 0xF3, 0x02, 0xE0, 0xFF, 0xFF, 0xFF, 0xCF, 0x00,
+    0xF1, 0x03, 0xB8, 0x00, 0x00, 0xF4, 0x01, 0x9B, 0x00, 0x00, 0xC7, 0x00, 0x6E, 0x00, 0xF7, 0xFF,
+    0xFF, 0xFF, 0x4F, 0x00, 0x7D, 0x50, 0x0F, 0x00, 0x10, 0x4F, 0x80, 0x0C, 0x00, 0x40, 0x1F, 0xB0,
+    0x0A, 0x00, 0x70, 0x0C, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xD8, 0xEF, 0x2A,
+    0x00, 0xB0, 0x9E, 0xAD, 0xEC, 0x01, 0xF4, 0x04, 0x3C, 0x20, 0x00, 0xF7, 0x01, 0x2D, 0x00, 0x00,
+    0xF5, 0x08, 0x1E, 0x00, 0x00, 0xB0, 0xCF, 0x2F, 0x00, 0x00, 0x00, 0xC7, 0xFF, 0x2B, 0x00, 0x00,
+    0x20, 0x7E, 0xEE, 0x02, 0x00, 0x30, 0x0C, 0xF4, 0x07, 0x00, 0x40, 0x0B, 0xF1, 0x08, 0x35, 0x50,
+    0x0A, 0xF5, 0x04, 0xFB, 0x9A, 0x8B, 0xAF, 0x00, 0x70, 0xFC, 0xDF, 0x07, 0x00, 0x00, 0x80, 0x07,
+    0x00, 0x00, 0x00, 0x90, 0x05, 0x00, 0x00, 0x20, 0xEB, 0x2B, 0x00, 0x00, 0xE4, 0x04, 0xD0, 0x18,
+    0xD8, 0x00, 0x10, 0x8E, 0x00, 0xF3, 0x01, 0xF1, 0x03, 0xB0, 0x0B, 0x00, 0xE5, 0x00, 0xE0, 0x05,
+    0xE7, 0x02, 0x00, 0xF3, 0x01, 0xF0, 0x33, 0x4F, 0x00, 0x00, 0xD0, 0x18, 0xC8, 0xD1, 0x08, 0x00,
+    0x00, 0x20, 0xEB, 0x2B, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x2E, 0xB2, 0xCE, 0x04, 0x00,
+    0x00, 0xF3, 0x05, 0x9C, 0x51, 0x2E, 0x00, 0x10, 0x9D, 0x20, 0x2F, 0x00, 0x6C, 0x00, 0xA0, 0x0C,
+    0x20, 0x2F, 0x00, 0x6C, 0x00, 0xE6, 0x02, 0x00, 0x8D, 0x41, 0x2E, 0x30, 0x5E, 0x00, 0x00, 0xB2,
+    0xCE, 0x04, 0x00, 0x20, 0xEA, 0x9D, 0x01, 0x00, 0x00, 0x00, 0xD1, 0x1A, 0xD2, 0x0B, 0x00, 0x00,
+    0x00, 0xF5, 0x01, 0x40, 0x1E, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6,
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xEF, 0x02,
+    0x00, 0x00, 0x00, 0x30, 0xBE, 0xF8, 0x1D, 0x30, 0x1F, 0x00, 0xD0, 0x0C, 0x60, 0xCF, 0x71, 0x0E,
+    0x00, 0xF3, 0x06, 0x00, 0xF5, 0xEB, 0x08, 0x00, 0xF2, 0x08, 0x00, 0x40, 0xFF, 0x02, 0x00, 0x90,
+    0x6F, 0x11, 0xD5, 0xED, 0x2C, 0x00, 0x00, 0xC6, 0xEF, 0x6B, 0x20, 0xDC, 0x02, 0xC9, 0xC9, 0xB9,
+    0x86, 0x00, 0x58, 0x20, 0x5F, 0x90, 0x0D, 0xE1, 0x07, 0xF5, 0x02, 0xE8, 0x00, 0xBA, 0x00, 0xAB,
+    0x00, 0x9C, 0x00, 0xAB, 0x00, 0xCA, 0x00, 0xE7, 0x00, 0xF3, 0x04, 0xD0, 0x09, 0x70, 0x1E, 0x10,
+    0x7E, 0x00, 0x24, 0xB2, 0x00, 0x00, 0xF1, 0x06, 0x00, 0x90, 0x0D, 0x00, 0x30, 0x4F, 0x00, 0x00,
+    0x9D, 0x00, 0x00, 0xC9, 0x00, 0x00, 0xE7, 0x00, 0x00, 0xF6, 0x00, 0x00, 0xF5, 0x01, 0x00, 0xF6,
+    0x00, 0x00, 0xE7, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x8E, 0x00, 0x50, 0x2F, 0x00, 0xB0, 0x0C, 0x00,
+    0xF3, 0x04, 0x00, 0x61, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x90, 0xC2, 0x91, 0x01, 0x30, 0xDC,
+    0x5C, 0x00, 0x30, 0xDB, 0x5C, 0x00, 0xA0, 0xC2, 0x91, 0x02, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7,
+    0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00,
+    0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0xD1, 0x0C, 0x30, 0x0D, 0xC0,
+    0x05, 0x20, 0x00, 0xF1, 0xFF, 0x5F, 0xD1, 0x0B, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x20, 0x3F,
+    0x00, 0x00, 0x80, 0x0C, 0x00, 0x00, 0xE0, 0x06, 0x00, 0x00, 0xE5, 0x00, 0x00, 0x00, 0x8C, 0x00,
+    0x00, 0x30, 0x2F, 0x00, 0x00, 0x90, 0x0B, 0x00, 0x00, 0xE1, 0x04, 0x00, 0x00, 0xD7, 0x00, 0x00,
+    0x00, 0x7D, 0x00, 0x00, 0x40, 0x1F, 0x00, 0x00, 0xA0, 0x09, 0x00, 0x00, 0x70, 0x01, 0x00, 0x00,
+    0x00, 0xA2, 0xFE, 0x5C, 0x00, 0x20, 0xBD, 0x12, 0xF6, 0x06, 0xA0, 0x1E, 0x00, 0x80, 0x2E, 0xF1,
+    0x08, 0x00, 0x20, 0x7F, 0xF4, 0x05, 0x00, 0x00, 0xBE, 0xF6, 0x04, 0x00, 0x00, 0xDC, 0xF7, 0x03,
+    0x00, 0x00, 0xDC, 0xF6, 0x04, 0x00, 0x00, 0xDC, 0xF4, 0x05, 0x00, 0x00, 0xBE, 0xF1, 0x08, 0x00,
+    0x20, 0x7F, 0xA0, 0x1E, 0x00, 0x80, 0x2F, 0x20, 0xBD, 0x12, 0xF6, 0x06, 0x00, 0xA2, 0xFE, 0x5C,
+    0x00, 0x00, 0x10, 0xEC, 0x00, 0x00, 0x00, 0xD2, 0xEF, 0x00, 0x00, 0x40, 0xDE, 0xEB, 0x00, 0x00,
+    0xE1, 0x1C, 0xEA, 0x00, 0x00, 0x30, 0x00, 0xEA, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00,
+    0x00, 0xEA, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0x00,
+    0xEA, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x60, 0xFF, 0xFF,
+    0xFF, 0x08, 0x00, 0x91, 0xED, 0x6C, 0x00, 0x10, 0xCD, 0x13, 0xE5, 0x08, 0x70, 0x1F, 0x00, 0x80,
+    0x1F, 0x60, 0x06, 0x00, 0x60, 0x4F, 0x00, 0x00, 0x00, 0x90, 0x2F, 0x00, 0x00, 0x00, 0xE2, 0x0D,
+    0x00, 0x00, 0x00, 0xFB, 0x05, 0x00, 0x00, 0xA0, 0x8F, 0x00, 0x00, 0x00, 0xFA, 0x0A, 0x00, 0x00,
+    0x90, 0xAF, 0x00, 0x00, 0x00, 0xF9, 0x0B, 0x00, 0x00, 0x80, 0xCF, 0x01, 0x00, 0x00, 0xF1, 0xEF,
+    0xFF, 0xFF, 0x7F, 0x10, 0xD7, 0xDE, 0x18, 0x00, 0xB0, 0x4D, 0x41, 0xBE, 0x00, 0xF4, 0x04, 0x00,
+    0xF6, 0x03, 0x95, 0x00, 0x00, 0xF4, 0x05, 0x00, 0x00, 0x00, 0xF7, 0x02, 0x00, 0x00, 0x62, 0x8E,
+    0x00, 0x00, 0x40, 0xFF, 0x1A, 0x00, 0x00, 0x00, 0x41, 0xDC, 0x01, 0x00, 0x00, 0x00, 0xF3, 0x07,
+    0x35, 0x00, 0x00, 0xF0, 0x09, 0xDC, 0x00, 0x00, 0xF4, 0x06, 0xF3, 0x2A, 0x41, 0xCD, 0x00, 0x30,
+    0xEB, 0xCE, 0x17, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x02, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0xF3, 0xFB, 0x02, 0x00, 0x00, 0x10, 0xCD, 0xF4, 0x02, 0x00, 0x00, 0x90, 0x2F, 0xF4,
+    0x02, 0x00, 0x00, 0xF5, 0x07, 0xF4, 0x02, 0x00, 0x10, 0xCE, 0x00, 0xF4, 0x02, 0x00, 0xB0, 0x2E,
+    0x00, 0xF4, 0x02, 0x00, 0xF6, 0x06, 0x00, 0xF4, 0x02, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x01,
+    0x00, 0x00, 0x00, 0xF4, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF4,
+    0x02, 0x00, 0x60, 0xFF, 0xFF, 0xAF, 0x00, 0x90, 0x0B, 0x00, 0x00, 0x00, 0xB0, 0x09, 0x00, 0x00,
+    0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0xF1, 0x05, 0x00, 0x00, 0x00, 0xF4, 0xEE, 0xCF, 0x06, 0x00,
+    0x51, 0x13, 0x82, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xEB, 0x01, 0x00, 0x00, 0x00, 0xF7, 0x03, 0x00,
+    0x00, 0x00, 0xF8, 0x02, 0x00, 0x00, 0x00, 0xCD, 0x00, 0xAA, 0x13, 0xA2, 0x3E, 0x00, 0xA5, 0xFE,
+    0xAE, 0x02, 0x00, 0x00, 0x00, 0x40, 0xAE, 0x00, 0x00, 0x00, 0xE1, 0x1D, 0x00, 0x00, 0x00, 0xEB,
+    0x02, 0x00, 0x00, 0x80, 0x4F, 0x00, 0x00, 0x00, 0xF4, 0x07, 0x00, 0x00, 0x10, 0xED, 0xEC, 0x9E,
+    0x01, 0x70, 0xBF, 0x13, 0xD4, 0x0D, 0xD0, 0x0D, 0x00, 0x50, 0x7F, 0xF0, 0x09, 0x00, 0x00, 0xAF,
+    0xE0, 0x09, 0x00, 0x10, 0x9F, 0xA0, 0x0D, 0x00, 0x50, 0x4F, 0x20, 0xAE, 0x12, 0xE5, 0x09, 0x00,
+    0xA2, 0xFE, 0x6C, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x30, 0x8F, 0x00, 0x00,
+    0x00, 0xB0, 0x2F, 0x00, 0x00, 0x00, 0xF3, 0x09, 0x00, 0x00, 0x00, 0xFA, 0x02, 0x00, 0x00, 0x30,
+    0x9F, 0x00, 0x00, 0x00, 0xA0, 0x2F, 0x00, 0x00, 0x00, 0xF2, 0x0A, 0x00, 0x00, 0x00, 0xFA, 0x02,
+    0x00, 0x00, 0x20, 0xAF, 0x00, 0x00, 0x00, 0x90, 0x3F, 0x00, 0x00, 0x00, 0xF2, 0x0A, 0x00, 0x00,
+    0x00, 0xE9, 0x02, 0x00, 0x00, 0x00, 0xA2, 0xFE, 0x5C, 0x00, 0x10, 0xBE, 0x12, 0xF6, 0x06, 0x80,
+    0x1F, 0x00, 0xA0, 0x0E, 0xA0, 0x0E, 0x00, 0x70, 0x1F, 0x80, 0x1F, 0x00, 0xA0, 0x0E, 0x10, 0xBD,
+    0x12, 0xF6, 0x06, 0x00, 0xE4, 0xFF, 0x9F, 0x00, 0x60, 0x8F, 0x12, 0xD4, 0x0B, 0xE0, 0x0B, 0x00,
+    0x50, 0x6F, 0xF2, 0x08, 0x00, 0x20, 0x8F, 0xE0, 0x0B, 0x00, 0x50, 0x6F, 0x60, 0x8F, 0x12, 0xD4,
+    0x1C, 0x00, 0xB4, 0xEE, 0x7C, 0x01, 0x00, 0xD6, 0xDF, 0x08, 0x00, 0xA0, 0x4D, 0x41, 0xBD, 0x00,
+    0xF4, 0x04, 0x00, 0xF3, 0x06, 0xF9, 0x00, 0x00, 0xE0, 0x0A, 0xFA, 0x00, 0x00, 0xE0, 0x0A, 0xF7,
+    0x04, 0x00, 0xF3, 0x07, 0xD1, 0x3D, 0x41, 0xFD, 0x02, 0x20, 0xEA, 0xBE, 0x9E, 0x00, 0x00, 0x00,
+    0x80, 0x1D, 0x00, 0x00, 0x00, 0xF5, 0x04, 0x00, 0x00, 0x30, 0x8F, 0x00, 0x00, 0x00, 0xE2, 0x0C,
+    0x00, 0x00, 0x10, 0xEC, 0x03, 0x00, 0x00, 0xE9, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x03, 0xE9, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x03, 0xC0, 0x04, 0xA7, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x20, 0x49, 0x00, 0x10, 0xF8, 0x2D, 0x10, 0xE8, 0x5D, 0x00, 0xE6, 0x6D, 0x00,
+    0x00, 0xD5, 0x7E, 0x01, 0x00, 0x00, 0xD6, 0x7E, 0x01, 0x00, 0x00, 0xE7, 0x2E, 0x00, 0x00, 0x10,
+    0x47, 0xFA, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFF, 0xFF, 0xFF, 0x01, 0x4A, 0x00, 0x00, 0x00, 0xF8, 0x4C, 0x00, 0x00, 0x20, 0xFA, 0x3B,
+    0x00, 0x00, 0x20, 0xFA, 0x1A, 0x00, 0x40, 0xFB, 0x09, 0x40, 0xFB, 0x29, 0x00, 0xFA, 0x2A, 0x00,
+    0x00, 0x39, 0x00, 0x00, 0x00, 0x92, 0xFD, 0x5C, 0x00, 0xB6, 0x13, 0xF6, 0x05, 0x00, 0x00, 0xB0,
+    0x0B, 0x00, 0x00, 0xB0, 0x0C, 0x00, 0x00, 0xF3, 0x09, 0x00, 0x30, 0xDD, 0x02, 0x00, 0xE2, 0x2D,
+    0x00, 0x00, 0xF6, 0x02, 0x00, 0x00, 0xD5, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x02, 0x00, 0x00, 0x00, 0x93, 0xED, 0xBE, 0x17, 0x00,
+    0x00, 0x00, 0x70, 0x7E, 0x02, 0x41, 0xD9, 0x03, 0x00, 0x00, 0xC8, 0x01, 0x00, 0x00, 0x50, 0x2D,
+    0x00, 0x40, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x99, 0x00, 0xB0, 0x07, 0x00, 0xC7, 0xEF, 0x07, 0xD3,
+    0x00, 0xF1, 0x02, 0xC1, 0x4C, 0xC1, 0x06, 0xF2, 0x01, 0xF2, 0x00, 0xD7, 0x01, 0xF1, 0x01, 0xF3,
+    0x00, 0xF3, 0x00, 0x8B, 0x00, 0xC7, 0x00, 0xB7, 0x00, 0xF1, 0x02, 0xBA, 0x31, 0xDD, 0x41, 0x3E,
+    0x00, 0xC0, 0x07, 0xC2, 0xBF, 0xB2, 0xCF, 0x04, 0x00, 0x50, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xCA, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x7E, 0x13, 0x20, 0xB5, 0x0D,
+    0x00, 0x00, 0x00, 0x93, 0xED, 0xEF, 0x6B, 0x01, 0x00, 0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF5, 0x9E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDB, 0xE9, 0x01, 0x00, 0x00, 0x00, 0x20,
+    0x7F, 0xF3, 0x06, 0x00, 0x00, 0x00, 0x80, 0x2F, 0xC0, 0x0C, 0x00, 0x00, 0x00, 0xE0, 0x0B, 0x70,
+    0x3F, 0x00, 0x00, 0x00, 0xF5, 0x05, 0x10, 0x9F, 0x00, 0x00, 0x00, 0xEB, 0x00, 0x00, 0xEA, 0x01,
+    0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xC0, 0x0C, 0x00, 0xE0,
+    0x0B, 0x00, 0x00, 0x70, 0x3F, 0x00, 0xF5, 0x06, 0x00, 0x00, 0x20, 0x9F, 0x00, 0xEB, 0x01, 0x00,
+    0x00, 0x00, 0xEB, 0x01, 0xF7, 0xFF, 0xEF, 0x7C, 0x00, 0xF7, 0x05, 0x20, 0xF7, 0x0A, 0xF7, 0x05,
+    0x00, 0xB0, 0x1F, 0xF7, 0x05, 0x00, 0x80, 0x3F, 0xF7, 0x05, 0x00, 0xB0, 0x1E, 0xF7, 0x05, 0x20,
+    0xF8, 0x05, 0xF7, 0xFF, 0xFF, 0x7F, 0x01, 0xF7, 0x05, 0x10, 0xD4, 0x1D, 0xF7, 0x05, 0x00, 0x40,
+    0x8F, 0xF7, 0x05, 0x00, 0x20, 0x9F, 0xF7, 0x05, 0x00, 0x50, 0x7F, 0xF7, 0x05, 0x10, 0xD4, 0x1D,
+    0xF7, 0xFF, 0xFF, 0x8D, 0x01, 0x00, 0x00, 0xB6, 0xFE, 0xBE, 0x05, 0x00, 0xD2, 0x6D, 0x01, 0x82,
+    0x5F, 0x10, 0xDD, 0x01, 0x00, 0x00, 0x02, 0x80, 0x4F, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x0D, 0x00,
+    0x00, 0x00, 0x00, 0xF2, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x09, 0x00, 0x00, 0x00, 0x00, 0xF2,
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x90, 0x3F, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xCE, 0x01, 0x00, 0x00, 0x04, 0x00, 0xE3, 0x5C, 0x01, 0x93, 0x5F, 0x00, 0x10, 0xD8,
+    0xFE, 0xAD, 0x04, 0xF7, 0xFF, 0xFF, 0xAD, 0x04, 0x00, 0xF7, 0x05, 0x00, 0x82, 0x9F, 0x00, 0xF7,
+    0x05, 0x00, 0x00, 0xF5, 0x08, 0xF7, 0x05, 0x00, 0x00, 0xA0, 0x2F, 0xF7, 0x05, 0x00, 0x00, 0x50,
+    0x7F, 0xF7, 0x05, 0x00, 0x00, 0x20, 0xAF, 0xF7, 0x05, 0x00, 0x00, 0x10, 0xBF, 0xF7, 0x05, 0x00,
+    0x00, 0x20, 0xAF, 0xF7, 0x05, 0x00, 0x00, 0x50, 0x7F, 0xF7, 0x05, 0x00, 0x00, 0xA0, 0x2F, 0xF7,
+    0x05, 0x00, 0x00, 0xF5, 0x08, 0xF7, 0x05, 0x00, 0x82, 0x9F, 0x00, 0xF7, 0xFF, 0xFF, 0xAE, 0x04,
+    0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x08, 0xF7, 0x05, 0x00, 0x00, 0x00, 0xF7, 0x05, 0x00, 0x00, 0x00,
+    0xF7, 0x05, 0x00, 0x00, 0x00, 0xF7, 0x05, 0x00, 0x00, 0x00, 0xF7, 0x05, 0x00, 0x00, 0x00, 0xF7,
+    0xFF, 0xFF, 0x5F, 0x00, 0xF7, 0x05, 0x00, 0x00, 0x00, 0xF7, 0x05, 0x00, 0x00, 0x00, 0xF7, 0x05,
+    0x00, 0x00, 0x00, 0xF7, 0x05, 0x00, 0x00, 0x00, 0xF7, 0x05, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF,
+    0xFF, 0x08, 0xF7, 0xFF, 0xFF, 0xFF, 0x08, 0xF7, 0x05, 0x00, 0x00, 0x00, 0xF7, 0x05, 0x00, 0x00,
+    0x00, 0xF7, 0x05, 0x00, 0x00, 0x00, 0xF7, 0x05, 0x00, 0x00, 0x00, 0xF7, 0x05, 0x00, 0x00, 0x00,
+    0xF7, 0xFF, 0xFF, 0x9F, 0x00, 0xF7, 0x05, 0x00, 0x00, 0x00, 0xF7, 0x05, 0x00, 0x00, 0x00, 0xF7,
+    0x05, 0x00, 0x00, 0x00, 0xF7, 0x05, 0x00, 0x00, 0x00, 0xF7, 0x05, 0x00, 0x00, 0x00, 0xF7, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0xB6, 0xFE, 0xCE, 0x28, 0x00, 0x00, 0xD2, 0x6D, 0x01, 0x72, 0xBE,
+    0x00, 0x10, 0xDD, 0x01, 0x00, 0x00, 0x21, 0x00, 0x80, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
+    0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x09, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF2, 0x0A, 0x00, 0x00, 0xFD, 0xFF, 0x01, 0xD0, 0x0D, 0x00, 0x00, 0x00,
+    0xF7, 0x01, 0x80, 0x4F, 0x00, 0x00, 0x00, 0xF7, 0x01, 0x10, 0xDD, 0x01, 0x00, 0x00, 0xF7, 0x01,
+    0x00, 0xD2, 0x5D, 0x01, 0x61, 0xFD, 0x01, 0x00, 0x10, 0xC7, 0xFE, 0xCE, 0x49, 0x00, 0xF7, 0x05,
+    0x00, 0x00, 0xB0, 0x0F, 0xF7, 0x05, 0x00, 0x00, 0xB0, 0x0F, 0xF7, 0x05, 0x00, 0x00, 0xB0, 0x0F,
+    0xF7, 0x05, 0x00, 0x00, 0xB0, 0x0F, 0xF7, 0x05, 0x00, 0x00, 0xB0, 0x0F, 0xF7, 0x05, 0x00, 0x00,
+    0xB0, 0x0F, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF7, 0x05, 0x00, 0x00, 0xB0, 0x0F, 0xF7, 0x05,
+    0x00, 0x00, 0xB0, 0x0F, 0xF7, 0x05, 0x00, 0x00, 0xB0, 0x0F, 0xF7, 0x05, 0x00, 0x00, 0xB0, 0x0F,
+    0xF7, 0x05, 0x00, 0x00, 0xB0, 0x0F, 0xF7, 0x05, 0x00, 0x00, 0xB0, 0x0F, 0xF2, 0x0A, 0xF2, 0x0A,
+    0xF2, 0x0A, 0xF2, 0x0A, 0xF2, 0x0A, 0xF2, 0x0A, 0xF2, 0x0A, 0xF2, 0x0A, 0xF2, 0x0A, 0xF2, 0x0A,
+    0xF2, 0x0A, 0xF2, 0x0A, 0xF2, 0x0A, 0x00, 0x00, 0xF5, 0x06, 0x00, 0x00, 0xF5, 0x06, 0x00, 0x00,
+    0xF5, 0x06, 0x00, 0x00, 0xF5, 0x06, 0x00, 0x00, 0xF5, 0x06, 0x00, 0x00, 0xF5, 0x06, 0x00, 0x00,
+    0xF5, 0x06, 0x00, 0x00, 0xF5, 0x06, 0x00, 0x00, 0xF5, 0x06, 0x00, 0x00, 0xF6, 0x05, 0x00, 0x00,
+    0xF9, 0x01, 0x00, 0x61, 0x8F, 0x00, 0xE5, 0xDF, 0x07, 0x00, 0xF4, 0x07, 0x00, 0x00, 0xFA, 0x04,
+    0xF4, 0x07, 0x00, 0x80, 0x6F, 0x00, 0xF4, 0x07, 0x00, 0xF5, 0x08, 0x00, 0xF4, 0x07, 0x30, 0xAF,
+    0x00, 0x00, 0xF4, 0x07, 0xE2, 0x1C, 0x00, 0x00, 0xF4, 0x17, 0xDC, 0x02, 0x00, 0x00, 0xF4, 0xFF,
+    0x7F, 0x00, 0x00, 0x00, 0xF4, 0x17, 0xFA, 0x05, 0x00, 0x00, 0xF4, 0x07, 0xC0, 0x3F, 0x00, 0x00,
+    0xF4, 0x07, 0x10, 0xED, 0x02, 0x00, 0xF4, 0x07, 0x00, 0xE2, 0x1D, 0x00, 0xF4, 0x07, 0x00, 0x40,
+    0xBF, 0x00, 0xF4, 0x07, 0x00, 0x00, 0xF6, 0x09, 0xF7, 0x05, 0x00, 0x00, 0xF7, 0x05, 0x00, 0x00,
+    0xF7, 0x05, 0x00, 0x00, 0xF7, 0x05, 0x00, 0x00, 0xF7, 0x05, 0x00, 0x00, 0xF7, 0x05, 0x00, 0x00,
+    0xF7, 0x05, 0x00, 0x00, 0xF7, 0x05, 0x00, 0x00, 0xF7, 0x05, 0x00, 0x00, 0xF7, 0x05, 0x00, 0x00,
+    0xF7, 0x05, 0x00, 0x00, 0xF7, 0x05, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xDF, 0xF7, 0x08, 0x00, 0x00,
+    0x00, 0x10, 0xFE, 0xF7, 0x2F, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xF7, 0xAF, 0x00, 0x00, 0x00, 0xF2,
+    0xFF, 0xF7, 0xF8, 0x03, 0x00, 0x00, 0xEA, 0xF9, 0xF7, 0xD2, 0x0C, 0x00, 0x30, 0x7F, 0xF8, 0xF7,
+    0x51, 0x5F, 0x00, 0xB0, 0x1D, 0xF8, 0xF7, 0x01, 0xDC, 0x00, 0xF4, 0x06, 0xF8, 0xF7, 0x01, 0xF4,
+    0x07, 0xCC, 0x00, 0xF8, 0xF7, 0x01, 0xA0, 0x6E, 0x4F, 0x00, 0xF8, 0xF7, 0x01, 0x20, 0xFF, 0x0B,
+    0x00, 0xF8, 0xF7, 0x01, 0x00, 0xF8, 0x03, 0x00, 0xF8, 0xF7, 0x01, 0x00, 0x10, 0x00, 0x00, 0xF8,
+    0xF7, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xE7, 0x04, 0x00, 0x00, 0x80, 0x0F, 0xF7, 0x1D, 0x00,
+    0x00, 0x80, 0x0F, 0xF7, 0xBF, 0x00, 0x00, 0x80, 0x0F, 0xF7, 0xF9, 0x08, 0x00, 0x80, 0x0F, 0xF7,
+    0xB2, 0x5F, 0x00, 0x80, 0x0F, 0xF7, 0x11, 0xEE, 0x02, 0x80, 0x0F, 0xF7, 0x01, 0xF4, 0x0C, 0x80,
+    0x0F, 0xF7, 0x01, 0x70, 0x9F, 0x80, 0x0F, 0xF7, 0x01, 0x00, 0xFA, 0x86, 0x0F, 0xF7, 0x01, 0x00,
+    0xD1, 0xAE, 0x0F, 0xF7, 0x01, 0x00, 0x30, 0xFF, 0x0F, 0xF7, 0x01, 0x00, 0x00, 0xF6, 0x0F, 0xF7,
+    0x01, 0x00, 0x00, 0x90, 0x0F, 0x00, 0x10, 0xC7, 0xFE, 0x9D, 0x02, 0x00, 0x00, 0xD2, 0x5D, 0x11,
+    0xA3, 0x6F, 0x00, 0x10, 0xCD, 0x01, 0x00, 0x00, 0xF8, 0x05, 0x80, 0x4F, 0x00, 0x00, 0x00, 0xD0,
+    0x0D, 0xD0, 0x0D, 0x00, 0x00, 0x00, 0x80, 0x4F, 0xF1, 0x0A, 0x00, 0x00, 0x00, 0x50, 0x7F, 0xF2,
+    0x09, 0x00, 0x00, 0x00, 0x40, 0x8F, 0xF1, 0x0A, 0x00, 0x00, 0x00, 0x50, 0x7F, 0xD0, 0x0D, 0x00,
+    0x00, 0x00, 0x80, 0x4F, 0x80, 0x3F, 0x00, 0x00, 0x00, 0xD0, 0x0D, 0x10, 0xCD, 0x01, 0x00, 0x00,
+    0xF7, 0x05, 0x00, 0xD2, 0x5D, 0x01, 0x93, 0x6F, 0x00, 0x00, 0x10, 0xC7, 0xFE, 0x9D, 0x02, 0x00,
+    0xF4, 0xFF, 0xEF, 0x5B, 0x00, 0xF4, 0x07, 0x20, 0xF9, 0x08, 0xF4, 0x07, 0x00, 0xB0, 0x2F, 0xF4,
+    0x07, 0x00, 0x70, 0x5F, 0xF4, 0x07, 0x00, 0x70, 0x5F, 0xF4, 0x07, 0x00, 0xC0, 0x1F, 0xF4, 0x07,
+    0x20, 0xFA, 0x07, 0xF4, 0xFF, 0xEF, 0x4B, 0x00, 0xF4, 0x07, 0x00, 0x00, 0x00, 0xF4, 0x07, 0x00,
+    0x00, 0x00, 0xF4, 0x07, 0x00, 0x00, 0x00, 0xF4, 0x07, 0x00, 0x00, 0x00, 0xF4, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0xC7, 0xFE, 0x9D, 0x02, 0x00, 0x00, 0x00, 0xD2, 0x5D, 0x11, 0xA3, 0x5F, 0x00,
+    0x00, 0x10, 0xCD, 0x01, 0x00, 0x00, 0xF8, 0x04, 0x00, 0x80, 0x4F, 0x00, 0x00, 0x00, 0xD0, 0x0C,
+    0x00, 0xD0, 0x0D, 0x00, 0x00, 0x00, 0x80, 0x3F, 0x00, 0xF1, 0x0A, 0x00, 0x00, 0x00, 0x50, 0x7F,
+    0x00, 0xF2, 0x09, 0x00, 0x00, 0x00, 0x40, 0x8F, 0x00, 0xF1, 0x0A, 0x00, 0x00, 0x00, 0x50, 0x7F,
+    0x00, 0xD0, 0x0D, 0x00, 0x00, 0x00, 0x80, 0x5F, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 0xD0, 0x1E,
+    0x00, 0x10, 0xCD, 0x01, 0x00, 0x00, 0xF7, 0x07, 0x00, 0x00, 0xD2, 0x5D, 0x01, 0x93, 0xBF, 0x00,
+    0x00, 0x00, 0x10, 0xC7, 0xFE, 0xDE, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xDD, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xAE,
+    0x00, 0xF4, 0xFF, 0xEF, 0x4B, 0x00, 0x00, 0xF4, 0x07, 0x30, 0xFA, 0x05, 0x00, 0xF4, 0x07, 0x00,
+    0xD0, 0x0D, 0x00, 0xF4, 0x07, 0x00, 0xA0, 0x1F, 0x00, 0xF4, 0x07, 0x00, 0xA0, 0x0F, 0x00, 0xF4,
+    0x07, 0x00, 0xE1, 0x0B, 0x00, 0xF4, 0x07, 0x31, 0xEC, 0x02, 0x00, 0xF4, 0xFF, 0xFF, 0x29, 0x00,
+    0x00, 0xF4, 0x07, 0xF4, 0x0A, 0x00, 0x00, 0xF4, 0x07, 0x70, 0x7F, 0x00, 0x00, 0xF4, 0x07, 0x00,
+    0xFA, 0x04, 0x00, 0xF4, 0x07, 0x00, 0xC1, 0x2E, 0x00, 0xF4, 0x07, 0x00, 0x20, 0xCE, 0x01, 0x00,
+    0xB2, 0xEE, 0x8C, 0x02, 0x20, 0x8F, 0x12, 0xD5, 0x05, 0xB0, 0x0C, 0x00, 0x00, 0x00, 0xE0, 0x0C,
+    0x00, 0x00, 0x00, 0xC0, 0x9F, 0x01, 0x00, 0x00, 0x60, 0xFF, 0xAF, 0x04, 0x00, 0x00, 0xE6, 0xFF,
+    0xBF, 0x01, 0x00, 0x00, 0xA4, 0xFF, 0x09, 0x00, 0x00, 0x00, 0xF3, 0x0D, 0x00, 0x00, 0x00, 0xC0,
+    0x0C, 0x40, 0x00, 0x00, 0xE1, 0x08, 0xF4, 0x3A, 0x21, 0xDA, 0x01, 0x50, 0xEB, 0xEF, 0x19, 0x00,
+    0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0xF8, 0x03,
+    0x00, 0x00, 0xF0, 0x0B, 0xF8, 0x03, 0x00, 0x00, 0xF0, 0x0B, 0xF8, 0x03, 0x00, 0x00, 0xF0, 0x0B,
+    0xF8, 0x03, 0x00, 0x00, 0xF0, 0x0B, 0xF8, 0x03, 0x00, 0x00, 0xF0, 0x0B, 0xF8, 0x03, 0x00, 0x00,
+    0xF0, 0x0B, 0xF8, 0x03, 0x00, 0x00, 0xF0, 0x0B, 0xF8, 0x03, 0x00, 0x00, 0xF0, 0x0B, 0xF8, 0x03,
+    0x00, 0x00, 0xF1, 0x0A, 0xF5, 0x06, 0x00, 0x00, 0xF4, 0x07, 0xD0, 0x0C, 0x00, 0x00, 0xEA, 0x01,
+    0x30, 0xBE, 0x03, 0xA2, 0x5F, 0x00, 0x00, 0x92, 0xFD, 0xAE, 0x03, 0x00, 0xEB, 0x02, 0x00, 0x00,
+    0x00, 0xEC, 0x00, 0xF5, 0x07, 0x00, 0x00, 0x40, 0x8F, 0x00, 0xD0, 0x0D, 0x00, 0x00, 0xA0, 0x2F,
+    0x00, 0x80, 0x4F, 0x00, 0x00, 0xF1, 0x0B, 0x00, 0x20, 0xAF, 0x00, 0x00, 0xF7, 0x05, 0x00, 0x00,
+    0xFB, 0x01, 0x00, 0xED, 0x00, 0x00, 0x00, 0xF4, 0x07, 0x40, 0x8F, 0x00, 0x00, 0x00, 0xD0, 0x0D,
+    0xA0, 0x2F, 0x00, 0x00, 0x00, 0x70, 0x4F, 0xF1, 0x0B, 0x00, 0x00, 0x00, 0x20, 0xAF, 0xF6, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0xEA, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x8F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xD0, 0x2F, 0x00, 0x00, 0x00, 0xFB, 0x02, 0x00, 0x00, 0xE9, 0x02, 0x00, 0x00, 0xFB,
+    0x01, 0xF6, 0x07, 0x00, 0x10, 0xFE, 0x07, 0x00, 0x10, 0xBF, 0x00, 0xF2, 0x0C, 0x00, 0x50, 0xEF,
+    0x0C, 0x00, 0x50, 0x6F, 0x00, 0xC0, 0x1F, 0x00, 0xA0, 0x8D, 0x2F, 0x00, 0xA0, 0x2F, 0x00, 0x70,
+    0x6F, 0x00, 0xE1, 0x38, 0x7F, 0x00, 0xE0, 0x0C, 0x00, 0x30, 0xAF, 0x00, 0xF5, 0x03, 0xCD, 0x00,
+    0xF4, 0x08, 0x00, 0x00, 0xED, 0x00, 0xDA, 0x00, 0xF8, 0x02, 0xF8, 0x03, 0x00, 0x00, 0xF8, 0x14,
+    0x8E, 0x00, 0xF3, 0x07, 0xDC, 0x00, 0x00, 0x00, 0xF4, 0x58, 0x3F, 0x00, 0xD0, 0x2C, 0x9F, 0x00,
+    0x00, 0x00, 0xE0, 0xAC, 0x0D, 0x00, 0x80, 0x8F, 0x4F, 0x00, 0x00, 0x00, 0x90, 0xEF, 0x08, 0x00,
+    0x30, 0xEF, 0x0E, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x03, 0x00, 0x00, 0xFD, 0x0A, 0x00, 0x00, 0x00,
+    0x10, 0xDE, 0x00, 0x00, 0x00, 0xF8, 0x05, 0x00, 0x00, 0xF5, 0x0A, 0x00, 0x00, 0xD1, 0x1D, 0xA0,
+    0x5F, 0x00, 0x00, 0xF9, 0x04, 0x10, 0xDE, 0x01, 0x40, 0x9F, 0x00, 0x00, 0xF5, 0x09, 0xD1, 0x1D,
+    0x00, 0x00, 0xA0, 0x4F, 0xFA, 0x03, 0x00, 0x00, 0x10, 0xEE, 0x8F, 0x00, 0x00, 0x00, 0x00, 0xF9,
+    0x3F, 0x00, 0x00, 0x00, 0x30, 0xBF, 0xCE, 0x00, 0x00, 0x00, 0xD0, 0x1E, 0xF7, 0x07, 0x00, 0x00,
+    0xF8, 0x05, 0xC0, 0x2F, 0x00, 0x30, 0xAF, 0x00, 0x30, 0xCF, 0x00, 0xD0, 0x1E, 0x00, 0x00, 0xF8,
+    0x07, 0xF8, 0x05, 0x00, 0x00, 0xD1, 0x2E, 0xF9, 0x04, 0x00, 0x00, 0xD1, 0x1E, 0xE1, 0x0C, 0x00,
+    0x00, 0xF7, 0x05, 0x60, 0x6F, 0x00, 0x20, 0xBE, 0x00, 0x00, 0xEC, 0x01, 0xA0, 0x3F, 0x00, 0x00,
+    0xF3, 0x09, 0xF4, 0x08, 0x00, 0x00, 0x90, 0x3F, 0xDC, 0x01, 0x00, 0x00, 0x10, 0xDE, 0x5F, 0x00,
+    0x00, 0x00, 0x00, 0xF6, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x08, 0x00, 0x00, 0x00, 0x00, 0xF3,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x08, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0xF3, 0x08, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x20, 0xFE,
+    0x03, 0x00, 0x00, 0x00, 0xB0, 0x8F, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x0C, 0x00, 0x00, 0x00, 0x20,
+    0xFF, 0x03, 0x00, 0x00, 0x00, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x0C, 0x00, 0x00, 0x00,
+    0x30, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0B, 0x00, 0x00,
+    0x00, 0x30, 0xEF, 0x02, 0x00, 0x00, 0x00, 0xD0, 0x6F, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x06, 0xFB, 0x8F, 0x9B, 0x00, 0x9B, 0x00, 0x9B, 0x00, 0x9B, 0x00, 0x9B, 0x00, 0x9B,
+    0x00, 0x9B, 0x00, 0x9B, 0x00, 0x9B, 0x00, 0x9B, 0x00, 0x9B, 0x00, 0x9B, 0x00, 0x9B, 0x00, 0x9B,
+    0x00, 0xFB, 0x8F, 0xE1, 0x04, 0x00, 0x00, 0x80, 0x0B, 0x00, 0x00, 0x20, 0x2F, 0x00, 0x00, 0x00,
+    0x9B, 0x00, 0x00, 0x00, 0xE5, 0x01, 0x00, 0x00, 0xD0, 0x06, 0x00, 0x00, 0x70, 0x0C, 0x00, 0x00,
+    0x10, 0x4F, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0xF3, 0x02, 0x00, 0x00, 0xC0, 0x08, 0x00,
+    0x00, 0x60, 0x0E, 0x00, 0x00, 0x10, 0x5E, 0x00, 0x00, 0x00, 0x54, 0xF2, 0xFF, 0x02, 0x00, 0xF4,
+    0x02, 0x00, 0xF4, 0x02, 0x00, 0xF4, 0x02, 0x00, 0xF4, 0x02, 0x00, 0xF4, 0x02, 0x00, 0xF4, 0x02,
+    0x00, 0xF4, 0x02, 0x00, 0xF4, 0x02, 0x00, 0xF4, 0x02, 0x00, 0xF4, 0x02, 0x00, 0xF4, 0x02, 0x00,
+    0xF4, 0x02, 0x00, 0xF4, 0x02, 0x00, 0xF4, 0x02, 0xF2, 0xFF, 0x02, 0x00, 0xA0, 0x1E, 0x00, 0x00,
+    0xF4, 0x8D, 0x00, 0x00, 0xAC, 0xF5, 0x02, 0x60, 0x2F, 0xB0, 0x0B, 0xE1, 0x08, 0x20, 0x5F, 0x73,
+    0x01, 0x00, 0x65, 0xFF, 0xFF, 0xFF, 0x1F, 0xE3, 0x09, 0x40, 0x4F, 0x00, 0x64, 0x10, 0xD8, 0xDF,
+    0x08, 0x00, 0x70, 0x4C, 0x41, 0x8E, 0x00, 0x00, 0x00, 0x00, 0xDA, 0x00, 0x00, 0x00, 0x00, 0xF9,
+    0x00, 0x00, 0xA5, 0xED, 0xFF, 0x00, 0xA0, 0x6E, 0x12, 0xF8, 0x00, 0xF2, 0x07, 0x00, 0xF9, 0x00,
+    0xE0, 0x1A, 0x71, 0xFE, 0x00, 0x50, 0xFD, 0x7D, 0xF4, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xF9,
+    0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xB2,
+    0xEE, 0x19, 0x00, 0xF9, 0x3B, 0x51, 0xAE, 0x00, 0xF9, 0x01, 0x00, 0xF9, 0x02, 0xF9, 0x00, 0x00,
+    0xF5, 0x05, 0xF9, 0x00, 0x00, 0xF4, 0x06, 0xF9, 0x00, 0x00, 0xF5, 0x05, 0xF9, 0x00, 0x00, 0xEA,
+    0x01, 0xF9, 0x29, 0x71, 0x6F, 0x00, 0xC9, 0xD6, 0xDF, 0x05, 0x00, 0x00, 0xC4, 0xEE, 0x4B, 0x00,
+    0x60, 0x8F, 0x12, 0x76, 0x00, 0xE0, 0x0B, 0x00, 0x00, 0x00, 0xF3, 0x06, 0x00, 0x00, 0x00, 0xF5,
+    0x05, 0x00, 0x00, 0x00, 0xF4, 0x07, 0x00, 0x00, 0x00, 0xE1, 0x0B, 0x00, 0x00, 0x00, 0x60, 0x8F,
+    0x11, 0xB7, 0x00, 0x00, 0xC4, 0xEF, 0x4B, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0A, 0x00, 0x00, 0x00,
+    0xE0, 0x0A, 0x00, 0x00, 0x00, 0xE0, 0x0A, 0x00, 0x00, 0x00, 0xE0, 0x0A, 0x00, 0xC6, 0xDF, 0xE7,
+    0x0A, 0x60, 0x8F, 0x21, 0xF8, 0x0A, 0xE1, 0x0B, 0x00, 0xE0, 0x0A, 0xF4, 0x06, 0x00, 0xE0, 0x0A,
+    0xF5, 0x05, 0x00, 0xE0, 0x0A, 0xF4, 0x06, 0x00, 0xE0, 0x0A, 0xF1, 0x09, 0x00, 0xE1, 0x0A, 0xA0,
+    0x5F, 0x21, 0xEB, 0x0A, 0x10, 0xE9, 0xBE, 0xB3, 0x0A, 0x00, 0xB3, 0xEE, 0x3A, 0x00, 0x50, 0x5E,
+    0x11, 0xE8, 0x02, 0xE1, 0x07, 0x00, 0xD0, 0x08, 0xF4, 0xFF, 0xFF, 0xFF, 0x0A, 0xF5, 0x04, 0x00,
+    0x00, 0x00, 0xF3, 0x07, 0x00, 0x00, 0x00, 0xE0, 0x0C, 0x00, 0x00, 0x00, 0x50, 0xAF, 0x12, 0xD5,
+    0x05, 0x00, 0xB4, 0xFE, 0x8C, 0x01, 0x00, 0xB2, 0xCE, 0x00, 0xBD, 0x02, 0x30, 0x5F, 0x00, 0x50,
+    0x4F, 0x00, 0xFB, 0xFF, 0xDF, 0x60, 0x4F, 0x00, 0x50, 0x4F, 0x00, 0x50, 0x4F, 0x00, 0x50, 0x4F,
+    0x00, 0x50, 0x4F, 0x00, 0x50, 0x4F, 0x00, 0x50, 0x4F, 0x00, 0x50, 0x4F, 0x00, 0x10, 0xD9, 0xFF,
+    0xFF, 0x0D, 0xC0, 0x2C, 0x40, 0xBE, 0x03, 0xF0, 0x07, 0x00, 0xBA, 0x00, 0xC0, 0x2C, 0x40, 0x7E,
+    0x00, 0x10, 0xEE, 0xDF, 0x07, 0x00, 0x80, 0x0B, 0x00, 0x00, 0x00, 0xB0, 0x2D, 0x00, 0x00, 0x00,
+    0x50, 0xEF, 0xFF, 0xAE, 0x01, 0xE3, 0x04, 0x10, 0xE4, 0x09, 0xE7, 0x00, 0x00, 0xD0, 0x09, 0xF4,
+    0x28, 0x20, 0xE9, 0x03, 0x40, 0xEB, 0xDF, 0x29, 0x00, 0xEA, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00,
+    0x00, 0xEA, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0xEA, 0xB3, 0xDE, 0x08, 0xFA, 0x3B, 0x61,
+    0x6F, 0xEA, 0x01, 0x00, 0xCC, 0xEA, 0x00, 0x00, 0xDB, 0xEA, 0x00, 0x00, 0xEB, 0xEA, 0x00, 0x00,
+    0xEB, 0xEA, 0x00, 0x00, 0xEB, 0xEA, 0x00, 0x00, 0xEB, 0xEA, 0x00, 0x00, 0xEB, 0xE9, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0xF8, 0x01, 0xF8, 0x01, 0xF8, 0x01, 0xF8, 0x01, 0xF8,
+    0x01, 0xF8, 0x01, 0xF8, 0x01, 0xF8, 0x01, 0x00, 0xE9, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0xF8, 0x01, 0x00, 0xF8, 0x01, 0x00, 0xF8, 0x01, 0x00,
+    0xF8, 0x01, 0x00, 0xF8, 0x01, 0x00, 0xF8, 0x01, 0x00, 0xF8, 0x01, 0x00, 0xF8, 0x01, 0x00, 0xF8,
+    0x01, 0x10, 0xDB, 0x00, 0xF6, 0x4C, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x40, 0x7F, 0x00,
+    0xF9, 0x00, 0xE3, 0x09, 0x00, 0xF9, 0x20, 0xBD, 0x00, 0x00, 0xF9, 0xC1, 0x1C, 0x00, 0x00, 0xF9,
+    0xFF, 0x05, 0x00, 0x00, 0xF9, 0xA1, 0x3E, 0x00, 0x00, 0xF9, 0x10, 0xDC, 0x01, 0x00, 0xF9, 0x00,
+    0xD1, 0x1C, 0x00, 0xF9, 0x00, 0x20, 0xAE, 0x00, 0xF8, 0x01, 0xF8, 0x01, 0xF8, 0x01, 0xF8, 0x01,
+    0xF8, 0x01, 0xF8, 0x01, 0xF8, 0x01, 0xF8, 0x01, 0xF8, 0x01, 0xF8, 0x01, 0xF8, 0x01, 0xF8, 0x01,
+    0xF8, 0x01, 0xAA, 0xD4, 0xBE, 0x41, 0xEC, 0x5D, 0x00, 0xEA, 0x1A, 0xC2, 0xDB, 0x13, 0xF8, 0x03,
+    0xEA, 0x00, 0x60, 0x6F, 0x00, 0xF1, 0x08, 0xEA, 0x00, 0x50, 0x4F, 0x00, 0xE0, 0x0A, 0xEA, 0x00,
+    0x50, 0x4F, 0x00, 0xE0, 0x0A, 0xEA, 0x00, 0x50, 0x4F, 0x00, 0xE0, 0x0A, 0xEA, 0x00, 0x50, 0x4F,
+    0x00, 0xE0, 0x0A, 0xEA, 0x00, 0x50, 0x4F, 0x00, 0xE0, 0x0A, 0xEA, 0x00, 0x50, 0x4F, 0x00, 0xE0,
+    0x0A, 0xAA, 0xB3, 0xDE, 0x08, 0xEA, 0x3B, 0x61, 0x6F, 0xEA, 0x01, 0x00, 0xCC, 0xEA, 0x00, 0x00,
+    0xDB, 0xEA, 0x00, 0x00, 0xEB, 0xEA, 0x00, 0x00, 0xEB, 0xEA, 0x00, 0x00, 0xEB, 0xEA, 0x00, 0x00,
+    0xEB, 0xEA, 0x00, 0x00, 0xEB, 0x00, 0xB4, 0xEE, 0x4B, 0x00, 0x60, 0x8F, 0x11, 0xF8, 0x05, 0xE0,
+    0x0B, 0x00, 0xB0, 0x0E, 0xF4, 0x06, 0x00, 0x60, 0x4F, 0xF5, 0x05, 0x00, 0x50, 0x5F, 0xF4, 0x06,
+    0x00, 0x60, 0x4F, 0xE1, 0x0B, 0x00, 0xB0, 0x0E, 0x50, 0x7F, 0x11, 0xF8, 0x06, 0x00, 0xC5, 0xEE,
+    0x5C, 0x00, 0xAA, 0xB2, 0xEE, 0x19, 0x00, 0xEA, 0x3B, 0x61, 0x9F, 0x00, 0xEA, 0x01, 0x00, 0xF9,
+    0x01, 0xEA, 0x00, 0x00, 0xF6, 0x04, 0xEA, 0x00, 0x00, 0xF5, 0x05, 0xEA, 0x00, 0x00, 0xF7, 0x04,
+    0xEA, 0x00, 0x00, 0xEB, 0x00, 0xFA, 0x28, 0x81, 0x6F, 0x00, 0xEA, 0xD7, 0xDF, 0x05, 0x00, 0xEA,
+    0x00, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC6,
+    0xDF, 0xB7, 0x0A, 0x60, 0x8F, 0x11, 0xF8, 0x0A, 0xE1, 0x0B, 0x00, 0xE0, 0x0A, 0xF4, 0x06, 0x00,
+    0xE0, 0x0A, 0xF5, 0x05, 0x00, 0xE0, 0x0A, 0xF4, 0x06, 0x00, 0xE0, 0x0A, 0xF1, 0x09, 0x00, 0xE1,
+    0x0A, 0xA0, 0x5F, 0x21, 0xFB, 0x0A, 0x10, 0xE9, 0xBE, 0xE3, 0x0A, 0x00, 0x00, 0x00, 0xE0, 0x0A,
+    0x00, 0x00, 0x00, 0xE0, 0x0A, 0x00, 0x00, 0x00, 0xE0, 0x0A, 0xBA, 0xC4, 0xAF, 0xEA, 0x3C, 0x00,
+    0xFA, 0x02, 0x00, 0xEA, 0x00, 0x00, 0xEA, 0x00, 0x00, 0xEA, 0x00, 0x00, 0xEA, 0x00, 0x00, 0xEA,
+    0x00, 0x00, 0xEA, 0x00, 0x00, 0x20, 0xEA, 0xBE, 0x05, 0xD0, 0x2B, 0x51, 0x06, 0xF2, 0x07, 0x00,
+    0x00, 0xE0, 0x9F, 0x03, 0x00, 0x30, 0xFB, 0xDF, 0x03, 0x00, 0x10, 0xE6, 0x0D, 0x00, 0x00, 0x80,
+    0x0E, 0xA2, 0x14, 0xD2, 0x09, 0x81, 0xFD, 0x8D, 0x01, 0x00, 0x7B, 0x00, 0x00, 0x00, 0x7E, 0x00,
+    0x00, 0x10, 0x7F, 0x00, 0x00, 0xE8, 0xFF, 0xFF, 0x01, 0x20, 0x7F, 0x00, 0x00, 0x20, 0x7F, 0x00,
+    0x00, 0x20, 0x7F, 0x00, 0x00, 0x20, 0x7F, 0x00, 0x00, 0x20, 0x7F, 0x00, 0x00, 0x20, 0x7F, 0x00,
+    0x00, 0x10, 0xAF, 0x51, 0x00, 0x00, 0xE6, 0xBE, 0x01, 0xBE, 0x00, 0x00, 0xAE, 0xBE, 0x00, 0x00,
+    0xAE, 0xBE, 0x00, 0x00, 0xAE, 0xBE, 0x00, 0x00, 0xAE, 0xBE, 0x00, 0x00, 0xAE, 0xBE, 0x00, 0x00,
+    0xAE, 0xCC, 0x00, 0x00, 0xAE, 0xF7, 0x15, 0xB3, 0xAF, 0x80, 0xFD, 0x4C, 0xAB, 0xEA, 0x01, 0x00,
+    0xB0, 0x0D, 0xF3, 0x07, 0x00, 0xF2, 0x06, 0xC0, 0x0D, 0x00, 0xE8, 0x01, 0x60, 0x4F, 0x00, 0x9E,
+    0x00, 0x10, 0xAE, 0x60, 0x3F, 0x00, 0x00, 0xF9, 0xC1, 0x0C, 0x00, 0x00, 0xF2, 0xF8, 0x05, 0x00,
+    0x00, 0xB0, 0xEF, 0x00, 0x00, 0x00, 0x50, 0x8F, 0x00, 0x00, 0xDB, 0x00, 0x00, 0xBD, 0x00, 0x10,
+    0x8E, 0xF6, 0x03, 0x40, 0xFF, 0x02, 0x50, 0x3F, 0xF1, 0x08, 0x90, 0xEB, 0x07, 0xA0, 0x0D, 0xB0,
+    0x0D, 0xE0, 0x96, 0x0C, 0xE0, 0x08, 0x60, 0x2F, 0xF4, 0x41, 0x2F, 0xF4, 0x03, 0x10, 0x7F, 0xB9,
+    0x00, 0x6E, 0xD9, 0x00, 0x00, 0xBB, 0x6D, 0x00, 0xB9, 0x8D, 0x00, 0x00, 0xF6, 0x1F, 0x00, 0xF4,
+    0x3F, 0x00, 0x00, 0xF1, 0x0B, 0x00, 0xE0, 0x0D, 0x00, 0xF4, 0x08, 0x00, 0xF5, 0x05, 0x90, 0x3F,
+    0x20, 0x9E, 0x00, 0x00, 0xCD, 0xB0, 0x1D, 0x00, 0x00, 0xF3, 0xFC, 0x03, 0x00, 0x00, 0xB0, 0xCF,
+    0x00, 0x00, 0x00, 0xF5, 0xF9, 0x06, 0x00, 0x10, 0xAE, 0xA0, 0x2E, 0x00, 0xB0, 0x1D, 0x10, 0xCE,
+    0x00, 0xF6, 0x04, 0x00, 0xF5, 0x07, 0xEA, 0x01, 0x00, 0xB0, 0x0D, 0xF3, 0x08, 0x00, 0xF2, 0x06,
+    0xB0, 0x0E, 0x00, 0xE9, 0x01, 0x50, 0x6F, 0x10, 0x8E, 0x00, 0x00, 0xCD, 0x60, 0x2F, 0x00, 0x00,
+    0xF6, 0xC3, 0x0A, 0x00, 0x00, 0xE1, 0xFC, 0x03, 0x00, 0x00, 0x80, 0xCF, 0x00, 0x00, 0x00, 0x30,
+    0x5F, 0x00, 0x00, 0x00, 0x90, 0x0D, 0x00, 0x00, 0x00, 0xF2, 0x07, 0x00, 0x00, 0x00, 0xE8, 0x01,
+    0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x80, 0x5F, 0x00, 0x00, 0xF4, 0x09, 0x00, 0x20,
+    0xCE, 0x00, 0x00, 0xB0, 0x2E, 0x00, 0x00, 0xF8, 0x05, 0x00, 0x40, 0x9F, 0x00, 0x00, 0xD1, 0x1D,
+    0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x8F, 0x00, 0xD8, 0x09, 0x70, 0x2E, 0x00, 0xB0, 0x09, 0x00, 0xC0,
+    0x09, 0x00, 0xA0, 0x0B, 0x00, 0x70, 0x0D, 0x00, 0x60, 0x0E, 0x00, 0xA0, 0x0B, 0x00, 0xE9, 0x03,
+    0x00, 0xA0, 0x0C, 0x00, 0x60, 0x0E, 0x00, 0x80, 0x0C, 0x00, 0xB0, 0x0A, 0x00, 0xC0, 0x09, 0x00,
+    0x90, 0x2D, 0x00, 0x10, 0xE9, 0x09, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+    0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0xE3, 0x2B, 0x00, 0x10, 0xDA, 0x00, 0x00, 0xF3, 0x02, 0x00,
+    0xF3, 0x03, 0x00, 0xF5, 0x01, 0x00, 0xD8, 0x00, 0x00, 0xC9, 0x00, 0x00, 0xE5, 0x02, 0x00, 0xB0,
+    0x0F, 0x00, 0xE6, 0x02, 0x00, 0xC8, 0x00, 0x00, 0xE7, 0x00, 0x00, 0xF4, 0x02, 0x00, 0xF3, 0x03,
+    0x10, 0xE9, 0x01, 0xE3, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x70, 0x02, 0xC2, 0xCE, 0x16, 0xF4, 0x02,
+    0xAB, 0x41, 0xEA, 0x7E, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00,
+};
+
+/* codepoint, offset, advance, width, height, left, top, packed size */
+FONT_DATA static const gfx_glyph_t font_lato18_glyphs[95] = {
+    { 0x0020,      0,   48,   0,   0,    0,    0,    0 },
+    { 0x0021,      0,   96,   3,  13,    2,    5,    0 },
+    { 0x0022,     26,  112,   5,   4,    1,    5,    0 },
+    { 0x0023,     38,  160,  10,  13,    0,    5,    0 },
+    { 0x0024,    103,  160,   9,  16,    1,    4,    0 },
+    { 0x0025,    183,  224,  14,  13,    0,    5,    0 },
+    { 0x0026,    274,  208,  13,  13,    0,    5,    0 },
+    { 0x0027,    365,   64,   2,   4,    1,    5,    0 },
+    { 0x0028,    369,   80,   4,  17,    1,    4,    0 },
+    { 0x0029,    403,   80,   5,  17,    0,    4,    0 },
+    { 0x002A,    454,  112,   7,   6,    0,    5,    0 },
+    { 0x002B,    478,  160,  10,   9,    0,    7,    0 },
+    { 0x002C,    523,   64,   3,   4,    0,   17,    0 },
+    { 0x002D,    531,   96,   6,   1,    0,   12,    0 },
+    { 0x002E,    534,   64,   3,   1,    0,   17,    0 },
+    { 0x002F,    536,  112,   8,  14,   -1,    5,    0 },
+    { 0x0030,    592,  160,  10,  13,    0,    5,    0 },
+    { 0x0031,    657,  160,   9,  13,    1,    5,    0 },
+    { 0x0032,    722,  160,  10,  13,    0,    5,    0 },
+    { 0x0033,    787,  160,   9,  13,    1,    5,    0 },
+    { 0x0034,    852,  160,  11,  13,    0,    5,    0 },
+    { 0x0035,    930,  160,   9,  13,    1,    5,    0 },
+    { 0x0036,    995,  160,  10,  13,    0,    5,    0 },
+    { 0x0037,   1060,  160,  10,  13,    0,    5,    0 },
+    { 0x0038,   1125,  160,  10,  13,    0,    5,    0 },
+    { 0x0039,   1190,  160,   9,  13,    1,    5,    0 },
+    { 0x003A,   1255,   80,   3,   9,    1,    9,    0 },
+    { 0x003B,   1273,   80,   3,  12,    1,    9,    0 },
+    { 0x003C,   1297,  160,   8,   8,    1,    8,    0 },
+    { 0x003D,   1329,  160,   9,   4,    1,   10,    0 },
+    { 0x003E,   1349,  160,   8,   8,    2,    8,    0 },
+    { 0x003F,   1381,  112,   7,  13,    0,    5,    0 },
+    { 0x0040,   1433,  240,  15,  14,    0,    6,    0 },
+    { 0x0041,   1545,  192,  13,  13,    0,    5,    0 },
+    { 0x0042,   1636,  192,  10,  13,    1,    5,    0 },
+    { 0x0043,   1701,  192,  12,  13,    0,    5,    0 },
+    { 0x0044,   1779,  224,  12,  13,    1,    5,    0 },
+    { 0x0045,   1857,  160,   9,  13,    1,    5,    0 },
+    { 0x0046,   1922,  160,   9,  13,    1,    5,    0 },
+    { 0x0047,   1987,  208,  13,  13,    0,    5,    0 },
+    { 0x0048,   2078,  224,  12,  13,    1,    5,    0 },
+    { 0x0049,   2156,   96,   3,  13,    1,    5,    0 },
+    { 0x004A,   2182,  128,   7,  13,    0,    5,    0 },
+    { 0x004B,   2234,  192,  11,  13,    1,    5,    0 },
+    { 0x004C,   2312,  144,   8,  13,    1,    5,    0 },
+    { 0x004D,   2364,  272,  14,  13,    1,    5,    0 },
+    { 0x004E,   2455,  224,  12,  13,    1,    5,    0 },
+    { 0x004F,   2533,  224,  14,  13,    0,    5,    0 },
+    { 0x0050,   2624,  176,  10,  13,    1,    5,    0 },
+    { 0x0051,   2689,  224,  15,  16,    0,    5,    0 },
+    { 0x0052,   2817,  192,  11,  13,    1,    5,    0 },
+    { 0x0053,   2895,  160,   9,  13,    0,    5,    0 },
+    { 0x0054,   2960,  176,  11,  13,    0,    5,    0 },
+    { 0x0055,   3038,  208,  11,  13,    1,    5,    0 },
+    { 0x0056,   3116,  192,  13,  13,    0,    5,    0 },
+    { 0x0057,   3207,  288,  19,  13,    0,    5,    0 },
+    { 0x0058,   3337,  192,  12,  13,    0,    5,    0 },
+    { 0x0059,   3415,  176,  12,  13,    0,    5,    0 },
+    { 0x005A,   3493,  176,  11,  13,    0,    5,    0 },
+    { 0x005B,   3571,   80,   4,  16,    1,    5,    0 },
+    { 0x005C,   3603,  112,   8,  14,   -1,    5,    0 },
+    { 0x005D,   3659,   80,   5,  16,    0,    5,    0 },
+    { 0x005E,   3707,  160,   8,   6,    1,    5,    0 },
+    { 0x005F,   3731,  112,   8,   1,    0,   19,    0 },
+    { 0x0060,   3735,   96,   4,   3,    0,    5,    0 },
+    { 0x0061,   3741,  144,   9,   9,    0,    9,    0 },
+    { 0x0062,   3786,  160,   9,  13,    1,    5,    0 },
+    { 0x0063,   3851,  128,   9,   9,    0,    9,    0 },
+    { 0x0064,   3896,  160,   9,  13,    0,    5,    0 },
+    { 0x0065,   3961,  144,   9,   9,    0,    9,    0 },
+    { 0x0066,   4006,   96,   6,  13,    0,    5,    0 },
+    { 0x0067,   4045,  144,   9,  12,    0,    9,    0 },
+    { 0x0068,   4105,  160,   8,  13,    1,    5,    0 },
+    { 0x0069,   4157,   80,   3,  13,    1,    5,    0 },
+    { 0x006A,   4183,   80,   5,  16,   -1,    5,    0 },
+    { 0x006B,   4231,  144,   9,  13,    1,    5,    0 },
+    { 0x006C,   4296,   80,   3,  13,    1,    5,    0 },
+    { 0x006D,   4322,  240,  13,   9,    1,    9,    0 },
+    { 0x006E,   4385,  160,   8,   9,    1,    9,    0 },
+    { 0x006F,   4421,  160,  10,   9,    0,    9,    0 },
+    { 0x0070,   4466,  160,   9,  12,    1,    9,    0 },
+    { 0x0071,   4526,  160,   9,  12,    0,    9,    0 },
+    { 0x0072,   4586,  112,   6,   9,    1,    9,    0 },
+    { 0x0073,   4613,  128,   8,   9,    0,    9,    0 },
+    { 0x0074,   4649,  112,   7,  12,    0,    6,    0 },
+    { 0x0075,   4697,  160,   8,   9,    1,    9,    0 },
+    { 0x0076,   4733,  144,   9,   9,    0,    9,    0 },
+    { 0x0077,   4778,  224,  14,   9,    0,    9,    0 },
+    { 0x0078,   4841,  144,   9,   9,    0,    9,    0 },
+    { 0x0079,   4886,  144,  10,  12,    0,    9,    0 },
+    { 0x007A,   4946,  128,   8,   9,    0,    9,    0 },
+    { 0x007B,   4982,   80,   5,  16,    0,    5,    0 },
+    { 0x007C,   5030,   80,   2,  16,    2,    5,    0 },
+    { 0x007D,   5046,   80,   5,  16,    0,    5,    0 },
+    { 0x007E,   5094,  160,   9,   4,    1,   11,    0 },
+};
+
+FONT_DATA static const gfx_kern_t font_lato18_kerns[641] = {
+    { 0x00220026,  -26, 0 },
+    { 0x0022002C,  -33, 0 },
+    { 0x0022002D,  -26, 0 },
+    { 0x0022002E,  -33, 0 },
+    { 0x0022002F,  -26, 0 },
+    { 0x00220040,   -7, 0 },
+    { 0x00220041,  -26, 0 },
+    { 0x00220043,   -7, 0 },
+    { 0x00220047,   -7, 0 },
+    { 0x0022004F,   -7, 0 },
+    { 0x00220051,   -7, 0 },
+    { 0x00220056,    7, 0 },
+    { 0x00220057,    7, 0 },
+    { 0x00220059,    4, 0 },
+    { 0x0022005C,    7, 0 },
+    { 0x00220061,   -9, 0 },
+    { 0x00220063,  -13, 0 },
+    { 0x00220064,  -13, 0 },
+    { 0x00220065,  -13, 0 },
+    { 0x0022006F,  -13, 0 },
+    { 0x00220071,  -13, 0 },
+    { 0x00270026,  -26, 0 },
+    { 0x0027002C,  -33, 0 },
+    { 0x0027002D,  -26, 0 },
+    { 0x0027002E,  -33, 0 },
+    { 0x0027002F,  -26, 0 },
+    { 0x00270040,   -7, 0 },
+    { 0x00270041,  -26, 0 },
+    { 0x00270043,   -7, 0 },
+    { 0x00270047,   -7, 0 },
+    { 0x0027004F,   -7, 0 },
+    { 0x00270051,   -7, 0 },
+    { 0x00270056,    7, 0 },
+    { 0x00270057,    7, 0 },
+    { 0x00270059,    4, 0 },
+    { 0x0027005C,    7, 0 },
+    { 0x00270061,   -9, 0 },
+    { 0x00270063,  -13, 0 },
+    { 0x00270064,  -13, 0 },
+    { 0x00270065,  -13, 0 },
+    { 0x0027006F,  -13, 0 },
+    { 0x00270071,  -13, 0 },
+    { 0x00280040,   -6, 0 },
+    { 0x00280043,   -6, 0 },
+    { 0x00280047,   -6, 0 },
+    { 0x0028004F,   -6, 0 },
+    { 0x00280051,   -6, 0 },
+    { 0x00280063,   -5, 0 },
+    { 0x00280064,   -5, 0 },
+    { 0x00280065,   -5, 0 },
+    { 0x0028006F,   -5, 0 },
+    { 0x00280071,   -5, 0 },
+    { 0x002A0026,  -26, 0 },
+    { 0x002A002C,  -33, 0 },
+    { 0x002A002D,  -26, 0 },
+    { 0x002A002E,  -33, 0 },
+    { 0x002A002F,  -26, 0 },
+    { 0x002A0040,   -7, 0 },
+    { 0x002A0041,  -26, 0 },
+    { 0x002A0043,   -7, 0 },
+    { 0x002A0047,   -7, 0 },
+    { 0x002A004F,   -7, 0 },
+    { 0x002A0051,   -7, 0 },
+    { 0x002A0056,    7, 0 },
+    { 0x002A0057,    7, 0 },
+    { 0x002A0059,    4, 0 },
+    { 0x002A005C,    7, 0 },
+    { 0x002A0061,   -9, 0 },
+    { 0x002A0063,  -13, 0 },
+    { 0x002A0064,  -13, 0 },
+    { 0x002A0065,  -13, 0 },
+    { 0x002A006F,  -13, 0 },
+    { 0x002A0071,  -13, 0 },
+    { 0x002C0022,  -33, 0 },
+    { 0x002C0027,  -33, 0 },
+    { 0x002C002A,  -33, 0 },
+    { 0x002C002D,  -20, 0 },
+    { 0x002C0040,   -8, 0 },
+    { 0x002C0043,   -8, 0 },
+    { 0x002C0047,   -8, 0 },
+    { 0x002C004F,   -8, 0 },
+    { 0x002C0051,   -8, 0 },
+    { 0x002C0054,  -26, 0 },
+    { 0x002C0056,  -26, 0 },
+    { 0x002C0057,  -18, 0 },
+    { 0x002C0059,  -22, 0 },
+    { 0x002C005C,  -26, 0 },
+    { 0x002C0076,  -19, 0 },
+    { 0x002C0077,   -9, 0 },
+    { 0x002C0079,  -19, 0 },
+    { 0x002D0022,  -26, 0 },
+    { 0x002D0026,   -7, 0 },
+    { 0x002D0027,  -26, 0 },
+    { 0x002D002A,  -26, 0 },
+    { 0x002D002C,  -20, 0 },
+    { 0x002D002E,  -20, 0 },
+    { 0x002D002F,   -7, 0 },
+    { 0x002D0041,   -7, 0 },
+    { 0x002D0054,  -26, 0 },
+    { 0x002D0056,  -16, 0 },
+    { 0x002D0057,   -5, 0 },
+    { 0x002D0058,   -9, 0 },
+    { 0x002D0059,  -23, 0 },
+    { 0x002D005A,   -7, 0 },
+    { 0x002D005C,  -16, 0 },
+    { 0x002E0022,  -33, 0 },
+    { 0x002E0027,  -33, 0 },
+    { 0x002E002A,  -33, 0 },
+    { 0x002E002D,  -20, 0 },
+    { 0x002E0040,   -8, 0 },
+    { 0x002E0043,   -8, 0 },
+    { 0x002E0047,   -8, 0 },
+    { 0x002E004F,   -8, 0 },
+    { 0x002E0051,   -8, 0 },
+    { 0x002E0054,  -26, 0 },
+    { 0x002E0056,  -26, 0 },
+    { 0x002E0057,  -18, 0 },
+    { 0x002E0059,  -22, 0 },
+    { 0x002E005C,  -26, 0 },
+    { 0x002E0076,  -19, 0 },
+    { 0x002E0077,   -9, 0 },
+    { 0x002E0079,  -19, 0 },
+    { 0x002F0022,    7, 0 },
+    { 0x002F0026,  -20, 0 },
+    { 0x002F0027,    7, 0 },
+    { 0x002F002A,    7, 0 },
+    { 0x002F002C,  -28, 0 },
+    { 0x002F002D,  -16, 0 },
+    { 0x002F002E,  -28, 0 },
+    { 0x002F002F,  -20, 0 },
+    { 0x002F003A,  -13, 0 },
+    { 0x002F003B,  -13, 0 },
+    { 0x002F003F,    7, 0 },
+    { 0x002F0040,   -7, 0 },
+    { 0x002F0041,  -20, 0 },
+    { 0x002F0043,   -7, 0 },
+    { 0x002F0047,   -7, 0 },
+    { 0x002F004A,  -22, 0 },
+    { 0x002F004F,   -7, 0 },
+    { 0x002F0051,   -7, 0 },
+    { 0x002F0061,  -17, 0 },
+    { 0x002F0063,  -17, 0 },
+    { 0x002F0064,  -17, 0 },
+    { 0x002F0065,  -17, 0 },
+    { 0x002F0066,   -4, 0 },
+    { 0x002F0067,  -20, 0 },
+    { 0x002F006D,  -13, 0 },
+    { 0x002F006E,  -13, 0 },
+    { 0x002F006F,  -17, 0 },
+    { 0x002F0070,  -13, 0 },
+    { 0x002F0071,  -17, 0 },
+    { 0x002F0072,  -13, 0 },
+    { 0x002F0073,  -15, 0 },
+    { 0x002F0074,   -6, 0 },
+    { 0x002F0075,  -13, 0 },
+    { 0x002F0076,   -7, 0 },
+    { 0x002F0078,   -7, 0 },
+    { 0x002F0079,   -7, 0 },
+    { 0x002F007A,  -12, 0 },
+    { 0x00400022,   -7, 0 },
+    { 0x00400026,   -6, 0 },
+    { 0x00400027,   -7, 0 },
+    { 0x00400029,   -6, 0 },
+    { 0x0040002A,   -7, 0 },
+    { 0x0040002C,   -8, 0 },
+    { 0x0040002E,   -8, 0 },
+    { 0x0040002F,   -6, 0 },
+    { 0x00400041,   -6, 0 },
+    { 0x00400054,  -14, 0 },
+    { 0x00400056,   -7, 0 },
+    { 0x00400058,   -4, 0 },
+    { 0x00400059,  -12, 0 },
+    { 0x0040005A,  -10, 0 },
+    { 0x0040005C,   -7, 0 },
+    { 0x0040005D,   -6, 0 },
+    { 0x0040007D,   -6, 0 },
+    { 0x00410022,  -26, 0 },
+    { 0x00410027,  -26, 0 },
+    { 0x0041002A,  -26, 0 },
+    { 0x0041002D,   -7, 0 },
+    { 0x0041003F,   -8, 0 },
+    { 0x00410040,   -6, 0 },
+    { 0x00410043,   -6, 0 },
+    { 0x00410047,   -6, 0 },
+    { 0x0041004A,    7, 0 },
+    { 0x0041004F,   -6, 0 },
+    { 0x00410051,   -6, 0 },
+    { 0x00410054,  -19, 0 },
+    { 0x00410055,   -8, 0 },
+    { 0x00410056,  -20, 0 },
+    { 0x00410057,  -12, 0 },
+    { 0x00410059,  -24, 0 },
+    { 0x0041005C,  -20, 0 },
+    { 0x00410076,  -12, 0 },
+    { 0x00410079,  -12, 0 },
+    { 0x0043002D,  -22, 0 },
+    { 0x00440022,   -7, 0 },
+    { 0x00440026,   -6, 0 },
+    { 0x00440027,   -7, 0 },
+    { 0x00440029,   -6, 0 },
+    { 0x0044002A,   -7, 0 },
+    { 0x0044002C,   -8, 0 },
+    { 0x0044002E,   -8, 0 },
+    { 0x0044002F,   -6, 0 },
+    { 0x00440041,   -6, 0 },
+    { 0x00440054,  -14, 0 },
+    { 0x00440056,   -7, 0 },
+    { 0x00440058,   -4, 0 },
+    { 0x00440059,  -12, 0 },
+    { 0x0044005A,  -10, 0 },
+    { 0x0044005C,   -7, 0 },
+    { 0x0044005D,   -6, 0 },
+    { 0x0044007D,   -6, 0 },
+    { 0x00460026,  -19, 0 },
+    { 0x0046002C,  -26, 0 },
+    { 0x0046002E,  -26, 0 },
+    { 0x0046002F,  -19, 0 },
+    { 0x0046003A,   -9, 0 },
+    { 0x0046003B,   -9, 0 },
+    { 0x0046003F,    4, 0 },
+    { 0x00460041,  -19, 0 },
+    { 0x0046004A,  -29, 0 },
+    { 0x00460063,  -10, 0 },
+    { 0x00460064,  -10, 0 },
+    { 0x00460065,  -10, 0 },
+    { 0x0046006D,   -9, 0 },
+    { 0x0046006E,   -9, 0 },
+    { 0x0046006F,  -10, 0 },
+    { 0x00460070,   -9, 0 },
+    { 0x00460071,  -10, 0 },
+    { 0x00460072,   -9, 0 },
+    { 0x00460075,   -9, 0 },
+    { 0x004A0026,   -8, 0 },
+    { 0x004A002C,   -7, 0 },
+    { 0x004A002E,   -7, 0 },
+    { 0x004A002F,   -8, 0 },
+    { 0x004A0041,   -8, 0 },
+    { 0x004B002D,   -9, 0 },
+    { 0x004B0040,   -4, 0 },
+    { 0x004B0043,   -4, 0 },
+    { 0x004B0047,   -4, 0 },
+    { 0x004B004F,   -4, 0 },
+    { 0x004B0051,   -4, 0 },
+    { 0x004B0063,   -5, 0 },
+    { 0x004B0064,   -5, 0 },
+    { 0x004B0065,   -5, 0 },
+    { 0x004B0066,   -7, 0 },
+    { 0x004B006F,   -5, 0 },
+    { 0x004B0071,   -5, 0 },
+    { 0x004B0074,  -12, 0 },
+    { 0x004B0076,  -10, 0 },
+    { 0x004B0077,   -8, 0 },
+    { 0x004B0079,  -10, 0 },
+    { 0x004C0022,  -42, 0 },
+    { 0x004C0027,  -42, 0 },
+    { 0x004C002A,  -42, 0 },
+    { 0x004C002C,    8, 0 },
+    { 0x004C002D,  -29, 0 },
+    { 0x004C002E,    8, 0 },
+    { 0x004C003F,   -7, 0 },
+    { 0x004C0040,  -12, 0 },
+    { 0x004C0043,  -12, 0 },
+    { 0x004C0047,  -12, 0 },
+    { 0x004C004F,  -12, 0 },
+    { 0x004C0051,  -12, 0 },
+    { 0x004C0054,  -25, 0 },
+    { 0x004C0056,  -26, 0 },
+    { 0x004C0057,  -22, 0 },
+    { 0x004C0059,  -31, 0 },
+    { 0x004C005C,  -26, 0 },
+    { 0x004C0063,   -5, 0 },
+    { 0x004C0064,   -5, 0 },
+    { 0x004C0065,   -5, 0 },
+    { 0x004C006F,   -5, 0 },
+    { 0x004C0071,   -5, 0 },
+    { 0x004C0076,  -16, 0 },
+    { 0x004C0077,  -12, 0 },
+    { 0x004C0079,  -16, 0 },
+    { 0x004F0022,   -7, 0 },
+    { 0x004F0026,   -6, 0 },
+    { 0x004F0027,   -7, 0 },
+    { 0x004F0029,   -6, 0 },
+    { 0x004F002A,   -7, 0 },
+    { 0x004F002C,   -8, 0 },
+    { 0x004F002E,   -8, 0 },
+    { 0x004F002F,   -6, 0 },
+    { 0x004F0041,   -6, 0 },
+    { 0x004F0054,  -14, 0 },
+    { 0x004F0056,   -7, 0 },
+    { 0x004F0058,   -4, 0 },
+    { 0x004F0059,  -12, 0 },
+    { 0x004F005A,  -10, 0 },
+    { 0x004F005C,   -7, 0 },
+    { 0x004F005D,   -6, 0 },
+    { 0x004F007D,   -6, 0 },
+    { 0x00500026,  -20, 0 },
+    { 0x0050002C,  -36, 0 },
+    { 0x0050002E,  -36, 0 },
+    { 0x0050002F,  -20, 0 },
+    { 0x00500041,  -20, 0 },
+    { 0x0050004A,  -26, 0 },
+    { 0x00500061,   -7, 0 },
+    { 0x00500063,   -4, 0 },
+    { 0x00500064,   -4, 0 },
+    { 0x00500065,   -4, 0 },
+    { 0x0050006F,   -4, 0 },
+    { 0x00500071,   -4, 0 },
+    { 0x00510022,   -7, 0 },
+    { 0x00510026,   -6, 0 },
+    { 0x00510027,   -7, 0 },
+    { 0x00510029,   -6, 0 },
+    { 0x0051002A,   -7, 0 },
+    { 0x0051002C,   -8, 0 },
+    { 0x0051002E,   -8, 0 },
+    { 0x0051002F,   -6, 0 },
+    { 0x00510041,   -6, 0 },
+    { 0x00510054,  -14, 0 },
+    { 0x00510056,   -7, 0 },
+    { 0x00510058,   -4, 0 },
+    { 0x00510059,  -12, 0 },
+    { 0x0051005A,  -10, 0 },
+    { 0x0051005C,   -7, 0 },
+    { 0x0051005D,   -6, 0 },
+    { 0x0051007D,   -6, 0 },
+    { 0x00520040,   -7, 0 },
+    { 0x00520043,   -7, 0 },
+    { 0x00520047,   -7, 0 },
+    { 0x0052004F,   -7, 0 },
+    { 0x00520051,   -7, 0 },
+    { 0x00520054,   -7, 0 },
+    { 0x00520055,   -6, 0 },
+    { 0x00540026,  -19, 0 },
+    { 0x0054002C,  -26, 0 },
+    { 0x0054002D,  -26, 0 },
+    { 0x0054002E,  -26, 0 },
+    { 0x0054002F,  -19, 0 },
+    { 0x0054003A,  -23, 0 },
+    { 0x0054003B,  -23, 0 },
+    { 0x00540040,  -14, 0 },
+    { 0x00540041,  -19, 0 },
+    { 0x00540043,  -14, 0 },
+    { 0x00540047,  -14, 0 },
+    { 0x0054004A,  -29, 0 },
+    { 0x0054004F,  -14, 0 },
+    { 0x00540051,  -14, 0 },
+    { 0x00540061,  -36, 0 },
+    { 0x00540063,  -30, 0 },
+    { 0x00540064,  -30, 0 },
+    { 0x00540065,  -30, 0 },
+    { 0x00540067,  -27, 0 },
+    { 0x0054006D,  -23, 0 },
+    { 0x0054006E,  -23, 0 },
+    { 0x0054006F,  -30, 0 },
+    { 0x00540070,  -23, 0 },
+    { 0x00540071,  -30, 0 },
+    { 0x00540072,  -23, 0 },
+    { 0x00540073,  -23, 0 },
+    { 0x00540075,  -23, 0 },
+    { 0x00540076,  -26, 0 },
+    { 0x00540077,  -20, 0 },
+    { 0x00540078,  -21, 0 },
+    { 0x00540079,  -26, 0 },
+    { 0x0054007A,  -17, 0 },
+    { 0x00550026,   -8, 0 },
+    { 0x0055002C,   -7, 0 },
+    { 0x0055002E,   -7, 0 },
+    { 0x0055002F,   -8, 0 },
+    { 0x00550041,   -8, 0 },
+    { 0x00560022,    7, 0 },
+    { 0x00560026,  -20, 0 },
+    { 0x00560027,    7, 0 },
+    { 0x0056002A,    7, 0 },
+    { 0x0056002C,  -28, 0 },
+    { 0x0056002D,  -16, 0 },
+    { 0x0056002E,  -28, 0 },
+    { 0x0056002F,  -20, 0 },
+    { 0x0056003A,  -13, 0 },
+    { 0x0056003B,  -13, 0 },
+    { 0x0056003F,    7, 0 },
+    { 0x00560040,   -7, 0 },
+    { 0x00560041,  -20, 0 },
+    { 0x00560043,   -7, 0 },
+    { 0x00560047,   -7, 0 },
+    { 0x0056004A,  -22, 0 },
+    { 0x0056004F,   -7, 0 },
+    { 0x00560051,   -7, 0 },
+    { 0x00560061,  -17, 0 },
+    { 0x00560063,  -17, 0 },
+    { 0x00560064,  -17, 0 },
+    { 0x00560065,  -17, 0 },
+    { 0x00560066,   -4, 0 },
+    { 0x00560067,  -20, 0 },
+    { 0x0056006D,  -13, 0 },
+    { 0x0056006E,  -13, 0 },
+    { 0x0056006F,  -17, 0 },
+    { 0x00560070,  -13, 0 },
+    { 0x00560071,  -17, 0 },
+    { 0x00560072,  -13, 0 },
+    { 0x00560073,  -15, 0 },
+    { 0x00560074,   -6, 0 },
+    { 0x00560075,  -13, 0 },
+    { 0x00560076,   -7, 0 },
+    { 0x00560078,   -7, 0 },
+    { 0x00560079,   -7, 0 },
+    { 0x0056007A,  -12, 0 },
+    { 0x00570022,    7, 0 },
+    { 0x00570026,  -14, 0 },
+    { 0x00570027,    7, 0 },
+    { 0x0057002A,    7, 0 },
+    { 0x0057002C,  -18, 0 },
+    { 0x0057002D,   -5, 0 },
+    { 0x0057002E,  -18, 0 },
+    { 0x0057002F,  -14, 0 },
+    { 0x0057003F,    5, 0 },
+    { 0x00570041,  -14, 0 },
+    { 0x0057004A,  -15, 0 },
+    { 0x00570061,  -13, 0 },
+    { 0x00570063,   -5, 0 },
+    { 0x00570064,   -5, 0 },
+    { 0x00570065,   -5, 0 },
+    { 0x00570067,  -14, 0 },
+    { 0x0057006F,   -5, 0 },
+    { 0x00570071,   -5, 0 },
+    { 0x00570073,   -7, 0 },
+    { 0x0058002D,   -9, 0 },
+    { 0x00580040,   -4, 0 },
+    { 0x00580043,   -4, 0 },
+    { 0x00580047,   -4, 0 },
+    { 0x0058004F,   -4, 0 },
+    { 0x00580051,   -4, 0 },
+    { 0x00580063,   -5, 0 },
+    { 0x00580064,   -5, 0 },
+    { 0x00580065,   -5, 0 },
+    { 0x00580066,   -7, 0 },
+    { 0x0058006F,   -5, 0 },
+    { 0x00580071,   -5, 0 },
+    { 0x00580074,  -12, 0 },
+    { 0x00580076,  -10, 0 },
+    { 0x00580077,   -8, 0 },
+    { 0x00580079,  -10, 0 },
+    { 0x00590022,    4, 0 },
+    { 0x00590026,  -24, 0 },
+    { 0x00590027,    4, 0 },
+    { 0x0059002A,    4, 0 },
+    { 0x0059002C,  -22, 0 },
+    { 0x0059002D,  -23, 0 },
+    { 0x0059002E,  -22, 0 },
+    { 0x0059002F,  -24, 0 },
+    { 0x0059003A,  -18, 0 },
+    { 0x0059003B,  -18, 0 },
+    { 0x0059003F,    5, 0 },
+    { 0x00590040,  -12, 0 },
+    { 0x00590041,  -24, 0 },
+    { 0x00590043,  -12, 0 },
+    { 0x00590047,  -12, 0 },
+    { 0x0059004A,  -29, 0 },
+    { 0x0059004F,  -12, 0 },
+    { 0x00590051,  -12, 0 },
+    { 0x00590061,  -18, 0 },
+    { 0x00590063,  -23, 0 },
+    { 0x00590064,  -23, 0 },
+    { 0x00590065,  -23, 0 },
+    { 0x00590067,  -25, 0 },
+    { 0x0059006D,  -18, 0 },
+    { 0x0059006E,  -18, 0 },
+    { 0x0059006F,  -23, 0 },
+    { 0x00590070,  -18, 0 },
+    { 0x00590071,  -23, 0 },
+    { 0x00590072,  -18, 0 },
+    { 0x00590073,  -18, 0 },
+    { 0x00590075,  -18, 0 },
+    { 0x00590076,  -14, 0 },
+    { 0x00590077,  -13, 0 },
+    { 0x00590078,  -19, 0 },
+    { 0x00590079,  -14, 0 },
+    { 0x005A002D,  -10, 0 },
+    { 0x005A003F,    5, 0 },
+    { 0x005A0040,   -8, 0 },
+    { 0x005A0043,   -8, 0 },
+    { 0x005A0047,   -8, 0 },
+    { 0x005A004F,   -8, 0 },
+    { 0x005A0051,   -8, 0 },
+    { 0x005A0063,   -5, 0 },
+    { 0x005A0064,   -5, 0 },
+    { 0x005A0065,   -5, 0 },
+    { 0x005A006F,   -5, 0 },
+    { 0x005A0071,   -5, 0 },
+    { 0x005A0073,   -4, 0 },
+    { 0x005A0076,   -6, 0 },
+    { 0x005A0079,   -6, 0 },
+    { 0x005B0040,   -6, 0 },
+    { 0x005B0043,   -6, 0 },
+    { 0x005B0047,   -6, 0 },
+    { 0x005B004F,   -6, 0 },
+    { 0x005B0051,   -6, 0 },
+    { 0x005B0063,   -5, 0 },
+    { 0x005B0064,   -5, 0 },
+    { 0x005B0065,   -5, 0 },
+    { 0x005B006F,   -5, 0 },
+    { 0x005B0071,   -5, 0 },
+    { 0x005C0022,  -26, 0 },
+    { 0x005C0027,  -26, 0 },
+    { 0x005C002A,  -26, 0 },
+    { 0x005C002D,   -7, 0 },
+    { 0x005C003F,   -8, 0 },
+    { 0x005C0040,   -6, 0 },
+    { 0x005C0043,   -6, 0 },
+    { 0x005C0047,   -6, 0 },
+    { 0x005C004A,    7, 0 },
+    { 0x005C004F,   -6, 0 },
+    { 0x005C0051,   -6, 0 },
+    { 0x005C0054,  -19, 0 },
+    { 0x005C0055,   -8, 0 },
+    { 0x005C0056,  -20, 0 },
+    { 0x005C0057,  -12, 0 },
+    { 0x005C0059,  -24, 0 },
+    { 0x005C005C,  -20, 0 },
+    { 0x005C0076,  -12, 0 },
+    { 0x005C0079,  -12, 0 },
+    { 0x00610022,  -10, 0 },
+    { 0x00610027,  -10, 0 },
+    { 0x0061002A,  -10, 0 },
+    { 0x00610076,   -5, 0 },
+    { 0x00610077,   -2, 0 },
+    { 0x00610079,   -5, 0 },
+    { 0x00620022,  -13, 0 },
+    { 0x00620027,  -13, 0 },
+    { 0x00620029,   -5, 0 },
+    { 0x0062002A,  -13, 0 },
+    { 0x00620056,  -17, 0 },
+    { 0x00620057,   -5, 0 },
+    { 0x0062005C,  -17, 0 },
+    { 0x0062005D,   -5, 0 },
+    { 0x00620076,   -4, 0 },
+    { 0x00620078,   -9, 0 },
+    { 0x00620079,   -4, 0 },
+    { 0x0062007D,   -5, 0 },
+    { 0x00650022,  -13, 0 },
+    { 0x00650027,  -13, 0 },
+    { 0x00650029,   -5, 0 },
+    { 0x0065002A,  -13, 0 },
+    { 0x00650056,  -17, 0 },
+    { 0x00650057,   -5, 0 },
+    { 0x0065005C,  -17, 0 },
+    { 0x0065005D,   -5, 0 },
+    { 0x00650076,   -4, 0 },
+    { 0x00650078,   -9, 0 },
+    { 0x00650079,   -4, 0 },
+    { 0x0065007D,   -5, 0 },
+    { 0x00660022,   10, 0 },
+    { 0x00660027,   10, 0 },
+    { 0x0066002A,   10, 0 },
+    { 0x0066002C,  -19, 0 },
+    { 0x0066002E,  -19, 0 },
+    { 0x00680022,  -10, 0 },
+    { 0x00680027,  -10, 0 },
+    { 0x0068002A,  -10, 0 },
+    { 0x00680076,   -5, 0 },
+    { 0x00680077,   -2, 0 },
+    { 0x00680079,   -5, 0 },
+    { 0x006B0063,   -9, 0 },
+    { 0x006B0064,   -9, 0 },
+    { 0x006B0065,   -9, 0 },
+    { 0x006B006F,   -9, 0 },
+    { 0x006B0071,   -9, 0 },
+    { 0x006D0022,  -10, 0 },
+    { 0x006D0027,  -10, 0 },
+    { 0x006D002A,  -10, 0 },
+    { 0x006D0076,   -5, 0 },
+    { 0x006D0077,   -2, 0 },
+    { 0x006D0079,   -5, 0 },
+    { 0x006E0022,  -10, 0 },
+    { 0x006E0027,  -10, 0 },
+    { 0x006E002A,  -10, 0 },
+    { 0x006E0076,   -5, 0 },
+    { 0x006E0077,   -2, 0 },
+    { 0x006E0079,   -5, 0 },
+    { 0x006F0022,  -13, 0 },
+    { 0x006F0027,  -13, 0 },
+    { 0x006F0029,   -5, 0 },
+    { 0x006F002A,  -13, 0 },
+    { 0x006F0056,  -17, 0 },
+    { 0x006F0057,   -5, 0 },
+    { 0x006F005C,  -17, 0 },
+    { 0x006F005D,   -5, 0 },
+    { 0x006F0076,   -4, 0 },
+    { 0x006F0078,   -9, 0 },
+    { 0x006F0079,   -4, 0 },
+    { 0x006F007D,   -5, 0 },
+    { 0x00700022,  -13, 0 },
+    { 0x00700027,  -13, 0 },
+    { 0x00700029,   -5, 0 },
+    { 0x0070002A,  -13, 0 },
+    { 0x00700056,  -17, 0 },
+    { 0x00700057,   -5, 0 },
+    { 0x0070005C,  -17, 0 },
+    { 0x0070005D,   -5, 0 },
+    { 0x00700076,   -4, 0 },
+    { 0x00700078,   -9, 0 },
+    { 0x00700079,   -4, 0 },
+    { 0x0070007D,   -5, 0 },
+    { 0x0072002C,  -19, 0 },
+    { 0x0072002E,  -19, 0 },
+    { 0x00720061,   -5, 0 },
+    { 0x00760026,  -12, 0 },
+    { 0x0076002C,  -19, 0 },
+    { 0x0076002E,  -19, 0 },
+    { 0x0076002F,  -12, 0 },
+    { 0x00760041,  -12, 0 },
+    { 0x00760063,   -4, 0 },
+    { 0x00760064,   -4, 0 },
+    { 0x00760065,   -4, 0 },
+    { 0x0076006F,   -4, 0 },
+    { 0x00760071,   -4, 0 },
+    { 0x0077002C,   -9, 0 },
+    { 0x0077002E,   -9, 0 },
+    { 0x00780063,   -9, 0 },
+    { 0x00780064,   -9, 0 },
+    { 0x00780065,   -9, 0 },
+    { 0x0078006F,   -9, 0 },
+    { 0x00780071,   -9, 0 },
+    { 0x00790026,  -12, 0 },
+    { 0x0079002C,  -19, 0 },
+    { 0x0079002E,  -19, 0 },
+    { 0x0079002F,  -12, 0 },
+    { 0x00790041,  -12, 0 },
+    { 0x00790063,   -4, 0 },
+    { 0x00790064,   -4, 0 },
+    { 0x00790065,   -4, 0 },
+    { 0x0079006F,   -4, 0 },
+    { 0x00790071,   -4, 0 },
+    { 0x007B0040,   -6, 0 },
+    { 0x007B0043,   -6, 0 },
+    { 0x007B0047,   -6, 0 },
+    { 0x007B004F,   -6, 0 },
+    { 0x007B0051,   -6, 0 },
+    { 0x007B0063,   -5, 0 },
+    { 0x007B0064,   -5, 0 },
+    { 0x007B0065,   -5, 0 },
+    { 0x007B006F,   -5, 0 },
+    { 0x007B0071,   -5, 0 },
+};
+
+const gfx_font_t font_lato18 = {
+    .glyphs = font_lato18_glyphs,
+    .bitmaps = font_lato18_bitmaps,
+    .kerns = font_lato18_kerns,
+    .glyph_count = 95,
+    .kern_count = 641,
+    .bpp = 4,
+    .line_height = 22,
+    .baseline = 18,
+    .fallback = 0x003F,
+};
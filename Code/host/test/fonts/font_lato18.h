@@ -0,0 +1,9 @@
+/* Generated by Tools/fontgen/fontgen.py, do not edit */
+#ifndef __FONT_LATO18_H__
+#define __FONT_LATO18_H__
+
+#include "gfx_font.h"
+
+extern const gfx_font_t font_lato18;       // Lato-Regular.ttf, 18 px, A4
+
+#endif /* __FONT_LATO18_H__ */
@@ -0,0 +1,9 @@
+/* Generated by Tools/fontgen/fontgen.py, do not edit */
+#ifndef __FONT_LATO40_DIGITS_H__
+#define __FONT_LATO40_DIGITS_H__
+
+#include "gfx_font.h"
+
+extern const gfx_font_t font_lato40_digits;       // Lato-Regular.ttf, 40 px, A8
+
+#endif /* __FONT_LATO40_DIGITS_H__ */
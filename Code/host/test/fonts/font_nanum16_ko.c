@@ -0,0 +1,1003 @@
+/* Generated by Tools/fontgen/fontgen.py, do not edit */
+/* nanum.ttf, 16 px, A4, 136 glyphs, 0 kerning pairs, 11608 bitmap bytes (13541 unpacked), store 15928 bytes, 36 index pages */
+
+#include "font_nanum16_ko.h"
+
+__attribute__((section(".ro_data"), aligned(32))) const uint8_t font_nanum16_ko_store[15928] = {
+    0x47, 0x46, 0x4E, 0x54, 0x01, 0x00, 0x30, 0x00, 0x38, 0x3E, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
+    0x04, 0x13, 0x0E, 0x00, 0x41, 0x31, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x30, 0x02, 0x00, 0x00,
+    0x60, 0x08, 0x00, 0x00, 0xE0, 0x10, 0x00, 0x00, 0xE0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0xFF, 0xFF,
+    0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0A, 0x00, 0xFF, 0xFF, 0x0B, 0x00,
+    0x0C, 0x00, 0x0D, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0xFF, 0xFF,
+    0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00,
+    0x19, 0x00, 0x1A, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1B, 0x00, 0x1C, 0x00, 0xFF, 0xFF,
+    0x1D, 0x00, 0x1E, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x21, 0x00, 0x22, 0x00, 0x23, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x20,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02,
+    0x03, 0x03, 0x06, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x01, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0D, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02,
+    0x02, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x04, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x21, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x80, 0x00, 0x30, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+    0x2D, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x06, 0x06, 0x08, 0x08, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x02, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03,
+    0x00, 0x00, 0x00, 0x10, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3C, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x05, 0x05, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01,
+    0x20, 0x01, 0x01, 0x00, 0x00, 0x20, 0x01, 0x00, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x01, 0x03, 0x06, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x03, 0x04, 0x05, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x11,
+    0x20, 0x00, 0x11, 0x00, 0x21, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0x08, 0x0B, 0x0B, 0x11, 0x01, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x61, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x04, 0x04, 0x06, 0x06, 0x06, 0x06, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x22, 0x10, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x03,
+    0x06, 0x08, 0x08, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x04, 0x04, 0x04, 0x05,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x41, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x0A, 0x08, 0x02, 0x05, 0x00, 0x00,
+    0x00, 0xAC, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x0E, 0x00, 0x02, 0x60, 0x00,
+    0x04, 0xAC, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x0F, 0x00, 0x01, 0x62, 0x00,
+    0x70, 0xAC, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x0E, 0x00, 0x02, 0x5A, 0x00,
+    0xA0, 0xAC, 0x00, 0x00, 0x44, 0x01, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x10, 0x00, 0x01, 0x74, 0x00,
+    0xB0, 0xAC, 0x00, 0x00, 0xB8, 0x01, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x0F, 0x00, 0x01, 0x57, 0x00,
+    0xBD, 0xAC, 0x00, 0x00, 0x0F, 0x02, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x0F, 0x00, 0x01, 0x65, 0x00,
+    0xC4, 0xAC, 0x00, 0x00, 0x74, 0x02, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x0F, 0x00, 0x01, 0x62, 0x00,
+    0xF5, 0xAC, 0x00, 0x00, 0xD6, 0x02, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x0E, 0x00, 0x02, 0x55, 0x00,
+    0x00, 0xAD, 0x00, 0x00, 0x2B, 0x03, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x0E, 0x00, 0x02, 0x5E, 0x00,
+    0xE0, 0xAD, 0x00, 0x00, 0x89, 0x03, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x0E, 0x00, 0x02, 0x50, 0x00,
+    0xF8, 0xAD, 0x00, 0x00, 0xD9, 0x03, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x0B, 0x00, 0x03, 0x35, 0x00,
+    0x08, 0xAE, 0x00, 0x00, 0x0E, 0x04, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x0E, 0x00, 0x02, 0x48, 0x00,
+    0x30, 0xAE, 0x00, 0x00, 0x56, 0x04, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x0E, 0x00, 0x02, 0x5A, 0x00,
+    0x4C, 0xAE, 0x00, 0x00, 0xB0, 0x04, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x0E, 0x00, 0x02, 0x64, 0x00,
+    0xBC, 0xAE, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x0E, 0x00, 0x02, 0x5C, 0x00,
+    0xA0, 0xB0, 0x00, 0x00, 0x70, 0x05, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x0E, 0x01, 0x02, 0x56, 0x00,
+    0xA8, 0xB0, 0x00, 0x00, 0xC6, 0x05, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x0E, 0x01, 0x02, 0x5A, 0x00,
+    0x08, 0xB1, 0x00, 0x00, 0x20, 0x06, 0x00, 0x00, 0xE0, 0x00, 0x0C, 0x0E, 0x01, 0x02, 0x44, 0x00,
+    0x24, 0xB1, 0x00, 0x00, 0x64, 0x06, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x0F, 0x00, 0x01, 0x61, 0x00,
+    0x92, 0xB1, 0x00, 0x00, 0xC5, 0x06, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x0E, 0x00, 0x02, 0x48, 0x00,
+    0x94, 0xB2, 0x00, 0x00, 0x0D, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x0E, 0x00, 0x02, 0x36, 0x00,
+    0xC8, 0xB2, 0x00, 0x00, 0x43, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x0C, 0x0E, 0x01, 0x02, 0x43, 0x00,
+    0xE4, 0xB2, 0x00, 0x00, 0x86, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x0E, 0x01, 0x02, 0x59, 0x00,
+    0x00, 0xB3, 0x00, 0x00, 0xDF, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x0C, 0x0E, 0x01, 0x02, 0x00, 0x00,
+    0x70, 0xB3, 0x00, 0x00, 0x33, 0x08, 0x00, 0x00, 0xE0, 0x00, 0x0C, 0x0E, 0x01, 0x02, 0x00, 0x00,
+    0xC4, 0xB3, 0x00, 0x00, 0x87, 0x08, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x0B, 0x00, 0x03, 0x36, 0x00,
+    0xD9, 0xB3, 0x00, 0x00, 0xBD, 0x08, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x0E, 0x00, 0x02, 0x53, 0x00,
+    0x18, 0xB4, 0x00, 0x00, 0x10, 0x09, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x0E, 0x00, 0x02, 0x5A, 0x00,
+    0xDC, 0xB4, 0x00, 0x00, 0x6A, 0x09, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x0B, 0x00, 0x03, 0x2A, 0x00,
+    0x14, 0xB5, 0x00, 0x00, 0x94, 0x09, 0x00, 0x00, 0xE0, 0x00, 0x0C, 0x0E, 0x01, 0x02, 0x44, 0x00,
+    0xC9, 0xB7, 0x00, 0x00, 0xD8, 0x09, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x0E, 0x00, 0x02, 0x65, 0x00,
+    0x08, 0xB8, 0x00, 0x00, 0x3D, 0x0A, 0x00, 0x00, 0xE0, 0x00, 0x0C, 0x0E, 0x01, 0x02, 0x00, 0x00,
+    0x25, 0xB8, 0x00, 0x00, 0x91, 0x0A, 0x00, 0x00, 0xE0, 0x00, 0x0C, 0x0F, 0x01, 0x02, 0x50, 0x00,
+    0x28, 0xB8, 0x00, 0x00, 0xE1, 0x0A, 0x00, 0x00, 0xE0, 0x00, 0x0C, 0x0E, 0x01, 0x02, 0x4C, 0x00,
+    0x5C, 0xB8, 0x00, 0x00, 0x2D, 0x0B, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x0B, 0x00, 0x03, 0x39, 0x00,
+    0x58, 0xB9, 0x00, 0x00, 0x66, 0x0B, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x0F, 0x00, 0x02, 0x50, 0x00,
+    0x7C, 0xB9, 0x00, 0x00, 0xB6, 0x0B, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x0E, 0x00, 0x02, 0x4C, 0x00,
+    0x84, 0xB9, 0x00, 0x00, 0x02, 0x0C, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x0E, 0x00, 0x02, 0x4B, 0x00,
+    0xAC, 0xB9, 0x00, 0x00, 0x4D, 0x0C, 0x00, 0x00, 0xE0, 0x00, 0x0C, 0x0E, 0x01, 0x02, 0x49, 0x00,
+    0xBC, 0xB9, 0x00, 0x00, 0x96, 0x0C, 0x00, 0x00, 0xE0, 0x00, 0x0C, 0x0F, 0x01, 0x01, 0x53, 0x00,
+    0x74, 0xBA, 0x00, 0x00, 0xE9, 0x0C, 0x00, 0x00, 0xE0, 0x00, 0x0C, 0x0E, 0x01, 0x02, 0x4F, 0x00,
+    0xA8, 0xBA, 0x00, 0x00, 0x38, 0x0D, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x0B, 0x00, 0x03, 0x45, 0x00,
+    0x34, 0xBB, 0x00, 0x00, 0x7D, 0x0D, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x0E, 0x00, 0x02, 0x48, 0x00,
+    0x00, 0xBC, 0x00, 0x00, 0xC5, 0x0D, 0x00, 0x00, 0xE0, 0x00, 0x0C, 0x0E, 0x01, 0x02, 0x49, 0x00,
+    0x0F, 0xBC, 0x00, 0x00, 0x0E, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x0E, 0x01, 0x02, 0x59, 0x00,
+    0x1C, 0xBC, 0x00, 0x00, 0x67, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x0F, 0x00, 0x01, 0x66, 0x00,
+    0x1D, 0xBC, 0x00, 0x00, 0xCD, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x10, 0x00, 0x01, 0x6F, 0x00,
+    0x29, 0xBC, 0x00, 0x00, 0x3C, 0x0F, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x0F, 0x00, 0x01, 0x71, 0x00,
+    0x30, 0xBC, 0x00, 0x00, 0xAD, 0x0F, 0x00, 0x00, 0xE0, 0x00, 0x0C, 0x0E, 0x01, 0x02, 0x00, 0x00,
+    0x84, 0xBC, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0xE0, 0x00, 0x0C, 0x0F, 0x01, 0x02, 0x4D, 0x00,
+    0x88, 0xBC, 0x00, 0x00, 0x4E, 0x10, 0x00, 0x00, 0xE0, 0x00, 0x0C, 0x0E, 0x01, 0x02, 0x4F, 0x00,
+    0xC0, 0xBC, 0x00, 0x00, 0x9D, 0x10, 0x00, 0x00, 0xE0, 0x00, 0x0C, 0x0F, 0x01, 0x01, 0x4E, 0x00,
+    0xF4, 0xBC, 0x00, 0x00, 0xEB, 0x10, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x0B, 0x00, 0x03, 0x48, 0x00,
+    0x80, 0xBD, 0x00, 0x00, 0x33, 0x11, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x0E, 0x00, 0x02, 0x48, 0x00,
+    0x44, 0xBE, 0x00, 0x00, 0x7B, 0x11, 0x00, 0x00, 0xE0, 0x00, 0x0C, 0x0E, 0x01, 0x02, 0x4A, 0x00,
+    0xAC, 0xC0, 0x00, 0x00, 0xC5, 0x11, 0x00, 0x00, 0xE0, 0x00, 0x10, 0x0E, 0xFF, 0x02, 0x65, 0x00,
+    0xC1, 0xC0, 0x00, 0x00, 0x2A, 0x12, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x0E, 0x00, 0x02, 0x68, 0x00,
+    0xDD, 0xC0, 0x00, 0x00, 0x92, 0x12, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x0E, 0x00, 0x02, 0x61, 0x00,
+    0x1C, 0xC1, 0x00, 0x00, 0xF3, 0x12, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x0E, 0x00, 0x02, 0x5A, 0x00,
+    0x20, 0xC1, 0x00, 0x00, 0x4D, 0x13, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x0F, 0x00, 0x01, 0x60, 0x00,
+    0x24, 0xC1, 0x00, 0x00, 0xAD, 0x13, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x0F, 0x00, 0x01, 0x5B, 0x00,
+    0x38, 0xC1, 0x00, 0x00, 0x08, 0x14, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x0F, 0xFF, 0x01, 0x64, 0x00,
+    0x3C, 0xC1, 0x00, 0x00, 0x6C, 0x14, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x0F, 0x00, 0x01, 0x62, 0x00,
+    0x8C, 0xC1, 0x00, 0x00, 0xCE, 0x14, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x0C, 0x00, 0x02, 0x46, 0x00,
+    0x8D, 0xC1, 0x00, 0x00, 0x14, 0x15, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x0F, 0x00, 0x02, 0x52, 0x00,
+    0xA4, 0xC2, 0x00, 0x00, 0x66, 0x15, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x0C, 0x00, 0x02, 0x3C, 0x00,
+    0xB5, 0xC2, 0x00, 0x00, 0xA2, 0x15, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x0E, 0x00, 0x02, 0x60, 0x00,
+    0xDC, 0xC2, 0x00, 0x00, 0x02, 0x16, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x0E, 0x00, 0x02, 0x5A, 0x00,
+    0xE4, 0xC2, 0x00, 0x00, 0x5C, 0x16, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x0E, 0x00, 0x02, 0x55, 0x00,
+    0x4C, 0xC5, 0x00, 0x00, 0xB1, 0x16, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x0E, 0x00, 0x02, 0x62, 0x00,
+    0xB4, 0xC5, 0x00, 0x00, 0x13, 0x17, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x0E, 0x00, 0x02, 0x5A, 0x00,
+    0xB8, 0xC5, 0x00, 0x00, 0x6D, 0x17, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x0E, 0x00, 0x02, 0x5A, 0x00,
+    0xC5, 0xC5, 0x00, 0x00, 0xC7, 0x17, 0x00, 0x00, 0xE0, 0x00, 0x0C, 0x0E, 0x01, 0x02, 0x53, 0x00,
+    0xC8, 0xC5, 0x00, 0x00, 0x1A, 0x18, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x10, 0x01, 0x01, 0x61, 0x00,
+    0xD0, 0xC5, 0x00, 0x00, 0x7B, 0x18, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x0E, 0x00, 0x02, 0x5E, 0x00,
+    0xED, 0xC5, 0x00, 0x00, 0xD9, 0x18, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x0F, 0x00, 0x02, 0x5B, 0x00,
+    0xF0, 0xC5, 0x00, 0x00, 0x34, 0x19, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x0E, 0x00, 0x02, 0x5A, 0x00,
+    0x24, 0xC6, 0x00, 0x00, 0x8E, 0x19, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x0B, 0x00, 0x03, 0x45, 0x00,
+    0x28, 0xC6, 0x00, 0x00, 0xD3, 0x19, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x0E, 0x00, 0x02, 0x4C, 0x00,
+    0x40, 0xC6, 0x00, 0x00, 0x1F, 0x1A, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x0E, 0x00, 0x02, 0x5F, 0x00,
+    0x94, 0xC6, 0x00, 0x00, 0x7E, 0x1A, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x0B, 0x00, 0x03, 0x4C, 0x00,
+    0xA9, 0xC6, 0x00, 0x00, 0xCA, 0x1A, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x0E, 0x00, 0x02, 0x68, 0x00,
+    0xCC, 0xC6, 0x00, 0x00, 0x32, 0x1B, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x10, 0x00, 0x01, 0x6A, 0x00,
+    0xE8, 0xC6, 0x00, 0x00, 0x9C, 0x1B, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x0F, 0x00, 0x02, 0x64, 0x00,
+    0x40, 0xC7, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x0E, 0x00, 0x02, 0x4E, 0x00,
+    0x4C, 0xC7, 0x00, 0x00, 0x4E, 0x1C, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x0E, 0x00, 0x02, 0x56, 0x00,
+    0x74, 0xC7, 0x00, 0x00, 0xA4, 0x1C, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x0E, 0x00, 0x02, 0x5A, 0x00,
+    0x78, 0xC7, 0x00, 0x00, 0xFE, 0x1C, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x0E, 0x00, 0x02, 0x5C, 0x00,
+    0x7C, 0xC7, 0x00, 0x00, 0x5A, 0x1D, 0x00, 0x00, 0xE0, 0x00, 0x0C, 0x0E, 0x01, 0x02, 0x4B, 0x00,
+    0x85, 0xC7, 0x00, 0x00, 0xA5, 0x1D, 0x00, 0x00, 0xE0, 0x00, 0x0C, 0x0E, 0x01, 0x02, 0x51, 0x00,
+    0x90, 0xC7, 0x00, 0x00, 0xF6, 0x1D, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x0E, 0x00, 0x02, 0x5E, 0x00,
+    0x94, 0xC7, 0x00, 0x00, 0x54, 0x1E, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x0F, 0x00, 0x01, 0x63, 0x00,
+    0xA0, 0xC7, 0x00, 0x00, 0xB7, 0x1E, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x0F, 0x00, 0x01, 0x69, 0x00,
+    0xA5, 0xC7, 0x00, 0x00, 0x20, 0x1F, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x0F, 0x00, 0x01, 0x6E, 0x00,
+    0xAC, 0xC7, 0x00, 0x00, 0x8E, 0x1F, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x0F, 0x00, 0x01, 0x64, 0x00,
+    0x00, 0xC8, 0x00, 0x00, 0xF2, 0x1F, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x0E, 0x00, 0x02, 0x5A, 0x00,
+    0x04, 0xC8, 0x00, 0x00, 0x4C, 0x20, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x0F, 0x00, 0x01, 0x5E, 0x00,
+    0x08, 0xC8, 0x00, 0x00, 0xAA, 0x20, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x0F, 0x00, 0x01, 0x5C, 0x00,
+    0x15, 0xC8, 0x00, 0x00, 0x06, 0x21, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x0F, 0x00, 0x01, 0x64, 0x00,
+    0x70, 0xC8, 0x00, 0x00, 0x6A, 0x21, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x0C, 0x00, 0x02, 0x42, 0x00,
+    0x71, 0xC8, 0x00, 0x00, 0xAC, 0x21, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x10, 0x00, 0x01, 0x59, 0x00,
+    0xFC, 0xC8, 0x00, 0x00, 0x05, 0x22, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x10, 0x00, 0x01, 0x4A, 0x00,
+    0x00, 0xC9, 0x00, 0x00, 0x4F, 0x22, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x0F, 0x00, 0x01, 0x60, 0x00,
+    0x11, 0xC9, 0x00, 0x00, 0xAF, 0x22, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x0F, 0x00, 0x01, 0x63, 0x00,
+    0xC0, 0xC9, 0x00, 0x00, 0x12, 0x23, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x0E, 0x00, 0x02, 0x5A, 0x00,
+    0xC4, 0xC9, 0x00, 0x00, 0x6C, 0x23, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x0F, 0x00, 0x01, 0x5E, 0x00,
+    0xD0, 0xC9, 0x00, 0x00, 0xCA, 0x23, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x0F, 0x00, 0x01, 0x5D, 0x00,
+    0xDC, 0xC9, 0x00, 0x00, 0x27, 0x24, 0x00, 0x00, 0xE0, 0x00, 0x10, 0x0F, 0xFF, 0x01, 0x6D, 0x00,
+    0xA9, 0xCD, 0x00, 0x00, 0x94, 0x24, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x0E, 0x00, 0x02, 0x60, 0x00,
+    0xE8, 0xCD, 0x00, 0x00, 0xF4, 0x24, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x0E, 0x00, 0x02, 0x5F, 0x00,
+    0x58, 0xCE, 0x00, 0x00, 0x53, 0x25, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x0E, 0x00, 0x02, 0x5A, 0x00,
+    0x6C, 0xD0, 0x00, 0x00, 0xAD, 0x25, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x0B, 0x00, 0x03, 0x38, 0x00,
+    0xDC, 0xD0, 0x00, 0x00, 0xE5, 0x25, 0x00, 0x00, 0xE0, 0x00, 0x0C, 0x0F, 0x01, 0x01, 0x00, 0x00,
+    0xDD, 0xD0, 0x00, 0x00, 0x3F, 0x26, 0x00, 0x00, 0xE0, 0x00, 0x0C, 0x0F, 0x01, 0x02, 0x53, 0x00,
+    0x30, 0xD1, 0x00, 0x00, 0x92, 0x26, 0x00, 0x00, 0xE0, 0x00, 0x0C, 0x10, 0x01, 0x01, 0x4D, 0x00,
+    0x5C, 0xD1, 0x00, 0x00, 0xDF, 0x26, 0x00, 0x00, 0xE0, 0x00, 0x0C, 0x0F, 0x01, 0x01, 0x57, 0x00,
+    0xB8, 0xD2, 0x00, 0x00, 0x36, 0x27, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x0B, 0x00, 0x03, 0x31, 0x00,
+    0x28, 0xD3, 0x00, 0x00, 0x67, 0x27, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x0F, 0x00, 0x01, 0x62, 0x00,
+    0x8C, 0xD3, 0x00, 0x00, 0xC9, 0x27, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x0F, 0x00, 0x01, 0x5F, 0x00,
+    0xC9, 0xD3, 0x00, 0x00, 0x28, 0x28, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x0F, 0x00, 0x01, 0x65, 0x00,
+    0x5C, 0xD4, 0x00, 0x00, 0x8D, 0x28, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x0B, 0x00, 0x03, 0x44, 0x00,
+    0x04, 0xD5, 0x00, 0x00, 0xD1, 0x28, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x0B, 0x00, 0x03, 0x37, 0x00,
+    0x0C, 0xD5, 0x00, 0x00, 0x08, 0x29, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x0E, 0x00, 0x02, 0x4B, 0x00,
+    0x58, 0xD5, 0x00, 0x00, 0x53, 0x29, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x0F, 0x00, 0x01, 0x5E, 0x00,
+    0x69, 0xD5, 0x00, 0x00, 0xB1, 0x29, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x0E, 0x00, 0x02, 0x6D, 0x00,
+    0x6D, 0xD5, 0x00, 0x00, 0x1E, 0x2A, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x0E, 0x00, 0x02, 0x68, 0x00,
+    0x74, 0xD5, 0x00, 0x00, 0x86, 0x2A, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x0E, 0x00, 0x02, 0x5C, 0x00,
+    0x88, 0xD5, 0x00, 0x00, 0xE2, 0x2A, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x0F, 0x00, 0x02, 0x71, 0x00,
+    0x89, 0xD5, 0x00, 0x00, 0x53, 0x2B, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x0F, 0x00, 0x01, 0x61, 0x00,
+    0x04, 0xD6, 0x00, 0x00, 0xB4, 0x2B, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x0F, 0x00, 0x01, 0x5C, 0x00,
+    0x38, 0xD6, 0x00, 0x00, 0x10, 0x2C, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x0B, 0x00, 0x03, 0x3D, 0x00,
+    0x54, 0xD6, 0x00, 0x00, 0x4D, 0x2C, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x10, 0x00, 0x01, 0x64, 0x00,
+    0x55, 0xD6, 0x00, 0x00, 0xB1, 0x2C, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x0F, 0x00, 0x01, 0x62, 0x00,
+    0xC4, 0xD6, 0x00, 0x00, 0x13, 0x2D, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x0E, 0x00, 0x02, 0x45, 0x00,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xCF, 0xD8, 0x00, 0x00, 0x00, 0xC9, 0xD8, 0x00, 0x00, 0x00, 0xC9, 0xD8,
+    0x00, 0x00, 0x00, 0xC9, 0xD8, 0x00, 0x00, 0x00, 0xC9, 0xD8, 0x00, 0x00, 0x00, 0xC9, 0xD8, 0x00,
+    0x00, 0x00, 0xC9, 0xF8, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x60, 0xFE, 0x66, 0x09, 0x00, 0xBA, 0x00,
+    0x00, 0x90, 0x99, 0x99, 0xDC, 0x00, 0xBA, 0xFC, 0x00, 0x02, 0xAB, 0x00, 0xBA, 0xFD, 0x00, 0x03,
+    0x10, 0x6E, 0x00, 0xBA, 0xFD, 0x00, 0x03, 0x60, 0x1F, 0x00, 0xBA, 0xFD, 0x00, 0x1F, 0xD1, 0x09,
+    0x00, 0xEA, 0x99, 0x02, 0x00, 0x00, 0xEA, 0x01, 0x00, 0xDA, 0x66, 0x01, 0x00, 0x80, 0x4F, 0x00,
+    0x00, 0xBA, 0x00, 0x00, 0x10, 0xFA, 0x05, 0x00, 0x00, 0xBA, 0x00, 0x00, 0xE4, 0x3D, 0xFE, 0x00,
+    0x04, 0xBA, 0x00, 0x00, 0x71, 0x01, 0xFE, 0x00, 0x00, 0xBA, 0xFA, 0x00, 0x00, 0xBA, 0xFA, 0x00,
+    0x00, 0xBA, 0xFA, 0x00, 0x02, 0xBA, 0x00, 0x00, 0xF9, 0x00, 0x00, 0xA0, 0xFE, 0xFF, 0x01, 0x01,
+    0xC8, 0xFC, 0x00, 0x02, 0xD9, 0x00, 0xC8, 0xFC, 0x00, 0x02, 0x9D, 0x00, 0xC8, 0xFD, 0x00, 0x03,
+    0x60, 0x2F, 0x00, 0xC8, 0xFD, 0x00, 0x17, 0xE3, 0x07, 0x00, 0xF8, 0xFF, 0x02, 0x00, 0x50, 0xAE,
+    0x00, 0x00, 0xC8, 0x00, 0x00, 0x40, 0xFB, 0x07, 0x00, 0x00, 0xC8, 0x00, 0x00, 0xE3, 0x2A, 0xFE,
+    0x00, 0x03, 0xC8, 0x00, 0x00, 0x10, 0xFD, 0x00, 0x00, 0xC8, 0xFE, 0x00, 0x04, 0xF0, 0x06, 0x00,
+    0x00, 0x96, 0xFE, 0x00, 0x01, 0xF0, 0x06, 0xFB, 0x00, 0x01, 0xF0, 0x06, 0xFB, 0x00, 0x01, 0xF0,
+    0x06, 0xFB, 0x00, 0x00, 0xF0, 0xFD, 0xFF, 0x01, 0x02, 0x00, 0xFC, 0x00, 0x02, 0xD0, 0x08, 0xD0,
+    0xFE, 0xFF, 0x02, 0x01, 0xD0, 0x08, 0xFE, 0x00, 0x03, 0xE7, 0x00, 0xD0, 0x08, 0xFE, 0x00, 0x2F,
+    0xAB, 0x00, 0xD0, 0x08, 0x00, 0x00, 0x10, 0x5F, 0x00, 0xD0, 0x08, 0x00, 0x00, 0x80, 0x3E, 0xFF,
+    0xFF, 0x08, 0x00, 0x00, 0xF3, 0x06, 0x00, 0xD0, 0x08, 0x00, 0x20, 0xBE, 0x00, 0x00, 0xD0, 0x08,
+    0x00, 0xE3, 0x1C, 0x00, 0x00, 0xD0, 0x08, 0x81, 0xAF, 0x01, 0x00, 0x00, 0xD0, 0x08, 0xC2, 0x06,
+    0xFE, 0x00, 0x01, 0xD0, 0x08, 0xFC, 0x00, 0x01, 0xD0, 0x08, 0xFC, 0x00, 0x01, 0xD0, 0x08, 0xFC,
+    0x00, 0x01, 0xD0, 0x08, 0xF9, 0x00, 0x06, 0x50, 0xFF, 0xFF, 0x3F, 0xF3, 0x72, 0x0D, 0xFE, 0x00,
+    0x04, 0x50, 0x1F, 0xF3, 0x72, 0x0D, 0xFE, 0x00, 0x04, 0x80, 0x0E, 0xF3, 0x72, 0x0D, 0xFE, 0x00,
+    0x04, 0xE0, 0x09, 0xF3, 0x72, 0x0D, 0xFE, 0x00, 0x1E, 0xF7, 0xFF, 0xFF, 0x72, 0x0D, 0x00, 0x00,
+    0x60, 0x6F, 0x00, 0xF3, 0x72, 0x0D, 0x00, 0x20, 0xF9, 0x07, 0x00, 0xF3, 0x72, 0x0D, 0x00, 0xE1,
+    0x4D, 0x00, 0x00, 0xF3, 0x72, 0x0D, 0x00, 0x20, 0xF8, 0x00, 0x03, 0xC3, 0x02, 0x40, 0x0C, 0xFD,
+    0x00, 0x03, 0xF6, 0x01, 0x60, 0x0E, 0xFE, 0x00, 0x04, 0x10, 0xDD, 0x08, 0xB0, 0x8D, 0xFE, 0x00,
+    0x16, 0xD3, 0x1B, 0x5D, 0xB7, 0xD1, 0x2A, 0x00, 0x20, 0xAF, 0x01, 0xD2, 0x1B, 0x20, 0xCB, 0x00,
+    0x00, 0x02, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0xFA, 0x00, 0x00, 0x60, 0xFE, 0xFF, 0x02, 0x05,
+    0xD0, 0x08, 0xFE, 0x00, 0x21, 0xF6, 0x01, 0xD0, 0x08, 0x00, 0x00, 0x10, 0x8D, 0xF4, 0xFF, 0x08,
+    0x00, 0x00, 0xC1, 0x1C, 0x00, 0xD0, 0x08, 0x00, 0x70, 0xCE, 0x01, 0xFA, 0xFF, 0x08, 0x90, 0xEE,
+    0x07, 0x00, 0x00, 0xD0, 0x08, 0x60, 0x16, 0xFE, 0x00, 0x01, 0x70, 0x04, 0xF9, 0x00, 0x00, 0xA0,
+    0xFD, 0xFF, 0x00, 0x08, 0xFC, 0x00, 0x03, 0xD0, 0x08, 0x00, 0xA0, 0xFD, 0xFF, 0x03, 0x08, 0x00,
+    0xA0, 0x0A, 0xFC, 0x00, 0x01, 0xA0, 0x0A, 0xFC, 0x00, 0x00, 0xA0, 0xFD, 0xFF, 0x00, 0x0C, 0xFA,
+    0x00, 0x00, 0x60, 0xFE, 0xFF, 0x02, 0x04, 0xD0, 0x08, 0xFE, 0x00, 0x03, 0xF6, 0x01, 0xD0, 0x08,
+    0xFE, 0x00, 0x21, 0xAC, 0xF4, 0xFF, 0x08, 0x00, 0x00, 0x60, 0x2F, 0x00, 0xD0, 0x08, 0x00, 0x00,
+    0xF6, 0x06, 0x00, 0xD0, 0x08, 0x00, 0xA3, 0x6F, 0x00, 0xF9, 0xFF, 0x08, 0xB1, 0xBF, 0x03, 0x00,
+    0x00, 0xD0, 0x08, 0x50, 0x03, 0xFE, 0x00, 0x2B, 0xD0, 0x08, 0x00, 0x00, 0xB5, 0xFE, 0xCE, 0x78,
+    0x03, 0x00, 0x80, 0x8F, 0x12, 0x41, 0xEB, 0x02, 0x00, 0xF0, 0x08, 0x00, 0x00, 0xE0, 0x08, 0x00,
+    0xF0, 0x08, 0x00, 0x00, 0xE0, 0x08, 0x00, 0x80, 0x7F, 0x02, 0x41, 0xEB, 0x02, 0x00, 0x00, 0xB5,
+    0xFE, 0xDE, 0x29, 0x00, 0xFD, 0x00, 0x00, 0x52, 0xFB, 0x00, 0x48, 0xE7, 0xA0, 0x0B, 0xD0, 0xFF,
+    0xFF, 0x0C, 0xE7, 0xA0, 0x0B, 0x00, 0x00, 0xA0, 0x0A, 0xE7, 0xA0, 0x0B, 0x00, 0x00, 0xD0, 0xBE,
+    0xED, 0xA0, 0x0B, 0x00, 0x00, 0xF2, 0x45, 0xE9, 0xA0, 0x0B, 0x00, 0x00, 0xC9, 0x00, 0xE7, 0xA0,
+    0x0B, 0x00, 0x30, 0x5F, 0x00, 0xE7, 0xA0, 0x0B, 0x00, 0xC1, 0x0B, 0xFD, 0xEF, 0xA0, 0x0B, 0x10,
+    0xDC, 0x01, 0x00, 0xE7, 0xA0, 0x0B, 0xD3, 0x2D, 0x00, 0x00, 0xE7, 0xA0, 0x0B, 0x81, 0x01, 0x00,
+    0x00, 0xE7, 0xA0, 0x0B, 0xFD, 0x00, 0x02, 0xE7, 0xA0, 0x0B, 0xFD, 0x00, 0x02, 0xE7, 0xA0, 0x0B,
+    0xFD, 0x00, 0x02, 0xE7, 0xA0, 0x0B, 0x01, 0x00, 0xFD, 0xFE, 0xFF, 0x00, 0xCF, 0xFA, 0x00, 0x00,
+    0xB9, 0xFA, 0x00, 0x00, 0xAB, 0xFD, 0x00, 0x03, 0x90, 0x0B, 0x00, 0x8C, 0xFD, 0x00, 0x03, 0xA0,
+    0x0C, 0x00, 0x7E, 0xFD, 0x00, 0x06, 0xA0, 0x0C, 0x00, 0x01, 0x00, 0x00, 0xFC, 0xFB, 0xFF, 0x00,
+    0x01, 0xF0, 0x00, 0x04, 0x50, 0xDB, 0xFF, 0xBE, 0x06, 0xFE, 0x00, 0x04, 0xE8, 0x27, 0x00, 0x62,
+    0xAE, 0xFE, 0x00, 0x00, 0xAD, 0xFE, 0x00, 0x00, 0xE8, 0xFE, 0x00, 0x04, 0xF8, 0x27, 0x00, 0x62,
+    0x9E, 0xFE, 0x00, 0x06, 0x50, 0xDB, 0xFF, 0xBE, 0x06, 0x00, 0x00, 0x00, 0x90, 0xFE, 0xFF, 0x01,
+    0x09, 0xF6, 0xFC, 0x00, 0x02, 0xC0, 0x08, 0xF6, 0xFC, 0x00, 0x02, 0xD0, 0x07, 0xF6, 0xFE, 0x00,
+    0x04, 0x10, 0x02, 0xE0, 0x06, 0xF6, 0xFE, 0x00, 0x04, 0x80, 0x0D, 0xF2, 0x03, 0xF6, 0xFE, 0x00,
+    0x0F, 0x80, 0x0D, 0x31, 0x00, 0xF6, 0xFF, 0x02, 0x00, 0x80, 0x0D, 0x00, 0x00, 0xF6, 0x00, 0x00,
+    0xFC, 0xFE, 0xFF, 0x01, 0xEF, 0xF6, 0xFA, 0x00, 0x00, 0xF6, 0xFA, 0x00, 0x00, 0xF6, 0xFE, 0x00,
+    0x04, 0xF4, 0x02, 0x00, 0x00, 0xF5, 0xFE, 0x00, 0x01, 0xF4, 0x02, 0xFB, 0x00, 0x01, 0xF4, 0x02,
+    0xFB, 0x00, 0x00, 0xF4, 0xFD, 0xFF, 0x01, 0x04, 0x00, 0x01, 0x00, 0xFB, 0xFE, 0xFF, 0x00, 0xCF,
+    0xFA, 0x00, 0x00, 0xB9, 0xFA, 0x00, 0x00, 0xAA, 0xFA, 0x00, 0x00, 0x9B, 0xFA, 0x00, 0x00, 0x8C,
+    0xFA, 0x00, 0x03, 0x7E, 0x00, 0x00, 0xFC, 0xFB, 0xFF, 0x06, 0x01, 0x00, 0x00, 0xF0, 0x06, 0xF1,
+    0x04, 0xFD, 0x00, 0x03, 0xF0, 0x06, 0xF1, 0x04, 0xFE, 0x00, 0x04, 0x55, 0xF0, 0x06, 0xF1, 0x04,
+    0xFE, 0x00, 0x04, 0xAB, 0xF0, 0x06, 0xF1, 0x04, 0xFE, 0x00, 0x00, 0xAB, 0xFA, 0x00, 0x00, 0xAB,
+    0xFA, 0x00, 0x00, 0xFB, 0xFD, 0xFF, 0x01, 0x07, 0x00, 0x01, 0x00, 0xF9, 0xFE, 0xFF, 0x00, 0xCF,
+    0xFB, 0x00, 0x00, 0xBA, 0xFB, 0x00, 0x00, 0xAB, 0xFB, 0x00, 0x00, 0x9C, 0xFB, 0x00, 0x00, 0x8D,
+    0xFB, 0x00, 0x00, 0x6E, 0xFC, 0x00, 0x01, 0x10, 0x4F, 0xFC, 0x00, 0x01, 0x30, 0x3F, 0xFC, 0x00,
+    0x01, 0x50, 0x1F, 0xFC, 0x00, 0x03, 0x80, 0x0D, 0x00, 0xFA, 0xFC, 0xFF, 0x00, 0xEF, 0x01, 0x00,
+    0xFB, 0xFE, 0xFF, 0x00, 0xCF, 0xFA, 0x00, 0x00, 0xB9, 0xFA, 0x00, 0x00, 0xAA, 0xFA, 0x00, 0x00,
+    0x9C, 0xFA, 0x00, 0x03, 0x7E, 0x00, 0x00, 0xFC, 0xFB, 0xFF, 0x00, 0x01, 0xE8, 0x00, 0x00, 0xF8,
+    0xFE, 0xFF, 0x00, 0xDF, 0xFE, 0x00, 0x00, 0xC8, 0xFE, 0x00, 0x00, 0xD8, 0xFE, 0x00, 0x00, 0xC8,
+    0xFE, 0x00, 0x00, 0xD8, 0xFE, 0x00, 0x00, 0xC8, 0xFE, 0x00, 0x00, 0xD8, 0xFE, 0x00, 0x00, 0xF8,
+    0xFE, 0xFF, 0x02, 0xDF, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xD0, 0x08, 0xC0, 0xFE, 0xFF, 0x02, 0x02,
+    0xD0, 0x08, 0xFE, 0x00, 0x03, 0xF6, 0x01, 0xD0, 0x08, 0xFE, 0x00, 0x2F, 0xC9, 0x00, 0xD0, 0x08,
+    0x00, 0x00, 0x10, 0x7E, 0x00, 0xD0, 0x08, 0x00, 0x00, 0x70, 0x1E, 0x00, 0xD0, 0x08, 0x00, 0x00,
+    0xE2, 0x07, 0x00, 0xD0, 0x08, 0x00, 0x20, 0xCD, 0x00, 0x00, 0xD0, 0x08, 0x00, 0xD3, 0x1C, 0x00,
+    0x00, 0xD0, 0x08, 0x71, 0xBF, 0x01, 0x00, 0x00, 0xD0, 0x08, 0xC1, 0x06, 0xFE, 0x00, 0x01, 0xD0,
+    0x08, 0xFC, 0x00, 0x01, 0xD0, 0x08, 0xFC, 0x00, 0x01, 0xD0, 0x08, 0xFC, 0x00, 0x01, 0xD0, 0x08,
+    0xFC, 0x00, 0x08, 0xD7, 0x00, 0x00, 0xF4, 0xFF, 0xD8, 0xFF, 0x0B, 0xD7, 0xFE, 0x00, 0x04, 0xC0,
+    0x07, 0xA0, 0x0A, 0xD7, 0xFE, 0x00, 0x04, 0xD0, 0x06, 0xB0, 0x09, 0xD7, 0xFE, 0x00, 0x04, 0xF1,
+    0x03, 0xD0, 0x07, 0xD7, 0xFE, 0x00, 0x04, 0xE5, 0x00, 0xF1, 0x03, 0xD7, 0xFE, 0x00, 0x1C, 0x8C,
+    0x00, 0xE6, 0x00, 0xF7, 0xFF, 0x04, 0x60, 0x1E, 0x00, 0x9C, 0x00, 0xD7, 0x00, 0x00, 0xF5, 0x06,
+    0x50, 0x2F, 0x00, 0xD7, 0x00, 0x00, 0x75, 0x00, 0xE1, 0x09, 0x00, 0xD7, 0xFD, 0x00, 0x03, 0xD9,
+    0x01, 0x00, 0xD7, 0xFD, 0x00, 0x03, 0x10, 0x00, 0x00, 0xD7, 0xFA, 0x00, 0x00, 0xD7, 0xFA, 0x00,
+    0x02, 0xD7, 0x00, 0x00, 0xFC, 0x00, 0x4E, 0xB0, 0x0A, 0xF2, 0xFF, 0xAA, 0xFF, 0x0E, 0xB0, 0x0A,
+    0x00, 0xA0, 0x09, 0x80, 0x0D, 0xB0, 0x0A, 0x00, 0xB0, 0x08, 0x90, 0x0B, 0xB0, 0x0A, 0x00, 0xE0,
+    0x05, 0xA0, 0x0A, 0xB0, 0x0A, 0x00, 0xF3, 0x01, 0xE0, 0xF6, 0xFF, 0x0A, 0x00, 0xAA, 0x00, 0xF3,
+    0x02, 0xB0, 0x0A, 0x40, 0x3F, 0x00, 0xBA, 0x00, 0xB0, 0x0A, 0xE3, 0x08, 0x30, 0x4F, 0x00, 0xB0,
+    0x0A, 0x84, 0x00, 0xC0, 0x0B, 0x00, 0xB0, 0x0A, 0x00, 0x00, 0xE6, 0x02, 0x00, 0xB0, 0x0A, 0x00,
+    0x00, 0x20, 0x00, 0x00, 0xB0, 0x0A, 0xFC, 0x00, 0x01, 0xB0, 0x0A, 0xFC, 0x00, 0x01, 0xB0, 0x0A,
+    0x00, 0x7F, 0xFE, 0x00, 0x03, 0x80, 0x0C, 0x00, 0x7F, 0xFE, 0x00, 0x03, 0x80, 0x0C, 0x00, 0x7F,
+    0xFE, 0x00, 0x03, 0x80, 0x0C, 0x00, 0x7F, 0xFE, 0x00, 0x0F, 0x80, 0xFF, 0x2F, 0x7F, 0x00, 0x10,
+    0x53, 0x84, 0x0C, 0x00, 0xFF, 0xFF, 0xEF, 0xAC, 0x85, 0x0C, 0xFC, 0x00, 0x01, 0x80, 0x0C, 0xFC,
+    0x00, 0x03, 0x20, 0x03, 0x00, 0x40, 0xFD, 0xFF, 0x00, 0x0C, 0xFC, 0x00, 0x03, 0x80, 0x0C, 0x00,
+    0x40, 0xFD, 0xFF, 0x03, 0x0C, 0x00, 0x40, 0x1F, 0xFC, 0x00, 0x01, 0x40, 0x1F, 0xFC, 0x00, 0x00,
+    0x40, 0xFD, 0xFF, 0x01, 0x2F, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x03, 0x80, 0x0C, 0x00, 0x7F, 0xFE,
+    0x00, 0x03, 0x80, 0x0C, 0x00, 0x7F, 0xFE, 0x00, 0x03, 0x80, 0x0C, 0x00, 0x7F, 0xFE, 0x00, 0x03,
+    0x80, 0xBE, 0x1B, 0x7F, 0xFE, 0x00, 0x0F, 0x80, 0x4D, 0x04, 0x7F, 0x00, 0x20, 0x63, 0x85, 0x0C,
+    0x00, 0xFF, 0xFF, 0xDE, 0xAC, 0x84, 0x0C, 0xFC, 0x00, 0x01, 0x60, 0x08, 0xF9, 0x00, 0x00, 0x20,
+    0xFD, 0xFF, 0x17, 0x0C, 0x00, 0x20, 0x3F, 0x00, 0x00, 0x80, 0x0C, 0x00, 0x20, 0x3F, 0x00, 0x00,
+    0x80, 0x0C, 0x00, 0x20, 0x3F, 0x00, 0x00, 0x80, 0x0C, 0x00, 0x20, 0xFD, 0xFF, 0x01, 0x0C, 0x00,
+    0xFC, 0x00, 0x01, 0x8D, 0xBB, 0xFD, 0x00, 0x01, 0x8D, 0xBB, 0xFD, 0x00, 0x01, 0x8D, 0xBB, 0xFD,
+    0x00, 0x07, 0x8D, 0xBB, 0x00, 0x40, 0xFF, 0xFF, 0x8F, 0xBB, 0xFD, 0x00, 0x01, 0x8D, 0xBB, 0xFD,
+    0x00, 0x01, 0x8D, 0xBB, 0xFD, 0x00, 0x0C, 0x8D, 0xBB, 0x00, 0x10, 0x53, 0x06, 0x8D, 0xFB, 0xFF,
+    0xEF, 0xBD, 0x06, 0x8D, 0xFC, 0x00, 0x00, 0x8D, 0xFC, 0x00, 0x00, 0x8D, 0xFC, 0x00, 0x00, 0x8D,
+    0xFC, 0x00, 0x00, 0x8D, 0xFD, 0x00, 0x00, 0x36, 0xFB, 0x00, 0x41, 0x7D, 0xA0, 0x0B, 0xF0, 0x06,
+    0x00, 0x00, 0x7D, 0xA0, 0x0B, 0xF0, 0x06, 0x00, 0x00, 0x7D, 0xA0, 0x0B, 0xF0, 0x06, 0x00, 0x00,
+    0x7D, 0xA0, 0x0B, 0xF0, 0x06, 0xF1, 0xFF, 0x7F, 0xA0, 0x0B, 0xF0, 0x06, 0x00, 0x00, 0x7D, 0xA0,
+    0x0B, 0xF0, 0x06, 0x00, 0x00, 0x7D, 0xA0, 0x0B, 0xF0, 0x06, 0x00, 0x00, 0x7D, 0xA0, 0x0B, 0xF0,
+    0x16, 0x32, 0x16, 0x7D, 0xA0, 0x0B, 0xF0, 0xFF, 0xCE, 0x1A, 0x7D, 0xA0, 0x0B, 0xFD, 0x00, 0x02,
+    0x7D, 0xA0, 0x0B, 0xFD, 0x00, 0x02, 0x7D, 0xA0, 0x0B, 0xFD, 0x00, 0x02, 0x7D, 0xA0, 0x0B, 0xFD,
+    0x00, 0x02, 0x7D, 0xA0, 0x0B, 0x01, 0x00, 0xF6, 0xFA, 0x00, 0x00, 0xF6, 0xFA, 0x00, 0x00, 0xF6,
+    0xFA, 0x00, 0x00, 0xF6, 0xFD, 0xFF, 0xFC, 0x00, 0x00, 0xC9, 0xFA, 0x00, 0x00, 0xC9, 0xFD, 0x00,
+    0x00, 0xFC, 0xFB, 0xFF, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xFE, 0xFD, 0xFF, 0x07, 0x02, 0x00, 0x00,
+    0x50, 0x1F, 0x00, 0xC0, 0x09, 0xFE, 0x00, 0x04, 0x40, 0x1F, 0x00, 0xC0, 0x09, 0xFE, 0x00, 0x07,
+    0x40, 0x1F, 0x00, 0xC0, 0x09, 0x00, 0x00, 0x20, 0xFC, 0xFF, 0x01, 0x06, 0x00, 0x01, 0x00, 0xE8,
+    0xFA, 0x00, 0x00, 0xE8, 0xFA, 0x00, 0x00, 0xE8, 0xFA, 0x00, 0x00, 0xE8, 0xFA, 0x00, 0x00, 0xF8,
+    0xFD, 0xFF, 0xEF, 0x00, 0x00, 0xFC, 0xFB, 0xFF, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x43, 0xFA, 0x00,
+    0x00, 0xC8, 0xFA, 0x00, 0x00, 0xC8, 0xFA, 0x00, 0x00, 0xC8, 0xFA, 0x00, 0x00, 0xF8, 0xFD, 0xFF,
+    0x01, 0x02, 0x00, 0xFC, 0x00, 0x01, 0x8D, 0xBB, 0xFD, 0x00, 0x01, 0x8D, 0xBB, 0xFD, 0x00, 0x01,
+    0x8D, 0xBB, 0xFD, 0x00, 0x01, 0x8D, 0xBB, 0xFD, 0x00, 0x01, 0x8D, 0xBB, 0xFD, 0x00, 0x01, 0x8D,
+    0xBB, 0xFD, 0x00, 0x01, 0x8D, 0xBB, 0xFD, 0x00, 0x0C, 0x8D, 0xBB, 0x00, 0x10, 0x42, 0x27, 0x8D,
+    0xFB, 0xFF, 0xEF, 0xBD, 0x29, 0x8D, 0xFC, 0x00, 0x00, 0x8D, 0xFC, 0x00, 0x00, 0x8D, 0xFC, 0x00,
+    0x00, 0x8D, 0xFC, 0x00, 0x00, 0x8D, 0xFD, 0x00, 0x0A, 0xA0, 0x0B, 0x00, 0xFD, 0xFF, 0xFF, 0x0D,
+    0xA0, 0x0B, 0x00, 0x8D, 0xFE, 0x00, 0x03, 0xA0, 0x0B, 0x00, 0x8D, 0xFE, 0x00, 0x03, 0xA0, 0x0B,
+    0x00, 0x8D, 0xFE, 0x00, 0x03, 0xA0, 0x0B, 0x00, 0x8D, 0xFE, 0x00, 0x03, 0xA0, 0xFF, 0x4F, 0x8D,
+    0xFE, 0x00, 0x03, 0xA0, 0x0B, 0x00, 0x8D, 0xFE, 0x00, 0x0F, 0xA0, 0x0B, 0x00, 0x8D, 0x00, 0x21,
+    0x74, 0xA2, 0x0B, 0x00, 0xFD, 0xFF, 0xDE, 0x9B, 0xA2, 0x0B, 0xFC, 0x00, 0x01, 0xA0, 0x0B, 0xFC,
+    0x00, 0x01, 0xA0, 0x0B, 0xFC, 0x00, 0x01, 0xA0, 0x0B, 0xFC, 0x00, 0x02, 0xA0, 0x0B, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0x05, 0xBA, 0xFF, 0xFF, 0x2F, 0xF0, 0x05, 0xBA, 0x6F, 0x00, 0x00, 0xF0, 0x05,
+    0xBA, 0x6F, 0x00, 0x00, 0xF0, 0x05, 0xBA, 0x6F, 0x00, 0x00, 0xF0, 0x05, 0xBA, 0x6F, 0x00, 0x00,
+    0xF0, 0xFF, 0xBF, 0x6F, 0x00, 0x00, 0xF0, 0x05, 0xBA, 0x6F, 0x00, 0x00, 0xF0, 0x05, 0xBA, 0x6F,
+    0x21, 0x63, 0xF2, 0x05, 0xBA, 0xFF, 0xEF, 0xAC, 0xF2, 0x05, 0xBA, 0x00, 0x00, 0x00, 0xF0, 0x05,
+    0xBA, 0x00, 0x00, 0x00, 0xF0, 0x05, 0xBA, 0x00, 0x00, 0x00, 0xF0, 0x05, 0xBA, 0x00, 0x00, 0x00,
+    0xF0, 0x05, 0xBA, 0x00, 0x00, 0x00, 0xB0, 0x09, 0xBA, 0xFF, 0xFF, 0x4F, 0xB0, 0x09, 0xBA, 0x6F,
+    0x00, 0x00, 0xB0, 0x09, 0xBA, 0x6F, 0x00, 0x00, 0xB0, 0x09, 0xBA, 0x6F, 0x00, 0x00, 0xB0, 0x09,
+    0xBA, 0x6F, 0x00, 0xFC, 0xFF, 0x09, 0xBA, 0x6F, 0x00, 0x00, 0xB0, 0x09, 0xBA, 0x6F, 0x00, 0x00,
+    0xB0, 0x09, 0xBA, 0x6F, 0x21, 0x63, 0xB2, 0x09, 0xBA, 0xFF, 0xEF, 0xAC, 0xB3, 0x09, 0xBA, 0x00,
+    0x00, 0x00, 0xB0, 0x09, 0xBA, 0x00, 0x00, 0x00, 0xB0, 0x09, 0xBA, 0x00, 0x00, 0x00, 0xB0, 0x09,
+    0xBA, 0x00, 0x00, 0x00, 0xB0, 0x09, 0xBA, 0x01, 0x00, 0xF6, 0xFE, 0xFF, 0x03, 0xBF, 0x00, 0x00,
+    0xF6, 0xFB, 0x00, 0x00, 0xF6, 0xFB, 0x00, 0x00, 0xF6, 0xFB, 0x00, 0x00, 0xF6, 0xFB, 0x00, 0x00,
+    0xF6, 0xFB, 0x00, 0x00, 0xF6, 0xFE, 0xFF, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0xE7, 0xFB, 0x00, 0x00,
+    0xE7, 0xFB, 0x00, 0x00, 0xE7, 0xFE, 0x00, 0x00, 0xFA, 0xFC, 0xFF, 0x00, 0xEF, 0x01, 0x00, 0xF8,
+    0xFE, 0xFF, 0x00, 0xCF, 0xFE, 0x00, 0x00, 0xD8, 0xFA, 0x00, 0x00, 0xD8, 0xFA, 0x00, 0x00, 0xD8,
+    0xFA, 0x00, 0x00, 0xF8, 0xFD, 0xFF, 0xFC, 0x00, 0x00, 0xC9, 0xFA, 0x00, 0x00, 0xC9, 0xFD, 0x00,
+    0x00, 0xFD, 0xFB, 0xFF, 0x00, 0x01, 0xF8, 0x00, 0x04, 0x50, 0xDB, 0xFF, 0xCE, 0x07, 0xFE, 0x00,
+    0x04, 0xF8, 0x27, 0x00, 0x52, 0xBD, 0xFE, 0x00, 0x00, 0xBD, 0xFE, 0x00, 0x08, 0xF7, 0x01, 0x00,
+    0x00, 0xF8, 0x27, 0x00, 0x51, 0xBE, 0xFE, 0x00, 0x06, 0x50, 0xDA, 0xFF, 0xBE, 0x07, 0x00, 0x00,
+    0xFC, 0x00, 0x02, 0x80, 0x0D, 0x20, 0xFE, 0xFF, 0x04, 0x2F, 0x80, 0x0D, 0x20, 0x4F, 0xFE, 0x00,
+    0x03, 0x80, 0x0D, 0x20, 0x4F, 0xFE, 0x00, 0x03, 0x80, 0x0D, 0x20, 0x4F, 0xFE, 0x00, 0x03, 0x80,
+    0x0D, 0x20, 0x4F, 0xFE, 0x00, 0x02, 0x80, 0x0D, 0x20, 0xFE, 0xFF, 0x1E, 0x3F, 0x80, 0x0D, 0x00,
+    0x00, 0xF1, 0x05, 0x00, 0x80, 0x0D, 0x00, 0x00, 0xF1, 0x05, 0x00, 0x80, 0x0D, 0x00, 0x00, 0xF1,
+    0x15, 0x32, 0x83, 0x0D, 0xF6, 0xFF, 0xFF, 0xEF, 0xCD, 0x88, 0x0D, 0xFC, 0x00, 0x01, 0x80, 0x0D,
+    0xFC, 0x00, 0x01, 0x80, 0x0D, 0xFC, 0x00, 0x01, 0x80, 0x0D, 0x01, 0x00, 0xF6, 0xFE, 0xFF, 0x03,
+    0xBF, 0x00, 0x00, 0xF6, 0xFB, 0x00, 0x00, 0xF6, 0xFB, 0x00, 0x00, 0xF6, 0xFB, 0x00, 0x00, 0xF6,
+    0xFB, 0x00, 0x00, 0xF6, 0xFB, 0x00, 0x00, 0xF6, 0xFE, 0xFF, 0x00, 0xDF, 0xEB, 0x00, 0x00, 0xFA,
+    0xFC, 0xFF, 0x00, 0xEF, 0xFC, 0x00, 0x07, 0x8D, 0xFA, 0xFF, 0xFF, 0x0F, 0x00, 0x8D, 0xBA, 0xFD,
+    0x00, 0x01, 0x8D, 0xBA, 0xFD, 0x00, 0x01, 0x8D, 0xBA, 0xFD, 0x00, 0x01, 0x8D, 0xBA, 0xFD, 0x00,
+    0x01, 0x8D, 0xBA, 0xFD, 0x00, 0x01, 0x8D, 0xBA, 0xFD, 0x00, 0x0C, 0x8D, 0xBA, 0x00, 0x10, 0x52,
+    0x17, 0x8D, 0xFA, 0xFF, 0xEF, 0xBD, 0x19, 0x8D, 0xFC, 0x00, 0x00, 0x8D, 0xFC, 0x00, 0x00, 0x8D,
+    0xFC, 0x00, 0x00, 0x8D, 0xFC, 0x00, 0x00, 0x8D, 0x05, 0xF1, 0xFF, 0xFF, 0x6F, 0x00, 0xA7, 0xFC,
+    0x00, 0x02, 0x6F, 0x00, 0xC8, 0xFC, 0x00, 0x0E, 0x6F, 0x00, 0xF8, 0xFF, 0x01, 0xF0, 0xFF, 0xFF,
+    0x6F, 0x00, 0xC8, 0x00, 0x00, 0xF0, 0x06, 0xFE, 0x00, 0x10, 0xC8, 0x00, 0x00, 0xF0, 0x06, 0x10,
+    0x32, 0x55, 0xF8, 0xFF, 0x01, 0xF0, 0xFF, 0xEF, 0xCD, 0x6A, 0xC8, 0xFA, 0x00, 0x00, 0xC8, 0xFA,
+    0x00, 0x00, 0xA7, 0xFE, 0x00, 0x04, 0x30, 0xD9, 0xFF, 0xBE, 0x06, 0xFE, 0x00, 0x04, 0xF3, 0x3A,
+    0x01, 0x62, 0x9E, 0xFE, 0x00, 0x00, 0xF7, 0xFE, 0x00, 0x00, 0xE8, 0xFE, 0x00, 0x04, 0xE3, 0x39,
+    0x01, 0x62, 0x9E, 0xFE, 0x00, 0x06, 0x20, 0xD9, 0xFF, 0xBE, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x0C, 0xBA, 0xFE, 0xFF, 0x0C, 0x80, 0x0C, 0xBA, 0x00, 0x80, 0x0C, 0x80, 0x0C, 0xBA, 0x00,
+    0x80, 0x0C, 0x80, 0x0C, 0xBA, 0x00, 0x80, 0x0C, 0x80, 0x0C, 0xBA, 0xFE, 0xFF, 0x5C, 0xFF, 0x0C,
+    0xBA, 0x7E, 0x00, 0x00, 0x80, 0x0C, 0xBA, 0x7E, 0x00, 0x00, 0x80, 0x0C, 0xBA, 0x7E, 0x00, 0x00,
+    0x80, 0x0C, 0xBA, 0x7E, 0x10, 0x53, 0x84, 0x0C, 0xBA, 0xFE, 0xEF, 0xBD, 0x84, 0x0C, 0xBA, 0x00,
+    0x00, 0x00, 0x80, 0x0C, 0xBA, 0x00, 0x00, 0x00, 0x80, 0x0C, 0xBA, 0x00, 0x00, 0x00, 0x80, 0x0C,
+    0xBA, 0x2F, 0xFE, 0xFF, 0xFF, 0x05, 0x00, 0x8D, 0x00, 0x00, 0xF1, 0x05, 0x00, 0x8D, 0x00, 0x00,
+    0xF1, 0x55, 0xFF, 0x8F, 0xFD, 0xFF, 0xFF, 0x05, 0x00, 0x8D, 0x8D, 0x00, 0x00, 0x40, 0xBB, 0x8F,
+    0x8D, 0x00, 0x00, 0x10, 0x44, 0x8E, 0x8D, 0x00, 0x21, 0x63, 0x05, 0x8D, 0xFD, 0xFF, 0xDE, 0xAC,
+    0x05, 0x8D, 0xFC, 0x00, 0x02, 0x47, 0x00, 0x65, 0xFE, 0x66, 0x01, 0x36, 0x00, 0xFD, 0x99, 0x00,
+    0x8E, 0xFC, 0x00, 0x00, 0x8D, 0xFC, 0x00, 0x00, 0x8D, 0xFC, 0x00, 0x00, 0x8D, 0xFC, 0x00, 0x00,
+    0x35, 0x18, 0xFE, 0xFF, 0xFF, 0x05, 0x00, 0x8D, 0x00, 0x00, 0xF0, 0x05, 0x00, 0x8D, 0x00, 0x00,
+    0xF0, 0x55, 0xFF, 0x8F, 0xFD, 0xFF, 0xFF, 0x05, 0x00, 0x8D, 0x8D, 0xFD, 0x00, 0x12, 0x8D, 0x8D,
+    0x00, 0x00, 0x50, 0xFF, 0x8F, 0x8D, 0x00, 0x21, 0x64, 0x03, 0x8D, 0xFD, 0xEF, 0xDE, 0x9C, 0x03,
+    0x8D, 0xFC, 0x00, 0x00, 0x8D, 0xFC, 0x00, 0x02, 0x8D, 0x00, 0x87, 0xFE, 0x00, 0x02, 0x48, 0x00,
+    0xC9, 0xFC, 0x00, 0x00, 0xC9, 0xFC, 0x00, 0x00, 0xF9, 0xFE, 0xFF, 0x00, 0xCF, 0x01, 0x00, 0xF7,
+    0xFE, 0xFF, 0x00, 0xBF, 0xFB, 0x00, 0x00, 0xBA, 0xFB, 0x00, 0x03, 0xBA, 0x00, 0x00, 0xF6, 0xFE,
+    0xFF, 0x03, 0xBF, 0x00, 0x00, 0xE6, 0xFB, 0x00, 0x00, 0xE6, 0xFB, 0x00, 0x00, 0xE6, 0xFB, 0x00,
+    0x00, 0xF6, 0xFD, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xD9, 0xFB, 0x00, 0x00, 0xD9, 0xFE, 0x00,
+    0x00, 0xFA, 0xFC, 0xFF, 0x00, 0xEF, 0x01, 0x00, 0xF6, 0xFE, 0xFF, 0x00, 0xDF, 0xFB, 0x00, 0x00,
+    0xD8, 0xFB, 0x00, 0x03, 0xD8, 0x00, 0x00, 0xF6, 0xFE, 0xFF, 0x03, 0xDF, 0x00, 0x00, 0xF6, 0xFB,
+    0x00, 0x00, 0xF6, 0xFB, 0x00, 0x00, 0xF6, 0xFD, 0xFF, 0x00, 0x05, 0xF3, 0x00, 0x00, 0xFA, 0xFC,
+    0xFF, 0x06, 0xEF, 0x00, 0x00, 0x8D, 0x00, 0xD0, 0x08, 0xFE, 0x00, 0x03, 0x8D, 0x00, 0xD0, 0x08,
+    0xFE, 0x00, 0x03, 0x8D, 0x00, 0xD0, 0x08, 0xFE, 0x00, 0x03, 0x8D, 0x00, 0xD0, 0x08, 0xFE, 0x00,
+    0x04, 0x35, 0x00, 0x50, 0x03, 0x00, 0x01, 0x00, 0xF9, 0xFE, 0xFF, 0x00, 0xBF, 0xFA, 0x00, 0x00,
+    0xB9, 0xFE, 0x00, 0x00, 0xF9, 0xFE, 0xFF, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0xC9, 0xFA, 0x00, 0x00,
+    0xF9, 0xFD, 0xFF, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xFC, 0xFB, 0xFF, 0x00, 0x01, 0xF8, 0x00, 0x00,
+    0xFA, 0xFE, 0xFF, 0x00, 0xEF, 0xFA, 0x00, 0x00, 0xE7, 0xFE, 0x00, 0x00, 0xFA, 0xFE, 0xFF, 0x00,
+    0xEF, 0xFE, 0x00, 0x00, 0xBA, 0xFA, 0x00, 0x00, 0xBA, 0xFA, 0x00, 0x00, 0xFA, 0xFD, 0xFF, 0x01,
+    0x04, 0x00, 0x01, 0x00, 0xF8, 0xFE, 0xFF, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0xAA, 0xFE, 0x00, 0x00,
+    0xF8, 0xFE, 0xFF, 0x00, 0xAF, 0xFE, 0x00, 0x00, 0xD8, 0xFA, 0x00, 0x00, 0xD8, 0xFA, 0x00, 0x00,
+    0xF8, 0xFD, 0xFF, 0xF7, 0x00, 0x00, 0xFC, 0xFB, 0xFF, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF8, 0xFE,
+    0xFF, 0x00, 0xDF, 0xFE, 0x00, 0x00, 0xC8, 0xFE, 0x00, 0x00, 0xD8, 0xFE, 0x00, 0x00, 0xC8, 0xFE,
+    0x00, 0x00, 0xD8, 0xFE, 0x00, 0x00, 0xF8, 0xFE, 0xFF, 0x02, 0xDF, 0x00, 0x00, 0xFC, 0x00, 0x1F,
+    0x8D, 0xFC, 0xFF, 0xFF, 0x09, 0x00, 0x8D, 0x00, 0x00, 0xC0, 0x09, 0x00, 0x8D, 0x00, 0x00, 0xC0,
+    0x09, 0x00, 0x8D, 0x00, 0x00, 0xC0, 0x09, 0x00, 0x8D, 0xFC, 0xFF, 0xFF, 0x09, 0x00, 0x8D, 0x9C,
+    0xFD, 0x00, 0x01, 0x8D, 0x9C, 0xFD, 0x00, 0x01, 0x8D, 0x9C, 0xFD, 0x00, 0x0C, 0x8D, 0x9C, 0x00,
+    0x10, 0x42, 0x17, 0x8D, 0xFC, 0xFF, 0xEF, 0xBD, 0x19, 0x8D, 0xFC, 0x00, 0x00, 0x8D, 0xFC, 0x00,
+    0x00, 0x8D, 0xFC, 0x00, 0x00, 0x8D, 0xFC, 0x00, 0x19, 0x23, 0xFB, 0xFF, 0xFF, 0x0E, 0x00, 0x8D,
+    0x00, 0x00, 0x70, 0x0E, 0x00, 0x8D, 0x00, 0x00, 0x70, 0x0E, 0x00, 0x8D, 0xFB, 0xFF, 0xFF, 0x0E,
+    0x00, 0x8D, 0xAB, 0xFD, 0x00, 0x0C, 0x8D, 0xAB, 0x00, 0x10, 0x53, 0x28, 0x8D, 0xFB, 0xFF, 0xEE,
+    0xAC, 0x18, 0x8D, 0xFC, 0x00, 0x00, 0x8D, 0xFC, 0x00, 0x02, 0x24, 0x00, 0xF9, 0xFE, 0xFF, 0x02,
+    0x8F, 0x00, 0xB9, 0xFE, 0x00, 0x02, 0x8D, 0x00, 0xB9, 0xFE, 0x00, 0x02, 0x8D, 0x00, 0xB9, 0xFE,
+    0x00, 0x02, 0x8D, 0x00, 0xF9, 0xFE, 0xFF, 0x00, 0x8F, 0x2F, 0xFC, 0xFF, 0xFF, 0x0E, 0x00, 0x8D,
+    0x9C, 0x00, 0x50, 0x0E, 0x00, 0x8D, 0x9C, 0x00, 0x50, 0xFF, 0xFF, 0x8F, 0x9C, 0x00, 0x50, 0x0E,
+    0x00, 0x8D, 0x9C, 0x00, 0x50, 0x0E, 0x00, 0x8D, 0x9C, 0x00, 0x50, 0xFF, 0xFF, 0x8F, 0x9C, 0x00,
+    0x50, 0x0E, 0x00, 0x8D, 0xFC, 0xFF, 0xFF, 0x0E, 0x00, 0x8D, 0xFC, 0x00, 0x02, 0x8D, 0x00, 0xC9,
+    0xFE, 0x00, 0x02, 0x8D, 0x00, 0xC9, 0xFE, 0x00, 0x02, 0x11, 0x00, 0xC9, 0xFC, 0x00, 0x00, 0xC9,
+    0xFC, 0x00, 0x00, 0xF9, 0xFE, 0xFF, 0x00, 0xCF, 0x01, 0x00, 0xF7, 0xFE, 0xFF, 0x03, 0xCF, 0x00,
+    0x00, 0xE7, 0xFE, 0x00, 0x03, 0xC9, 0x00, 0x00, 0xE7, 0xFE, 0x00, 0x03, 0xC9, 0x00, 0x00, 0xE7,
+    0xFE, 0x00, 0x03, 0xC9, 0x00, 0x00, 0xE7, 0xFE, 0x00, 0x03, 0xC9, 0x00, 0x00, 0xE7, 0xFE, 0x00,
+    0x03, 0xC9, 0x00, 0x00, 0xF7, 0xFE, 0xFF, 0x00, 0xCF, 0xFD, 0x00, 0x00, 0xD9, 0xFB, 0x00, 0x00,
+    0xD9, 0xFB, 0x00, 0x00, 0xD9, 0xFE, 0x00, 0x00, 0xFA, 0xFC, 0xFF, 0x00, 0xEF, 0x01, 0x00, 0xB5,
+    0xFE, 0xBB, 0x03, 0xAB, 0x00, 0x00, 0xF6, 0xFE, 0x44, 0x03, 0xD9, 0x00, 0x00, 0xF6, 0xFE, 0x00,
+    0x03, 0xD8, 0x00, 0x00, 0xF6, 0xFE, 0x00, 0x03, 0xD8, 0x00, 0x00, 0xF6, 0xFE, 0x00, 0x03, 0xD8,
+    0x00, 0x00, 0xF6, 0xFE, 0xFF, 0x00, 0xDF, 0xF2, 0x00, 0x00, 0xFA, 0xFC, 0xFF, 0x00, 0xEF, 0xFE,
+    0x00, 0x00, 0xF6, 0xFB, 0x00, 0x00, 0xF6, 0xFB, 0x00, 0x00, 0xF6, 0xFB, 0x00, 0x00, 0xF6, 0xFB,
+    0x00, 0x00, 0xF6, 0xFE, 0x00, 0x23, 0xFB, 0xFF, 0xFF, 0x0E, 0x00, 0x8D, 0xAB, 0x00, 0x60, 0x0E,
+    0x00, 0x8D, 0xAB, 0x00, 0x60, 0x0E, 0x00, 0x8D, 0xAB, 0x00, 0x60, 0x0E, 0x00, 0x8D, 0xAB, 0x00,
+    0x60, 0x0E, 0x00, 0x8D, 0xFB, 0xFF, 0xFF, 0x0E, 0x00, 0x8D, 0xFC, 0x00, 0x00, 0x19, 0xFA, 0x00,
+    0x00, 0xFA, 0xFE, 0xFF, 0x00, 0x8F, 0xFC, 0x00, 0x02, 0x8D, 0x00, 0xFA, 0xFE, 0xFF, 0x02, 0x8F,
+    0x00, 0xAA, 0xFC, 0x00, 0x00, 0xAA, 0xFC, 0x00, 0x00, 0xFA, 0xFE, 0xFF, 0x00, 0xCF, 0x28, 0xFB,
+    0xFF, 0xFF, 0x0E, 0x00, 0x8D, 0x00, 0xAB, 0x00, 0x60, 0x0E, 0x00, 0x8D, 0x00, 0xAB, 0x00, 0x60,
+    0x0E, 0x00, 0x8D, 0x00, 0xAB, 0x00, 0x60, 0x0E, 0x00, 0x8D, 0x00, 0xAB, 0x00, 0x60, 0x0E, 0x00,
+    0x8D, 0x00, 0xFB, 0xFF, 0xFF, 0x0E, 0x00, 0x8D, 0xFB, 0x00, 0x00, 0x8D, 0xFE, 0x00, 0x03, 0xF9,
+    0xFF, 0x0E, 0x7C, 0xF8, 0x00, 0x00, 0xF7, 0xFE, 0xFF, 0x00, 0x0C, 0xFD, 0x00, 0x02, 0x10, 0xDA,
+    0x02, 0xFE, 0x00, 0x12, 0x10, 0xE7, 0x1C, 0x00, 0x00, 0x10, 0x74, 0xBB, 0x34, 0xDA, 0x48, 0x01,
+    0x50, 0x8D, 0x03, 0x00, 0x20, 0xC7, 0x05, 0x35, 0x20, 0x01, 0x00, 0x11, 0x00, 0x11, 0x00, 0x00,
+    0xF1, 0x05, 0x00, 0xAB, 0x00, 0xC8, 0x00, 0x00, 0xF1, 0x05, 0x00, 0xAB, 0x00, 0xC8, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0xAF, 0x00, 0xC8, 0x00, 0x00, 0xF1, 0x05, 0x00, 0xAB, 0x00, 0xF8, 0xFF, 0x02,
+    0xF1, 0x05, 0x00, 0xAB, 0x00, 0xC8, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xAF, 0x00, 0xC8, 0xFA, 0x00,
+    0x00, 0xC8, 0xFA, 0x00, 0x00, 0x10, 0xFE, 0x00, 0x00, 0xF4, 0xFE, 0xFF, 0x00, 0xCF, 0xFA, 0x00,
+    0x00, 0xC8, 0xFE, 0x00, 0x00, 0xF4, 0xFE, 0xFF, 0x00, 0xCF, 0xFE, 0x00, 0x01, 0xF4, 0x01, 0xFB,
+    0x00, 0x01, 0xF4, 0x01, 0xFB, 0x00, 0x00, 0xF4, 0xFD, 0xFF, 0x01, 0x02, 0x00, 0x03, 0x10, 0x00,
+    0x00, 0x11, 0xFD, 0x00, 0x2D, 0xF1, 0x05, 0x00, 0xAB, 0x00, 0xC8, 0x00, 0x00, 0xF1, 0x05, 0x00,
+    0xAB, 0x00, 0xC8, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xAF, 0x00, 0xC8, 0x00, 0x00, 0xF1, 0x05, 0x00,
+    0xAB, 0x00, 0xF8, 0xFF, 0x02, 0xF1, 0x05, 0x00, 0xAB, 0x00, 0xC8, 0x00, 0x00, 0xF1, 0xFF, 0xFF,
+    0xAF, 0x00, 0xC8, 0xFA, 0x00, 0x00, 0xC8, 0xF6, 0x00, 0x04, 0xFC, 0xFF, 0x7E, 0xFF, 0xCF, 0xFD,
+    0x00, 0x03, 0x70, 0x0E, 0x00, 0xC8, 0xFE, 0x00, 0x04, 0xFC, 0xFF, 0x0E, 0x00, 0xC8, 0xFE, 0x00,
+    0x00, 0x8C, 0xFE, 0x00, 0x00, 0xC8, 0xFE, 0x00, 0x04, 0x8C, 0x00, 0x31, 0x00, 0xC8, 0xFE, 0x00,
+    0x04, 0xFC, 0xFF, 0xCE, 0x00, 0xC8, 0xFA, 0x00, 0x02, 0x64, 0x00, 0x00, 0x3D, 0x60, 0x02, 0x00,
+    0x45, 0x00, 0x32, 0x00, 0x00, 0xF1, 0x05, 0x00, 0xAB, 0x00, 0xC8, 0x00, 0x00, 0xF1, 0x05, 0x00,
+    0xAB, 0x00, 0xC8, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xAF, 0x00, 0xC8, 0x00, 0x00, 0xF1, 0x05, 0x00,
+    0xAB, 0x00, 0xF8, 0xFF, 0x02, 0xF1, 0x05, 0x00, 0xAB, 0x00, 0xC8, 0x00, 0x00, 0xF1, 0x05, 0x00,
+    0xAB, 0x00, 0xC8, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xAF, 0x00, 0xC8, 0xFA, 0x00, 0x00, 0xC8, 0xFA,
+    0x00, 0x00, 0x85, 0xFE, 0x00, 0x04, 0x20, 0xD9, 0xFE, 0xBE, 0x07, 0xFE, 0x00, 0x04, 0xE3, 0x3A,
+    0x01, 0x52, 0xBE, 0xFE, 0x00, 0x0C, 0xF7, 0x01, 0x00, 0x00, 0xF7, 0x01, 0x00, 0x00, 0xE2, 0x3A,
+    0x01, 0x51, 0xBD, 0xFE, 0x00, 0x06, 0x20, 0xD9, 0xFF, 0xCE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xC0, 0x08, 0xBA, 0x6E, 0x00, 0x8C, 0xC0, 0x08, 0xBA, 0x6E, 0x00, 0x8C, 0xC0, 0x08, 0xBA, 0x6E,
+    0x00, 0x8C, 0xC0, 0x08, 0xBA, 0xFE, 0xFF, 0x8F, 0xC0, 0x08, 0xBA, 0x6E, 0x00, 0x8C, 0xC0, 0xFF,
+    0xBF, 0x6E, 0x00, 0x8C, 0xC0, 0x08, 0xBA, 0x6E, 0x00, 0x8C, 0xC0, 0x08, 0xBA, 0x6E, 0x00, 0x8C,
+    0xC0, 0x08, 0xBA, 0xFE, 0xFF, 0x8F, 0xC0, 0x08, 0xBA, 0x00, 0x00, 0x00, 0xC0, 0x08, 0xBA, 0x00,
+    0x00, 0x00, 0xC0, 0x08, 0xBA, 0x00, 0x00, 0x00, 0xC0, 0x08, 0xBA, 0x00, 0x00, 0x00, 0xC0, 0x08,
+    0xBA, 0xFC, 0x00, 0x19, 0x8D, 0x57, 0x00, 0x60, 0x06, 0x00, 0x8D, 0x9C, 0x00, 0xA0, 0x0B, 0x00,
+    0x8D, 0x9C, 0x00, 0xA0, 0x0B, 0x00, 0x8D, 0x9C, 0x00, 0xA0, 0x0B, 0x00, 0x8D, 0xFC, 0xFD, 0xFF,
+    0x18, 0x8F, 0x9C, 0x00, 0xA0, 0x0B, 0x00, 0x8D, 0x9C, 0x00, 0xA0, 0x0B, 0x00, 0x8D, 0x9C, 0x00,
+    0xA0, 0x0B, 0x00, 0x8D, 0xFC, 0xFF, 0xFF, 0x0B, 0x00, 0x8D, 0xFC, 0x00, 0x00, 0x8D, 0xFC, 0x00,
+    0x00, 0x8D, 0xFC, 0x00, 0x00, 0x8D, 0xFC, 0x00, 0x00, 0x8D, 0xFC, 0x00, 0x00, 0x23, 0x2F, 0x57,
+    0x00, 0x30, 0x08, 0x00, 0x7D, 0x9C, 0x00, 0x50, 0x1F, 0x00, 0x8D, 0x9C, 0x00, 0x50, 0x1F, 0x00,
+    0x8D, 0xFC, 0xFF, 0xFF, 0x1F, 0x00, 0x8D, 0x9C, 0x00, 0x50, 0xFF, 0xFF, 0x8F, 0x9C, 0x00, 0x50,
+    0x1F, 0x00, 0x8D, 0x9C, 0x00, 0x50, 0x1F, 0x00, 0x8D, 0xFC, 0xFF, 0xFF, 0x1F, 0x00, 0x8D, 0xFC,
+    0x00, 0x02, 0x8D, 0x00, 0xC9, 0xFE, 0x00, 0x02, 0x8D, 0x00, 0xC9, 0xFE, 0x00, 0x02, 0x35, 0x00,
+    0xC9, 0xFC, 0x00, 0x00, 0xC9, 0xFC, 0x00, 0x00, 0xF9, 0xFE, 0xFF, 0x00, 0xCF, 0xFC, 0x00, 0x30,
+    0x35, 0x68, 0x00, 0x60, 0x0D, 0x00, 0x8D, 0x8C, 0x00, 0x70, 0x0E, 0x00, 0x8D, 0x8C, 0x00, 0x70,
+    0x9F, 0x99, 0x8E, 0xFC, 0xFF, 0xFF, 0x6E, 0x66, 0x8E, 0x8C, 0x00, 0x70, 0x0E, 0x00, 0x8D, 0x8C,
+    0x00, 0x70, 0xFF, 0xFF, 0x8F, 0x8C, 0x00, 0x70, 0x0E, 0x00, 0x8D, 0xFC, 0xFF, 0xFF, 0x0E, 0x00,
+    0x8D, 0xFC, 0x00, 0x00, 0x8D, 0xFC, 0x00, 0x02, 0x59, 0x00, 0xE7, 0xFC, 0x00, 0x00, 0xE7, 0xFC,
+    0x00, 0x00, 0xE7, 0xFC, 0x00, 0x00, 0xF7, 0xFE, 0xFF, 0x00, 0xCF, 0x01, 0x00, 0xB7, 0xFE, 0x00,
+    0x03, 0xA7, 0x00, 0x00, 0xD8, 0xFE, 0x00, 0x03, 0xC9, 0x00, 0x00, 0xE8, 0xFE, 0x66, 0x03, 0xCB,
+    0x00, 0x00, 0xE8, 0xFE, 0x99, 0x03, 0xCD, 0x00, 0x00, 0xD8, 0xFE, 0x00, 0x03, 0xC8, 0x00, 0x00,
+    0xD8, 0xFE, 0x00, 0x03, 0xC8, 0x00, 0x00, 0xD8, 0xFE, 0x00, 0x03, 0xC8, 0x00, 0x00, 0xF8, 0xFE,
+    0xFF, 0x00, 0xCF, 0xFD, 0x00, 0x00, 0xD9, 0xFB, 0x00, 0x00, 0xD9, 0xFE, 0x00, 0x00, 0xFA, 0xFC,
+    0xFF, 0x00, 0xEF, 0x01, 0x00, 0xE7, 0xFE, 0x00, 0x03, 0xE7, 0x00, 0x00, 0xE7, 0xFE, 0x00, 0x03,
+    0xE7, 0x00, 0x00, 0xF7, 0xFE, 0xFF, 0x03, 0xEF, 0x00, 0x00, 0xE7, 0xFE, 0x00, 0x03, 0xE7, 0x00,
+    0x00, 0xE7, 0xFE, 0x00, 0x03, 0xE7, 0x00, 0x00, 0xF7, 0xFE, 0xFF, 0x00, 0xEF, 0xF2, 0x00, 0x00,
+    0xFA, 0xFC, 0xFF, 0x00, 0xEF, 0xFE, 0x00, 0x00, 0xF6, 0xFB, 0x00, 0x00, 0xF6, 0xFB, 0x00, 0x00,
+    0xF6, 0xFB, 0x00, 0x00, 0xF6, 0xFB, 0x00, 0x00, 0xD6, 0xFE, 0x00, 0xFC, 0x00, 0x36, 0x8D, 0x67,
+    0x00, 0x30, 0x09, 0x00, 0x8D, 0xAC, 0x00, 0x50, 0x1F, 0x00, 0x8D, 0xAC, 0x00, 0x50, 0x1F, 0x00,
+    0x8D, 0xAC, 0x00, 0x50, 0x1F, 0x00, 0x8D, 0xFC, 0xFF, 0xFF, 0x1F, 0x00, 0x8D, 0x9C, 0x00, 0x40,
+    0x1F, 0x00, 0x8D, 0x9C, 0x00, 0x40, 0x1F, 0x00, 0x8D, 0x9C, 0x00, 0x40, 0x1F, 0x00, 0x8D, 0xFC,
+    0xFF, 0xFF, 0x1F, 0x00, 0x8D, 0xFC, 0x00, 0x00, 0x8D, 0xFC, 0x00, 0x00, 0x8D, 0xFC, 0x00, 0x00,
+    0x8D, 0xFC, 0x00, 0x00, 0x8D, 0xFC, 0x00, 0x01, 0x70, 0x08, 0xFE, 0x00, 0x04, 0xF0, 0x07, 0x00,
+    0xA0, 0x0B, 0xFE, 0x00, 0x04, 0xE0, 0x07, 0x00, 0xA0, 0x0B, 0xFE, 0x00, 0x04, 0xF1, 0x05, 0x00,
+    0xA0, 0x0B, 0xFE, 0x00, 0x04, 0xF4, 0x03, 0x00, 0xA0, 0x0B, 0xFE, 0x00, 0x2C, 0xF9, 0x07, 0x00,
+    0xA0, 0x0B, 0x00, 0x00, 0x10, 0x8E, 0x3E, 0x00, 0xA0, 0xFF, 0x4F, 0x00, 0xA0, 0x0D, 0xD8, 0x02,
+    0xA0, 0x0B, 0x00, 0x00, 0xF7, 0x04, 0xC0, 0x2D, 0xA0, 0x0B, 0x00, 0x80, 0x6F, 0x00, 0x10, 0xEC,
+    0xA1, 0x0B, 0x00, 0xA0, 0x05, 0x00, 0x00, 0x51, 0xA0, 0x0B, 0xFB, 0x00, 0x01, 0xA0, 0x0B, 0xFB,
+    0x00, 0x01, 0xA0, 0x0B, 0xFB, 0x00, 0x02, 0xA0, 0x0B, 0x00, 0x05, 0x00, 0x00, 0x59, 0x00, 0x00,
+    0xC8, 0xFD, 0x00, 0x03, 0x7E, 0x00, 0x00, 0xC8, 0xFE, 0x00, 0x04, 0x10, 0x5F, 0x00, 0x00, 0xC8,
+    0xFE, 0x00, 0x1F, 0x60, 0x9F, 0x00, 0x00, 0xF8, 0xFF, 0x02, 0x00, 0xE2, 0xD7, 0x08, 0x00, 0xC8,
+    0x00, 0x00, 0x20, 0xBD, 0x30, 0xAE, 0x01, 0xC8, 0x00, 0x00, 0xE5, 0x1B, 0x00, 0xC2, 0x0C, 0xC8,
+    0x00, 0x00, 0x74, 0xFE, 0x00, 0x01, 0x02, 0xB8, 0xF6, 0x00, 0x04, 0x30, 0xDA, 0xFF, 0xCE, 0x06,
+    0xFE, 0x00, 0x04, 0xF3, 0x3A, 0x01, 0x62, 0xAE, 0xFE, 0x00, 0x00, 0xF7, 0xFE, 0x00, 0x00, 0xE8,
+    0xFE, 0x00, 0x04, 0xF3, 0x39, 0x01, 0x51, 0x9E, 0xFE, 0x00, 0x06, 0x30, 0xD9, 0xFF, 0xBE, 0x06,
+    0x00, 0x00, 0x31, 0x00, 0x50, 0x0A, 0x00, 0xAA, 0x70, 0x0D, 0x00, 0x70, 0x0E, 0x00, 0xAA, 0x70,
+    0x0D, 0x00, 0x70, 0x0C, 0x00, 0xAA, 0x70, 0x0D, 0x00, 0xB0, 0x2E, 0x00, 0xFA, 0xFF, 0x0D, 0x00,
+    0xE6, 0xC7, 0x01, 0xAA, 0x70, 0x0D, 0x50, 0x6F, 0xC0, 0x2C, 0xAA, 0x70, 0x0D, 0xF6, 0x08, 0x10,
+    0x9C, 0xAA, 0x70, 0x0D, 0x51, 0xFE, 0x00, 0x02, 0x77, 0x70, 0x0D, 0xFC, 0x00, 0x24, 0x10, 0x02,
+    0x00, 0x00, 0xB5, 0xFE, 0xEF, 0x5B, 0x00, 0x00, 0x80, 0x7E, 0x12, 0x21, 0xE6, 0x09, 0x00, 0xD0,
+    0x09, 0x00, 0x00, 0x80, 0x0E, 0x00, 0x80, 0x6E, 0x12, 0x20, 0xE6, 0x09, 0x00, 0x00, 0xB5, 0xFE,
+    0xEF, 0x6B, 0x00, 0xFC, 0x00, 0x41, 0xD0, 0x08, 0x00, 0x00, 0x9C, 0x00, 0x00, 0xD0, 0x08, 0x00,
+    0x00, 0x9C, 0x00, 0x00, 0xD0, 0x08, 0x00, 0x00, 0x8E, 0x00, 0x00, 0xD0, 0x08, 0x00, 0x20, 0x6F,
+    0x00, 0x00, 0xD0, 0x08, 0x00, 0x70, 0xAF, 0x20, 0xFF, 0xFF, 0x08, 0x00, 0xD0, 0xE9, 0x05, 0x00,
+    0xD0, 0x08, 0x00, 0xE7, 0x61, 0x3E, 0x00, 0xD0, 0x08, 0x50, 0x6F, 0x00, 0xEA, 0x03, 0xD0, 0x08,
+    0xF6, 0x08, 0x00, 0xB0, 0x3E, 0xD0, 0x08, 0x78, 0xFE, 0x00, 0x02, 0x06, 0xD0, 0x08, 0xFC, 0x00,
+    0x01, 0xD0, 0x08, 0xFC, 0x00, 0x01, 0xD0, 0x08, 0xFC, 0x00, 0x01, 0xD0, 0x08, 0xFC, 0x00, 0x39,
+    0x30, 0x02, 0x00, 0x00, 0x97, 0x00, 0x00, 0xD0, 0x08, 0x00, 0x00, 0xBA, 0x00, 0x00, 0xD0, 0x08,
+    0x00, 0x00, 0x9D, 0x00, 0x00, 0xD0, 0x08, 0x00, 0x30, 0xDF, 0x01, 0xFD, 0xFF, 0x08, 0x00, 0xC0,
+    0xAA, 0x1C, 0x00, 0xD0, 0x08, 0x00, 0xEA, 0x12, 0xCD, 0x02, 0xD0, 0x08, 0xB2, 0x3E, 0x00, 0xA1,
+    0x3F, 0xD0, 0x08, 0xB4, 0x02, 0x00, 0x00, 0x04, 0xD0, 0x08, 0xFC, 0x00, 0x12, 0xD0, 0x08, 0x00,
+    0x70, 0x0E, 0x00, 0x00, 0xD0, 0x08, 0x00, 0x70, 0x0E, 0x00, 0x00, 0x10, 0x01, 0x00, 0x70, 0x0E,
+    0xFC, 0x00, 0x01, 0x70, 0x0E, 0xFC, 0x00, 0x00, 0x70, 0xFD, 0xFF, 0x00, 0x0C, 0x31, 0x00, 0x00,
+    0x43, 0x00, 0x00, 0x50, 0x03, 0x00, 0x00, 0xC9, 0x00, 0x00, 0xD0, 0x08, 0x00, 0x00, 0xAB, 0x00,
+    0x00, 0xD0, 0x08, 0x00, 0x20, 0xEF, 0x02, 0x98, 0xE9, 0x08, 0x00, 0xC1, 0x8B, 0x2D, 0x65, 0xE6,
+    0x08, 0x30, 0xDD, 0x01, 0xEA, 0x06, 0xD0, 0x08, 0xF4, 0x1B, 0x00, 0x60, 0x2D, 0xD0, 0x08, 0x40,
+    0xFD, 0x00, 0x01, 0xC0, 0x07, 0xF9, 0x00, 0x00, 0xA0, 0xFD, 0xFF, 0x00, 0x08, 0xFC, 0x00, 0x03,
+    0xD0, 0x08, 0x00, 0xA0, 0xFD, 0xFF, 0x03, 0x08, 0x00, 0xA0, 0x0A, 0xFC, 0x00, 0x01, 0xA0, 0x0A,
+    0xFC, 0x00, 0x00, 0xA0, 0xFD, 0xFF, 0x00, 0x0C, 0xFD, 0x00, 0x01, 0x40, 0x05, 0xFC, 0x00, 0x4F,
+    0x90, 0x0C, 0xBA, 0x00, 0x00, 0xBA, 0x00, 0x90, 0x0C, 0xBA, 0x00, 0x00, 0xAA, 0x00, 0x90, 0x0C,
+    0xBA, 0x00, 0x00, 0xAA, 0x00, 0x90, 0x0C, 0xBA, 0x00, 0x00, 0x8C, 0x90, 0xEB, 0x0C, 0xBA, 0x00,
+    0x10, 0xCF, 0x30, 0xA4, 0x0C, 0xBA, 0x00, 0x40, 0xFF, 0x03, 0x90, 0x0C, 0xBA, 0x00, 0xA0, 0x9B,
+    0x0B, 0x90, 0x0C, 0xBA, 0x00, 0xF3, 0x24, 0x6F, 0x90, 0x0C, 0xBA, 0x10, 0xBD, 0x00, 0xE8, 0x93,
+    0x0C, 0xBA, 0xB0, 0x1D, 0x00, 0xB0, 0x97, 0x0C, 0xBA, 0x30, 0x02, 0x00, 0x00, 0x90, 0x0C, 0xBA,
+    0xFD, 0x00, 0x02, 0x90, 0x0C, 0xBA, 0xFD, 0x00, 0x02, 0x90, 0x0C, 0xBA, 0xFD, 0x00, 0x00, 0x21,
+    0xFE, 0x00, 0x36, 0x50, 0x0B, 0x00, 0xF5, 0x70, 0x0D, 0x00, 0x70, 0x0E, 0x00, 0xF5, 0x70, 0x0D,
+    0x00, 0x70, 0x0C, 0x00, 0xF5, 0x70, 0x0D, 0x00, 0xB0, 0x2E, 0xFA, 0xFF, 0x70, 0x0D, 0x00, 0xE5,
+    0xC7, 0x01, 0xF5, 0x70, 0x0D, 0x40, 0x6E, 0xC0, 0x1C, 0xF5, 0x70, 0x0D, 0xF6, 0x08, 0x10, 0x9C,
+    0xF5, 0x70, 0x0D, 0x51, 0x00, 0x00, 0x01, 0xF5, 0x70, 0x0D, 0xFD, 0x00, 0x13, 0xF5, 0x70, 0x0D,
+    0x00, 0x50, 0x1F, 0x00, 0xF5, 0x70, 0x0D, 0x00, 0x50, 0x1F, 0x00, 0x10, 0x60, 0x0B, 0x00, 0x50,
+    0x1F, 0xFC, 0x00, 0x01, 0x50, 0x1F, 0xFC, 0x00, 0x00, 0x50, 0xFD, 0xFF, 0x00, 0x2F, 0xFE, 0x00,
+    0x00, 0x11, 0xFB, 0x00, 0x00, 0xE7, 0xFB, 0x00, 0x00, 0xD9, 0xFC, 0x00, 0x02, 0x10, 0xFE, 0x03,
+    0xFD, 0x00, 0x02, 0xA0, 0x7D, 0x2E, 0xFE, 0x00, 0x1A, 0x10, 0xEA, 0x03, 0xE9, 0x04, 0x00, 0x10,
+    0xD7, 0x3D, 0x00, 0x90, 0x9F, 0x02, 0x50, 0x8E, 0x01, 0x96, 0x00, 0xD5, 0x0C, 0x00, 0x01, 0x00,
+    0xD8, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xD8, 0xFB, 0x00, 0x00, 0xD8, 0xFE, 0x00, 0x00, 0xFA,
+    0xFC, 0xFF, 0x00, 0xEF, 0xFE, 0x00, 0x00, 0x94, 0xFA, 0x00, 0x00, 0xDB, 0xFB, 0x00, 0x02, 0xC3,
+    0xBB, 0x3C, 0xFD, 0x00, 0x12, 0x93, 0x9F, 0x00, 0xF8, 0x5B, 0x01, 0x00, 0x80, 0xCF, 0x04, 0x21,
+    0x30, 0xEA, 0x09, 0x00, 0x10, 0x02, 0x00, 0xD8, 0xFA, 0x00, 0x00, 0xD8, 0xFD, 0x00, 0x00, 0xFC,
+    0xFB, 0xFF, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x65, 0xFE, 0x66, 0x00, 0x56, 0xFE, 0x00, 0x00, 0x98,
+    0xFE, 0x99, 0x00, 0xDC, 0xFA, 0x00, 0x00, 0xD8, 0xFA, 0x00, 0x00, 0xD8, 0xFA, 0x00, 0x00, 0xD8,
+    0xFA, 0x00, 0x02, 0x21, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x21, 0xFB, 0x00, 0x00, 0xE7, 0xFB, 0x00,
+    0x00, 0xD9, 0xFC, 0x00, 0x02, 0x10, 0xFE, 0x03, 0xFD, 0x00, 0x02, 0xA0, 0x7D, 0x2D, 0xFD, 0x00,
+    0x14, 0xE9, 0x03, 0xDA, 0x03, 0x00, 0x00, 0xD5, 0x4E, 0x00, 0xA0, 0x8F, 0x01, 0x60, 0xAF, 0x01,
+    0x00, 0x00, 0xE6, 0x0C, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x01, 0xF3, 0x00, 0x00, 0xFA, 0xFC, 0xFF,
+    0x00, 0xEF, 0xFE, 0x00, 0x01, 0xF6, 0x01, 0xFB, 0x00, 0x00, 0xDC, 0xFB, 0x00, 0x02, 0x90, 0xDE,
+    0x1A, 0xFD, 0x00, 0x10, 0x51, 0xDC, 0x23, 0xEB, 0x27, 0x00, 0x00, 0x60, 0xEE, 0x18, 0x00, 0x50,
+    0xFC, 0x0A, 0x00, 0x10, 0x04, 0xFE, 0x00, 0x03, 0x10, 0x01, 0x00, 0xFC, 0xFB, 0xFF, 0x00, 0x01,
+    0xF8, 0x00, 0x00, 0xA5, 0xFE, 0x00, 0x00, 0xA5, 0xFE, 0x00, 0x00, 0xD7, 0xFE, 0x00, 0x00, 0xE7,
+    0xFE, 0x00, 0x00, 0xF7, 0xFE, 0xFF, 0x00, 0xEF, 0xFE, 0x00, 0x00, 0xD7, 0xFE, 0x00, 0x00, 0xE7,
+    0xFE, 0x00, 0x00, 0xD7, 0xFE, 0x00, 0x00, 0xE7, 0xFE, 0x00, 0x00, 0xF7, 0xFE, 0xFF, 0x02, 0xEF,
+    0x00, 0x00, 0xFC, 0x00, 0x41, 0xD0, 0x08, 0x00, 0x00, 0xAB, 0x00, 0x00, 0xD0, 0x08, 0x00, 0x00,
+    0xAB, 0x00, 0x00, 0xD0, 0x08, 0x00, 0x00, 0x9D, 0x00, 0x00, 0xD0, 0x08, 0x00, 0x10, 0x7F, 0x00,
+    0x00, 0xD0, 0x08, 0x00, 0x60, 0xAF, 0x00, 0x00, 0xD0, 0x08, 0x00, 0xC0, 0xD9, 0x06, 0x00, 0xD0,
+    0x08, 0x00, 0xE7, 0x52, 0x3F, 0x00, 0xD0, 0x08, 0x40, 0x7F, 0x00, 0xE9, 0x03, 0xD0, 0x08, 0xF6,
+    0x09, 0x00, 0xA0, 0x3F, 0xD0, 0x08, 0x87, 0xFE, 0x00, 0x02, 0x06, 0xD0, 0x08, 0xFC, 0x00, 0x01,
+    0xD0, 0x08, 0xFC, 0x00, 0x01, 0xD0, 0x08, 0xFC, 0x00, 0x01, 0xD0, 0x08, 0x30, 0x00, 0x00, 0x86,
+    0x00, 0x00, 0xD0, 0x08, 0x00, 0x00, 0xCA, 0x00, 0x00, 0xD0, 0x08, 0x00, 0x00, 0xAD, 0x00, 0x00,
+    0xD0, 0x08, 0x00, 0x60, 0xEF, 0x06, 0x00, 0xD0, 0x08, 0x00, 0xF5, 0x37, 0x7E, 0x00, 0xD0, 0x08,
+    0x91, 0x8F, 0x00, 0xE4, 0x3C, 0xD0, 0x08, 0xD4, 0x04, 0x00, 0x10, 0x07, 0xD0, 0x08, 0xF9, 0x00,
+    0x00, 0xA0, 0xFD, 0xFF, 0x00, 0x08, 0xFC, 0x00, 0x03, 0xD0, 0x08, 0x00, 0xA0, 0xFD, 0xFF, 0x03,
+    0x08, 0x00, 0xA0, 0x0A, 0xFC, 0x00, 0x01, 0xA0, 0x0A, 0xFC, 0x00, 0x00, 0xA0, 0xFD, 0xFF, 0x00,
+    0x0C, 0x2D, 0x00, 0xD7, 0xCF, 0x04, 0x00, 0xC8, 0x00, 0x00, 0xA0, 0x3C, 0x61, 0x5F, 0x00, 0xC8,
+    0x00, 0x00, 0xF3, 0x04, 0x00, 0xD9, 0x00, 0xC8, 0x00, 0x00, 0xF6, 0x01, 0x00, 0xF6, 0x01, 0xF8,
+    0xFF, 0x02, 0xF3, 0x04, 0x00, 0xD9, 0x00, 0xC8, 0x00, 0x00, 0xA0, 0x3C, 0x61, 0x5F, 0x00, 0xC8,
+    0xFE, 0x00, 0x04, 0xD8, 0xCF, 0x05, 0x00, 0xC8, 0xFA, 0x00, 0x00, 0x32, 0xFE, 0x00, 0x00, 0xF4,
+    0xFE, 0xFF, 0x00, 0xCF, 0xFA, 0x00, 0x00, 0xC8, 0xFE, 0x00, 0x00, 0xF4, 0xFE, 0xFF, 0x00, 0xCF,
+    0xFE, 0x00, 0x01, 0xF4, 0x01, 0xFB, 0x00, 0x01, 0xF4, 0x01, 0xFB, 0x00, 0x00, 0xF4, 0xFD, 0xFF,
+    0x01, 0x02, 0x00, 0xFC, 0x00, 0x47, 0xD0, 0x08, 0x00, 0xC5, 0xDF, 0x05, 0x00, 0xD0, 0x08, 0x40,
+    0x6F, 0x51, 0x4F, 0x00, 0xD0, 0x08, 0xC0, 0x0A, 0x00, 0xC9, 0x00, 0xD0, 0x08, 0xF1, 0x05, 0x00,
+    0xF5, 0x01, 0xD0, 0x08, 0xF3, 0x04, 0x00, 0xF3, 0xFF, 0xFF, 0x08, 0xF3, 0x04, 0x00, 0xF3, 0x03,
+    0xD0, 0x08, 0xF1, 0x05, 0x00, 0xF5, 0x01, 0xD0, 0x08, 0xC0, 0x0A, 0x00, 0xB9, 0x00, 0xD0, 0x08,
+    0x40, 0x6F, 0x51, 0x4F, 0x00, 0xD0, 0x08, 0x00, 0xC5, 0xCF, 0x05, 0x00, 0xD0, 0x08, 0xFC, 0x00,
+    0x01, 0xD0, 0x08, 0xFC, 0x00, 0x01, 0xD0, 0x08, 0xFC, 0x00, 0x01, 0xD0, 0x08, 0x37, 0x00, 0xC4,
+    0xDF, 0x08, 0x00, 0xD0, 0x07, 0x40, 0x6F, 0x31, 0xAD, 0x00, 0xD0, 0x07, 0xD0, 0x0A, 0x00, 0xF5,
+    0x03, 0xD0, 0x07, 0xF2, 0x06, 0x00, 0xF1, 0xFF, 0xFF, 0x07, 0xF2, 0x06, 0x00, 0xF0, 0x05, 0xD0,
+    0x07, 0xD0, 0x09, 0x00, 0xE4, 0x01, 0xD0, 0x07, 0x50, 0x6F, 0x31, 0x7D, 0x00, 0xD0, 0x07, 0x00,
+    0xC4, 0xDF, 0x06, 0x00, 0xD0, 0x07, 0xFC, 0x00, 0x0B, 0xD0, 0x07, 0x00, 0x30, 0x04, 0x00, 0x00,
+    0x90, 0x05, 0x00, 0x90, 0x0C, 0xFC, 0x00, 0x01, 0x90, 0x0C, 0xFC, 0x00, 0x01, 0x90, 0x0C, 0xFC,
+    0x00, 0x00, 0x90, 0xFD, 0xFF, 0x00, 0x0C, 0x29, 0x40, 0xFC, 0x8D, 0x01, 0x00, 0x8D, 0xF5, 0x16,
+    0xC3, 0x0A, 0x00, 0x8D, 0x9C, 0x00, 0x20, 0x3F, 0x00, 0x8D, 0x6E, 0x00, 0x00, 0xFF, 0xFF, 0x8F,
+    0x9C, 0x00, 0x20, 0x3F, 0x00, 0x8D, 0xF5, 0x15, 0xC3, 0x0B, 0x00, 0x8D, 0x40, 0xEC, 0x8D, 0x01,
+    0x00, 0x8D, 0xFC, 0x00, 0x02, 0x12, 0x00, 0x87, 0xFE, 0x00, 0x02, 0x6A, 0x00, 0xBA, 0xFE, 0x00,
+    0x02, 0x8D, 0x00, 0xFA, 0xFE, 0xFF, 0x02, 0x8F, 0x00, 0xBA, 0xFE, 0x00, 0x02, 0x8D, 0x00, 0xBA,
+    0xFE, 0x00, 0x02, 0x8D, 0x00, 0xFA, 0xFE, 0xFF, 0x00, 0x8F, 0xFC, 0x00, 0x31, 0x11, 0x00, 0x40,
+    0xFC, 0x7D, 0x00, 0x00, 0x8D, 0x00, 0xF4, 0x16, 0xC3, 0x08, 0x00, 0x8D, 0x00, 0x9C, 0x00, 0x30,
+    0x1F, 0x00, 0x8D, 0x00, 0x6E, 0x00, 0x00, 0xFF, 0xFF, 0x8F, 0x00, 0x9C, 0x00, 0x30, 0x3F, 0x00,
+    0x8D, 0x00, 0xF4, 0x16, 0xC3, 0x0B, 0x00, 0x8D, 0x00, 0x40, 0xFC, 0x8D, 0x01, 0x00, 0x8D, 0xFB,
+    0x00, 0x00, 0x59, 0xF8, 0x00, 0x22, 0x10, 0x5D, 0x00, 0xD4, 0x01, 0x00, 0x00, 0x40, 0x5F, 0x00,
+    0xF6, 0x01, 0x00, 0x00, 0xC1, 0xBC, 0x00, 0xCB, 0x0B, 0x00, 0x20, 0xDC, 0x91, 0x77, 0x0B, 0xCC,
+    0x03, 0xC0, 0x2B, 0x00, 0xBB, 0x01, 0xA1, 0x0A, 0x10, 0xFB, 0x00, 0xFD, 0x00, 0x48, 0xC9, 0xA0,
+    0x0B, 0x10, 0xEA, 0x4D, 0x00, 0xC9, 0xA0, 0x0B, 0x90, 0x1C, 0xE6, 0x01, 0xC9, 0xA0, 0x0B, 0xF1,
+    0x05, 0xD0, 0x07, 0xC9, 0xA0, 0x0B, 0xF3, 0x02, 0xA0, 0x0A, 0xC9, 0xA0, 0x0B, 0xF5, 0x01, 0x90,
+    0xBE, 0xCE, 0xA0, 0x0B, 0xF5, 0x01, 0x90, 0x4C, 0xCB, 0xA0, 0x0B, 0xF3, 0x02, 0xA0, 0x0A, 0xC9,
+    0xA0, 0x0B, 0xF1, 0x05, 0xD0, 0x07, 0xC9, 0xA0, 0x0B, 0x90, 0x1C, 0xF6, 0x02, 0xC9, 0xA0, 0x0B,
+    0x10, 0xFA, 0x4D, 0x00, 0xC9, 0xA0, 0x0B, 0xFD, 0x00, 0x02, 0xC9, 0xA0, 0x0B, 0xFD, 0x00, 0x02,
+    0xC9, 0xA0, 0x0B, 0xFD, 0x00, 0x02, 0xC9, 0xA0, 0x0B, 0x30, 0x00, 0xC5, 0xEF, 0x29, 0x00, 0xD0,
+    0x08, 0x50, 0x5E, 0x31, 0xFD, 0xFF, 0xFF, 0x08, 0xE0, 0x08, 0x00, 0xF3, 0x04, 0xD0, 0x08, 0xF1,
+    0x05, 0x00, 0xF0, 0x05, 0xD0, 0x08, 0xE0, 0x08, 0x00, 0xF3, 0x04, 0xD0, 0x08, 0x60, 0x5E, 0x31,
+    0xFC, 0xFF, 0xFF, 0x08, 0x00, 0xC5, 0xEF, 0x3A, 0x00, 0xD0, 0x08, 0xFC, 0x00, 0x01, 0xD0, 0x08,
+    0xFC, 0x00, 0x03, 0x40, 0x02, 0x00, 0xE0, 0xFD, 0xFF, 0x00, 0x08, 0xFC, 0x00, 0x01, 0xD0, 0x08,
+    0xFC, 0x00, 0x01, 0xD0, 0x08, 0xFC, 0x00, 0x01, 0xD0, 0x08, 0xFC, 0x00, 0x01, 0xD0, 0x08, 0xFC,
+    0x00, 0x01, 0x20, 0x01, 0x37, 0x00, 0xC4, 0xEF, 0x19, 0x00, 0xD0, 0x08, 0x40, 0x6F, 0x31, 0xFD,
+    0xFF, 0xFF, 0x08, 0xD0, 0x0A, 0x00, 0xF5, 0x04, 0xD0, 0x08, 0xF2, 0x06, 0x00, 0xF1, 0x06, 0xD0,
+    0x08, 0xF2, 0x06, 0x00, 0xF0, 0x04, 0xD0, 0x08, 0xD0, 0x09, 0x00, 0xF4, 0xFF, 0xFF, 0x08, 0x50,
+    0x6F, 0x31, 0x2C, 0x00, 0xD0, 0x08, 0x00, 0xC4, 0xCF, 0x03, 0x00, 0xD0, 0x08, 0xFC, 0x00, 0x0B,
+    0xD0, 0x08, 0x00, 0x30, 0x04, 0x00, 0x00, 0x90, 0x05, 0x00, 0x90, 0x0C, 0xFC, 0x00, 0x01, 0x90,
+    0x0C, 0xFC, 0x00, 0x01, 0x90, 0x0C, 0xFC, 0x00, 0x00, 0x90, 0xFD, 0xFF, 0x00, 0x0C, 0x16, 0x00,
+    0x10, 0xC6, 0xFE, 0x9D, 0x02, 0x00, 0x00, 0xD1, 0x4C, 0x11, 0xA3, 0x3E, 0x00, 0x00, 0xE8, 0x01,
+    0x00, 0x00, 0xCB, 0x00, 0x00, 0xBA, 0xFE, 0x00, 0x15, 0xE7, 0x00, 0x00, 0xE8, 0x01, 0x00, 0x00,
+    0xCB, 0x00, 0x00, 0xD1, 0x4C, 0x11, 0xA3, 0x3E, 0x00, 0x00, 0x10, 0xC8, 0xFF, 0x9D, 0x02, 0xFD,
+    0x00, 0x00, 0xD9, 0xFB, 0x00, 0x00, 0xD9, 0xFB, 0x00, 0x00, 0xD9, 0xFE, 0x00, 0x00, 0xFA, 0xFC,
+    0xFF, 0x00, 0xEF, 0x05, 0x00, 0x30, 0xDA, 0xFF, 0xBE, 0x06, 0xFE, 0x00, 0x04, 0xF4, 0x39, 0x01,
+    0x72, 0x9F, 0xFE, 0x00, 0x00, 0xE9, 0xFE, 0x00, 0x00, 0xEA, 0xFE, 0x00, 0x04, 0xF4, 0x38, 0x01,
+    0x62, 0x9E, 0xFE, 0x00, 0x04, 0x40, 0xDA, 0xFF, 0xBE, 0x06, 0xFC, 0x00, 0x00, 0xC9, 0xFA, 0x00,
+    0x00, 0xC9, 0xFD, 0x00, 0x00, 0xFC, 0xFB, 0xFF, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xC8, 0xFA, 0x00,
+    0x00, 0xC8, 0xFA, 0x00, 0x00, 0xC8, 0xFA, 0x00, 0x00, 0xF8, 0xFD, 0xFF, 0x01, 0x02, 0x00, 0xFC,
+    0x00, 0x00, 0xE6, 0xFE, 0x00, 0x2C, 0xB5, 0xEE, 0x2A, 0x00, 0xE6, 0x00, 0x00, 0x50, 0x6F, 0x21,
+    0xE9, 0x02, 0xE6, 0x00, 0x00, 0xD0, 0x09, 0x00, 0xD0, 0x08, 0xE6, 0x00, 0x00, 0xC0, 0x09, 0x00,
+    0xD0, 0x08, 0xE6, 0x00, 0x00, 0x60, 0x6F, 0x11, 0xF9, 0x03, 0xF6, 0xFF, 0x04, 0x00, 0xC5, 0xFF,
+    0x3B, 0x00, 0xE6, 0xFD, 0x00, 0x03, 0xAB, 0x00, 0x00, 0xE6, 0xFD, 0x00, 0x03, 0xAB, 0x00, 0x00,
+    0xE6, 0xFD, 0x00, 0x0B, 0xAB, 0x21, 0x43, 0xE6, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xDE, 0xAC, 0xE6,
+    0xFA, 0x00, 0x00, 0xE6, 0xFA, 0x00, 0x00, 0xE6, 0xFA, 0x00, 0x02, 0xE6, 0x00, 0x00, 0x16, 0x00,
+    0x10, 0xC6, 0xFE, 0x9D, 0x02, 0x00, 0x00, 0xD1, 0x4C, 0x11, 0xA3, 0x3E, 0x00, 0x00, 0xE8, 0x01,
+    0x00, 0x00, 0xCB, 0x00, 0x00, 0xBA, 0xFE, 0x00, 0x2C, 0xE7, 0x00, 0x00, 0xE8, 0x01, 0x00, 0x00,
+    0xCB, 0x00, 0x00, 0xD1, 0x4C, 0x11, 0xA3, 0x3E, 0x00, 0x00, 0x10, 0xC7, 0xFE, 0x9D, 0x02, 0x00,
+    0x00, 0x40, 0x0B, 0x00, 0x70, 0x08, 0x00, 0x00, 0x50, 0x1F, 0x00, 0xA0, 0x0B, 0x00, 0x00, 0x50,
+    0x1F, 0x00, 0xA0, 0x0B, 0x00, 0xFA, 0xFC, 0xFF, 0x00, 0xEF, 0x05, 0x00, 0x30, 0xD9, 0xFF, 0xAE,
+    0x05, 0xFE, 0x00, 0x04, 0xF4, 0x39, 0x11, 0x72, 0x8E, 0xFE, 0x00, 0x00, 0xDA, 0xFE, 0x00, 0x00,
+    0xE9, 0xFE, 0x00, 0x04, 0xF7, 0x28, 0x01, 0x62, 0xBE, 0xFE, 0x00, 0x04, 0x80, 0xEF, 0xFF, 0xFD,
+    0x1B, 0xFE, 0x00, 0x04, 0x10, 0x4F, 0x00, 0xF1, 0x05, 0xFE, 0x00, 0x07, 0x10, 0x4F, 0x00, 0xF1,
+    0x05, 0x00, 0x00, 0xFC, 0xFB, 0xFF, 0x00, 0x01, 0xF8, 0x00, 0x04, 0x40, 0xDA, 0xFF, 0xBE, 0x17,
+    0xFE, 0x00, 0x04, 0xF6, 0x38, 0x00, 0x51, 0xCD, 0xFE, 0x00, 0x00, 0xCB, 0xFE, 0x00, 0x08, 0xF6,
+    0x02, 0x00, 0x00, 0xF6, 0x28, 0x00, 0x51, 0xBD, 0xFE, 0x00, 0x06, 0x40, 0xDA, 0xFF, 0xBE, 0x07,
+    0x00, 0x00, 0xFC, 0x00, 0x2B, 0x30, 0x05, 0x00, 0x91, 0xED, 0x7D, 0x00, 0x70, 0x0D, 0x00, 0xBC,
+    0x12, 0xD3, 0x09, 0x70, 0x0D, 0x40, 0x2F, 0x00, 0x50, 0x1F, 0x70, 0x0D, 0x40, 0x2F, 0x00, 0x50,
+    0x1F, 0x70, 0x0D, 0x00, 0xBC, 0x02, 0xD3, 0x09, 0x70, 0x0D, 0x00, 0x91, 0xED, 0x7D, 0x00, 0x70,
+    0x0D, 0xFC, 0x00, 0x01, 0x70, 0x0D, 0xFE, 0x00, 0x30, 0x10, 0x32, 0x73, 0x0D, 0xF6, 0xFF, 0xFF,
+    0xEF, 0xCD, 0x78, 0x0D, 0x00, 0x00, 0xF4, 0x02, 0x00, 0x70, 0x0D, 0x00, 0x00, 0xF4, 0x02, 0xFC,
+    0xFF, 0x0D, 0x00, 0x00, 0xF4, 0x02, 0x00, 0x70, 0x0D, 0x00, 0x00, 0xF4, 0x02, 0x00, 0x70, 0x0D,
+    0x00, 0x00, 0xF4, 0x02, 0x00, 0x70, 0x0D, 0x00, 0x00, 0x20, 0xFD, 0x00, 0x29, 0x10, 0xD8, 0xBE,
+    0x02, 0xF3, 0x92, 0x0B, 0x90, 0x2D, 0x91, 0x0D, 0xF3, 0x92, 0x0B, 0xE0, 0x06, 0x10, 0x3F, 0xF3,
+    0x92, 0x0B, 0xE0, 0x06, 0x10, 0x3F, 0xF3, 0x92, 0x0B, 0x90, 0x2D, 0x91, 0x1D, 0xF3, 0x92, 0x0B,
+    0x10, 0xE8, 0xBE, 0x02, 0xF3, 0x92, 0x0B, 0xFD, 0x00, 0x33, 0xF3, 0x92, 0x0B, 0x00, 0x00, 0x10,
+    0x32, 0xF3, 0x92, 0x0B, 0xFD, 0xFF, 0xEF, 0xCD, 0xF4, 0x92, 0x0B, 0x00, 0x70, 0x0D, 0x00, 0xF3,
+    0x92, 0x0B, 0x00, 0x70, 0x0D, 0xFC, 0xFF, 0x92, 0x0B, 0x00, 0x70, 0x0D, 0x00, 0xF3, 0x92, 0x0B,
+    0x00, 0x70, 0x0D, 0x00, 0xF3, 0x92, 0x0B, 0x00, 0x70, 0x0D, 0x00, 0xF3, 0x92, 0x0B, 0xFA, 0x00,
+    0x05, 0x00, 0x20, 0xD9, 0xFE, 0xAD, 0x04, 0xFE, 0x00, 0x04, 0xE2, 0x4B, 0x11, 0x93, 0x6F, 0xFE,
+    0x00, 0x04, 0xE9, 0x01, 0x00, 0x00, 0xDB, 0xFE, 0x00, 0x00, 0xE9, 0xFE, 0x00, 0x00, 0xDA, 0xFE,
+    0x00, 0x04, 0xE3, 0x4B, 0x11, 0x82, 0x6F, 0xFE, 0x00, 0x04, 0x20, 0xD9, 0xFF, 0xAE, 0x04, 0xEF,
+    0x00, 0x00, 0xFC, 0xFB, 0xFF, 0x02, 0x01, 0x00, 0x32, 0xFA, 0x00, 0x00, 0xC8, 0xFA, 0x00, 0x00,
+    0xC8, 0xFA, 0x00, 0x00, 0xC8, 0xFA, 0x00, 0x00, 0xF8, 0xFD, 0xFF, 0x01, 0x02, 0x00, 0x05, 0x00,
+    0x30, 0xDA, 0xFF, 0xBE, 0x06, 0xFE, 0x00, 0x04, 0xF5, 0x39, 0x11, 0x72, 0x9E, 0xFE, 0x00, 0x00,
+    0xDA, 0xFE, 0x00, 0x00, 0xE9, 0xFE, 0x00, 0x04, 0xF5, 0x38, 0x01, 0x62, 0xAE, 0xFE, 0x00, 0x04,
+    0x40, 0xDA, 0xFF, 0xBE, 0x06, 0xF7, 0x00, 0x00, 0xFC, 0xFB, 0xFF, 0x00, 0x01, 0xF0, 0x00, 0x00,
+    0xF8, 0xFD, 0xFF, 0xFE, 0x00, 0x00, 0xC8, 0xFE, 0x00, 0x00, 0xF6, 0xFE, 0x00, 0x00, 0xC8, 0xFE,
+    0x00, 0x00, 0xF6, 0xFE, 0x00, 0x00, 0xC8, 0xFE, 0x00, 0x00, 0xF6, 0xFE, 0x00, 0x00, 0xF8, 0xFD,
+    0xFF, 0x01, 0x00, 0x00, 0xFC, 0x00, 0x47, 0xD0, 0x08, 0x00, 0xC4, 0xDF, 0x06, 0x00, 0xD0, 0x08,
+    0x30, 0x7F, 0x51, 0x6F, 0x00, 0xD0, 0x08, 0xB0, 0x0B, 0x00, 0xE8, 0x00, 0xD0, 0x08, 0xF0, 0x06,
+    0x00, 0xF3, 0x03, 0xD0, 0x08, 0xF2, 0x04, 0x00, 0xF1, 0x05, 0xD0, 0x08, 0xF2, 0x04, 0x00, 0xF1,
+    0x05, 0xD0, 0x08, 0xF0, 0x06, 0x00, 0xF3, 0x03, 0xD0, 0x08, 0xB0, 0x0B, 0x00, 0xE8, 0x00, 0xD0,
+    0x08, 0x30, 0x7F, 0x51, 0x6F, 0x00, 0xD0, 0x08, 0x00, 0xC4, 0xDF, 0x06, 0x00, 0xD0, 0x08, 0xFC,
+    0x00, 0x01, 0xD0, 0x08, 0xFC, 0x00, 0x01, 0xD0, 0x08, 0xFC, 0x00, 0x01, 0xD0, 0x08, 0x37, 0x00,
+    0xC4, 0xDF, 0x07, 0x00, 0xD0, 0x07, 0x40, 0x6F, 0x31, 0x9D, 0x00, 0xD0, 0x07, 0xD0, 0x0A, 0x00,
+    0xF5, 0x03, 0xD0, 0x07, 0xF2, 0x06, 0x00, 0xF1, 0x06, 0xD0, 0x07, 0xF2, 0x06, 0x00, 0xF0, 0x06,
+    0xD0, 0x07, 0xD0, 0x09, 0x00, 0xF4, 0x03, 0xD0, 0x07, 0x50, 0x6F, 0x31, 0x9D, 0x00, 0xD0, 0x07,
+    0x00, 0xC4, 0xDF, 0x07, 0x00, 0xD0, 0x07, 0xFC, 0x00, 0x12, 0xD0, 0x07, 0x00, 0x30, 0x04, 0x00,
+    0x00, 0xD0, 0x07, 0x00, 0x90, 0x0C, 0x00, 0x00, 0x70, 0x04, 0x00, 0x90, 0x0C, 0xFC, 0x00, 0x01,
+    0x90, 0x0C, 0xFC, 0x00, 0x00, 0x90, 0xFD, 0xFF, 0x00, 0x0C, 0x29, 0x40, 0xFC, 0x8E, 0x01, 0x00,
+    0x8D, 0xF4, 0x16, 0xC3, 0x0B, 0x00, 0x8D, 0xAC, 0x00, 0x20, 0x4F, 0x00, 0x8D, 0x7E, 0x00, 0x00,
+    0x7F, 0x00, 0x8D, 0xAC, 0x00, 0x20, 0x4F, 0x00, 0x8D, 0xF4, 0x16, 0xC3, 0x0B, 0x00, 0x8D, 0x40,
+    0xFC, 0x8E, 0x01, 0x00, 0x8D, 0xFA, 0x00, 0x00, 0xFA, 0xFE, 0xFF, 0x00, 0x8F, 0xFC, 0x00, 0x02,
+    0x8D, 0x00, 0xFA, 0xFE, 0xFF, 0x02, 0x8F, 0x00, 0xAA, 0xFC, 0x00, 0x00, 0xAA, 0xFC, 0x00, 0x00,
+    0xFA, 0xFE, 0xFF, 0x00, 0xCF, 0x29, 0x40, 0xFC, 0x8E, 0x01, 0x00, 0x8D, 0xF5, 0x16, 0xC3, 0x0B,
+    0x00, 0x8D, 0x9C, 0x00, 0x20, 0x4F, 0x00, 0x8D, 0x6E, 0x00, 0x00, 0x6F, 0x00, 0x8D, 0x9C, 0x00,
+    0x20, 0x4F, 0x00, 0x8D, 0xF5, 0x15, 0xC3, 0x0B, 0x00, 0x8D, 0x40, 0xEC, 0x8D, 0x01, 0x00, 0x8D,
+    0xFA, 0x00, 0x00, 0x66, 0xFE, 0x00, 0x02, 0x6A, 0x00, 0xBA, 0xFE, 0x00, 0x02, 0x8D, 0x00, 0xFA,
+    0xFE, 0xFF, 0x02, 0x8F, 0x00, 0xBA, 0xFE, 0x00, 0x02, 0x8D, 0x00, 0xBA, 0xFE, 0x00, 0x02, 0x8D,
+    0x00, 0xFA, 0xFE, 0xFF, 0x00, 0x8F, 0xFC, 0x00, 0x08, 0xBA, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x7F,
+    0x00, 0xBA, 0xFD, 0x00, 0x03, 0x30, 0x5F, 0x00, 0xBA, 0xFD, 0x00, 0x03, 0x70, 0x1F, 0x00, 0xBA,
+    0xFD, 0x00, 0x03, 0xD0, 0x0A, 0x00, 0xBA, 0xFD, 0x00, 0x0B, 0xF5, 0x04, 0x00, 0xFA, 0xFF, 0x04,
+    0x00, 0x10, 0xFD, 0x09, 0x00, 0xBA, 0xFE, 0x00, 0x04, 0xB0, 0x6D, 0x5F, 0x00, 0xBA, 0xFE, 0x00,
+    0x14, 0xEA, 0x02, 0xF8, 0x05, 0xBA, 0x00, 0x00, 0xB2, 0x4E, 0x00, 0x90, 0x5F, 0xBA, 0x00, 0x00,
+    0xC9, 0x02, 0x00, 0x00, 0x16, 0xBA, 0xFA, 0x00, 0x00, 0xBA, 0xFA, 0x00, 0x00, 0xBA, 0xFA, 0x00,
+    0x02, 0xBA, 0x00, 0x00, 0xFC, 0x00, 0x08, 0x43, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xDF, 0x00, 0xC8,
+    0xFC, 0x00, 0x02, 0x9E, 0x00, 0xC8, 0xFD, 0x00, 0x03, 0x60, 0x2F, 0x00, 0xC8, 0xFD, 0x00, 0x03,
+    0xE2, 0x09, 0x00, 0xC8, 0xFE, 0x00, 0x1C, 0x30, 0xED, 0x3E, 0x00, 0xF8, 0xFF, 0x02, 0x00, 0xE6,
+    0x1A, 0xF8, 0x07, 0xC8, 0x00, 0x00, 0xC4, 0x7E, 0x00, 0x60, 0x6E, 0xC8, 0x00, 0x00, 0x93, 0x01,
+    0x00, 0x00, 0x01, 0xC8, 0xFA, 0x00, 0x00, 0xC8, 0xFA, 0x00, 0x00, 0xC8, 0xFE, 0x00, 0x04, 0xF0,
+    0x06, 0x00, 0x00, 0x43, 0xFE, 0x00, 0x01, 0xF0, 0x06, 0xFB, 0x00, 0x01, 0xF0, 0x06, 0xFB, 0x00,
+    0x00, 0xF0, 0xFD, 0xFF, 0x01, 0x02, 0x00, 0xFC, 0x00, 0x03, 0x54, 0x00, 0x00, 0xC0, 0xFE, 0xFF,
+    0x01, 0x00, 0xC8, 0xFC, 0x00, 0x02, 0xAD, 0x00, 0xC8, 0xFD, 0x00, 0x03, 0x70, 0x3F, 0x00, 0xC8,
+    0xFD, 0x00, 0x1E, 0xF5, 0x0D, 0x00, 0xF8, 0xFF, 0x02, 0x00, 0x70, 0x9F, 0xBC, 0x01, 0xC8, 0x00,
+    0x00, 0x40, 0xFB, 0x06, 0xC1, 0x5E, 0xC8, 0x00, 0x00, 0xF5, 0x2B, 0x00, 0x00, 0x48, 0xC8, 0x00,
+    0x00, 0x20, 0xFD, 0x00, 0x00, 0x85, 0xF6, 0x00, 0x00, 0xF2, 0xFE, 0xFF, 0x00, 0xCF, 0xFE, 0x00,
+    0x04, 0xF2, 0x03, 0x00, 0x00, 0xC8, 0xFE, 0x00, 0x04, 0xF2, 0x03, 0x00, 0x00, 0xC8, 0xFE, 0x00,
+    0x04, 0xF2, 0x03, 0x00, 0x00, 0xC8, 0xFE, 0x00, 0x00, 0xF2, 0xFE, 0xFF, 0x02, 0xCF, 0x00, 0x00,
+    0xFC, 0x00, 0x03, 0x22, 0x00, 0x00, 0xC0, 0xFE, 0xFF, 0x01, 0x00, 0xC8, 0xFC, 0x00, 0x02, 0xBC,
+    0x00, 0xC8, 0xFD, 0x00, 0x03, 0x50, 0x3F, 0x00, 0xC8, 0xFD, 0x00, 0x1F, 0xE3, 0x0D, 0x00, 0xE8,
+    0x99, 0x01, 0x00, 0x40, 0xBE, 0xBD, 0x01, 0xD8, 0x66, 0x01, 0x10, 0xF8, 0x0A, 0xD1, 0x5D, 0xC8,
+    0x00, 0x00, 0xE5, 0x6E, 0x00, 0x10, 0x59, 0xC8, 0x00, 0x00, 0x61, 0x01, 0xFE, 0x00, 0x00, 0xC8,
+    0xFA, 0x00, 0x00, 0x64, 0xFE, 0x00, 0x04, 0x30, 0xDA, 0xFF, 0xCE, 0x06, 0xFE, 0x00, 0x04, 0xF3,
+    0x3A, 0x01, 0x62, 0xAE, 0xFE, 0x00, 0x00, 0xF7, 0xFE, 0x00, 0x00, 0xE8, 0xFE, 0x00, 0x04, 0xF3,
+    0x39, 0x01, 0x51, 0x9E, 0xFE, 0x00, 0x06, 0x30, 0xD9, 0xFF, 0xBE, 0x06, 0x00, 0x00, 0xFD, 0x00,
+    0x02, 0x24, 0x40, 0x05, 0xFD, 0x00, 0x48, 0x8C, 0xA0, 0x0B, 0xF0, 0xFF, 0xFF, 0x03, 0x8C, 0xA0,
+    0x0B, 0x00, 0x00, 0xF5, 0x00, 0x8C, 0xA0, 0x0B, 0x00, 0x00, 0xC8, 0x00, 0x8C, 0xA0, 0x0B, 0x00,
+    0x00, 0x7C, 0x00, 0x8C, 0xA0, 0x0B, 0x00, 0x30, 0x3F, 0x00, 0xFC, 0xFF, 0x0B, 0x00, 0xA0, 0x9F,
+    0x00, 0x8C, 0xA0, 0x0B, 0x00, 0xF5, 0xF8, 0x03, 0x8C, 0xA0, 0x0B, 0x20, 0x8E, 0xA0, 0x2D, 0x8C,
+    0xA0, 0x0B, 0xD2, 0x0B, 0x10, 0xBD, 0x8C, 0xA0, 0x0B, 0xC7, 0x01, 0x00, 0x12, 0x8C, 0xA0, 0x0B,
+    0xFD, 0x00, 0x02, 0x8C, 0xA0, 0x0B, 0xFD, 0x00, 0x02, 0x8C, 0xA0, 0x0B, 0xFD, 0x00, 0x02, 0x8C,
+    0xA0, 0x0B, 0xFC, 0x00, 0x08, 0xD0, 0x08, 0xC0, 0xFF, 0xFF, 0xCF, 0x00, 0xD0, 0x08, 0xFE, 0x00,
+    0x3B, 0xAD, 0x00, 0xD0, 0x08, 0x00, 0x00, 0x20, 0x6F, 0x00, 0xD0, 0x08, 0x00, 0x00, 0x80, 0x1E,
+    0x00, 0xD0, 0x08, 0x00, 0x00, 0xE1, 0x09, 0xFC, 0xFF, 0x08, 0x00, 0x00, 0xFA, 0x1D, 0x00, 0xD0,
+    0x08, 0x00, 0x60, 0x5F, 0xAD, 0x00, 0xD0, 0x08, 0x00, 0xF5, 0x06, 0xF4, 0x09, 0xD0, 0x08, 0x80,
+    0x8F, 0x00, 0x50, 0xAF, 0xD0, 0x08, 0xE5, 0x05, 0x00, 0x00, 0x34, 0xD0, 0x08, 0xFC, 0x00, 0x01,
+    0xD0, 0x08, 0xFC, 0x00, 0x01, 0xD0, 0x08, 0xFC, 0x00, 0x01, 0xD0, 0x08, 0xFC, 0x00, 0x02, 0x50,
+    0x03, 0x90, 0xFE, 0xFF, 0x02, 0x01, 0xD0, 0x08, 0xFE, 0x00, 0x2D, 0xBC, 0x00, 0xD0, 0x08, 0x00,
+    0x00, 0x40, 0x4F, 0x00, 0xD0, 0x08, 0x00, 0x00, 0xD1, 0x0B, 0x94, 0xE9, 0x08, 0x00, 0x10, 0xEC,
+    0x3E, 0x62, 0xE6, 0x08, 0x00, 0xD4, 0x1C, 0xF7, 0x06, 0xD0, 0x08, 0xB3, 0x9F, 0x00, 0x60, 0x9E,
+    0xD0, 0x08, 0x91, 0x03, 0x00, 0x00, 0x22, 0xD0, 0x08, 0xFC, 0x00, 0x01, 0xD0, 0x08, 0xFC, 0x00,
+    0x0B, 0xD0, 0x08, 0x00, 0x70, 0x0E, 0x00, 0x00, 0x40, 0x02, 0x00, 0x70, 0x0E, 0xFC, 0x00, 0x01,
+    0x70, 0x0E, 0xFC, 0x00, 0x00, 0x70, 0xFD, 0xFF, 0x00, 0x0C, 0xFC, 0x00, 0x32, 0x30, 0x02, 0x90,
+    0xFF, 0xFF, 0xDF, 0x00, 0xD0, 0x08, 0x00, 0x00, 0x10, 0x8E, 0x00, 0xD0, 0x08, 0x00, 0x00, 0x90,
+    0x1E, 0x00, 0xD0, 0x08, 0x00, 0x00, 0xF8, 0x0B, 0xF7, 0xFF, 0x08, 0x00, 0xA1, 0x7F, 0xBD, 0x02,
+    0xD0, 0x08, 0x81, 0xDE, 0x03, 0xB1, 0x6E, 0xD0, 0x08, 0xC3, 0x06, 0x00, 0x00, 0x25, 0xD0, 0x08,
+    0xFC, 0x00, 0x03, 0x10, 0x00, 0x00, 0xA0, 0xFD, 0xFF, 0x00, 0x08, 0xFC, 0x00, 0x03, 0xD0, 0x08,
+    0x00, 0xA0, 0xFD, 0xFF, 0x03, 0x08, 0x00, 0xA0, 0x0A, 0xFC, 0x00, 0x01, 0xA0, 0x0A, 0xFC, 0x00,
+    0x00, 0xA0, 0xFD, 0xFF, 0x00, 0x0C, 0xFC, 0x00, 0x08, 0x60, 0x04, 0x90, 0xFF, 0xFF, 0xEF, 0x00,
+    0xD0, 0x08, 0xFE, 0x00, 0x27, 0x9D, 0x00, 0xD0, 0x08, 0x00, 0x00, 0x70, 0x2E, 0x00, 0xD0, 0x08,
+    0x00, 0x00, 0xF4, 0x08, 0xF7, 0xFF, 0x08, 0x00, 0x50, 0xCE, 0x4E, 0x00, 0xD0, 0x08, 0x20, 0xFA,
+    0x08, 0xF7, 0x18, 0xD0, 0x08, 0xF5, 0x4C, 0x00, 0x40, 0x7D, 0xD0, 0x08, 0x40, 0xFD, 0x00, 0x01,
+    0xD0, 0x08, 0xFC, 0x00, 0x24, 0x30, 0x02, 0x00, 0x00, 0xB6, 0xFE, 0xDF, 0x3A, 0x00, 0x00, 0xB0,
+    0x6E, 0x02, 0x31, 0xF9, 0x04, 0x00, 0xF0, 0x07, 0x00, 0x00, 0xE0, 0x09, 0x00, 0xB0, 0x5D, 0x01,
+    0x31, 0xF9, 0x04, 0x00, 0x00, 0xB7, 0xFE, 0xDF, 0x3A, 0x00, 0xF9, 0x00, 0x00, 0xF6, 0xFE, 0xFF,
+    0x00, 0x1E, 0xFC, 0x00, 0x01, 0xF4, 0x07, 0xFD, 0x00, 0x01, 0x40, 0xAE, 0xFD, 0x00, 0x02, 0x10,
+    0xF8, 0x0C, 0xFD, 0x00, 0x12, 0xD6, 0x8D, 0xCE, 0x04, 0x00, 0x20, 0xD8, 0x8E, 0x01, 0x91, 0xCF,
+    0x07, 0x40, 0x7D, 0x01, 0x53, 0x00, 0x82, 0x07, 0xFE, 0x00, 0x00, 0xD8, 0xFB, 0x00, 0x00, 0xD8,
+    0xFB, 0x00, 0x00, 0xD8, 0xFE, 0x00, 0x00, 0xFA, 0xFC, 0xFF, 0x00, 0xEF, 0xF8, 0x00, 0x00, 0xF8,
+    0xFE, 0xFF, 0x00, 0x3F, 0xFB, 0x00, 0x01, 0xF8, 0x05, 0xFC, 0x00, 0x01, 0xC4, 0x4F, 0xFD, 0x00,
+    0x15, 0x20, 0xC7, 0x9E, 0xED, 0x27, 0x00, 0x00, 0x60, 0xFE, 0x7D, 0x01, 0x60, 0xFC, 0x1C, 0x00,
+    0x10, 0x25, 0x00, 0xF6, 0x00, 0x20, 0x03, 0xFD, 0x00, 0x00, 0xF6, 0xFD, 0x00, 0x00, 0xFC, 0xFB,
+    0xFF, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x64, 0xFE, 0x66, 0x00, 0x56, 0xFE, 0x00, 0x00, 0x97, 0xFE,
+    0x99, 0x00, 0xDC, 0xFA, 0x00, 0x00, 0xD7, 0xFA, 0x00, 0x00, 0xD7, 0xFA, 0x00, 0x00, 0xD7, 0xFA,
+    0x00, 0x02, 0x21, 0x00, 0x00, 0xF9, 0x00, 0x00, 0xF6, 0xFE, 0xFF, 0x00, 0x2E, 0xFC, 0x00, 0x01,
+    0xF5, 0x06, 0xFD, 0x00, 0x01, 0x91, 0x6F, 0xFD, 0x00, 0x12, 0x71, 0xFE, 0x5D, 0x00, 0x00, 0x20,
+    0xB6, 0xDF, 0x26, 0xE8, 0x9E, 0x05, 0x70, 0x9D, 0x04, 0x00, 0x10, 0xA6, 0x0B, 0xF3, 0x00, 0x00,
+    0xFA, 0xFC, 0xFF, 0x00, 0xEF, 0xFE, 0x00, 0x00, 0xE7, 0xFB, 0x00, 0x00, 0xE7, 0xFB, 0x00, 0x00,
+    0xE7, 0xFB, 0x00, 0x00, 0xE7, 0xFB, 0x00, 0x00, 0xE7, 0xFB, 0x00, 0x00, 0x31, 0xFE, 0x00, 0x01,
+    0x00, 0x42, 0xFE, 0x44, 0x00, 0x14, 0xFE, 0x00, 0x04, 0xB7, 0xBB, 0xBB, 0xFB, 0x1D, 0xFB, 0x00,
+    0x01, 0xE9, 0x03, 0xFC, 0x00, 0x01, 0xD4, 0x3F, 0xFD, 0x00, 0x10, 0x10, 0xC6, 0xAF, 0xDD, 0x16,
+    0x00, 0x00, 0x50, 0xFC, 0x9E, 0x02, 0x71, 0xFE, 0x0B, 0x00, 0x20, 0x47, 0xFE, 0x00, 0x01, 0x50,
+    0x05, 0xF8, 0x00, 0x00, 0xFC, 0xFB, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x01, 0xF4, 0x02, 0xFD, 0x00,
+    0x03, 0x21, 0x00, 0xF4, 0x02, 0xFD, 0x00, 0x03, 0xC8, 0x00, 0xF4, 0x02, 0xFD, 0x00, 0x02, 0xC8,
+    0x00, 0x20, 0xFC, 0x00, 0x00, 0xC8, 0xFA, 0x00, 0x00, 0xF8, 0xFD, 0xFF, 0x01, 0x04, 0x00, 0xF8,
+    0x00, 0x00, 0xF8, 0xFE, 0xFF, 0x00, 0x2E, 0xFB, 0x00, 0x01, 0xE9, 0x04, 0xFC, 0x00, 0x01, 0xD5,
+    0x4F, 0xFD, 0x00, 0x10, 0x41, 0xD8, 0x8D, 0xEC, 0x49, 0x00, 0x00, 0x50, 0xEF, 0x5A, 0x00, 0x40,
+    0xFA, 0x0D, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x03, 0x10, 0x02, 0x00, 0xFC, 0xFB, 0xFF, 0x00, 0x01,
+    0xFE, 0x00, 0x00, 0xD8, 0xFA, 0x00, 0x00, 0xD8, 0xFC, 0x00, 0x04, 0x50, 0xDA, 0xFF, 0xCE, 0x17,
+    0xFE, 0x00, 0x04, 0xF7, 0x38, 0x00, 0x51, 0xCD, 0xFE, 0x00, 0x00, 0xCB, 0xFE, 0x00, 0x08, 0xF7,
+    0x01, 0x00, 0x00, 0xF6, 0x38, 0x00, 0x51, 0xBD, 0xFE, 0x00, 0x06, 0x40, 0xDA, 0xFF, 0xBE, 0x06,
+    0x00, 0x00, 0xFC, 0x00, 0x08, 0xD0, 0x08, 0xC0, 0xFF, 0xFF, 0xEF, 0x00, 0xD0, 0x08, 0xFE, 0x00,
+    0x03, 0xCA, 0x00, 0xD0, 0x08, 0xFE, 0x00, 0x34, 0x8E, 0x00, 0xD0, 0x08, 0x00, 0x00, 0x50, 0x2F,
+    0x00, 0xD0, 0x08, 0x00, 0x00, 0xD0, 0x0A, 0x00, 0xD0, 0x08, 0x00, 0x00, 0xF8, 0x1D, 0x00, 0xD0,
+    0x08, 0x00, 0x50, 0x5F, 0xAD, 0x00, 0xD0, 0x08, 0x00, 0xF5, 0x06, 0xF3, 0x0A, 0xD0, 0x08, 0x81,
+    0x7F, 0x00, 0x50, 0xAF, 0xD0, 0x08, 0xE5, 0x05, 0x00, 0x00, 0x34, 0xD0, 0x08, 0xFC, 0x00, 0x01,
+    0xD0, 0x08, 0xFC, 0x00, 0x01, 0xD0, 0x08, 0xFC, 0x00, 0x01, 0xD0, 0x08, 0xFA, 0x00, 0x06, 0x90,
+    0xFF, 0xFF, 0xEF, 0x00, 0xD0, 0x08, 0xFE, 0x00, 0x2D, 0xAD, 0x00, 0xD0, 0x08, 0x00, 0x00, 0x50,
+    0x3F, 0x00, 0xD0, 0x08, 0x00, 0x00, 0xE2, 0x0A, 0x00, 0xD0, 0x08, 0x00, 0x20, 0xED, 0x4E, 0x00,
+    0xD0, 0x08, 0x00, 0xE5, 0x1B, 0xF7, 0x07, 0xD0, 0x08, 0xC4, 0x8F, 0x00, 0x50, 0x7E, 0xD0, 0x08,
+    0x92, 0x02, 0x00, 0x00, 0x01, 0xD0, 0x08, 0xFC, 0x00, 0x12, 0xD0, 0x08, 0x00, 0x70, 0x0E, 0x00,
+    0x00, 0xD0, 0x08, 0x00, 0x70, 0x0E, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x70, 0x0E, 0xFC, 0x00, 0x01,
+    0x70, 0x0E, 0xFC, 0x00, 0x00, 0x70, 0xFD, 0xFF, 0x00, 0x0C, 0xFA, 0x00, 0x00, 0xB0, 0xFE, 0xFF,
+    0x02, 0x02, 0xD0, 0x08, 0xFE, 0x00, 0x27, 0xCB, 0x00, 0xD0, 0x08, 0x00, 0x00, 0x50, 0x4F, 0x00,
+    0xD0, 0x08, 0x00, 0x00, 0xF4, 0x2E, 0x00, 0xD0, 0x08, 0x00, 0x70, 0xAF, 0xDA, 0x03, 0xD0, 0x08,
+    0x40, 0xFB, 0x07, 0x90, 0x8F, 0xD0, 0x08, 0xF7, 0x2A, 0x00, 0x00, 0x54, 0xD0, 0x08, 0x20, 0xFD,
+    0x00, 0x01, 0xD0, 0x08, 0xF9, 0x00, 0x00, 0x90, 0xFD, 0xFF, 0x17, 0x08, 0x00, 0x90, 0x0B, 0x00,
+    0x00, 0xD0, 0x08, 0x00, 0x90, 0x0B, 0x00, 0x00, 0xD0, 0x08, 0x00, 0x90, 0x0B, 0x00, 0x00, 0xD0,
+    0x08, 0x00, 0x90, 0xFD, 0xFF, 0x00, 0x08, 0xFC, 0x00, 0x01, 0x20, 0x07, 0xFB, 0x00, 0x09, 0x40,
+    0x1F, 0x00, 0x60, 0xFF, 0x6F, 0xFF, 0x7F, 0x40, 0x1F, 0xFE, 0x00, 0x3C, 0x3F, 0x00, 0x6C, 0x40,
+    0x1F, 0x00, 0x00, 0x30, 0x1F, 0x00, 0x3E, 0x40, 0x1F, 0x00, 0x00, 0x70, 0x0C, 0x10, 0x0F, 0x40,
+    0x1F, 0x00, 0x00, 0xD0, 0x1E, 0x70, 0x1F, 0x40, 0xFF, 0x4F, 0x00, 0xE7, 0x8D, 0xE0, 0x8E, 0x40,
+    0x1F, 0x00, 0x30, 0x6F, 0xD4, 0xC8, 0xF4, 0x43, 0x1F, 0x00, 0xE2, 0x09, 0x40, 0x5F, 0x90, 0x7E,
+    0x1F, 0x00, 0x60, 0x00, 0xD1, 0x0A, 0x00, 0x56, 0x1F, 0xFE, 0x00, 0x04, 0xC8, 0x01, 0x00, 0x40,
+    0x1F, 0xFE, 0x00, 0x04, 0x10, 0x00, 0x00, 0x40, 0x1F, 0xFB, 0x00, 0x01, 0x40, 0x1F, 0xFB, 0x00,
+    0x02, 0x40, 0x1F, 0x00, 0x04, 0x00, 0x00, 0xFB, 0xFF, 0x7F, 0xF5, 0x00, 0x04, 0xF9, 0xFF, 0xFF,
+    0xFE, 0x1E, 0xFC, 0x00, 0x02, 0x51, 0xBB, 0x02, 0xFE, 0x00, 0x0D, 0x42, 0xA7, 0xAD, 0xAD, 0x36,
+    0x01, 0x00, 0x50, 0xCE, 0x49, 0x00, 0x50, 0xC9, 0x09, 0xF8, 0x00, 0x00, 0xB9, 0xFE, 0xCC, 0x07,
+    0xDC, 0xDD, 0xDD, 0x01, 0x43, 0x44, 0x44, 0xDA, 0xFE, 0x22, 0x06, 0x00, 0x00, 0x50, 0xEB, 0xFF,
+    0xCE, 0x07, 0xFE, 0x00, 0x04, 0xF7, 0x27, 0x00, 0x52, 0xBE, 0xFE, 0x00, 0x00, 0xBC, 0xFE, 0x00,
+    0x08, 0xF7, 0x01, 0x00, 0x00, 0xF7, 0x27, 0x00, 0x51, 0xBE, 0xFE, 0x00, 0x06, 0x50, 0xDA, 0xFF,
+    0xBE, 0x06, 0x00, 0x00, 0x06, 0x00, 0xE0, 0xFF, 0xAF, 0x00, 0x80, 0x0D, 0xFC, 0x00, 0x02, 0x80,
+    0x0D, 0x00, 0xFE, 0xFF, 0x02, 0x08, 0x80, 0x0D, 0xFE, 0x00, 0x18, 0xEA, 0x01, 0x80, 0x0D, 0x00,
+    0x00, 0xD5, 0x3F, 0x00, 0x80, 0x0D, 0x20, 0xD7, 0x7E, 0xEA, 0x38, 0x80, 0x0D, 0x70, 0x8D, 0x01,
+    0x30, 0xBA, 0x80, 0x0D, 0xFC, 0x00, 0x2B, 0x81, 0x0D, 0xB5, 0xBB, 0xBB, 0xCC, 0xFD, 0x8A, 0x0D,
+    0x42, 0x44, 0xF5, 0x37, 0x12, 0x80, 0x0D, 0x00, 0x00, 0xF2, 0x04, 0x00, 0x80, 0x0D, 0x00, 0x00,
+    0xF2, 0x04, 0x00, 0x80, 0x0D, 0x00, 0x00, 0xF2, 0x04, 0x00, 0x80, 0x0D, 0x00, 0x00, 0x91, 0x03,
+    0x00, 0x80, 0x0D, 0xFC, 0x00, 0x08, 0xD0, 0x08, 0x00, 0xF5, 0xFF, 0x3F, 0x00, 0xD0, 0x08, 0xFC,
+    0x00, 0x02, 0xD0, 0x08, 0xA0, 0xFE, 0xFF, 0x02, 0x02, 0xD0, 0x08, 0xFE, 0x00, 0x2F, 0xD9, 0x00,
+    0xD0, 0x08, 0x00, 0x00, 0x10, 0x7E, 0x00, 0xD0, 0x08, 0x00, 0x00, 0xA0, 0x0E, 0x00, 0xD0, 0x08,
+    0x00, 0x00, 0xF6, 0x3E, 0x00, 0xD0, 0x08, 0x00, 0x70, 0x7F, 0xEB, 0x02, 0xD0, 0x08, 0x10, 0xF9,
+    0x06, 0xC1, 0x4E, 0xD0, 0x08, 0xD3, 0x4D, 0x00, 0x10, 0x9B, 0xD0, 0x08, 0x60, 0x01, 0xFE, 0x00,
+    0x01, 0xD0, 0x08, 0xFC, 0x00, 0x01, 0xD0, 0x08, 0xFC, 0x00, 0x01, 0xD0, 0x08, 0x01, 0x00, 0xFA,
+    0xFE, 0xFF, 0x00, 0xCF, 0xFB, 0x00, 0x00, 0xB8, 0xFB, 0x00, 0x00, 0xA9, 0xFB, 0x00, 0x00, 0x9A,
+    0xFC, 0x00, 0x08, 0x21, 0x8C, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xCE, 0x6F, 0xFB, 0x00, 0x00, 0x5F,
+    0xFC, 0x00, 0x01, 0x20, 0x3F, 0xFC, 0x00, 0x01, 0x50, 0x1F, 0xFC, 0x00, 0x03, 0x80, 0x0D, 0x00,
+    0xFA, 0xFC, 0xFF, 0x00, 0xEF, 0x00, 0x00, 0x00, 0x20, 0x02, 0x44, 0x00, 0x00, 0x00, 0xA0, 0x0B,
+    0xBA, 0xFC, 0xFF, 0xAF, 0xA0, 0x0B, 0xBA, 0x9C, 0x00, 0x00, 0xA0, 0x0B, 0xBA, 0x9C, 0x00, 0x00,
+    0xA0, 0x0B, 0xBA, 0x9C, 0x00, 0x00, 0xA0, 0x0B, 0xBA, 0xFC, 0xFF, 0x5F, 0xA0, 0xFF, 0xBF, 0x9C,
+    0x00, 0x00, 0xA0, 0x0B, 0xBA, 0x9C, 0x00, 0x00, 0xA0, 0x0B, 0xBA, 0x9C, 0x00, 0x00, 0xA0, 0x0B,
+    0xBA, 0x9C, 0x10, 0x53, 0xA4, 0x0B, 0xBA, 0xFC, 0xEF, 0xBD, 0xA5, 0x0B, 0xBA, 0x00, 0x00, 0x00,
+    0xA0, 0x0B, 0xBA, 0x00, 0x00, 0x00, 0xA0, 0x0B, 0xBA, 0x00, 0x00, 0x00, 0xA0, 0x0B, 0xBA, 0x2F,
+    0xFA, 0xFF, 0xAF, 0x50, 0x06, 0x95, 0xAA, 0x00, 0x00, 0xA0, 0x0A, 0xD7, 0xAA, 0x00, 0x00, 0xA0,
+    0x0A, 0xD7, 0xFA, 0xFF, 0x8F, 0xA0, 0x0A, 0xD7, 0xAA, 0x00, 0x00, 0xA0, 0xFF, 0xDF, 0xAA, 0x00,
+    0x00, 0xA0, 0x0A, 0xD7, 0xAA, 0x10, 0x52, 0xA5, 0x0A, 0xD7, 0xFA, 0xEF, 0xBD, 0xA6, 0x0A, 0xD7,
+    0xFE, 0x00, 0x0A, 0xA0, 0x0A, 0xD7, 0x00, 0x65, 0x66, 0x76, 0x67, 0x77, 0x00, 0x98, 0xFE, 0x99,
+    0x00, 0xDC, 0xFC, 0x00, 0x00, 0xD8, 0xFC, 0x00, 0x00, 0xD8, 0xFC, 0x00, 0x00, 0xD8, 0xFC, 0x00,
+    0x00, 0x32, 0xFC, 0x00, 0x00, 0x11, 0xFC, 0x00, 0x07, 0x8D, 0xFD, 0xFF, 0xFF, 0x08, 0x00, 0x8D,
+    0x8D, 0xFD, 0x00, 0x01, 0x8D, 0x8D, 0xFD, 0x00, 0x01, 0x8D, 0x8D, 0xFD, 0x00, 0x07, 0x8D, 0xFD,
+    0xFF, 0xFF, 0x72, 0xFF, 0x8F, 0x8D, 0xFD, 0x00, 0x01, 0x8D, 0x8D, 0xFD, 0x00, 0x0C, 0x8D, 0x8D,
+    0x00, 0x21, 0x63, 0x05, 0x8D, 0xFD, 0xFF, 0xEE, 0xAC, 0x06, 0x8D, 0xFC, 0x00, 0x00, 0x8D, 0xFC,
+    0x00, 0x00, 0x8D, 0xFC, 0x00, 0x00, 0x8D, 0xFC, 0x00, 0x00, 0x8D, 0xFC, 0x00, 0x00, 0x24, 0xFD,
+    0x00, 0x2B, 0x02, 0x00, 0xFB, 0xFF, 0x8F, 0x30, 0x2F, 0xD7, 0x9B, 0x00, 0x00, 0x30, 0x2F, 0xD7,
+    0x9B, 0x00, 0x00, 0x30, 0x2F, 0xD7, 0xFB, 0xFF, 0x2F, 0xFD, 0x2F, 0xD7, 0x9B, 0x00, 0x00, 0x30,
+    0x2F, 0xD7, 0x9B, 0x10, 0x42, 0x35, 0x2F, 0xD7, 0xFB, 0xFF, 0xBD, 0x37, 0x2F, 0xD7, 0xFE, 0x00,
+    0x02, 0x30, 0x2F, 0xD7, 0xFC, 0x00, 0x02, 0x63, 0x00, 0xF8, 0xFE, 0xFF, 0x02, 0xDF, 0x00, 0xD8,
+    0xFE, 0x00, 0x02, 0xD8, 0x00, 0xD8, 0xFE, 0x00, 0x02, 0xD8, 0x00, 0xD8, 0xFE, 0x00, 0x02, 0xD8,
+    0x00, 0xF8, 0xFE, 0xFF, 0x00, 0xDF, 0x01, 0x00, 0xF6, 0xFE, 0xFF, 0x03, 0xBF, 0x00, 0x00, 0xE6,
+    0xFB, 0x00, 0x00, 0xE6, 0xFB, 0x00, 0x00, 0xF6, 0xFE, 0xFF, 0x03, 0x7F, 0x00, 0x00, 0xE6, 0xFB,
+    0x00, 0x00, 0xE6, 0xFB, 0x00, 0x00, 0xE6, 0xFB, 0x00, 0x00, 0xF6, 0xFE, 0xFF, 0x00, 0xEF, 0xF2,
+    0x00, 0x00, 0xFA, 0xFC, 0xFF, 0x00, 0xEF, 0xFC, 0x00, 0x01, 0x10, 0x02, 0xFD, 0x00, 0x41, 0x9A,
+    0xA0, 0x0B, 0xF8, 0xFF, 0xFF, 0x3F, 0xAB, 0xA0, 0x0B, 0x30, 0x05, 0x51, 0x01, 0xAB, 0xA0, 0x0B,
+    0x70, 0x0C, 0xF3, 0x01, 0xAB, 0xA0, 0x0B, 0x70, 0x0C, 0xF3, 0x01, 0xAB, 0xA0, 0x0B, 0x70, 0x0D,
+    0xF3, 0x01, 0xFB, 0xFF, 0x0B, 0x70, 0x0D, 0xF4, 0x01, 0xAB, 0xA0, 0x0B, 0x60, 0x0D, 0xF4, 0x01,
+    0xAB, 0xA0, 0x0B, 0x60, 0x0D, 0xF4, 0x31, 0xAB, 0xA0, 0x0B, 0xFB, 0xFF, 0xFF, 0xAD, 0xAB, 0xA0,
+    0x0B, 0xFD, 0x00, 0x02, 0xAB, 0xA0, 0x0B, 0xFD, 0x00, 0x02, 0xAB, 0xA0, 0x0B, 0xFD, 0x00, 0x02,
+    0xAB, 0xA0, 0x0B, 0xFD, 0x00, 0x02, 0xAB, 0xA0, 0x0B, 0xFC, 0x00, 0x02, 0x10, 0x01, 0xF5, 0xFE,
+    0xFF, 0x02, 0x0A, 0xD0, 0x08, 0xFC, 0x00, 0x24, 0xD0, 0x08, 0x00, 0x6C, 0x10, 0x4D, 0x00, 0xD0,
+    0x08, 0x00, 0x7D, 0x10, 0x4F, 0xF7, 0xFF, 0x08, 0x00, 0x7D, 0x10, 0x4F, 0x00, 0xD0, 0x08, 0x00,
+    0x7D, 0x10, 0x4F, 0x42, 0xD0, 0x08, 0xF9, 0xFF, 0xFF, 0xEE, 0xAD, 0xD0, 0x08, 0xFC, 0x00, 0x01,
+    0xD0, 0x08, 0xFC, 0x00, 0x03, 0x10, 0x01, 0x00, 0x90, 0xFD, 0xFF, 0x17, 0x08, 0x00, 0x90, 0x0B,
+    0x00, 0x00, 0xD0, 0x08, 0x00, 0x90, 0x0B, 0x00, 0x00, 0xD0, 0x08, 0x00, 0x90, 0x0B, 0x00, 0x00,
+    0xD0, 0x08, 0x00, 0x90, 0xFD, 0xFF, 0x00, 0x08, 0xFC, 0x00, 0x02, 0x40, 0x02, 0xF3, 0xFE, 0xFF,
+    0x33, 0x0C, 0xD0, 0x08, 0x00, 0x23, 0x00, 0x12, 0x00, 0xD0, 0x08, 0x00, 0x8C, 0x00, 0x6E, 0xF4,
+    0xFF, 0x08, 0x00, 0x9B, 0x00, 0x6E, 0x00, 0xD0, 0x08, 0x00, 0x9B, 0x00, 0x6E, 0xF4, 0xFF, 0x08,
+    0x00, 0x9B, 0x00, 0x5F, 0x10, 0xD0, 0x08, 0xF7, 0xFF, 0xEF, 0xDF, 0xED, 0xD1, 0x08, 0x10, 0x22,
+    0x43, 0x33, 0x02, 0xD0, 0x08, 0xFC, 0x00, 0x24, 0x50, 0x03, 0x00, 0x00, 0xC7, 0xFE, 0xDF, 0x3A,
+    0x00, 0x00, 0xB0, 0x5E, 0x02, 0x31, 0xF9, 0x04, 0x00, 0xF0, 0x07, 0x00, 0x00, 0xE0, 0x09, 0x00,
+    0xB0, 0x5D, 0x01, 0x31, 0xF8, 0x04, 0x00, 0x00, 0xC7, 0xFE, 0xDF, 0x3A, 0x00, 0x01, 0x00, 0xFC,
+    0xFD, 0xFF, 0x00, 0x02, 0xF9, 0x00, 0x1B, 0x20, 0x3E, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x20, 0x3F,
+    0x00, 0xD0, 0x07, 0x00, 0x00, 0x20, 0x3F, 0x00, 0xD0, 0x07, 0x00, 0x00, 0x10, 0x4F, 0x00, 0xE0,
+    0x07, 0x00, 0x10, 0xFC, 0xFF, 0x06, 0x06, 0x00, 0x00, 0x9B, 0x00, 0xF2, 0x03, 0xFE, 0x00, 0x03,
+    0x9B, 0x00, 0xF2, 0x03, 0xFE, 0x00, 0x05, 0x9B, 0x00, 0xF2, 0x03, 0x00, 0xFA, 0xFC, 0xFF, 0x00,
+    0xEF, 0x01, 0x00, 0xFC, 0xFD, 0xFF, 0x24, 0x02, 0x00, 0x10, 0x14, 0x00, 0x30, 0x02, 0x00, 0x00,
+    0x30, 0x2F, 0x00, 0xC0, 0x08, 0x00, 0x00, 0x30, 0x3F, 0x00, 0xD0, 0x08, 0x00, 0x00, 0x20, 0x3F,
+    0x00, 0xD0, 0x07, 0x00, 0x00, 0x20, 0x3F, 0x00, 0xE0, 0x06, 0x00, 0x10, 0xFC, 0xFF, 0x00, 0x06,
+    0xEC, 0x00, 0x00, 0xFA, 0xFC, 0xFF, 0x00, 0xEF, 0x01, 0x00, 0xFE, 0xFD, 0xFF, 0x00, 0x04, 0xF7,
+    0x00, 0x04, 0x20, 0x3F, 0x00, 0xD0, 0x07, 0xFE, 0x00, 0x07, 0x20, 0x4F, 0x00, 0xE0, 0x06, 0x00,
+    0x00, 0x10, 0xFC, 0xFF, 0x00, 0x06, 0xF8, 0x00, 0x00, 0xFC, 0xFB, 0xFF, 0x00, 0x01, 0xF8, 0x00,
+    0x00, 0xF9, 0xFE, 0xFF, 0x00, 0xDF, 0xFA, 0x00, 0x00, 0xD8, 0xFE, 0x00, 0x00, 0xF9, 0xFE, 0xFF,
+    0x00, 0xDF, 0xFE, 0x00, 0x00, 0xC9, 0xFA, 0x00, 0x00, 0xC9, 0xFA, 0x00, 0x00, 0xF9, 0xFD, 0xFF,
+    0x01, 0x04, 0x00, 0xFC, 0x00, 0x00, 0x11, 0xFA, 0x00, 0x00, 0xBA, 0xFE, 0x00, 0x04, 0xFC, 0xFF,
+    0x2F, 0x00, 0xBA, 0xFA, 0x00, 0x03, 0xBA, 0x00, 0x00, 0xFC, 0xFE, 0xFF, 0x01, 0x2F, 0xBA, 0xFA,
+    0x00, 0x00, 0xBA, 0xFE, 0x00, 0x24, 0xC5, 0xDE, 0x18, 0x00, 0xBA, 0x00, 0x00, 0x50, 0x6F, 0x31,
+    0xAC, 0x00, 0xFA, 0xFF, 0x03, 0xB0, 0x0A, 0x00, 0xF4, 0x02, 0xBA, 0x00, 0x00, 0xB0, 0x0A, 0x00,
+    0xF4, 0x02, 0xBA, 0x00, 0x00, 0x50, 0x5F, 0x31, 0xAC, 0x00, 0xBA, 0xFE, 0x00, 0x04, 0xC5, 0xDE,
+    0x18, 0x00, 0xBA, 0xFA, 0x00, 0x00, 0xBA, 0xFA, 0x00, 0x00, 0xBA, 0xFA, 0x00, 0x02, 0xBA, 0x00,
+    0x00, 0x08, 0x00, 0xFB, 0xFF, 0x2F, 0x00, 0xA7, 0x00, 0x00, 0x43, 0xFE, 0x44, 0x04, 0x04, 0xC8,
+    0x00, 0x00, 0xB8, 0xFE, 0xBB, 0x01, 0x0B, 0xC8, 0xFA, 0x00, 0x20, 0xC8, 0x00, 0x00, 0x20, 0xD9,
+    0xEF, 0x3A, 0x00, 0xF8, 0xFF, 0x02, 0xC0, 0x2B, 0x20, 0xE9, 0x01, 0xC8, 0x00, 0x00, 0xC0, 0x2B,
+    0x10, 0xE8, 0x01, 0xC8, 0x00, 0x00, 0x20, 0xDA, 0xEF, 0x3B, 0x00, 0xC8, 0xFE, 0x00, 0x04, 0x51,
+    0x01, 0x00, 0x00, 0xA7, 0xFE, 0x00, 0x04, 0xF3, 0x02, 0x00, 0x00, 0xC8, 0xFE, 0x00, 0x00, 0xF3,
+    0xFE, 0xFF, 0x00, 0xCF, 0xFE, 0x00, 0x04, 0xF3, 0x02, 0x00, 0x00, 0xC8, 0xFE, 0x00, 0x04, 0xF3,
+    0x02, 0x00, 0x00, 0xC8, 0xFE, 0x00, 0x00, 0xF3, 0xFE, 0xFF, 0x02, 0xCF, 0x00, 0x00, 0x05, 0x00,
+    0xFB, 0xFF, 0x2F, 0x00, 0xB8, 0xFA, 0x00, 0x03, 0xC8, 0x00, 0x00, 0xFB, 0xFE, 0xFF, 0x01, 0x0E,
+    0xC8, 0xFD, 0x00, 0x23, 0x01, 0x00, 0x00, 0xC8, 0x00, 0x00, 0x20, 0xFB, 0xEE, 0x4C, 0x00, 0xF8,
+    0xFF, 0x02, 0xC0, 0x1A, 0x00, 0xF7, 0x01, 0xC8, 0x00, 0x00, 0xC0, 0x2B, 0x10, 0xE9, 0x01, 0xC8,
+    0x00, 0x00, 0x20, 0xD9, 0xEF, 0x3B, 0x00, 0xC8, 0xFA, 0x00, 0x00, 0xC8, 0xFE, 0x00, 0x04, 0x30,
+    0xDA, 0xFF, 0xBE, 0x16, 0xFE, 0x00, 0x04, 0xF4, 0x38, 0x01, 0x62, 0x8E, 0xFE, 0x00, 0x00, 0xE8,
+    0xFE, 0x00, 0x00, 0xD9, 0xFE, 0x00, 0x04, 0xF4, 0x39, 0x01, 0x62, 0x8E, 0xFE, 0x00, 0x06, 0x30,
+    0xDA, 0xFF, 0xBE, 0x05, 0x00, 0x00, 0xFD, 0x00, 0x09, 0x88, 0x90, 0x0B, 0x10, 0xFF, 0xEF, 0x00,
+    0xAA, 0xA0, 0x0B, 0xFD, 0x00, 0x09, 0xAA, 0xA0, 0x0B, 0xFA, 0xFF, 0xFF, 0x3F, 0xAA, 0xA0, 0x0B,
+    0xFD, 0x00, 0x2C, 0xAA, 0xA0, 0x0B, 0x10, 0xE9, 0x8D, 0x00, 0xAA, 0xA0, 0x0B, 0xA0, 0x1B, 0xD2,
+    0x08, 0xFA, 0xFF, 0x0B, 0xF1, 0x04, 0x60, 0x0E, 0xAA, 0xA0, 0x0B, 0xF1, 0x04, 0x60, 0x0E, 0xAA,
+    0xA0, 0x0B, 0xB0, 0x1B, 0xD2, 0x08, 0xAA, 0xA0, 0x0B, 0x10, 0xE9, 0x8E, 0x00, 0xAA, 0xA0, 0x0B,
+    0xFD, 0x00, 0x02, 0xAA, 0xA0, 0x0B, 0xFD, 0x00, 0x02, 0xAA, 0xA0, 0x0B, 0xFD, 0x00, 0x02, 0xAA,
+    0xA0, 0x0B, 0x06, 0x00, 0xFC, 0xFF, 0x04, 0xB4, 0x70, 0x0C, 0xFC, 0x00, 0x0A, 0xE5, 0x70, 0x0D,
+    0x00, 0xF7, 0xFF, 0xFF, 0xBF, 0xE5, 0x70, 0x0D, 0xFC, 0x00, 0x22, 0xE5, 0x70, 0x0D, 0x00, 0x10,
+    0xEA, 0xCE, 0x05, 0xF5, 0xFF, 0x0D, 0x00, 0xA0, 0x2B, 0x51, 0x2F, 0xE5, 0x70, 0x0D, 0x00, 0xA0,
+    0x1B, 0x40, 0x2F, 0xE5, 0x70, 0x0D, 0x00, 0x10, 0xEA, 0xCE, 0x05, 0xE5, 0x70, 0x0D, 0xFC, 0x00,
+    0x02, 0xA4, 0x50, 0x09, 0xFE, 0x00, 0x03, 0x41, 0x01, 0x10, 0x04, 0xFD, 0x00, 0x03, 0xF4, 0x02,
+    0x50, 0x0F, 0xFD, 0x00, 0x03, 0xFB, 0x06, 0x90, 0x5F, 0xFE, 0x00, 0x16, 0xB2, 0x5E, 0x4D, 0xD5,
+    0xE4, 0x18, 0x00, 0x20, 0xCE, 0x03, 0xE4, 0x3D, 0x30, 0xCD, 0x00, 0x00, 0x03, 0x00, 0x20, 0x01,
+    0x00, 0x20, 0x00, 0xF9, 0x00, 0x05, 0xFC, 0xFF, 0x04, 0xC5, 0x70, 0x0D, 0xFD, 0x00, 0x09, 0xE5,
+    0x70, 0x0D, 0xF7, 0xFF, 0xFF, 0xBF, 0xE5, 0x70, 0x0D, 0xFD, 0x00, 0x1E, 0xE5, 0x70, 0x0D, 0x20,
+    0xEA, 0xCE, 0x06, 0xF5, 0xFF, 0x0D, 0xB0, 0x2B, 0x41, 0x3F, 0xE5, 0x70, 0x0D, 0xB0, 0x1A, 0x40,
+    0x3F, 0xE5, 0x70, 0x0D, 0x20, 0xEA, 0xDF, 0x06, 0xE5, 0x70, 0x0D, 0xFD, 0x00, 0x25, 0x73, 0x70,
+    0x0D, 0x00, 0x00, 0xB7, 0xFE, 0xDF, 0x6B, 0x01, 0x00, 0xB0, 0x5D, 0x02, 0x21, 0xE6, 0x09, 0x00,
+    0xF1, 0x06, 0x00, 0x00, 0x90, 0x0E, 0x00, 0xB0, 0x5D, 0x02, 0x21, 0xE6, 0x08, 0x00, 0x00, 0xB6,
+    0xFE, 0xDF, 0x5B, 0x00, 0xFC, 0x00, 0x08, 0x40, 0x02, 0x00, 0xF9, 0xFF, 0xAF, 0x00, 0xD0, 0x08,
+    0xFC, 0x00, 0x02, 0xD0, 0x08, 0xF7, 0xFE, 0xFF, 0x02, 0x8F, 0xD0, 0x08, 0xFC, 0x00, 0x24, 0xD0,
+    0x08, 0x00, 0xC5, 0xEE, 0x4B, 0xB0, 0xFB, 0x08, 0x50, 0x6F, 0x11, 0xF7, 0x43, 0xD4, 0x08, 0x90,
+    0x0C, 0x00, 0xE0, 0x06, 0xD0, 0x08, 0x50, 0x5F, 0x11, 0xF7, 0xF3, 0xFF, 0x08, 0x00, 0xC5, 0xEE,
+    0x4B, 0x00, 0xD0, 0x08, 0xFC, 0x00, 0x0B, 0xD0, 0x08, 0x00, 0x30, 0x03, 0x00, 0x00, 0x60, 0x03,
+    0x00, 0x90, 0x0C, 0xFC, 0x00, 0x01, 0x90, 0x0C, 0xFC, 0x00, 0x00, 0x90, 0xFD, 0xFF, 0x00, 0x0C,
+    0x04, 0x00, 0x00, 0xF9, 0xFF, 0xDF, 0xF8, 0x00, 0x00, 0x40, 0xFC, 0xFF, 0x00, 0x08, 0xF8, 0x00,
+    0x1F, 0xC8, 0xFF, 0x9D, 0x02, 0x00, 0x00, 0xA0, 0x4D, 0x11, 0xA3, 0x1E, 0x00, 0x00, 0xF0, 0x07,
+    0x00, 0x20, 0x4F, 0x00, 0x00, 0xA0, 0x4D, 0x11, 0xA3, 0x1D, 0x00, 0x00, 0x10, 0xD8, 0xFF, 0x9D,
+    0x02, 0xFD, 0x00, 0x00, 0xD8, 0xFE, 0x00, 0x00, 0xFA, 0xFC, 0xFF, 0x00, 0xEF, 0xFC, 0x00, 0x00,
+    0x31, 0xFA, 0x00, 0x00, 0xE6, 0xFE, 0x00, 0x04, 0xF8, 0xFF, 0x5F, 0x00, 0xE6, 0xFA, 0x00, 0x03,
+    0xE6, 0x00, 0x00, 0xF6, 0xFE, 0xFF, 0x01, 0x6F, 0xE6, 0xFA, 0x00, 0x00, 0xE6, 0xFE, 0x00, 0x14,
+    0xC7, 0xEE, 0x7C, 0x00, 0xE6, 0x00, 0x00, 0x60, 0x5F, 0x11, 0xE4, 0x06, 0xF6, 0xFF, 0x04, 0x60,
+    0x4F, 0x11, 0xE4, 0x07, 0xE6, 0xFE, 0x00, 0x04, 0xD7, 0xFF, 0x8D, 0x00, 0xE6, 0xFD, 0x00, 0x03,
+    0xC9, 0x00, 0x00, 0xE6, 0xFD, 0x00, 0x0B, 0xCA, 0x11, 0x43, 0xE6, 0x00, 0x00, 0xFC, 0xFF, 0xFF,
+    0xDE, 0xAC, 0xE6, 0xFA, 0x00, 0x00, 0xE6, 0xFA, 0x00, 0x00, 0xE6, 0xFA, 0x00, 0x02, 0x31, 0x00,
+    0x00, 0x05, 0x00, 0x42, 0x44, 0x24, 0x00, 0x41, 0xFE, 0x00, 0x04, 0xB5, 0xBB, 0x7B, 0x00, 0xF6,
+    0xFA, 0x00, 0x03, 0xF6, 0x00, 0x00, 0xF4, 0xFE, 0xFF, 0x21, 0x8F, 0xF6, 0x00, 0x00, 0x50, 0x5F,
+    0x01, 0xE4, 0x07, 0xF6, 0x00, 0x00, 0x50, 0x5F, 0x01, 0xE4, 0x07, 0xF6, 0x44, 0x00, 0x00, 0xC6,
+    0xFF, 0x8D, 0x00, 0xF6, 0xBB, 0x01, 0x00, 0x00, 0xE8, 0x00, 0x00, 0xF6, 0xFD, 0x00, 0x0B, 0xE8,
+    0x10, 0x43, 0xF6, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xDE, 0xAC, 0xF6, 0xFA, 0x00, 0x00, 0x52, 0xFE,
+    0x00, 0x00, 0xF7, 0xFD, 0xFF, 0xFA, 0x00, 0x00, 0xF6, 0xFA, 0x00, 0x00, 0xF6, 0xFA, 0x00, 0x02,
+    0xD5, 0x00, 0x00, 0x04, 0x00, 0x00, 0xF9, 0xFF, 0xDF, 0xF8, 0x00, 0x00, 0x40, 0xFC, 0xFF, 0x00,
+    0x08, 0xF9, 0x00, 0x19, 0x20, 0xD9, 0xFF, 0xBE, 0x04, 0x00, 0x00, 0xD0, 0x3B, 0x01, 0x82, 0x2F,
+    0x00, 0x00, 0xD0, 0x3B, 0x01, 0x82, 0x2F, 0x00, 0x00, 0x20, 0xD9, 0xFF, 0xAE, 0x04, 0xF9, 0x00,
+    0x00, 0xFA, 0xFC, 0xFF, 0x00, 0xEF, 0xFE, 0x00, 0x00, 0xF6, 0xFB, 0x00, 0x00, 0xF6, 0xFB, 0x00,
+    0x00, 0xF6, 0xFB, 0x00, 0x00, 0xF6, 0xFE, 0x00,
+};
@@ -0,0 +1,10 @@
+/* Generated by Tools/fontgen/fontgen.py, do not edit */
+#ifndef __FONT_NANUM16_KO_H__
+#define __FONT_NANUM16_KO_H__
+
+#include <stdint.h>
+
+/* nanum.ttf, 16 px, A4, 136 glyphs, 0 kerning pairs, 11608 bitmap bytes (13541 unpacked), store 15928 bytes, 36 index pages, open with gfx_font_open(&font, (uint32_t)font_nanum16_ko_store) */
+extern const uint8_t font_nanum16_ko_store[15928];
+
+#endif /* __FONT_NANUM16_KO_H__ */
@@ -0,0 +1,199 @@
+/**
+ * @file img_encode.c
+ * @brief LZ4 (RGB565) and QOI encoders for generated test images, same output as Tools/imgcodec
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#include <string.h>
+
+#include "gfx_image.h"
+#include "img_encode.h"
+
+#define LZ4_HASH_BITS           14
+#define LZ4_MIN_MATCH           4
+#define LZ4_LAST_LITERALS       5
+#define LZ4_MF_LIMIT            12
+
+typedef struct {
+    uint8_t    *p;
+    uint8_t    *end;
+} enc_out_t;
+
+static int enc_byte(enc_out_t *o, uint32_t b)
+{
+    if (o->p >= o->end) {
+        return 0;
+    }
+    *o->p++ = (uint8_t)b;
+    return 1;
+}
+
+static int enc_length(enc_out_t *o, uint32_t n)
+{
+    for (; n >= 255U; n -= 255U) {
+        if (!enc_byte(o, 255U)) {
+            return 0;
+        }
+    }
+    return enc_byte(o, n);
+}
+
+static int enc_sequence(enc_out_t *o, const uint8_t *lit, uint32_t lit_len, uint32_t offset, uint32_t match)
+{
+    uint32_t ml = match ? match - LZ4_MIN_MATCH : 0;
+
+    if (!enc_byte(o, ((lit_len < 15U ? lit_len : 15U) << 4) | (ml < 15U ? ml : 15U)) ||
+        (lit_len >= 15U && !enc_length(o, lit_len - 15U)) || (uint32_t)(o->end - o->p) < lit_len) {
+        return 0;
+    }
+    memcpy(o->p, lit, lit_len);
+    o->p += lit_len;
+    if (match) {
+        if (!enc_byte(o, offset & 0xFFU) || !enc_byte(o, offset >> 8) || (ml >= 15U && !enc_length(o, ml - 15U))) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static uint32_t enc_read32(const uint8_t *p)
+{
+    uint32_t v;
+
+    memcpy(&v, p, 4);
+    return v;
+}
+
+uint32_t img_encode_lz4(const uint16_t *pixels, uint16_t width, uint16_t height, uint16_t window,
+                        uint8_t *out, uint32_t cap)
+{
+    static uint32_t table[1U << LZ4_HASH_BITS];
+    const uint8_t *in = (const uint8_t *)pixels;
+    uint32_t n = (uint32_t)width * height * 2U;
+    uint32_t ip = 0, anchor = 0, limit = (n > LZ4_MF_LIMIT) ? n - LZ4_MF_LIMIT : 0;
+    gfx_img_lz4_header_t h;
+    enc_out_t o;
+
+    if (cap < sizeof(h)) {
+        return 0;
+    }
+    o.p = out + sizeof(h);
+    o.end = out + cap;
+    memset(table, 0xFF, sizeof(table));
+
+    while (ip < limit) {
+        uint32_t v = enc_read32(in + ip);
+        uint32_t slot = (v * 2654435761U) >> (32 - LZ4_HASH_BITS);
+        uint32_t ref = table[slot];
+        uint32_t len = LZ4_MIN_MATCH;
+
+        table[slot] = ip;
+        if (ref == 0xFFFFFFFFU || ip - ref > window || enc_read32(in + ref) != v) {
+            ip++;
+            continue;
+        }
+        while (ip + len < n - LZ4_LAST_LITERALS && in[ref + len] == in[ip + len]) {
+            len++;
+        }
+        if (!enc_sequence(&o, in + anchor, ip - anchor, ip - ref, len)) {
+            return 0;
+        }
+        ip += len;
+        anchor = ip;
+    }
+    if (!enc_sequence(&o, in + anchor, n - anchor, 0, 0)) {
+        return 0;
+    }
+
+    h.magic = GFX_IMG_LZ4_MAGIC;
+    h.width = width;
+    h.height = height;
+    h.size = (uint32_t)(o.p - out) - sizeof(h);
+    h.window = window;
+    h.reserved = 0;
+    memcpy(out, &h, sizeof(h));
+    return (uint32_t)(o.p - out);
+}
+
+static uint32_t qoi_hash(const uint8_t *px)
+{
+    return (px[0] * 3U + px[1] * 5U + px[2] * 7U + px[3] * 11U) & 63U;
+}
+
+uint32_t img_encode_qoi(const uint32_t *argb, uint16_t width, uint16_t height, uint8_t *out, uint32_t cap)
+{
+    uint8_t index[64][4];
+    uint8_t prev[4] = { 0, 0, 0, 255 };
+    uint32_t n = (uint32_t)width * height;
+    uint32_t run = 0;
+    enc_out_t o = { out, out + cap };
+    const uint8_t header[GFX_IMG_QOI_HEADER_SIZE] = {
+        'q', 'o', 'i', 'f',
+        0, 0, (uint8_t)(width >> 8), (uint8_t)width,
+        0, 0, (uint8_t)(height >> 8), (uint8_t)height,
+        3, 0,
+    };
+
+    memset(index, 0, sizeof(index));
+    for (uint32_t i = 0; i < sizeof(header); i++) {
+        if (!enc_byte(&o, header[i])) {
+            return 0;
+        }
+    }
+
+    for (uint32_t i = 0; i < n; i++) {
+        uint8_t px[4] = { (uint8_t)(argb[i] >> 16), (uint8_t)(argb[i] >> 8), (uint8_t)argb[i], 255 };
+        uint32_t h;
+
+        if (!memcmp(px, prev, 4)) {
+            run++;
+            if (run == 62U || i == n - 1U) {
+                if (!enc_byte(&o, 0xC0U | (run - 1U))) {
+                    return 0;
+                }
+                run = 0;
+            }
+            continue;
+        }
+        if (run) {
+            if (!enc_byte(&o, 0xC0U | (run - 1U))) {
+                return 0;
+            }
+            run = 0;
+        }
+        h = qoi_hash(px);
+        if (!memcmp(index[h], px, 4)) {
+            if (!enc_byte(&o, h)) {
+                return 0;
+            }
+        } else {
+            int32_t dr = (int8_t)(px[0] - prev[0]);
+            int32_t dg = (int8_t)(px[1] - prev[1]);
+            int32_t db = (int8_t)(px[2] - prev[2]);
+            int ok;
+
+            memcpy(index[h], px, 4);
+            if (dr >= -2 && dr <= 1 && dg >= -2 && dg <= 1 && db >= -2 && db <= 1) {
+                ok = enc_byte(&o, 0x40U | (uint32_t)((dr + 2) << 4) | (uint32_t)((dg + 2) << 2) | (uint32_t)(db + 2));
+            } else if (dg >= -32 && dg <= 31 && dr - dg >= -8 && dr - dg <= 7 && db - dg >= -8 && db - dg <= 7) {
+                ok = enc_byte(&o, 0x80U | (uint32_t)(dg + 32)) &&
+                     enc_byte(&o, (uint32_t)((dr - dg + 8) << 4) | (uint32_t)(db - dg + 8));
+            } else {
+                ok = enc_byte(&o, 0xFEU) && enc_byte(&o, px[0]) && enc_byte(&o, px[1]) && enc_byte(&o, px[2]);
+            }
+            if (!ok) {
+                return 0;
+            }
+        }
+        memcpy(prev, px, 4);
+    }
+
+    for (uint32_t i = 0; i < 8U; i++) {
+        if (!enc_byte(&o, i == 7U)) {
+            return 0;
+        }
+    }
+    return (uint32_t)(o.p - out);
+}
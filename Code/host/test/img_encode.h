@@ -0,0 +1,27 @@
+/**
+ * @file img_encode.h
+ * @brief LZ4 (RGB565) and QOI encoders for generated test images, same output as Tools/imgcodec
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#ifndef __IMG_ENCODE_H__
+#define __IMG_ENCODE_H__
+
+#include <stdint.h>
+
+/**
+ * @brief gfx_img_lz4_header_t + LZ4 block, match offsets <= window
+ * @return bytes written, 0 if cap is too small
+ */
+uint32_t img_encode_lz4(const uint16_t *pixels, uint16_t width, uint16_t height, uint16_t window,
+                        uint8_t *out, uint32_t cap);
+
+/**
+ * @brief Standard QOI, RGB channels of ARGB8888 pixels
+ * @return bytes written, 0 if cap is too small
+ */
+uint32_t img_encode_qoi(const uint32_t *argb, uint16_t width, uint16_t height, uint8_t *out, uint32_t cap);
+
+#endif /* __IMG_ENCODE_H__ */
@@ -0,0 +1,2174 @@
+/**
+ * @file render_scenes.c
+ * @brief Scene table of the render suite: fills, blends, images, vectors and text drawn with the firmware code
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note Every scene draws from a cleared frame buffer and only inside the
+ *       capture window, bench passes may use the whole screen. Source data
+ *       is generated, so the goldens only depend on the drawing code.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "main.h"
+#include "dma2d.h"
+#include "jpeg_codec.h"
+#include "lcd_l8.h"
+#include "lcd_overlay.h"
+#include "lcd_present.h"
+#include "lcd_vfb.h"
+#include "mdma_fetch.h"
+#include "gfx_anim.h"
+#include "gfx_asset.h"
+#include "gfx_blit.h"
+#include "gfx_convert.h"
+#include "gfx_effect.h"
+#include "gfx_font.h"
+#include "gfx_gradient.h"
+#include "gfx_image.h"
+#include "gfx_jpeg.h"
+#include "gfx_scene.h"
+#include "gfx_transform.h"
+#include "gfx_tri.h"
+#include "gfx_vector.h"
+#include "font_lato18.h"
+#include "font_lato40_digits.h"
+#include "font_nanum16_ko.h"
+#include "img_encode.h"
+#include "render_scenes.h"
+#include "sim.h"
+
+#define ASSET_ARGB8888          (SCENE_ASSET_ADDR)                  // 400x240 ARGB8888
+#define ASSET_RGB565            (SCENE_ASSET_ADDR + 0x60000UL)      // 400x240 RGB565
+#define ASSET_L8                (SCENE_ASSET_ADDR + 0x90000UL)      // 400x240 L8
+#define ASSET_A8                (SCENE_ASSET_ADDR + 0xB0000UL)      // 400x240 A8
+#define ASSET_UI                (SCENE_ASSET_ADDR + 0xD0000UL)      // 400x240 RGB565, flat UI art
+#define ASSET_LZ4               (SCENE_ASSET_ADDR + 0x100000UL)     // ASSET_UI, LZ4
+#define ASSET_QOI               (SCENE_ASSET_ADDR + 0x140000UL)     // ASSET_ARGB8888 colours, QOI
+#define ASSET_CODEC_CAP         0x40000UL
+#define ASSET_BUNDLE            (SCENE_ASSET_ADDR + 0x200000UL)     // test_assets.bin, "flashed" at start up
+#define ASSET_JPEG              (SCENE_ASSET_ADDR + 0x300000UL)     // Tools/mjpeg test streams, 256 KB each
+#define ASSET_JPEG_SLOT         0x40000UL
+#define ASSET_JPEG_STREAM       (SCENE_ASSET_ADDR + 0x480000UL)     // Frame assembly buffer
+#define ASSET_ANIM              (SCENE_ASSET_ADDR + 0x500000UL)     // Sprite sheets, 128 KB
+#define ASSET_W                 400U
+#define ASSET_H                 240U
+#define OVERLAY_ADDR            0x24000000UL                        // RAM, 64x48 ARGB4444
+#define SCENE_DMA_DATA          __attribute__((section(".sram_bss"), aligned(32)))   // Test images read by DMA2D, not in DTCM
+
+static uint8_t assets_ready = 0;
+static uint32_t asset_lz4_size = 0;
+static uint32_t asset_qoi_size = 0;
+
+/* Panels with borders, a stepped gradient bar and a repeated icon: what LZ4 is meant for */
+static uint16_t scene_ui_pixel(uint32_t x, uint32_t y)
+{
+    uint32_t px = x % 130U, py = y % 110U;
+
+    if (y >= 220U && y < 236U) {
+        return GFX_RGB565((x * 255U / ASSET_W) & 0xF0U, 0x80, 0xFF - ((x * 255U / ASSET_W) & 0xF0U));
+    }
+    if (px < 8U || py < 8U || y >= 220U) {
+        return GFX_RGB565(16, 20, 28);                      // Background
+    }
+    if (px == 8U || py == 8U || px == 129U || py == 109U) {
+        return GFX_RGB565(90, 110, 140);                    // Panel border
+    }
+    if (px >= 20U && px < 52U && py >= 20U && py < 52U) {
+        return (((px - 20U) ^ (py - 20U)) & 8U) ? GFX_RGB565(255, 200, 40) : GFX_RGB565(40, 60, 90);
+    }
+    return ((x / 130U + y / 110U) & 1U) ? GFX_RGB565(40, 48, 64) : GFX_RGB565(32, 56, 48);
+}
+
+static void scene_make_assets(void)
+{
+    volatile uint32_t *argb = (volatile uint32_t *)ASSET_ARGB8888;
+    volatile uint16_t *rgb565 = (volatile uint16_t *)ASSET_RGB565;
+    volatile uint8_t *l8 = (volatile uint8_t *)ASSET_L8;
+    volatile uint8_t *a8 = (volatile uint8_t *)ASSET_A8;
+
+    for (uint32_t y = 0; y < ASSET_H; y++) {
+        for (uint32_t x = 0; x < ASSET_W; x++) {
+            uint32_t i = y * ASSET_W + x;
+            uint32_t r = (x * 255U) / (ASSET_W - 1U);
+            uint32_t g = (y * 255U) / (ASSET_H - 1U);
+            uint32_t b = ((x ^ y) & 0x20U) ? 0xC0U : 0x40U;
+            int32_t dx = (int32_t)(x % 64U) - 32, dy = (int32_t)(y % 64U) - 32;
+            int32_t d2 = dx * dx + dy * dy;
+
+            /* Alpha: radial falloff per 64x64 cell */
+            argb[i] = ((uint32_t)(d2 >= 1024 ? 0 : 255 - d2 * 255 / 1024) << 24) | (r << 16) | (g << 8) | b;
+            rgb565[i] = (uint16_t)(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+            l8[i] = lcd_l8_index_rgb332((uint8_t)r, (uint8_t)g, (uint8_t)b);
+            /* Coverage mask: anti-aliased ring, what a glyph looks like to DMA2D */
+            a8[i] = (uint8_t)(d2 < 400 ? 0 : (d2 < 500 ? (d2 - 400) * 255 / 100 : (d2 < 900 ? 255 : (d2 < 1000 ? (1000 - d2) * 255 / 100 : 0))));
+            ((volatile uint16_t *)ASSET_UI)[i] = scene_ui_pixel(x, y);
+        }
+    }
+    asset_lz4_size = img_encode_lz4((const uint16_t *)ASSET_UI, ASSET_W, ASSET_H, GFX_IMG_LZ4_RING,
+                                    (uint8_t *)ASSET_LZ4, ASSET_CODEC_CAP);
+    asset_qoi_size = img_encode_qoi((const uint32_t *)ASSET_ARGB8888, ASSET_W, ASSET_H,
+                                    (uint8_t *)ASSET_QOI, ASSET_CODEC_CAP);
+    assets_ready = 1;
+}
+
+/* One DMA2D job through the HAL, the way application code drives PFC and blending */
+static void scene_dma2d(uint32_t mode, uint32_t fg, uint32_t fg_cm, uint32_t fg_pitch, uint32_t fg_color,
+                        uint32_t bg, uint32_t bg_cm, uint32_t bg_pitch,
+                        uint32_t dst, uint32_t dst_pitch, uint32_t w, uint32_t h)
+{
+    hdma2d.Init.Mode = mode;
+    hdma2d.Init.ColorMode = DMA2D_OUTPUT_RGB565;
+    hdma2d.Init.OutputOffset = dst_pitch - w;
+    hdma2d.LayerCfg[DMA2D_FOREGROUND_LAYER].InputColorMode = fg_cm;
+    hdma2d.LayerCfg[DMA2D_FOREGROUND_LAYER].InputOffset = fg_pitch - w;
+    hdma2d.LayerCfg[DMA2D_FOREGROUND_LAYER].AlphaMode = DMA2D_NO_MODIF_ALPHA;
+    hdma2d.LayerCfg[DMA2D_FOREGROUND_LAYER].InputAlpha = fg_color;
+    hdma2d.LayerCfg[DMA2D_BACKGROUND_LAYER].InputColorMode = bg_cm;
+    hdma2d.LayerCfg[DMA2D_BACKGROUND_LAYER].InputOffset = bg_pitch - w;
+    hdma2d.LayerCfg[DMA2D_BACKGROUND_LAYER].AlphaMode = DMA2D_NO_MODIF_ALPHA;
+    hdma2d.LayerCfg[DMA2D_BACKGROUND_LAYER].InputAlpha = 0;
+
+    if (HAL_DMA2D_Init(&hdma2d) != HAL_OK ||
+        HAL_DMA2D_ConfigLayer(&hdma2d, DMA2D_FOREGROUND_LAYER) != HAL_OK ||
+        (mode == DMA2D_M2M_BLEND && HAL_DMA2D_ConfigLayer(&hdma2d, DMA2D_BACKGROUND_LAYER) != HAL_OK)) {
+        Error_Handler();
+    }
+    if (mode == DMA2D_M2M_BLEND) {
+        HAL_DMA2D_BlendingStart(&hdma2d, fg, bg, dst, w, h);
+    } else {
+        HAL_DMA2D_Start(&hdma2d, fg, dst, w, h);
+    }
+    HAL_DMA2D_PollForTransfer(&hdma2d, 100);
+}
+
+static uint32_t fb_addr(uint32_t x, uint32_t y)
+{
+    return SCENE_FB_ADDR + (y * SCENE_FB_PITCH + x) * 2U;
+}
+
+void render_scenes_reset(void)
+{
+    if (!assets_ready) {
+        scene_make_assets();
+    }
+    lcd_overlay_show(false);
+    lcd_present_set_address(0, SCENE_FB_ADDR);
+    lcd_present_wait(lcd_present());
+    DMA2D_fill_rect(0, 0, 800, 480, 0x0000);
+}
+
+/* ---------------------------------------------------------------------------
+ * fill
+ */
+static void scene_fill_rects(void)
+{
+    static const uint16_t colors[] = { 0xF800, 0x07E0, 0x001F, 0xFFE0, 0xF81F, 0x07FF, 0xFFFF, 0x8410 };
+
+    DMA2D_fill_rect(0, 0, SCENE_CAPTURE_W, SCENE_CAPTURE_H, 0x2104);
+    for (uint32_t i = 0; i < 24; i++) {
+        uint16_t x = (uint16_t)((i * 37U) % 160U);
+        uint16_t y = (uint16_t)((i * 23U) % 100U);
+
+        DMA2D_fill_rect(x, y, (uint16_t)(1U + (i * 7U) % 31U), (uint16_t)(1U + (i * 5U) % 27U), colors[i % 8U]);
+    }
+}
+
+static uint32_t bench_fill_screen(void)
+{
+    DMA2D_fill_rect(0, 0, 800, 480, 0x1234);
+    return 800U * 480U;
+}
+
+static uint32_t bench_fill_small(void)
+{
+    for (uint32_t i = 0; i < 64; i++) {
+        DMA2D_fill_rect((uint16_t)(i * 12U), (uint16_t)(i * 7U), 16, 16, (uint16_t)i);
+    }
+    return 64U * 16U * 16U;
+}
+
+/* ---------------------------------------------------------------------------
+ * image
+ */
+static void scene_copy_rgb565(void)
+{
+    DMA2D_copy_rect(ASSET_RGB565 + (10U * ASSET_W + 20U) * 2U, ASSET_W, fb_addr(0, 0), SCENE_FB_PITCH,
+                    SCENE_CAPTURE_W, SCENE_CAPTURE_H, DMA2D_INPUT_RGB565);
+}
+
+static uint32_t bench_copy_rgb565(void)
+{
+    DMA2D_copy_rect(ASSET_RGB565, ASSET_W, fb_addr(0, 0), SCENE_FB_PITCH, ASSET_W, ASSET_H, DMA2D_INPUT_RGB565);
+    return ASSET_W * ASSET_H;
+}
+
+static void scene_pfc_argb8888(void)
+{
+    scene_dma2d(DMA2D_M2M_PFC, ASSET_ARGB8888, DMA2D_INPUT_ARGB8888, ASSET_W, 0, 0, 0, 0,
+                fb_addr(0, 0), SCENE_FB_PITCH, SCENE_CAPTURE_W, SCENE_CAPTURE_H);
+}
+
+static uint32_t bench_pfc_argb8888(void)
+{
+    scene_dma2d(DMA2D_M2M_PFC, ASSET_ARGB8888, DMA2D_INPUT_ARGB8888, ASSET_W, 0, 0, 0, 0,
+                fb_addr(0, 0), SCENE_FB_PITCH, ASSET_W, ASSET_H);
+    return ASSET_W * ASSET_H;
+}
+
+/*
+ * Streaming decoders: the whole image is first decoded in 7 line bands and
+ * compared with the source, then drawn clipped (lines skipped above, columns
+ * dropped on both sides).
+ */
+static void scene_decode_check(uint32_t data, uint32_t size, const char *name)
+{
+    static uint16_t lines[7U * ASSET_W];
+    static gfx_img_decoder_t check;
+    gfx_img_decoder_t *dec = &check;
+
+    if (gfx_img_open(dec, data, size) != GFX_IMG_OK) {
+        fprintf(stderr, "render_scenes: %s does not open\n", name);
+        abort();
+    }
+    for (uint32_t y = 0; y < ASSET_H; y += 7U) {
+        uint32_t n = (ASSET_H - y < 7U) ? ASSET_H - y : 7U;
+
+        if (gfx_img_decode(dec, (uint32_t)(uintptr_t)lines, ASSET_W, 0, ASSET_W, 7) != GFX_IMG_OK) {
+            fprintf(stderr, "render_scenes: %s decode error at line %u\n", name, (unsigned)y);
+            abort();
+        }
+        for (uint32_t i = 0; i < n * ASSET_W; i++) {
+            const volatile uint32_t *argb = (const volatile uint32_t *)ASSET_ARGB8888;
+            uint16_t want = (data == ASSET_LZ4) ? ((const volatile uint16_t *)ASSET_UI)[y * ASSET_W + i]
+                          : GFX_RGB565(argb[y * ASSET_W + i] >> 16, argb[y * ASSET_W + i] >> 8, argb[y * ASSET_W + i]);
+
+            if (lines[i] != want) {
+                fprintf(stderr, "render_scenes: %s differs from the source at pixel %u\n", name, (unsigned)(y * ASSET_W + i));
+                abort();
+            }
+        }
+    }
+    if (gfx_img_decode(dec, (uint32_t)(uintptr_t)lines, ASSET_W, 0, ASSET_W, 1) != GFX_IMG_ERR_END) {
+        fprintf(stderr, "render_scenes: %s does not end\n", name);
+        abort();
+    }
+}
+
+static void scene_decode(void)
+{
+    gfx_canvas_t cv;
+
+    scene_decode_check(ASSET_LZ4, asset_lz4_size, "lz4");
+    scene_decode_check(ASSET_QOI, asset_qoi_size, "qoi");
+    gfx_canvas_init(&cv, SCENE_FB_ADDR);
+    cv.clip.w = SCENE_CAPTURE_W;
+    cv.clip.h = SCENE_CAPTURE_H;
+    gfx_img_draw(&cv, ASSET_LZ4, asset_lz4_size, -40, -30);
+    gfx_img_draw(&cv, ASSET_QOI, asset_qoi_size, 96, 64);
+}
+
+/* Decoded in 16 line bands straight into GRAM, 2x2 images cover the screen */
+static uint32_t bench_decode(uint32_t data, uint32_t size)
+{
+    static gfx_img_decoder_t dec;
+
+    for (uint32_t i = 0; i < 4U; i++) {
+        uint32_t dst = fb_addr((i & 1U) * ASSET_W, (i >> 1) * ASSET_H);
+
+        gfx_img_open(&dec, data, size);
+        for (uint32_t y = 0; y < ASSET_H; y += 16U) {
+            gfx_img_decode(&dec, dst + y * SCENE_FB_PITCH * 2U, SCENE_FB_PITCH, 0, ASSET_W, 16);
+        }
+    }
+    return 4U * ASSET_W * ASSET_H;
+}
+
+static uint32_t bench_decode_lz4(void)
+{
+    return bench_decode(ASSET_LZ4, asset_lz4_size);
+}
+
+static uint32_t bench_decode_qoi(void)
+{
+    return bench_decode(ASSET_QOI, asset_qoi_size);
+}
+
+#ifdef RENDER_BUNDLE
+#include "test_assets.h"
+
+static gfx_bundle_t bundle;
+
+static void scene_bundle_load(void)
+{
+    static const char *const names[] = { "icon_wifi", "badge", "logo", "photo", "panel_qoi", "panel", "badge_8888" };
+    FILE *f;
+    long n;
+
+    if (bundle.count != 0U) {
+        return;
+    }
+    f = fopen(RENDER_BUNDLE, "rb");
+    if (f == NULL || fseek(f, 0, SEEK_END) != 0 || (n = ftell(f)) <= 0 || n > 0x100000L || fseek(f, 0, SEEK_SET) != 0 ||
+        fread((void *)ASSET_BUNDLE, 1, (size_t)n, f) != (size_t)n || gfx_asset_open(&bundle, ASSET_BUNDLE) != GFX_ASSET_OK) {
+        fprintf(stderr, "render_scenes: cannot load %s\n", RENDER_BUNDLE);
+        abort();
+    }
+    fclose(f);
+
+    /* Every name resolves to its slot, unknown names miss */
+    for (uint32_t i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+        const gfx_asset_t *a = gfx_asset_find(&bundle, names[i]);
+
+        if (a == NULL || strcmp(gfx_asset_name(&bundle, a), names[i]) != 0 ||
+            ((gfx_asset_addr(&bundle, a) & (GFX_BUNDLE_ALIGN - 1U)) != 0U)) {
+            fprintf(stderr, "render_scenes: asset %s not found\n", names[i]);
+            abort();
+        }
+    }
+    if (gfx_asset_find(&bundle, "missing") != NULL || gfx_asset_find(&bundle, "") != NULL ||
+        gfx_asset_at(&bundle, ASSET_COUNT) != NULL || bundle.count != ASSET_COUNT) {
+        fprintf(stderr, "render_scenes: bundle lookup is broken\n");
+        abort();
+    }
+}
+
+/* Every format of the bundle: RGB565, L8 + CLUT, A8 tinted, ARGB4444 / ARGB8888 blended, LZ4 / QOI, clipped */
+static void scene_bundle(void)
+{
+    gfx_canvas_t cv;
+
+    scene_bundle_load();
+    gfx_canvas_init(&cv, SCENE_FB_ADDR);
+    cv.clip.w = SCENE_CAPTURE_W;
+    cv.clip.h = SCENE_CAPTURE_H;
+    DMA2D_fill_rect(0, 0, SCENE_CAPTURE_W, SCENE_CAPTURE_H, GFX_RGB565(48, 48, 48));
+    gfx_asset_draw(&cv, &bundle, gfx_asset_at(&bundle, ASSET_PHOTO), 0, 0, 0xFFFFFFFFUL);
+    gfx_asset_draw(&cv, &bundle, gfx_asset_find(&bundle, "logo"), 124, 2, 0xFFFFFFFFUL);
+    gfx_asset_draw(&cv, &bundle, gfx_asset_find(&bundle, "badge"), 4, 36, 0xFFFFFFFFUL);
+    gfx_asset_draw(&cv, &bundle, gfx_asset_find(&bundle, "badge_8888"), 48, 36, 0x80FFFFFFUL);
+    gfx_asset_draw(&cv, &bundle, gfx_asset_find(&bundle, "icon_wifi"), 130, 64, GFX_ARGB(255, 80, 220, 255));
+    gfx_asset_draw(&cv, &bundle, gfx_asset_find(&bundle, "panel"), -20, 84, 0xFFFFFFFFUL);
+    gfx_asset_draw(&cv, &bundle, gfx_asset_find(&bundle, "panel_qoi"), 150, 100, 0xFFFFFFFFUL);
+}
+
+static uint32_t bench_bundle(void)
+{
+    static const uint8_t slots[] = { ASSET_PHOTO, ASSET_LOGO, ASSET_BADGE, ASSET_ICON_WIFI };
+    gfx_canvas_t cv;
+    uint32_t pixels = 0;
+
+    scene_bundle_load();
+    gfx_canvas_init(&cv, SCENE_FB_ADDR);
+    for (uint32_t i = 0; i < 24U; i++) {
+        const gfx_asset_t *a = gfx_asset_at(&bundle, slots[i % 4U]);
+
+        gfx_asset_draw(&cv, &bundle, a, (int16_t)((i % 6U) * 130U), (int16_t)((i / 6U) * 110U), 0xFFFFFFFFUL);
+        pixels += (uint32_t)a->width * a->height;
+    }
+    return pixels;
+}
+#endif
+
+#ifdef RENDER_JPEG_DIR
+enum { JPEG_444 = 0, JPEG_422, JPEG_420, JPEG_RST, JPEG_PAN, JPEG_COUNT };
+
+static const char *const jpeg_names[JPEG_COUNT] = { "photo_444", "photo_422", "photo_420", "logo_rst", "pan" };
+static uint32_t jpeg_size[JPEG_COUNT];
+
+static const uint8_t *jpeg_data(uint32_t i)
+{
+    return (const uint8_t *)(uintptr_t)(ASSET_JPEG + i * ASSET_JPEG_SLOT);
+}
+
+static void scene_jpeg_load(void)
+{
+    char path[512];
+    FILE *f;
+    long n;
+
+    if (jpeg_size[0] != 0U) {
+        return;
+    }
+    for (uint32_t i = 0; i < JPEG_COUNT; i++) {
+        snprintf(path, sizeof(path), "%s/%s.%s", RENDER_JPEG_DIR, jpeg_names[i], (i == JPEG_PAN) ? "mjpeg" : "jpg");
+        f = fopen(path, "rb");
+        if (f == NULL || fseek(f, 0, SEEK_END) != 0 || (n = ftell(f)) <= 0 || n > (long)ASSET_JPEG_SLOT ||
+            fseek(f, 0, SEEK_SET) != 0 || fread((void *)jpeg_data(i), 1, (size_t)n, f) != (size_t)n) {
+            fprintf(stderr, "render_scenes: cannot load %s\n", path);
+            abort();
+        }
+        fclose(f);
+        jpeg_size[i] = (uint32_t)n;
+    }
+}
+
+/* PSNR of the frame buffer at (0, 0) against Pillow's decode of the same file */
+static double scene_jpeg_psnr(const char *name, uint32_t w, uint32_t h)
+{
+    static uint8_t ref[120U * 80U * 3U];
+    const volatile uint16_t *fb = (const volatile uint16_t *)SCENE_FB_ADDR;
+    char path[512];
+    unsigned rw, rh, max;
+    double se = 0.0;
+    FILE *f;
+
+    snprintf(path, sizeof(path), "%s/%s_000.ppm", RENDER_JPEG_DIR, name);
+    f = fopen(path, "rb");
+    if (f == NULL || fscanf(f, "P6 %u %u %u", &rw, &rh, &max) != 3 || fgetc(f) == EOF || rw != w || rh != h ||
+        max != 255U || (size_t)w * h * 3U > sizeof(ref) || fread(ref, 3, (size_t)w * h, f) != (size_t)w * h) {
+        fprintf(stderr, "render_scenes: cannot read %s\n", path);
+        abort();
+    }
+    fclose(f);
+    for (uint32_t y = 0; y < h; y++) {
+        for (uint32_t x = 0; x < w; x++) {
+            uint16_t p = fb[y * SCENE_FB_PITCH + x];
+            const uint8_t *q = &ref[(y * w + x) * 3U];
+            int32_t d[3] = { (int32_t)(((p >> 8) & 0xF8U) | (p >> 13)) - q[0],
+                             (int32_t)(((p >> 3) & 0xFCU) | ((p >> 9) & 0x03U)) - q[1],
+                             (int32_t)(((p << 3) & 0xF8U) | ((p >> 2) & 0x07U)) - q[2] };
+
+            se += (double)(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+        }
+    }
+    return (se == 0.0) ? 99.0 : 10.0 * log10(255.0 * 255.0 * 3.0 * w * h / se);
+}
+
+/* Every sub-sampling and a restart interval against the reference, pixels around the image untouched */
+static void scene_jpeg_check(void)
+{
+    const volatile uint16_t *fb = (const volatile uint16_t *)SCENE_FB_ADDR;
+    gfx_jpeg_info_t info;
+    gfx_canvas_t cv;
+
+    gfx_canvas_init(&cv, SCENE_FB_ADDR);
+    for (uint32_t i = JPEG_444; i <= JPEG_RST; i++) {
+        double psnr;
+
+        DMA2D_fill_rect(0, 0, 200, 100, 0x0000);
+        if (gfx_jpeg_info(jpeg_data(i), jpeg_size[i], &info) != GFX_JPEG_OK ||
+            info.css != ((i == JPEG_RST) ? JPEG_CSS_420 : i) ||
+            gfx_jpeg_draw(&cv, jpeg_data(i), jpeg_size[i], 0, 0) != GFX_JPEG_OK) {
+            fprintf(stderr, "render_scenes: %s does not decode\n", jpeg_names[i]);
+            abort();
+        }
+        for (uint32_t x = 0; x <= info.width; x++) {
+            if (fb[info.height * SCENE_FB_PITCH + x] != 0U || fb[(x * info.height / info.width) * SCENE_FB_PITCH + info.width] != 0U) {
+                fprintf(stderr, "render_scenes: %s writes outside the image\n", jpeg_names[i]);
+                abort();
+            }
+        }
+        if ((psnr = scene_jpeg_psnr(jpeg_names[i], info.width, info.height)) < 30.0) {
+            fprintf(stderr, "render_scenes: %s PSNR %.1f dB against the reference\n", jpeg_names[i], psnr);
+            abort();
+        }
+    }
+
+    /* Top / left clipping is refused, a broken header is reported */
+    if (gfx_jpeg_draw(&cv, jpeg_data(JPEG_420), jpeg_size[JPEG_420], -8, 0) != GFX_JPEG_ERR_CLIP ||
+        gfx_jpeg_draw(&cv, jpeg_data(JPEG_420), 40, 0, 0) != GFX_JPEG_ERR_DECODE ||
+        gfx_jpeg_draw(&cv, jpeg_data(JPEG_420) + 2, jpeg_size[JPEG_420] - 2U, 0, 0) != GFX_JPEG_ERR_DECODE) {
+        fprintf(stderr, "render_scenes: jpeg errors are not reported\n");
+        abort();
+    }
+    DMA2D_fill_rect(0, 0, 800, 480, 0x0000);
+}
+
+/* Frames located in the raw stream, looping, and assembled from odd sized pieces of a byte stream */
+static void scene_mjpeg_check(void)
+{
+    static const uint8_t noise[] = { 0x00, 0xFF, 0xFF, 0xD9, 0x12, 0xFF };
+    const uint8_t *pan = jpeg_data(JPEG_PAN);
+    const uint8_t *frame[6], *f;
+    gfx_jpeg_stream_t stream;
+    gfx_mjpeg_t mjpeg;
+    uint32_t size[6], sz, n = 0, piece = 1;
+
+    gfx_mjpeg_open(&mjpeg, pan, jpeg_size[JPEG_PAN], false);
+    while (n < 7U && gfx_mjpeg_next(&mjpeg, &frame[n < 6U ? n : 5U], &size[n < 6U ? n : 5U]) == GFX_JPEG_OK) {
+        n++;
+    }
+    if (n != 6U || frame[0] != pan || frame[5] + size[5] != pan + jpeg_size[JPEG_PAN]) {
+        fprintf(stderr, "render_scenes: mjpeg has %u frames\n", (unsigned)n);
+        abort();
+    }
+    gfx_mjpeg_open(&mjpeg, pan, jpeg_size[JPEG_PAN], true);
+    for (uint32_t i = 0; i < 13U; i++) {
+        if (gfx_mjpeg_next(&mjpeg, &f, &sz) != GFX_JPEG_OK || f != frame[i % 6U] || sz != size[i % 6U]) {
+            fprintf(stderr, "render_scenes: mjpeg does not loop\n");
+            abort();
+        }
+    }
+    gfx_mjpeg_open(&mjpeg, noise, sizeof(noise), true);
+    if (gfx_mjpeg_next(&mjpeg, &f, &sz) != GFX_JPEG_ERR_END) {
+        fprintf(stderr, "render_scenes: mjpeg finds a frame in noise\n");
+        abort();
+    }
+
+    /* Joined after noise, pieces of 1..97 bytes, frames come out whole and in order */
+    n = 0;
+    gfx_jpeg_stream_init(&stream, (uint8_t *)(uintptr_t)ASSET_JPEG_STREAM, ASSET_JPEG_SLOT);
+    gfx_jpeg_stream_feed(&stream, noise, sizeof(noise));
+    for (uint32_t pos = 0; pos < jpeg_size[JPEG_PAN];) {
+        uint32_t len = jpeg_size[JPEG_PAN] - pos;
+
+        len = (len < piece) ? len : piece;
+        pos += gfx_jpeg_stream_feed(&stream, pan + pos, len);
+        piece = piece % 97U + 7U;
+        if (stream.ready) {
+            if (n >= 6U || stream.len != size[n] || memcmp(stream.buf, frame[n], size[n]) != 0) {
+                fprintf(stderr, "render_scenes: stream frame %u differs\n", (unsigned)n);
+                abort();
+            }
+            n++;
+            gfx_jpeg_stream_release(&stream);
+        }
+    }
+    if (n != 6U || stream.frames != 6U || stream.dropped != 0U) {
+        fprintf(stderr, "render_scenes: stream assembled %u frames\n", (unsigned)n);
+        abort();
+    }
+
+    /* Frames larger than the buffer are dropped, not truncated */
+    gfx_jpeg_stream_init(&stream, (uint8_t *)(uintptr_t)ASSET_JPEG_STREAM, 4096);
+    for (uint32_t pos = 0; pos < jpeg_size[JPEG_PAN];) {
+        pos += gfx_jpeg_stream_feed(&stream, pan + pos, jpeg_size[JPEG_PAN] - pos);
+        if (stream.ready) {
+            gfx_jpeg_stream_release(&stream);
+        }
+    }
+    if (stream.frames != 0U || stream.dropped != 6U) {
+        fprintf(stderr, "render_scenes: stream keeps frames larger than its buffer\n");
+        abort();
+    }
+}
+
+/* All three sub-samplings, cut by the canvas clip on the right and at the bottom */
+static void scene_jpeg(void)
+{
+    gfx_canvas_t cv;
+
+    scene_jpeg_load();
+    scene_jpeg_check();
+    scene_mjpeg_check();
+    gfx_canvas_init(&cv, SCENE_FB_ADDR);
+    cv.clip.w = SCENE_CAPTURE_W;
+    cv.clip.h = SCENE_CAPTURE_H;
+    DMA2D_fill_rect(0, 0, SCENE_CAPTURE_W, SCENE_CAPTURE_H, GFX_RGB565(48, 48, 48));
+    gfx_jpeg_draw(&cv, jpeg_data(JPEG_444), jpeg_size[JPEG_444], 0, 0);
+    gfx_jpeg_draw(&cv, jpeg_data(JPEG_RST), jpeg_size[JPEG_RST], 124, 4);
+    gfx_jpeg_draw(&cv, jpeg_data(JPEG_422), jpeg_size[JPEG_422], 6, 82);
+    gfx_jpeg_draw(&cv, jpeg_data(JPEG_420), jpeg_size[JPEG_420], 130, 70);
+}
+
+/* 800x480 MJPEG playback, 4:2:0: device time is the DMA2D YCbCr conversion, the codec is not modelled */
+static uint32_t bench_mjpeg(void)
+{
+    static gfx_mjpeg_t mjpeg;
+    const uint8_t *frame;
+    uint32_t size;
+    gfx_canvas_t cv;
+
+    scene_jpeg_load();
+    if (mjpeg.data == NULL) {
+        gfx_mjpeg_open(&mjpeg, jpeg_data(JPEG_PAN), jpeg_size[JPEG_PAN], true);
+    }
+    gfx_canvas_init(&cv, SCENE_FB_ADDR);
+    if (gfx_mjpeg_next(&mjpeg, &frame, &size) != GFX_JPEG_OK || gfx_jpeg_draw(&cv, frame, size, 0, 0) != GFX_JPEG_OK) {
+        fprintf(stderr, "render_scenes: mjpeg frame %u does not decode\n", (unsigned)mjpeg.frame);
+        abort();
+    }
+    return 800U * 480U;
+}
+#endif
+
+static void scene_pfc_l8(void)
+{
+    DMA2D_load_clut(lcd_l8_default_clut(), 256);
+    scene_dma2d(DMA2D_M2M_PFC, ASSET_L8 + 50U * ASSET_W + 100U, DMA2D_INPUT_L8, ASSET_W, 0, 0, 0, 0,
+                fb_addr(0, 0), SCENE_FB_PITCH, SCENE_CAPTURE_W, SCENE_CAPTURE_H);
+}
+
+static uint32_t bench_pfc_l8(void)
+{
+    DMA2D_load_clut(lcd_l8_default_clut(), 256);
+    scene_dma2d(DMA2D_M2M_PFC, ASSET_L8, DMA2D_INPUT_L8, ASSET_W, 0, 0, 0, 0,
+                fb_addr(0, 0), SCENE_FB_PITCH, ASSET_W, ASSET_H);
+    return ASSET_W * ASSET_H;
+}
+
+/*
+ * Conversion engine: the same dark gradient truncated by DMA2D and dithered
+ * on the CPU (ARGB8888 and RGB888), then L8 images with their own CLUT per
+ * job (ARGB8888 and RGB888 entries).
+ */
+#define GRAD_W                  192U
+#define GRAD_H                  28U
+
+SCENE_DMA_DATA static uint32_t cvt_grad[GRAD_W * GRAD_H];
+static uint8_t cvt_grad888[GRAD_W * GRAD_H * 3U];
+SCENE_DMA_DATA static uint8_t cvt_l8[96U * 40U];
+SCENE_DMA_DATA static uint32_t cvt_clut_grey[256];
+SCENE_DMA_DATA static uint8_t cvt_clut_heat[256 * 3];
+
+static void scene_cvt_make(void)
+{
+    for (uint32_t y = 0; y < GRAD_H; y++) {
+        for (uint32_t x = 0; x < GRAD_W; x++) {
+            uint32_t r = 8U + x * 40U / GRAD_W, g = 16U + y, b = 40U + x * 60U / GRAD_W;
+
+            cvt_grad[y * GRAD_W + x] = GFX_ARGB(255, r, g, b);
+            cvt_grad888[(y * GRAD_W + x) * 3U] = (uint8_t)(255U - b);
+            cvt_grad888[(y * GRAD_W + x) * 3U + 1U] = (uint8_t)(255U - g * 3U);
+            cvt_grad888[(y * GRAD_W + x) * 3U + 2U] = (uint8_t)(200U - r);
+        }
+    }
+    for (uint32_t i = 0; i < 96U * 40U; i++) {
+        cvt_l8[i] = (uint8_t)((i % 96U) * 255U / 95U);
+    }
+    for (uint32_t i = 0; i < 256U; i++) {
+        cvt_clut_grey[i] = GFX_ARGB(255, i, i, i);
+        cvt_clut_heat[i * 3U] = (uint8_t)((i > 170U) ? (i - 170U) * 3U : 0U);          // B
+        cvt_clut_heat[i * 3U + 1U] = (uint8_t)((i > 85U) ? ((i - 85U) * 3U > 255U ? 255U : (i - 85U) * 3U) : 0U);
+        cvt_clut_heat[i * 3U + 2U] = (uint8_t)((i * 3U > 255U) ? 255U : i * 3U);        // R
+    }
+}
+
+/* A flat 4x4 block keeps its level exactly: 2 * v summed over red / blue, 4 * v over green */
+static void scene_cvt_check(void)
+{
+    static uint32_t flat[16];
+    const gfx_cvt_src_t src = { (uint32_t)(uintptr_t)flat, 4, 4, 4, GFX_CVT_ARGB8888, 0, NULL, 0 };
+    const volatile uint16_t *fb = (const volatile uint16_t *)SCENE_FB_ADDR;
+    gfx_canvas_t cv;
+
+    gfx_canvas_init(&cv, SCENE_FB_ADDR);
+    for (uint32_t v = 0; v < 256U; v++) {
+        uint32_t sr = 0, sg = 0, sb = 0;
+
+        for (uint32_t i = 0; i < 16U; i++) {
+            flat[i] = GFX_ARGB(255, v, v ^ 0x55U, 255U - v);
+        }
+        gfx_cvt_draw(&cv, &src, (int16_t)(4U * (v & 63U) + 1U), (int16_t)(4U * (v >> 6) + 3U), GFX_CVT_DITHER);
+        for (uint32_t i = 0; i < 16U; i++) {
+            uint16_t p = fb[(4U * (v >> 6) + 3U + i / 4U) * SCENE_FB_PITCH + 4U * (v & 63U) + 1U + i % 4U];
+
+            sr += p >> 11;
+            sg += (p >> 5) & 0x3FU;
+            sb += p & 0x1FU;
+        }
+        if ((v <= 248U && sr != 2U * v) || ((v ^ 0x55U) <= 252U && sg != 4U * (v ^ 0x55U)) ||
+            (255U - v <= 248U && sb != 2U * (255U - v))) {
+            fprintf(stderr, "render_scenes: dithered level %u is not kept\n", (unsigned)v);
+            abort();
+        }
+    }
+    DMA2D_fill_rect(0, 0, 800, 480, 0x0000);
+}
+
+static void scene_convert(void)
+{
+    const gfx_cvt_src_t grad = { (uint32_t)(uintptr_t)cvt_grad, GRAD_W, GRAD_W, GRAD_H, GFX_CVT_ARGB8888, 0, NULL, 0 };
+    const gfx_cvt_src_t grad888 = { (uint32_t)(uintptr_t)cvt_grad888, GRAD_W, GRAD_W, GRAD_H, GFX_CVT_RGB888, 0, NULL, 0 };
+    gfx_cvt_src_t l8 = { (uint32_t)(uintptr_t)cvt_l8, 96, 96, 40, GFX_CVT_L8, 0, cvt_clut_grey, 256 };
+    gfx_canvas_t cv;
+
+    scene_cvt_make();
+    scene_cvt_check();
+    gfx_canvas_init(&cv, SCENE_FB_ADDR);
+    cv.clip.w = SCENE_CAPTURE_W;
+    cv.clip.h = SCENE_CAPTURE_H;
+    gfx_cvt_draw(&cv, &grad, 0, 0, GFX_CVT_EXACT);
+    gfx_cvt_draw(&cv, &grad, 0, GRAD_H, GFX_CVT_AUTO);
+    gfx_cvt_draw(&cv, &grad888, 1, 2 * GRAD_H, GFX_CVT_DITHER);            // Odd x: unaligned first pixel
+    gfx_cvt_draw(&cv, &l8, 0, 3 * GRAD_H, GFX_CVT_AUTO);
+    l8.clut = cvt_clut_heat;
+    l8.clut_rgb888 = 1;
+    gfx_cvt_draw(&cv, &l8, 120, 3 * GRAD_H, GFX_CVT_AUTO);                // Cut by the clip
+}
+
+/* The 400x240 ARGB8888 image dithered into GRAM, 2x2 over the screen */
+static uint32_t bench_convert(void)
+{
+    const gfx_cvt_src_t img = { ASSET_ARGB8888, ASSET_W, ASSET_W, ASSET_H, GFX_CVT_ARGB8888, 0, NULL, 0 };
+    gfx_canvas_t cv;
+
+    gfx_canvas_init(&cv, SCENE_FB_ADDR);
+    for (uint32_t i = 0; i < 4U; i++) {
+        gfx_cvt_draw(&cv, &img, (int16_t)((i & 1U) * ASSET_W), (int16_t)((i >> 1) * ASSET_H), GFX_CVT_DITHER);
+    }
+    return 4U * ASSET_W * ASSET_H;
+}
+
+/* ---------------------------------------------------------------------------
+ * gradients
+ */
+static const gfx_grad_stop_t grad_sky[] = {
+    { 0, GFX_ARGB(255, 20, 30, 90) }, { 140, GFX_ARGB(255, 90, 140, 220) }, { 255, GFX_ARGB(255, 250, 200, 150) },
+};
+static const gfx_grad_stop_t grad_glow[] = {
+    { 0, GFX_ARGB(230, 255, 255, 200) }, { 255, GFX_ARGB(0, 255, 160, 40) },
+};
+static gfx_grad_t grad_a, grad_b;
+
+/* Opaque fills must give exactly the colour of each pixel, angled ones may be off by the rounded line shift */
+static void scene_grad_check(const gfx_grad_t *g, const gfx_rect_t *r, uint32_t tolerance, const char *name)
+{
+    for (int32_t y = r->y; y < r->y + r->h; y++) {
+        for (int32_t x = r->x; x < r->x + r->w; x++) {
+            uint32_t c = gfx_grad_color(g, (int16_t)x, (int16_t)y);
+            uint16_t want = GFX_RGB565((c >> 16) & 0xFFU, (c >> 8) & 0xFFU, c & 0xFFU);
+            uint16_t got = *(const volatile uint16_t *)fb_addr((uint32_t)x, (uint32_t)y);
+            int32_t dr = (int32_t)(want >> 11) - (int32_t)(got >> 11);
+            int32_t dg = (int32_t)((want >> 5) & 0x3FU) - (int32_t)((got >> 5) & 0x3FU);
+            int32_t db = (int32_t)(want & 0x1FU) - (int32_t)(got & 0x1FU);
+
+            if ((uint32_t)abs(dr) > tolerance || (uint32_t)abs(dg) > 2U * tolerance || (uint32_t)abs(db) > tolerance) {
+                fprintf(stderr, "render_scenes: %s gradient at (%d, %d) is %04x, expected %04x\n",
+                        name, (int)x, (int)y, got, want);
+                abort();
+            }
+        }
+    }
+}
+
+/* Every path: vertical runs, horizontal doubling, angled template, radial with mirrored lines, two blended ones */
+static void scene_gradients(void)
+{
+    static const gfx_rect_t v = { 0, 0, 96, 64 }, h = { 96, 0, 96, 32 }, ht = { 96, 32, 96, 32 };
+    static const gfx_rect_t d = { 0, 64, 96, 64 }, rad = { 96, 64, 96, 64 }, glow = { 36, 54, 72, 56 };
+    const gfx_grad_stats_t *st = gfx_grad_get_stats();
+    uint32_t runs;
+    gfx_canvas_t cv;
+
+    gfx_canvas_init(&cv, SCENE_FB_ADDR);
+    cv.clip.w = SCENE_CAPTURE_W;
+    cv.clip.h = SCENE_CAPTURE_H;
+
+    gfx_grad_reset_stats();
+    gfx_grad_linear(&grad_a, 0, 0, 0, 63, grad_sky, 3);
+    gfx_grad_fill(&cv, &v, &grad_a);
+    scene_grad_check(&grad_a, &v, 0, "vertical");
+    runs = 1;
+    for (uint32_t y = 1; y < (uint32_t)v.h; y++) {
+        runs += (*(const volatile uint16_t *)fb_addr(0, y) != *(const volatile uint16_t *)fb_addr(0, y - 1U)) ? 1U : 0U;
+    }
+    if (st->lines != 1U || st->jobs != runs) {
+        fprintf(stderr, "render_scenes: vertical gradient took %u lines, %u jobs\n", (unsigned)st->lines, (unsigned)st->jobs);
+        abort();
+    }
+
+    gfx_grad_reset_stats();
+    gfx_grad_linear(&grad_a, 100, 0, 187, 0, grad_sky, 3);
+    gfx_grad_fill(&cv, &h, &grad_a);
+    scene_grad_check(&grad_a, &h, 0, "horizontal");
+    if (st->lines != 1U || st->jobs != 6U) {
+        fprintf(stderr, "render_scenes: horizontal gradient took %u lines, %u jobs\n", (unsigned)st->lines, (unsigned)st->jobs);
+        abort();
+    }
+
+    gfx_grad_linear(&grad_a, 0, 64, 95, 127, grad_sky, 3);
+    gfx_grad_fill(&cv, &d, &grad_a);
+    scene_grad_check(&grad_a, &d, 1, "angled");
+
+    gfx_grad_reset_stats();
+    gfx_grad_radial(&grad_a, 144, 96, 44, grad_sky, 3);
+    gfx_grad_fill(&cv, &rad, &grad_a);
+    scene_grad_check(&grad_a, &rad, 0, "radial");
+    if (st->lines != 32U) {
+        fprintf(stderr, "render_scenes: radial gradient computed %u lines\n", (unsigned)st->lines);
+        abort();
+    }
+
+    /* Translucent: a horizontal band over stripes and a glow over the others */
+    for (uint32_t i = 0; i < 4U; i++) {
+        DMA2D_fill_rect((uint16_t)(96U + i * 24U), 32, 12, 32, GFX_RGB565(200, 200, 200));
+    }
+    gfx_grad_linear(&grad_b, 96, 0, 191, 0, grad_glow, 2);
+    gfx_grad_fill(&cv, &ht, &grad_b);
+    gfx_grad_radial(&grad_b, 72, 82, 30, grad_glow, 2);
+    gfx_grad_fill(&cv, &glow, &grad_b);
+}
+
+static uint32_t bench_grad_vertical(void)
+{
+    static const gfx_rect_t screen = { 0, 0, 800, 480 };
+    gfx_canvas_t cv;
+
+    gfx_canvas_init(&cv, SCENE_FB_ADDR);
+    gfx_grad_linear(&grad_a, 0, 0, 0, 479, grad_sky, 3);
+    gfx_grad_fill(&cv, &screen, &grad_a);
+    return 800U * 480U;
+}
+
+static uint32_t bench_grad_horizontal(void)
+{
+    static const gfx_rect_t screen = { 0, 0, 800, 480 };
+    gfx_canvas_t cv;
+
+    gfx_canvas_init(&cv, SCENE_FB_ADDR);
+    gfx_grad_linear(&grad_a, 0, 0, 799, 0, grad_sky, 3);
+    gfx_grad_fill(&cv, &screen, &grad_a);
+    return 800U * 480U;
+}
+
+static uint32_t bench_grad_radial(void)
+{
+    static const gfx_rect_t screen = { 0, 0, 800, 480 };
+    gfx_canvas_t cv;
+
+    gfx_canvas_init(&cv, SCENE_FB_ADDR);
+    gfx_grad_radial(&grad_a, 400, 240, 300, grad_sky, 3);
+    gfx_grad_fill(&cv, &screen, &grad_a);
+    return 800U * 480U;
+}
+
+/* ---------------------------------------------------------------------------
+ * transform
+ */
+#define NEEDLE_W                12U
+#define NEEDLE_H                72U
+#define XFORM_EPS               (1.0 / 64.0)                        // Reference check margin, pixels
+
+static uint32_t xform_needle[NEEDLE_W * NEEDLE_H];                  // ARGB8888, pivot at (6, 62)
+
+/* Tapered needle with anti-aliased sides and a hub, straight alpha */
+static const gfx_xform_src_t *scene_needle(void)
+{
+    static gfx_xform_src_t img;
+
+    if (img.addr == 0U) {
+        img = (gfx_xform_src_t){ (uint32_t)(uintptr_t)xform_needle, NEEDLE_W, NEEDLE_W, NEEDLE_H, GFX_XFORM_ARGB8888, 0 };
+        for (uint32_t y = 0; y < NEEDLE_H; y++) {
+            for (uint32_t x = 0; x < NEEDLE_W; x++) {
+                double dx = fabs((double)x + 0.5 - 6.0), dy = (double)y + 0.5 - 62.0;
+                double half = (y < 62U) ? 0.5 + 4.5 * (double)y / 62.0 : 5.0;
+                double hub = 5.5 - sqrt(dx * dx + dy * dy);
+                double a = fmax(fmin(half - dx + 0.5, 1.0), fmin(hub + 0.5, 1.0));
+
+                a = (y < 2U) ? 0.0 : fmax(a, 0.0);
+                xform_needle[y * NEEDLE_W + x] = ((uint32_t)(a * 255.0 + 0.5) << 24) |
+                                                 ((hub > 0.0) ? 0xE0E0E0U : 0xFF4020U);
+            }
+        }
+    }
+    return &img;
+}
+
+/*
+ * Compare a full screen transform of the UI image with a double precision
+ * reference. Pixels whose sample point is within 1/64 of a pixel edge are
+ * skipped: the rounding of the 16.16 steps adds up to 0.01 pixels across
+ * the screen. Bilinear allows one LSB per channel for the 8 bit weights.
+ */
+static void scene_xform_check(gfx_xform_filter_t filter, float angle, float scale)
+{
+    const gfx_xform_src_t img = { ASSET_UI, ASSET_W, ASSET_W, ASSET_H, GFX_XFORM_RGB565, 0 };
+    const volatile uint16_t *src = (const volatile uint16_t *)ASSET_UI;
+    const volatile uint16_t *fb = (const volatile uint16_t *)SCENE_FB_ADDR;
+    gfx_xform_matrix_t m;
+    gfx_canvas_t cv;
+    double det, ia, ib, ic, id;
+    uint32_t checked = 0;
+
+    gfx_canvas_init(&cv, SCENE_FB_ADDR);
+    gfx_xform_rotate_scale(&m, 200.0f, 120.0f, 400.0f, 240.0f, angle, scale);
+    DMA2D_fill_rect(0, 0, 800, 480, 0x0000);
+    gfx_xform_draw(&cv, &img, &m, filter, 255);
+
+    det = (double)m.a * m.d - (double)m.b * m.c;
+    ia = m.d / det;
+    ib = -m.b / det;
+    ic = -m.c / det;
+    id = m.a / det;
+    for (uint32_t y = 0; y < 480U; y++) {
+        for (uint32_t x = 0; x < 800U; x++) {
+            double u = ia * (x + 0.5 - m.tx) + ib * (y + 0.5 - m.ty);
+            double v = ic * (x + 0.5 - m.tx) + id * (y + 0.5 - m.ty);
+            uint16_t got = fb[y * SCENE_FB_PITCH + x];
+            bool ok;
+
+            if (filter == GFX_XFORM_NEAREST) {
+                if (fabs(u - floor(u + 0.5)) < XFORM_EPS || fabs(v - floor(v + 0.5)) < XFORM_EPS) {
+                    continue;
+                }
+                ok = (u < 0.0 || v < 0.0 || u >= ASSET_W || v >= ASSET_H) ? (got == 0U)
+                   : (got == src[(uint32_t)v * ASSET_W + (uint32_t)u]);
+            } else {
+                double us = u - 0.5, vs = v - 0.5;
+
+                if (us <= -1.0 - XFORM_EPS || vs <= -1.0 - XFORM_EPS || us >= ASSET_W + XFORM_EPS || vs >= ASSET_H + XFORM_EPS) {
+                    ok = (got == 0U);
+                } else if (us >= XFORM_EPS && vs >= XFORM_EPS && us <= ASSET_W - 1.0 - XFORM_EPS && vs <= ASSET_H - 1.0 - XFORM_EPS) {
+                    uint32_t x0 = (uint32_t)us, y0 = (uint32_t)vs;
+                    double fx = us - x0, fy = vs - y0;
+                    uint16_t p[4] = { src[y0 * ASSET_W + x0], src[y0 * ASSET_W + x0 + 1U],
+                                      src[(y0 + 1U) * ASSET_W + x0], src[(y0 + 1U) * ASSET_W + x0 + 1U] };
+                    static const uint32_t shift[3] = { 11, 5, 0 }, bits[3] = { 5, 6, 5 };
+
+                    ok = true;
+                    for (uint32_t c = 0; c < 3U; c++) {
+                        double e[4], want;
+                        int32_t g = (got >> shift[c]) & ((1U << bits[c]) - 1U);
+
+                        for (uint32_t k = 0; k < 4U; k++) {
+                            uint32_t q = (p[k] >> shift[c]) & ((1U << bits[c]) - 1U);
+
+                            e[k] = (double)((q << (8U - bits[c])) | (q >> (2U * bits[c] - 8U)));
+                        }
+                        want = (e[0] * (1.0 - fx) + e[1] * fx) * (1.0 - fy) + (e[2] * (1.0 - fx) + e[3] * fx) * fy;
+                        ok = ok && (abs(g - (int32_t)want / (1 << (8U - bits[c]))) <= 1);
+                    }
+                } else {
+                    continue;                               // Anti-aliased border
+                }
+            }
+            if (!ok) {
+                fprintf(stderr, "render_scenes: xform %s angle %.2f scale %.2f wrong at (%u, %u)\n",
+                        (filter == GFX_XFORM_NEAREST) ? "nearest" : "bilinear", angle, scale, (unsigned)x, (unsigned)y);
+                abort();
+            }
+            checked++;
+        }
+    }
+    if (checked < 100000U) {
+        fprintf(stderr, "render_scenes: xform check covered only %u pixels\n", (unsigned)checked);
+        abort();
+    }
+}
+
+/* Dial with needles (bilinear), rotated UI art (nearest), an upscaled ARGB8888 image cut by the canvas clip */
+static void scene_xform(void)
+{
+    const gfx_xform_src_t ui = { ASSET_UI, ASSET_W, ASSET_W, ASSET_H, GFX_XFORM_RGB565, 0 };
+    const gfx_xform_src_t argb = { ASSET_ARGB8888, ASSET_W, 64, 64, GFX_XFORM_ARGB8888, 0 };
+    gfx_xform_matrix_t m;
+    gfx_canvas_t cv;
+
+    scene_xform_check(GFX_XFORM_NEAREST, 0.3f, 1.37f);
+    scene_xform_check(GFX_XFORM_NEAREST, 2.2f, 0.61f);
+    scene_xform_check(GFX_XFORM_BILINEAR, -0.7f, 1.61f);
+    scene_xform_check(GFX_XFORM_BILINEAR, 3.9f, 0.83f);
+
+    gfx_canvas_init(&cv, SCENE_FB_ADDR);
+    cv.clip.w = SCENE_CAPTURE_W;
+    cv.clip.h = SCENE_CAPTURE_H;
+    DMA2D_fill_rect(0, 0, 800, 480, 0x0000);
+    DMA2D_fill_rect(0, 0, SCENE_CAPTURE_W, SCENE_CAPTURE_H, GFX_RGB565(24, 32, 48));
+
+    gfx_xform_rotate_scale(&m, 200.0f, 120.0f, 52.0f, 40.0f, 0.4f, 0.25f);
+    gfx_xform_draw(&cv, &ui, &m, GFX_XFORM_NEAREST, 255);
+    gfx_xform_rotate_scale(&m, 32.0f, 32.0f, 178.0f, 112.0f, -0.5f, 1.6f);
+    gfx_xform_draw(&cv, &argb, &m, GFX_XFORM_BILINEAR, 255);
+
+    for (uint32_t i = 0; i < 5U; i++) {
+        gfx_xform_rotate_scale(&m, 6.0f, 62.0f, 140.5f, 52.25f, -2.0f + (float)i * 0.85f, 0.7f);
+        gfx_xform_draw(&cv, scene_needle(), &m, (i & 1U) ? GFX_XFORM_NEAREST : GFX_XFORM_BILINEAR,
+                       (uint8_t)(255U - i * 30U));
+    }
+}
+
+/* The UI image at screen size, a different angle every pass */
+static uint32_t bench_xform(gfx_xform_filter_t filter)
+{
+    static uint32_t pass = 0;
+    const gfx_xform_src_t ui = { ASSET_UI, ASSET_W, ASSET_W, ASSET_H, GFX_XFORM_RGB565, 0 };
+    const gfx_xform_stats_t *st = gfx_xform_get_stats();
+    uint32_t before = st->pixels;
+    gfx_xform_matrix_t m;
+    gfx_canvas_t cv;
+
+    gfx_canvas_init(&cv, SCENE_FB_ADDR);
+    gfx_xform_rotate_scale(&m, 200.0f, 120.0f, 400.0f, 240.0f, (float)(pass++ % 32U) * 0.19635f, 1.5f);
+    gfx_xform_draw(&cv, &ui, &m, filter, 255);
+    return st->pixels - before;
+}
+
+static uint32_t bench_xform_nearest(void)
+{
+    return bench_xform(GFX_XFORM_NEAREST);
+}
+
+static uint32_t bench_xform_bilinear(void)
+{
+    return bench_xform(GFX_XFORM_BILINEAR);
+}
+
+/* ---------------------------------------------------------------------------
+ * triangles
+ */
+#define TRI_TEX                 64U
+#define TRI_EPS                 (1.0 / 32.0)                        // Reference check margin, pixels or texels
+
+static uint16_t tri_coords[TRI_TEX * TRI_TEX];                      // RGB565 slot, texel (u, v) holds u << 6 | v
+static uint16_t tri_glass[TRI_TEX * TRI_TEX];                       // ARGB4444, translucent rings
+static uint32_t tri_seed = 1;
+
+static const gfx_tri_tex_t *scene_tri_textures(gfx_tri_tex_t *glass)
+{
+    static gfx_tri_tex_t coords;
+
+    if (coords.addr == 0U) {
+        coords = (gfx_tri_tex_t){ (uint32_t)(uintptr_t)tri_coords, TRI_TEX, TRI_TEX, TRI_TEX, GFX_TRI_RGB565, 0 };
+        for (uint32_t v = 0; v < TRI_TEX; v++) {
+            for (uint32_t u = 0; u < TRI_TEX; u++) {
+                double dx = (double)u + 0.5 - 32.0, dy = (double)v + 0.5 - 32.0;
+                uint32_t ring = (uint32_t)sqrt(dx * dx + dy * dy) / 6U;
+
+                tri_coords[v * TRI_TEX + u] = (uint16_t)((u << 6) | v);
+                tri_glass[v * TRI_TEX + u] = (uint16_t)(((ring & 1U) ? 0xC000U : 0x6000U) |
+                                                        ((ring & 2U) ? 0x0F84U : 0x04CFU));
+            }
+        }
+    }
+    *glass = (gfx_tri_tex_t){ (uint32_t)(uintptr_t)tri_glass, TRI_TEX, TRI_TEX, TRI_TEX, GFX_TRI_ARGB4444, 0 };
+    return &coords;
+}
+
+/* Vertex position on the 1/16 pixel grid, so the reference sees the snapped triangle */
+static float tri_rand(float lo, float hi)
+{
+    tri_seed = tri_seed * 1103515245U + 12345U;
+    return lo + (float)((uint32_t)((hi - lo) * 16.0f) * ((tri_seed >> 8) & 0xFFFFU) / 0x10000U) / 16.0f;
+}
+
+/*
+ * A 10 x 8 grid of quads with jittered inner vertices, alternating
+ * diagonals and windings, drawn with one translucent texel: every pixel
+ * centre inside the outer rectangle must be blended exactly once, none
+ * outside it. Then a thin sliver must be binned into far fewer tiles than
+ * its bounding box covers.
+ */
+static void scene_tri_check_mesh(void)
+{
+    static const uint16_t white = 0x8FFFU;
+    const gfx_tri_tex_t tex = { (uint32_t)(uintptr_t)&white, 1, 1, 1, GFX_TRI_ARGB4444, 0 };
+    const volatile uint16_t *fb = (const volatile uint16_t *)SCENE_FB_ADDR;
+    const gfx_tri_stats_t *st = gfx_tri_get_stats();
+    gfx_tri_vertex_t grid[9][11];
+    gfx_canvas_t cv;
+    uint16_t once = 0;
+
+    for (uint32_t j = 0; j < 9U; j++) {
+        for (uint32_t i = 0; i < 11U; i++) {
+            bool inner = (i > 0U && i < 10U && j > 0U && j < 8U);
+
+            grid[j][i] = (gfx_tri_vertex_t){ 20.25f + (float)i * 31.0f + (inner ? tri_rand(-9.0f, 9.0f) : 0.0f),
+                                             30.75f + (float)j * 29.0f + (inner ? tri_rand(-9.0f, 9.0f) : 0.0f),
+                                             0.5f, 0.5f, 1.0f };
+        }
+    }
+    gfx_canvas_init(&cv, SCENE_FB_ADDR);
+    DMA2D_fill_rect(0, 0, 800, 480, 0x0000);
+    gfx_tri_begin(&cv);
+    for (uint32_t j = 0; j < 8U; j++) {
+        for (uint32_t i = 0; i < 10U; i++) {
+            gfx_tri_vertex_t q[4] = { grid[j][i], grid[j][i + 1U], grid[j + 1U][i + 1U], grid[j + 1U][i] };
+            gfx_tri_vertex_t a[3] = { q[0], q[1], q[3] }, b[3] = { q[1], q[2], q[3] };
+
+            if ((i + j) & 1U) {
+                gfx_tri_add_quad(q, &tex, GFX_TRI_AFFINE);
+            } else {
+                gfx_tri_add(a, &tex, GFX_TRI_AFFINE);
+                b[0] = q[3];
+                b[2] = q[1];                                // Other winding
+                gfx_tri_add(b, &tex, GFX_TRI_AFFINE);
+            }
+        }
+    }
+    gfx_tri_end();
+
+    for (uint32_t y = 0; y < 480U; y++) {
+        for (uint32_t x = 0; x < 800U; x++) {
+            bool inside = (x + 0.5 > 20.25 && x + 0.5 < 330.25 && y + 0.5 > 30.75 && y + 0.5 < 262.75);
+            uint16_t got = fb[y * SCENE_FB_PITCH + x];
+
+            once = (once == 0U && inside) ? got : once;
+            if (inside ? (got != once || got == 0U) : (got != 0U)) {
+                fprintf(stderr, "render_scenes: tri mesh pixel (%u, %u) is %04x, once is %04x\n",
+                        (unsigned)x, (unsigned)y, got, once);
+                abort();
+            }
+        }
+    }
+
+    gfx_tri_reset_stats();
+    gfx_tri_begin(&cv);
+    gfx_tri_add((const gfx_tri_vertex_t[3]){ { 0.0f, 0.0f, 0.5f, 0.5f, 1.0f }, { 320.0f, 316.0f, 0.5f, 0.5f, 1.0f },
+                                             { 316.0f, 320.0f, 0.5f, 0.5f, 1.0f } }, &tex, GFX_TRI_AFFINE);
+    gfx_tri_end();
+    if (st->bins > 40U) {
+        fprintf(stderr, "render_scenes: tri sliver binned into %u of 110 tiles\n", (unsigned)st->bins);
+        abort();
+    }
+}
+
+/*
+ * Random triangles of the coordinate texture against a double precision
+ * reference: pixel centres clearly inside must show the texel at the
+ * exact mapping, clearly outside ones stay untouched. Affine must be
+ * exact away from texel edges, perspective may be one texel off where the
+ * GFX_TRI_SPAN pixel segments bend away from the hyperbola, and only
+ * where the texture is magnified.
+ */
+static void scene_tri_check_map(gfx_tri_mapping_t mapping)
+{
+    const volatile uint16_t *fb = (const volatile uint16_t *)SCENE_FB_ADDR;
+    gfx_tri_tex_t glass;
+    const gfx_tri_tex_t *tex = scene_tri_textures(&glass);
+    int32_t slack = (mapping == GFX_TRI_AFFINE) ? 0 : 1;
+    gfx_canvas_t cv;
+    uint32_t checked = 0;
+
+    gfx_canvas_init(&cv, SCENE_FB_ADDR);
+    for (uint32_t n = 0; n < 24U; n++) {
+        gfx_tri_vertex_t v[3];
+        double area;
+
+        for (uint32_t i = 0; i < 3U; i++) {
+            v[i] = (gfx_tri_vertex_t){ tri_rand(-40.0f, 840.0f), tri_rand(-40.0f, 520.0f),
+                                       tri_rand(0.0f, 64.0f), tri_rand(0.0f, 64.0f),
+                                       (mapping == GFX_TRI_PERSPECTIVE) ? tri_rand(0.5f, 4.0f) : 1.0f };
+        }
+        DMA2D_fill_rect(0, 0, 800, 480, 0xFFFF);
+        gfx_tri_begin(&cv);
+        gfx_tri_add(v, tex, mapping);
+        gfx_tri_end();
+
+        area = ((double)v[1].x - v[0].x) * ((double)v[2].y - v[0].y) - ((double)v[1].y - v[0].y) * ((double)v[2].x - v[0].x);
+        if (fabs(area) < 1.0) {
+            continue;
+        }
+        for (uint32_t y = 0; y < 480U; y++) {
+            for (uint32_t x = 0; x < 800U; x++) {
+                double px = x + 0.5, py = y + 0.5, l[3], dl[3], dist = 1e9, q = 0.0, u = 0.0, t = 0.0, dq = 0.0, du = 0.0, dt = 0.0;
+                uint16_t got = fb[y * SCENE_FB_PITCH + x];
+                bool minified, ok;
+
+                for (uint32_t k = 0; k < 3U; k++) {
+                    const gfx_tri_vertex_t *a = &v[(k + 1U) % 3U], *b = &v[(k + 2U) % 3U];
+                    double e = ((double)b->x - a->x) * (py - a->y) - ((double)b->y - a->y) * (px - a->x);
+
+                    l[k] = e / area;
+                    dl[k] = -((double)b->y - a->y) / area;          // Per pixel to the right
+                    dist = fmin(dist, e / area * fabs(area) / hypot((double)b->x - a->x, (double)b->y - a->y));
+                }
+                if (fabs(dist) < TRI_EPS) {
+                    continue;
+                }
+                if (dist < 0.0) {
+                    if (got != 0xFFFFU) {
+                        fprintf(stderr, "render_scenes: tri %u drew outside at (%u, %u)\n", (unsigned)n, (unsigned)x, (unsigned)y);
+                        abort();
+                    }
+                    continue;
+                }
+                for (uint32_t k = 0; k < 3U; k++) {
+                    q += l[k] / v[k].w;
+                    u += l[k] * v[k].u / v[k].w;
+                    t += l[k] * v[k].v / v[k].w;
+                    dq += dl[k] / v[k].w;
+                    du += dl[k] * v[k].u / v[k].w;
+                    dt += dl[k] * v[k].v / v[k].w;
+                }
+                u /= q;
+                t /= q;
+                minified = (mapping == GFX_TRI_PERSPECTIVE) &&
+                           (fabs((u * q + du) / (q + dq) - u) > 0.5 || fabs((t * q + dt) / (q + dq) - t) > 0.5);
+                if (mapping == GFX_TRI_AFFINE &&
+                    (fabs(u - floor(u + 0.5)) < TRI_EPS || fabs(t - floor(t + 0.5)) < TRI_EPS)) {
+                    continue;
+                }
+                ok = (got != 0xFFFFU);
+                if (ok && !minified) {                      // Minified: over half a texel per pixel, coverage only
+                    ok = abs((int32_t)(got >> 6) - (int32_t)fmin(u, 63.0)) <= slack &&
+                         abs((int32_t)(got & 63U) - (int32_t)fmin(t, 63.0)) <= slack;
+                }
+                if (!ok) {
+                    fprintf(stderr, "render_scenes: tri %u %s at (%u, %u) is %04x, expected texel (%.3f, %.3f)\n", (unsigned)n,
+                            (mapping == GFX_TRI_AFFINE) ? "affine" : "perspective", (unsigned)x, (unsigned)y, got, u, t);
+                    abort();
+                }
+                checked++;
+            }
+        }
+    }
+    if (checked < 200000U) {
+        fprintf(stderr, "render_scenes: tri check covered only %u pixels\n", (unsigned)checked);
+        abort();
+    }
+}
+
+/* Carousel of UI cards, a page turning on its left edge, translucent ARGB4444 triangles, cut by the canvas clip */
+static void scene_tri(void)
+{
+    const gfx_tri_tex_t card = { ASSET_UI + (8U * ASSET_W + 8U) * 2U, ASSET_W, 64, 48, GFX_TRI_RGB565, 0 };
+    const gfx_tri_tex_t page = { ASSET_RGB565 + (16U * ASSET_W + 16U) * 2U, ASSET_W, 80, 56, GFX_TRI_RGB565, 0 };
+    gfx_tri_vertex_t v[4];
+    gfx_tri_tex_t glass;
+    gfx_canvas_t cv;
+
+    tri_seed = 1;
+    scene_tri_check_mesh();
+    scene_tri_check_map(GFX_TRI_AFFINE);
+    scene_tri_check_map(GFX_TRI_PERSPECTIVE);
+    scene_tri_textures(&glass);
+
+    gfx_canvas_init(&cv, SCENE_FB_ADDR);
+    cv.clip.w = SCENE_CAPTURE_W;
+    cv.clip.h = SCENE_CAPTURE_H;
+    DMA2D_fill_rect(0, 0, 800, 480, 0x0000);
+    DMA2D_fill_rect(0, 0, SCENE_CAPTURE_W, SCENE_CAPTURE_H, GFX_RGB565(24, 32, 48));
+
+    gfx_tri_begin(&cv);
+    gfx_tri_card(v, &card, 38.0f, 32.0f, 32.0f, -0.9f, 240.0f);
+    gfx_tri_add_quad(v, &card, GFX_TRI_PERSPECTIVE);
+    gfx_tri_card(v, &card, 154.0f, 32.0f, 32.0f, 0.9f, 240.0f);
+    gfx_tri_add_quad(v, &card, GFX_TRI_PERSPECTIVE);
+    gfx_tri_card(v, &card, 96.0f, 34.0f, 32.0f, 0.0f, 240.0f);
+    gfx_tri_add_quad(v, &card, GFX_TRI_PERSPECTIVE);
+    gfx_tri_card(v, &page, 8.0f, 96.0f, 0.0f, 1.1f, 240.0f);
+    gfx_tri_add_quad(v, &page, GFX_TRI_PERSPECTIVE);
+    gfx_tri_card(v, &page, 84.0f, 96.0f, 0.0f, 1.1f, 240.0f);
+    gfx_tri_add_quad(v, &page, GFX_TRI_AFFINE);            // Same page mapped affine: the texture bends along the diagonal
+    gfx_tri_add((const gfx_tri_vertex_t[3]){ { 150.25f, 70.5f, 0.0f, 0.0f, 1.0f }, { 214.0f, 98.0f, 64.0f, 16.0f, 1.0f },
+                                             { 160.5f, 140.75f, 8.0f, 64.0f, 1.0f } }, &glass, GFX_TRI_AFFINE);
+    gfx_tri_end();
+}
+
+/* A 400 x 300 textured quad, the size the 2.5D effects need at 30 fps */
+/* A 400x300 quad, its min_mps of 3.6 is 30 fps */
+static uint32_t bench_tri(gfx_tri_mapping_t mapping)
+{
+    const gfx_tri_tex_t ui = { ASSET_UI, ASSET_W, ASSET_W, ASSET_H, GFX_TRI_RGB565, 0 };
+    const gfx_tri_stats_t *st = gfx_tri_get_stats();
+    float w = (mapping == GFX_TRI_PERSPECTIVE) ? 2.0f : 1.0f;
+    const gfx_tri_vertex_t v[4] = {
+        { 200.0f,  90.0f,   0.0f,   0.0f, 1.0f }, { 600.0f,  90.0f, 400.0f,   0.0f, w },
+        { 600.0f, 390.0f, 400.0f, 240.0f, w },    { 200.0f, 390.0f,   0.0f, 240.0f, 1.0f },
+    };
+    uint32_t before = st->pixels;
+    gfx_canvas_t cv;
+
+    gfx_canvas_init(&cv, SCENE_FB_ADDR);
+    gfx_tri_begin(&cv);
+    gfx_tri_add_quad(v, &ui, mapping);
+    gfx_tri_end();
+    return st->pixels - before;
+}
+
+static uint32_t bench_tri_affine(void)
+{
+    return bench_tri(GFX_TRI_AFFINE);
+}
+
+static uint32_t bench_tri_perspective(void)
+{
+    return bench_tri(GFX_TRI_PERSPECTIVE);
+}
+
+/* ---------------------------------------------------------------------------
+ * composited blits
+ */
+#define BLIT_W                  46U
+#define BLIT_H                  40U
+#define BLIT_KEY                0xF81FU                             // Magenta
+
+SCENE_DMA_DATA static uint16_t blit_rgb565[BLIT_W * BLIT_H];                       // Legacy sprite, magenta background
+SCENE_DMA_DATA static uint8_t blit_l8[BLIT_W * BLIT_H];                            // Same sprite, index 0 is magenta
+SCENE_DMA_DATA static uint8_t blit_mask[BLIT_W * BLIT_H];                          // Anti-aliased disc
+SCENE_DMA_DATA static uint32_t blit_palette[16];
+
+/* A ring of colour bands on magenta, one band translucent in the palette */
+static void scene_blit_assets(void)
+{
+    if (blit_palette[0] != 0U) {
+        return;
+    }
+    blit_palette[0] = 0xFFFF00FFU;
+    for (uint32_t i = 1; i < 16U; i++) {
+        blit_palette[i] = GFX_ARGB((i == 5U) ? 96U : 255U, i * 16U, 255U - i * 12U, (i & 1U) ? 220U : 40U);
+    }
+    for (uint32_t y = 0; y < BLIT_H; y++) {
+        for (uint32_t x = 0; x < BLIT_W; x++) {
+            double dx = (double)x + 0.5 - 23.0, dy = (double)y + 0.5 - 20.0, r = sqrt(dx * dx + dy * dy);
+            uint32_t band = (r < 19.0 && r > 6.0) ? 1U + (x / 4U + y / 6U) % 15U : 0U;
+            uint32_t e = blit_palette[band];
+
+            blit_l8[y * BLIT_W + x] = (uint8_t)band;
+            blit_rgb565[y * BLIT_W + x] = (uint16_t)(((e >> 8) & 0xF800U) | ((e >> 5) & 0x07E0U) | ((e >> 3) & 0x001FU));
+            blit_mask[y * BLIT_W + x] = (uint8_t)fmax(0.0, fmin(255.0, (17.5 - hypot(dx - 6.0, dy + 4.0)) * 255.0));
+        }
+    }
+}
+
+/*
+ * Every format x flags x opacity combination, the source at (48 * col,
+ * 42 * row), its mask 3 pixels right and 2 down so the mask area clips
+ * it. Each pixel is compared with a double precision blend of what was
+ * there before: within 2 LSB (3 on green) where it blends, exact where
+ * nothing or the whole source is drawn. The path taken is checked too.
+ * The capture shows the opaque columns: no flags, key, mask, both.
+ */
+static void scene_blit(void)
+{
+    static uint16_t before[126U * SCENE_FB_PITCH];
+    const volatile uint16_t *fb = (const volatile uint16_t *)SCENE_FB_ADDR;
+    const gfx_blit_stats_t *st = gfx_blit_get_stats();
+    gfx_canvas_t cv;
+
+    scene_blit_assets();
+    gfx_canvas_init(&cv, SCENE_FB_ADDR);
+    DMA2D_fill_rect(0, 0, 800, 480, GFX_RGB565(24, 32, 48));
+    for (uint16_t x = 0; x < 800U; x += 16U) {
+        DMA2D_fill_rect(x, 0, 8, 126, GFX_RGB565(200, 190, 170));
+    }
+    DMA2D_wait();
+    for (uint32_t i = 0; i < 126U * SCENE_FB_PITCH; i++) {
+        before[i] = fb[i];
+    }
+
+    for (uint32_t row = 0; row < 3U; row++) {
+        for (uint32_t col = 0; col < 8U; col++) {
+            gfx_blit_src_t src = { 0, BLIT_W, BLIT_W, BLIT_H, (uint8_t)row, 0, blit_palette, 16, GFX_ARGB(200, 40, 220, 120) };
+            gfx_blit_opts_t o = { (uint8_t)(col & 3U), (col < 4U) ? 255U : 150U, BLIT_KEY, (uint32_t)(uintptr_t)blit_mask, BLIT_W,
+                                  { (int16_t)(col * 48U + 3U), (int16_t)(row * 42U + 2U), BLIT_W, BLIT_H } };
+            bool hw = (row == GFX_BLIT_COLOR) || (row == GFX_BLIT_L8 && !(o.flags & GFX_BLIT_MASK)) || o.flags == 0U;
+            uint32_t jobs = st->dma2d_jobs;
+
+            src.addr = (row == GFX_BLIT_L8) ? (uint32_t)(uintptr_t)blit_l8 : (uint32_t)(uintptr_t)blit_rgb565;
+            gfx_blit(&cv, &src, (int16_t)(col * 48U), (int16_t)(row * 42U), &o);
+            if ((st->dma2d_jobs != jobs) != hw) {
+                fprintf(stderr, "render_scenes: blit format %u flags %u took the %s path\n",
+                        (unsigned)row, (unsigned)o.flags, hw ? "cpu" : "dma2d");
+                abort();
+            }
+        }
+    }
+    DMA2D_wait();
+
+    for (uint32_t y = 0; y < 126U; y++) {
+        for (uint32_t x = 0; x < 384U; x++) {
+            uint32_t row = y / 42U, col = x / 48U, sx = x - col * 48U, sy = y - row * 42U;
+            uint32_t flags = col & 3U, c = 0, d = before[y * SCENE_FB_PITCH + x];
+            uint16_t got = fb[y * SCENE_FB_PITCH + x];
+            double a = (col < 4U) ? 1.0 : 150.0 / 255.0;
+            bool ok = true;
+
+            if (sx >= BLIT_W || sy >= BLIT_H) {
+                a = 0.0;
+            } else if (row == GFX_BLIT_COLOR) {
+                c = GFX_RGB565(40, 220, 120);
+                a *= 200.0 / 255.0;
+            } else {
+                uint32_t e = blit_palette[blit_l8[sy * BLIT_W + sx]];
+
+                c = blit_rgb565[sy * BLIT_W + sx];
+                a *= (row == GFX_BLIT_L8) ? (double)(e >> 24) / 255.0 : 1.0;
+                a = ((flags & GFX_BLIT_KEY) && c == BLIT_KEY) ? 0.0 : a;
+            }
+            if (flags & GFX_BLIT_MASK) {
+                a *= (sx < 3U || sy < 2U) ? 0.0 : blit_mask[(sy - 2U) * BLIT_W + sx - 3U] / 255.0;
+            }
+
+            if (a == 0.0 || a == 1.0) {
+                ok = (got == ((a == 0.0) ? d : c));
+            } else {
+                static const uint32_t shift[3] = { 11, 5, 0 }, bits[3] = { 5, 6, 5 }, slack[3] = { 2, 3, 2 };
+
+                for (uint32_t k = 0; k < 3U; k++) {
+                    double dc = (d >> shift[k]) & ((1U << bits[k]) - 1U), sc = (c >> shift[k]) & ((1U << bits[k]) - 1U);
+                    int32_t g = (got >> shift[k]) & ((1U << bits[k]) - 1U);
+
+                    ok = ok && fabs(g - (dc + (sc - dc) * a)) <= slack[k];
+                }
+            }
+            if (!ok) {
+                fprintf(stderr, "render_scenes: blit format %u flags %u opacity %u at (%u, %u) is %04x, was %04x, source %04x x %.3f\n",
+                        (unsigned)row, (unsigned)flags, (col < 4U) ? 255U : 150U, (unsigned)sx, (unsigned)sy, got, d, c, a);
+                abort();
+            }
+        }
+    }
+}
+
+/* UI art with its background keyed out, the CPU path (two pixels per word on the M7) */
+static uint32_t bench_blit_key(void)
+{
+    const gfx_blit_src_t ui = { ASSET_UI, ASSET_W, ASSET_W, ASSET_H, GFX_BLIT_RGB565, 0, NULL, 0, 0 };
+    const gfx_blit_opts_t o = { GFX_BLIT_KEY, 255, GFX_RGB565(16, 20, 28), 0, 0, { 0, 0, 0, 0 } };
+    gfx_canvas_t cv;
+
+    gfx_canvas_init(&cv, SCENE_FB_ADDR);
+    gfx_blit(&cv, &ui, 0, 0, &o);
+    return ASSET_W * ASSET_H;
+}
+
+/* L8 image with a keyed CLUT entry and opacity: one CLUT load and one DMA2D blend */
+static uint32_t bench_blit_clut_key(void)
+{
+    const gfx_blit_src_t l8 = { ASSET_L8, ASSET_W, ASSET_W, ASSET_H, GFX_BLIT_L8, 0, lcd_l8_default_clut(), 256, 0 };
+    const gfx_blit_opts_t o = { GFX_BLIT_KEY, 200, 0x0000, 0, 0, { 0, 0, 0, 0 } };
+    gfx_canvas_t cv;
+
+    gfx_canvas_init(&cv, SCENE_FB_ADDR);
+    gfx_blit(&cv, &l8, 0, 0, &o);
+    DMA2D_wait();
+    return ASSET_W * ASSET_H;
+}
+
+/* ---------------------------------------------------------------------------
+ * effects
+ */
+SCENE_DMA_DATA static uint8_t fx_corner_in[GFX_FX_CORNER_SIZE(10)];
+SCENE_DMA_DATA static uint8_t fx_corner_card[GFX_FX_CORNER_SIZE(8)];
+SCENE_DMA_DATA static uint8_t fx_corner_out[GFX_FX_CORNER_SIZE(12)];
+
+/* Box passes in double precision with clamped edges, what gfx_fx_blur() approximates with running sums */
+static void scene_blur_ref(uint16_t *px, uint32_t w, uint32_t h, int32_t r, uint32_t passes)
+{
+    static double ch[3][100 * 60], tmp[100];
+
+    for (uint32_t i = 0; i < w * h; i++) {
+        ch[0][i] = px[i] >> 11;
+        ch[1][i] = (px[i] >> 5) & 0x3FU;
+        ch[2][i] = px[i] & 0x1FU;
+    }
+    for (uint32_t c = 0; c < 3U; c++) {
+        for (uint32_t dir = 0; dir < 2U; dir++) {
+            uint32_t n = dir ? h : w, lines = dir ? w : h;
+
+            for (uint32_t l = 0; l < lines; l++) {
+                for (uint32_t p = 0; p < passes; p++) {
+                    for (int32_t i = 0; i < (int32_t)n; i++) {
+                        double sum = 0.0;
+
+                        for (int32_t k = i - r; k <= i + r; k++) {
+                            int32_t j = (k < 0) ? 0 : ((k >= (int32_t)n) ? (int32_t)n - 1 : k);
+
+                            sum += dir ? ch[c][j * w + l] : ch[c][l * w + j];
+                        }
+                        tmp[i] = floor(sum / (2 * r + 1) + 0.5);
+                    }
+                    for (uint32_t i = 0; i < n; i++) {
+                        *(dir ? &ch[c][i * w + l] : &ch[c][l * w + i]) = tmp[i];
+                    }
+                }
+            }
+        }
+    }
+    for (uint32_t i = 0; i < w * h; i++) {
+        px[i] = (uint16_t)(((uint32_t)ch[0][i] << 11) | ((uint32_t)ch[1][i] << 5) | (uint32_t)ch[2][i]);
+    }
+}
+
+static void scene_blur_check(void)
+{
+    static uint16_t want[100 * 60];
+    const gfx_rect_t area = { 13, 7, 100, 60 };
+    const volatile uint16_t *fb = (const volatile uint16_t *)SCENE_FB_ADDR;
+    gfx_canvas_t cv;
+
+    gfx_canvas_init(&cv, SCENE_FB_ADDR);
+    DMA2D_copy_rect(ASSET_UI, ASSET_W, fb_addr(0, 0), SCENE_FB_PITCH, ASSET_W, ASSET_H, DMA2D_INPUT_RGB565);
+    for (uint32_t y = 0; y < 60U; y++) {
+        for (uint32_t x = 0; x < 100U; x++) {
+            want[y * 100U + x] = fb[(7U + y) * SCENE_FB_PITCH + 13U + x];
+        }
+    }
+    scene_blur_ref(want, 100, 60, 4, 2);
+    gfx_fx_blur(&cv, &area, 4, 2);
+    for (uint32_t y = 0; y < ASSET_H; y++) {
+        for (uint32_t x = 0; x < ASSET_W; x++) {
+            uint16_t got = fb[y * SCENE_FB_PITCH + x];
+            bool inside = x >= 13U && x < 113U && y >= 7U && y < 67U;
+            uint16_t exp = inside ? want[(y - 7U) * 100U + x - 13U] : ((const volatile uint16_t *)ASSET_UI)[y * ASSET_W + x];
+            int32_t dr = (int32_t)(got >> 11) - (exp >> 11);
+            int32_t dg = (int32_t)((got >> 5) & 0x3FU) - ((exp >> 5) & 0x3F);
+            int32_t db = (int32_t)(got & 0x1FU) - (exp & 0x1F);
+
+            if (abs(dr) > 1 || abs(dg) > 1 || abs(db) > 1) {
+                fprintf(stderr, "render_scenes: blur differs from the reference at (%u, %u)\n", (unsigned)x, (unsigned)y);
+                abort();
+            }
+        }
+    }
+    DMA2D_fill_rect(0, 0, 800, 480, 0x0000);
+}
+
+/* Frosted glass panel, card with a drop shadow, photo with cut corners, shadow clipped by the canvas */
+static void scene_effects(void)
+{
+    const gfx_rect_t glass = { 8, 8, 90, 60 }, card = { 112, 16, 64, 44 }, photo = { 16, 82, 72, 40 };
+    gfx_fx_corner_t in, in_card, out;
+    gfx_rect_t r;
+    gfx_canvas_t cv;
+
+    scene_blur_check();
+    gfx_fx_corner_make(&in, fx_corner_in, 10, false);
+    gfx_fx_corner_make(&in_card, fx_corner_card, 8, false);
+    gfx_fx_corner_make(&out, fx_corner_out, 12, true);
+
+    gfx_canvas_init(&cv, SCENE_FB_ADDR);
+    cv.clip.w = SCENE_CAPTURE_W;
+    cv.clip.h = SCENE_CAPTURE_H;
+    DMA2D_copy_rect(ASSET_UI + (20U * ASSET_W + 30U) * 2U, ASSET_W, fb_addr(0, 0), SCENE_FB_PITCH,
+                    SCENE_CAPTURE_W, 76, DMA2D_INPUT_RGB565);
+    DMA2D_fill_rect(0, 76, SCENE_CAPTURE_W, SCENE_CAPTURE_H - 76U, GFX_RGB565(220, 224, 232));
+
+    gfx_fx_blur(&cv, &glass, 5, 3);
+    gfx_fx_round_rect(&cv, &glass, &in, GFX_ARGB(70, 255, 255, 255));
+
+    r = card;
+    r.x += 3;
+    r.y += 4;
+    gfx_fx_shadow(&cv, &r, 8, 10, GFX_ARGB(170, 0, 0, 0));
+    gfx_fx_round_rect(&cv, &card, &in_card, GFX_ARGB(255, 250, 250, 250));
+
+    DMA2D_copy_rect(ASSET_RGB565 + (40U * ASSET_W + 100U) * 2U, ASSET_W, fb_addr(photo.x, photo.y), SCENE_FB_PITCH,
+                    (uint16_t)photo.w, (uint16_t)photo.h, DMA2D_INPUT_RGB565);
+    gfx_fx_round_corners(&cv, &photo, &out, GFX_ARGB(255, 220, 224, 232));
+
+    r = (gfx_rect_t){ 150, 90, 60, 30 };
+    gfx_fx_shadow(&cv, &r, 6, 14, GFX_ARGB(200, 40, 60, 160));
+}
+
+/* Frosted glass over the whole screen */
+static uint32_t bench_blur(void)
+{
+    const gfx_rect_t all = { 0, 0, 800, 480 };
+    gfx_canvas_t cv;
+
+    gfx_canvas_init(&cv, SCENE_FB_ADDR);
+    gfx_fx_blur(&cv, &all, 8, 2);
+    return 800U * 480U;
+}
+
+/* Twelve 180x100 cards with wide shadows */
+static uint32_t bench_shadow(void)
+{
+    const gfx_fx_stats_t *st = gfx_fx_get_stats();
+    uint32_t before = st->shadow_pixels;
+    gfx_canvas_t cv;
+
+    gfx_canvas_init(&cv, SCENE_FB_ADDR);
+    for (uint32_t i = 0; i < 12U; i++) {
+        gfx_rect_t r = { (int16_t)(16U + (i % 4U) * 196U), (int16_t)(16U + (i / 4U) * 156U), 180, 100 };
+
+        gfx_fx_shadow(&cv, &r, 12, 16, GFX_ARGB(120, 0, 0, 0));
+    }
+    return st->shadow_pixels - before;
+}
+
+/* ---------------------------------------------------------------------------
+ * blend
+ */
+static void scene_blend_argb8888(void)
+{
+    scene_copy_rgb565();
+    scene_dma2d(DMA2D_M2M_BLEND, ASSET_ARGB8888 + 16U, DMA2D_INPUT_ARGB8888, ASSET_W, 0,
+                fb_addr(0, 0), DMA2D_INPUT_RGB565, SCENE_FB_PITCH,
+                fb_addr(0, 0), SCENE_FB_PITCH, SCENE_CAPTURE_W, SCENE_CAPTURE_H);
+}
+
+static uint32_t bench_blend_argb8888(void)
+{
+    scene_dma2d(DMA2D_M2M_BLEND, ASSET_ARGB8888, DMA2D_INPUT_ARGB8888, ASSET_W, 0,
+                fb_addr(0, 0), DMA2D_INPUT_RGB565, SCENE_FB_PITCH,
+                fb_addr(0, 0), SCENE_FB_PITCH, ASSET_W, ASSET_H);
+    return ASSET_W * ASSET_H;
+}
+
+static void scene_blend_a8(void)
+{
+    DMA2D_fill_rect(0, 0, SCENE_CAPTURE_W, SCENE_CAPTURE_H / 2U, 0x0010);
+    DMA2D_fill_rect(0, SCENE_CAPTURE_H / 2U, SCENE_CAPTURE_W, SCENE_CAPTURE_H / 2U, 0xC618);
+    scene_dma2d(DMA2D_M2M_BLEND, ASSET_A8, DMA2D_INPUT_A8, ASSET_W, 0xFFA000,
+                fb_addr(0, 0), DMA2D_INPUT_RGB565, SCENE_FB_PITCH,
+                fb_addr(0, 0), SCENE_FB_PITCH, SCENE_CAPTURE_W, SCENE_CAPTURE_H);
+}
+
+static uint32_t bench_blend_a8(void)
+{
+    scene_dma2d(DMA2D_M2M_BLEND, ASSET_A8, DMA2D_INPUT_A8, ASSET_W, 0xFFFFFF,
+                fb_addr(0, 0), DMA2D_INPUT_RGB565, SCENE_FB_PITCH,
+                fb_addr(0, 0), SCENE_FB_PITCH, ASSET_W, ASSET_H);
+    return ASSET_W * ASSET_H;
+}
+
+/* LTDC layer 2 blending, no bus master work on the CPU side */
+static void scene_overlay(void)
+{
+    volatile uint16_t *ov = (volatile uint16_t *)OVERLAY_ADDR;
+    lcd_overlay_cfg_t cfg;
+
+    scene_fill_rects();
+    for (uint32_t y = 0; y < 48U; y++) {
+        for (uint32_t x = 0; x < 64U; x++) {
+            ov[y * 64U + x] = (uint16_t)(((x / 4U) << 12) | (((y / 3U) & 0xFU) << 8) | 0x00F0U);
+        }
+    }
+    lcd_overlay_default_cfg(&cfg, OVERLAY_ADDR, 64, 48);
+    cfg.x = 96;
+    cfg.y = 64;
+    cfg.alpha = 200;
+    lcd_overlay_init(&cfg);
+}
+
+static void scene_overlay_cleanup(void)
+{
+    lcd_overlay_show(false);
+}
+
+/* GFXMMU packed buffer for a glass with a bezel and rounded corners, the top left corner shows the cut */
+static void scene_vfb(void)
+{
+    static const lcd_vfb_shape_t shape = { 12, 12, 6, 6, 64 };
+    static lcd_vfb_span_t spans[LCD_VFB_HEIGHT];
+    lcd_vfb_info_t info;
+    uint32_t vfb;
+
+    if (lcd_vfb_shape_spans(&shape, spans) != LCD_VFB_OK || lcd_vfb_init(spans, 1, &info) != LCD_VFB_OK ||
+        info.frame_bytes >= LCD_VFB_PHYS_SIZE || info.spare_size != LCD_VFB_PHYS_SIZE - info.frame_bytes) {
+        fprintf(stderr, "render_scenes: GFXMMU frame buffer set up failed\n");
+        abort();
+    }
+    vfb = lcd_vfb_get_buffer(0);
+    DMA2D_fill_rect_fb(vfb, LCD_VFB_PITCH, 0, 0, LCD_VFB_WIDTH, LCD_VFB_HEIGHT, GFX_RGB565(200, 40, 40));
+    DMA2D_copy_rect(ASSET_UI, ASSET_W, lcd_vfb_pixel_addr(vfb, 4, 4), LCD_VFB_PITCH,
+                    SCENE_CAPTURE_W - 4U, SCENE_CAPTURE_H - 4U, DMA2D_INPUT_RGB565);
+}
+
+static void scene_vfb_cleanup(void)
+{
+    lcd_vfb_deinit();
+}
+
+/* ---------------------------------------------------------------------------
+ * animation
+ *
+ * Four sheets in RO_DATA: a spinning coin (ARGB8888 grid), a scrolling
+ * stripe sequence (RGB565, one column), a pulsing dot (ARGB4444) and a glow
+ * too large for a staging buffer, so it is always blended from flash.
+ */
+static const gfx_anim_sheet_t anim_coin = { ASSET_ANIM, 192, 48, 48, 8, 4, GFX_ANIM_ARGB8888, 40 };
+static const gfx_anim_sheet_t anim_stripes = { ASSET_ANIM + 0x12000UL, 64, 64, 40, 6, 1, GFX_ANIM_RGB565, 80 };
+static const gfx_anim_sheet_t anim_dot = { ASSET_ANIM + 0x1A000UL, 128, 32, 32, 4, 4, GFX_ANIM_ARGB4444, 40 };
+static const gfx_anim_sheet_t anim_glow = { ASSET_ANIM + 0x1C000UL, 160, 80, 64, 2, 2, GFX_ANIM_ARGB8888, 120 };
+static uint8_t anim_sheets_ready = 0;
+
+static void scene_anim_sheets(void)
+{
+    if (anim_sheets_ready) {
+        return;
+    }
+    for (uint32_t f = 0; f < anim_coin.frames; f++) {
+        volatile uint32_t *px = (volatile uint32_t *)(anim_coin.addr + ((f / 4U) * 48U * 192U + (f % 4U) * 48U) * 4U);
+        float rx = 2.0f + 21.0f * fabsf(cosf((float)f * 3.14159265f / 8.0f));
+
+        for (uint32_t y = 0; y < 48U; y++) {
+            for (uint32_t x = 0; x < 48U; x++) {
+                float dx = ((float)x - 23.5f) / rx, dy = ((float)y - 23.5f) / 22.0f;
+                float d = dx * dx + dy * dy;
+                uint32_t shade = 160U + (uint32_t)(95.0f * (1.0f - dy) / 2.0f);
+
+                px[y * 192U + x] = (d > 1.0f) ? 0U : (d > 0.7f) ? GFX_ARGB(255, 180, 120, 20) : GFX_ARGB(230, shade, shade * 3U / 4U, 40);
+            }
+        }
+    }
+    for (uint32_t f = 0; f < anim_stripes.frames; f++) {
+        volatile uint16_t *px = (volatile uint16_t *)(anim_stripes.addr + f * 64U * 40U * 2U);
+
+        for (uint32_t y = 0; y < 40U; y++) {
+            for (uint32_t x = 0; x < 64U; x++) {
+                px[y * 64U + x] = (((x + y + f * 4U) / 8U) & 1U) ? GFX_RGB565(40, 90, 160) : GFX_RGB565(220, 220, 240);
+            }
+        }
+    }
+    for (uint32_t f = 0; f < anim_dot.frames; f++) {
+        volatile uint16_t *px = (volatile uint16_t *)(anim_dot.addr + f * 32U * 2U);
+        int32_t r2 = (int32_t)((6U + 3U * f) * (6U + 3U * f));
+
+        for (int32_t y = 0; y < 32; y++) {
+            for (int32_t x = 0; x < 32; x++) {
+                int32_t d2 = (x - 16) * (x - 16) + (y - 16) * (y - 16);
+                uint16_t a = (d2 > r2) ? 0U : (uint16_t)(15 - 10 * d2 / r2);
+
+                px[y * 128 + x] = (uint16_t)((a << 12) | 0x0F4AU);
+            }
+        }
+    }
+    for (uint32_t f = 0; f < anim_glow.frames; f++) {
+        volatile uint32_t *px = (volatile uint32_t *)(anim_glow.addr + f * 80U * 4U);
+
+        for (int32_t y = 0; y < 64; y++) {
+            for (int32_t x = 0; x < 80; x++) {
+                int32_t d = abs(x - 40) + abs(y - 32) * 5 / 4;
+                int32_t a = 255 - d * (int32_t)(6U + 2U * f);
+
+                px[y * 160 + x] = GFX_ARGB((a < 0) ? 0U : (uint32_t)a, 120, 255, 140);
+            }
+        }
+    }
+    anim_sheets_ready = 1;
+}
+
+/* Sprites on top of each other, cut by the canvas on every side */
+static void scene_anim_setup(gfx_anim_t *anim)
+{
+    uint8_t id;
+
+    gfx_anim_init(anim);
+    gfx_anim_add(anim, &anim_stripes, 0, 6, -8, 80, 0, NULL);
+    gfx_anim_add(anim, &anim_coin, 0, 8, 20, 10, 2, NULL);
+    gfx_anim_add(anim, &anim_coin, 4, 4, 150, 40, 1, &id);
+    gfx_anim_set_opacity(anim, id, 180);
+    gfx_anim_add(anim, &anim_dot, 0, 4, 70, 60, 3, NULL);
+    gfx_anim_add(anim, &anim_dot, 1, 3, 100, -10, 3, &id);
+    gfx_anim_set_opacity(anim, id, 200);
+    gfx_anim_add(anim, &anim_glow, 0, 2, 110, 70, 1, &id);
+    gfx_anim_set_opacity(anim, id, 160);
+}
+
+static uint64_t scene_anim_play(bool prefetch)
+{
+    gfx_anim_t anim;
+    gfx_canvas_t cv;
+    uint64_t start;
+
+    gfx_canvas_init(&cv, SCENE_FB_ADDR);
+    cv.clip.w = SCENE_CAPTURE_W;
+    cv.clip.h = SCENE_CAPTURE_H;
+    scene_anim_setup(&anim);
+    anim.prefetch = prefetch;
+    start = sim_cycles();
+    for (uint32_t i = 0; i < 8U; i++) {
+        DMA2D_fill_rect(0, 0, SCENE_CAPTURE_W, SCENE_CAPTURE_H, GFX_RGB565(32, 24, 40));
+        gfx_anim_draw(&anim, &cv);
+        gfx_anim_tick(&anim, 40);
+    }
+    mdma_fetch_wait();
+    return sim_cycles() - start;
+}
+
+/*
+ * The eighth frame, drawn once straight from flash and once through the
+ * staging buffers: the pictures must match, the prefetch must be faster
+ * and the bottom sprite must come from the previous draw every time.
+ */
+static void scene_anim(void)
+{
+    static uint16_t direct_frame[SCENE_CAPTURE_W * SCENE_CAPTURE_H];
+    const gfx_anim_stats_t *st = gfx_anim_get_stats();
+    uint64_t direct_cycles, prefetch_cycles;
+
+    scene_anim_sheets();
+    direct_cycles = scene_anim_play(false);
+    for (uint32_t y = 0; y < SCENE_CAPTURE_H; y++) {
+        memcpy(&direct_frame[y * SCENE_CAPTURE_W], (const void *)fb_addr(0, y), SCENE_CAPTURE_W * 2U);
+    }
+
+    gfx_anim_reset_stats();
+    prefetch_cycles = scene_anim_play(true);
+    for (uint32_t y = 0; y < SCENE_CAPTURE_H; y++) {
+        if (memcmp(&direct_frame[y * SCENE_CAPTURE_W], (const void *)fb_addr(0, y), SCENE_CAPTURE_W * 2U) != 0) {
+            fprintf(stderr, "render_scenes: prefetched animation differs from the direct one in line %u\n", (unsigned)y);
+            abort();
+        }
+    }
+    if (prefetch_cycles >= direct_cycles || st->hits < 7U || st->direct == 0) {
+        fprintf(stderr, "render_scenes: animation prefetch %llu cycles (direct %llu), %u hits, %u direct blends\n",
+                (unsigned long long)prefetch_cycles, (unsigned long long)direct_cycles,
+                (unsigned)st->hits, (unsigned)st->direct);
+        abort();
+    }
+}
+
+/* A full sprite set over the whole screen at 60 fps steps */
+static uint32_t bench_anim(void)
+{
+    static const gfx_anim_sheet_t *const sheets[] = { &anim_coin, &anim_stripes, &anim_dot, &anim_coin };
+    gfx_anim_t anim;
+    gfx_canvas_t cv;
+    uint32_t pixels = 0;
+
+    scene_anim_sheets();
+    gfx_canvas_init(&cv, SCENE_FB_ADDR);
+    gfx_anim_init(&anim);
+    for (uint32_t i = 0; i < GFX_ANIM_SPRITES_MAX; i++) {
+        const gfx_anim_sheet_t *sh = sheets[i & 3U];
+
+        gfx_anim_add(&anim, sh, 0, sh->frames, (int16_t)((i % 4U) * 190U + 20U), (int16_t)((i / 4U) * 110U + 20U),
+                     (int8_t)(i & 3U), NULL);
+        pixels += (uint32_t)sh->frame_w * sh->frame_h;
+    }
+    for (uint32_t i = 0; i < 4U; i++) {
+        gfx_anim_draw(&anim, &cv);
+        gfx_anim_tick(&anim, 16);
+    }
+    mdma_fetch_wait();
+    return 4U * pixels;
+}
+
+/* ---------------------------------------------------------------------------
+ * scene graph
+ *
+ * A status screen in the capture window: header row (title sized by its
+ * text, spacer, clock), a column of tile rows and a popup on top.
+ */
+static gfx_scene_t ui_scene;
+SCENE_DMA_DATA static uint8_t ui_corner_buf[GFX_FX_CORNER_SIZE(4)];
+static gfx_fx_corner_t ui_corner;
+
+typedef struct {
+    gfx_node_id_t title;
+    gfx_node_id_t clock;
+    gfx_node_id_t grid;
+    gfx_node_id_t tiles[4][7];
+    gfx_node_id_t popup;
+} ui_nodes_t;
+
+static void scene_ui_build(gfx_scene_t *s, const gfx_rect_t *bounds, ui_nodes_t *ui)
+{
+    gfx_node_id_t header, spacer, row, id;
+
+    gfx_fx_corner_make(&ui_corner, ui_corner_buf, 4, false);
+    gfx_scene_init(s, bounds, GFX_ARGB(255, 24, 28, 40));
+
+    gfx_scene_add(s, GFX_SCENE_ROOT, GFX_NODE_GROUP, 0, 0, GFX_SIZE_FILL, 24, &header);
+    gfx_scene_set_fill(s, header, GFX_ARGB(255, 40, 80, 160));
+    gfx_scene_set_layout(s, header, GFX_LAYOUT_ROW, 2, 4);
+    gfx_scene_add(s, header, GFX_NODE_TEXT, 0, 0, GFX_SIZE_CONTENT, GFX_SIZE_FILL, &ui->title);
+    gfx_scene_set_text(s, ui->title, &font_lato18, "Status");
+    gfx_scene_add(s, header, GFX_NODE_GROUP, 0, 9, GFX_SIZE_FILL, 2, &spacer);
+    gfx_scene_set_fill(s, spacer, GFX_ARGB(128, 255, 255, 255));
+    gfx_scene_add(s, header, GFX_NODE_TEXT, 0, 0, 48, GFX_SIZE_FILL, &ui->clock);
+    gfx_scene_set_align(s, ui->clock, GFX_ALIGN_RIGHT);
+    gfx_scene_set_text(s, ui->clock, &font_lato18, "12:00");
+
+    gfx_scene_add(s, GFX_SCENE_ROOT, GFX_NODE_GROUP, 0, 26, GFX_SIZE_FILL, GFX_SIZE_FILL, &ui->grid);
+    gfx_scene_set_layout(s, ui->grid, GFX_LAYOUT_COLUMN, 4, 3);
+    for (uint32_t r = 0; r < 4U; r++) {
+        gfx_scene_add(s, ui->grid, GFX_NODE_GROUP, 0, 0, GFX_SIZE_FILL, GFX_SIZE_FILL, &row);
+        gfx_scene_set_layout(s, row, GFX_LAYOUT_ROW, 0, 3);
+        for (uint32_t c = 0; c < 7U; c++) {
+            gfx_scene_add(s, row, GFX_NODE_GROUP, 0, 0, GFX_SIZE_FILL, GFX_SIZE_FILL, &ui->tiles[r][c]);
+            gfx_scene_set_fill(s, ui->tiles[r][c], GFX_ARGB(255, 60 + r * 40, 200 - c * 20, 120));
+            gfx_scene_set_corner(s, ui->tiles[r][c], ((r + c) & 1U) ? &ui_corner : NULL);
+        }
+    }
+
+    gfx_scene_add(s, GFX_SCENE_ROOT, GFX_NODE_GROUP, 100, 58, 84, 48, &ui->popup);
+    gfx_scene_set_z(s, ui->popup, 5);
+    gfx_scene_set_fill(s, ui->popup, GFX_ARGB(255, 230, 230, 236));
+    gfx_scene_set_layout(s, ui->popup, GFX_LAYOUT_COLUMN, 4, 4);
+    gfx_scene_add(s, ui->popup, GFX_NODE_TEXT, 0, 0, GFX_SIZE_FILL, GFX_SIZE_CONTENT, &id);
+    gfx_scene_set_color(s, id, GFX_ARGB(255, 30, 30, 30));
+    gfx_scene_set_align(s, id, GFX_ALIGN_CENTER);
+    gfx_scene_set_text(s, id, &font_lato18, "Alert");
+    gfx_scene_add(s, ui->popup, GFX_NODE_GROUP, 8, 0, GFX_SIZE_FILL, GFX_SIZE_FILL, &id);
+    gfx_scene_set_fill(s, id, GFX_ARGB(160, 220, 40, 40));
+}
+
+static void scene_ui_check(bool ok, const char *what)
+{
+    const gfx_scene_stats_t *st = gfx_scene_get_stats();
+
+    if (!ok) {
+        fprintf(stderr, "render_scenes: scene graph %s: %u layouts, %u visits, %u draws, %u culled, %u rects\n", what,
+                (unsigned)st->layouts, (unsigned)st->visits, (unsigned)st->draws, (unsigned)st->culled, (unsigned)st->rects);
+        abort();
+    }
+}
+
+/*
+ * Every update is checked for the work it caused, then the result is
+ * compared with a full redraw of the same scene.
+ */
+static void scene_graph(void)
+{
+    static const gfx_rect_t bounds = { 0, 0, SCENE_CAPTURE_W, SCENE_CAPTURE_H };
+    static uint16_t frame[SCENE_CAPTURE_W * SCENE_CAPTURE_H];
+    const gfx_scene_stats_t *st = gfx_scene_get_stats();
+    gfx_canvas_t cv;
+    ui_nodes_t ui;
+
+    gfx_canvas_init(&cv, SCENE_FB_ADDR);
+    scene_ui_build(&ui_scene, &bounds, &ui);
+    gfx_scene_reset_stats();
+    gfx_scene_render(&ui_scene, &cv);
+    scene_ui_check(st->layouts == ui_scene.used - 1U && st->rects == 1U && st->culled > 0, "first frame");
+
+    /* Fixed size text: no layout, one rectangle, the header behind it stops the walk */
+    gfx_scene_reset_stats();
+    gfx_scene_set_text(&ui_scene, ui.clock, &font_lato18, "12:01");
+    gfx_scene_render(&ui_scene, &cv);
+    scene_ui_check(st->layouts == 0 && st->rects == 1U && st->draws == 2U && st->visits * 4U < ui_scene.used, "clock");
+
+    /* Tile under the popup: only the popup and its children are drawn, the walk ends at its background */
+    gfx_scene_reset_stats();
+    gfx_scene_set_fill(&ui_scene, ui.tiles[2][4], GFX_ARGB(255, 255, 0, 255));
+    gfx_scene_render(&ui_scene, &cv);
+    scene_ui_check(st->draws == 3U && st->visits == 4U && st->layouts == 0, "covered tile");
+
+    /* Moving the popup: the root places its three children, only the popup subtree is entered */
+    gfx_scene_reset_stats();
+    gfx_scene_set_pos(&ui_scene, ui.popup, 96, 66);
+    gfx_scene_render(&ui_scene, &cv);
+    scene_ui_check(st->layouts == 5U, "popup move");
+
+    /* Longer title: the header row is placed again, the spacer shrinks */
+    gfx_scene_reset_stats();
+    gfx_scene_set_text(&ui_scene, ui.title, &font_lato18, "Status OK");
+    gfx_scene_render(&ui_scene, &cv);
+    scene_ui_check(st->layouts == 3U, "title");
+
+    /* Hidden tile: its row closes the gap, the other rows stay */
+    gfx_scene_reset_stats();
+    gfx_scene_set_visible(&ui_scene, ui.tiles[0][3], false);
+    gfx_scene_set_fill(&ui_scene, ui.tiles[1][1], GFX_ARGB(255, 250, 250, 250));
+    gfx_scene_render(&ui_scene, &cv);
+    scene_ui_check(st->layouts == 6U, "hide");
+
+    for (uint32_t y = 0; y < SCENE_CAPTURE_H; y++) {
+        memcpy(&frame[y * SCENE_CAPTURE_W], (const void *)fb_addr(0, y), SCENE_CAPTURE_W * 2U);
+    }
+    DMA2D_fill_rect(0, 0, SCENE_CAPTURE_W, SCENE_CAPTURE_H, 0x0000);
+    gfx_scene_damage(&ui_scene, &bounds);
+    gfx_scene_render(&ui_scene, &cv);
+    for (uint32_t y = 0; y < SCENE_CAPTURE_H; y++) {
+        if (memcmp(&frame[y * SCENE_CAPTURE_W], (const void *)fb_addr(0, y), SCENE_CAPTURE_W * 2U) != 0) {
+            fprintf(stderr, "render_scenes: scene graph updates differ from a full redraw in line %u\n", (unsigned)y);
+            abort();
+        }
+    }
+}
+
+/* Full screen scene of 120 nodes, 8 tiles change colour per frame */
+static uint32_t bench_scene(void)
+{
+    static uint32_t pass = 0;
+    static gfx_node_id_t tiles[112];
+    const gfx_scene_stats_t *st = gfx_scene_get_stats();
+    uint32_t before;
+    gfx_canvas_t cv;
+
+    gfx_canvas_init(&cv, SCENE_FB_ADDR);
+    if (pass == 0) {
+        gfx_node_id_t row;
+
+        gfx_scene_init(&ui_scene, NULL, GFX_ARGB(255, 24, 28, 40));
+        gfx_scene_set_layout(&ui_scene, GFX_SCENE_ROOT, GFX_LAYOUT_COLUMN, 8, 6);
+        for (uint32_t r = 0; r < 8U; r++) {
+            gfx_scene_add(&ui_scene, GFX_SCENE_ROOT, GFX_NODE_GROUP, 0, 0, GFX_SIZE_FILL, GFX_SIZE_FILL, &row);
+            gfx_scene_set_layout(&ui_scene, row, GFX_LAYOUT_ROW, 0, 6);
+            for (uint32_t c = 0; c < 14U; c++) {
+                gfx_scene_add(&ui_scene, row, GFX_NODE_GROUP, 0, 0, GFX_SIZE_FILL, GFX_SIZE_FILL, &tiles[r * 14U + c]);
+                gfx_scene_set_fill(&ui_scene, tiles[r * 14U + c], GFX_ARGB(255, 40, 40 + c * 12, 60 + r * 20));
+            }
+        }
+        gfx_scene_render(&ui_scene, &cv);
+    }
+    before = st->pixels;
+    for (uint32_t i = 0; i < 8U; i++) {
+        uint32_t t = (pass * 37U + i * 13U) % 112U;
+
+        gfx_scene_set_fill(&ui_scene, tiles[t], GFX_ARGB(255, (pass * 8U) & 0xFFU, 120, 200));
+        pass++;
+    }
+    gfx_scene_render(&ui_scene, &cv);
+    return st->pixels - before;
+}
+
+/* Gauge: every primitive once, thin lines and small radii show the anti-aliasing */
+static void scene_draw_gauge(const gfx_canvas_t *cv, float ox, float oy, float scale)
+{
+    static const gfx_vec_point_t star[10] = {
+        { 0.0f, -20.0f }, { 5.9f, -8.1f }, { 19.0f, -6.2f }, { 9.5f, 3.1f }, { 11.8f, 16.2f },
+        { 0.0f, 10.0f }, { -11.8f, 16.2f }, { -9.5f, 3.1f }, { -19.0f, -6.2f }, { -5.9f, -8.1f },
+    };
+    gfx_vec_point_t pts[10];
+
+    gfx_vec_round_rect(cv, ox + 4.0f * scale, oy + 4.0f * scale, 184.0f * scale, 120.0f * scale, 14.0f * scale,
+                       GFX_ARGB(255, 40, 44, 52));
+    gfx_vec_ring(cv, ox + 64.0f * scale, oy + 64.0f * scale, 48.0f * scale, 3.0f * scale, GFX_ARGB(255, 200, 200, 200));
+    gfx_vec_arc(cv, ox + 64.0f * scale, oy + 64.0f * scale, 40.0f * scale, 8.0f * scale, 135.0f, 45.0f,
+                GFX_ARGB(255, 0, 160, 255));
+    gfx_vec_arc(cv, ox + 64.0f * scale, oy + 64.0f * scale, 40.0f * scale, 8.0f * scale, 300.0f, 45.0f,
+                GFX_ARGB(160, 255, 60, 0));
+    gfx_vec_line(cv, ox + 64.0f * scale, oy + 64.0f * scale, ox + 96.5f * scale, oy + 37.3f * scale, 2.5f * scale,
+                 GFX_ARGB(255, 255, 255, 255));
+    gfx_vec_circle(cv, ox + 64.0f * scale, oy + 64.0f * scale, 5.5f * scale, GFX_ARGB(255, 255, 200, 0));
+    for (uint32_t i = 0; i < 10; i++) {
+        pts[i].x = ox + (150.0f + star[i].x) * scale;
+        pts[i].y = oy + (40.0f + star[i].y) * scale;
+    }
+    gfx_vec_polygon(cv, pts, 10, GFX_ARGB(255, 255, 220, 0));
+    for (uint32_t i = 0; i < 6; i++) {
+        gfx_vec_line(cv, ox + (120.0f + (float)i * 10.0f) * scale, oy + 112.0f * scale,
+                     ox + (130.0f + (float)i * 10.0f) * scale, oy + (70.0f + (float)i * 5.3f) * scale,
+                     (0.6f + (float)i * 0.4f) * scale, GFX_ARGB(255, 120, 255, 120));
+    }
+}
+
+static void scene_vector(void)
+{
+    gfx_canvas_t cv;
+
+    gfx_canvas_init(&cv, SCENE_FB_ADDR);
+    scene_draw_gauge(&cv, 0.0f, 0.0f, 1.0f);
+    gfx_vec_circle(&cv, -6.0f, 118.0f, 14.0f, GFX_ARGB(255, 255, 0, 160));      // Left of the canvas: clipped edges
+}
+
+static uint32_t bench_vector(void)
+{
+    const gfx_vec_stats_t *st = gfx_vec_get_stats();
+    uint32_t before = st->mask_pixels;
+    gfx_canvas_t cv;
+
+    gfx_canvas_init(&cv, SCENE_FB_ADDR);
+    scene_draw_gauge(&cv, 0.0f, 0.0f, 2.5f);
+    scene_draw_gauge(&cv, 330.5f, 170.25f, 2.4f);          // Fractional origin, partly clipped
+    return st->mask_pixels - before;
+}
+
+/* Kerning pairs (AV, To, Wa), A4 and A8 fonts, translucent text, clipping at the canvas edge */
+static void scene_text(void)
+{
+    gfx_canvas_t cv;
+
+    gfx_canvas_init(&cv, SCENE_FB_ADDR);
+    DMA2D_fill_rect(0, 0, SCENE_CAPTURE_W, SCENE_CAPTURE_H, GFX_RGB565(24, 32, 48));
+    gfx_font_draw(&cv, &font_lato18, 4, 2, "AVATAR Today, Wave", GFX_ARGB(255, 255, 255, 255));
+    gfx_font_draw(&cv, &font_lato18, 4, 24, "gjpqy {[(|)]} @#$&", GFX_ARGB(255, 255, 200, 80));
+    gfx_font_draw(&cv, &font_lato18, 4, 46, "50% alpha text", GFX_ARGB(128, 120, 220, 255));
+    gfx_font_draw(&cv, &font_lato40_digits, 4, 68, "-12.5%", GFX_ARGB(255, 80, 255, 120));
+    gfx_font_draw(&cv, &font_lato40_digits, 140, 68, "88", GFX_ARGB(255, 255, 80, 80));
+    cv.clip.w = SCENE_CAPTURE_W - 8;                        // Last glyph is cut by the clip
+    gfx_font_draw(&cv, &font_lato18, 160, 46, "clip", GFX_ARGB(255, 255, 255, 255));
+}
+
+static uint32_t bench_text(void)
+{
+    static const char *const lines[] = {
+        "The quick brown fox jumps over the lazy dog 0123456789",
+        "Speed 88 km/h  Battery 76%  Range 142 km  Temp 21.5 C",
+        "AVATAR Today, Wave: kerning pairs in every line {[()]}",
+    };
+    const gfx_font_stats_t *st = gfx_font_get_stats();
+    uint32_t before = st->blend_pixels;
+    gfx_canvas_t cv;
+
+    gfx_canvas_init(&cv, SCENE_FB_ADDR);
+    for (uint32_t i = 0; i < 18U; i++) {
+        gfx_font_draw(&cv, &font_lato18, 8, (int16_t)(i * 24U), lines[i % 3U], GFX_ARGB(255, 255, 255, 255));
+    }
+    gfx_font_draw(&cv, &font_lato40_digits, 560, 420, "123.45%", GFX_ARGB(255, 255, 200, 0));
+    return st->blend_pixels - before;
+}
+
+static const char *const cjk_page[] = {
+    "설정",
+    "디스플레이 밝기",
+    "화면 꺼짐 시간",
+    "언어 및 지역",
+    "네트워크 연결 상태",
+    "무선 네트워크에 연결되었습니다",
+    "배터리 잔량이 부족합니다 충전기를 연결하세요",
+    "소프트웨어 업데이트를 확인하는 중입니다",
+    "시스템 정보",
+    "장치 이름 일련 번호",
+    "펌웨어 버전 저장 공간 사용량",
+    "알림 및 소리 음량 조절 진동 모드",
+    "방해 금지 시간",
+    "날짜와 시간 자동 설정",
+    "표준 시간대 선택",
+    "사용자 계정 관리",
+    "비밀번호를 다시 입력하세요",
+    "오류가 발생했습니다 잠시 후 다시 시도하세요",
+    "현재 속도와 평균 속도",
+    "주행 거리 및 남은 거리",
+};
+
+static gfx_font_t font_ko16;
+
+static void scene_cjk_open(void)
+{
+    if (font_ko16.glyphs == NULL) {
+        gfx_font_open(&font_ko16, (uint32_t)font_nanum16_ko_store);
+    }
+}
+
+/* Hangul from a compressed store, the last line has characters missing in the subset (fallback glyph) */
+static void scene_text_cjk(void)
+{
+    gfx_canvas_t cv;
+
+    scene_cjk_open();
+    gfx_canvas_init(&cv, SCENE_FB_ADDR);
+    DMA2D_fill_rect(0, 0, SCENE_CAPTURE_W, SCENE_CAPTURE_H, GFX_RGB565(24, 32, 48));
+    for (uint32_t i = 0; i < 5U; i++) {
+        gfx_font_draw(&cv, &font_ko16, 4, (int16_t)(2U + i * 20U), cjk_page[5U + i], GFX_ARGB(255, 255, 255, 255));
+    }
+    gfx_font_draw(&cv, &font_ko16, 4, 104, "확인 취소 한글", GFX_ARGB(255, 255, 200, 80));
+}
+
+/* Page change worst case: the atlas is flushed, every glyph is looked up and unpacked from flash */
+static uint32_t bench_text_cjk(void)
+{
+    const gfx_font_stats_t *st = gfx_font_get_stats();
+    uint32_t before = st->blend_pixels;
+    gfx_canvas_t cv;
+
+    scene_cjk_open();
+    gfx_canvas_init(&cv, SCENE_FB_ADDR);
+    gfx_font_cache_flush();
+    for (uint32_t i = 0; i < 20U; i++) {
+        gfx_font_draw(&cv, &font_ko16, 8, (int16_t)(i * 24U), cjk_page[i], GFX_ARGB(255, 255, 255, 255));
+    }
+    return st->blend_pixels - before;
+}
+
+const render_scene_t render_scenes[] = {
+    { "fill_rects",         "fill",     scene_fill_rects,       bench_fill_screen,      NULL, 0.0f },
+    { "fill_small",         "fill",     NULL,                   bench_fill_small,       NULL, 0.0f },
+    { "copy_rgb565",        "image",    scene_copy_rgb565,      bench_copy_rgb565,      NULL, 0.0f },
+    { "pfc_argb8888",       "image",    scene_pfc_argb8888,     bench_pfc_argb8888,     NULL, 0.0f },
+    { "pfc_l8_clut",        "image",    scene_pfc_l8,           bench_pfc_l8,           NULL, 0.0f },
+    { "decode_lz4",         "image",    scene_decode,           bench_decode_lz4,       NULL, 0.0f },
+    { "decode_qoi",         "image",    NULL,                   bench_decode_qoi,       NULL, 0.0f },
+#ifdef RENDER_BUNDLE
+    { "asset_bundle",       "image",    scene_bundle,           bench_bundle,           NULL, 0.0f },
+#endif
+#ifdef RENDER_JPEG_DIR
+    { "jpeg_photo",         "image",    scene_jpeg,             bench_mjpeg,            NULL, 0.0f },
+#endif
+    { "convert_dither",     "image",    scene_convert,          bench_convert,          NULL, 0.0f },
+    { "grad_vertical",      "fill",     scene_gradients,        bench_grad_vertical,    NULL, 0.0f },
+    { "grad_horizontal",    "fill",     NULL,                   bench_grad_horizontal,  NULL, 0.0f },
+    { "grad_radial",        "fill",     NULL,                   bench_grad_radial,      NULL, 0.0f },
+    { "xform_affine",       "image",    scene_xform,            bench_xform_nearest,    NULL, 0.0f },
+    { "xform_bilinear",     "image",    NULL,                   bench_xform_bilinear,   NULL, 0.0f },
+    { "tri_affine",         "image",    scene_tri,              bench_tri_affine,       NULL, 3.6f },
+    { "tri_perspective",    "image",    NULL,                   bench_tri_perspective,  NULL, 3.6f },
+    { "blit_modes",         "blend",    scene_blit,             bench_blit_clut_key,    NULL, 0.0f },
+    { "blit_key_rgb565",    "blend",    NULL,                   bench_blit_key,         NULL, 0.0f },
+    { "fx_effects",         "effect",   scene_effects,          bench_shadow,           NULL, 0.0f },
+    { "fx_blur",            "effect",   NULL,                   bench_blur,             NULL, 0.0f },
+    { "blend_argb8888",     "blend",    scene_blend_argb8888,   bench_blend_argb8888,   NULL, 0.0f },
+    { "blend_a8_mask",      "blend",    scene_blend_a8,         bench_blend_a8,         NULL, 0.0f },
+    { "overlay_argb4444",   "blend",    scene_overlay,          NULL,                   scene_overlay_cleanup, 0.0f },
+    { "vfb_bezel",          "fill",     scene_vfb,              NULL,                   scene_vfb_cleanup, 0.0f },
+    { "anim_sprites",       "image",    scene_anim,             bench_anim,             NULL, 0.0f },
+    { "scene_graph",        "fill",     scene_graph,            bench_scene,            NULL, 0.0f },
+    { "vector_aa",          "vector",   scene_vector,           bench_vector,           NULL, 0.0f },
+    { "text_atlas",         "text",     scene_text,             bench_text,             NULL, 0.0f },
+    { "text_cjk",           "text",     scene_text_cjk,         bench_text_cjk,         NULL, 0.0f },
+};
+
+const uint32_t render_scene_count = sizeof(render_scenes) / sizeof(render_scenes[0]);
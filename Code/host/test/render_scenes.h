@@ -0,0 +1,37 @@
+/**
+ * @file render_scenes.h
+ * @brief Scenes of the golden image / fill rate suite, drawn with the firmware drawing code
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ */
+
+#ifndef __RENDER_SCENES_H__
+#define __RENDER_SCENES_H__
+
+#include <stdint.h>
+
+#define SCENE_FB_ADDR           0x24040000UL
+#define SCENE_FB_PITCH          800U
+#define SCENE_CAPTURE_W         192U            // Golden images cover the top left corner of the screen
+#define SCENE_CAPTURE_H         128U
+#define SCENE_ASSET_ADDR        0x90200000UL    // Source images live in RO_DATA like real assets
+
+typedef struct {
+    const char *name;
+    const char *kind;                           // fill / blend / image / vector / text / transform
+    void      (*render)(void);                  // Draws the scene inside the capture window (NULL: bench only)
+    uint32_t  (*bench)(void);                   // One benchmark pass, returns pixels drawn (NULL: no bench)
+    void      (*cleanup)(void);                 // Undo layer changes after the capture (optional)
+    float       min_mps;                        // Device MP/s the bench must reach (0: no floor)
+} render_scene_t;
+
+extern const render_scene_t render_scenes[];
+extern const uint32_t render_scene_count;
+
+/**
+ * @brief Bring the display back to the state every scene starts from
+ */
+void render_scenes_reset(void);
+
+#endif /* __RENDER_SCENES_H__ */
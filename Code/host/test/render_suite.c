@@ -0,0 +1,437 @@
+/**
+ * @file render_suite.c
+ * @brief Golden image regression and fill rate benchmark for the rendering layer
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note usage: render_suite [--golden DIR] [--out DIR] [--update] [--no-golden] [--no-bench]
+ *                           [--filter NAME] [--tolerance N] [--max-bad-ppm N] [--perf-drop PCT]
+ *
+ *       Golden check: the capture window of the composed LTDC output is
+ *       compared with DIR/<scene>.ppm. A pixel is bad when one channel is off
+ *       by more than the tolerance (default 8, one RGB565 red/blue step), a
+ *       scene fails when more than max-bad-ppm pixels per million are bad.
+ *       Mismatches write <scene>.actual.ppm and <scene>.diff.ppm to --out.
+ *
+ *       Benchmark: device MP/s from the simulator's virtual time, compared
+ *       with DIR/bench_baseline.txt and failing on a drop larger than
+ *       perf-drop percent (default 5) or under the scene's min_mps. Virtual
+ *       time is the DMA2D bus model and the register accesses, plus the CPU
+ *       work: the firmware runs natively, so after every pass the work
+ *       counters of the drawing modules are charged at modelled Cortex-M7
+ *       cycles per unit (cpu_costs[]), without overlap with DMA2D. Host MP/s
+ *       is wall clock and only printed.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "main.h"
+#include "dma2d.h"
+#include "ltdc.h"
+#include "lcd_present.h"
+#include "mdma_fetch.h"
+#include "gfx_blit.h"
+#include "gfx_convert.h"
+#include "gfx_effect.h"
+#include "gfx_font.h"
+#include "gfx_gradient.h"
+#include "gfx_image.h"
+#include "gfx_scene.h"
+#include "gfx_transform.h"
+#include "gfx_tri.h"
+#include "gfx_vector.h"
+#include "render_scenes.h"
+#include "sim.h"
+
+#ifndef RENDER_GOLDEN_DIR
+#define RENDER_GOLDEN_DIR       "."
+#endif
+
+#define BENCH_MIN_PIXELS        4000000ULL          // Per primitive, at least this many pixels
+#define BENCH_MAX_PASSES        200U
+#define BASELINE_FILE           "bench_baseline.txt"
+#define MAX_SCENES              64U
+
+typedef struct {
+    const char *golden_dir;
+    const char *out_dir;
+    const char *filter;
+    int         update;
+    int         golden;
+    int         bench;
+    uint32_t    tolerance;
+    uint32_t    max_bad_ppm;
+    double      perf_drop;
+} suite_opts_t;
+
+typedef struct {
+    char        name[64];
+    double      mps;
+} baseline_t;
+
+typedef struct {
+    uint32_t  (*count)(void);                       // Work counter of a firmware module
+    uint32_t    cycles;                             // Modelled Cortex-M7 cycles per unit
+} cpu_cost_t;
+
+static uint8_t  capture[SCENE_CAPTURE_W * SCENE_CAPTURE_H * 3U];
+static uint8_t  golden[SCENE_CAPTURE_W * SCENE_CAPTURE_H * 3U];
+static uint8_t  frame[800U * 480U * 3U];
+
+static uint32_t cost_lz4(void)       { return gfx_img_get_stats()->lz4_pixels; }
+static uint32_t cost_qoi(void)       { return gfx_img_get_stats()->qoi_pixels; }
+static uint32_t cost_dither(void)    { return gfx_cvt_get_stats()->dither_pixels; }
+static uint32_t cost_grad(void)      { return gfx_grad_get_stats()->cpu_pixels; }
+static uint32_t cost_xform(void)     { return gfx_xform_get_stats()->pixels; }
+static uint32_t cost_bilinear(void)  { return gfx_xform_get_stats()->bilinear; }
+static uint32_t cost_tri_px(void)    { return gfx_tri_get_stats()->pixels; }
+static uint32_t cost_tri_spans(void) { return gfx_tri_get_stats()->spans; }
+static uint32_t cost_tri_bins(void)  { return gfx_tri_get_stats()->bins; }
+static uint32_t cost_tri(void)       { return gfx_tri_get_stats()->triangles; }
+static uint32_t cost_blit(void)      { return gfx_blit_get_stats()->cpu_pixels; }
+static uint32_t cost_blur(void)      { return gfx_fx_get_stats()->blur_pixels; }
+static uint32_t cost_shadow(void)    { return gfx_fx_get_stats()->shadow_pixels; }
+static uint32_t cost_mask(void)      { return gfx_vec_get_stats()->mask_pixels; }
+static uint32_t cost_edges(void)     { return gfx_vec_get_stats()->edges; }
+static uint32_t cost_glyphs(void)    { return gfx_font_get_stats()->glyphs; }
+static uint32_t cost_unpack(void)    { return gfx_font_get_stats()->decoded_bytes; }
+static uint32_t cost_strip(void)     { return gfx_font_get_stats()->blend_pixels; }
+static uint32_t cost_visits(void)    { return gfx_scene_get_stats()->visits; }
+
+/* Inner loop estimates: loads, ALU and stores of one unit, single issue, hits in the D-cache.
+ * JPEG is decoded by the hardware codec on the device, it costs no CPU time there. */
+static const cpu_cost_t cpu_costs[] = {
+    { cost_lz4,         4 },                        // Literal / match byte copies through the ring, 2 bytes a pixel
+    { cost_qoi,         14 },                       // Op decode, colour cache hash, RGB565 pack
+    { cost_dither,      10 },                       // Bayer offset, UQADD8, pack, two pixels a word
+    { cost_grad,        6 },                        // Template pixel: LUT load and store, distance step, bound compares
+    { cost_xform,       8 },                        // Nearest sample: 16.16 step, clamp, ARGB8888 load and store
+    { cost_bilinear,    16 },                       // On top: three more texels and the weights
+    { cost_tri_px,      8 },                        // Span pixel, ARGB4444 blend included on average
+    { cost_tri_spans,   70 },                       // Two VDIV.F32, two integer divisions, end point mapping
+    { cost_tri_bins,    60 },                       // Edge setup of a triangle in a tile
+    { cost_tri,         400 },                      // Snap, bounding box, attribute planes, binning
+    { cost_blit,        6 },                        // Keyed copy (2 pixels a word) to full blend
+    { cost_blur,        36 },                       // Three box passes, horizontal and vertical
+    { cost_shadow,      12 },                       // Coverage and blur of the shadow tile
+    { cost_mask,        5 },                        // Coverage accumulation of the band mask
+    { cost_edges,       120 },                      // Edge setup, clipping into bands
+    { cost_glyphs,      150 },                      // Layout, kerning, atlas lookup
+    { cost_unpack,      6 },                        // PackBits / A4 unpacking into the atlas
+    { cost_strip,       2 },                        // Strip cleared, glyph coverage merged into it
+    { cost_visits,      40 },                       // Scene node tested against a damaged rectangle
+};
+#define CPU_COSTS               (sizeof(cpu_costs) / sizeof(cpu_costs[0]))
+
+static baseline_t baselines[MAX_SCENES];
+static uint32_t   baseline_count = 0;
+static baseline_t measured[MAX_SCENES];
+static uint32_t   measured_count = 0;
+
+static int ppm_write(const char *path, const uint8_t *rgb, uint32_t w, uint32_t h)
+{
+    FILE *f = fopen(path, "wb");
+    int ok;
+
+    if (f == NULL) {
+        return 0;
+    }
+    fprintf(f, "P6\n%u %u\n255\n", w, h);
+    ok = fwrite(rgb, 3, (size_t)w * h, f) == (size_t)w * h;
+    return (fclose(f) == 0) && ok;
+}
+
+static int ppm_read(const char *path, uint8_t *rgb, uint32_t w, uint32_t h)
+{
+    FILE *f = fopen(path, "rb");
+    unsigned fw = 0, fh = 0, maxval = 0;
+    int ok;
+
+    if (f == NULL) {
+        return 0;
+    }
+    ok = fscanf(f, "P6 %u %u %u", &fw, &fh, &maxval) == 3 && fw == w && fh == h && maxval == 255 &&
+         fgetc(f) != EOF && fread(rgb, 3, (size_t)w * h, f) == (size_t)w * h;
+    fclose(f);
+    return ok;
+}
+
+static void capture_window(void)
+{
+    uint32_t w, h;
+
+    if (!sim_ltdc_compose(frame, &w, &h)) {
+        memset(capture, 0, sizeof(capture));
+        return;
+    }
+    for (uint32_t y = 0; y < SCENE_CAPTURE_H; y++) {
+        memcpy(&capture[y * SCENE_CAPTURE_W * 3U], &frame[y * w * 3U], SCENE_CAPTURE_W * 3U);
+    }
+}
+
+static const char *path_join(char *buf, size_t size, const char *dir, const char *name, const char *ext)
+{
+    snprintf(buf, size, "%s/%s%s", dir, name, ext);
+    return buf;
+}
+
+/* Returns 0 on pass */
+static int golden_check(const suite_opts_t *o, const render_scene_t *s)
+{
+    static uint8_t diff[SCENE_CAPTURE_W * SCENE_CAPTURE_H * 3U];
+    const uint32_t pixels = SCENE_CAPTURE_W * SCENE_CAPTURE_H;
+    uint32_t bad = 0, max_diff = 0;
+    double sq = 0.0, psnr;
+    char path[512];
+
+    render_scenes_reset();
+    s->render();
+    capture_window();
+    if (s->cleanup) {
+        s->cleanup();
+    }
+
+    if (o->update) {
+        if (!ppm_write(path_join(path, sizeof(path), o->golden_dir, s->name, ".ppm"), capture,
+                       SCENE_CAPTURE_W, SCENE_CAPTURE_H)) {
+            printf("  %-20s cannot write %s\n", s->name, path);
+            return 1;
+        }
+        printf("  %-20s %-9s updated\n", s->name, s->kind);
+        return 0;
+    }
+
+    if (!ppm_read(path_join(path, sizeof(path), o->golden_dir, s->name, ".ppm"), golden,
+                  SCENE_CAPTURE_W, SCENE_CAPTURE_H)) {
+        printf("  %-20s %-9s MISSING golden %s (run with --update)\n", s->name, s->kind, path);
+        return 1;
+    }
+
+    for (uint32_t i = 0; i < pixels; i++) {
+        uint32_t worst = 0;
+
+        for (uint32_t c = 0; c < 3; c++) {
+            int32_t d = (int32_t)capture[i * 3U + c] - (int32_t)golden[i * 3U + c];
+            uint32_t ad = (uint32_t)(d < 0 ? -d : d);
+
+            sq += (double)ad * ad;
+            worst = ad > worst ? ad : worst;
+        }
+        max_diff = worst > max_diff ? worst : max_diff;
+        bad += worst > o->tolerance;
+        /* Diff image: bad pixels red, small differences grey, equal pixels dimmed actual */
+        diff[i * 3U + 0] = worst > o->tolerance ? 255 : (uint8_t)(worst ? 128 : capture[i * 3U] / 4U);
+        diff[i * 3U + 1] = worst > o->tolerance ? 0 : (uint8_t)(worst ? 128 : capture[i * 3U + 1] / 4U);
+        diff[i * 3U + 2] = worst > o->tolerance ? 0 : (uint8_t)(worst ? 128 : capture[i * 3U + 2] / 4U);
+    }
+
+    psnr = (sq == 0.0) ? INFINITY : 10.0 * log10(255.0 * 255.0 / (sq / (pixels * 3.0)));
+    if ((uint64_t)bad * 1000000ULL > (uint64_t)o->max_bad_ppm * pixels) {
+        ppm_write(path_join(path, sizeof(path), o->out_dir, s->name, ".actual.ppm"), capture,
+                  SCENE_CAPTURE_W, SCENE_CAPTURE_H);
+        ppm_write(path_join(path, sizeof(path), o->out_dir, s->name, ".diff.ppm"), diff,
+                  SCENE_CAPTURE_W, SCENE_CAPTURE_H);
+        printf("  %-20s %-9s FAIL  bad=%u max=%u psnr=%.1f dB, see %s\n",
+               s->name, s->kind, bad, max_diff, psnr, path);
+        return 1;
+    }
+    printf("  %-20s %-9s ok    bad=%u max=%u psnr=%.1f dB\n", s->name, s->kind, bad, max_diff, psnr);
+    return 0;
+}
+
+static void baseline_load(const char *dir)
+{
+    char path[512];
+    FILE *f = fopen(path_join(path, sizeof(path), dir, BASELINE_FILE, ""), "r");
+    char line[256];
+
+    if (f == NULL) {
+        return;
+    }
+    while (fgets(line, sizeof(line), f) && baseline_count < MAX_SCENES) {
+        baseline_t *b = &baselines[baseline_count];
+
+        if (line[0] != '#' && sscanf(line, "%63s %lf", b->name, &b->mps) == 2) {
+            baseline_count++;
+        }
+    }
+    fclose(f);
+}
+
+static int baseline_save(const char *dir)
+{
+    char path[512];
+    FILE *f = fopen(path_join(path, sizeof(path), dir, BASELINE_FILE, ""), "w");
+
+    if (f == NULL) {
+        return 0;
+    }
+    fprintf(f, "# render_suite --update: modelled device throughput, MP/s\n");
+    for (uint32_t i = 0; i < measured_count; i++) {
+        fprintf(f, "%-20s %.2f\n", measured[i].name, measured[i].mps);
+    }
+    return fclose(f) == 0;
+}
+
+static const baseline_t *baseline_find(const char *name)
+{
+    for (uint32_t i = 0; i < baseline_count; i++) {
+        if (strcmp(baselines[i].name, name) == 0) {
+            return &baselines[i];
+        }
+    }
+    return NULL;
+}
+
+static double wall_seconds(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/* Charge the CPU work counted since the last call to virtual time */
+static uint64_t bench_charge_cpu(uint32_t last[CPU_COSTS])
+{
+    uint64_t cycles = 0;
+
+    for (uint32_t i = 0; i < CPU_COSTS; i++) {
+        uint32_t now = cpu_costs[i].count();
+
+        cycles += (uint64_t)(now - last[i]) * cpu_costs[i].cycles;
+        last[i] = now;
+    }
+    sim_charge_cycles(cycles);
+    return cycles;
+}
+
+/* Returns 0 on pass */
+static int bench_run(const suite_opts_t *o, const render_scene_t *s)
+{
+    const baseline_t *base;
+    uint64_t pixels = 0, cycles, cpu = 0;
+    uint32_t passes = 0, last[CPU_COSTS];
+    double t0, wall, model_mps, host_mps;
+    int fail = 0;
+
+    render_scenes_reset();
+    s->bench();                                             // Warm up: CLUT loads, first touch of host pages
+    bench_charge_cpu(last);
+
+    cycles = sim_cycles();
+    t0 = wall_seconds();
+    while (pixels < BENCH_MIN_PIXELS && passes < BENCH_MAX_PASSES) {
+        pixels += s->bench();
+        cpu += bench_charge_cpu(last);
+        passes++;
+    }
+    wall = wall_seconds() - t0;
+    cycles = sim_cycles() - cycles;
+
+    host_mps = (double)pixels / wall / 1e6;
+    if (cycles == 0) {
+        printf("  %-20s %-9s %10llu px %8s MP/s device %8.1f MP/s host  (no device time)\n",
+               s->name, s->kind, (unsigned long long)pixels, "-", host_mps);
+        return 1;
+    }
+    model_mps = (double)pixels / ((double)cycles / SIM_CPU_HZ) / 1e6;
+
+    if (measured_count < MAX_SCENES) {
+        snprintf(measured[measured_count].name, sizeof(measured[0].name), "%s", s->name);
+        measured[measured_count++].mps = model_mps;
+    }
+
+    base = baseline_find(s->name);
+    printf("  %-20s %-9s %10llu px %8.1f MP/s device %8.1f MP/s host %3u%% cpu",
+           s->name, s->kind, (unsigned long long)pixels, model_mps, host_mps, (unsigned)(cpu * 100U / cycles));
+    if (model_mps < s->min_mps) {
+        printf("  under %.1f MP/s FAIL\n", s->min_mps);
+        fail = 1;
+    } else if (o->update) {
+        printf("\n");
+    } else if (base == NULL) {
+        printf("  (no baseline)\n");
+    } else {
+        double change = (model_mps - base->mps) * 100.0 / base->mps;
+
+        fail = change < -o->perf_drop;
+        printf("  %+6.1f%% %s\n", change, fail ? "FAIL" : "ok");
+    }
+    return fail;
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: render_suite [--golden DIR] [--out DIR] [--update] [--no-golden] [--no-bench]\n"
+                    "                    [--filter NAME] [--tolerance N] [--max-bad-ppm N] [--perf-drop PCT]\n");
+    exit(2);
+}
+
+int main(int argc, char **argv)
+{
+    suite_opts_t o = { RENDER_GOLDEN_DIR, ".", NULL, 0, 1, 1, 8, 1000, 5.0 };
+    int failures = 0;
+
+    for (int i = 1; i < argc; i++) {
+        const char *a = argv[i];
+        const char *v = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+        if (!strcmp(a, "--update"))                 { o.update = 1; }
+        else if (!strcmp(a, "--no-golden"))         { o.golden = 0; }
+        else if (!strcmp(a, "--no-bench"))          { o.bench = 0; }
+        else if (v == NULL)                         { usage(); }
+        else if (!strcmp(a, "--golden"))            { o.golden_dir = v; i++; }
+        else if (!strcmp(a, "--out"))               { o.out_dir = v; i++; }
+        else if (!strcmp(a, "--filter"))            { o.filter = v; i++; }
+        else if (!strcmp(a, "--tolerance"))         { o.tolerance = (uint32_t)atoi(v); i++; }
+        else if (!strcmp(a, "--max-bad-ppm"))       { o.max_bad_ppm = (uint32_t)atoi(v); i++; }
+        else if (!strcmp(a, "--perf-drop"))         { o.perf_drop = atof(v); i++; }
+        else                                        { usage(); }
+    }
+
+    sim_init();
+    MX_LTDC_Init();
+    MX_DMA2D_Init();
+    mdma_fetch_init();
+    lcd_present_init();
+
+    if (o.golden) {
+        printf("golden images (%ux%u, tolerance %u, max %u bad ppm)\n",
+               SCENE_CAPTURE_W, SCENE_CAPTURE_H, o.tolerance, o.max_bad_ppm);
+        for (uint32_t i = 0; i < render_scene_count; i++) {
+            const render_scene_t *s = &render_scenes[i];
+
+            if (s->render && (o.filter == NULL || strstr(s->name, o.filter))) {
+                failures += golden_check(&o, s);
+            }
+        }
+    }
+
+    if (o.bench) {
+        baseline_load(o.golden_dir);
+        printf("fill rate (device = simulated STM32H7B0 @ %lu MHz)\n", SIM_CPU_HZ / 1000000UL);
+        for (uint32_t i = 0; i < render_scene_count; i++) {
+            const render_scene_t *s = &render_scenes[i];
+
+            if (s->bench && (o.filter == NULL || strstr(s->name, o.filter))) {
+                failures += bench_run(&o, s);
+            }
+        }
+        if (o.update && o.filter == NULL && !baseline_save(o.golden_dir)) {
+            fprintf(stderr, "render_suite: cannot write %s/%s\n", o.golden_dir, BASELINE_FILE);
+            failures++;
+        }
+    }
+
+    if (failures) {
+        printf("render_suite: %d failure(s)\n", failures);
+        return 1;
+    }
+    printf("render_suite: ok\n");
+    return 0;
+}
@@ -0,0 +1,910 @@
+/**
+ * @file sim_selftest.c
+ * @brief Runs the firmware display code on the simulator and checks pixels, timing and statistics
+ * @author 404zen
+ * @date 2026-10-18
+ * @version 1.0
+ * @note usage: sim_selftest [output dir], writes selftest_frame.ppm there
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "main.h"
+#include "dma2d.h"
+#include "gpio.h"
+#include "ltdc.h"
+#include "lcd_overlay.h"
+#include "lcd_present.h"
+#include "lcd_scroll.h"
+#include "lcd_shot.h"
+#include "lcd_vfb.h"
+#include "mdma_fetch.h"
+#include "touch_gesture.h"
+#include "touch_gt911.h"
+#include "sim.h"
+
+#define FB_ADDR                 0x24040000UL
+#define SCRATCH_ADDR            0x24000000UL        // RAM, free on the host
+#define OSPI_SCRATCH_ADDR       0x90700000UL        // External flash, writable on the host
+
+#ifndef TOUCH_TRACE_DIR
+#define TOUCH_TRACE_DIR         "test/touch"
+#endif
+#define GESTURE_LOG_MAX         128
+
+#define CHECK(cond)                                                             \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+            failures++;                                                         \
+        }                                                                       \
+    } while (0)
+
+static int failures = 0;
+
+static uint16_t fb_pixel(uint32_t x, uint32_t y)
+{
+    return ((volatile uint16_t *)FB_ADDR)[y * 800U + x];
+}
+
+static void test_fill_and_copy(void)
+{
+    const sim_dma2d_stats_t *st = sim_dma2d_get_stats();
+
+    sim_dma2d_reset_stats();
+    DMA2D_fill_rect(10, 20, 100, 50, 0xF800);
+    CHECK(fb_pixel(10, 20) == 0xF800);
+    CHECK(fb_pixel(109, 69) == 0xF800);
+    CHECK(fb_pixel(110, 69) != 0xF800);
+    CHECK(st->last.op == SIM_DMA2D_R2M);
+    CHECK(st->last.pixels == 5000);
+    CHECK(st->last.bytes_read == 0);
+    CHECK(st->last.bytes_written == 10000);
+
+    DMA2D_copy_rect(FB_ADDR + (20U * 800U + 10U) * 2U, 800, FB_ADDR + (300U * 800U + 400U) * 2U, 800,
+                    100, 50, DMA2D_INPUT_RGB565);
+    CHECK(fb_pixel(400, 300) == 0xF800);
+    CHECK(fb_pixel(499, 349) == 0xF800);
+    CHECK(st->last.op == SIM_DMA2D_M2M);
+    CHECK(st->last.bytes_read == 10000 && st->last.bytes_written == 10000);
+    CHECK(st->jobs[SIM_DMA2D_R2M] == 1 && st->jobs[SIM_DMA2D_M2M] == 1);
+}
+
+static void test_pfc_and_blend(void)
+{
+    static uint16_t dtcm_pixels[16];
+    static const uint32_t clut[4] = { 0xFF000000, 0xFFFF0000, 0xFF00FF00, 0xFF0000FF };
+    volatile uint8_t *l8 = (volatile uint8_t *)SCRATCH_ADDR;
+    volatile uint32_t *argb = (volatile uint32_t *)(SCRATCH_ADDR + 0x100);
+    volatile uint16_t *out = (volatile uint16_t *)(SCRATCH_ADDR + 0x200);
+    const sim_dma2d_stats_t *st = sim_dma2d_get_stats();
+
+    /* L8 -> RGB565 through the CLUT */
+    DMA2D_load_clut(clut, 4);
+    CHECK(st->last.op == SIM_DMA2D_CLUT_LOAD && st->last.bytes_read == 16);
+    for (uint32_t i = 0; i < 4; i++) {
+        l8[i] = (uint8_t)i;
+    }
+    hdma2d.Init.Mode = DMA2D_M2M_PFC;
+    hdma2d.Init.ColorMode = DMA2D_OUTPUT_RGB565;
+    hdma2d.Init.OutputOffset = 0;
+    hdma2d.LayerCfg[1].InputColorMode = DMA2D_INPUT_L8;
+    CHECK(HAL_DMA2D_Init(&hdma2d) == HAL_OK);
+    CHECK(HAL_DMA2D_ConfigLayer(&hdma2d, 1) == HAL_OK);
+    CHECK(HAL_DMA2D_Start(&hdma2d, SCRATCH_ADDR, SCRATCH_ADDR + 0x200, 4, 1) == HAL_OK);
+    CHECK(HAL_DMA2D_PollForTransfer(&hdma2d, 10) == HAL_OK);
+    CHECK(out[0] == 0x0000 && out[1] == 0xF800 && out[2] == 0x07E0 && out[3] == 0x001F);
+    CHECK(st->last.op == SIM_DMA2D_M2M_PFC && st->last.bytes_read == 4 && st->last.bytes_written == 8);
+
+    /* 50 % white over blue */
+    argb[0] = 0x80FFFFFF;
+    out[0] = 0x001F;
+    hdma2d.Init.Mode = DMA2D_M2M_BLEND;
+    hdma2d.LayerCfg[1].InputColorMode = DMA2D_INPUT_ARGB8888;
+    hdma2d.LayerCfg[0].InputColorMode = DMA2D_INPUT_RGB565;
+    hdma2d.LayerCfg[0].AlphaMode = DMA2D_NO_MODIF_ALPHA;
+    CHECK(HAL_DMA2D_Init(&hdma2d) == HAL_OK);
+    CHECK(HAL_DMA2D_ConfigLayer(&hdma2d, 0) == HAL_OK);
+    CHECK(HAL_DMA2D_ConfigLayer(&hdma2d, 1) == HAL_OK);
+    CHECK(HAL_DMA2D_BlendingStart(&hdma2d, SCRATCH_ADDR + 0x100, SCRATCH_ADDR + 0x200, SCRATCH_ADDR + 0x200, 1, 1) == HAL_OK);
+    CHECK(HAL_DMA2D_PollForTransfer(&hdma2d, 10) == HAL_OK);
+    CHECK(out[0] == ((16U << 11) | (32U << 5) | 31U));
+    CHECK(st->last.op == SIM_DMA2D_M2M_BLEND && st->last.bytes_read == 6 && st->last.bytes_written == 2);
+
+    /* One 4:2:0 MCU (16x16): four Y blocks, then Cb and Cr, each chroma sample covers 2x2 pixels */
+    memset((void *)SCRATCH_ADDR, 128, 384);
+    l8[64] = 200;                                           // Y block 1, pixel (8, 0)
+    l8[320] = 192;                                          // Cr (0, 0)
+    DMA2D_convert_ycbcr_start(SCRATCH_ADDR, 16, DMA2D_CSS_420, SCRATCH_ADDR + 0x200, 16, 16, 16);
+    DMA2D_wait();
+    CHECK(out[0] == ((27U << 11) | (20U << 5) | 16U));      // 128 + 1.402 * 64, 128 - 0.714 * 64
+    CHECK(out[1] == out[0] && out[16] == out[0] && out[17] == out[0]);
+    CHECK(out[2] == ((16U << 11) | (32U << 5) | 16U));
+    CHECK(out[8] == ((25U << 11) | (50U << 5) | 25U));
+    CHECK(st->last.op == SIM_DMA2D_M2M_PFC && st->last.bytes_read == 384 && st->last.bytes_written == 512);
+
+    /* Lines must cover whole MCUs */
+    DMA2D_convert_ycbcr_start(SCRATCH_ADDR, 12, DMA2D_CSS_420, SCRATCH_ADDR + 0x200, 16, 12, 16);
+    DMA2D_wait();
+    CHECK(DMA2D->ISR & DMA2D_ISR_CEIF);
+    DMA2D->IFCR = DMA2D_IFCR_CCEIF;
+
+    /* Bad address: transfer error, nothing written */
+    hdma2d.Init.Mode = DMA2D_R2M;
+    CHECK(HAL_DMA2D_Init(&hdma2d) == HAL_OK);
+    CHECK(HAL_DMA2D_Start(&hdma2d, 0, 0x10000000, 4, 4) == HAL_OK);
+    HAL_DMA2D_PollForTransfer(&hdma2d, 10);                 // Job already ended, only unlocks the handle
+    CHECK(DMA2D->ISR & DMA2D_ISR_TEIF);
+    DMA2D->IFCR = DMA2D_IFCR_CTEIF;
+    CHECK(!(DMA2D->ISR & DMA2D_ISR_TEIF));
+
+    /* DTCM, and host .bss standing in for it, are out of reach of the masters */
+    CHECK(HAL_DMA2D_Start(&hdma2d, 0, 0x20000000, 4, 4) == HAL_OK);
+    HAL_DMA2D_PollForTransfer(&hdma2d, 10);
+    CHECK(DMA2D->ISR & DMA2D_ISR_TEIF);
+    DMA2D->IFCR = DMA2D_IFCR_CTEIF;
+    CHECK(HAL_DMA2D_Start(&hdma2d, 0, (uint32_t)(uintptr_t)dtcm_pixels, 4, 4) == HAL_OK);
+    HAL_DMA2D_PollForTransfer(&hdma2d, 10);
+    CHECK(DMA2D->ISR & DMA2D_ISR_TEIF);
+    DMA2D->IFCR = DMA2D_IFCR_CTEIF;
+
+    MX_DMA2D_Init();
+}
+
+static void test_present(void)
+{
+    const lcd_present_stats_t *ps;
+    uint32_t seq;
+    uint64_t t0;
+    uint32_t px;
+
+    lcd_present_init();
+    lcd_present_reset_stats();
+
+    /* Frame period from the timing registers: 1081 * 543 pixel clocks at 33 MHz */
+    t0 = sim_cycles();
+    sim_run_frames(1);
+    t0 = sim_cycles();
+    sim_run_frames(10);
+    CHECK(sim_cycles() - t0 > 10ULL * 1081 * 543 * (SIM_CPU_HZ / SIM_LTDC_PIXCLK_HZ));
+    CHECK(sim_cycles() - t0 < 10ULL * 1081 * 544 * (SIM_CPU_HZ / SIM_LTDC_PIXCLK_HZ + 1));
+
+    /* Shadow address only becomes active at the vblank reload */
+    DMA2D_fill_rect(0, 0, 1, 1, 0x07E0);
+    ((volatile uint16_t *)SCRATCH_ADDR)[0] = 0x001F;
+    CHECK(lcd_present_set_address(0, SCRATCH_ADDR) == LCD_PRESENT_OK);
+    seq = lcd_present();
+    CHECK(sim_ltdc_layer_pixel(0, 0, 0, &px) && (px & 0xFFFFFF) == 0x00FF00);
+    CHECK(!lcd_present_done(seq));
+    lcd_present_wait(seq);
+    CHECK(lcd_present_done(seq));
+    CHECK(sim_ltdc_layer_pixel(0, 0, 0, &px) && (px & 0xFFFFFF) == 0x0000FF);
+
+    ps = lcd_present_get_stats();
+    CHECK(ps->frames == 1 && ps->requests == 1);
+    CHECK(ps->vblanks >= 11);
+
+    /* Reload taken while interrupts are masked, then a new request: only the armed frame latches */
+    lcd_present_reset_stats();
+    __disable_irq();
+    seq = lcd_present();
+    sim_run_frames(1);
+    CHECK(lcd_present() == seq + 1);
+    __enable_irq();
+    CHECK(lcd_present_done(seq) && !lcd_present_done(seq + 1));
+    lcd_present_wait(seq + 1);
+    CHECK(ps->frames == 2 && ps->missed_vblanks == 0);
+
+    lcd_present_set_address(0, FB_ADDR);
+    lcd_present_wait(lcd_present());
+
+    /* Full screen fill waits for the blanking period */
+    t0 = sim_cycles();
+    DMA2D_fill_screen();
+    CHECK(fb_pixel(799, 479) == 0x001F);
+    CHECK(sim_dma2d_get_stats()->last.bytes_written == 800U * 480U * 2U);
+    CHECK(sim_cycles() > t0);
+}
+
+static void scroll_render_cb(uint32_t line, uint16_t count, uint32_t dst, uint16_t pitch, void *user)
+{
+    volatile uint16_t *d = (volatile uint16_t *)dst;
+
+    (void)user;
+    for (uint32_t y = 0; y < count; y++) {
+        for (uint32_t x = 0; x < pitch; x++) {
+            d[y * pitch + x] = (line + y == 15U) ? 0xF800 : 0x001F;     // Line 15 red
+        }
+    }
+}
+
+static void test_scroll(void)
+{
+    lcd_scroll_cfg_t cfg = { 0, SCRATCH_ADDR, LTDC_PIXEL_FORMAT_RGB565, 100, 50, 10, 0, 0, 100, 40, 0,
+                             scroll_render_cb, NULL };
+    lcd_scroll_t scroll;
+    uint32_t seq, px;
+
+    cfg.ring_lines = 45;                                    // Less than view_h + max_step
+    CHECK(lcd_scroll_init(&scroll, &cfg) == LCD_SCROLL_ERR_PARAM);
+    cfg.ring_lines = 50;
+    CHECK(lcd_scroll_init(&scroll, &cfg) == LCD_SCROLL_OK);
+    CHECK(scroll.lines_rendered == 40);
+
+    /* Second step before the first latched: 15 lines from the frame on screen is more than the 10 spare ring lines */
+    CHECK(lcd_scroll_by(&scroll, 10) == LCD_SCROLL_OK);
+    seq = scroll.seq;
+    CHECK(!lcd_present_done(seq));
+    CHECK(lcd_scroll_by(&scroll, 5) == LCD_SCROLL_OK);
+    CHECK(lcd_present_done(seq) && scroll.shown_top == 10);
+    CHECK(scroll.lines_rendered == 55);
+    lcd_present_wait(scroll.seq);
+    CHECK(sim_ltdc_layer_pixel(0, 0, 0, &px) && (px & 0xFFFFFF) == 0xFF0000);
+
+    /* Layer 0 back to the full screen frame buffer */
+    CHECK(lcd_present_set_window(0, 0, 0, 800, 480) == LCD_PRESENT_OK);
+    HAL_LTDC_SetPitch_NoReload(&hltdc, 800, 0);
+    lcd_present_set_address(0, FB_ADDR);
+    lcd_present_wait(lcd_present());
+}
+
+static void test_overlay(const char *dir)
+{
+    volatile uint16_t *ov = (volatile uint16_t *)SCRATCH_ADDR;
+    lcd_overlay_cfg_t cfg;
+    uint8_t rgb[3];
+    char path[512];
+    FILE *f;
+
+    for (uint32_t i = 0; i < 32U * 32U; i++) {
+        ov[i] = 0xFF00;                                     // Opaque red, ARGB4444
+    }
+    lcd_overlay_default_cfg(&cfg, SCRATCH_ADDR, 32, 32);
+    cfg.x = 100;
+    cfg.y = 100;
+    CHECK(lcd_overlay_init(&cfg) == LCD_OVERLAY_OK);
+
+    snprintf(path, sizeof(path), "%s/selftest_frame.ppm", dir);
+    CHECK(sim_dump_frame(path));
+
+    f = fopen(path, "rb");
+    CHECK(f != NULL);
+    if (f != NULL) {
+        int w = 0, h = 0, maxval = 0;
+
+        CHECK(fscanf(f, "P6 %d %d %d", &w, &h, &maxval) == 3 && w == 800 && h == 480 && maxval == 255);
+        fgetc(f);
+        fseek(f, (long)(100 * 800 + 100) * 3, SEEK_CUR);
+        CHECK(fread(rgb, 1, 3, f) == 3 && rgb[0] == 0xFF && rgb[1] == 0 && rgb[2] == 0);
+        fseek(f, (long)(50 * 800 - 1) * 3, SEEK_CUR);
+        CHECK(fread(rgb, 1, 3, f) == 3 && rgb[0] == 0 && rgb[1] == 0 && rgb[2] == 0xFF);
+        fclose(f);
+    }
+    CHECK(sim_ltdc_get_stats()->reloads > 0);
+
+    /* Alpha changes neither the pitch of a clipped window nor the visibility */
+    CHECK(lcd_overlay_move(790, 100) == LCD_OVERLAY_OK);
+    CHECK(lcd_overlay_set_alpha(128) == LCD_OVERLAY_OK);
+    CHECK((LTDC_LAYER(&hltdc, LCD_OVERLAY_LAYER)->CACR & LTDC_LxCACR_CONSTA) == 128U);
+    CHECK(((LTDC_LAYER(&hltdc, LCD_OVERLAY_LAYER)->CFBLR & LTDC_LxCFBLR_CFBP) >> LTDC_LxCFBLR_CFBP_Pos) == 64U);
+    CHECK(lcd_overlay_show(false) == LCD_OVERLAY_OK);
+    CHECK(lcd_overlay_set_alpha(255) == LCD_OVERLAY_OK);
+    CHECK((LTDC_LAYER(&hltdc, LCD_OVERLAY_LAYER)->CR & LTDC_LxCR_LEN) == 0U);
+    CHECK(lcd_overlay_move(100, 100) == LCD_OVERLAY_OK);
+    CHECK(lcd_overlay_show(true) == LCD_OVERLAY_OK);
+}
+
+static void test_gfxmmu(void)
+{
+    static const lcd_vfb_shape_t shape = { 16, 16, 8, 8, 32 };
+    static lcd_vfb_span_t spans[LCD_VFB_HEIGHT];
+    volatile uint16_t *gram = (volatile uint16_t *)LCD_VFB_PHYS_ADDR;
+    volatile uint16_t *vfb = (volatile uint16_t *)GFXMMU_VIRTUAL_BUFFER0_BASE;
+    lcd_vfb_info_t info;
+    uint32_t px;
+
+    /* Corner circle of radius 32: 27 pixels cut on the first line, none below the radius */
+    CHECK(lcd_vfb_shape_spans(&shape, spans) == LCD_VFB_OK);
+    CHECK(spans[7].x0 == spans[7].x1);
+    CHECK(spans[8].x0 == 43 && spans[8].x1 == 757);
+    CHECK(spans[9].x0 == 39 && spans[9].x1 == 761);
+    CHECK(spans[40].x0 == 16 && spans[40].x1 == 784);
+    CHECK(spans[471].x0 == 43 && spans[472].x0 == spans[472].x1);
+
+    /* Two packed buffers do not fit GRAM, one leaves the rest free */
+    CHECK(lcd_vfb_init(spans, 2, &info) == LCD_VFB_ERR_SIZE);
+    CHECK(lcd_vfb_init(spans, 1, &info) == LCD_VFB_OK);
+    CHECK(info.lines == 464 && info.frame_bytes < 464U * 1536U);
+    CHECK(info.spare_addr == LCD_VFB_PHYS_ADDR + info.frame_bytes);
+    CHECK(info.spare_size == LCD_VFB_PHYS_SIZE - info.frame_bytes);
+    CHECK(lcd_vfb_get_buffer(0) == GFXMMU_VIRTUAL_BUFFER0_BASE && lcd_vfb_get_buffer(1) == 0);
+
+    /* DMA2D through the table: line 8 starts at block 5 (pixel 40), line 9 right after it */
+    gram[info.frame_bytes / 2U] = 0x5A5A;
+    DMA2D_fill_rect_fb(GFXMMU_VIRTUAL_BUFFER0_BASE, LCD_VFB_PITCH, 0, 0, LCD_VFB_WIDTH, LCD_VFB_HEIGHT, 0x07E0);
+    CHECK(gram[0] == 0x07E0 && gram[info.frame_bytes / 2U - 1U] == 0x07E0);
+    CHECK(gram[info.frame_bytes / 2U] == 0x5A5A);            // Spare memory untouched
+
+    /* CPU: backed pixels land in GRAM, the rest reads the default value and drops writes */
+    vfb[9U * LCD_VFB_PITCH + 32U] = 0x1234;
+    CHECK(gram[(94U - 5U + 1U) * 8U] == 0x1234);                // Line 8 is blocks 5..94
+    CHECK(vfb[9U * LCD_VFB_PITCH + 32U] == 0x1234);
+    CHECK(vfb[8U * LCD_VFB_PITCH + 40U] == 0x07E0 && vfb[8U * LCD_VFB_PITCH + 39U] == 0);
+    vfb[0] = 0xFFFF;
+    CHECK(vfb[0] == 0 && gram[0] == 0x07E0);
+    GFXMMU->DVR = 0x12345678;
+    CHECK(vfb[0] == 0x5678 && vfb[1] == 0x1234);
+    GFXMMU->DVR = 0;
+
+    /* LTDC scans the virtual buffer with the 3072 byte pitch */
+    CHECK(sim_ltdc_layer_pixel(0, 400, 240, &px) && (px & 0xFFFFFF) == 0x00FF00);
+    CHECK(sim_ltdc_layer_pixel(0, 0, 0, &px) && (px & 0xFFFFFF) == 0);
+    CHECK(sim_ltdc_layer_pixel(0, 32, 9, &px) && (px & 0xFFFFFF) == 0x1045A5);
+
+    /* A physical address outside memory: master error, default value */
+    GFXMMU->B0CR = 0x10000000UL;
+    CHECK(vfb[240U * LCD_VFB_PITCH + 400U] == 0);
+    CHECK(GFXMMU->SR & GFXMMU_SR_AMEF);
+    GFXMMU->FCR = GFXMMU_FCR_CAMEF;
+    CHECK(!(GFXMMU->SR & GFXMMU_SR_AMEF));
+
+    lcd_vfb_deinit();
+    CHECK(sim_ltdc_layer_pixel(0, 400, 240, &px) && (px & 0xFFFFFF) == 0x00FF00);
+    CHECK(sim_ltdc_layer_pixel(0, 0, 0, &px) && (px & 0xFFFFFF) == 0x00FF00);
+}
+
+static void test_mdma(void)
+{
+    volatile uint8_t *sheet = (volatile uint8_t *)OSPI_SCRATCH_ADDR;
+    volatile uint8_t *dst = (volatile uint8_t *)(SCRATCH_ADDR + 0x1000);
+    const sim_mdma_stats_t *st = sim_mdma_get_stats();
+    bool same = true;
+    uint64_t t0, t1;
+
+    for (uint32_t i = 0; i < 64U * 256U; i++) {
+        sheet[i] = (uint8_t)(i * 7U + (i >> 8));
+    }
+    memset((void *)dst, 0, 1024);
+    sim_mdma_reset_stats();
+    CHECK(mdma_fetch_init() == MDMA_FETCH_OK);
+
+    /* 10 rows of 40 bytes out of 256 byte lines: runs in the background, OSPI speed */
+    t0 = sim_cycles();
+    CHECK(mdma_fetch_start(OSPI_SCRATCH_ADDR + 3U * 256U + 16U, 256, (uint32_t)dst, 40, 10) == MDMA_FETCH_OK);
+    CHECK(mdma_fetch_busy() && dst[0] == 0);
+    CHECK(mdma_fetch_start(OSPI_SCRATCH_ADDR, 256, (uint32_t)dst, 40, 10) == MDMA_FETCH_ERR_BUSY);
+    CHECK(mdma_fetch_wait() == MDMA_FETCH_OK);
+    t1 = sim_cycles();
+    CHECK(t1 - t0 >= 400U * SIM_OSPI_CYCLES_PER_BYTE && t1 - t0 < 400U * SIM_OSPI_CYCLES_PER_BYTE + 600U);
+    for (uint32_t r = 0; r < 10U; r++) {
+        for (uint32_t i = 0; i < 40U; i++) {
+            same &= dst[r * 40U + i] == sheet[(3U + r) * 256U + 16U + i];
+        }
+    }
+    CHECK(same);
+    CHECK(dst[400] == 0);
+    CHECK(st->jobs == 1 && st->bytes == 400);
+
+    /* Odd address and length: byte beats, same result */
+    CHECK(mdma_fetch_start(OSPI_SCRATCH_ADDR + 1U, 256, (uint32_t)dst, 33, 3) == MDMA_FETCH_OK);
+    CHECK(mdma_fetch_wait() == MDMA_FETCH_OK);
+    CHECK(dst[0] == sheet[1] && dst[32] == sheet[33] && dst[33] == sheet[257] && dst[98] == sheet[2U * 256U + 33U]);
+
+    /* A DMA2D job started meanwhile overlaps the fetch */
+    CHECK(mdma_fetch_start(OSPI_SCRATCH_ADDR, 256, (uint32_t)dst, 256, 4) == MDMA_FETCH_OK);
+    t0 = sim_cycles();
+    DMA2D_fill_rect(0, 0, 100, 100, 0x001F);
+    CHECK(!mdma_fetch_busy());
+    CHECK(sim_cycles() - t0 < 100U * 100U * 2U / 2U + 2048U * SIM_OSPI_CYCLES_PER_BYTE / 2U);
+    CHECK(dst[1023] == sheet[3U * 256U + 255U]);
+
+    /* Bus error on a destination outside memory, bad sizes are refused */
+    CHECK(mdma_fetch_start(OSPI_SCRATCH_ADDR, 256, 0x10000000UL, 64, 2) == MDMA_FETCH_OK);
+    CHECK(mdma_fetch_wait() == MDMA_FETCH_ERR_XFER);
+    CHECK(st->errors == 1 && mdma_fetch_get_stats()->errors == 1);
+    CHECK(mdma_fetch_start(OSPI_SCRATCH_ADDR, 256, (uint32_t)dst, 64, 0) == MDMA_FETCH_ERR_PARAM);
+    CHECK(mdma_fetch_start(OSPI_SCRATCH_ADDR, 32, (uint32_t)dst, 64, 2) == MDMA_FETCH_ERR_PARAM);
+    CHECK(mdma_fetch_start(OSPI_SCRATCH_ADDR, 256, (uint32_t)dst, 64, 1) == MDMA_FETCH_OK);
+    CHECK(mdma_fetch_wait() == MDMA_FETCH_OK && dst[63] == sheet[63]);
+}
+
+static void test_touch(void)
+{
+    static const sim_touch_point_t one[] = { { 3, 100, 200, 20 } };
+    static const sim_touch_point_t two[] = { { 3, 110, 205, 21 }, { 5, 700, 50, 30 } };
+    static const sim_touch_point_t moved[] = { { 5, 690, 60, 30 } };
+    const sim_gt911_stats_t *gt = sim_gt911_get_stats();
+    const touch_stats_t *ts = touch_gt911_get_stats();
+    touch_info_t info;
+    touch_event_t ev;
+    uint64_t t0, t1;
+
+    MX_GPIO_Init();
+    sim_gt911_reset_stats();
+    touch_gt911_reset_stats();
+    CHECK(touch_gt911_init(&info) == TOUCH_OK);
+    CHECK(gt->resets == 1);
+    CHECK(info.res_x == 800 && info.res_y == 480 && info.trigger == 1 && info.firmware == 0x1060);
+    CHECK(!touch_gt911_read(&ev) && touch_gt911_pending() == 0);
+
+    /* One finger: status and all points in one read from the INT interrupt, then the status is cleared */
+    sim_gt911_reset_stats();
+    t0 = sim_cycles();
+    CHECK(sim_gt911_report(one, 1));
+    t1 = sim_cycles();
+    CHECK(gt->int_edges == 1 && gt->starts == 3);                   // Read with a repeated start, clear
+    CHECK(gt->bytes_read == 41 && gt->bytes_written == 1);
+    CHECK(t1 - t0 > 45U * 18U * (SIM_CPU_HZ / 800000U));             // 400 kHz bus
+    CHECK(t1 - t0 < SIM_CPU_HZ / 500U);                              // Queued within 2 ms
+    CHECK(touch_gt911_pending() == 1 && touch_gt911_read(&ev));
+    CHECK(ev.tick >= t0 / (SIM_CPU_HZ / 1000U) && ev.tick <= t1 / (SIM_CPU_HZ / 1000U));
+    CHECK(ev.down == 1 && ev.count == 1);
+    CHECK(ev.points[0].id == 3 && ev.points[0].action == TOUCH_DOWN);
+    CHECK(ev.points[0].x == 100 && ev.points[0].y == 200 && ev.points[0].size == 20);
+
+    /* Second finger, then the first lifted: both events wait in the queue */
+    CHECK(sim_gt911_report(two, 2));
+    CHECK(sim_gt911_report(moved, 1));
+    CHECK(touch_gt911_pending() == 2);
+    CHECK(touch_gt911_read(&ev) && ev.down == 2 && ev.count == 2);
+    CHECK(ev.points[0].id == 3 && ev.points[0].action == TOUCH_MOVE && ev.points[0].x == 110);
+    CHECK(ev.points[1].id == 5 && ev.points[1].action == TOUCH_DOWN && ev.points[1].y == 50);
+    CHECK(touch_gt911_read(&ev) && ev.down == 1 && ev.count == 2);
+    CHECK(ev.points[0].id == 5 && ev.points[0].action == TOUCH_MOVE && ev.points[0].x == 690);
+    CHECK(ev.points[1].id == 3 && ev.points[1].action == TOUCH_UP && ev.points[1].x == 110 && ev.points[1].y == 205);
+
+    /* All lifted: one UP, an empty report after it queues nothing */
+    CHECK(sim_gt911_report(NULL, 0));
+    CHECK(sim_gt911_report(NULL, 0));
+    CHECK(touch_gt911_read(&ev) && ev.down == 0 && ev.count == 1);
+    CHECK(ev.points[0].id == 5 && ev.points[0].action == TOUCH_UP);
+    CHECK(!touch_gt911_read(&ev));
+
+    /* Full queue: the lift is dropped, reported by the next event that is queued */
+    touch_gt911_reset_stats();
+    for (uint16_t i = 0; i < TOUCH_QUEUE_SIZE; i++) {
+        sim_touch_point_t p = { 1, (uint16_t)(10U * i), 100, 10 };
+
+        CHECK(sim_gt911_report(&p, 1));
+    }
+    CHECK(sim_gt911_report(NULL, 0));
+    CHECK(ts->events == TOUCH_QUEUE_SIZE && ts->dropped == 1 && ts->reports == TOUCH_QUEUE_SIZE + 1U);
+    for (uint16_t i = 0; i < TOUCH_QUEUE_SIZE; i++) {
+        CHECK(touch_gt911_read(&ev) && ev.points[0].x == 10U * i);
+    }
+    CHECK(sim_gt911_report(NULL, 0));
+    CHECK(touch_gt911_read(&ev) && ev.down == 0 && ev.count == 1 && ev.points[0].action == TOUCH_UP);
+
+    /* No interrupt, no bus traffic: the report stays in the GT911, the next one is lost */
+    touch_gt911_deinit();
+    sim_gt911_reset_stats();
+    CHECK(sim_gt911_report(one, 1));
+    CHECK(!sim_gt911_report(two, 2));
+    CHECK(gt->starts == 0 && gt->missed == 1 && touch_gt911_pending() == 0);
+
+    /* Another panel resolution and a rising INT edge */
+    sim_gt911_config(1024, 600, 0);
+    CHECK(touch_gt911_init(&info) == TOUCH_OK);
+    CHECK(info.res_x == 1024 && info.res_y == 600 && info.trigger == 0);
+    {
+        sim_touch_point_t p = { 2, 512, 300, 8 };
+
+        CHECK(sim_gt911_report(&p, 1));
+    }
+    CHECK(touch_gt911_read(&ev) && ev.points[0].x == 400 && ev.points[0].y == 240);
+    touch_gt911_deinit();
+}
+
+/* One event from a trace: the lines with the same tick, lifted points after the ones down */
+static bool trace_event(FILE *f, touch_event_t *ev)
+{
+    static char pending[64];
+    static bool have = false;
+    char line[64];
+
+    memset(ev, 0, sizeof(*ev));
+    for (;;) {
+        unsigned tick, id, x, y, size;
+        char action;
+
+        if (have) {
+            strcpy(line, pending);
+            have = false;
+        } else if (fgets(line, sizeof(line), f) == NULL) {
+            return ev->count != 0;
+        }
+        if (sscanf(line, "%u %u %c %u %u %u", &tick, &id, &action, &x, &y, &size) != 6) {
+            continue;                                       // Comment
+        }
+        if (ev->count != 0 && tick != ev->tick) {
+            strcpy(pending, line);
+            have = true;
+            return true;
+        }
+        if (ev->count < TOUCH_EVENT_POINTS) {
+            touch_point_t *p = &ev->points[ev->count++];
+
+            ev->tick = tick;
+            p->id = (uint8_t)id;
+            p->action = (action == 'd') ? TOUCH_DOWN : ((action == 'u') ? TOUCH_UP : TOUCH_MOVE);
+            p->x = (uint16_t)x;
+            p->y = (uint16_t)y;
+            p->size = (uint16_t)size;
+            ev->down += (p->action != TOUCH_UP);
+        }
+    }
+}
+
+/* Replays test/touch/<name>.trace, calls back after every event */
+static uint32_t trace_replay(const char *name, touch_gesture_ctx_t *ctx, touch_gesture_t *log,
+                             void (*on_event)(const touch_gesture_ctx_t *ctx, const touch_event_t *ev))
+{
+    char path[256];
+    touch_event_t ev;
+    uint32_t n = 0;
+    FILE *f;
+
+    snprintf(path, sizeof(path), "%s/%s.trace", TOUCH_TRACE_DIR, name);
+    f = fopen(path, "r");
+    CHECK(f != NULL);
+    if (f == NULL) {
+        return 0;
+    }
+    touch_gesture_init(ctx);
+    while (trace_event(f, &ev)) {
+        touch_gesture_t out[TOUCH_GESTURE_OUT_MAX];
+        uint8_t count = touch_gesture_feed(ctx, &ev, out);
+
+        for (uint8_t i = 0; i < count && n < GESTURE_LOG_MAX; i++) {
+            log[n++] = out[i];
+        }
+        if (on_event != NULL) {
+            on_event(ctx, &ev);
+        }
+    }
+    fclose(f);
+    return n;
+}
+
+static uint32_t gesture_count(const touch_gesture_t *log, uint32_t n, uint8_t type, uint8_t phase)
+{
+    uint32_t found = 0;
+
+    for (uint32_t i = 0; i < n; i++) {
+        found += (log[i].type == type && log[i].phase == phase);
+    }
+    return found;
+}
+
+static const touch_gesture_t *gesture_last(const touch_gesture_t *log, uint32_t n, uint8_t type)
+{
+    while (n-- > 0) {
+        if (log[n].type == type) {
+            return &log[n];
+        }
+    }
+    return NULL;
+}
+
+static int32_t predict_error_max;
+static uint32_t predict_samples;
+
+/* drag.trace moves 1 px/ms right, 0.5 px/ms down: the prediction is the next sample after latency ms */
+static void check_prediction(const touch_gesture_ctx_t *ctx, const touch_event_t *ev)
+{
+    int32_t t = (int32_t)ev->tick - 4000 + (int32_t)touch_gesture_get_latency(ctx);
+    int16_t x, y;
+
+    if (ev->tick < 4100 || ev->tick > 4300 || !touch_gesture_predict(ctx, &x, &y)) {
+        return;
+    }
+    if (t > 300) {
+        return;
+    }
+    predict_samples++;
+    if (abs(x - (100 + t)) > predict_error_max) {
+        predict_error_max = abs(x - (100 + t));
+    }
+    if (abs(y - (100 + t / 2)) > predict_error_max) {
+        predict_error_max = abs(y - (100 + t / 2));
+    }
+}
+
+static void test_gestures(void)
+{
+    static touch_gesture_t log[GESTURE_LOG_MAX];
+    touch_gesture_ctx_t ctx;
+    const touch_gesture_t *g;
+    uint32_t n;
+
+    /* Tap: jitter inside the slop, nothing else */
+    n = trace_replay("tap", &ctx, log, NULL);
+    CHECK(n == 1 && log[0].type == TOUCH_GESTURE_TAP && log[0].x == 400 && log[0].y == 240);
+
+    /* Long press once, no tap at the lift */
+    n = trace_replay("long_press", &ctx, log, NULL);
+    CHECK(n == 1 && log[0].type == TOUCH_GESTURE_LONG_PRESS && log[0].tick == 2500);
+
+    /* Swipe: drag begin, updates, end, then the swipe */
+    n = trace_replay("swipe_left", &ctx, log, NULL);
+    CHECK(gesture_count(log, n, TOUCH_GESTURE_DRAG, TOUCH_PHASE_BEGIN) == 1);
+    CHECK(gesture_count(log, n, TOUCH_GESTURE_DRAG, TOUCH_PHASE_END) == 1);
+    CHECK(gesture_count(log, n, TOUCH_GESTURE_TAP, TOUCH_PHASE_ONCE) == 0);
+    g = gesture_last(log, n, TOUCH_GESTURE_SWIPE);
+    CHECK(g != NULL && g == &log[n - 1]);
+    if (g != NULL) {
+        CHECK(g->direction == TOUCH_SWIPE_LEFT && g->dx == -240 && g->dy == 4);
+        CHECK(g->vx < -1100 && g->vx > -1300);
+    }
+
+    /* Drag that rests before the lift is no swipe, the predictor leads the finger by the latency */
+    predict_error_max = 0;
+    predict_samples = 0;
+    n = trace_replay("drag", &ctx, log, check_prediction);
+    CHECK(gesture_count(log, n, TOUCH_GESTURE_SWIPE, TOUCH_PHASE_ONCE) == 0);
+    g = gesture_last(log, n, TOUCH_GESTURE_DRAG);
+    CHECK(g != NULL && g->phase == TOUCH_PHASE_END && g->dx == 300 && g->dy == 150);
+    CHECK(predict_samples >= 15 && predict_error_max <= 3);
+    touch_gesture_latency(&ctx, 1000, 1040);
+    CHECK(touch_gesture_get_latency(&ctx) == 40);
+    touch_gesture_latency(&ctx, 2000, 2008);
+    CHECK(touch_gesture_get_latency(&ctx) == 36);
+
+    /* Pinch out to 3x, fingers kept at the same angle */
+    n = trace_replay("pinch", &ctx, log, NULL);
+    CHECK(gesture_count(log, n, TOUCH_GESTURE_PINCH, TOUCH_PHASE_BEGIN) == 1);
+    CHECK(gesture_count(log, n, TOUCH_GESTURE_PINCH, TOUCH_PHASE_END) == 1);
+    CHECK(gesture_count(log, n, TOUCH_GESTURE_ROTATE, TOUCH_PHASE_BEGIN) == 0);
+    CHECK(gesture_count(log, n, TOUCH_GESTURE_TAP, TOUCH_PHASE_ONCE) == 0);
+    for (uint32_t i = n; i-- > 0;) {
+        if (log[i].type == TOUCH_GESTURE_PINCH && log[i].phase == TOUCH_PHASE_UPDATE) {
+            CHECK(log[i].scale == 3 * 65536 && log[i].x == 400 && log[i].y == 240);
+            break;
+        }
+    }
+
+    /* Rotate 45 degrees clockwise, the distance stays */
+    n = trace_replay("rotate", &ctx, log, NULL);
+    CHECK(gesture_count(log, n, TOUCH_GESTURE_ROTATE, TOUCH_PHASE_BEGIN) == 1);
+    CHECK(gesture_count(log, n, TOUCH_GESTURE_ROTATE, TOUCH_PHASE_END) == 1);
+    CHECK(gesture_count(log, n, TOUCH_GESTURE_PINCH, TOUCH_PHASE_BEGIN) == 0);
+    for (uint32_t i = n; i-- > 0;) {
+        if (log[i].type == TOUCH_GESTURE_ROTATE && log[i].phase == TOUCH_PHASE_UPDATE) {
+            CHECK(log[i].angle > 4450 && log[i].angle < 4550);
+            break;
+        }
+    }
+}
+
+static uint8_t shot_stream[800U * 480U * 3U];
+static uint32_t shot_stream_len;
+static uint32_t shot_offers;
+static uint16_t shot_image[800U * 480U];
+
+/* UART stand-in: busy every third packet, log text between the packets */
+static uint32_t shot_sink(const uint8_t *data, uint32_t len, void *user)
+{
+    static const char log_line[] = "touch 0 down (1, 2) at 3 ms\r\n";
+
+    (void)user;
+    if (++shot_offers % 3 == 0 || shot_stream_len + len + sizeof(log_line) > sizeof(shot_stream)) {
+        return 0;
+    }
+    memcpy(&shot_stream[shot_stream_len], data, len);
+    shot_stream_len += len;
+    if (shot_offers % 7 == 0) {
+        memcpy(&shot_stream[shot_stream_len], log_line, sizeof(log_line) - 1);
+        shot_stream_len += sizeof(log_line) - 1;
+    }
+    return len;
+}
+
+static uint16_t shot_crc16(const uint8_t *data, uint32_t len)
+{
+    uint16_t crc = 0xFFFF;
+
+    while (len--) {
+        crc ^= (uint16_t)(*data++ << 8);
+        for (int i = 0; i < 8; i++) {
+            crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+/* Host side of the stream format, like Tools/fbshot: returns the pixels decoded, w * h if complete */
+static uint32_t shot_decode(uint16_t *w, uint16_t *h, bool *ended)
+{
+    const uint8_t *s = shot_stream;
+    uint32_t pixels = 0, total = 0, pos = 0;
+
+    *w = *h = 0;
+    *ended = false;
+    while (pos + LCD_SHOT_HEAD_SIZE <= shot_stream_len) {
+        const uint8_t *pl = &s[pos + LCD_SHOT_HEAD_SIZE];
+        uint32_t len, at;
+
+        if (s[pos] != LCD_SHOT_SYNC0 || s[pos + 1] != LCD_SHOT_SYNC1) {
+            pos++;                                          // Log text
+            continue;
+        }
+        len = s[pos + 3] | (s[pos + 4] << 8);
+        if (shot_crc16(&s[pos + 2], len + 3) != (pl[len] | (pl[len + 1] << 8))) {
+            pos++;
+            continue;
+        }
+        switch (s[pos + 2]) {
+        case 'H':
+            CHECK(pl[0] == LCD_SHOT_VERSION && pl[1] == LCD_SHOT_ENC_RLE565);
+            *w = (uint16_t)(pl[6] | (pl[7] << 8));
+            *h = (uint16_t)(pl[8] | (pl[9] << 8));
+            total = (uint32_t)*w * *h;
+            break;
+        case 'D':
+            at = pl[2] | (pl[3] << 8) | ((uint32_t)pl[4] << 16) | ((uint32_t)pl[5] << 24);
+            for (uint32_t i = 6; i < len && at < total;) {
+                uint8_t c = pl[i++];
+                uint32_t n = (c & 0x80) ? (c & 0x7FU) + 2U : c + 1U;
+
+                for (uint32_t k = 0; k < n && at < total; k++, at++, pixels++) {
+                    uint32_t j = (c & 0x80) ? i : i + 2U * k;
+
+                    shot_image[at] = (uint16_t)(pl[j] | (pl[j + 1] << 8));
+                }
+                i += (c & 0x80) ? 2U : 2U * n;
+            }
+            break;
+        case 'E':
+            *ended = true;
+            break;
+        default:
+            break;
+        }
+        pos += LCD_SHOT_HEAD_SIZE + len + LCD_SHOT_CRC_SIZE;
+    }
+    return pixels;
+}
+
+/* Poll until the capture is sent, into an empty stream */
+static void shot_run(void)
+{
+    shot_stream_len = 0;
+    for (uint32_t polls = 0; lcd_shot_poll() && polls < 100000U; polls++) {
+    }
+}
+
+static void test_screenshot(const char *dir)
+{
+    static uint32_t clut[256];
+    const lcd_shot_stats_t *st = lcd_shot_get_stats();
+    volatile uint16_t *fb = (volatile uint16_t *)FB_ADDR;
+    volatile uint8_t *l8 = (volatile uint8_t *)SCRATCH_ADDR;
+    uint32_t seed = 12345, mismatches = 0, packets;
+    uint16_t w, h;
+    bool ended;
+    char path[512];
+    FILE *f;
+
+    /* A UI-like frame: flat areas, a gradient bar, and a noisy patch that only literals can hold */
+    DMA2D_fill_rect(0, 0, 800, 480, 0x001F);
+    DMA2D_fill_rect(40, 40, 300, 120, 0xFFFF);
+    for (uint32_t y = 300; y < 340; y++) {
+        for (uint32_t x = 0; x < 800; x++) {
+            fb[y * 800U + x] = (uint16_t)((x >> 4) << 11);
+        }
+    }
+    for (uint32_t y = 400; y < 464; y++) {
+        for (uint32_t x = 600; x < 664; x++) {
+            seed = seed * 1103515245U + 12345U;
+            fb[y * 800U + x] = (uint16_t)(seed >> 16);
+        }
+    }
+
+    CHECK(lcd_shot_start(FB_ADDR, 800, 480, LCD_SHOT_RGB565, NULL, 0, 0, 800, 480) == LCD_SHOT_ERR_PARAM);   // No sink
+    lcd_shot_init(shot_sink, NULL);
+    lcd_shot_reset_stats();
+    CHECK(lcd_shot_start(FB_ADDR, 800, 480, LCD_SHOT_RGB565, NULL, 700, 0, 200, 10) == LCD_SHOT_ERR_PARAM);
+    CHECK(lcd_shot_start(FB_ADDR, 800, 480, LCD_SHOT_RGB565, NULL, 0, 1, 800, 480) == LCD_SHOT_ERR_PARAM);
+    CHECK(lcd_shot_start(FB_ADDR, 800, 480, LCD_SHOT_RGB565, NULL, 0, 1, 800, 65535) == LCD_SHOT_ERR_PARAM);
+    CHECK(lcd_shot_start(SCRATCH_ADDR, 64, 32, LCD_SHOT_L8, NULL, 0, 0, 64, 8) == LCD_SHOT_ERR_PARAM);
+    CHECK(lcd_shot_start(FB_ADDR, 800, 480, LCD_SHOT_RGB565, NULL, 0, 0, 800, 480) == LCD_SHOT_OK);
+    CHECK(lcd_shot_start(FB_ADDR, 800, 480, LCD_SHOT_RGB565, NULL, 0, 0, 8, 8) == LCD_SHOT_ERR_BUSY);
+
+    /* Whole frame: a few packets per poll, refused packets are offered again */
+    shot_offers = 0;
+    shot_stream_len = 0;
+    packets = 0;
+    while (lcd_shot_poll()) {
+        CHECK(st->packets - packets <= LCD_SHOT_PACKETS_PER_POLL);
+        packets = st->packets;
+    }
+    CHECK(!lcd_shot_busy() && st->shots == 1 && st->stalls > 0 && st->pixels == 800U * 480U);
+    CHECK(st->bytes < 800U * 480U * 2U / 20U);                         // UI content: over 20:1
+    CHECK(shot_decode(&w, &h, &ended) == 800U * 480U && ended && w == 800 && h == 480);
+    for (uint32_t i = 0; i < 800U * 480U; i++) {
+        mismatches += (shot_image[i] != fb[i]);
+    }
+    CHECK(mismatches == 0);
+
+    /* Stream and the expected picture for Tools/fbshot (screenshot_png test) */
+    snprintf(path, sizeof(path), "%s/selftest_shot.bin", dir);
+    f = fopen(path, "wb");
+    CHECK(f != NULL);
+    if (f != NULL) {
+        fwrite(shot_stream, 1, shot_stream_len, f);
+        fclose(f);
+    }
+    snprintf(path, sizeof(path), "%s/selftest_shot.ppm", dir);
+    f = fopen(path, "wb");
+    CHECK(f != NULL);
+    if (f != NULL) {
+        fprintf(f, "P6\n800 480\n255\n");
+        for (uint32_t i = 0; i < 800U * 480U; i++) {
+            uint16_t p = fb[i];
+            uint8_t r = (uint8_t)(p >> 11), g = (uint8_t)((p >> 5) & 0x3F), b = (uint8_t)(p & 0x1F);
+            uint8_t rgb[3] = { (uint8_t)((r << 3) | (r >> 2)), (uint8_t)((g << 2) | (g >> 4)), (uint8_t)((b << 3) | (b >> 2)) };
+
+            fwrite(rgb, 1, 3, f);
+        }
+        fclose(f);
+    }
+
+    /* L8 region through its CLUT */
+    for (uint32_t i = 0; i < 256; i++) {
+        clut[i] = 0xFF000000U | (i << 16) | ((255U - i) << 8) | (i ^ 0x55U);
+    }
+    for (uint32_t i = 0; i < 64U * 32U; i++) {
+        l8[i] = (uint8_t)((i / 64U < 16U) ? i : 7U);
+    }
+    CHECK(lcd_shot_start(SCRATCH_ADDR, 64, 32, LCD_SHOT_L8, clut, 8, 4, 48, 20) == LCD_SHOT_OK);
+    shot_run();
+    CHECK(shot_decode(&w, &h, &ended) == 48U * 20U && ended && w == 48 && h == 20);
+    mismatches = 0;
+    for (uint32_t y = 0; y < 20U; y++) {
+        for (uint32_t x = 0; x < 48U; x++) {
+            uint32_t c = clut[l8[(y + 4U) * 64U + x + 8U]];
+
+            mismatches += (shot_image[y * 48U + x] !=
+                           (uint16_t)(((c >> 8) & 0xF800) | ((c >> 5) & 0x07E0) | ((c >> 3) & 0x001F)));
+        }
+    }
+    CHECK(mismatches == 0 && st->shots == 2);
+
+    /* Aborted: no end packet */
+    CHECK(lcd_shot_start(FB_ADDR, 800, 480, LCD_SHOT_RGB565, NULL, 0, 0, 800, 480) == LCD_SHOT_OK);
+    shot_stream_len = 0;
+    lcd_shot_poll();
+    lcd_shot_abort();
+    CHECK(!lcd_shot_busy() && st->aborted == 1 && !lcd_shot_poll());
+    shot_decode(&w, &h, &ended);
+    CHECK(!ended);
+}
+
+int main(int argc, char **argv)
+{
+    const char *dir = (argc > 1) ? argv[1] : ".";
+
+    sim_init();
+    MX_LTDC_Init();
+    MX_DMA2D_Init();
+
+    test_fill_and_copy();
+    test_pfc_and_blend();
+    test_present();
+    test_scroll();
+    test_overlay(dir);
+    test_gfxmmu();
+    test_mdma();
+    test_touch();
+    test_gestures();
+    test_screenshot(dir);
+
+    if (failures) {
+        fprintf(stderr, "sim_selftest: %d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("sim_selftest: ok, %llu us simulated\n", (unsigned long long)sim_time_us());
+    return 0;
+}
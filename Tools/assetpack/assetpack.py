@@ -0,0 +1,321 @@
+#!/usr/bin/env python3
+"""
+assetpack.py - build one resource bundle for RO_DATA from images and fonts.
+
+The bundle is read in place by gfx_asset (App/Graphics/gfx_asset.h). Every
+image is converted on the host to the format it is drawn from, so the target
+does no parsing and no pixel conversion:
+
+  format=auto       (default) picks the smallest lossless-enough format:
+                    alpha with a single colour -> A8 (tinted when drawn),
+                    other alpha                -> ARGB4444,
+                    opaque, <= 256 colours     -> L8 + CLUT,
+                    opaque                     -> RGB565
+  format=rgb565 | argb4444 | argb8888 | a8 | l8   forces a format
+  compress=lz4 | qoi                RGB565 streamed through gfx_image
+
+Image data starts on a 32 byte cache line and every line is padded to
+--row-align bytes (default 8, one 64-bit AXI beat), the padded pitch is in
+the asset entry. Assets are found by name through a minimal perfect hash
+(hash and displace), --header also writes the slot of every asset so code
+can skip the hash.
+
+Manifest, one asset per line, paths relative to the manifest:
+  # name        kind    file                options
+  wifi          image   icons/wifi.png
+  background    image   bg.png              compress=lz4
+  font_ko16     font    NanumGothic.ttf     size=16 bpp=4 text=ui_strings.txt compress=1
+  strings       blob    strings.bin
+
+Fonts are packed by fontgen.py --store (options size, bpp, ranges, chars,
+text, fallback, compress, kerning=0).
+
+Requires Pillow (pip install pillow).
+
+Usage:
+  python assetpack.py assets.txt -o assets.bin --header assets.h [--compress]
+"""
+
+import argparse
+import os
+import re
+import shlex
+import struct
+import subprocess
+import sys
+import tempfile
+
+from PIL import Image
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+sys.path.insert(0, os.path.join(HERE, "..", "imgcodec"))
+import imgcodec  # noqa: E402
+
+MAGIC = 0x444E4247                      # "GBND"
+VERSION = 1
+ALIGN = 32
+HEADER_SIZE = 32
+ENTRY_SIZE = 32
+
+FORMATS = ["rgb565", "argb4444", "argb8888", "a8", "l8", "font", "blob"]
+BPP = {"rgb565": 2, "argb4444": 2, "argb8888": 4, "a8": 1, "l8": 1}
+CODECS = ["none", "lz4", "qoi"]
+
+
+def fnv1a(name):
+    h = 0x811C9DC5
+    for b in name.encode("utf-8"):
+        h = ((h ^ b) * 0x01000193) & 0xFFFFFFFF
+    return h
+
+
+def mix(h, d):
+    h ^= (d * 0x9E3779B9) & 0xFFFFFFFF
+    h ^= h >> 16
+    h = (h * 0x85EBCA6B) & 0xFFFFFFFF
+    h ^= h >> 13
+    h = (h * 0xC2B2AE35) & 0xFFFFFFFF
+    h ^= h >> 16
+    return h
+
+
+def perfect_hash(names):
+    """Hash and displace: slot = mix(h, d) % n, or -d - 1 for single key buckets"""
+    n = len(names)
+    buckets = [[] for _ in range(n)]
+    for name in names:
+        buckets[fnv1a(name) % n].append(name)
+    disp = [0] * n
+    slot_of = {}
+    used = [False] * n
+    for b in sorted(range(n), key=lambda i: -len(buckets[i])):
+        keys = buckets[b]
+        if len(keys) < 2:
+            break
+        d = 0
+        while True:
+            slots = [mix(fnv1a(k), d) % n for k in keys]
+            if len(set(slots)) == len(slots) and not any(used[s] for s in slots):
+                break
+            d += 1
+            if d > 1000000:
+                sys.exit("assetpack: no perfect hash found")
+        disp[b] = d
+        for k, s in zip(keys, slots):
+            used[s] = True
+            slot_of[k] = s
+    free = [i for i in range(n) if not used[i]]
+    for b in range(n):
+        if len(buckets[b]) == 1:
+            s = free.pop()
+            disp[b] = -s - 1
+            slot_of[buckets[b][0]] = s
+    return disp, slot_of
+
+
+def pitch_for(width, bpp, row_align):
+    row = -(-width * bpp // row_align) * row_align
+    return row // bpp
+
+
+def auto_format(im):
+    rgba = im.convert("RGBA")
+    amin, _ = rgba.getchannel("A").getextrema()
+    if amin < 255:
+        colours = {px[:3] for px in imgcodec_pixels(rgba) if px[3] > 0}
+        return "a8" if len(colours) <= 1 else "argb4444"
+    return "l8" if rgba.convert("RGB").getcolors(256) is not None else "rgb565"
+
+
+def imgcodec_pixels(rgba):
+    data = rgba.tobytes()
+    return [tuple(data[i:i + 4]) for i in range(0, len(data), 4)]
+
+
+def q4(v):
+    return (v * 15 + 127) // 255
+
+
+def pack_pixels(im, fmt, pitch):
+    """Pixel rows padded to pitch, plus the CLUT for L8"""
+    rgba = imgcodec_pixels(im.convert("RGBA"))
+    w, h = im.size
+    bpp = BPP[fmt]
+    pad = b"\0" * ((pitch - w) * bpp)
+    out = bytearray()
+    clut = None
+    if fmt == "l8":
+        colours = sorted({px[:3] for px in rgba})
+        if len(colours) > 256:
+            sys.exit("assetpack: more than 256 colours for l8")
+        index = {c: i for i, c in enumerate(colours)}
+        clut = b"".join(struct.pack("<I", 0xFF000000 | (r << 16) | (g << 8) | b) for r, g, b in colours)
+    for y in range(h):
+        for r, g, b, a in rgba[y * w:(y + 1) * w]:
+            if fmt == "rgb565":
+                out += struct.pack("<H", ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3))
+            elif fmt == "argb4444":
+                out += struct.pack("<H", (q4(a) << 12) | (q4(r) << 8) | (q4(g) << 4) | q4(b))
+            elif fmt == "argb8888":
+                out += struct.pack("<I", (a << 24) | (r << 16) | (g << 8) | b)
+            elif fmt == "a8":
+                out.append(a)
+            else:
+                out.append(index[(r, g, b)])
+        out += pad
+    return bytes(out), clut
+
+
+def build_font(path, opts):
+    fontgen = os.path.join(HERE, "..", "fontgen", "fontgen.py")
+    with tempfile.TemporaryDirectory() as tmp:
+        cmd = [sys.executable, fontgen, path, "--store", "--name", "font", "-o", tmp]
+        for key in ("size", "bpp", "ranges", "chars", "text", "fallback"):
+            if key in opts:
+                cmd += ["--" + key, opts[key]]
+        if opts.get("compress", "0") not in ("0", "none"):
+            cmd.append("--compress")
+        if opts.get("kerning", "1") == "0":
+            cmd.append("--no-kerning")
+        subprocess.run(cmd, check=True, stdout=subprocess.DEVNULL)
+        with open(os.path.join(tmp, "font.bin"), "rb") as f:
+            return f.read()
+
+
+def read_manifest(path):
+    base = os.path.dirname(os.path.abspath(path))
+    items = []
+    with open(path, encoding="utf-8") as f:
+        for lineno, line in enumerate(f, 1):
+            line = line.split("#", 1)[0].strip()
+            if not line:
+                continue
+            parts = shlex.split(line)
+            if len(parts) < 3 or parts[1] not in ("image", "font", "blob"):
+                sys.exit("%s:%d: expected <name> image|font|blob <file> [key=value ...]" % (path, lineno))
+            opts = dict(p.split("=", 1) for p in parts[3:])
+            for key in ("text",):
+                if key in opts:
+                    opts[key] = os.path.join(base, opts[key])
+            if not re.match(r"^[A-Za-z_][A-Za-z0-9_]*$", parts[0]):
+                sys.exit("%s:%d: asset names must be C identifiers" % (path, lineno))
+            items.append((parts[0], parts[1], os.path.join(base, parts[2]), opts))
+    return items
+
+
+def build_asset(name, kind, path, opts, args):
+    """Returns (entry fields, data, clut)"""
+    if kind == "blob":
+        with open(path, "rb") as f:
+            return dict(width=0, height=0, pitch=0, format="blob", codec="none"), f.read(), None
+    if kind == "font":
+        return dict(width=0, height=0, pitch=0, format="font", codec="none"), build_font(path, opts), None
+
+    im = Image.open(path)
+    codec = opts.get("compress", "none")
+    if codec not in CODECS:
+        sys.exit("assetpack: %s: compress must be one of %s" % (name, ", ".join(CODECS)))
+    fmt = opts.get("format", "auto")
+    if fmt == "auto":
+        fmt = "rgb565" if codec != "none" else auto_format(im)
+    if fmt not in BPP:
+        sys.exit("assetpack: %s: unknown format %s" % (name, fmt))
+    if codec != "none" and fmt != "rgb565":
+        sys.exit("assetpack: %s: compressed images are RGB565" % name)
+
+    raw_size = im.width * im.height * 2
+    if fmt == "rgb565" and codec == "none" and args.compress:
+        data, _ = imgcodec.encode_lz4(im.convert("RGB"), args.window)
+        if len(data) * 3 <= raw_size * 2:   # Worth it from 1.5x
+            codec = "lz4"
+    if codec == "lz4":
+        data, _ = imgcodec.encode_lz4(im.convert("RGB"), args.window)
+        return dict(width=im.width, height=im.height, pitch=im.width, format=fmt, codec=codec), data, None
+    if codec == "qoi":
+        data, _ = imgcodec.encode_qoi(im, False)
+        return dict(width=im.width, height=im.height, pitch=im.width, format=fmt, codec=codec), data, None
+
+    pitch = pitch_for(im.width, BPP[fmt], args.row_align)
+    data, clut = pack_pixels(im, fmt, pitch)
+    return dict(width=im.width, height=im.height, pitch=pitch, format=fmt, codec="none"), data, clut
+
+
+def align(buf, n=ALIGN):
+    buf += b"\0" * (-len(buf) % n)
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Build a gfx_asset resource bundle")
+    ap.add_argument("manifest")
+    ap.add_argument("-o", "--output", required=True, help="bundle .bin")
+    ap.add_argument("--header", help="C header with the slot of every asset")
+    ap.add_argument("--compress", action="store_true", help="LZ4 every RGB565 image that shrinks by 1.5x or more")
+    ap.add_argument("--window", type=int, default=8192, help="LZ4 match window (<= GFX_IMG_LZ4_RING)")
+    ap.add_argument("--row-align", type=int, default=8, help="line pitch alignment in bytes")
+    args = ap.parse_args()
+
+    items = read_manifest(args.manifest)
+    if not items:
+        sys.exit("assetpack: empty manifest")
+    names = [it[0] for it in items]
+    if len(set(names)) != len(names):
+        sys.exit("assetpack: duplicate asset names")
+    disp, slot_of = perfect_hash(names)
+
+    n = len(items)
+    disp_offset = HEADER_SIZE
+    entry_offset = disp_offset + 4 * n
+    blob = bytearray(entry_offset + ENTRY_SIZE * n)
+    struct.pack_into("<%di" % n, blob, disp_offset, *disp)
+
+    name_offset = {}
+    for name in names:
+        name_offset[name] = len(blob)
+        blob += name.encode("utf-8") + b"\0"
+
+    entries = [None] * n
+    for name, kind, path, opts in items:
+        fields, data, clut = build_asset(name, kind, path, opts, args)
+        align(blob)
+        data_offset = len(blob)
+        blob += data
+        clut_offset = 0
+        if clut:
+            align(blob)
+            clut_offset = len(blob)
+            blob += clut
+        entries[slot_of[name]] = (name, fields, data_offset, len(data), clut_offset, len(clut or b"") // 4)
+        if fields["codec"] != "none" and len(data) >= fields["width"] * fields["height"] * 2:
+            print("assetpack: warning: %s does not shrink with %s" % (name, fields["codec"]))
+        print("%-20s %-9s %4dx%-4d pitch %-4d %-4s %7d bytes" % (
+            name, fields["format"], fields["width"], fields["height"], fields["pitch"],
+            fields["codec"] if fields["codec"] != "none" else "", len(data)))
+    align(blob)
+
+    for slot, (name, f, data_offset, size, clut_offset, clut_size) in enumerate(entries):
+        struct.pack_into("<IIIIHHHBBIHH", blob, entry_offset + slot * ENTRY_SIZE,
+                         fnv1a(name), name_offset[name], data_offset, size, f["width"], f["height"], f["pitch"],
+                         FORMATS.index(f["format"]), CODECS.index(f["codec"]), clut_offset, clut_size, 0)
+    struct.pack_into("<IHHIIIIII", blob, 0, MAGIC, VERSION, HEADER_SIZE, len(blob), n,
+                     disp_offset, entry_offset, 0, 0)
+
+    with open(args.output, "wb") as f:
+        f.write(blob)
+    print("%s: %d assets, %d bytes" % (args.output, n, len(blob)))
+
+    if args.header:
+        guard = "__%s__" % re.sub(r"[^0-9a-zA-Z]", "_", os.path.basename(args.header)).upper()
+        with open(args.header, "w", newline="\n") as out:
+            out.write("/* Generated by Tools/assetpack/assetpack.py, do not edit */\n")
+            out.write("#ifndef %s\n#define %s\n\n" % (guard, guard))
+            out.write("/* Slots for gfx_asset_at(), valid for this bundle only */\n")
+            for slot, e in enumerate(entries):
+                out.write("#define ASSET_%-24s %d\n" % (e[0].upper(), slot))
+            out.write("#define ASSET_COUNT                    %d\n\n" % n)
+            out.write("#endif /* %s */\n" % guard)
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
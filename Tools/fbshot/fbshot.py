@@ -0,0 +1,216 @@
+#!/usr/bin/env python3
+"""
+fbshot.py - rebuild PNG screenshots streamed by lcd_shot over the UART.
+
+The board answers "shot" (whole screen) or "shot x y w h" (region) with
+packets on the same UART as its log: 0xA5 0x5A, type, payload length
+(LE16), payload, CRC-16/CCITT-FALSE (LE) over type, length and payload.
+Anything between packets is log text, a packet with a bad CRC is skipped
+and only leaves a hole in the picture.
+
+  'H' header: version, encoding, x, y, w, h (LE16), tick (LE32), id (LE16)
+  'D' data:   id (LE16), first pixel (LE32), RLE codes
+  'E' end:    id (LE16), pixels (LE32), RLE bytes (LE32)
+
+RLE of RGB565 pixels in raster order of the region: control byte c < 0x80
+is c + 1 literal pixels (LE), c >= 0x80 the next pixel (c & 0x7F) + 2 times.
+
+Requires Pillow (pip install pillow), and pyserial for --port.
+
+Usage:
+  python fbshot.py --port /dev/ttyUSB0 -o screen.png
+  python fbshot.py --port COM5 --region 0,0,400,240 -o corner.png
+  python fbshot.py capture.bin -o screen.png --expect screen.ppm
+"""
+
+import argparse
+import struct
+import sys
+import time
+
+from PIL import Image
+
+SYNC = b"\xA5\x5A"
+HEAD_SIZE = 5
+CRC_SIZE = 2
+PAYLOAD_MAX = 256 - HEAD_SIZE - CRC_SIZE
+ENC_RLE565 = 1
+
+
+def crc16_ccitt(data):
+    crc = 0xFFFF
+    for b in data:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else crc << 1
+            crc &= 0xFFFF
+    return crc
+
+
+def packets(stream, log=None):
+    """(type, payload) of every packet with a good CRC, the bytes in between go to log"""
+    pos = 0
+    text_start = 0
+    while True:
+        i = stream.find(SYNC, pos)
+        if i < 0 or i + HEAD_SIZE > len(stream):
+            break
+        length = struct.unpack_from("<H", stream, i + 3)[0]
+        end = i + HEAD_SIZE + length + CRC_SIZE
+        if length > PAYLOAD_MAX or end > len(stream):
+            pos = i + 1
+            continue
+        body = stream[i + 2:i + HEAD_SIZE + length]
+        if crc16_ccitt(body) != struct.unpack_from("<H", stream, end - CRC_SIZE)[0]:
+            pos = i + 1
+            continue
+        if log is not None and i > text_start:
+            log.write(stream[text_start:i].decode("latin-1"))
+        yield chr(stream[i + 2]), bytes(stream[i + HEAD_SIZE:i + HEAD_SIZE + length])
+        pos = text_start = end
+    if log is not None and text_start < len(stream):
+        log.write(stream[text_start:].decode("latin-1"))
+
+
+def rgb565_to_rgb888(p):
+    r, g, b = p >> 11, (p >> 5) & 0x3F, p & 0x1F
+    return (r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2)
+
+
+class Shot:
+    def __init__(self, payload):
+        (self.version, self.encoding, self.x, self.y, self.w, self.h,
+         self.tick, self.id) = struct.unpack_from("<BBHHHHIH", payload)
+        if self.encoding != ENC_RLE565:
+            raise ValueError("shot %d: unknown encoding %d" % (self.id, self.encoding))
+        self.total = self.w * self.h
+        self.pixels = [0] * self.total
+        self.filled = bytearray(self.total)
+        self.ended = False
+
+    def data(self, payload):
+        index = struct.unpack_from("<I", payload, 2)[0]
+        pos = 6
+        while pos < len(payload) and index < self.total:
+            c = payload[pos]
+            pos += 1
+            if c & 0x80:
+                n = (c & 0x7F) + 2
+                values = [struct.unpack_from("<H", payload, pos)[0]] * n
+                pos += 2
+            else:
+                n = c + 1
+                values = list(struct.unpack_from("<%dH" % n, payload, pos))
+                pos += 2 * n
+            n = min(n, self.total - index)
+            self.pixels[index:index + n] = values[:n]
+            self.filled[index:index + n] = b"\x01" * n
+            index += n
+
+    def missing(self):
+        return self.total - sum(self.filled)
+
+    def image(self):
+        rgb = bytearray()
+        for p in self.pixels:
+            rgb += bytes(rgb565_to_rgb888(p))
+        return Image.frombytes("RGB", (self.w, self.h), bytes(rgb))
+
+
+def decode(stream, log=None):
+    shots = []
+    current = None
+    for kind, payload in packets(stream, log):
+        if kind == "H":
+            current = Shot(payload)
+            shots.append(current)
+            continue
+        if current is None or struct.unpack_from("<H", payload)[0] != current.id:
+            continue                                    # Data of a shot whose header was lost
+        if kind == "D":
+            current.data(payload)
+        elif kind == "E":
+            current.ended = True
+    return shots
+
+
+def capture(port, baud, region, timeout):
+    import serial                                       # pyserial, only needed here
+
+    command = "shot" if region is None else "shot %d %d %d %d" % region
+    stream = bytearray()
+    with serial.Serial(port, baud, timeout=0.2) as ser:
+        ser.reset_input_buffer()
+        ser.write(command.encode() + b"\r\n")
+        last = time.monotonic()
+        while time.monotonic() - last < timeout:
+            data = ser.read(4096)
+            if data:
+                stream += data
+                last = time.monotonic()
+                if any(kind == "E" for kind, _ in packets(stream[-(len(data) + 32):])):
+                    break
+    return stream
+
+
+def parse_region(text):
+    parts = text.split(",")
+    if len(parts) != 4 or not all(p.isdigit() for p in parts):
+        raise argparse.ArgumentTypeError("expected x,y,w,h, got %r" % text)
+    return tuple(int(p) for p in parts)
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Rebuild PNG screenshots streamed by lcd_shot")
+    ap.add_argument("input", nargs="?", help="captured UART stream, instead of --port")
+    ap.add_argument("-o", "--output", required=True, help="PNG, several shots get _<id> before the extension")
+    ap.add_argument("--port", help="serial port of the board, sends the shot command")
+    ap.add_argument("--baud", type=int, default=115200)
+    ap.add_argument("--region", type=parse_region, metavar="x,y,w,h", help="--port: capture only this region")
+    ap.add_argument("--timeout", type=float, default=5.0, help="--port: seconds without data before giving up")
+    ap.add_argument("--save", metavar="FILE", help="--port: also write the raw stream")
+    ap.add_argument("--log", action="store_true", help="print the text between the packets")
+    ap.add_argument("--expect", metavar="PPM", help="fail unless the (first) shot equals this image")
+    args = ap.parse_args()
+
+    if (args.input is None) == (args.port is None):
+        sys.exit("fbshot: give either a capture file or --port")
+    if args.port:
+        stream = capture(args.port, args.baud, args.region, args.timeout)
+        if args.save:
+            with open(args.save, "wb") as f:
+                f.write(stream)
+    else:
+        with open(args.input, "rb") as f:
+            stream = f.read()
+
+    shots = decode(stream, sys.stdout if args.log else None)
+    if not shots:
+        sys.exit("fbshot: no screenshot in %d bytes" % len(stream))
+
+    status = 0
+    for shot in shots:
+        path = args.output
+        if len(shots) > 1:
+            stem, dot, ext = args.output.rpartition(".")
+            path = "%s_%d.%s" % (stem, shot.id, ext) if dot else "%s_%d" % (args.output, shot.id)
+        shot.image().save(path)
+        missing = shot.missing()
+        print("%s: %dx%d at (%d, %d), tick %d ms, %d bytes for %d raw%s%s" % (
+            path, shot.w, shot.h, shot.x, shot.y, shot.tick, len(stream), shot.total * 2,
+            ", %d pixels missing" % missing if missing else "", "" if shot.ended else ", no end packet"))
+        if missing or not shot.ended:
+            status = 1
+
+    if args.expect:
+        want = Image.open(args.expect).convert("RGB")
+        got = shots[0].image()
+        if want.size != got.size or want.tobytes() != got.tobytes():
+            print("fbshot: shot %d differs from %s" % (shots[0].id, args.expect))
+            status = 1
+
+    return status
+
+
+if __name__ == "__main__":
+    sys.exit(main())
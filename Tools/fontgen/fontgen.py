@@ -0,0 +1,378 @@
+#!/usr/bin/env python3
+"""
+fontgen.py - pre-rasterise a TrueType/OpenType font into A4/A8 glyph bitmaps
+for gfx_font (App/Graphics/gfx_font.h).
+
+Writes <name>.c / <name>.h. Bitmaps, glyph table and kerning pairs are placed
+in .ro_data (RO_DATA region, 0x90200000), only the small gfx_font_t header
+lives in internal flash. Glyphs are sorted by codepoint, kerning pairs by
+(left << 16 | right), advances and kerning are in 1/16 pixel.
+
+Character set: --ranges and --chars add characters, --text adds every
+character used by a UI string file (UTF-8), so the font only carries what the
+firmware can display.
+
+--store writes a font store instead (<name>.bin, see gfx_font_store_t): one
+blob with a two-level codepoint index, for CJK sizes with thousands of
+glyphs. Flash it into RO_DATA and open it with gfx_font_open(), or add
+--c-array to also get it as a C array. --compress packs every glyph with
+PackBits when that makes it smaller (unpacked once, when the glyph enters
+the atlas).
+
+Requires Pillow with FreeType (pip install pillow). Kerning is read from the
+GPOS 'kern' feature when fontTools is installed (pip install fonttools).
+
+Usage:
+  python fontgen.py Lato-Regular.ttf --size 18 --bpp 4 --ranges 0x20-0x7E --name font_lato18 -o out/
+  python fontgen.py Lato-Regular.ttf --size 32 --bpp 8 --chars "0123456789.-%" --name font_digits32 -o out/
+  python fontgen.py NotoSansSC.otf --size 16 --store --compress --text strings_zh.txt --name font_sc16 -o out/
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+from PIL import Image, ImageDraw, ImageFont
+
+Q = 16  # 1/16 pixel
+
+
+def parse_ranges(text):
+    chars = set()
+    for part in text.split(","):
+        part = part.strip()
+        if not part:
+            continue
+        if "-" in part:
+            lo, hi = part.split("-", 1)
+            chars.update(range(int(lo, 0), int(hi, 0) + 1))
+        else:
+            chars.add(int(part, 0))
+    return chars
+
+
+def render_glyph(font, ch, baseline):
+    l, t, r, b = font.getbbox(ch, anchor="ls")
+    w, h = max(r - l, 0), max(b - t, 0)
+    if w == 0 or h == 0:
+        return 0, 0, 0, 0, b""
+    img = Image.new("L", (w, h), 0)
+    ImageDraw.Draw(img).text((-l, -t), ch, font=font, fill=255, anchor="ls")
+    bbox = img.getbbox()
+    if bbox is None:
+        return 0, 0, 0, 0, b""
+    # Drop empty borders left by the bounding box estimate
+    img = img.crop(bbox)
+    return img.width, img.height, l + bbox[0], baseline + t + bbox[1], img.tobytes()
+
+
+def pack(data, w, h, bpp):
+    if bpp == 8:
+        return data
+    out = bytearray()
+    for y in range(h):
+        row = data[y * w:(y + 1) * w]
+        for x in range(0, w, 2):
+            p0 = (row[x] * 15 + 127) // 255
+            p1 = (row[x + 1] * 15 + 127) // 255 if x + 1 < w else 0
+            out.append(p0 | (p1 << 4))          # First pixel in the low nibble, as DMA2D A4
+    return bytes(out)
+
+
+def packbits(data):
+    """n < 128: n + 1 literals, n > 128: next byte 257 - n times"""
+    out = bytearray()
+    i, n = 0, len(data)
+    while i < n:
+        j = i + 1
+        while j < n and data[j] == data[i] and j - i < 128:
+            j += 1
+        if j - i >= 3:
+            out += bytes((257 - (j - i), data[i]))
+            i = j
+            continue
+        j = i
+        while j < n and j - i < 128 and not (j + 2 < n and data[j] == data[j + 1] == data[j + 2]):
+            j += 1
+        out.append(j - i - 1)
+        out += data[i:j]
+        i = j
+    return bytes(out)
+
+
+def unpackbits(data, size):
+    out = bytearray()
+    i = 0
+    while i < len(data) and len(out) < size:
+        n = data[i]
+        i += 1
+        if n < 128:
+            out += data[i:i + n + 1]
+            i += n + 1
+        elif n > 128:
+            out += bytes((data[i],)) * (257 - n)
+            i += 1
+    return bytes(out[:size])
+
+
+def build_index(cps):
+    """Two-level index of gfx_font_store_t: l1[256] -> page of bits / base / rank"""
+    l1 = [0xFFFF] * 256
+    pages = []
+    for gi, cp in enumerate(cps):
+        hi, lo = cp >> 8, cp & 0xFF
+        if l1[hi] == 0xFFFF:
+            l1[hi] = len(pages)
+            pages.append({"bits": [0] * 8, "base": gi})
+        pages[l1[hi]]["bits"][lo >> 5] |= 1 << (lo & 31)
+    for p in pages:
+        rank, acc = [], 0
+        for w in p["bits"]:
+            rank.append(acc)
+            acc += bin(w).count("1")
+        p["rank"] = rank
+    return l1, pages
+
+
+def align(buf, n):
+    buf += b"\0" * (-len(buf) % n)
+
+
+def write_store(path, args, glyphs, bitmaps, kerns, ascent, descent):
+    cps = [g[0] for g in glyphs]
+    if cps and cps[-1] > 0xFFFF:
+        sys.exit("fontgen: the store index covers the BMP only (U+%04X)" % cps[-1])
+    l1, pages = build_index(cps)
+
+    header_size = 48
+    blob = bytearray(header_size)
+    l1_offset = len(blob)
+    blob += struct.pack("<256H", *l1)
+    page_offset = len(blob)
+    for p in pages:
+        blob += struct.pack("<8II8B", *p["bits"], p["base"], *p["rank"])
+    glyph_offset = len(blob)
+    for g in glyphs:
+        blob += struct.pack("<IIHBBbbH", *g)
+    kern_offset = len(blob)
+    for pair, k in kerns:
+        blob += struct.pack("<IhH", pair, k, 0)
+    align(blob, 32)
+    bitmap_offset = len(blob)
+    blob += bitmaps
+    align(blob, 4)
+
+    struct.pack_into("<IHHII4BIIIIIII", blob, 0, 0x544E4647, 1, header_size, len(blob), len(glyphs),
+                     args.bpp, ascent + descent, ascent, 0, ord(args.fallback),
+                     l1_offset, page_offset, glyph_offset, bitmap_offset, kern_offset, len(kerns))
+    with open(path, "wb") as f:
+        f.write(blob)
+    return bytes(blob), len(pages)
+
+
+def gpos_kerning(path, size, cps):
+    """Pair adjustments of the 'kern' feature (GPOS) or the legacy kern table, pixels"""
+    from fontTools.ttLib import TTFont
+
+    tt = TTFont(path)
+    cmap = tt.getBestCmap()
+    scale = size / tt["head"].unitsPerEm
+    names = {}
+    for cp in cps:
+        if cp in cmap:
+            names.setdefault(cmap[cp], []).append(cp)
+    kern = {}
+
+    def put(left, right, value):
+        if value and left in names and right in names:
+            for a in names[left]:
+                for b in names[right]:
+                    kern.setdefault((a, b), value)     # First subtable wins, as in a shaper
+
+    if "GPOS" in tt and tt["GPOS"].table.FeatureList is not None:
+        gpos = tt["GPOS"].table
+        indices = []
+        for rec in gpos.FeatureList.FeatureRecord:
+            if rec.FeatureTag == "kern":
+                indices += [i for i in rec.Feature.LookupListIndex if i not in indices]
+        for i in indices:
+            lookup = gpos.LookupList.Lookup[i]
+            for sub in lookup.SubTable:
+                if lookup.LookupType == 9:
+                    sub = sub.ExtSubTable
+                if sub.LookupType != 2:
+                    continue
+                if sub.Format == 1:
+                    for left, pset in zip(sub.Coverage.glyphs, sub.PairSet):
+                        for rec in pset.PairValueRecord:
+                            v = getattr(rec.Value1, "XAdvance", 0) if rec.Value1 else 0
+                            put(left, rec.SecondGlyph, v)
+                elif sub.Format == 2:
+                    cls1, cls2 = sub.ClassDef1.classDefs, sub.ClassDef2.classDefs
+                    for left in sub.Coverage.glyphs:
+                        if left not in names:
+                            continue
+                        row = sub.Class1Record[cls1.get(left, 0)].Class2Record
+                        for right in names:
+                            rec = row[cls2.get(right, 0)]
+                            put(left, right, getattr(rec.Value1, "XAdvance", 0) if rec.Value1 else 0)
+    elif "kern" in tt:
+        for sub in tt["kern"].kernTables:
+            for (left, right), v in sub.kernTable.items():
+                put(left, right, v)
+
+    return {pair: v * scale for pair, v in kern.items()}
+
+
+def font_cmap(path):
+    """Codepoints the font maps to a glyph, None without fontTools"""
+    try:
+        from fontTools.ttLib import TTFont
+    except ImportError:
+        return None
+    return set(TTFont(path, lazy=True).getBestCmap())
+
+
+def kerning_pairs(font, path, size, cps):
+    try:
+        kern = gpos_kerning(path, size, cps)
+    except ImportError:
+        # No fontTools: whatever the layout engine of Pillow applies
+        chars = [chr(c) for c in cps]
+        adv = {c: font.getlength(c) for c in chars}
+        kern = {(ord(a), ord(b)): font.getlength(a + b) - adv[a] - adv[b] for a in chars for b in chars}
+    pairs = [((a << 16) | b, round(v * Q)) for (a, b), v in kern.items()]
+    return sorted(p for p in pairs if p[1])
+
+
+def emit_bytes(out, data, per_line=16):
+    for i in range(0, len(data), per_line):
+        out.write("    " + ", ".join("0x%02X" % b for b in data[i:i + per_line]) + ",\n")
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Rasterise a font for gfx_font")
+    ap.add_argument("font", help="TrueType / OpenType file")
+    ap.add_argument("--size", type=int, required=True, help="pixel size")
+    ap.add_argument("--bpp", type=int, choices=(4, 8), default=4)
+    ap.add_argument("--ranges", default="", help="codepoint ranges, e.g. 0x20-0x7E,0xB0")
+    ap.add_argument("--chars", default="", help="characters to include")
+    ap.add_argument("--text", action="append", default=[], help="UTF-8 string table, every character used is included")
+    ap.add_argument("--fallback", default="?", help="character drawn for missing codepoints")
+    ap.add_argument("--no-kerning", action="store_true")
+    ap.add_argument("--compress", action="store_true", help="PackBits per glyph when smaller")
+    ap.add_argument("--store", action="store_true", help="write a font store <name>.bin")
+    ap.add_argument("--c-array", action="store_true", help="with --store: also emit the store as a C array")
+    ap.add_argument("--name", required=True, help="C symbol of the gfx_font_t")
+    ap.add_argument("-o", "--outdir", default=".")
+    args = ap.parse_args()
+
+    font = ImageFont.truetype(args.font, args.size)
+    ascent, descent = font.getmetrics()
+
+    cps = parse_ranges(args.ranges) | {ord(c) for c in args.chars} | {ord(args.fallback)}
+    for path in args.text:
+        with open(path, encoding="utf-8") as f:
+            cps |= {ord(c) for c in f.read() if c >= " "}
+    cmap = font_cmap(args.font)
+    if cmap is not None:
+        # Missing characters are left out so gfx_font draws the fallback glyph,
+        # a space is kept for its advance
+        missing = {c for c in cps if c not in cmap and c != 0x20}
+        if ord(args.fallback) in missing:
+            sys.exit("fontgen: the fallback U+%04X is not in the font" % ord(args.fallback))
+        if missing:
+            print("fontgen: %d characters not in the font, left out" % len(missing))
+        cps -= missing
+    cps = sorted(cps)
+
+    glyphs = []
+    bitmaps = bytearray()
+    raw_bytes = 0
+    for cp in cps:
+        w, h, left, top, data = render_glyph(font, chr(cp), ascent)
+        if w > 255 or h > 255 or not (-128 <= left < 128 and -128 <= top < 128):
+            sys.exit("fontgen: glyph U+%04X too large" % cp)
+        packed = pack(data, w, h, args.bpp)
+        size = 0
+        if args.compress and packed:
+            small = packbits(packed)
+            assert unpackbits(small, len(packed)) == packed
+            if len(small) < len(packed) and len(small) <= 0xFFFF:
+                packed, size = small, len(small)
+        raw_bytes += len(pack(data, w, h, args.bpp)) if size else len(packed)
+        glyphs.append((cp, len(bitmaps), round(font.getlength(chr(cp)) * Q), w, h, left, top, size))
+        bitmaps += packed
+
+    bmp_cps = [c for c in cps if c <= 0xFFFF]
+    kerns = [] if args.no_kerning else kerning_pairs(font, args.font, args.size, bmp_cps)
+
+    os.makedirs(args.outdir, exist_ok=True)
+    guard = "__%s_H__" % args.name.upper()
+    src = os.path.basename(args.font)
+    summary = "%s, %d px, A%d, %d glyphs, %d kerning pairs, %d bitmap bytes" % (
+        src, args.size, args.bpp, len(glyphs), len(kerns), len(bitmaps))
+    if args.compress:
+        summary += " (%d unpacked)" % raw_bytes
+
+    if args.store:
+        blob, npages = write_store(os.path.join(args.outdir, args.name + ".bin"), args, glyphs, bitmaps, kerns,
+                                   ascent, descent)
+        summary += ", store %d bytes, %d index pages" % (len(blob), npages)
+        if args.c_array:
+            with open(os.path.join(args.outdir, args.name + ".h"), "w", newline="\n") as out:
+                out.write("/* Generated by Tools/fontgen/fontgen.py, do not edit */\n")
+                out.write("#ifndef %s\n#define %s\n\n#include <stdint.h>\n\n" % (guard, guard))
+                out.write("/* %s, open with gfx_font_open(&font, (uint32_t)%s_store) */\n" % (summary, args.name))
+                out.write("extern const uint8_t %s_store[%d];\n\n" % (args.name, len(blob)))
+                out.write("#endif /* %s */\n" % guard)
+            with open(os.path.join(args.outdir, args.name + ".c"), "w", newline="\n") as out:
+                out.write("/* Generated by Tools/fontgen/fontgen.py, do not edit */\n")
+                out.write("/* %s */\n\n" % summary)
+                out.write("#include \"%s.h\"\n\n" % args.name)
+                out.write("__attribute__((section(\".ro_data\"), aligned(32))) const uint8_t %s_store[%d] = {\n"
+                          % (args.name, len(blob)))
+                emit_bytes(out, blob)
+                out.write("};\n")
+        print("%s: %s" % (args.name, summary))
+        return 0
+
+    with open(os.path.join(args.outdir, args.name + ".h"), "w", newline="\n") as out:
+        out.write("/* Generated by Tools/fontgen/fontgen.py, do not edit */\n")
+        out.write("#ifndef %s\n#define %s\n\n#include \"gfx_font.h\"\n\n" % (guard, guard))
+        out.write("extern const gfx_font_t %s;       // %s, %d px, A%d\n\n" % (args.name, src, args.size, args.bpp))
+        out.write("#endif /* %s */\n" % guard)
+
+    with open(os.path.join(args.outdir, args.name + ".c"), "w", newline="\n") as out:
+        out.write("/* Generated by Tools/fontgen/fontgen.py, do not edit */\n")
+        out.write("/* %s */\n\n" % summary)
+        out.write("#include \"%s.h\"\n\n" % args.name)
+        out.write("#define FONT_DATA __attribute__((section(\".ro_data\"), aligned(32)))\n\n")
+        out.write("FONT_DATA static const uint8_t %s_bitmaps[%d] = {\n" % (args.name, max(len(bitmaps), 1)))
+        emit_bytes(out, bitmaps or b"\0")
+        out.write("};\n\n")
+        out.write("/* codepoint, offset, advance, width, height, left, top, packed size */\n")
+        out.write("FONT_DATA static const gfx_glyph_t %s_glyphs[%d] = {\n" % (args.name, len(glyphs)))
+        for g in glyphs:
+            out.write("    { 0x%04X, %6d, %4d, %3d, %3d, %4d, %4d, %4d },\n" % g)
+        out.write("};\n\n")
+        if kerns:
+            out.write("FONT_DATA static const gfx_kern_t %s_kerns[%d] = {\n" % (args.name, len(kerns)))
+            for pair, k in kerns:
+                out.write("    { 0x%08X, %4d, 0 },\n" % (pair, k))
+            out.write("};\n\n")
+        out.write("const gfx_font_t %s = {\n" % args.name)
+        out.write("    .glyphs = %s_glyphs,\n" % args.name)
+        out.write("    .bitmaps = %s_bitmaps,\n" % args.name)
+        out.write("    .kerns = %s,\n" % ((args.name + "_kerns") if kerns else "NULL"))
+        out.write("    .glyph_count = %d,\n    .kern_count = %d,\n" % (len(glyphs), len(kerns)))
+        out.write("    .bpp = %d,\n    .line_height = %d,\n    .baseline = %d,\n" % (args.bpp, ascent + descent, ascent))
+        out.write("    .fallback = 0x%04X,\n};\n" % ord(args.fallback))
+
+    print("%s: %s" % (args.name, summary))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
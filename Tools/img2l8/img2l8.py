@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+"""
+img2l8.py - convert RGB images to L8 (8-bit CLUT index) C arrays for lcd_l8.
+
+Palette modes:
+  rgb332    fixed 3-3-2 palette, identical to lcd_l8_default_clut(), no CLUT
+            is emitted and every image can be drawn without reloading the CLUT.
+  adaptive  one median-cut palette shared by all input images, emitted as
+            <name>_clut[256] (ARGB8888) to be passed to lcd_l8_load_clut().
+
+Arrays are placed in .ro_data (RO_DATA region, 0x90200000) and aligned to a
+32 byte cache line so DMA2D and the D-cache fetch whole lines. They are
+defined in <output>.c and declared extern in <output>.h, so the header can
+be included from any number of files.
+
+Requires Pillow (pip install pillow).
+
+Usage:
+  python img2l8.py -o ui_assets.h --name ui --palette adaptive bg.png icon.png
+  (writes ui_assets.h and ui_assets.c)
+"""
+
+import argparse
+import os
+import re
+import sys
+
+from PIL import Image
+
+
+def rgb332_palette():
+    pal = []
+    for i in range(256):
+        r = (i >> 5) & 0x07
+        g = (i >> 2) & 0x07
+        b = i & 0x03
+        r = (r << 5) | (r << 2) | (r >> 1)
+        g = (g << 5) | (g << 2) | (g >> 1)
+        b = (b << 6) | (b << 4) | (b << 2) | b
+        pal.append((r, g, b))
+    return pal
+
+
+def adaptive_palette(images):
+    # Stack all images into one strip so they share a single palette
+    width = max(im.width for im in images)
+    height = sum(im.height for im in images)
+    strip = Image.new("RGB", (width, height))
+    y = 0
+    for im in images:
+        strip.paste(im, (0, y))
+        y += im.height
+    q = strip.quantize(colors=256, method=Image.Quantize.MEDIANCUT)
+    flat = q.getpalette()[:256 * 3]
+    flat += [0] * (256 * 3 - len(flat))
+    return [tuple(flat[i * 3:i * 3 + 3]) for i in range(256)]
+
+
+def palette_image(pal):
+    img = Image.new("P", (1, 1))
+    flat = []
+    for rgb in pal:
+        flat.extend(rgb)
+    img.putpalette(flat)
+    return img
+
+
+def c_name(path):
+    base = os.path.splitext(os.path.basename(path))[0]
+    return re.sub(r"[^0-9a-zA-Z_]", "_", base).lower()
+
+
+def emit_bytes(out, data, per_line=16):
+    for i in range(0, len(data), per_line):
+        chunk = data[i:i + per_line]
+        out.write("    " + ", ".join("0x%02X" % b for b in chunk) + ",\n")
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Convert images to L8 C arrays")
+    ap.add_argument("images", nargs="+")
+    ap.add_argument("-o", "--output", required=True, help="output header, the arrays go to the .c next to it")
+    ap.add_argument("--name", default="assets", help="prefix for the CLUT symbol")
+    ap.add_argument("--palette", choices=("rgb332", "adaptive"), default="rgb332")
+    ap.add_argument("--dither", action="store_true", help="Floyd-Steinberg dithering")
+    args = ap.parse_args()
+
+    images = [Image.open(p).convert("RGB") for p in args.images]
+    pal = rgb332_palette() if args.palette == "rgb332" else adaptive_palette(images)
+    pal_img = palette_image(pal)
+    dither = Image.Dither.FLOYDSTEINBERG if args.dither else Image.Dither.NONE
+
+    guard = "__%s__" % re.sub(r"[^0-9a-zA-Z]", "_", os.path.basename(args.output)).upper()
+    source = os.path.splitext(args.output)[0] + ".c"
+    with open(args.output, "w", newline="\n") as hdr, open(source, "w", newline="\n") as out:
+        hdr.write("/* Generated by Tools/img2l8/img2l8.py, do not edit */\n")
+        hdr.write("#ifndef %s\n#define %s\n\n#include <stdint.h>\n\n" % (guard, guard))
+        out.write("/* Generated by Tools/img2l8/img2l8.py, do not edit */\n\n")
+        out.write("#include \"%s\"\n\n" % os.path.basename(args.output))
+        out.write("#define L8_ASSET __attribute__((section(\".ro_data\"), aligned(32)))\n\n")
+
+        if args.palette == "adaptive":
+            hdr.write("extern const uint32_t %s_clut[256];\n\n" % args.name)
+            out.write("L8_ASSET const uint32_t %s_clut[256] = {\n" % args.name)
+            for i in range(0, 256, 4):
+                out.write("    " + ", ".join("0xFF%02X%02X%02X" % pal[j] for j in range(i, i + 4)) + ",\n")
+            out.write("};\n\n")
+
+        for path, im in zip(args.images, images):
+            name = c_name(path)
+            idx = im.quantize(palette=pal_img, dither=dither)
+            data = idx.tobytes()
+            hdr.write("#define %s_WIDTH %d\n#define %s_HEIGHT %d\n" % (name.upper(), im.width, name.upper(), im.height))
+            hdr.write("extern const uint8_t %s_l8[%d];\n\n" % (name, len(data)))
+            out.write("L8_ASSET const uint8_t %s_l8[%d] = {\n" % (name, len(data)))
+            emit_bytes(out, data)
+            out.write("};\n\n")
+
+        hdr.write("#endif /* %s */\n" % guard)
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
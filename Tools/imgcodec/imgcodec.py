@@ -0,0 +1,239 @@
+#!/usr/bin/env python3
+"""
+imgcodec.py - compress images for the streaming decoders of gfx_image.
+
+Formats:
+  lz4   RGB565 pixels as one LZ4 block behind a gfx_img_lz4_header_t.
+        Match offsets are limited to --window bytes (default 8192, must not
+        exceed GFX_IMG_LZ4_RING) so the decoder history fits its ring.
+        Good for UI art with flat areas and repeated patterns.
+  qoi   standard QOI (qoiformat.org), RGB or RGBA (--alpha). Good for photos
+        and gradients, decoded to RGB565 by gfx_img_decode().
+
+Arrays are placed in .ro_data (RO_DATA region, 0x90200000) and aligned to a
+32 byte cache line; draw them with
+  gfx_img_draw(&canvas, (uint32_t)name_lz4, sizeof(name_lz4), x, y);
+
+Requires Pillow (pip install pillow).
+
+Usage:
+  python imgcodec.py -o ui_images.h --format lz4 bg.png icon.png
+  python imgcodec.py -o photos.h --format qoi --bin out/ photo.png
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+from PIL import Image
+
+LZ4_MAGIC = b"Z565"
+LZ4_MIN_MATCH = 4
+LZ4_LAST_LITERALS = 5                   # Format rule: the block ends with literals
+LZ4_MF_LIMIT = 12                       # No match starts in the last 12 bytes
+
+
+def rgb565_bytes(im):
+    rgb = im.convert("RGB").tobytes()
+    out = bytearray()
+    for i in range(0, len(rgb), 3):
+        r, g, b = rgb[i], rgb[i + 1], rgb[i + 2]
+        out += struct.pack("<H", ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3))
+    return bytes(out)
+
+
+def lz4_length(out, n):
+    while n >= 255:
+        out.append(255)
+        n -= 255
+    out.append(n)
+
+
+def lz4_sequence(out, literals, offset, match):
+    lit = len(literals)
+    token = (min(lit, 15) << 4) | (min(match - LZ4_MIN_MATCH, 15) if match else 0)
+    out.append(token)
+    if lit >= 15:
+        lz4_length(out, lit - 15)
+    out += literals
+    if match:
+        out += struct.pack("<H", offset)
+        if match - LZ4_MIN_MATCH >= 15:
+            lz4_length(out, match - LZ4_MIN_MATCH - 15)
+
+
+def lz4_compress(data, window):
+    """Greedy LZ4 block compressor, offsets <= window"""
+    n = len(data)
+    out = bytearray()
+    last = {}
+    ip = anchor = 0
+    limit = n - LZ4_MF_LIMIT
+    while ip < limit:
+        key = data[ip:ip + 4]
+        ref = last.get(key)
+        last[key] = ip
+        if ref is None or ip - ref > window:
+            ip += 1
+            continue
+        length = 4
+        end = n - LZ4_LAST_LITERALS
+        while ip + length < end and data[ref + length] == data[ip + length]:
+            length += 1
+        lz4_sequence(out, data[anchor:ip], ip - ref, length)
+        for i in range(ip + 1, ip + length):
+            if i < limit:
+                last[data[i:i + 4]] = i
+        ip += length
+        anchor = ip
+    lz4_sequence(out, data[anchor:], 0, 0)
+    return bytes(out)
+
+
+def lz4_decompress(block, size):
+    out = bytearray()
+    i = 0
+    while i < len(block):
+        token = block[i]
+        i += 1
+        lit = token >> 4
+        if lit == 15:
+            while True:
+                b = block[i]
+                i += 1
+                lit += b
+                if b != 255:
+                    break
+        out += block[i:i + lit]
+        i += lit
+        if i >= len(block):
+            break
+        offset = block[i] | (block[i + 1] << 8)
+        i += 2
+        match = token & 15
+        if match == 15:
+            while True:
+                b = block[i]
+                i += 1
+                match += b
+                if b != 255:
+                    break
+        for _ in range(match + LZ4_MIN_MATCH):
+            out.append(out[-offset])
+    assert len(out) == size
+    return bytes(out)
+
+
+def encode_lz4(im, window):
+    raw = rgb565_bytes(im)
+    block = lz4_compress(raw, window)
+    assert lz4_decompress(block, len(raw)) == raw
+    header = LZ4_MAGIC + struct.pack("<HHIHH", im.width, im.height, len(block), window, 0)
+    return header + block, len(raw)
+
+
+def qoi_hash(px):
+    r, g, b, a = px
+    return (r * 3 + g * 5 + b * 7 + a * 11) % 64
+
+
+def encode_qoi(im, alpha):
+    channels = 4 if alpha else 3
+    rgba = im.convert("RGBA").tobytes()
+    pixels = [tuple(rgba[i:i + 4]) for i in range(0, len(rgba), 4)]
+    if not alpha:
+        pixels = [(r, g, b, 255) for r, g, b, _ in pixels]
+    out = bytearray(b"qoif" + struct.pack(">IIBB", im.width, im.height, channels, 0))
+    index = [(0, 0, 0, 0)] * 64
+    prev = (0, 0, 0, 255)
+    run = 0
+    for i, px in enumerate(pixels):
+        if px == prev:
+            run += 1
+            if run == 62 or i == len(pixels) - 1:
+                out.append(0xC0 | (run - 1))
+                run = 0
+            continue
+        if run:
+            out.append(0xC0 | (run - 1))
+            run = 0
+        h = qoi_hash(px)
+        if index[h] == px:
+            out.append(h)
+        else:
+            index[h] = px
+            if px[3] != prev[3]:
+                out += bytes((0xFF,) + px)
+            else:
+                dr = (px[0] - prev[0] + 128) % 256 - 128
+                dg = (px[1] - prev[1] + 128) % 256 - 128
+                db = (px[2] - prev[2] + 128) % 256 - 128
+                if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                    out.append(0x40 | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2))
+                elif -32 <= dg <= 31 and -8 <= dr - dg <= 7 and -8 <= db - dg <= 7:
+                    out.append(0x80 | (dg + 32))
+                    out.append(((dr - dg + 8) << 4) | (db - dg + 8))
+                else:
+                    out += bytes((0xFE,) + px[:3])
+        prev = px
+    out += b"\0" * 7 + b"\1"
+    return bytes(out), im.width * im.height * 2
+
+
+def c_name(path):
+    base = os.path.splitext(os.path.basename(path))[0]
+    return re.sub(r"[^0-9a-zA-Z_]", "_", base).lower()
+
+
+def emit_bytes(out, data, per_line=16):
+    for i in range(0, len(data), per_line):
+        chunk = data[i:i + per_line]
+        out.write("    " + ", ".join("0x%02X" % b for b in chunk) + ",\n")
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Compress images for gfx_image (LZ4 RGB565 / QOI)")
+    ap.add_argument("images", nargs="+")
+    ap.add_argument("-o", "--output", required=True, help="output header")
+    ap.add_argument("--format", choices=("lz4", "qoi"), default="lz4")
+    ap.add_argument("--window", type=int, default=8192, help="LZ4 match window in bytes")
+    ap.add_argument("--alpha", action="store_true", help="QOI: keep the alpha channel")
+    ap.add_argument("--bin", metavar="DIR", help="also write each image as a raw .lz4 / .qoi file")
+    args = ap.parse_args()
+
+    if not 4 <= args.window <= 65535:
+        sys.exit("imgcodec: --window must be 4..65535")
+
+    guard = "__%s__" % re.sub(r"[^0-9a-zA-Z]", "_", os.path.basename(args.output)).upper()
+    with open(args.output, "w", newline="\n") as out:
+        out.write("/* Generated by Tools/imgcodec/imgcodec.py, do not edit */\n")
+        out.write("#ifndef %s\n#define %s\n\n#include <stdint.h>\n\n" % (guard, guard))
+        out.write("#define IMG_ASSET __attribute__((section(\".ro_data\"), aligned(32)))\n\n")
+
+        for path in args.images:
+            im = Image.open(path)
+            name = c_name(path)
+            if args.format == "lz4":
+                data, raw = encode_lz4(im, args.window)
+            else:
+                data, raw = encode_qoi(im, args.alpha)
+            print("%s: %dx%d, %d -> %d bytes (%.2fx)" % (name, im.width, im.height, raw, len(data),
+                                                        raw / float(len(data))))
+            if args.bin:
+                os.makedirs(args.bin, exist_ok=True)
+                with open(os.path.join(args.bin, "%s.%s" % (name, args.format)), "wb") as f:
+                    f.write(data)
+            out.write("#define %s_WIDTH %d\n#define %s_HEIGHT %d\n" % (name.upper(), im.width, name.upper(), im.height))
+            out.write("IMG_ASSET const uint8_t %s_%s[%d] = {\n" % (name, args.format, len(data)))
+            emit_bytes(out, data)
+            out.write("};\n\n")
+
+        out.write("#endif /* %s */\n" % guard)
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,139 @@
+#!/usr/bin/env python3
+"""
+mjpeg.py - encode images as baseline JPEG / raw MJPEG for gfx_jpeg.
+
+A raw MJPEG stream is JPEG frames back to back, each one complete with its
+own quantisation and Huffman tables (the decoder refuses frames without
+DHT). Every frame is baseline, YCbCr, with the sub-sampling the DMA2D
+YCbCr input understands: 4:4:4, 4:2:2 or 4:2:0.
+
+Frames are the input images in order, or with --pan a window of WxH moving
+across one image (scaled so it is 25% larger than the window), which makes
+a test clip for gfx_mjpeg_next() out of a single photo.
+
+Play it with
+  gfx_mjpeg_open(&mjpeg, clip_mjpeg, sizeof(clip_mjpeg), true);
+  gfx_mjpeg_next(&mjpeg, &frame, &size);
+  gfx_jpeg_draw(&canvas, frame, size, 0, 0);
+
+Requires Pillow (pip install pillow).
+
+Usage:
+  python mjpeg.py -o photo.jpg --subsampling 420 photo.png
+  python mjpeg.py -o clip.mjpeg --pan 800x480 --frames 30 --header clip.h photo.png
+"""
+
+import argparse
+import io
+import os
+import re
+import sys
+
+from PIL import Image
+
+SUBSAMPLING = {"444": 0, "422": 1, "420": 2}     # Pillow values
+
+
+def parse_size(text):
+    m = re.fullmatch(r"(\d+)x(\d+)", text)
+    if not m or int(m.group(1)) == 0 or int(m.group(2)) == 0:
+        raise argparse.ArgumentTypeError("expected WxH, got %r" % text)
+    return int(m.group(1)), int(m.group(2))
+
+
+def c_name(path):
+    base = os.path.splitext(os.path.basename(path))[0]
+    return re.sub(r"[^0-9a-zA-Z_]", "_", base).lower()
+
+
+def emit_bytes(out, data, per_line=16):
+    for i in range(0, len(data), per_line):
+        chunk = data[i:i + per_line]
+        out.write("    " + ", ".join("0x%02X" % b for b in chunk) + ",\n")
+
+
+def pan_frames(im, size, count):
+    w, h = size
+    scale = max(w * 1.25 / im.width, h * 1.25 / im.height)
+    big = im.resize((max(w, round(im.width * scale)), max(h, round(im.height * scale))), Image.LANCZOS)
+    frames = []
+    for i in range(count):
+        t = i / (count - 1) if count > 1 else 0.0
+        x = round((big.width - w) * t)
+        y = round((big.height - h) * t)
+        frames.append(big.crop((x, y, x + w, y + h)))
+    return frames
+
+
+def encode(im, quality, subsampling, restart):
+    opts = {"quality": quality, "subsampling": SUBSAMPLING[subsampling], "optimize": False, "progressive": False}
+    if restart:
+        opts["restart_marker_blocks"] = restart
+    buf = io.BytesIO()
+    im.convert("RGB").save(buf, "JPEG", **opts)
+    return buf.getvalue()
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Encode images as baseline JPEG / raw MJPEG for gfx_jpeg")
+    ap.add_argument("images", nargs="+")
+    ap.add_argument("-o", "--output", required=True, help="output .jpg / .mjpeg (frames back to back)")
+    ap.add_argument("--quality", type=int, default=85)
+    ap.add_argument("--subsampling", choices=sorted(SUBSAMPLING), default="420")
+    ap.add_argument("--restart", type=int, default=0, metavar="N", help="restart marker every N MCUs")
+    ap.add_argument("--size", type=parse_size, metavar="WxH", help="resize every image first")
+    ap.add_argument("--pan", type=parse_size, metavar="WxH", help="frames are a WxH window panning over one image")
+    ap.add_argument("--frames", type=int, default=30, help="--pan: frame count")
+    ap.add_argument("--header", metavar="FILE", help="also write a C header with the stream in .ro_data")
+    ap.add_argument("--ref", metavar="DIR", help="write every frame as decoded by Pillow to DIR/<name>_NNN.ppm")
+    args = ap.parse_args()
+
+    if not 1 <= args.quality <= 100:
+        sys.exit("mjpeg: --quality must be 1..100")
+    if args.pan and len(args.images) != 1:
+        sys.exit("mjpeg: --pan takes exactly one image")
+    if args.frames < 1:
+        sys.exit("mjpeg: --frames must be at least 1")
+
+    if args.pan:
+        frames = pan_frames(Image.open(args.images[0]).convert("RGB"), args.pan, args.frames)
+    else:
+        frames = [Image.open(path).convert("RGB") for path in args.images]
+    if args.size:
+        frames = [im.resize(args.size, Image.LANCZOS) for im in frames]
+    for im in frames:
+        if im.width > 65535 or im.height > 65535:
+            sys.exit("mjpeg: frame too large")
+
+    name = c_name(args.output)
+    stream = bytearray()
+    for i, im in enumerate(frames):
+        data = encode(im, args.quality, args.subsampling, args.restart)
+        stream += data
+        if args.ref:
+            os.makedirs(args.ref, exist_ok=True)
+            Image.open(io.BytesIO(data)).convert("RGB").save(os.path.join(args.ref, "%s_%03d.ppm" % (name, i)))
+
+    with open(args.output, "wb") as f:
+        f.write(stream)
+    print("%s: %d frame(s) %dx%d, %s, %d bytes (%.1f KB per frame)" % (
+        name, len(frames), frames[0].width, frames[0].height, args.subsampling, len(stream),
+        len(stream) / 1024.0 / len(frames)))
+
+    if args.header:
+        guard = "__%s__" % re.sub(r"[^0-9a-zA-Z]", "_", os.path.basename(args.header)).upper()
+        with open(args.header, "w", newline="\n") as out:
+            out.write("/* Generated by Tools/mjpeg/mjpeg.py, do not edit */\n")
+            out.write("#ifndef %s\n#define %s\n\n#include <stdint.h>\n\n" % (guard, guard))
+            out.write("#define MJPEG_ASSET __attribute__((section(\".ro_data\"), aligned(32)))\n\n")
+            out.write("#define %s_WIDTH %d\n#define %s_HEIGHT %d\n#define %s_FRAMES %d\n" % (
+                name.upper(), frames[0].width, name.upper(), frames[0].height, name.upper(), len(frames)))
+            out.write("MJPEG_ASSET const uint8_t %s_mjpeg[%d] = {\n" % (name, len(stream)))
+            emit_bytes(out, stream)
+            out.write("};\n\n#endif /* %s */\n" % guard)
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())